@@ -18,6 +18,11 @@
 #include "Globals.h"
 #include "Util.h"
 
+extern void AddSnapshotField(const std::string &class_name,
+                             const std::string &type,
+                             const std::string &method_name,
+                             llvm::StringRef getter);
+
 namespace {
 
 static llvm::StringRef meth_name_ref;
@@ -168,6 +173,23 @@ static void DeclareCppMethod0(std::ostream &os, const std::string &class_name,
       return;
     }
 
+    // NOTE(pag): Statements and types cache their kinds, so we can define
+    //            their `Kind` methods inline.
+    if (class_name == "Stmt" && meth_name_ref == "getStmtClass") {
+      os
+          << "  inline ::pasta::StmtKind Kind(void) const noexcept {\n"
+          << "    return kind;\n"
+          << "  }\n";
+      return;
+
+    } else if (class_name == "Type" && meth_name_ref == "getTypeClass") {
+      os
+          << "  inline ::pasta::TypeKind Kind(void) const noexcept {\n"
+          << "    return qualifiers ? ::pasta::TypeKind::kQualified : kind;\n"
+          << "  }\n";
+      return;
+    }
+
     const auto null_key = std::make_pair(class_name, meth_name);
     const auto can_ret_null = kCanReturnNullptr.count(null_key) ||
                               kConditionalNullptr.count(null_key);
@@ -175,6 +197,7 @@ static void DeclareCppMethod0(std::ostream &os, const std::string &class_name,
       os << "  std::optional<" << new_rt << "> " << meth_name << "(void) const;\n";
     } else {
       os << "  " << new_rt << ' ' << meth_name << "(void) const;\n";
+      AddSnapshotField(class_name, new_rt, meth_name, meth_name_ref);
     }
   }
 }
@@ -198,6 +221,7 @@ static void DeclareCppMethod1(
         os << "  std::optional<" << new_rt << "> " << meth_name << "(void) const;\n";
       } else {
         os << "  " << new_rt << ' ' << meth_name << "(void) const;\n";
+        AddSnapshotField(class_name, new_rt, meth_name, "");
       }
     } else if (!new_rt.empty() && !strcmp(p0, "(bool)")) {
       if (can_ret_null) {
@@ -100,6 +100,12 @@ static void DefineCppMethod0(std::ostream &os, const std::string &class_name,
     return;
   }
 
+  // Defined inline in `Stmt.h`.
+  if (class_name == "Stmt" && meth_name_ref == "getStmtClass") {
+    os_py << "\n    .def_prop_ro(\"" << CapitalCaseToSnakeCase(meth_name) << "\", &" << class_name << "::" << meth_name << ")";
+    return;
+  }
+
   const auto null_key = std::make_pair(class_name, meth_name);
   const auto can_ret_null = kCanReturnNullptr.count(null_key) ||
                             kConditionalNullptr.count(null_key);
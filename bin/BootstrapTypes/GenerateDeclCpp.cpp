@@ -12,6 +12,9 @@
 
 extern void DefineCppMethods(std::ostream &os, const std::string &class_name,
                              uint32_t class_id, std::ostream &os_py);
+extern void DefineSnapshot(std::ostream &os, const std::string &class_name);
+extern void DefineSnapshotBindings(std::ostream &os_py,
+                                   const std::string &class_name);
 
 // Generate `lib/AST/Decl.cpp`.
 void GenerateDeclCpp(std::ostream &py_cmake, std::ostream &py_ast) {
@@ -53,7 +56,15 @@ void GenerateDeclCpp(std::ostream &py_cmake, std::ostream &py_ast) {
       << "#include \"Builder.h\"\n\n"
       << "#define PASTA_DEFINE_BASE_OPERATORS(base, derived) \\\n"
       << "    std::optional<class derived> derived::From(const class base &that) { \\\n"
-      << "      if (auto decl_ptr = clang::dyn_cast_or_null<clang::derived>(that.u.base)) { \\\n"
+      << "      if (that.Is<class derived>()) { \\\n"
+      << "        return DeclBuilder::Create<class derived>(that.ast, that.u.Decl); \\\n"
+      << "      } else { \\\n"
+      << "        return std::nullopt; \\\n"
+      << "      } \\\n"
+      << "    }\n\n"
+      << "#define PASTA_DEFINE_DECL_CONTEXT_BASE_OPERATORS(derived) \\\n"
+      << "    std::optional<class derived> derived::From(const class DeclContext &that) { \\\n"
+      << "      if (auto decl_ptr = clang::dyn_cast_or_null<clang::derived>(that.u.DeclContext)) { \\\n"
       << "        return DeclBuilder::Create<class derived>(that.ast, decl_ptr); \\\n"
       << "      } else { \\\n"
       << "        return std::nullopt; \\\n"
@@ -309,8 +320,7 @@ void Register)" << name << "(nb::module_ &m) {\n"
     if (name_ref.endswith("Decl")) {
 
       if (derived_from_decl_context.count(name)) {
-        os << "PASTA_DEFINE_BASE_OPERATORS(DeclContext, "
-           << name << ")\n";
+        os << "PASTA_DEFINE_DECL_CONTEXT_BASE_OPERATORS(" << name << ")\n";
       }
 
       // These are annoying; these classes don't technically exist, so we need
@@ -414,11 +424,19 @@ void Register)" << name << "(nb::module_ &m) {\n"
 
       os_py << "\n    .def_prop_ro(\"body\", &" << name << "::Body)";
     }
+    DefineSnapshotBindings(os_py, name);
     os_py << ";\n"
           << "}\n"
           << "} // namespace pasta\n";
   }
 
+  // Snapshots copy out all scalar and token properties of an entity.
+  for (const auto &name : gTopologicallyOrderedDecls) {
+    if (name != "DeclContext") {
+      DefineSnapshot(os, name);
+    }
+  }
+
   os
       << "}  // namespace pasta\n"
       << "#endif  // PASTA_IN_BOOTSTRAP\n";
@@ -12,6 +12,7 @@
 
 extern void DeclareCppMethods(std::ostream &os, const std::string &class_name,
                               uint32_t class_id);
+extern void DeclareSnapshot(std::ostream &os, const std::string &class_name);
 
 // Generate `include/pasta/AST/Decl.h`.
 void GenerateDeclH(void) {
@@ -29,6 +30,7 @@ void GenerateDeclH(void) {
       << "#include <variant>\n"
       << "#include <vector>\n"
       << "#include <pasta/Util/Compiler.h>\n"
+      << "#include \"LazyRange.h\"\n"
       << "#include \"Forward.h\"\n\n"
       << "#include \"Attr.h\"\n"
       << "#include \"DeclHead.h\"\n\n"
@@ -97,6 +99,13 @@ void GenerateDeclH(void) {
      << "  }\n"
      << "};\n\n";
 
+  for (const auto &name : gTopologicallyOrderedDecls) {
+    if (name != "DeclContext") {
+      os << "struct " << name << "Snapshot;\n";
+    }
+  }
+  os << "\n";
+
   // Define them all.
   for (const auto &name : gTopologicallyOrderedDecls) {
     llvm::StringRef name_ref(name);
@@ -132,7 +141,10 @@ void GenerateDeclH(void) {
     }
 
     os  << " public:\n"
-        << "  PASTA_DECLARE_DEFAULT_CONSTRUCTORS(" << name << ")\n";
+        << "  PASTA_DECLARE_DEFAULT_CONSTRUCTORS(" << name << ")\n"
+        << "  static constexpr ::pasta::detail::KindRange kKindRange = {"
+        << gKindRanges[name].first << ", " << gKindRanges[name].second
+        << "};\n";
 
     // Constructors from derived class -> base class.
     if (name_ref.endswith("Decl")) {
@@ -162,6 +174,7 @@ void GenerateDeclH(void) {
 //    }
 
     DeclareCppMethods(os, name, gClassIDs[name]);
+    os << "  ::pasta::" << name << "Snapshot Snapshot(void) const;\n";
 
     // The top level `Decl` class has all the content.
     if (name == "Decl") {
@@ -170,16 +183,24 @@ void GenerateDeclH(void) {
           << "  inline DeclKind Kind(void) const {\n"
           << "    return kind;\n"
           << "  }\n\n"
+          << "  // Returns `true` if this is a `T`, or is derived from `T`.\n"
+          << "  template <typename T>\n"
+          << "  inline bool Is(void) const noexcept {\n"
+          << "    return ::pasta::detail::IsInKindRange(\n"
+          << "        ::pasta::detail::DeclKindOrder(kind), T::kKindRange);\n"
+          << "  }\n\n"
           << "  ::pasta::DeclCategory Category(void) const noexcept;\n"
           << "  std::string_view KindName(void) const noexcept;\n"
           << "  ::pasta::Token Token(void) const noexcept;\n"
-          << "  ::pasta::TokenRange Tokens(void) const noexcept;\n\n"
+          << "  ::pasta::TokenRange Tokens(void) const noexcept;\n"
+          << "  std::optional<::pasta::Decl> ParentDeclaration(void) const;\n\n"
           << "  inline bool operator==(const Decl &that) const noexcept {\n"
           << "    return u.opaque == that.u.opaque;\n"
           << "  }\n"
           << "  static std::optional<::pasta::Decl> From(const TokenContext &);\n"
           << "  static std::optional<::pasta::Decl> From(const DeclContext &);\n"
           << " protected:\n"
+          << "  friend class BorrowedDecl;\n"
           << "  friend class TokenContext;\n\n"
           << "  std::shared_ptr<ASTImpl> ast;\n"
           << "  union {\n";
@@ -233,6 +254,9 @@ void GenerateDeclH(void) {
         << "  PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(" << name << ")\n"
         << "};\n\n";
 
+    DeclareSnapshot(os, name);
+    os << "\n\n";
+
     // Requiring that all derivations have the same size as the base class
     // will let us do fun sketchy things.
     if (name != "Decl" && name_ref.endswith("Decl")) {
@@ -4,8 +4,10 @@
 
 #include <fstream>
 #include <ostream>
+#include <set>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 #include "BootstrapConfig.h"
 #include "Globals.h"
@@ -14,6 +16,57 @@
 // Declare PASTA versions of every clang enumeration type from our macro file.
 extern void DeclareEnums(std::ostream &os, std::ostream &os_py);
 
+// Assign positions to `name` and the classes derived from it in a pre-order
+// walk of the class hierarchy, such that every class, along with its concrete
+// derived classes, occupies a contiguous range of positions. Only concrete
+// classes are given positions, because only they have kinds.
+static void OrderKinds(const std::string &name,
+                       bool (*is_concrete)(const std::string &),
+                       std::set<std::string> &seen,
+                       std::vector<std::string> &ordered) {
+  const auto first = static_cast<unsigned>(ordered.size());
+  if (is_concrete(name)) {
+    ordered.push_back(name);
+  }
+
+  for (const auto &derived_class : gDerivedClasses[name]) {
+    if (derived_class != "DeclContext" && seen.insert(derived_class).second) {
+      OrderKinds(derived_class, is_concrete, seen, ordered);
+    }
+  }
+
+  gKindRanges[name] = {first, static_cast<unsigned>(ordered.size())};
+}
+
+// Define a function mapping the kinds of the concrete classes derived from
+// `root` to their positions in a pre-order walk of the class hierarchy.
+static void DefineKindOrder(std::ostream &os, const std::string &root,
+                            bool (*is_concrete)(const std::string &),
+                            unsigned suffix_len) {
+  std::set<std::string> seen;
+  std::vector<std::string> ordered;
+  seen.insert(root);
+  OrderKinds(root, is_concrete, seen, ordered);
+
+  os
+      << "inline constexpr uint16_t " << root << "KindOrder(" << root
+      << "Kind kind) noexcept {\n"
+      << "  switch (kind) {\n";
+
+  auto order = 0u;
+  for (const auto &name : ordered) {
+    os << "    case " << root << "Kind::k"
+       << name.substr(0, name.size() - suffix_len) << ": return "
+       << (order++) << ";\n";
+  }
+
+  os
+      << "    default: break;\n"
+      << "  }\n"
+      << "  return kInvalidKindOrder;\n"
+      << "}\n\n";
+}
+
 // Generate `include/pasta/AST/Forward.h`.
 void GenerateForwardH(std::ostream &os_py) {
   std::ofstream os(kASTForwardHeader);
@@ -199,6 +252,36 @@ void RegisterEnums(nb::module_ &m) {
       << "    PASTA_FOR_EACH_ATTR_IMPL(m, PASTA_IGNORE_ABSTRACT)\n"
       << "\n";
 
+  // NOTE(pag): The kind enumerators aren't ordered such that derived classes
+  //            are contiguous, so we number the kinds in a pre-order walk of
+  //            each class hierarchy. This lets us test if an entity is of a
+  //            given class, or is derived from it, with two comparisons.
+  os
+      << "namespace detail {\n\n"
+      << "static constexpr uint16_t kInvalidKindOrder = 0xFFFFu;\n\n"
+      << "// The half-open range of kind orders of a class and its concrete\n"
+      << "// derived classes.\n"
+      << "struct KindRange {\n"
+      << "  uint16_t begin;\n"
+      << "  uint16_t end;\n"
+      << "};\n\n"
+      << "inline constexpr bool IsInKindRange(uint16_t order,\n"
+      << "                                    KindRange range) noexcept {\n"
+      << "  return range.begin <= order && order < range.end;\n"
+      << "}\n\n";
+
+  DefineKindOrder(os, "Decl", IsConcreteDecl, 4u);
+  DefineKindOrder(
+      os, "Stmt",
+      +[] (const std::string &name) {
+        return ClassifyStmt(name) != StmtClassification::kAbstract;
+      },
+      0u);
+  DefineKindOrder(os, "Type", IsConcreteType, 4u);
+
+  os
+      << "}  // namespace detail\n\n";
+
   // Forward declare them all.
   for (const auto &name : kAllClassNames) {
     os << "class " << name.str() << ";\n";
@@ -12,6 +12,9 @@
 
 extern void DefineCppMethods(std::ostream &os, const std::string &class_name,
                              uint32_t class_id, std::ostream &os_py);
+extern void DefineSnapshot(std::ostream &os, const std::string &class_name);
+extern void DefineSnapshotBindings(std::ostream &os_py,
+                                   const std::string &class_name);
 
 // Generate `lib/AST/Stmt.cpp`.
 void GenerateStmtCpp(std::ostream& py_cmake, std::ostream& py_ast) {
@@ -47,8 +50,8 @@ void GenerateStmtCpp(std::ostream& py_cmake, std::ostream& py_ast) {
       << "#include \"Builder.h\"\n\n"
       << "#define PASTA_DEFINE_BASE_OPERATORS(base, derived) \\\n"
       << "    std::optional<class derived> derived::From(const class base &that) { \\\n"
-      << "      if (auto stmt_ptr = clang::dyn_cast_or_null<clang::derived>(that.u.Stmt)) { \\\n"
-      << "        return StmtBuilder::Create<class derived>(that.ast, stmt_ptr); \\\n"
+      << "      if (that.Is<class derived>()) { \\\n"
+      << "        return StmtBuilder::Create<class derived>(that.ast, that.u.Stmt); \\\n"
       << "      } else { \\\n"
       << "        return std::nullopt; \\\n"
       << "      } \\\n"
@@ -178,11 +181,17 @@ void Register)" << name << "(nb::module_ &m) {\n"
     }
     DefineCppMethods(os, name, gClassIDs[name], os_py);
 
+    DefineSnapshotBindings(os_py, name);
     os_py << ";\n"
           << "}\n"
           << "} // namespace pasta\n";
   }
 
+  // Snapshots copy out all scalar and token properties of an entity.
+  for (const auto &name : gTopologicallyOrderedStmts) {
+    DefineSnapshot(os, name);
+  }
+
   os
       << "}  // namespace pasta\n"
       << "#endif  // PASTA_IN_BOOTSTRAP\n";
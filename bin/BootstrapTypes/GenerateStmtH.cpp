@@ -12,6 +12,7 @@
 
 extern void DeclareCppMethods(std::ostream &os, const std::string &class_name,
                               uint32_t class_id);
+extern void DeclareSnapshot(std::ostream &os, const std::string &class_name);
 
 // Generate `include/pasta/AST/Stmt.h`.
 void GenerateStmtH(void) {
@@ -28,6 +29,7 @@ void GenerateStmtH(void) {
       << "#include <variant>\n"
       << "#include <vector>\n"
       << "#include <pasta/Util/Compiler.h>\n"
+      << "#include \"LazyRange.h\"\n"
       << "#include \"Attr.h\"\n"
       << "#include \"DeclHead.h\"\n\n"
       << "#include \"StmtManual.h\"\n\n"
@@ -61,6 +63,11 @@ void GenerateStmtH(void) {
   os
       << "};\n\n";
 
+  for (const auto &name : gTopologicallyOrderedStmts) {
+    os << "struct " << name << "Snapshot;\n";
+  }
+  os << "\n";
+
   // Define them all.
   for (const auto &name : gTopologicallyOrderedStmts) {
     llvm::StringRef name_ref(name);
@@ -90,13 +97,25 @@ void GenerateStmtH(void) {
     }
 
     os  << " public:\n"
-        << "  PASTA_DECLARE_DEFAULT_CONSTRUCTORS(" << name << ")\n";
+        << "  PASTA_DECLARE_DEFAULT_CONSTRUCTORS(" << name << ")\n"
+        << "  static constexpr ::pasta::detail::KindRange kKindRange = {"
+        << gKindRanges[name].first << ", " << gKindRanges[name].second
+        << "};\n";
 
     if (name_ref == "Stmt") {
-      os << "  friend class TokenContext;\n"
+      os << "  friend class BorrowedStmt;\n"
+         << "  friend class TokenContext;\n"
          << "  static std::optional<::pasta::Stmt> From(const TokenContext &);\n"
          << "  std::vector<::pasta::MacroSubstitution> AlignedSubstitutions(bool heuristic = true) const noexcept;\n"
-         << "  bool AlignsWith(::pasta::Macro &) const noexcept;\n";
+         << "  bool AlignsWith(::pasta::Macro &) const noexcept;\n"
+         << "  std::optional<::pasta::Stmt> Parent(void) const;\n"
+         << "  std::optional<::pasta::Decl> ParentDeclaration(void) const;\n\n"
+         << "  // Returns `true` if this is a `T`, or is derived from `T`.\n"
+         << "  template <typename T>\n"
+         << "  inline bool Is(void) const noexcept {\n"
+         << "    return ::pasta::detail::IsInKindRange(\n"
+         << "        ::pasta::detail::StmtKindOrder(kind), T::kKindRange);\n"
+         << "  }\n\n";
     }
 
     // Constructors from derived class -> base class.
@@ -111,6 +130,7 @@ void GenerateStmtH(void) {
     }
 
     DeclareCppMethods(os, name, gClassIDs[name]);
+    os << "  ::pasta::" << name << "Snapshot Snapshot(void) const;\n";
 
     // The top level `Stmt` class has all the content.
     if (name == "Stmt") {
@@ -145,6 +165,9 @@ void GenerateStmtH(void) {
         << "  PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(" << name << ")\n"
         << "};\n\n";
 
+    DeclareSnapshot(os, name);
+    os << "\n\n";
+
     // Requiring that all derivations have the same size as the base class
     // will let us do fun sketchy things.
     if (name != "Stmt") {
@@ -12,6 +12,7 @@
 
 extern void DefineCppMethods(std::ostream &os, const std::string &class_name,
                              uint32_t class_id, std::ostream &os_py);
+extern void DefineSnapshot(std::ostream &os, const std::string &class_name);
 
 // Generate `lib/AST/Type.cpp`.
 void GenerateTypeCpp(std::ostream &py_cmake, std::ostream &py_ast) {
@@ -44,8 +45,8 @@ void GenerateTypeCpp(std::ostream &py_cmake, std::ostream &py_ast) {
       << "#define PASTA_DEFINE_BASE_OPERATORS(base, derived) \\\n"
       << "    std::optional<class derived> derived::From(const class base &that) { \\\n"
       << "      assert(that.ast.get() != nullptr); \\\n"
-      << "      if (auto type_ptr = clang::dyn_cast_or_null<clang::derived>(that.u.Type)) { \\\n"
-      << "        return TypeBuilder::Create<class derived>(that.ast, type_ptr, that.qualifiers); \\\n"
+      << "      if (that.Is<class derived>()) { \\\n"
+      << "        return TypeBuilder::Create<class derived>(that.ast, that.u.Type, that.qualifiers); \\\n"
       << "      } else { \\\n"
       << "        return std::nullopt; \\\n"
       << "      } \\\n"
@@ -190,6 +191,13 @@ void Register)" << name << "(nb::module_ &m) {\n"
           << "} // namespace pasta\n";
   }
 
+  // Snapshots copy out all scalar and token properties of an entity.
+  for (const auto &name : gTopologicallyOrderedTypes) {
+    if (name != "QualType") {
+      DefineSnapshot(os, name);
+    }
+  }
+
   os
       << "}  // namespace pasta\n"
       << "#endif  // PASTA_IN_BOOTSTRAP\n";
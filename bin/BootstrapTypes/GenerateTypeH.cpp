@@ -12,6 +12,7 @@
 
 extern void DeclareCppMethods(std::ostream &os, const std::string &class_name,
                               uint32_t class_id);
+extern void DeclareSnapshot(std::ostream &os, const std::string &class_name);
 
 // Generate `include/pasta/AST/Type.h`.
 void GenerateTypeH(void) {
@@ -26,9 +27,11 @@ void GenerateTypeH(void) {
       << "#ifdef PASTA_IN_BOOTSTRAP\n"
       << "#  include \"TypeBootstrap.h\"\n"
       << "#else\n"
+      << "#include <type_traits>\n"
       << "#include <variant>\n"
       << "#include <vector>\n"
       << "#include <pasta/Util/Compiler.h>\n"
+      << "#include \"LazyRange.h\"\n"
       << "#include \"TypeManual.h\"\n\n"
       << "#define PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(base) \\\n"
       << "    friend class AST; \\\n"
@@ -66,7 +69,16 @@ void GenerateTypeH(void) {
   const std::string qual_type{"QualType"};
 
   os
-      << "};\n\n"
+      << "};\n\n";
+
+  for (const auto &name : gTopologicallyOrderedTypes) {
+    if (name != qual_type) {
+      os << "struct " << name << "Snapshot;\n";
+    }
+  }
+
+  os
+      << "\n"
       << "// Wraps a type, including its qualifiers.\n"
       << "class Type {\n"
       << " protected:\n"
@@ -74,6 +86,7 @@ void GenerateTypeH(void) {
       << "  friend class ASTImpl;\n"
       << "  friend class TypeBuilder;\n"
       << "  friend class PrintedTokenRange;\n\n"
+      << "  friend class BorrowedType;\n"
       << "  friend class TokenContext;\n"
       << "  std::shared_ptr<ASTImpl> ast;\n"
       << "  union {\n";
@@ -98,6 +111,9 @@ void GenerateTypeH(void) {
       << "  }\n\n"
       << " public:\n"
       << "  PASTA_DECLARE_DEFAULT_CONSTRUCTORS(Type)\n"
+      << "  static constexpr ::pasta::detail::KindRange kKindRange = {"
+      << gKindRanges[type].first << ", " << gKindRanges[type].second
+      << "};\n"
       << "  clang::QualType RawQualType(void) const noexcept;\n\n"
       << "  inline const clang::Type *RawType(void) const noexcept {\n"
       << "    return u.Type;\n"
@@ -138,7 +154,18 @@ void GenerateTypeH(void) {
   os
       << "  inline bool IsQualified(void) const noexcept {\n"
       << "    return qualifiers;\n"
-      << "  }\n"
+      << "  }\n\n"
+      << "  // Returns `true` if this is a `T`, or is derived from `T`. This\n"
+      << "  // ignores qualifiers, except when `T` is `QualifiedType`.\n"
+      << "  template <typename T>\n"
+      << "  inline bool Is(void) const noexcept {\n"
+      << "    if constexpr (std::is_same_v<T, QualifiedType>) {\n"
+      << "      return qualifiers;\n"
+      << "    } else {\n"
+      << "      return ::pasta::detail::IsInKindRange(\n"
+      << "          ::pasta::detail::TypeKindOrder(kind), T::kKindRange);\n"
+      << "    }\n"
+      << "  }\n\n"
       << "  inline Type UnqualifiedType(void) const noexcept {\n"
       << "    return Type(ast, u.Type, kind, 0);\n"
       << "  }\n\n"
@@ -147,8 +174,10 @@ void GenerateTypeH(void) {
       << "  /* Type methods */\n";
 
   DeclareCppMethods(os, type, gClassIDs[type]);
+  os << "  ::pasta::TypeSnapshot Snapshot(void) const;\n";
 
-  os << "};";
+  os << "};\n\n";
+  DeclareSnapshot(os, type);
 
   // Define them all.
   for (const auto &name : gTopologicallyOrderedTypes) {
@@ -188,7 +217,10 @@ void GenerateTypeH(void) {
     }
 
     os  << " public:\n"
-        << "  PASTA_DECLARE_DEFAULT_CONSTRUCTORS(" << name << ")\n";
+        << "  PASTA_DECLARE_DEFAULT_CONSTRUCTORS(" << name << ")\n"
+        << "  static constexpr ::pasta::detail::KindRange kKindRange = {"
+        << gKindRanges[name].first << ", " << gKindRanges[name].second
+        << "};\n";
 
     // Constructors from derived class -> base class.
     for (const auto &base_class : gTransitiveBaseClasses[name]) {
@@ -208,9 +240,13 @@ void GenerateTypeH(void) {
     }
 
     os
+        << "  ::pasta::" << name << "Snapshot Snapshot(void) const;\n"
         << " protected:\n"
         << "  PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(" << name << ")\n"
-        << "};\n";
+        << "};\n\n";
+
+    DeclareSnapshot(os, name);
+    os << "\n";
 
     // Requiring that all derivations have the same size as the base class
     // will let us do fun sketchy things.
@@ -216,70 +216,70 @@ std::unordered_map<std::string, std::string> gRetTypeMap{
   {"(llvm::iterator_range<clang::CXXCtorInitializer *const *>)", "std::vector<::pasta::CXXCtorInitializer>"},
   {"(llvm::iterator_range<clang::UnresolvedSetIterator>)", "std::vector<::pasta::NamedDecl>"},
 
-  {"(llvm::iterator_range<clang::DeclContext::decl_iterator>)", "std::vector<::pasta::Decl>"},
-  {"(llvm::iterator_range<clang::Decl::redecl_iterator>)", "std::vector<::pasta::Decl>"},
-  {"(llvm::iterator_range<clang::Decl *const *>)", "std::vector<::pasta::Decl>"},
+  {"(llvm::iterator_range<clang::DeclContext::decl_iterator>)", "::pasta::LazyRange<::pasta::Decl>"},
+  {"(llvm::iterator_range<clang::Decl::redecl_iterator>)", "::pasta::LazyRange<::pasta::Decl>"},
+  {"(llvm::iterator_range<clang::Decl *const *>)", "::pasta::LazyRange<::pasta::Decl>"},
   {"(llvm::iterator_range<clang::DeclContext::filtered_decl_iterator<clang::ObjCMethodDecl, &clang::ObjCMethodDecl::isClassMethod>>)",
-   "std::vector<::pasta::ObjCMethodDecl>"},
+   "::pasta::LazyRange<::pasta::ObjCMethodDecl>"},
   {"(llvm::iterator_range<clang::DeclContext::filtered_decl_iterator<clang::ObjCPropertyDecl, &clang::ObjCPropertyDecl::isClassProperty>>)",
-   "std::vector<::pasta::ObjCPropertyDecl>"},
+   "::pasta::LazyRange<::pasta::ObjCPropertyDecl>"},
   {"(llvm::iterator_range<clang::DeclContext::filtered_decl_iterator<clang::ObjCMethodDecl, &clang::ObjCMethodDecl::isInstanceMethod>>)",
-   "std::vector<::pasta::ObjCMethodDecl>"},
+   "::pasta::LazyRange<::pasta::ObjCMethodDecl>"},
   {"(llvm::iterator_range<clang::DeclContext::filtered_decl_iterator<clang::ObjCPropertyDecl, &clang::ObjCPropertyDecl::isInstanceProperty>>)",
-   "std::vector<::pasta::ObjCPropertyDecl>"},
+   "::pasta::LazyRange<::pasta::ObjCPropertyDecl>"},
   {"(llvm::iterator_range<clang::DeclContext::specific_decl_iterator<clang::ObjCMethodDecl>>)",
-   "std::vector<::pasta::ObjCMethodDecl>"},
+   "::pasta::LazyRange<::pasta::ObjCMethodDecl>"},
   {"(llvm::iterator_range<clang::DeclContext::specific_decl_iterator<clang::ObjCPropertyDecl>>)",
-   "std::vector<::pasta::ObjCPropertyDecl>"},
+   "::pasta::LazyRange<::pasta::ObjCPropertyDecl>"},
   {"(llvm::iterator_range<clang::RedeclarableTemplateDecl::SpecIterator<clang::FunctionTemplateSpecializationInfo, clang::RedeclarableTemplateDecl::SpecEntryTraits<clang::FunctionTemplateSpecializationInfo>, clang::FunctionDecl>>)",
-   "std::vector<::pasta::FunctionDecl>"},
+   "::pasta::LazyRange<::pasta::FunctionDecl>"},
 
   {"(llvm::iterator_range<clang::DeclContext::specific_decl_iterator<clang::ObjCPropertyImplDecl>>)",
-   "std::vector<::pasta::ObjCPropertyImplDecl>"},
+   "::pasta::LazyRange<::pasta::ObjCPropertyImplDecl>"},
   {"(llvm::iterator_range<clang::DeclContext::specific_decl_iterator<clang::ObjCIvarDecl>>)",
-   "std::vector<::pasta::ObjCIvarDecl>"},
+   "::pasta::LazyRange<::pasta::ObjCIvarDecl>"},
   {"(llvm::iterator_range<clang::ObjCProtocolDecl *const *>)",
-   "std::vector<::pasta::ObjCProtocolDecl>"},
+   "::pasta::LazyRange<::pasta::ObjCProtocolDecl>"},
   {"(llvm::ArrayRef<clang::ParmVarDecl *>)",
-   "std::vector<::pasta::ParmVarDecl>"},
+   "::pasta::LazyRange<::pasta::ParmVarDecl>"},
   {"(llvm::ArrayRef<clang::DesignatedInitExpr::Designator>)",
    "std::vector<::pasta::Designator>"},
   {"(llvm::ArrayRef<clang::NamedDecl *>)",
-   "std::vector<::pasta::NamedDecl>"},
+   "::pasta::LazyRange<::pasta::NamedDecl>"},
   {"(llvm::ArrayRef<clang::ImplicitParamDecl *>)",
-   "std::vector<::pasta::ImplicitParamDecl>"},
+   "::pasta::LazyRange<::pasta::ImplicitParamDecl>"},
   {"(llvm::ArrayRef<clang::BindingDecl *>)",
-   "std::vector<::pasta::BindingDecl>"},
+   "::pasta::LazyRange<::pasta::BindingDecl>"},
   {"(llvm::iterator_range<clang::RedeclarableTemplateDecl::SpecIterator<clang::VarTemplateSpecializationDecl, clang::RedeclarableTemplateDecl::SpecEntryTraits<clang::VarTemplateSpecializationDecl>, clang::VarTemplateSpecializationDecl>>)",
-   "std::vector<::pasta::VarTemplateSpecializationDecl>"},
+   "::pasta::LazyRange<::pasta::VarTemplateSpecializationDecl>"},
   {"(llvm::iterator_range<clang::RedeclarableTemplateDecl::SpecIterator<clang::ClassTemplateSpecializationDecl, clang::RedeclarableTemplateDecl::SpecEntryTraits<clang::ClassTemplateSpecializationDecl>, clang::ClassTemplateSpecializationDecl>>)",
-   "std::vector<::pasta::ClassTemplateSpecializationDecl>"},
+   "::pasta::LazyRange<::pasta::ClassTemplateSpecializationDecl>"},
   {"(llvm::iterator_range<clang::DeclContext::specific_decl_iterator<clang::EnumConstantDecl>>)",
-   "std::vector<::pasta::EnumConstantDecl>"},
+   "::pasta::LazyRange<::pasta::EnumConstantDecl>"},
   {"(llvm::iterator_range<clang::DeclContext::specific_decl_iterator<clang::FieldDecl>>)",
-   "std::vector<::pasta::FieldDecl>"},
+   "::pasta::LazyRange<::pasta::FieldDecl>"},
   {"(llvm::iterator_range<clang::DeclContext::specific_decl_iterator<clang::CXXConstructorDecl>>)",
-   "std::vector<::pasta::CXXConstructorDecl>"},
+   "::pasta::LazyRange<::pasta::CXXConstructorDecl>"},
   {"(llvm::iterator_range<clang::CXXRecordDecl::friend_iterator>)",
-   "std::vector<::pasta::FriendDecl>"},
+   "::pasta::LazyRange<::pasta::FriendDecl>"},
   {"(llvm::iterator_range<clang::DeclContext::specific_decl_iterator<clang::CXXMethodDecl>>)",
-   "std::vector<::pasta::CXXMethodDecl>"},
+   "::pasta::LazyRange<::pasta::CXXMethodDecl>"},
   {"(llvm::iterator_range<clang::ObjCInterfaceDecl::filtered_category_iterator<&clang::ObjCInterfaceDecl::isKnownCategory>>)",
-   "std::vector<::pasta::ObjCCategoryDecl>"},
+   "::pasta::LazyRange<::pasta::ObjCCategoryDecl>"},
   {"(llvm::iterator_range<clang::ObjCInterfaceDecl::filtered_category_iterator<&clang::ObjCInterfaceDecl::isKnownExtension>>)",
-   "std::vector<::pasta::ObjCCategoryDecl>"},
+   "::pasta::LazyRange<::pasta::ObjCCategoryDecl>"},
   {"(llvm::iterator_range<clang::ObjCInterfaceDecl::filtered_category_iterator<&clang::ObjCInterfaceDecl::isVisibleCategory>>)",
-   "std::vector<::pasta::ObjCCategoryDecl>"},
+   "::pasta::LazyRange<::pasta::ObjCCategoryDecl>"},
   {"(llvm::iterator_range<clang::ObjCInterfaceDecl::filtered_category_iterator<&clang::ObjCInterfaceDecl::isVisibleExtension>>)",
-   "std::vector<::pasta::ObjCCategoryDecl>"},
+   "::pasta::LazyRange<::pasta::ObjCCategoryDecl>"},
 
   {"(llvm::iterator_range<clang::UsingDecl::shadow_iterator>)",
-   "std::vector<::pasta::UsingShadowDecl>"},
+   "::pasta::LazyRange<::pasta::UsingShadowDecl>"},
   {"(llvm::iterator_range<clang::BaseUsingDecl::shadow_iterator>)",
-   "std::vector<::pasta::UsingShadowDecl>"},
+   "::pasta::LazyRange<::pasta::UsingShadowDecl>"},
 
   {"(llvm::iterator_range<const clang::CXXMethodDecl *const *>)",
-   "std::vector<::pasta::CXXMethodDecl>"},
+   "::pasta::LazyRange<::pasta::CXXMethodDecl>"},
 
   {"(llvm::iterator_range<const clang::SourceLocation *>)",
    "std::vector<::pasta::Token>"},
@@ -296,25 +296,25 @@ std::unordered_map<std::string, std::string> gRetTypeMap{
   DECL_VARIANT(BlockDecl, CompoundLiteralExpr),
 
   {"(llvm::iterator_range<clang::ConstStmtIterator>)",
-   "std::vector<::pasta::Stmt>"},
+   "::pasta::LazyRange<::pasta::Stmt>"},
 
   {"(llvm::iterator_range<clang::Stmt::CastIterator<clang::Expr, const clang::Expr *const, const clang::Stmt *const>>)",
-   "std::vector<::pasta::Expr>"},
+   "::pasta::LazyRange<::pasta::Expr>"},
 
   {"(llvm::iterator_range<clang::Stmt::CastIterator<clang::AddrLabelExpr, const clang::AddrLabelExpr *const, const clang::Stmt *const>>)",
-   "std::vector<::pasta::AddrLabelExpr>"},
+   "::pasta::LazyRange<::pasta::AddrLabelExpr>"},
 
   {"(llvm::ArrayRef<const clang::Stmt *>)",
-   "std::vector<::pasta::Stmt>"},
+   "::pasta::LazyRange<::pasta::Stmt>"},
 
   {"(llvm::ArrayRef<clang::Stmt *>)",
-   "std::vector<::pasta::Stmt>"},
+   "::pasta::LazyRange<::pasta::Stmt>"},
 
   {"(llvm::ArrayRef<const clang::Expr *>)",
-   "std::vector<::pasta::Expr>"},
+   "::pasta::LazyRange<::pasta::Expr>"},
 
   {"(llvm::ArrayRef<clang::Expr *>)",
-   "std::vector<::pasta::Expr>"},
+   "::pasta::LazyRange<::pasta::Expr>"},
 
   {"(llvm::ArrayRef<llvm::StringRef>)",
    "std::vector<std::string_view>"},
@@ -326,7 +326,7 @@ std::unordered_map<std::string, std::string> gRetTypeMap{
    "std::vector<::pasta::Token>"},
 
   {"(llvm::iterator_range<const clang::Expr *const *>)",
-   "std::vector<::pasta::Expr>"},
+   "::pasta::LazyRange<::pasta::Expr>"},
 
   {"(llvm::iterator_range<const clang::CXXBaseSpecifier *>)",
    "std::vector<::pasta::CXXBaseSpecifier>"},
@@ -583,13 +583,7 @@ std::unordered_map<std::string, std::string> gRetTypeToValMap{
    "  return ret;\n"},
 
 #define DECL_ITERATOR_IMPL(cls) \
-    "  std::vector<::pasta::" #cls "> ret;\n" \
-    "  for (auto decl_ptr : val) {\n" \
-    "    if (decl_ptr) {\n" \
-    "      ret.emplace_back(DeclBuilder::Create<::pasta::" #cls ">(ast, decl_ptr));\n" \
-    "    }\n" \
-    "  }\n" \
-    "  return ret;\n"
+    "  return LazyRangeBuilder::Create<::pasta::" #cls ", DeclBuilder>(ast, val);\n"
 
   {"(llvm::iterator_range<clang::DeclContext::decl_iterator>)",
    DECL_ITERATOR_IMPL(Decl)},
@@ -716,13 +710,7 @@ std::unordered_map<std::string, std::string> gRetTypeToValMap{
   DECL_VARIANT_IMPL(BlockDecl, DeclBuilder, CompoundLiteralExpr, StmtBuilder),
 
 #define STMT_ITERATOR_IMPL(cls) \
-    "  std::vector<::pasta::" #cls "> ret;\n" \
-    "  for (auto stmt_ptr : val) {\n" \
-    "    if (stmt_ptr) {\n" \
-    "      ret.emplace_back(StmtBuilder::Create<::pasta::" #cls ">(ast, stmt_ptr));\n" \
-    "    }\n" \
-    "  }\n" \
-    "  return ret;\n"
+    "  return LazyRangeBuilder::Create<::pasta::" #cls ", StmtBuilder>(ast, val);\n"
 
   {"(llvm::iterator_range<clang::ConstStmtIterator>)",
    STMT_ITERATOR_IMPL(Stmt)},
@@ -1948,6 +1936,7 @@ std::vector<std::string> gTopologicallyOrderedAttrs;
 
 std::unordered_map<std::string, std::set<std::string>> gTransitiveBaseClasses;
 std::unordered_map<std::string, std::set<std::string>> gTransitiveDerivedClasses;
+std::unordered_map<std::string, std::pair<unsigned, unsigned>> gKindRanges;
 
 
 #define PASTA_BEGIN_CLANG_WRAPPER(cls, id) \
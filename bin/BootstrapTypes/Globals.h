@@ -84,6 +84,10 @@ extern std::vector<std::string> gTopologicallyOrderedAttrs;
 extern std::unordered_map<std::string, std::set<std::string>> gTransitiveBaseClasses;
 extern std::unordered_map<std::string, std::set<std::string>> gTransitiveDerivedClasses;
 
+// Maps class names to the half-open ranges of positions occupied by the class
+// and its concrete derived classes in a pre-order walk of the class hierarchy.
+extern std::unordered_map<std::string, std::pair<unsigned, unsigned>> gKindRanges;
+
 extern std::unordered_map<std::string, std::vector<std::string>> gEnumerators;
 
 #define PASTA_BEGIN_CLANG_WRAPPER(cls, id) \
@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#include <map>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "Globals.h"
+#include "Util.h"
+
+namespace {
+
+// A scalar or token property of a class, copied into the class's snapshot.
+struct SnapshotField {
+  std::string type;
+  std::string field_name;
+  std::string method_name;
+
+  // Clang getter of a token property. If this is empty, then the token index
+  // is computed from the PASTA method.
+  std::string token_getter;
+
+  // `ASTImpl` method that returns the raw token of a token property, given the
+  // Clang entity. This is used instead of `token_getter` when the Clang getter
+  // returns the wrong location.
+  std::string raw_token_getter;
+
+  // Condition on the Clang entity, named `self`, that must hold before the
+  // method can be called. If the condition doesn't hold, then the field is
+  // value-initialized.
+  std::string precondition;
+  bool is_token{false};
+};
+
+// Maps class names to the fields of their snapshots. Inherited fields aren't
+// included.
+static std::unordered_map<std::string, std::vector<SnapshotField>>
+    gSnapshotFields;
+
+static const std::unordered_set<std::string> kScalarTypes{
+  "bool",
+  "uint32_t",
+  "int64_t",
+  "uint64_t",
+  "float",
+  "double",
+  "::pasta::BuiltinTypeKind",
+  "::pasta::ExprDependence",
+};
+
+// Preconditions of methods whose Clang getters assert when called on the wrong
+// kind of entity. The accessors leave checking these up to the caller, but a
+// snapshot calls every getter, and so it must check them itself.
+static const std::map<std::pair<std::string, std::string>, std::string>
+    kSnapshotPreconditions{
+  {{"CXXRecordDecl", "DeviceLambdaManglingNumber"}, "self.isLambda()"},
+  {{"CXXRecordDecl", "LambdaIndexInContext"}, "self.isLambda()"},
+  {{"CallExpr", "HasUnusedResultAttribute"}, "!self.isTypeDependent()"},
+  {{"ChooseExpr", "IsConditionTrue"}, "!self.isConditionDependent()"},
+  {{"ConceptSpecializationExpr", "IsSatisfied"}, "!self.isValueDependent()"},
+  {{"FieldDecl", "BitWidthValue"},
+   "self.isBitField() && !self.getBitWidth()->isValueDependent()"},
+  {{"FieldDecl", "IsZeroLengthBitField"},
+   "!self.isBitField() || !self.getBitWidth()->isValueDependent()"},
+  {{"FieldDecl", "IsZeroSize"},
+   "!self.isBitField() || !self.getBitWidth()->isValueDependent()"},
+  {{"GenericSelectionExpr", "ResultIndex"}, "!self.isResultDependent()"},
+  {{"ObjCInterfaceDecl", "HasDesignatedInitializers"}, "self.hasDefinition()"},
+  {{"RequiresExpr", "IsSatisfied"}, "!self.isValueDependent()"},
+  {{"TemplateTemplateParmDecl", "NumExpansionTemplateParameters"},
+   "self.isExpandedParameterPack()"},
+  {{"TemplateTypeParmDecl", "NumExpansionParameters"},
+   "self.isExpandedParameterPack()"},
+};
+
+// Token methods that are defined manually, because their Clang getters return
+// the wrong locations, mapped to the `ASTImpl` methods that find their raw
+// tokens. E.g. Clang deduplicates function types, and so the ellipsis location
+// of a `FunctionDecl` can be that of another function.
+static const std::map<std::pair<std::string, std::string>, std::string>
+    kSnapshotRawTokenGetters{
+  {{"FunctionDecl", "EllipsisToken"}, "FunctionEllipsisToken"},
+};
+
+// Snapshot field names that would otherwise be C++ keywords.
+static const std::unordered_set<std::string> kReservedFieldNames{
+  "auto", "class", "const", "default", "delete", "enum", "explicit", "inline",
+  "new", "operator", "register", "signed", "struct", "template", "this",
+  "union", "unsigned", "virtual", "volatile",
+};
+
+// Returns the direct base class of `class_name` that has a snapshot.
+static std::string SnapshotBaseClass(const std::string &class_name) {
+  for (const auto &base_class : gBaseClasses[class_name]) {
+    if (base_class != "DeclContext") {
+      return base_class;
+    }
+  }
+  return {};
+}
+
+// Returns `true` if `class_name`, or one of its bases, has a snapshot field
+// named `field_name`.
+static bool HasSnapshotField(const std::string &class_name,
+                             const std::string &field_name) {
+  for (auto name = class_name; !name.empty(); name = SnapshotBaseClass(name)) {
+    for (const SnapshotField &field : gSnapshotFields[name]) {
+      if (field.field_name == field_name) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+// Record a property of `class_name` for inclusion in its snapshot, if the
+// property is a scalar or a token. `getter` is the Clang method returning
+// the property, and is only used for tokens.
+void AddSnapshotField(const std::string &class_name_, const std::string &type,
+                      const std::string &method_name, llvm::StringRef getter) {
+  if (class_name_ == "DeclContext") {
+    return;  // Declaration contexts don't have snapshots.
+  }
+
+  const auto is_token = type == "::pasta::Token";
+  if (!is_token && !kScalarTypes.count(type) &&
+      !llvm::StringRef(type).startswith("enum ")) {
+    return;
+  }
+
+  // NOTE(pag): `QualType` methods are declared on `QualifiedType`.
+  const std::string class_name =
+      class_name_ == "QualType" ? "QualifiedType" : class_name_;
+
+  auto field_name = CapitalCaseToSnakeCase(method_name);
+  if (kReservedFieldNames.count(field_name)) {
+    field_name += "_";
+  }
+
+  // Derived classes sometimes re-declare the methods of their bases, in which
+  // case the snapshot of the base already has the field.
+  if (HasSnapshotField(class_name, field_name)) {
+    return;
+  }
+
+  SnapshotField field;
+  field.type = is_token ? "uint32_t" : type;
+  field.field_name = std::move(field_name);
+  field.method_name = method_name;
+  field.is_token = is_token;
+  field.token_getter = getter.str();
+  if (auto it = kSnapshotPreconditions.find({class_name, method_name});
+      it != kSnapshotPreconditions.end()) {
+    field.precondition = it->second;
+  }
+  if (auto it = kSnapshotRawTokenGetters.find({class_name, method_name});
+      it != kSnapshotRawTokenGetters.end()) {
+    field.raw_token_getter = it->second;
+  }
+  gSnapshotFields[class_name].emplace_back(std::move(field));
+}
+
+// Declare the snapshot structure of `class_name`. Snapshots of derived classes
+// extend the snapshots of their base classes. Fields with preconditions are
+// value-initialized.
+void DeclareSnapshot(std::ostream &os, const std::string &class_name) {
+  os << "struct " << class_name << "Snapshot";
+  if (auto base_class = SnapshotBaseClass(class_name); !base_class.empty()) {
+    os << " : public " << base_class << "Snapshot";
+  }
+  os << " {\n";
+
+  for (const SnapshotField &field : gSnapshotFields[class_name]) {
+    os << "  " << field.type << ' ' << field.field_name;
+    if (!field.precondition.empty()) {
+      os << "{}";
+    }
+    os << ";\n";
+  }
+
+  os << "};";
+}
+
+// Define the `Snapshot` method of `class_name`. The fields of the base class
+// snapshots are filled in by the `Snapshot` methods of the base classes. Token
+// fields are computed directly from the Clang getters, so that we don't need to
+// create any `Token`s. Fields with preconditions are only filled in if their
+// preconditions hold.
+void DefineSnapshot(std::ostream &os, const std::string &class_name) {
+  os
+      << "::pasta::" << class_name << "Snapshot " << class_name
+      << "::Snapshot(void) const {\n"
+      << "  ::pasta::" << class_name << "Snapshot snapshot;\n";
+
+  if (auto base_class = SnapshotBaseClass(class_name); !base_class.empty()) {
+    os
+        << "  static_cast<::pasta::" << base_class << "Snapshot &>(snapshot) = "
+        << base_class << "::Snapshot();\n";
+  }
+
+  for (const SnapshotField &field : gSnapshotFields[class_name]) {
+    if (!field.precondition.empty()) {
+      os
+          << "  if (const auto &self = *(u." << class_name << "); "
+          << field.precondition << ") {\n"
+          << "    snapshot." << field.field_name << " = " << class_name
+          << "::" << field.method_name << "();\n"
+          << "  }\n";
+      continue;
+    }
+
+    os << "  snapshot." << field.field_name << " = ";
+    if (!field.is_token) {
+      os << class_name << "::" << field.method_name << "();\n";
+
+    } else if (!field.raw_token_getter.empty()) {
+      os << "ast->TokenIndexAt(ast->" << field.raw_token_getter << "(u."
+         << class_name << "));\n";
+
+    } else if (!field.token_getter.empty()) {
+      os << "ast->TokenIndexAt(const_cast<clang::" << class_name << " *>(u."
+         << class_name << ")->" << field.token_getter << "());\n";
+
+    } else {
+      os << "static_cast<uint32_t>(" << class_name << "::"
+         << field.method_name << "().Index());\n";
+    }
+  }
+
+  os
+      << "  return snapshot;\n"
+      << "}\n\n";
+}
+
+// Bind the `Snapshot` method of `class_name`, and its snapshot structure, whose
+// fields are read-only. This continues the still-open binding of `class_name`
+// on `os_py`, and leaves the binding of the snapshot open. Snapshots of derived
+// classes are bound after those of their base classes, because the classes
+// themselves are registered in that order.
+void DefineSnapshotBindings(std::ostream &os_py,
+                            const std::string &class_name) {
+  os_py
+      << "\n    .def(\"snapshot\", &" << class_name << "::Snapshot);\n\n"
+      << "  nb::class_<" << class_name << "Snapshot";
+  if (auto base_class = SnapshotBaseClass(class_name); !base_class.empty()) {
+    os_py << ", " << base_class << "Snapshot";
+  }
+  os_py << ">(m, \"" << class_name << "Snapshot\")";
+
+  for (const SnapshotField &field : gSnapshotFields[class_name]) {
+    os_py
+        << "\n    .def_ro(\"" << field.field_name << "\", &" << class_name
+        << "Snapshot::" << field.field_name << ")";
+  }
+}
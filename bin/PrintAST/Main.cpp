@@ -16,7 +16,21 @@
 #include <iostream>
 #include <memory>
 #include <string>
+#include <string_view>
 
+namespace {
+
+// Prints each top-level declaration to `stderr` as soon as it's printed.
+class StderrSink final : public pasta::PrintedTokenSink {
+ public:
+  virtual ~StderrSink(void) = default;
+
+  void AcceptText(std::string_view text) final {
+    std::cerr << text;
+  }
+};
+
+}  // namespace
 
 int main(int argc, char *argv[]) {
   if (2 > argc) {
@@ -71,17 +85,8 @@ int main(int argc, char *argv[]) {
       std::cerr << maybe_ast.TakeError() << std::endl;
       return EXIT_FAILURE;
     } else {
-      auto tu = maybe_ast->TranslationUnit();
-      auto tokens = pasta::PrintedTokenRange::Create(tu);
-      for (pasta::PrintedToken tok : tokens) {
-        for (auto i = 0u, max_i = tok.NumLeadingNewLines(); i < max_i; ++i) {
-          std::cerr << '\n';
-        }
-        for (auto i = 0u, max_i = tok.NumLeadingSpaces(); i < max_i; ++i) {
-          std::cerr << ' ';
-        }
-        std::cerr << tok.Data();
-      }
+      StderrSink sink;
+      pasta::PrintedTokenRange::Stream(maybe_ast->TranslationUnit(), sink);
     }
   }
 
@@ -17,7 +17,9 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 void PrintTokensTo(std::iostream &s, const pasta::TokenRange &tokens) {
   int i = 0;
@@ -34,70 +36,29 @@ void PrintTokensTo(std::iostream &s, const pasta::TokenRange &tokens) {
   }
 }
 
-class StmtPrintAlignedSubstitutions final : public pasta::StmtVisitor {
+// NOTE(bpappas): Don't visit implicit expressions to avoid printing their
+// tokens twice. Implicit expressions comprise the same tokens as their
+// immediate children, so if we were to visit them, we would first print
+// their tokens, and then their immediate childrens' tokens.
+static bool IsImplicit(const pasta::Stmt &stmt) {
+  return stmt.Kind() == pasta::StmtKind::kImplicitCastExpr ||
+         stmt.Kind() == pasta::StmtKind::kImplicitValueInitExpr;
+}
+
+// Collects the statements whose aligned substitutions to print, in the order
+// in which to print them.
+class StmtCollector final : public pasta::StmtVisitor {
 public:
-  std::ostream &os;
+  std::vector<pasta::Stmt> &stmts;
 
-  virtual ~StmtPrintAlignedSubstitutions(void) = default;
+  virtual ~StmtCollector(void) = default;
 
-  explicit StmtPrintAlignedSubstitutions(std::ostream &os_) : os(os_) {}
+  explicit StmtCollector(std::vector<pasta::Stmt> &stmts_)
+      : stmts(stmts_) {}
 
   void VisitStmt(const pasta::Stmt &stmt) {
-    // NOTE(bpappas): Don't visit implicit expressions to avoid printing their
-    // tokens twice. Implicit expressions comprise the same tokens as their
-    // immediate children, so if we were to visit them, we would first print
-    // their tokens, and then their immediate childrens' tokens.
-    if (stmt.Kind() != pasta::StmtKind::kImplicitCastExpr
-        && stmt.Kind() != pasta::StmtKind::kImplicitValueInitExpr) {
-      auto covering_subs = stmt.AlignedSubstitutions();
-      if (!covering_subs.empty()) {
-        std::stringstream ss;
-        PrintTokensTo(ss, stmt.Tokens());
-        ss << " is covered by the following expansions:\n";
-        for (auto sub : covering_subs) {
-          std::optional<pasta::MacroExpansion> exp;
-          if ((exp = pasta::MacroExpansion::From(sub))) {
-            // NOTE(bpappas): To avoid visiting function-like macro expansions
-            // twice, we only consider expansions that do not have arguments, or
-            // are the pre-expanded versions of their arguments
-            auto should_visit = (exp->Arguments().empty() ||
-                                 exp->IsArgumentPreExpansion());
-            if (!should_visit) {
-              continue;
-            }
-          }
-
-          ss << "  ";
-          if (auto name = sub.NameOrOperator()) {
-            ss << name->Data();
-          } else {
-            ss << "<a nameless macro>";
-          }
-
-          if (exp && !exp->Arguments().empty()) {
-            ss << "\n    Aligned parameters:\n";
-            auto aligned_parameters = exp->AlignedParameterSubstitutions(stmt);
-            auto parameter_use_counts = exp->ParameterUseCounts();
-            for (auto &[param, param_stmts] : aligned_parameters) {
-              unsigned expected = parameter_use_counts.at(param);
-              auto param_name = param.Name();
-              std::size_t actual = param_stmts.size();
-              ss << "      " << (param_name ? param_name->Data() : "<a nameless parameter>")
-                << " (expected " << std::to_string(expected)
-                << ", actual " << std::to_string(actual)
-                << "):\n";
-              for (auto param_stmt : param_stmts) {
-                ss << "        ";
-                PrintTokensTo(ss, param_stmt.Tokens());
-                ss << '\n';
-              }
-            }
-          } else {
-            ss << '\n';
-          }
-        }
-        std::cout << ss.str();
-      }
+    if (!IsImplicit(stmt)) {
+      stmts.push_back(stmt);
     }
     for (const auto &child : stmt.Children()) {
       Accept(child);
@@ -105,13 +66,69 @@ public:
   }
 };
 
-class DeclPrintStmtsCoveredByArguments final : public pasta::DeclVisitor {
-public:
-  std::ostream &os;
+static void PrintCoveringSubstitutions(
+    const pasta::Stmt &stmt,
+    const std::vector<pasta::MacroSubstitution> &covering_subs,
+    const std::unordered_map<const void *,
+                             std::vector<pasta::MacroSubstitution>> &stmt_subs) {
+  if (covering_subs.empty()) {
+    return;
+  }
+
+  std::stringstream ss;
+  PrintTokensTo(ss, stmt.Tokens());
+  ss << " is covered by the following expansions:\n";
+  for (auto sub : covering_subs) {
+    std::optional<pasta::MacroExpansion> exp;
+    if ((exp = pasta::MacroExpansion::From(sub))) {
+      // NOTE(bpappas): To avoid visiting function-like macro expansions
+      // twice, we only consider expansions that do not have arguments, or
+      // are the pre-expanded versions of their arguments
+      auto should_visit = (exp->Arguments().empty() ||
+                           exp->IsArgumentPreExpansion());
+      if (!should_visit) {
+        continue;
+      }
+    }
+
+    ss << "  ";
+    if (auto name = sub.NameOrOperator()) {
+      ss << name->Data();
+    } else {
+      ss << "<a nameless macro>";
+    }
+
+    if (exp && !exp->Arguments().empty()) {
+      ss << "\n    Aligned parameters:\n";
+      auto aligned_parameters =
+          exp->AlignedParameterSubstitutions(stmt, stmt_subs);
+      auto parameter_use_counts = exp->ParameterUseCounts();
+      for (auto &[param, param_stmts] : aligned_parameters) {
+        unsigned expected = parameter_use_counts.at(param);
+        auto param_name = param.Name();
+        std::size_t actual = param_stmts.size();
+        ss << "      " << (param_name ? param_name->Data() : "<a nameless parameter>")
+          << " (expected " << std::to_string(expected)
+          << ", actual " << std::to_string(actual)
+          << "):\n";
+        for (auto param_stmt : param_stmts) {
+          ss << "        ";
+          PrintTokensTo(ss, param_stmt.Tokens());
+          ss << '\n';
+        }
+      }
+    } else {
+      ss << '\n';
+    }
+  }
+  std::cout << ss.str();
+}
 
-  virtual ~DeclPrintStmtsCoveredByArguments(void) = default;
+class DeclCollectStmts final : public pasta::DeclVisitor {
+public:
+  std::vector<pasta::Stmt> stmts;
 
-  explicit DeclPrintStmtsCoveredByArguments(std::ostream &os_) : os(os_) {}
+  virtual ~DeclCollectStmts(void) = default;
 
   void VisitDeclContext(const pasta::DeclContext &dc) {
     for (const auto &decl : dc.AlreadyLoadedDeclarations()) {
@@ -128,25 +145,44 @@ public:
     // local ones anyway inside function declaration contexts.
     if (!decl.IsLocalVariableDeclaration()) {
       if (auto initializer = decl.Initializer()) {
-        StmtPrintAlignedSubstitutions finder(os);
-        finder.Accept(*initializer);
+        StmtCollector collector(stmts);
+        collector.Accept(*initializer);
       }
     }
   }
 
   void VisitFunctionDecl(const pasta::FunctionDecl &decl) final {
     if (auto body = decl.Body()) {
-      StmtPrintAlignedSubstitutions finder(os);
-      finder.Accept(*body);
+      StmtCollector collector(stmts);
+      collector.Accept(*body);
     }
     VisitDeclContext(decl);
   }
 };
 
-
+// Finds the aligned substitutions of all statements in one sweep, then prints
+// them in the order in which the statements were visited.
 static void PrintAlignedSubstitutions(pasta::AST ast) {
-  DeclPrintStmtsCoveredByArguments finder(std::cout);
-  finder.Accept(ast.TranslationUnit());
+  DeclCollectStmts collector;
+  collector.Accept(ast.TranslationUnit());
+
+  std::vector<pasta::TokenRange> ranges;
+  ranges.reserve(collector.stmts.size());
+  for (const pasta::Stmt &stmt : collector.stmts) {
+    ranges.emplace_back(stmt.Tokens());
+  }
+
+  auto all_subs = pasta::TokenRange::AlignedSubstitutions(ranges, true);
+
+  std::unordered_map<const void *, std::vector<pasta::MacroSubstitution>>
+      stmt_subs;
+  for (size_t i = 0u, max_i = collector.stmts.size(); i < max_i; ++i) {
+    stmt_subs.emplace(collector.stmts[i].RawStmt(), all_subs[i]);
+  }
+
+  for (size_t i = 0u, max_i = collector.stmts.size(); i < max_i; ++i) {
+    PrintCoveringSubstitutions(collector.stmts[i], all_subs[i], stmt_subs);
+  }
 }
 
 static void OnSigsegv(int) {
@@ -0,0 +1,1206 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#include <pasta/AST/AST.h>
+#include <pasta/AST/Borrowed.h>
+#include <pasta/AST/Decl.h>
+#include <pasta/AST/EntityExport.h>
+#include <pasta/AST/Macro.h>
+#include <pasta/AST/Stmt.h>
+#include <pasta/AST/Token.h>
+#include <pasta/AST/TokenSnapshot.h>
+#include <pasta/AST/Walker.h>
+#include <pasta/Compile/Cache.h>
+#include <pasta/Compile/Command.h>
+#include <pasta/Compile/Compiler.h>
+#include <pasta/Compile/Job.h>
+#include <pasta/Util/ArgumentVector.h>
+#include <pasta/Util/FileSystem.h>
+#include <pasta/Util/Init.h>
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wimplicit-int-conversion"
+#pragma clang diagnostic ignored "-Wsign-conversion"
+#pragma clang diagnostic ignored "-Wshorten-64-to-32"
+#include <clang/AST/ASTContext.h>
+#include <clang/AST/ExprCXX.h>
+#include <clang/AST/RecursiveASTVisitor.h>
+#pragma clang diagnostic pop
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+// Options specific to this tool. These are removed from the compile command.
+struct Options {
+
+  // If non-zero, then walk or export the top-level declarations in parallel
+  // using this many threads.
+  unsigned num_threads{0u};
+
+  // Print the number of walked entities of each kind.
+  bool print_walk_counts{false};
+
+  // Print the number of entities of each kind in the AST's kind index, and
+  // check the index of each class against a walk of the AST.
+  bool print_index_counts{false};
+
+  // Print the number of entities of each kind visited by a Clang
+  // `RecursiveASTVisitor`, as a baseline for the other counts.
+  bool print_visitor_counts{false};
+
+  // Check the AST's parent map against the parents observed while walking,
+  // and print the number of statements whose parents are declarations.
+  bool check_parents{false};
+
+  // Snapshot every declaration and statement, and print the number of
+  // snapshots of each kind, as well as the bit widths of fields.
+  bool snapshot_entities{false};
+
+  // Print the parsed files and tokens of the translation unit.
+  bool print_parsed_tokens{false};
+
+  // Print the macro trees of the translation unit.
+  bool print_macros{false};
+
+  // Print the data and file locations of only the tokens seen by the parser,
+  // i.e. the file tokens and final macro expansion tokens. Unlike
+  // `print_parsed_tokens`, this doesn't depend on how macros are tracked.
+  bool print_parsed_locations{false};
+
+  // Share canonical macro definitions across the ASTs of all compile jobs.
+  bool share_macro_definitions{false};
+
+  // Print the name and canonical definition of every `#define` of each compile
+  // job. Canonical definitions are numbered in the order in which they were
+  // first seen, across all compile jobs.
+  bool print_canonical_macros{false};
+
+  // How to track macros when running the compile jobs.
+  pasta::MacroTracking macro_tracking{pasta::MacroTracking::kEnabled};
+
+  // Run each compile job with and without macro tracking, and export its
+  // entities both with `EntityExport::Serialize` and with a loop over the
+  // accessors of the walked entities, and print how long each took to
+  // `std::cerr`.
+  bool print_times{false};
+
+  // Only preprocess the compile jobs, i.e. via `CompileJob::Preprocess`, and
+  // then print the parsed files, tokens, and macros of the preprocessed
+  // translation units, as with `print_parsed_tokens` and `print_macros`. All
+  // other printing options are ignored.
+  bool preprocess_only{false};
+
+  // Check the precomputed derivation depths and file locations of the parsed
+  // tokens against following their derived locations by hand, and print the
+  // number of tokens at each derivation depth.
+  bool check_derivations{false};
+
+  // Export the entities of the translation unit, load the export back, and
+  // print its entities and references.
+  bool print_entity_export{false};
+
+  // If non-empty, then write a token snapshot of the translation unit into
+  // this file, load it back from the file, and print the parsed files and
+  // tokens of the loaded snapshot, in the same format as
+  // `print_parsed_tokens`.
+  std::string token_snapshot_path;
+
+  // If non-empty, then run the compile jobs through the compile cache in this
+  // directory, print whether or not each job hit the cache, and then print
+  // the parsed files and tokens of the cached snapshots.
+  std::string compile_cache_dir;
+
+  // Copy each job's cache entry to the entry path of a different cache key,
+  // as if the hashes of their keys collided, and print whether or not the
+  // other key hits the cache.
+  bool check_cache_collisions{false};
+};
+
+// Try to parse `arg` as one of our options. Returns `false` if `arg` should be
+// passed along to the compiler.
+static bool ParseOption(std::string_view arg, Options &options) {
+  static constexpr std::string_view kThreads = "--pasta-threads=";
+  static constexpr std::string_view kTokenSnapshot = "--pasta-token-snapshot=";
+  static constexpr std::string_view kCompileCache = "--pasta-compile-cache=";
+  if (arg.starts_with(kThreads)) {
+    options.num_threads = static_cast<unsigned>(
+        std::strtoul(arg.substr(kThreads.size()).data(), nullptr, 10));
+    return true;
+
+  } else if (arg.starts_with(kTokenSnapshot)) {
+    options.token_snapshot_path = arg.substr(kTokenSnapshot.size());
+    return true;
+
+  } else if (arg.starts_with(kCompileCache)) {
+    options.compile_cache_dir = arg.substr(kCompileCache.size());
+    return true;
+
+  } else if (arg == "--pasta-check-cache-collisions") {
+    options.check_cache_collisions = true;
+    return true;
+
+  } else if (arg == "--pasta-walk-counts") {
+    options.print_walk_counts = true;
+    return true;
+
+  } else if (arg == "--pasta-index-counts") {
+    options.print_index_counts = true;
+    return true;
+
+  } else if (arg == "--pasta-visitor-counts") {
+    options.print_visitor_counts = true;
+    return true;
+
+  } else if (arg == "--pasta-check-parents") {
+    options.check_parents = true;
+    return true;
+
+  } else if (arg == "--pasta-snapshot-entities") {
+    options.snapshot_entities = true;
+    return true;
+
+  } else if (arg == "--pasta-parsed-tokens") {
+    options.print_parsed_tokens = true;
+    return true;
+
+  } else if (arg == "--pasta-macros") {
+    options.print_macros = true;
+    return true;
+
+  } else if (arg == "--pasta-parsed-locations") {
+    options.print_parsed_locations = true;
+    return true;
+
+  } else if (arg == "--pasta-share-macros") {
+    options.share_macro_definitions = true;
+    return true;
+
+  } else if (arg == "--pasta-canonical-macros") {
+    options.print_canonical_macros = true;
+    return true;
+
+  } else if (arg == "--pasta-no-macro-tracking") {
+    options.macro_tracking = pasta::MacroTracking::kDisabled;
+    return true;
+
+  } else if (arg == "--pasta-time") {
+    options.print_times = true;
+    return true;
+
+  } else if (arg == "--pasta-preprocess-only") {
+    options.preprocess_only = true;
+    return true;
+
+  } else if (arg == "--pasta-check-derivations") {
+    options.check_derivations = true;
+    return true;
+
+  } else if (arg == "--pasta-entity-export") {
+    options.print_entity_export = true;
+    return true;
+
+  } else {
+    return false;
+  }
+}
+
+// Number of entities of each kind, keyed by kind name, so that they print in
+// a stable order.
+using KindCounts = std::map<std::string, unsigned, std::less<>>;
+
+static void PrintCounts(const KindCounts &decl_counts,
+                        const KindCounts &stmt_counts) {
+  for (const auto &[kind, count] : decl_counts) {
+    std::cout << "decl " << kind << ' ' << count << '\n';
+  }
+  for (const auto &[kind, count] : stmt_counts) {
+    std::cout << "stmt " << kind << ' ' << count << '\n';
+  }
+}
+
+// Counts the walked entities of each kind, and reports entities that are
+// walked more than once.
+class CountingWalker final : public pasta::Walker {
+ public:
+  std::mutex mutex;
+  std::unordered_set<const void *> seen;
+  KindCounts decl_counts;
+  KindCounts stmt_counts;
+
+  virtual ~CountingWalker(void) = default;
+
+  bool PreVisit(pasta::BorrowedDecl decl) final {
+    Count(decl.RawDecl(), decl.KindName(), decl_counts);
+    return true;
+  }
+
+  bool PreVisit(pasta::BorrowedStmt stmt) final {
+    Count(stmt.RawStmt(), stmt.KindName(), stmt_counts);
+    return true;
+  }
+
+ private:
+  void Count(const void *entity, std::string_view kind, KindCounts &counts) {
+    std::unique_lock<std::mutex> locker(mutex);
+    if (!seen.insert(entity).second) {
+      std::cout << "Walked twice: " << kind << '\n';
+    }
+
+    auto it = counts.find(kind);
+    if (it == counts.end()) {
+      counts.emplace(kind, 1u);
+    } else {
+      ++it->second;
+    }
+  }
+};
+
+// Walk `ast`, and print the number of walked entities of each kind.
+static void PrintWalkCounts(const pasta::AST &ast, const Options &options) {
+  CountingWalker walker;
+  if (options.num_threads) {
+    walker.WalkInParallel(ast, options.num_threads);
+  } else {
+    walker.Walk(ast);
+  }
+  PrintCounts(walker.decl_counts, walker.stmt_counts);
+}
+
+// NOTE(pag): Some derived classes hide `KindName`, e.g. `TagDecl::KindName`
+//            returns `struct`, `class`, etc.
+static std::string_view KindNameOf(const pasta::Decl &decl) {
+  return decl.KindName();
+}
+
+static std::string_view KindNameOf(const pasta::Stmt &stmt) {
+  return stmt.KindName();
+}
+
+static const void *RawEntityOf(const pasta::Decl &decl) {
+  return decl.RawDecl();
+}
+
+static const void *RawEntityOf(const pasta::Stmt &stmt) {
+  return stmt.RawStmt();
+}
+
+// Records the kind order of each walked entity, in walk order.
+class OrderingWalker final : public pasta::Walker {
+ public:
+  std::vector<std::pair<uint16_t, const void *>> decls;
+  std::vector<std::pair<uint16_t, const void *>> stmts;
+
+  virtual ~OrderingWalker(void) = default;
+
+  bool PreVisit(pasta::BorrowedDecl decl) final {
+    decls.emplace_back(pasta::detail::DeclKindOrder(decl.Kind()),
+                       decl.RawDecl());
+    return true;
+  }
+
+  bool PreVisit(pasta::BorrowedStmt stmt) final {
+    stmts.emplace_back(pasta::detail::StmtKindOrder(stmt.Kind()),
+                       stmt.RawStmt());
+    return true;
+  }
+};
+
+// Report the classes `T` for which `DeclsOfKind<T>` or `StmtsOfKind<T>` don't
+// return exactly the walked entities that are a `T`, in walk order.
+static void CheckIndexClasses(const pasta::AST &ast) {
+  OrderingWalker walker;
+  walker.Walk(ast);
+
+  auto check = [] (const auto &range, const auto &walked,
+                   pasta::detail::KindRange kind_range,
+                   std::string_view name) {
+    auto it = walked.begin();
+    auto next = [&] (void) {
+      while (it != walked.end() &&
+             !pasta::detail::IsInKindRange(it->first, kind_range)) {
+        ++it;
+      }
+    };
+
+    bool matches = true;
+    for (const auto &entity : range) {
+      next();
+      if (it == walked.end() || it->second != RawEntityOf(entity)) {
+        matches = false;
+        break;
+      }
+      ++it;
+    }
+    next();
+    if (!matches || it != walked.end()) {
+      std::cout << "Wrong entities in index of " << name << '\n';
+    }
+  };
+
+#define PASTA_CHECK_DECLS_OF_KIND(name) \
+    check(ast.DeclsOfKind<pasta::name ## Decl>(), walker.decls, \
+          pasta::name ## Decl::kKindRange, #name "Decl");
+
+#define PASTA_CHECK_DECLS_OF_ABSTRACT_KIND(name) \
+    check(ast.DeclsOfKind<pasta::name>(), walker.decls, \
+          pasta::name::kKindRange, #name);
+
+#define PASTA_CHECK_STMTS_OF_KIND(name) \
+    check(ast.StmtsOfKind<pasta::name>(), walker.stmts, \
+          pasta::name::kKindRange, #name);
+
+  PASTA_FOR_EACH_DECL_IMPL(PASTA_CHECK_DECLS_OF_KIND,
+                           PASTA_CHECK_DECLS_OF_ABSTRACT_KIND)
+  PASTA_FOR_EACH_STMT_IMPL(PASTA_CHECK_STMTS_OF_KIND,
+                           PASTA_CHECK_STMTS_OF_KIND,
+                           PASTA_CHECK_STMTS_OF_KIND,
+                           PASTA_CHECK_STMTS_OF_KIND,
+                           PASTA_CHECK_STMTS_OF_KIND,
+                           PASTA_CHECK_STMTS_OF_KIND)
+#undef PASTA_CHECK_DECLS_OF_KIND
+#undef PASTA_CHECK_DECLS_OF_ABSTRACT_KIND
+#undef PASTA_CHECK_STMTS_OF_KIND
+}
+
+// Print the number of entities of each kind in the kind index of `ast`, and
+// report indexed entities whose kind doesn't match the kind they were
+// requested by, as well as classes whose indexed entities don't match the
+// walked entities of that class.
+static void PrintIndexCounts(const pasta::AST &ast) {
+  KindCounts decl_counts;
+  KindCounts stmt_counts;
+
+  auto count = [] (const auto &range, std::string_view kind,
+                   KindCounts &counts) {
+    unsigned num_entities = 0u;
+    for (const auto &entity : range) {
+      if (KindNameOf(entity) != kind) {
+        std::cout << "Wrong kind in index: " << KindNameOf(entity)
+                  << " instead of " << kind << '\n';
+      }
+      ++num_entities;
+    }
+    if (num_entities) {
+      counts.emplace(kind, num_entities);
+    }
+  };
+
+#define PASTA_COUNT_DECLS_OF_KIND(name) \
+    count(ast.DeclsOfKind(pasta::DeclKind::k ## name), #name, decl_counts);
+
+#define PASTA_COUNT_STMTS_OF_KIND(name) \
+    count(ast.StmtsOfKind(pasta::StmtKind::k ## name), #name, stmt_counts);
+
+  PASTA_FOR_EACH_DECL_IMPL(PASTA_COUNT_DECLS_OF_KIND, PASTA_IGNORE_ABSTRACT)
+  PASTA_FOR_EACH_STMT_IMPL(PASTA_COUNT_STMTS_OF_KIND,
+                           PASTA_COUNT_STMTS_OF_KIND,
+                           PASTA_COUNT_STMTS_OF_KIND,
+                           PASTA_COUNT_STMTS_OF_KIND,
+                           PASTA_COUNT_STMTS_OF_KIND,
+                           PASTA_IGNORE_ABSTRACT)
+#undef PASTA_COUNT_DECLS_OF_KIND
+#undef PASTA_COUNT_STMTS_OF_KIND
+
+  PrintCounts(decl_counts, stmt_counts);
+  CheckIndexClasses(ast);
+}
+
+// Counts the entities of each kind that a Clang `RecursiveASTVisitor` visits.
+// This is the baseline against which we check the walker and the kind index.
+//
+// NOTE(pag): The visitor is configured to match what the walker promises to
+//            walk, i.e. implicit code, but not template instantiations. The
+//            visitor also revisits some shared expressions, which the walker
+//            walks only once, and so we skip those revisits here: the
+//            expressions of `CXXDefaultArgExpr`s and `CXXDefaultInitExpr`s
+//            are those of the parameters and fields, and the syntactic form of
+//            an initializer list shares its expressions with the semantic
+//            form. Attributes, labels, blocks, and the helper expressions of
+//            OpenMP clauses are walked differently, and so tests that compare
+//            against this baseline should avoid them.
+class CountingVisitor final
+    : public clang::RecursiveASTVisitor<CountingVisitor> {
+ public:
+  KindCounts decl_counts;
+  KindCounts stmt_counts;
+
+  bool shouldVisitImplicitCode(void) const {
+    return true;
+  }
+
+  bool VisitDecl(clang::Decl *decl) {
+    ++decl_counts[decl->getDeclKindName()];
+    return true;
+  }
+
+  bool VisitStmt(clang::Stmt *stmt) {
+    ++stmt_counts[stmt->getStmtClassName()];
+    return true;
+  }
+
+  bool TraverseCXXDefaultArgExpr(clang::CXXDefaultArgExpr *expr,
+                                 DataRecursionQueue * = nullptr) {
+    return WalkUpFromCXXDefaultArgExpr(expr);
+  }
+
+  bool TraverseCXXDefaultInitExpr(clang::CXXDefaultInitExpr *expr,
+                                  DataRecursionQueue * = nullptr) {
+    return WalkUpFromCXXDefaultInitExpr(expr);
+  }
+
+  bool TraverseInitListExpr(clang::InitListExpr *expr,
+                            DataRecursionQueue * = nullptr) {
+    if (!expr->isSemanticForm()) {
+      expr = expr->getSemanticForm();
+    }
+    if (!WalkUpFromInitListExpr(expr)) {
+      return false;
+    }
+    for (clang::Stmt *child : expr->children()) {
+      if (!TraverseStmt(child)) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+static void PrintVisitorCounts(const pasta::AST &ast) {
+  CountingVisitor visitor;
+  visitor.TraverseDecl(ast.UnderlyingAST().getTranslationUnitDecl());
+  PrintCounts(visitor.decl_counts, visitor.stmt_counts);
+}
+
+// Records the parent and nearest enclosing declaration of each walked entity.
+class ParentRecordingWalker final : public pasta::Walker {
+ public:
+  struct Parents {
+    const void *entity;
+    const void *parent;
+    const void *parent_decl;
+    bool is_decl;
+    bool parent_is_decl;
+  };
+
+  std::vector<Parents> entities;
+
+  virtual ~ParentRecordingWalker(void) = default;
+
+  bool PreVisit(pasta::BorrowedDecl decl) final {
+    Enter(decl.RawDecl(), true);
+    return true;
+  }
+
+  bool PreVisit(pasta::BorrowedStmt stmt) final {
+    Enter(stmt.RawStmt(), false);
+    return true;
+  }
+
+  void PostVisit(pasta::BorrowedDecl) final {
+    stack.pop_back();
+    decl_stack.pop_back();
+  }
+
+  void PostVisit(pasta::BorrowedStmt) final {
+    stack.pop_back();
+  }
+
+ private:
+  std::vector<std::pair<const void *, bool>> stack;
+  std::vector<const void *> decl_stack;
+
+  void Enter(const void *entity, bool is_decl) {
+    Parents &parents = entities.emplace_back();
+    parents.entity = entity;
+    parents.is_decl = is_decl;
+    parents.parent = stack.empty() ? nullptr : stack.back().first;
+    parents.parent_is_decl = !stack.empty() && stack.back().second;
+    parents.parent_decl = decl_stack.empty() ? nullptr : decl_stack.back();
+
+    stack.emplace_back(entity, is_decl);
+    if (is_decl) {
+      decl_stack.push_back(entity);
+    }
+  }
+};
+
+// Return the raw declaration of `decl`, or `nullptr`.
+static const void *RawOf(const std::optional<pasta::Decl> &decl) {
+  return decl ? decl->RawDecl() : nullptr;
+}
+
+static const void *RawOf(const std::optional<pasta::Stmt> &stmt) {
+  return stmt ? stmt->RawStmt() : nullptr;
+}
+
+// Check `Decl::ParentDeclaration`, `Stmt::Parent`, and
+// `Stmt::ParentDeclaration` against the parents observed while walking `ast`.
+// Report every mismatch, and print the number of statements whose parent is a
+// declaration, by the kinds of both.
+static void CheckParents(const pasta::AST &ast) {
+  ParentRecordingWalker walker;
+  walker.Walk(ast);
+
+  KindCounts decl_parent_counts;
+  for (const ParentRecordingWalker::Parents &parents : walker.entities) {
+    if (parents.is_decl) {
+      pasta::Decl decl = ast.Adopt(
+          reinterpret_cast<const clang::Decl *>(parents.entity));
+      if (RawOf(decl.ParentDeclaration()) != parents.parent_decl) {
+        std::cout << "Wrong parent declaration of " << decl.KindName()
+                  << '\n';
+      }
+      continue;
+    }
+
+    pasta::Stmt stmt = ast.Adopt(
+        reinterpret_cast<const clang::Stmt *>(parents.entity));
+    if (RawOf(stmt.ParentDeclaration()) != parents.parent_decl) {
+      std::cout << "Wrong parent declaration of " << stmt.KindName() << '\n';
+    }
+
+    const void *expected_parent =
+        parents.parent_is_decl ? nullptr : parents.parent;
+    if (RawOf(stmt.Parent()) != expected_parent) {
+      std::cout << "Wrong parent of " << stmt.KindName() << '\n';
+    }
+
+    if (parents.parent_is_decl) {
+      pasta::Decl parent = ast.Adopt(
+          reinterpret_cast<const clang::Decl *>(parents.parent));
+      std::string key(parent.KindName());
+      key += ' ';
+      key += stmt.KindName();
+      ++decl_parent_counts[key];
+    }
+  }
+
+  for (const auto &[kinds, count] : decl_parent_counts) {
+    std::cout << "parent " << kinds << ' ' << count << '\n';
+  }
+  std::cout << "Checked " << walker.entities.size() << " entities\n";
+}
+
+// Snapshot every declaration and statement of `ast`. Snapshots call every
+// scalar getter, and so this checks that the snapshots respect the
+// preconditions of the getters. The bit widths of fields are printed, so that
+// we can tell that guarded fields are filled in when their preconditions hold.
+static void SnapshotEntities(const pasta::AST &ast) {
+  KindCounts decl_counts;
+  KindCounts stmt_counts;
+
+  auto snapshot = [] (const auto &range, std::string_view kind,
+                      KindCounts &counts) {
+    unsigned num_entities = 0u;
+    for (const auto &entity : range) {
+      if (KindNameOf(entity) == kind) {
+        (void) entity.Snapshot();
+        ++num_entities;
+      }
+    }
+    if (num_entities) {
+      counts.emplace(kind, num_entities);
+    }
+  };
+
+// NOTE(pag): `DeclsOfKind<T>` and `StmtsOfKind<T>` also return entities of
+//            kinds derived from `T`, and so we only snapshot and count those
+//            of exactly the kind of `T`, so that each entity is snapshotted as
+//            its most derived class once.
+#define PASTA_SNAPSHOT_DECLS_OF_KIND(name) \
+    snapshot(ast.DeclsOfKind<pasta::name ## Decl>(), #name, decl_counts);
+
+#define PASTA_SNAPSHOT_STMTS_OF_KIND(name) \
+    snapshot(ast.StmtsOfKind<pasta::name>(), #name, stmt_counts);
+
+  PASTA_FOR_EACH_DECL_IMPL(PASTA_SNAPSHOT_DECLS_OF_KIND, PASTA_IGNORE_ABSTRACT)
+  PASTA_FOR_EACH_STMT_IMPL(PASTA_SNAPSHOT_STMTS_OF_KIND,
+                           PASTA_SNAPSHOT_STMTS_OF_KIND,
+                           PASTA_SNAPSHOT_STMTS_OF_KIND,
+                           PASTA_SNAPSHOT_STMTS_OF_KIND,
+                           PASTA_SNAPSHOT_STMTS_OF_KIND,
+                           PASTA_IGNORE_ABSTRACT)
+#undef PASTA_SNAPSHOT_DECLS_OF_KIND
+#undef PASTA_SNAPSHOT_STMTS_OF_KIND
+
+  PrintCounts(decl_counts, stmt_counts);
+
+  for (const pasta::FieldDecl &field : ast.DeclsOfKind<pasta::FieldDecl>()) {
+    const pasta::FieldDeclSnapshot field_snapshot = field.Snapshot();
+    std::cout << "field " << field.Name() << ' '
+              << field_snapshot.is_bit_field << ' '
+              << field_snapshot.bit_width_value << '\n';
+  }
+}
+
+// Print a parsed token. `T` is either a `Token` or a `TokenSnapshotToken`.
+template <typename T>
+static void PrintParsedToken(const T &tok) {
+  std::cout << "token " << tok.Index() << ' '
+            << static_cast<unsigned>(tok.Kind()) << ' '
+            << static_cast<unsigned>(tok.Role());
+  if (auto file_tok = tok.FileLocation()) {
+    std::cout << " @" << file_tok->Line() << ':' << file_tok->Column();
+  }
+  if (auto derived_tok = tok.DerivedLocation()) {
+    std::cout << " <" << derived_tok->Index();
+  }
+  std::cout << " |" << tok.Data() << '\n';
+}
+
+// Print the parsed files and tokens of `ast`. `T` is either an `AST` or a
+// `PreprocessedTranslationUnit`.
+template <typename T>
+static void PrintParsedTokens(const T &ast) {
+  for (const pasta::File &file : ast.ParsedFiles()) {
+    std::cout << "file " << file.Path().generic_string() << ' '
+              << file.DataHash().value_or(0u) << '\n';
+  }
+  for (const pasta::Token &tok : ast.Tokens()) {
+    PrintParsedToken(tok);
+  }
+}
+
+// Canonical macro definitions seen so far, across all compile jobs, numbered
+// in the order in which they were first seen. Holding onto the definitions
+// keeps them alive after their ASTs are gone, and so keeps them canonical.
+struct CanonicalMacros {
+  std::map<const void *, unsigned> ids;
+  std::vector<pasta::MacroDefinition> definitions;
+};
+
+// Print the name and canonical definition number of every `#define` in
+// `macros` and in their children.
+static void PrintCanonicalMacros(const pasta::MacroRange &macros,
+                                 CanonicalMacros &canon) {
+  for (const pasta::Macro &macro : macros) {
+    if (auto define = pasta::DefineMacroDirective::From(macro)) {
+      std::optional<pasta::MacroToken> name = define->Name();
+      std::cout << "define " << (name ? name->Data() : "<unnamed>");
+      if (auto def = define->CanonicalDefinition()) {
+        auto [it, added] = canon.ids.emplace(def->RawMacroDefinition(),
+                                             canon.definitions.size());
+        if (added) {
+          canon.definitions.push_back(*def);
+        }
+        std::cout << ' ' << it->second << " |" << def->Data() << '\n';
+      } else {
+        std::cout << " none\n";
+      }
+    }
+    PrintCanonicalMacros(macro.Children(), canon);
+  }
+}
+
+// Print the data and file locations of the tokens of `ast` that were seen by
+// the parser.
+static void PrintParsedLocations(const pasta::AST &ast) {
+  for (const pasta::Token &tok : ast.Tokens()) {
+    if (tok.Role() != pasta::TokenRole::kFileToken &&
+        tok.Role() != pasta::TokenRole::kFinalMacroExpansionToken) {
+      continue;
+    }
+    std::cout << "token";
+    if (auto file_tok = tok.FileLocation()) {
+      std::cout << " @" << file_tok->Line() << ':' << file_tok->Column();
+    }
+    std::cout << " |" << tok.Data() << '\n';
+  }
+}
+
+// Print the macro nodes of `macros` and of their children, nested `depth`
+// levels deep. Macro tokens are printed along with the parsed tokens that
+// they became.
+static void PrintMacros(const pasta::MacroRange &macros, unsigned depth) {
+  for (const pasta::Macro &macro : macros) {
+    std::cout << "macro " << depth << ' ' << macro.KindName();
+    if (auto tok = pasta::MacroToken::From(macro)) {
+      std::cout << " <" << tok->ParsedLocation().Index() << " |"
+                << tok->Data();
+    }
+    std::cout << '\n';
+    PrintMacros(macro.Children(), depth + 1u);
+  }
+}
+
+// Print the parsed files and tokens of `snapshot`, in the same format as for
+// an AST.
+static void PrintParsedTokens(const pasta::TokenSnapshot &snapshot) {
+  for (uint32_t i = 0u, max_i = snapshot.NumFiles(); i < max_i; ++i) {
+    std::optional<pasta::TokenSnapshotFile> file = snapshot.File(i);
+    std::cout << "file " << file->Path().generic_string() << ' '
+              << file->DataHash() << '\n';
+  }
+  for (uint32_t i = 0u, max_i = snapshot.NumTokens(); i < max_i; ++i) {
+    PrintParsedToken(snapshot.Token(i).value());
+  }
+}
+
+// Return the raw file token of `tok`'s file location, or `nullptr`.
+static const void *RawFileTokenOf(const pasta::Token &tok) {
+  std::optional<pasta::FileToken> file_tok = tok.FileLocation();
+  return file_tok ? file_tok->RawFileToken() : nullptr;
+}
+
+// Check `Token::DerivationDepth` and `Token::FileLocation`, which are looked
+// up in tables, against following `Token::DerivedLocation` by hand. Report
+// every mismatch, and print the number of tokens at each derivation depth.
+//
+// NOTE(pag): Every token that follows the first token with a file location in
+//            a derivation chain is derived from that same file location, and
+//            so the file location of the last token of the chain is that of
+//            the whole chain.
+static void CheckDerivations(const pasta::AST &ast) {
+  std::map<unsigned, unsigned> depth_counts;
+  unsigned num_tokens = 0u;
+  for (const pasta::Token &tok : ast.Tokens()) {
+    ++num_tokens;
+
+    unsigned walked_depth = 0u;
+    pasta::Token root = tok;
+    for (auto derived = tok.DerivedLocation(); derived;
+         derived = derived->DerivedLocation()) {
+      root = derived.value();
+      ++walked_depth;
+    }
+
+    const unsigned depth = tok.DerivationDepth();
+    if (depth != walked_depth) {
+      std::cout << "Wrong derivation depth of token " << tok.Index() << ": "
+                << depth << " instead of " << walked_depth << '\n';
+    }
+    if (depth != tok.DerivationChain().size() - 1u) {
+      std::cout << "Wrong derivation chain of token " << tok.Index() << '\n';
+    }
+    if (RawFileTokenOf(tok) != RawFileTokenOf(root)) {
+      std::cout << "Wrong file location of token " << tok.Index() << '\n';
+    }
+    ++depth_counts[walked_depth];
+  }
+
+  for (const auto &[depth, count] : depth_counts) {
+    std::cout << "depth " << depth << ' ' << count << '\n';
+  }
+  std::cout << "Checked " << num_tokens << " tokens\n";
+}
+
+// Write a token snapshot of `ast` into the file at `path`, load the snapshot
+// back from that file, and print its parsed files and tokens.
+static bool PrintTokenSnapshot(const pasta::AST &ast,
+                               const std::filesystem::path &path) {
+  auto maybe_data = pasta::TokenSnapshot::Serialize(ast);
+  if (!maybe_data.Succeeded()) {
+    std::cerr << maybe_data.TakeError().message() << std::endl;
+    return false;
+  }
+
+  std::string data = maybe_data.TakeValue();
+  std::ofstream os(path, std::ios::binary | std::ios::trunc);
+  os.write(data.data(), static_cast<std::streamsize>(data.size()));
+  os.close();
+  if (!os) {
+    std::cerr << "Unable to write " << path.generic_string() << std::endl;
+    return false;
+  }
+
+  auto maybe_snapshot = pasta::TokenSnapshot::Load(path);
+  if (!maybe_snapshot.Succeeded()) {
+    std::cerr << maybe_snapshot.TakeError().message() << std::endl;
+    return false;
+  }
+
+  PrintParsedTokens(maybe_snapshot.TakeValue());
+  return true;
+}
+
+// Export the entities of `ast`, load the export back, and print its entities
+// and references. Kinds are printed as numbers.
+static bool PrintEntityExport(const pasta::AST &ast, const Options &options) {
+  auto maybe_export = pasta::EntityExport::Load(
+      pasta::EntityExport::Serialize(ast, options.num_threads));
+  if (!maybe_export.Succeeded()) {
+    std::cerr << maybe_export.TakeError().message() << std::endl;
+    return false;
+  }
+
+  const pasta::EntityExport entity_export = maybe_export.TakeValue();
+  uint32_t index = 0u;
+  for (const pasta::ExportedEntity &entity : entity_export.Entities()) {
+    std::cout << "entity " << index++ << ' ' << entity.parent << ' '
+              << static_cast<unsigned>(entity.category) << ' '
+              << entity.kind << ' ' << entity.first_token << ' '
+              << entity.last_token << ' ' << entity.token << " |"
+              << entity_export.Name(entity) << '\n';
+  }
+  for (const pasta::ExportedReference &ref : entity_export.References()) {
+    std::cout << "reference " << ref.from << ' ' << ref.to << ' '
+              << static_cast<unsigned>(ref.kind) << '\n';
+  }
+  return true;
+}
+
+// Return the number of microseconds since `start`.
+static uint64_t MicrosecondsSince(std::chrono::steady_clock::time_point start) {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::steady_clock::now() - start).count());
+}
+
+// Run `job` with and without macro tracking, and print how long each run took.
+static bool TimeMacroTracking(const pasta::CompileJob &job) {
+  for (auto tracking : {pasta::MacroTracking::kEnabled,
+                        pasta::MacroTracking::kDisabled}) {
+    const auto start = std::chrono::steady_clock::now();
+    auto maybe_ast = job.Run(tracking);
+    const uint64_t us = MicrosecondsSince(start);
+    if (!maybe_ast.Succeeded()) {
+      std::cerr << maybe_ast.TakeError() << std::endl;
+      return false;
+    }
+    std::cerr << "time run "
+              << (tracking == pasta::MacroTracking::kEnabled ?
+                  "with" : "without")
+              << " macro tracking " << us << "us\n";
+  }
+  return true;
+}
+
+// Exports the entities of an AST by calling the public accessors of each
+// walked declaration and statement, i.e. what a user of PASTA would do without
+// `EntityExport`. This is the baseline against which `EntityExport::Serialize`
+// is timed.
+class AccessorExporter final : public pasta::Walker {
+ public:
+  std::vector<pasta::ExportedEntity> entities;
+  std::vector<pasta::ExportedReference> references;
+  std::string names;
+
+  explicit AccessorExporter(const pasta::AST &ast_)
+      : ast(ast_) {}
+
+  virtual ~AccessorExporter(void) = default;
+
+  bool PreVisit(pasta::BorrowedDecl borrowed_decl) final {
+    const pasta::Decl decl = ast.Adopt(borrowed_decl.RawDecl());
+    pasta::ExportedEntity &entity = Enter(decl.RawDecl());
+    entity.category = pasta::ExportedEntityCategory::kDeclaration;
+    entity.kind = static_cast<uint16_t>(decl.Kind());
+
+    const pasta::TokenRange tokens = decl.Tokens();
+    entity.first_token = TokenIndex(tokens.Front());
+    entity.last_token = TokenIndex(tokens.Back());
+    entity.token = TokenIndex(decl.Token());
+
+    if (auto named = pasta::NamedDecl::From(decl)) {
+      const std::string name = named->Name();
+      entity.name_offset = static_cast<uint32_t>(names.size());
+      entity.name_length = static_cast<uint32_t>(name.size());
+      names += name;
+    }
+
+    Refer(decl.CanonicalDeclaration(),
+          pasta::ExportedReferenceKind::kCanonicalDeclaration);
+    return true;
+  }
+
+  bool PreVisit(pasta::BorrowedStmt borrowed_stmt) final {
+    const pasta::Stmt stmt = ast.Adopt(borrowed_stmt.RawStmt());
+    pasta::ExportedEntity &entity = Enter(stmt.RawStmt());
+    entity.category = pasta::ExportedEntityCategory::kStatement;
+    entity.kind = static_cast<uint16_t>(stmt.Kind());
+    entity.first_token = TokenIndex(stmt.BeginToken());
+    entity.last_token = TokenIndex(stmt.EndToken());
+    entity.token = entity.first_token;
+
+    if (auto ref = pasta::DeclRefExpr::From(stmt)) {
+      Refer(ref->Declaration(),
+            pasta::ExportedReferenceKind::kReferencedDeclaration);
+    } else if (auto member = pasta::MemberExpr::From(stmt)) {
+      Refer(member->MemberDeclaration(),
+            pasta::ExportedReferenceKind::kReferencedDeclaration);
+    } else if (auto call = pasta::CallExpr::From(stmt)) {
+      if (auto callee = call->DirectCallee()) {
+        Refer(callee.value(),
+              pasta::ExportedReferenceKind::kCalledDeclaration);
+      }
+    }
+    return true;
+  }
+
+  void PostVisit(pasta::BorrowedDecl) final {
+    parents.pop_back();
+  }
+
+  void PostVisit(pasta::BorrowedStmt) final {
+    parents.pop_back();
+  }
+
+  // Resolve the references to the exported declarations, dropping those to
+  // declarations that weren't exported.
+  void ResolveReferences(void) {
+    for (const auto &[from, to, kind] : pending_references) {
+      if (auto it = indices.find(to); it != indices.end()) {
+        pasta::ExportedReference &ref = references.emplace_back();
+        ref.from = from;
+        ref.to = it->second;
+        ref.kind = kind;
+      }
+    }
+  }
+
+ private:
+  const pasta::AST &ast;
+  std::vector<uint32_t> parents;
+  std::unordered_map<const void *, uint32_t> indices;
+  std::vector<std::tuple<uint32_t, const void *, pasta::ExportedReferenceKind>>
+      pending_references;
+
+  static uint32_t TokenIndex(const std::optional<pasta::Token> &tok) {
+    return tok ? TokenIndex(tok.value()) : pasta::kInvalidTokenIndex;
+  }
+
+  static uint32_t TokenIndex(const pasta::Token &tok) {
+    return tok ? static_cast<uint32_t>(tok.Index()) :
+                 pasta::kInvalidTokenIndex;
+  }
+
+  pasta::ExportedEntity &Enter(const void *raw_entity) {
+    const auto index = static_cast<uint32_t>(entities.size());
+    indices.emplace(raw_entity, index);
+    pasta::ExportedEntity &entity = entities.emplace_back();
+    entity.parent = parents.empty() ? pasta::kInvalidExportIndex :
+                                      parents.back();
+    parents.push_back(index);
+    return entity;
+  }
+
+  void Refer(const pasta::Decl &to, pasta::ExportedReferenceKind kind) {
+    pending_references.emplace_back(parents.back(), to.RawDecl(), kind);
+  }
+};
+
+// Export the entities of `ast` with `EntityExport::Serialize`, and with an
+// `AccessorExporter`, and print how many entities each exported and how long
+// each took.
+static void TimeEntityExport(const pasta::AST &ast, const Options &options) {
+  auto start = std::chrono::steady_clock::now();
+  const std::string data =
+      pasta::EntityExport::Serialize(ast, options.num_threads);
+  uint64_t us = MicrosecondsSince(start);
+  if (auto maybe_export = pasta::EntityExport::Load(data);
+      maybe_export.Succeeded()) {
+    std::cerr << "time entity export "
+              << maybe_export.TakeValue().Entities().size() << " entities "
+              << us << "us\n";
+  }
+
+  start = std::chrono::steady_clock::now();
+  AccessorExporter exporter(ast);
+  exporter.Walk(ast);
+  exporter.ResolveReferences();
+  us = MicrosecondsSince(start);
+  std::cerr << "time accessor export " << exporter.entities.size()
+            << " entities " << us << "us\n";
+}
+
+// Run `job` through the compile cache in `options.compile_cache_dir`, and
+// print whether or not it hit the cache, as well as the parsed files and
+// tokens of its snapshot.
+static bool RunCached(const pasta::Compiler &compiler,
+                      const pasta::CompileJob &job, const Options &options) {
+  const pasta::CompileCache cache(options.compile_cache_dir);
+  const bool hit = cache.Lookup(compiler, job).has_value();
+  std::cout << "cache " << (hit ? "hit" : "miss") << '\n';
+
+  auto maybe_snapshot = cache.Run(compiler, job);
+  if (!maybe_snapshot.Succeeded()) {
+    std::cerr << maybe_snapshot.TakeError() << std::endl;
+    return false;
+  }
+
+  // NOTE(pag): The key without macro tracking differs from the key of `job`,
+  //            and so looking it up must miss, even though the entry at its
+  //            path is a valid entry.
+  if (options.check_cache_collisions) {
+    const auto other_tracking = pasta::MacroTracking::kDisabled;
+    std::error_code ec;
+    std::filesystem::copy_file(
+        cache.EntryPath(compiler, job),
+        cache.EntryPath(compiler, job, other_tracking),
+        std::filesystem::copy_options::overwrite_existing, ec);
+    if (ec) {
+      std::cerr << ec.message() << std::endl;
+      return false;
+    }
+
+    const bool other_hit =
+        cache.Lookup(compiler, job, other_tracking).has_value();
+    std::cout << "cache collision " << (other_hit ? "hit" : "miss") << '\n';
+  }
+
+  PrintParsedTokens(maybe_snapshot.TakeValue());
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  Options options;
+  std::vector<const char *> compile_args;
+  for (auto i = 1; i < argc; ++i) {
+    if (!ParseOption(argv[i], options)) {
+      compile_args.push_back(argv[i]);
+    }
+  }
+
+  if (compile_args.empty()) {
+    std::cerr << "Usage: " << argv[0]
+              << " [--pasta-OPTION...] COMPILE_COMMAND..." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  pasta::InitPasta initializer;
+  auto tl = pasta::TargetLanguage::kC;
+
+  const pasta::ArgumentVector args(compile_args);
+  for (auto arg : args) {
+    if (strstr(arg, "++") || strstr(arg, "cpp") || strstr(arg, "hpp") ||
+        strstr(arg, "cxx") || strstr(arg, "hxx")) {
+      tl = pasta::TargetLanguage::kCXX;
+      break;
+    }
+  }
+
+  pasta::FileManager fm(pasta::FileSystem::CreateNative());
+  if (options.share_macro_definitions) {
+    fm.EnableMacroDefinitionSharing();
+  }
+
+  auto maybe_compiler =
+      pasta::Compiler::CreateHostCompiler(fm, tl);
+  if (!maybe_compiler.Succeeded()) {
+    std::cerr << maybe_compiler.TakeError() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  auto maybe_cwd = pasta::FileSystem::From(
+      maybe_compiler.Value())->CurrentWorkingDirectory();
+  if (!maybe_cwd.Succeeded()) {
+    std::cerr << maybe_cwd.TakeError().message() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  auto maybe_command = pasta::CompileCommand::CreateFromArguments(
+      args, maybe_cwd.TakeValue());
+  if (!maybe_command.Succeeded()) {
+    std::cerr << maybe_command.TakeError() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  const auto command = maybe_command.TakeValue();
+  auto maybe_jobs = maybe_compiler->CreateJobsForCommand(command);
+  if (!maybe_jobs.Succeeded()) {
+    std::cerr << maybe_jobs.TakeError() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  CanonicalMacros canon;
+  for (const auto &job : maybe_jobs.TakeValue()) {
+    if (!options.compile_cache_dir.empty()) {
+      if (!RunCached(maybe_compiler.Value(), job, options)) {
+        return EXIT_FAILURE;
+      }
+      continue;
+    }
+
+    if (options.preprocess_only) {
+      auto maybe_tu = job.Preprocess();
+      if (!maybe_tu.Succeeded()) {
+        std::cerr << maybe_tu.TakeError() << std::endl;
+        return EXIT_FAILURE;
+      }
+
+      pasta::PreprocessedTranslationUnit tu = maybe_tu.TakeValue();
+      if (options.print_parsed_tokens) {
+        PrintParsedTokens(tu);
+      }
+      if (options.print_macros) {
+        PrintMacros(tu.Macros(), 0u);
+      }
+      continue;
+    }
+
+    if (options.print_times && !TimeMacroTracking(job)) {
+      return EXIT_FAILURE;
+    }
+
+    auto maybe_ast = job.Run(options.macro_tracking);
+    if (!maybe_ast.Succeeded()) {
+      std::cerr << maybe_ast.TakeError() << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    pasta::AST ast = maybe_ast.TakeValue();
+    if (options.print_times) {
+      TimeEntityExport(ast, options);
+    }
+    if (options.print_walk_counts) {
+      PrintWalkCounts(ast, options);
+    }
+    if (options.print_index_counts) {
+      PrintIndexCounts(ast);
+    }
+    if (options.print_visitor_counts) {
+      PrintVisitorCounts(ast);
+    }
+    if (options.check_parents) {
+      CheckParents(ast);
+    }
+    if (options.snapshot_entities) {
+      SnapshotEntities(ast);
+    }
+    if (options.print_parsed_tokens) {
+      PrintParsedTokens(ast);
+    }
+    if (options.print_macros) {
+      PrintMacros(ast.Macros(), 0u);
+    }
+    if (options.print_parsed_locations) {
+      PrintParsedLocations(ast);
+    }
+    if (options.print_canonical_macros) {
+      std::cout << "job " << job.SourceFile().Path().generic_string() << '\n';
+      PrintCanonicalMacros(ast.Macros(), canon);
+    }
+    if (options.check_derivations) {
+      CheckDerivations(ast);
+    }
+    if (options.print_entity_export && !PrintEntityExport(ast, options)) {
+      return EXIT_FAILURE;
+    }
+    if (!options.token_snapshot_path.empty() &&
+        !PrintTokenSnapshot(ast, options.token_snapshot_path)) {
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
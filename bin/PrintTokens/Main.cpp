@@ -0,0 +1,436 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#include <pasta/AST/AST.h>
+#include <pasta/AST/Borrowed.h>
+#include <pasta/AST/Decl.h>
+#include <pasta/AST/Printer.h>
+#include <pasta/Compile/Command.h>
+#include <pasta/Compile/Compiler.h>
+#include <pasta/Compile/Job.h>
+#include <pasta/Util/ArgumentVector.h>
+#include <pasta/Util/FileSystem.h>
+#include <pasta/Util/Init.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+// Options specific to this tool. These are removed from the compile command.
+struct Options {
+
+  // If non-zero, then print the top-level declarations in parallel using this
+  // many threads.
+  unsigned num_threads{0u};
+
+  // Print the kinds of each token's contexts.
+  bool print_contexts{false};
+
+  // Print the number of leading new lines and spaces before each token.
+  bool print_whitespace{false};
+
+  // Print each explicit top-level declaration separately.
+  bool print_top_level_decls{false};
+
+  // Enable the AST's print cache, and print each top-level declaration twice,
+  // only outputting the second (cached) print.
+  bool print_cache{false};
+
+  // Print each explicit top-level declaration separately, concatenate them
+  // into a rope, and print the flattened rope.
+  bool print_rope{false};
+
+  // If non-zero, then build, flatten, and destroy a rope that concatenates
+  // this many copies of the printed translation unit.
+  unsigned deep_rope_length{0u};
+
+  // Re-use the tokens printed for types within a single print. See
+  // `PrintingPolicy::ShouldCachePrintedTypes`.
+  bool cache_types{true};
+
+  // Print each explicit top-level declaration separately, twice: first with
+  // tag bodies, then without them.
+  bool alternate_policies{false};
+
+  // Align the parsed tokens of the translation unit with its printed tokens,
+  // and print the parsed tokens.
+  bool align{false};
+
+  // Anchor alignments on unique tokens. See
+  // `AlignmentSession::EnableAnchoredMatching`.
+  bool anchor_alignments{true};
+
+  // Align each top-level declaration separately, using `num_threads` threads,
+  // and print the concatenated parsed tokens.
+  bool align_top_level_decls{false};
+
+  // Print the top-level declarations through the views of borrowed handles,
+  // as obtained from `BorrowedDecl::View`.
+  bool print_borrowed{false};
+
+  // Print the translation unit with `PrintedTokenRange::Stream`, printing
+  // the tokens of each chunk as soon as it is streamed.
+  bool print_stream{false};
+};
+
+// A printing policy whose decisions are configured by our options.
+class ConfigurablePolicy final : public pasta::PrintingPolicy {
+ public:
+  const bool cache_types;
+  const bool print_tag_bodies;
+
+  inline ConfigurablePolicy(bool cache_types_, bool print_tag_bodies_)
+      : cache_types(cache_types_),
+        print_tag_bodies(print_tag_bodies_) {}
+
+  virtual ~ConfigurablePolicy(void) = default;
+
+  bool ShouldPrintTagBodies(void) const final {
+    return print_tag_bodies;
+  }
+
+  bool ShouldCachePrintedTypes(void) const final {
+    return cache_types;
+  }
+};
+
+// Try to parse `arg` as one of our options. Returns `false` if `arg` should be
+// passed along to the compiler.
+static bool ParseOption(std::string_view arg, Options &options) {
+  static constexpr std::string_view kThreads = "--pasta-threads=";
+  static constexpr std::string_view kDeepRope = "--pasta-deep-rope=";
+  if (arg.starts_with(kThreads)) {
+    options.num_threads = static_cast<unsigned>(
+        std::strtoul(arg.substr(kThreads.size()).data(), nullptr, 10));
+    return true;
+
+  } else if (arg == "--pasta-contexts") {
+    options.print_contexts = true;
+    return true;
+
+  } else if (arg == "--pasta-whitespace") {
+    options.print_whitespace = true;
+    return true;
+
+  } else if (arg == "--pasta-top-level-decls") {
+    options.print_top_level_decls = true;
+    return true;
+
+  } else if (arg == "--pasta-rope") {
+    options.print_top_level_decls = true;
+    options.print_rope = true;
+    return true;
+
+  } else if (arg.starts_with(kDeepRope)) {
+    options.deep_rope_length = static_cast<unsigned>(
+        std::strtoul(arg.substr(kDeepRope.size()).data(), nullptr, 10));
+    return true;
+
+  } else if (arg == "--pasta-no-type-cache") {
+    options.cache_types = false;
+    return true;
+
+  } else if (arg == "--pasta-alternate-policies") {
+    options.print_top_level_decls = true;
+    options.alternate_policies = true;
+    return true;
+
+  } else if (arg == "--pasta-align") {
+    options.align = true;
+    return true;
+
+  } else if (arg == "--pasta-align-top-level-decls") {
+    options.align_top_level_decls = true;
+    return true;
+
+  } else if (arg == "--pasta-no-anchors") {
+    options.anchor_alignments = false;
+    return true;
+
+  } else if (arg == "--pasta-borrowed") {
+    options.print_top_level_decls = true;
+    options.print_borrowed = true;
+    return true;
+
+  } else if (arg == "--pasta-stream") {
+    options.print_stream = true;
+    return true;
+
+  } else if (arg == "--pasta-print-cache") {
+    options.print_top_level_decls = true;
+    options.print_cache = true;
+    return true;
+
+  } else {
+    return false;
+  }
+}
+
+// Print the kinds of the contexts of `tok`, innermost first.
+static void PrintContexts(const pasta::PrintedToken &tok) {
+  std::optional<pasta::TokenContext> context = tok.Context();
+  const char *sep = " @";
+  for (; context; context = context->Parent()) {
+    std::cout << sep << context->KindName();
+    sep = "/";
+  }
+}
+
+static void PrintToken(const pasta::PrintedToken &tok,
+                       const Options &options) {
+  if (options.print_whitespace) {
+    std::cout << tok.NumLeadingNewLines() << ' ' << tok.NumLeadingSpaces()
+              << " |";
+  }
+  std::cout << tok.Data();
+  if (options.print_contexts) {
+    PrintContexts(tok);
+  }
+  std::cout << '\n';
+}
+
+static void PrintTokens(const pasta::PrintedTokenRange &range,
+                        const Options &options) {
+  for (const pasta::PrintedToken &tok : range) {
+    PrintToken(tok, options);
+  }
+}
+
+// Prints the tokens of each streamed chunk as soon as the chunk is accepted.
+// Every chunk ends with an end-of-file token, but only that of the last chunk
+// is printed, so that the output matches printing the translation unit in one
+// go.
+class PrintingSink final : public pasta::PrintedTokenSink {
+ public:
+  const Options &options;
+  std::optional<pasta::PrintedTokenRange> last_chunk;
+
+  inline explicit PrintingSink(const Options &options_)
+      : options(options_) {}
+
+  virtual ~PrintingSink(void) = default;
+
+  void Accept(const pasta::PrintedTokenRange &chunk) final {
+    for (const pasta::PrintedToken &tok : chunk) {
+      if (tok.Kind() != pasta::TokenKind::kEndOfFile) {
+        PrintToken(tok, options);
+      }
+    }
+    last_chunk = chunk;
+  }
+
+  void Finish(void) {
+    if (!last_chunk) {
+      return;
+    }
+    for (const pasta::PrintedToken &tok : last_chunk.value()) {
+      if (tok.Kind() == pasta::TokenKind::kEndOfFile) {
+        PrintToken(tok, options);
+      }
+    }
+    last_chunk.reset();
+  }
+};
+
+// Print each explicit top-level declaration of `ast` separately.
+static void PrintTopLevelDecls(const pasta::AST &ast, const Options &options,
+                               const pasta::PrintingPolicy &pp) {
+  const ConfigurablePolicy no_tag_bodies_pp(options.cache_types, false);
+
+  if (options.print_cache) {
+    ast.EnablePrintCache(64u << 20u);
+  }
+
+  std::optional<pasta::PrintedTokenRope> rope;
+
+  const pasta::DeclContext tu = ast.TranslationUnit();
+  for (const pasta::Decl &owned_decl : tu.AlreadyLoadedDeclarations()) {
+    if (owned_decl.IsImplicit()) {
+      continue;
+    }
+
+    const pasta::Decl decl = options.print_borrowed ?
+                             *pasta::BorrowedDecl(owned_decl).View() :
+                             owned_decl;
+
+    if (options.print_cache) {
+      (void) pasta::PrintedTokenRange::Create(decl, pp);
+    }
+
+    auto range = pasta::PrintedTokenRange::Create(decl, pp);
+    if (options.alternate_policies) {
+      PrintTokens(range, options);
+      PrintTokens(pasta::PrintedTokenRange::Create(decl, no_tag_bodies_pp),
+                  options);
+
+    } else if (!options.print_rope) {
+      PrintTokens(range, options);
+
+    // Flatten each intermediate rope, so that flattening the final rope has
+    // to release them.
+    } else if (rope) {
+      rope = pasta::PrintedTokenRope::Concatenate(rope.value(), range);
+      (void) rope->Flatten();
+
+    } else {
+      rope.emplace(range);
+    }
+  }
+
+  if (rope) {
+    PrintTokens(rope->Flatten(), options);
+  }
+}
+
+// Align the parsed tokens of `ast` with the printed translation unit, and print
+// the parsed tokens, which now have the contexts of the printed tokens.
+static void PrintAlignedTokens(const pasta::AST &ast, const Options &options,
+                               const pasta::PrintingPolicy &pp) {
+  auto parsed = pasta::PrintedTokenRange::Adopt(ast.Tokens());
+  auto printed = pasta::PrintedTokenRange::Create(ast.TranslationUnit(), pp);
+
+  pasta::AlignmentSession session;
+  session.EnableAnchoredMatching(options.anchor_alignments);
+  if (auto err = session.Align(parsed, printed)) {
+    std::cout << "Alignment error: " << err.value() << '\n';
+  }
+
+  PrintTokens(parsed, options);
+}
+
+// Build a rope that concatenates `length` copies of the printed translation
+// unit, one at a time, flatten it, and then destroy it.
+static bool BuildDeepRope(const pasta::AST &ast, unsigned length) {
+  auto range = pasta::PrintedTokenRange::Create(ast.TranslationUnit());
+  pasta::PrintedTokenRope rope(range);
+  for (auto i = 1u; i < length; ++i) {
+    rope = pasta::PrintedTokenRope::Concatenate(rope, range).value();
+  }
+
+  if (rope.Size() != range.Size() * length ||
+      rope.Flatten().Size() != rope.Size()) {
+    std::cerr << "Deep rope has the wrong size" << std::endl;
+    return false;
+  }
+
+  std::cout << "Deep rope of " << rope.NumSegments() << " segments\n";
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  Options options;
+  std::vector<const char *> compile_args;
+  for (auto i = 1; i < argc; ++i) {
+    if (!ParseOption(argv[i], options)) {
+      compile_args.push_back(argv[i]);
+    }
+  }
+
+  if (compile_args.empty()) {
+    std::cerr << "Usage: " << argv[0]
+              << " [--pasta-OPTION...] COMPILE_COMMAND..." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  pasta::InitPasta initializer;
+  auto tl = pasta::TargetLanguage::kC;
+
+  const pasta::ArgumentVector args(compile_args);
+  for (auto arg : args) {
+    if (strstr(arg, "++") || strstr(arg, "cpp") || strstr(arg, "hpp") ||
+        strstr(arg, "cxx") || strstr(arg, "hxx")) {
+      tl = pasta::TargetLanguage::kCXX;
+      break;
+    }
+  }
+
+  pasta::FileManager fm(pasta::FileSystem::CreateNative());
+  auto maybe_compiler =
+      pasta::Compiler::CreateHostCompiler(fm, tl);
+  if (!maybe_compiler.Succeeded()) {
+    std::cerr << maybe_compiler.TakeError() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  auto maybe_cwd = pasta::FileSystem::From(
+      maybe_compiler.Value())->CurrentWorkingDirectory();
+  if (!maybe_cwd.Succeeded()) {
+    std::cerr << maybe_cwd.TakeError().message() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  auto maybe_command = pasta::CompileCommand::CreateFromArguments(
+      args, maybe_cwd.TakeValue());
+  if (!maybe_command.Succeeded()) {
+    std::cerr << maybe_command.TakeError() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  const auto command = maybe_command.TakeValue();
+  auto maybe_jobs = maybe_compiler->CreateJobsForCommand(command);
+  if (!maybe_jobs.Succeeded()) {
+    std::cerr << maybe_jobs.TakeError() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  for (const auto &job : maybe_jobs.TakeValue()) {
+    auto maybe_ast = job.Run();
+    if (!maybe_ast.Succeeded()) {
+      std::cerr << maybe_ast.TakeError() << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    // NOTE(pag): Only an unspecialized `PrintingPolicy` can use the AST's
+    //            print cache.
+    const pasta::PrintingPolicy default_pp;
+    const ConfigurablePolicy configured_pp(options.cache_types, true);
+    const pasta::PrintingPolicy &pp =
+        options.cache_types ? default_pp : configured_pp;
+
+    pasta::AST ast = maybe_ast.TakeValue();
+    if (options.align_top_level_decls) {
+      std::vector<std::string> errors;
+      auto aligned = pasta::PrintedTokenRange::AlignTopLevelDecls(
+          ast, options.num_threads, pp, &errors);
+      for (const std::string &err : errors) {
+        std::cout << "Alignment error: " << err << '\n';
+      }
+      PrintTokens(aligned, options);
+
+    } else if (options.align) {
+      PrintAlignedTokens(ast, options, pp);
+
+    } else if (options.deep_rope_length) {
+      if (!BuildDeepRope(ast, options.deep_rope_length)) {
+        return EXIT_FAILURE;
+      }
+
+    } else if (options.print_top_level_decls) {
+      PrintTopLevelDecls(ast, options, pp);
+
+    } else if (options.print_stream) {
+      PrintingSink sink(options);
+      pasta::PrintedTokenRange::Stream(ast.TranslationUnit(), sink, pp);
+      sink.Finish();
+
+    } else if (options.num_threads) {
+      PrintTokens(pasta::PrintedTokenRange::PrintTopLevelDecls(
+                      ast, options.num_threads, pp),
+                  options);
+    } else {
+      PrintTokens(pasta::PrintedTokenRange::Create(ast.TranslationUnit(), pp),
+                  options);
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -23,6 +23,11 @@ void RegisterAbstractConditionalOperator(nb::module_ &m) {
     .def_prop_ro("condition", &AbstractConditionalOperator::Condition)
     .def_prop_ro("false_expression", &AbstractConditionalOperator::FalseExpression)
     .def_prop_ro("question_token", &AbstractConditionalOperator::QuestionToken)
-    .def_prop_ro("true_expression", &AbstractConditionalOperator::TrueExpression);
+    .def_prop_ro("true_expression", &AbstractConditionalOperator::TrueExpression)
+    .def("snapshot", &AbstractConditionalOperator::Snapshot);
+
+  nb::class_<AbstractConditionalOperatorSnapshot, ExprSnapshot>(m, "AbstractConditionalOperatorSnapshot")
+    .def_ro("colon_token", &AbstractConditionalOperatorSnapshot::colon_token)
+    .def_ro("question_token", &AbstractConditionalOperatorSnapshot::question_token);
 }
 } // namespace pasta
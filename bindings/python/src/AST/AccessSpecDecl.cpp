@@ -20,6 +20,11 @@ namespace nb = nanobind;
 void RegisterAccessSpecDecl(nb::module_ &m) {
   nb::class_<AccessSpecDecl, Decl>(m, "AccessSpecDecl")
     .def_prop_ro("access_specifier_token", &AccessSpecDecl::AccessSpecifierToken)
-    .def_prop_ro("colon_token", &AccessSpecDecl::ColonToken);
+    .def_prop_ro("colon_token", &AccessSpecDecl::ColonToken)
+    .def("snapshot", &AccessSpecDecl::Snapshot);
+
+  nb::class_<AccessSpecDeclSnapshot, DeclSnapshot>(m, "AccessSpecDeclSnapshot")
+    .def_ro("access_specifier_token", &AccessSpecDeclSnapshot::access_specifier_token)
+    .def_ro("colon_token", &AccessSpecDeclSnapshot::colon_token);
 }
 } // namespace pasta
@@ -24,6 +24,11 @@ void RegisterAddrLabelExpr(nb::module_ &m) {
     .def_prop_ro("begin_token", &AddrLabelExpr::BeginToken)
     .def_prop_ro("end_token", &AddrLabelExpr::EndToken)
     .def_prop_ro("label", &AddrLabelExpr::Label)
-    .def_prop_ro("label_token", &AddrLabelExpr::LabelToken);
+    .def_prop_ro("label_token", &AddrLabelExpr::LabelToken)
+    .def("snapshot", &AddrLabelExpr::Snapshot);
+
+  nb::class_<AddrLabelExprSnapshot, ExprSnapshot>(m, "AddrLabelExprSnapshot")
+    .def_ro("amp_amp_token", &AddrLabelExprSnapshot::amp_amp_token)
+    .def_ro("label_token", &AddrLabelExprSnapshot::label_token);
 }
 } // namespace pasta
@@ -21,6 +21,9 @@ void RegisterArrayInitIndexExpr(nb::module_ &m) {
   nb::class_<ArrayInitIndexExpr, Expr>(m, "ArrayInitIndexExpr")
     .def_prop_ro("children", &ArrayInitIndexExpr::Children)
     .def_prop_ro("begin_token", &ArrayInitIndexExpr::BeginToken)
-    .def_prop_ro("end_token", &ArrayInitIndexExpr::EndToken);
+    .def_prop_ro("end_token", &ArrayInitIndexExpr::EndToken)
+    .def("snapshot", &ArrayInitIndexExpr::Snapshot);
+
+  nb::class_<ArrayInitIndexExprSnapshot, ExprSnapshot>(m, "ArrayInitIndexExprSnapshot");
 }
 } // namespace pasta
@@ -24,6 +24,9 @@ void RegisterArrayInitLoopExpr(nb::module_ &m) {
     .def_prop_ro("begin_token", &ArrayInitLoopExpr::BeginToken)
     .def_prop_ro("common_expression", &ArrayInitLoopExpr::CommonExpression)
     .def_prop_ro("end_token", &ArrayInitLoopExpr::EndToken)
-    .def_prop_ro("sub_expression", &ArrayInitLoopExpr::SubExpression);
+    .def_prop_ro("sub_expression", &ArrayInitLoopExpr::SubExpression)
+    .def("snapshot", &ArrayInitLoopExpr::Snapshot);
+
+  nb::class_<ArrayInitLoopExprSnapshot, ExprSnapshot>(m, "ArrayInitLoopExprSnapshot");
 }
 } // namespace pasta
@@ -27,6 +27,10 @@ void RegisterArraySubscriptExpr(nb::module_ &m) {
     .def_prop_ro("index", &ArraySubscriptExpr::Index)
     .def_prop_ro("lhs", &ArraySubscriptExpr::LHS)
     .def_prop_ro("r_bracket_token", &ArraySubscriptExpr::RBracketToken)
-    .def_prop_ro("rhs", &ArraySubscriptExpr::RHS);
+    .def_prop_ro("rhs", &ArraySubscriptExpr::RHS)
+    .def("snapshot", &ArraySubscriptExpr::Snapshot);
+
+  nb::class_<ArraySubscriptExprSnapshot, ExprSnapshot>(m, "ArraySubscriptExprSnapshot")
+    .def_ro("r_bracket_token", &ArraySubscriptExprSnapshot::r_bracket_token);
 }
 } // namespace pasta
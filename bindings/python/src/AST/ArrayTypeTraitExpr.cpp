@@ -25,6 +25,11 @@ void RegisterArrayTypeTraitExpr(nb::module_ &m) {
     .def_prop_ro("end_token", &ArrayTypeTraitExpr::EndToken)
     .def_prop_ro("queried_type", &ArrayTypeTraitExpr::QueriedType)
     .def_prop_ro("trait", &ArrayTypeTraitExpr::Trait)
-    .def_prop_ro("value", &ArrayTypeTraitExpr::Value);
+    .def_prop_ro("value", &ArrayTypeTraitExpr::Value)
+    .def("snapshot", &ArrayTypeTraitExpr::Snapshot);
+
+  nb::class_<ArrayTypeTraitExprSnapshot, ExprSnapshot>(m, "ArrayTypeTraitExprSnapshot")
+    .def_ro("trait", &ArrayTypeTraitExprSnapshot::trait)
+    .def_ro("value", &ArrayTypeTraitExprSnapshot::value);
 }
 } // namespace pasta
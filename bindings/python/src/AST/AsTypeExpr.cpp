@@ -24,6 +24,11 @@ void RegisterAsTypeExpr(nb::module_ &m) {
     .def_prop_ro("builtin_token", &AsTypeExpr::BuiltinToken)
     .def_prop_ro("end_token", &AsTypeExpr::EndToken)
     .def_prop_ro("r_paren_token", &AsTypeExpr::RParenToken)
-    .def_prop_ro("src_expression", &AsTypeExpr::SrcExpression);
+    .def_prop_ro("src_expression", &AsTypeExpr::SrcExpression)
+    .def("snapshot", &AsTypeExpr::Snapshot);
+
+  nb::class_<AsTypeExprSnapshot, ExprSnapshot>(m, "AsTypeExprSnapshot")
+    .def_ro("builtin_token", &AsTypeExprSnapshot::builtin_token)
+    .def_ro("r_paren_token", &AsTypeExprSnapshot::r_paren_token);
 }
 } // namespace pasta
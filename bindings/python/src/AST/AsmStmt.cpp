@@ -31,6 +31,16 @@ void RegisterAsmStmt(nb::module_ &m) {
     .def_prop_ro("inputs", &AsmStmt::Inputs)
     .def_prop_ro("is_simple", &AsmStmt::IsSimple)
     .def_prop_ro("is_volatile", &AsmStmt::IsVolatile)
-    .def_prop_ro("outputs", &AsmStmt::Outputs);
+    .def_prop_ro("outputs", &AsmStmt::Outputs)
+    .def("snapshot", &AsmStmt::Snapshot);
+
+  nb::class_<AsmStmtSnapshot, StmtSnapshot>(m, "AsmStmtSnapshot")
+    .def_ro("assembly_token", &AsmStmtSnapshot::assembly_token)
+    .def_ro("num_clobbers", &AsmStmtSnapshot::num_clobbers)
+    .def_ro("num_inputs", &AsmStmtSnapshot::num_inputs)
+    .def_ro("num_outputs", &AsmStmtSnapshot::num_outputs)
+    .def_ro("num_plus_operands", &AsmStmtSnapshot::num_plus_operands)
+    .def_ro("is_simple", &AsmStmtSnapshot::is_simple)
+    .def_ro("is_volatile", &AsmStmtSnapshot::is_volatile);
 }
 } // namespace pasta
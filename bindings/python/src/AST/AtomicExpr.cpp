@@ -36,6 +36,16 @@ void RegisterAtomicExpr(nb::module_ &m) {
     .def_prop_ro("weak", &AtomicExpr::Weak)
     .def_prop_ro("is_cmp_x_chg", &AtomicExpr::IsCmpXChg)
     .def_prop_ro("is_open_cl", &AtomicExpr::IsOpenCL)
-    .def_prop_ro("is_volatile", &AtomicExpr::IsVolatile);
+    .def_prop_ro("is_volatile", &AtomicExpr::IsVolatile)
+    .def("snapshot", &AtomicExpr::Snapshot);
+
+  nb::class_<AtomicExprSnapshot, ExprSnapshot>(m, "AtomicExprSnapshot")
+    .def_ro("builtin_token", &AtomicExprSnapshot::builtin_token)
+    .def_ro("num_sub_expressions", &AtomicExprSnapshot::num_sub_expressions)
+    .def_ro("operation", &AtomicExprSnapshot::operation)
+    .def_ro("r_paren_token", &AtomicExprSnapshot::r_paren_token)
+    .def_ro("is_cmp_x_chg", &AtomicExprSnapshot::is_cmp_x_chg)
+    .def_ro("is_open_cl", &AtomicExprSnapshot::is_open_cl)
+    .def_ro("is_volatile", &AtomicExprSnapshot::is_volatile);
 }
 } // namespace pasta
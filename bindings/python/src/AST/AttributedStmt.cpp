@@ -24,6 +24,10 @@ void RegisterAttributedStmt(nb::module_ &m) {
     .def_prop_ro("attributes", &AttributedStmt::Attributes)
     .def_prop_ro("begin_token", &AttributedStmt::BeginToken)
     .def_prop_ro("end_token", &AttributedStmt::EndToken)
-    .def_prop_ro("sub_statement", &AttributedStmt::SubStatement);
+    .def_prop_ro("sub_statement", &AttributedStmt::SubStatement)
+    .def("snapshot", &AttributedStmt::Snapshot);
+
+  nb::class_<AttributedStmtSnapshot, ValueStmtSnapshot>(m, "AttributedStmtSnapshot")
+    .def_ro("attribute_token", &AttributedStmtSnapshot::attribute_token);
 }
 } // namespace pasta
@@ -19,6 +19,9 @@ namespace nb = nanobind;
 
 void RegisterBaseUsingDecl(nb::module_ &m) {
   nb::class_<BaseUsingDecl, NamedDecl>(m, "BaseUsingDecl")
-    .def_prop_ro("shadows", &BaseUsingDecl::Shadows);
+    .def_prop_ro("shadows", &BaseUsingDecl::Shadows)
+    .def("snapshot", &BaseUsingDecl::Snapshot);
+
+  nb::class_<BaseUsingDeclSnapshot, NamedDeclSnapshot>(m, "BaseUsingDeclSnapshot");
 }
 } // namespace pasta
@@ -26,6 +26,9 @@ void RegisterBinaryConditionalOperator(nb::module_ &m) {
     .def_prop_ro("end_token", &BinaryConditionalOperator::EndToken)
     .def_prop_ro("false_expression", &BinaryConditionalOperator::FalseExpression)
     .def_prop_ro("opaque_value", &BinaryConditionalOperator::OpaqueValue)
-    .def_prop_ro("true_expression", &BinaryConditionalOperator::TrueExpression);
+    .def_prop_ro("true_expression", &BinaryConditionalOperator::TrueExpression)
+    .def("snapshot", &BinaryConditionalOperator::Snapshot);
+
+  nb::class_<BinaryConditionalOperatorSnapshot, AbstractConditionalOperatorSnapshot>(m, "BinaryConditionalOperatorSnapshot");
 }
 } // namespace pasta
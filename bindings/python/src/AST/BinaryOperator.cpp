@@ -41,6 +41,25 @@ void RegisterBinaryOperator(nb::module_ &m) {
     .def_prop_ro("is_pointer_memory_operation", &BinaryOperator::IsPointerMemoryOperation)
     .def_prop_ro("is_relational_operation", &BinaryOperator::IsRelationalOperation)
     .def_prop_ro("is_shift_assign_operation", &BinaryOperator::IsShiftAssignOperation)
-    .def_prop_ro("is_shift_operation", &BinaryOperator::IsShiftOperation);
+    .def_prop_ro("is_shift_operation", &BinaryOperator::IsShiftOperation)
+    .def("snapshot", &BinaryOperator::Snapshot);
+
+  nb::class_<BinaryOperatorSnapshot, ExprSnapshot>(m, "BinaryOperatorSnapshot")
+    .def_ro("opcode", &BinaryOperatorSnapshot::opcode)
+    .def_ro("operator_token", &BinaryOperatorSnapshot::operator_token)
+    .def_ro("has_stored_fp_features", &BinaryOperatorSnapshot::has_stored_fp_features)
+    .def_ro("is_additive_operation", &BinaryOperatorSnapshot::is_additive_operation)
+    .def_ro("is_assignment_operation", &BinaryOperatorSnapshot::is_assignment_operation)
+    .def_ro("is_bitwise_operation", &BinaryOperatorSnapshot::is_bitwise_operation)
+    .def_ro("is_comma_operation", &BinaryOperatorSnapshot::is_comma_operation)
+    .def_ro("is_comparison_operation", &BinaryOperatorSnapshot::is_comparison_operation)
+    .def_ro("is_compound_assignment_operation", &BinaryOperatorSnapshot::is_compound_assignment_operation)
+    .def_ro("is_equality_operation", &BinaryOperatorSnapshot::is_equality_operation)
+    .def_ro("is_logical_operation", &BinaryOperatorSnapshot::is_logical_operation)
+    .def_ro("is_multiplicative_operation", &BinaryOperatorSnapshot::is_multiplicative_operation)
+    .def_ro("is_pointer_memory_operation", &BinaryOperatorSnapshot::is_pointer_memory_operation)
+    .def_ro("is_relational_operation", &BinaryOperatorSnapshot::is_relational_operation)
+    .def_ro("is_shift_assign_operation", &BinaryOperatorSnapshot::is_shift_assign_operation)
+    .def_ro("is_shift_operation", &BinaryOperatorSnapshot::is_shift_operation);
 }
 } // namespace pasta
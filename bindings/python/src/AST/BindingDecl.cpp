@@ -21,6 +21,9 @@ void RegisterBindingDecl(nb::module_ &m) {
   nb::class_<BindingDecl, ValueDecl>(m, "BindingDecl")
     .def_prop_ro("binding", &BindingDecl::Binding)
     .def_prop_ro("decomposed_declaration", &BindingDecl::DecomposedDeclaration)
-    .def_prop_ro("holding_variable", &BindingDecl::HoldingVariable);
+    .def_prop_ro("holding_variable", &BindingDecl::HoldingVariable)
+    .def("snapshot", &BindingDecl::Snapshot);
+
+  nb::class_<BindingDeclSnapshot, ValueDeclSnapshot>(m, "BindingDeclSnapshot");
 }
 } // namespace pasta
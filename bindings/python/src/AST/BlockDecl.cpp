@@ -33,6 +33,20 @@ void RegisterBlockDecl(nb::module_ &m) {
     .def_prop_ro("has_captures", &BlockDecl::HasCaptures)
     .def_prop_ro("is_conversion_from_lambda", &BlockDecl::IsConversionFromLambda)
     .def_prop_ro("is_variadic", &BlockDecl::IsVariadic)
-    .def_prop_ro("parameters", &BlockDecl::Parameters);
+    .def_prop_ro("parameters", &BlockDecl::Parameters)
+    .def("snapshot", &BlockDecl::Snapshot);
+
+  nb::class_<BlockDeclSnapshot, DeclSnapshot>(m, "BlockDeclSnapshot")
+    .def_ro("block_missing_return_type", &BlockDeclSnapshot::block_missing_return_type)
+    .def_ro("can_avoid_copy_to_heap", &BlockDeclSnapshot::can_avoid_copy_to_heap)
+    .def_ro("captures_cxx_this", &BlockDeclSnapshot::captures_cxx_this)
+    .def_ro("does_not_escape", &BlockDeclSnapshot::does_not_escape)
+    .def_ro("block_mangling_number", &BlockDeclSnapshot::block_mangling_number)
+    .def_ro("caret_token", &BlockDeclSnapshot::caret_token)
+    .def_ro("num_captures", &BlockDeclSnapshot::num_captures)
+    .def_ro("num_parameters", &BlockDeclSnapshot::num_parameters)
+    .def_ro("has_captures", &BlockDeclSnapshot::has_captures)
+    .def_ro("is_conversion_from_lambda", &BlockDeclSnapshot::is_conversion_from_lambda)
+    .def_ro("is_variadic", &BlockDeclSnapshot::is_variadic);
 }
 } // namespace pasta
@@ -25,6 +25,10 @@ void RegisterBlockExpr(nb::module_ &m) {
     .def_prop_ro("body", &BlockExpr::Body)
     .def_prop_ro("caret_token", &BlockExpr::CaretToken)
     .def_prop_ro("end_token", &BlockExpr::EndToken)
-    .def_prop_ro("function_type", &BlockExpr::FunctionType);
+    .def_prop_ro("function_type", &BlockExpr::FunctionType)
+    .def("snapshot", &BlockExpr::Snapshot);
+
+  nb::class_<BlockExprSnapshot, ExprSnapshot>(m, "BlockExprSnapshot")
+    .def_ro("caret_token", &BlockExprSnapshot::caret_token);
 }
 } // namespace pasta
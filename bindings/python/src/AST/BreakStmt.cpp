@@ -22,6 +22,10 @@ void RegisterBreakStmt(nb::module_ &m) {
     .def_prop_ro("children", &BreakStmt::Children)
     .def_prop_ro("begin_token", &BreakStmt::BeginToken)
     .def_prop_ro("break_token", &BreakStmt::BreakToken)
-    .def_prop_ro("end_token", &BreakStmt::EndToken);
+    .def_prop_ro("end_token", &BreakStmt::EndToken)
+    .def("snapshot", &BreakStmt::Snapshot);
+
+  nb::class_<BreakStmtSnapshot, StmtSnapshot>(m, "BreakStmtSnapshot")
+    .def_ro("break_token", &BreakStmtSnapshot::break_token);
 }
 } // namespace pasta
@@ -20,6 +20,9 @@ namespace nb = nanobind;
 void RegisterBuiltinBitCastExpr(nb::module_ &m) {
   nb::class_<BuiltinBitCastExpr, ExplicitCastExpr>(m, "BuiltinBitCastExpr")
     .def_prop_ro("begin_token", &BuiltinBitCastExpr::BeginToken)
-    .def_prop_ro("end_token", &BuiltinBitCastExpr::EndToken);
+    .def_prop_ro("end_token", &BuiltinBitCastExpr::EndToken)
+    .def("snapshot", &BuiltinBitCastExpr::Snapshot);
+
+  nb::class_<BuiltinBitCastExprSnapshot, ExplicitCastExprSnapshot>(m, "BuiltinBitCastExprSnapshot");
 }
 } // namespace pasta
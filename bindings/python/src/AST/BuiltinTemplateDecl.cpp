@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterBuiltinTemplateDecl(nb::module_ &m) {
-  nb::class_<BuiltinTemplateDecl, TemplateDecl>(m, "BuiltinTemplateDecl");
+  nb::class_<BuiltinTemplateDecl, TemplateDecl>(m, "BuiltinTemplateDecl")
+    .def("snapshot", &BuiltinTemplateDecl::Snapshot);
+
+  nb::class_<BuiltinTemplateDeclSnapshot, TemplateDeclSnapshot>(m, "BuiltinTemplateDeclSnapshot");
 }
 } // namespace pasta
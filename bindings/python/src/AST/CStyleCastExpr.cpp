@@ -22,6 +22,11 @@ void RegisterCStyleCastExpr(nb::module_ &m) {
     .def_prop_ro("begin_token", &CStyleCastExpr::BeginToken)
     .def_prop_ro("end_token", &CStyleCastExpr::EndToken)
     .def_prop_ro("l_paren_token", &CStyleCastExpr::LParenToken)
-    .def_prop_ro("r_paren_token", &CStyleCastExpr::RParenToken);
+    .def_prop_ro("r_paren_token", &CStyleCastExpr::RParenToken)
+    .def("snapshot", &CStyleCastExpr::Snapshot);
+
+  nb::class_<CStyleCastExprSnapshot, ExplicitCastExprSnapshot>(m, "CStyleCastExprSnapshot")
+    .def_ro("l_paren_token", &CStyleCastExprSnapshot::l_paren_token)
+    .def_ro("r_paren_token", &CStyleCastExprSnapshot::r_paren_token);
 }
 } // namespace pasta
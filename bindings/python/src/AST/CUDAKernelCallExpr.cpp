@@ -19,6 +19,9 @@ namespace nb = nanobind;
 
 void RegisterCUDAKernelCallExpr(nb::module_ &m) {
   nb::class_<CUDAKernelCallExpr, CallExpr>(m, "CUDAKernelCallExpr")
-    .def_prop_ro("config", &CUDAKernelCallExpr::Config);
+    .def_prop_ro("config", &CUDAKernelCallExpr::Config)
+    .def("snapshot", &CUDAKernelCallExpr::Snapshot);
+
+  nb::class_<CUDAKernelCallExprSnapshot, CallExprSnapshot>(m, "CUDAKernelCallExprSnapshot");
 }
 } // namespace pasta
@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterCXXAddrspaceCastExpr(nb::module_ &m) {
-  nb::class_<CXXAddrspaceCastExpr, CXXNamedCastExpr>(m, "CXXAddrspaceCastExpr");
+  nb::class_<CXXAddrspaceCastExpr, CXXNamedCastExpr>(m, "CXXAddrspaceCastExpr")
+    .def("snapshot", &CXXAddrspaceCastExpr::Snapshot);
+
+  nb::class_<CXXAddrspaceCastExprSnapshot, CXXNamedCastExprSnapshot>(m, "CXXAddrspaceCastExprSnapshot");
 }
 } // namespace pasta
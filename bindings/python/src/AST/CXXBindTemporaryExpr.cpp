@@ -22,6 +22,9 @@ void RegisterCXXBindTemporaryExpr(nb::module_ &m) {
     .def_prop_ro("children", &CXXBindTemporaryExpr::Children)
     .def_prop_ro("begin_token", &CXXBindTemporaryExpr::BeginToken)
     .def_prop_ro("end_token", &CXXBindTemporaryExpr::EndToken)
-    .def_prop_ro("sub_expression", &CXXBindTemporaryExpr::SubExpression);
+    .def_prop_ro("sub_expression", &CXXBindTemporaryExpr::SubExpression)
+    .def("snapshot", &CXXBindTemporaryExpr::Snapshot);
+
+  nb::class_<CXXBindTemporaryExprSnapshot, ExprSnapshot>(m, "CXXBindTemporaryExprSnapshot");
 }
 } // namespace pasta
@@ -23,6 +23,11 @@ void RegisterCXXBoolLiteralExpr(nb::module_ &m) {
     .def_prop_ro("begin_token", &CXXBoolLiteralExpr::BeginToken)
     .def_prop_ro("end_token", &CXXBoolLiteralExpr::EndToken)
     .def_prop_ro("token", &CXXBoolLiteralExpr::Token)
-    .def_prop_ro("value", &CXXBoolLiteralExpr::Value);
+    .def_prop_ro("value", &CXXBoolLiteralExpr::Value)
+    .def("snapshot", &CXXBoolLiteralExpr::Snapshot);
+
+  nb::class_<CXXBoolLiteralExprSnapshot, ExprSnapshot>(m, "CXXBoolLiteralExprSnapshot")
+    .def_ro("token", &CXXBoolLiteralExprSnapshot::token)
+    .def_ro("value", &CXXBoolLiteralExprSnapshot::value);
 }
 } // namespace pasta
@@ -25,6 +25,10 @@ void RegisterCXXCatchStmt(nb::module_ &m) {
     .def_prop_ro("caught_type", &CXXCatchStmt::CaughtType)
     .def_prop_ro("end_token", &CXXCatchStmt::EndToken)
     .def_prop_ro("exception_declaration", &CXXCatchStmt::ExceptionDeclaration)
-    .def_prop_ro("handler_block", &CXXCatchStmt::HandlerBlock);
+    .def_prop_ro("handler_block", &CXXCatchStmt::HandlerBlock)
+    .def("snapshot", &CXXCatchStmt::Snapshot);
+
+  nb::class_<CXXCatchStmtSnapshot, StmtSnapshot>(m, "CXXCatchStmtSnapshot")
+    .def_ro("catch_token", &CXXCatchStmtSnapshot::catch_token);
 }
 } // namespace pasta
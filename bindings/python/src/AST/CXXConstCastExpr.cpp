@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterCXXConstCastExpr(nb::module_ &m) {
-  nb::class_<CXXConstCastExpr, CXXNamedCastExpr>(m, "CXXConstCastExpr");
+  nb::class_<CXXConstCastExpr, CXXNamedCastExpr>(m, "CXXConstCastExpr")
+    .def("snapshot", &CXXConstCastExpr::Snapshot);
+
+  nb::class_<CXXConstCastExprSnapshot, CXXNamedCastExprSnapshot>(m, "CXXConstCastExprSnapshot");
 }
 } // namespace pasta
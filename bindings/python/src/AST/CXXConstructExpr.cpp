@@ -33,6 +33,18 @@ void RegisterCXXConstructExpr(nb::module_ &m) {
     .def_prop_ro("is_immediate_escalating", &CXXConstructExpr::IsImmediateEscalating)
     .def_prop_ro("is_list_initialization", &CXXConstructExpr::IsListInitialization)
     .def_prop_ro("is_std_initializer_list_initialization", &CXXConstructExpr::IsStdInitializerListInitialization)
-    .def_prop_ro("requires_zero_initialization", &CXXConstructExpr::RequiresZeroInitialization);
+    .def_prop_ro("requires_zero_initialization", &CXXConstructExpr::RequiresZeroInitialization)
+    .def("snapshot", &CXXConstructExpr::Snapshot);
+
+  nb::class_<CXXConstructExprSnapshot, ExprSnapshot>(m, "CXXConstructExprSnapshot")
+    .def_ro("construction_kind", &CXXConstructExprSnapshot::construction_kind)
+    .def_ro("token", &CXXConstructExprSnapshot::token)
+    .def_ro("num_arguments", &CXXConstructExprSnapshot::num_arguments)
+    .def_ro("had_multiple_candidates", &CXXConstructExprSnapshot::had_multiple_candidates)
+    .def_ro("is_elidable", &CXXConstructExprSnapshot::is_elidable)
+    .def_ro("is_immediate_escalating", &CXXConstructExprSnapshot::is_immediate_escalating)
+    .def_ro("is_list_initialization", &CXXConstructExprSnapshot::is_list_initialization)
+    .def_ro("is_std_initializer_list_initialization", &CXXConstructExprSnapshot::is_std_initializer_list_initialization)
+    .def_ro("requires_zero_initialization", &CXXConstructExprSnapshot::requires_zero_initialization);
 }
 } // namespace pasta
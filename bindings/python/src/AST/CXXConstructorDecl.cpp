@@ -27,6 +27,15 @@ void RegisterCXXConstructorDecl(nb::module_ &m) {
     .def_prop_ro("is_delegating_constructor", &CXXConstructorDecl::IsDelegatingConstructor)
     .def_prop_ro("is_explicit", &CXXConstructorDecl::IsExplicit)
     .def_prop_ro("is_inheriting_constructor", &CXXConstructorDecl::IsInheritingConstructor)
-    .def_prop_ro("is_specialization_copying_object", &CXXConstructorDecl::IsSpecializationCopyingObject);
+    .def_prop_ro("is_specialization_copying_object", &CXXConstructorDecl::IsSpecializationCopyingObject)
+    .def("snapshot", &CXXConstructorDecl::Snapshot);
+
+  nb::class_<CXXConstructorDeclSnapshot, CXXMethodDeclSnapshot>(m, "CXXConstructorDeclSnapshot")
+    .def_ro("num_constructor_initializers", &CXXConstructorDeclSnapshot::num_constructor_initializers)
+    .def_ro("is_default_constructor", &CXXConstructorDeclSnapshot::is_default_constructor)
+    .def_ro("is_delegating_constructor", &CXXConstructorDeclSnapshot::is_delegating_constructor)
+    .def_ro("is_explicit", &CXXConstructorDeclSnapshot::is_explicit)
+    .def_ro("is_inheriting_constructor", &CXXConstructorDeclSnapshot::is_inheriting_constructor)
+    .def_ro("is_specialization_copying_object", &CXXConstructorDeclSnapshot::is_specialization_copying_object);
 }
 } // namespace pasta
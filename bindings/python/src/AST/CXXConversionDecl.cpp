@@ -22,6 +22,11 @@ void RegisterCXXConversionDecl(nb::module_ &m) {
     .def_prop_ro("canonical_declaration", &CXXConversionDecl::CanonicalDeclaration)
     .def_prop_ro("conversion_type", &CXXConversionDecl::ConversionType)
     .def_prop_ro("is_explicit", &CXXConversionDecl::IsExplicit)
-    .def_prop_ro("is_lambda_to_block_pointer_conversion", &CXXConversionDecl::IsLambdaToBlockPointerConversion);
+    .def_prop_ro("is_lambda_to_block_pointer_conversion", &CXXConversionDecl::IsLambdaToBlockPointerConversion)
+    .def("snapshot", &CXXConversionDecl::Snapshot);
+
+  nb::class_<CXXConversionDeclSnapshot, CXXMethodDeclSnapshot>(m, "CXXConversionDeclSnapshot")
+    .def_ro("is_explicit", &CXXConversionDeclSnapshot::is_explicit)
+    .def_ro("is_lambda_to_block_pointer_conversion", &CXXConversionDeclSnapshot::is_lambda_to_block_pointer_conversion);
 }
 } // namespace pasta
@@ -22,6 +22,11 @@ void RegisterCXXDeductionGuideDecl(nb::module_ &m) {
     .def_prop_ro("corresponding_constructor", &CXXDeductionGuideDecl::CorrespondingConstructor)
     .def_prop_ro("deduced_template", &CXXDeductionGuideDecl::DeducedTemplate)
     .def_prop_ro("deduction_candidate_kind", &CXXDeductionGuideDecl::DeductionCandidateKind)
-    .def_prop_ro("is_explicit", &CXXDeductionGuideDecl::IsExplicit);
+    .def_prop_ro("is_explicit", &CXXDeductionGuideDecl::IsExplicit)
+    .def("snapshot", &CXXDeductionGuideDecl::Snapshot);
+
+  nb::class_<CXXDeductionGuideDeclSnapshot, FunctionDeclSnapshot>(m, "CXXDeductionGuideDeclSnapshot")
+    .def_ro("deduction_candidate_kind", &CXXDeductionGuideDeclSnapshot::deduction_candidate_kind)
+    .def_ro("is_explicit", &CXXDeductionGuideDeclSnapshot::is_explicit);
 }
 } // namespace pasta
@@ -29,6 +29,11 @@ void RegisterCXXDefaultArgExpr(nb::module_ &m) {
     .def_prop_ro("rewritten_expression", &CXXDefaultArgExpr::RewrittenExpression)
     .def_prop_ro("used_context", &CXXDefaultArgExpr::UsedContext)
     .def_prop_ro("used_token", &CXXDefaultArgExpr::UsedToken)
-    .def_prop_ro("has_rewritten_initializer", &CXXDefaultArgExpr::HasRewrittenInitializer);
+    .def_prop_ro("has_rewritten_initializer", &CXXDefaultArgExpr::HasRewrittenInitializer)
+    .def("snapshot", &CXXDefaultArgExpr::Snapshot);
+
+  nb::class_<CXXDefaultArgExprSnapshot, ExprSnapshot>(m, "CXXDefaultArgExprSnapshot")
+    .def_ro("used_token", &CXXDefaultArgExprSnapshot::used_token)
+    .def_ro("has_rewritten_initializer", &CXXDefaultArgExprSnapshot::has_rewritten_initializer);
 }
 } // namespace pasta
@@ -27,6 +27,11 @@ void RegisterCXXDefaultInitExpr(nb::module_ &m) {
     .def_prop_ro("rewritten_expression", &CXXDefaultInitExpr::RewrittenExpression)
     .def_prop_ro("used_context", &CXXDefaultInitExpr::UsedContext)
     .def_prop_ro("used_token", &CXXDefaultInitExpr::UsedToken)
-    .def_prop_ro("has_rewritten_initializer", &CXXDefaultInitExpr::HasRewrittenInitializer);
+    .def_prop_ro("has_rewritten_initializer", &CXXDefaultInitExpr::HasRewrittenInitializer)
+    .def("snapshot", &CXXDefaultInitExpr::Snapshot);
+
+  nb::class_<CXXDefaultInitExprSnapshot, ExprSnapshot>(m, "CXXDefaultInitExprSnapshot")
+    .def_ro("used_token", &CXXDefaultInitExprSnapshot::used_token)
+    .def_ro("has_rewritten_initializer", &CXXDefaultInitExprSnapshot::has_rewritten_initializer);
 }
 } // namespace pasta
@@ -28,6 +28,13 @@ void RegisterCXXDeleteExpr(nb::module_ &m) {
     .def_prop_ro("operator_delete", &CXXDeleteExpr::OperatorDelete)
     .def_prop_ro("is_array_form", &CXXDeleteExpr::IsArrayForm)
     .def_prop_ro("is_array_form_as_written", &CXXDeleteExpr::IsArrayFormAsWritten)
-    .def_prop_ro("is_global_delete", &CXXDeleteExpr::IsGlobalDelete);
+    .def_prop_ro("is_global_delete", &CXXDeleteExpr::IsGlobalDelete)
+    .def("snapshot", &CXXDeleteExpr::Snapshot);
+
+  nb::class_<CXXDeleteExprSnapshot, ExprSnapshot>(m, "CXXDeleteExprSnapshot")
+    .def_ro("does_usual_array_delete_want_size", &CXXDeleteExprSnapshot::does_usual_array_delete_want_size)
+    .def_ro("is_array_form", &CXXDeleteExprSnapshot::is_array_form)
+    .def_ro("is_array_form_as_written", &CXXDeleteExprSnapshot::is_array_form_as_written)
+    .def_ro("is_global_delete", &CXXDeleteExprSnapshot::is_global_delete);
 }
 } // namespace pasta
@@ -34,6 +34,19 @@ void RegisterCXXDependentScopeMemberExpr(nb::module_ &m) {
     .def_prop_ro("has_explicit_template_arguments", &CXXDependentScopeMemberExpr::HasExplicitTemplateArguments)
     .def_prop_ro("has_template_keyword", &CXXDependentScopeMemberExpr::HasTemplateKeyword)
     .def_prop_ro("is_arrow", &CXXDependentScopeMemberExpr::IsArrow)
-    .def_prop_ro("is_implicit_access", &CXXDependentScopeMemberExpr::IsImplicitAccess);
+    .def_prop_ro("is_implicit_access", &CXXDependentScopeMemberExpr::IsImplicitAccess)
+    .def("snapshot", &CXXDependentScopeMemberExpr::Snapshot);
+
+  nb::class_<CXXDependentScopeMemberExprSnapshot, ExprSnapshot>(m, "CXXDependentScopeMemberExprSnapshot")
+    .def_ro("l_angle_token", &CXXDependentScopeMemberExprSnapshot::l_angle_token)
+    .def_ro("member_token", &CXXDependentScopeMemberExprSnapshot::member_token)
+    .def_ro("num_template_arguments", &CXXDependentScopeMemberExprSnapshot::num_template_arguments)
+    .def_ro("operator_token", &CXXDependentScopeMemberExprSnapshot::operator_token)
+    .def_ro("r_angle_token", &CXXDependentScopeMemberExprSnapshot::r_angle_token)
+    .def_ro("template_keyword_token", &CXXDependentScopeMemberExprSnapshot::template_keyword_token)
+    .def_ro("has_explicit_template_arguments", &CXXDependentScopeMemberExprSnapshot::has_explicit_template_arguments)
+    .def_ro("has_template_keyword", &CXXDependentScopeMemberExprSnapshot::has_template_keyword)
+    .def_ro("is_arrow", &CXXDependentScopeMemberExprSnapshot::is_arrow)
+    .def_ro("is_implicit_access", &CXXDependentScopeMemberExprSnapshot::is_implicit_access);
 }
 } // namespace pasta
@@ -21,6 +21,9 @@ void RegisterCXXDestructorDecl(nb::module_ &m) {
   nb::class_<CXXDestructorDecl, CXXMethodDecl>(m, "CXXDestructorDecl")
     .def_prop_ro("canonical_declaration", &CXXDestructorDecl::CanonicalDeclaration)
     .def_prop_ro("operator_delete", &CXXDestructorDecl::OperatorDelete)
-    .def_prop_ro("operator_delete_this_argument", &CXXDestructorDecl::OperatorDeleteThisArgument);
+    .def_prop_ro("operator_delete_this_argument", &CXXDestructorDecl::OperatorDeleteThisArgument)
+    .def("snapshot", &CXXDestructorDecl::Snapshot);
+
+  nb::class_<CXXDestructorDeclSnapshot, CXXMethodDeclSnapshot>(m, "CXXDestructorDeclSnapshot");
 }
 } // namespace pasta
@@ -19,6 +19,10 @@ namespace nb = nanobind;
 
 void RegisterCXXDynamicCastExpr(nb::module_ &m) {
   nb::class_<CXXDynamicCastExpr, CXXNamedCastExpr>(m, "CXXDynamicCastExpr")
-    .def_prop_ro("is_always_null", &CXXDynamicCastExpr::IsAlwaysNull);
+    .def_prop_ro("is_always_null", &CXXDynamicCastExpr::IsAlwaysNull)
+    .def("snapshot", &CXXDynamicCastExpr::Snapshot);
+
+  nb::class_<CXXDynamicCastExprSnapshot, CXXNamedCastExprSnapshot>(m, "CXXDynamicCastExprSnapshot")
+    .def_ro("is_always_null", &CXXDynamicCastExprSnapshot::is_always_null);
 }
 } // namespace pasta
@@ -33,6 +33,15 @@ void RegisterCXXFoldExpr(nb::module_ &m) {
     .def_prop_ro("rhs", &CXXFoldExpr::RHS)
     .def_prop_ro("r_paren_token", &CXXFoldExpr::RParenToken)
     .def_prop_ro("is_left_fold", &CXXFoldExpr::IsLeftFold)
-    .def_prop_ro("is_right_fold", &CXXFoldExpr::IsRightFold);
+    .def_prop_ro("is_right_fold", &CXXFoldExpr::IsRightFold)
+    .def("snapshot", &CXXFoldExpr::Snapshot);
+
+  nb::class_<CXXFoldExprSnapshot, ExprSnapshot>(m, "CXXFoldExprSnapshot")
+    .def_ro("ellipsis_token", &CXXFoldExprSnapshot::ellipsis_token)
+    .def_ro("l_paren_token", &CXXFoldExprSnapshot::l_paren_token)
+    .def_ro("operator_", &CXXFoldExprSnapshot::operator_)
+    .def_ro("r_paren_token", &CXXFoldExprSnapshot::r_paren_token)
+    .def_ro("is_left_fold", &CXXFoldExprSnapshot::is_left_fold)
+    .def_ro("is_right_fold", &CXXFoldExprSnapshot::is_right_fold);
 }
 } // namespace pasta
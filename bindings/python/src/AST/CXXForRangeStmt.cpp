@@ -35,6 +35,13 @@ void RegisterCXXForRangeStmt(nb::module_ &m) {
     .def_prop_ro("loop_variable", &CXXForRangeStmt::LoopVariable)
     .def_prop_ro("r_paren_token", &CXXForRangeStmt::RParenToken)
     .def_prop_ro("range_initializer", &CXXForRangeStmt::RangeInitializer)
-    .def_prop_ro("range_statement", &CXXForRangeStmt::RangeStatement);
+    .def_prop_ro("range_statement", &CXXForRangeStmt::RangeStatement)
+    .def("snapshot", &CXXForRangeStmt::Snapshot);
+
+  nb::class_<CXXForRangeStmtSnapshot, StmtSnapshot>(m, "CXXForRangeStmtSnapshot")
+    .def_ro("coawait_token", &CXXForRangeStmtSnapshot::coawait_token)
+    .def_ro("colon_token", &CXXForRangeStmtSnapshot::colon_token)
+    .def_ro("for_token", &CXXForRangeStmtSnapshot::for_token)
+    .def_ro("r_paren_token", &CXXForRangeStmtSnapshot::r_paren_token);
 }
 } // namespace pasta
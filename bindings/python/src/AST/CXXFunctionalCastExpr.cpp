@@ -23,6 +23,12 @@ void RegisterCXXFunctionalCastExpr(nb::module_ &m) {
     .def_prop_ro("end_token", &CXXFunctionalCastExpr::EndToken)
     .def_prop_ro("l_paren_token", &CXXFunctionalCastExpr::LParenToken)
     .def_prop_ro("r_paren_token", &CXXFunctionalCastExpr::RParenToken)
-    .def_prop_ro("is_list_initialization", &CXXFunctionalCastExpr::IsListInitialization);
+    .def_prop_ro("is_list_initialization", &CXXFunctionalCastExpr::IsListInitialization)
+    .def("snapshot", &CXXFunctionalCastExpr::Snapshot);
+
+  nb::class_<CXXFunctionalCastExprSnapshot, ExplicitCastExprSnapshot>(m, "CXXFunctionalCastExprSnapshot")
+    .def_ro("l_paren_token", &CXXFunctionalCastExprSnapshot::l_paren_token)
+    .def_ro("r_paren_token", &CXXFunctionalCastExprSnapshot::r_paren_token)
+    .def_ro("is_list_initialization", &CXXFunctionalCastExprSnapshot::is_list_initialization);
 }
 } // namespace pasta
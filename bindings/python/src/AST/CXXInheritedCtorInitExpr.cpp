@@ -26,6 +26,13 @@ void RegisterCXXInheritedCtorInitExpr(nb::module_ &m) {
     .def_prop_ro("constructor", &CXXInheritedCtorInitExpr::Constructor)
     .def_prop_ro("end_token", &CXXInheritedCtorInitExpr::EndToken)
     .def_prop_ro("token", &CXXInheritedCtorInitExpr::Token)
-    .def_prop_ro("inherited_from_virtual_base", &CXXInheritedCtorInitExpr::InheritedFromVirtualBase);
+    .def_prop_ro("inherited_from_virtual_base", &CXXInheritedCtorInitExpr::InheritedFromVirtualBase)
+    .def("snapshot", &CXXInheritedCtorInitExpr::Snapshot);
+
+  nb::class_<CXXInheritedCtorInitExprSnapshot, ExprSnapshot>(m, "CXXInheritedCtorInitExprSnapshot")
+    .def_ro("constructs_virtual_base", &CXXInheritedCtorInitExprSnapshot::constructs_virtual_base)
+    .def_ro("construction_kind", &CXXInheritedCtorInitExprSnapshot::construction_kind)
+    .def_ro("token", &CXXInheritedCtorInitExprSnapshot::token)
+    .def_ro("inherited_from_virtual_base", &CXXInheritedCtorInitExprSnapshot::inherited_from_virtual_base);
 }
 } // namespace pasta
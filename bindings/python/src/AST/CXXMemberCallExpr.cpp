@@ -23,6 +23,9 @@ void RegisterCXXMemberCallExpr(nb::module_ &m) {
     .def_prop_ro("implicit_object_argument", &CXXMemberCallExpr::ImplicitObjectArgument)
     .def_prop_ro("method_declaration", &CXXMemberCallExpr::MethodDeclaration)
     .def_prop_ro("object_type", &CXXMemberCallExpr::ObjectType)
-    .def_prop_ro("record_declaration", &CXXMemberCallExpr::RecordDeclaration);
+    .def_prop_ro("record_declaration", &CXXMemberCallExpr::RecordDeclaration)
+    .def("snapshot", &CXXMemberCallExpr::Snapshot);
+
+  nb::class_<CXXMemberCallExprSnapshot, CallExprSnapshot>(m, "CXXMemberCallExprSnapshot");
 }
 } // namespace pasta
@@ -35,6 +35,19 @@ void RegisterCXXMethodDecl(nb::module_ &m) {
     .def_prop_ro("is_virtual", &CXXMethodDecl::IsVirtual)
     .def_prop_ro("is_volatile", &CXXMethodDecl::IsVolatile)
     .def_prop_ro("overridden_methods", &CXXMethodDecl::OverriddenMethods)
-    .def_prop_ro("size_overridden_methods", &CXXMethodDecl::SizeOverriddenMethods);
+    .def_prop_ro("size_overridden_methods", &CXXMethodDecl::SizeOverriddenMethods)
+    .def("snapshot", &CXXMethodDecl::Snapshot);
+
+  nb::class_<CXXMethodDeclSnapshot, FunctionDeclSnapshot>(m, "CXXMethodDeclSnapshot")
+    .def_ro("reference_qualifier", &CXXMethodDeclSnapshot::reference_qualifier)
+    .def_ro("has_inline_body", &CXXMethodDeclSnapshot::has_inline_body)
+    .def_ro("is_const", &CXXMethodDeclSnapshot::is_const)
+    .def_ro("is_copy_assignment_operator", &CXXMethodDeclSnapshot::is_copy_assignment_operator)
+    .def_ro("is_instance", &CXXMethodDeclSnapshot::is_instance)
+    .def_ro("is_lambda_static_invoker", &CXXMethodDeclSnapshot::is_lambda_static_invoker)
+    .def_ro("is_move_assignment_operator", &CXXMethodDeclSnapshot::is_move_assignment_operator)
+    .def_ro("is_virtual", &CXXMethodDeclSnapshot::is_virtual)
+    .def_ro("is_volatile", &CXXMethodDeclSnapshot::is_volatile)
+    .def_ro("size_overridden_methods", &CXXMethodDeclSnapshot::size_overridden_methods);
 }
 } // namespace pasta
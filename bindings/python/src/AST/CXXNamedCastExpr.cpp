@@ -24,6 +24,11 @@ void RegisterCXXNamedCastExpr(nb::module_ &m) {
     .def_prop_ro("cast_name", &CXXNamedCastExpr::CastName)
     .def_prop_ro("end_token", &CXXNamedCastExpr::EndToken)
     .def_prop_ro("operator_token", &CXXNamedCastExpr::OperatorToken)
-    .def_prop_ro("r_paren_token", &CXXNamedCastExpr::RParenToken);
+    .def_prop_ro("r_paren_token", &CXXNamedCastExpr::RParenToken)
+    .def("snapshot", &CXXNamedCastExpr::Snapshot);
+
+  nb::class_<CXXNamedCastExprSnapshot, ExplicitCastExprSnapshot>(m, "CXXNamedCastExprSnapshot")
+    .def_ro("operator_token", &CXXNamedCastExprSnapshot::operator_token)
+    .def_ro("r_paren_token", &CXXNamedCastExprSnapshot::r_paren_token);
 }
 } // namespace pasta
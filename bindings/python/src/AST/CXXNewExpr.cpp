@@ -40,6 +40,18 @@ void RegisterCXXNewExpr(nb::module_ &m) {
     .def_prop_ro("is_parenthesis_type_id", &CXXNewExpr::IsParenthesisTypeId)
     .def_prop_ro("pass_alignment", &CXXNewExpr::PassAlignment)
     .def_prop_ro("placement_arguments", &CXXNewExpr::PlacementArguments)
-    .def_prop_ro("should_null_check_allocation", &CXXNewExpr::ShouldNullCheckAllocation);
+    .def_prop_ro("should_null_check_allocation", &CXXNewExpr::ShouldNullCheckAllocation)
+    .def("snapshot", &CXXNewExpr::Snapshot);
+
+  nb::class_<CXXNewExprSnapshot, ExprSnapshot>(m, "CXXNewExprSnapshot")
+    .def_ro("does_usual_array_delete_want_size", &CXXNewExprSnapshot::does_usual_array_delete_want_size)
+    .def_ro("initialization_style", &CXXNewExprSnapshot::initialization_style)
+    .def_ro("num_placement_arguments", &CXXNewExprSnapshot::num_placement_arguments)
+    .def_ro("has_initializer", &CXXNewExprSnapshot::has_initializer)
+    .def_ro("is_array", &CXXNewExprSnapshot::is_array)
+    .def_ro("is_global_new", &CXXNewExprSnapshot::is_global_new)
+    .def_ro("is_parenthesis_type_id", &CXXNewExprSnapshot::is_parenthesis_type_id)
+    .def_ro("pass_alignment", &CXXNewExprSnapshot::pass_alignment)
+    .def_ro("should_null_check_allocation", &CXXNewExprSnapshot::should_null_check_allocation);
 }
 } // namespace pasta
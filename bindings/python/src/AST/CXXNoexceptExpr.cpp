@@ -24,6 +24,10 @@ void RegisterCXXNoexceptExpr(nb::module_ &m) {
     .def_prop_ro("end_token", &CXXNoexceptExpr::EndToken)
     .def_prop_ro("operand", &CXXNoexceptExpr::Operand)
     .def_prop_ro("tokens", &CXXNoexceptExpr::Tokens)
-    .def_prop_ro("value", &CXXNoexceptExpr::Value);
+    .def_prop_ro("value", &CXXNoexceptExpr::Value)
+    .def("snapshot", &CXXNoexceptExpr::Snapshot);
+
+  nb::class_<CXXNoexceptExprSnapshot, ExprSnapshot>(m, "CXXNoexceptExprSnapshot")
+    .def_ro("value", &CXXNoexceptExprSnapshot::value);
 }
 } // namespace pasta
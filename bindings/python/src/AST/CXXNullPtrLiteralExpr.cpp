@@ -22,6 +22,10 @@ void RegisterCXXNullPtrLiteralExpr(nb::module_ &m) {
     .def_prop_ro("children", &CXXNullPtrLiteralExpr::Children)
     .def_prop_ro("begin_token", &CXXNullPtrLiteralExpr::BeginToken)
     .def_prop_ro("end_token", &CXXNullPtrLiteralExpr::EndToken)
-    .def_prop_ro("token", &CXXNullPtrLiteralExpr::Token);
+    .def_prop_ro("token", &CXXNullPtrLiteralExpr::Token)
+    .def("snapshot", &CXXNullPtrLiteralExpr::Snapshot);
+
+  nb::class_<CXXNullPtrLiteralExprSnapshot, ExprSnapshot>(m, "CXXNullPtrLiteralExprSnapshot")
+    .def_ro("token", &CXXNullPtrLiteralExprSnapshot::token);
 }
 } // namespace pasta
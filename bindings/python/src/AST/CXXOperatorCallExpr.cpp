@@ -27,6 +27,14 @@ void RegisterCXXOperatorCallExpr(nb::module_ &m) {
     .def_prop_ro("tokens", &CXXOperatorCallExpr::Tokens)
     .def_prop_ro("is_assignment_operation", &CXXOperatorCallExpr::IsAssignmentOperation)
     .def_prop_ro("is_comparison_operation", &CXXOperatorCallExpr::IsComparisonOperation)
-    .def_prop_ro("is_infix_binary_operation", &CXXOperatorCallExpr::IsInfixBinaryOperation);
+    .def_prop_ro("is_infix_binary_operation", &CXXOperatorCallExpr::IsInfixBinaryOperation)
+    .def("snapshot", &CXXOperatorCallExpr::Snapshot);
+
+  nb::class_<CXXOperatorCallExprSnapshot, CallExprSnapshot>(m, "CXXOperatorCallExprSnapshot")
+    .def_ro("operator_", &CXXOperatorCallExprSnapshot::operator_)
+    .def_ro("operator_token", &CXXOperatorCallExprSnapshot::operator_token)
+    .def_ro("is_assignment_operation", &CXXOperatorCallExprSnapshot::is_assignment_operation)
+    .def_ro("is_comparison_operation", &CXXOperatorCallExprSnapshot::is_comparison_operation)
+    .def_ro("is_infix_binary_operation", &CXXOperatorCallExprSnapshot::is_infix_binary_operation);
 }
 } // namespace pasta
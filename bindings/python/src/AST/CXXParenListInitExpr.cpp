@@ -25,6 +25,10 @@ void RegisterCXXParenListInitExpr(nb::module_ &m) {
     .def_prop_ro("end_token", &CXXParenListInitExpr::EndToken)
     .def_prop_ro("initializer_token", &CXXParenListInitExpr::InitializerToken)
     .def_prop_ro("initialized_field_in_union", &CXXParenListInitExpr::InitializedFieldInUnion)
-    .def_prop_ro("tokens", &CXXParenListInitExpr::Tokens);
+    .def_prop_ro("tokens", &CXXParenListInitExpr::Tokens)
+    .def("snapshot", &CXXParenListInitExpr::Snapshot);
+
+  nb::class_<CXXParenListInitExprSnapshot, ExprSnapshot>(m, "CXXParenListInitExprSnapshot")
+    .def_ro("initializer_token", &CXXParenListInitExprSnapshot::initializer_token);
 }
 } // namespace pasta
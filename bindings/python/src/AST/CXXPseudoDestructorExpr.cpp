@@ -29,6 +29,15 @@ void RegisterCXXPseudoDestructorExpr(nb::module_ &m) {
     .def_prop_ro("operator_token", &CXXPseudoDestructorExpr::OperatorToken)
     .def_prop_ro("tilde_token", &CXXPseudoDestructorExpr::TildeToken)
     .def_prop_ro("has_qualifier", &CXXPseudoDestructorExpr::HasQualifier)
-    .def_prop_ro("is_arrow", &CXXPseudoDestructorExpr::IsArrow);
+    .def_prop_ro("is_arrow", &CXXPseudoDestructorExpr::IsArrow)
+    .def("snapshot", &CXXPseudoDestructorExpr::Snapshot);
+
+  nb::class_<CXXPseudoDestructorExprSnapshot, ExprSnapshot>(m, "CXXPseudoDestructorExprSnapshot")
+    .def_ro("colon_colon_token", &CXXPseudoDestructorExprSnapshot::colon_colon_token)
+    .def_ro("destroyed_type_token", &CXXPseudoDestructorExprSnapshot::destroyed_type_token)
+    .def_ro("operator_token", &CXXPseudoDestructorExprSnapshot::operator_token)
+    .def_ro("tilde_token", &CXXPseudoDestructorExprSnapshot::tilde_token)
+    .def_ro("has_qualifier", &CXXPseudoDestructorExprSnapshot::has_qualifier)
+    .def_ro("is_arrow", &CXXPseudoDestructorExprSnapshot::is_arrow);
 }
 } // namespace pasta
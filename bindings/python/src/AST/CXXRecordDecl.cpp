@@ -156,6 +156,17 @@ void RegisterCXXRecordDecl(nb::module_ &m) {
     .def_prop_ro("needs_overload_resolution_for_move_assignment", &CXXRecordDecl::NeedsOverloadResolutionForMoveAssignment)
     .def_prop_ro("needs_overload_resolution_for_move_constructor", &CXXRecordDecl::NeedsOverloadResolutionForMoveConstructor)
     .def_prop_ro("null_field_offset_is_zero", &CXXRecordDecl::NullFieldOffsetIsZero)
-    .def_prop_ro("virtual_bases", &CXXRecordDecl::VirtualBases);
+    .def_prop_ro("virtual_bases", &CXXRecordDecl::VirtualBases)
+    .def("snapshot", &CXXRecordDecl::Snapshot);
+
+  nb::class_<CXXRecordDeclSnapshot, RecordDeclSnapshot>(m, "CXXRecordDeclSnapshot")
+    .def_ro("device_lambda_mangling_number", &CXXRecordDeclSnapshot::device_lambda_mangling_number)
+    .def_ro("lambda_dependency_kind", &CXXRecordDeclSnapshot::lambda_dependency_kind)
+    .def_ro("lambda_index_in_context", &CXXRecordDeclSnapshot::lambda_index_in_context)
+    .def_ro("ms_vtor_disp_mode", &CXXRecordDeclSnapshot::ms_vtor_disp_mode)
+    .def_ro("template_specialization_kind", &CXXRecordDeclSnapshot::template_specialization_kind)
+    .def_ro("is_dependent_lambda", &CXXRecordDeclSnapshot::is_dependent_lambda)
+    .def_ro("is_generic_lambda", &CXXRecordDeclSnapshot::is_generic_lambda)
+    .def_ro("is_never_dependent_lambda", &CXXRecordDeclSnapshot::is_never_dependent_lambda);
 }
 } // namespace pasta
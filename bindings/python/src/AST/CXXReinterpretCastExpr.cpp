@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterCXXReinterpretCastExpr(nb::module_ &m) {
-  nb::class_<CXXReinterpretCastExpr, CXXNamedCastExpr>(m, "CXXReinterpretCastExpr");
+  nb::class_<CXXReinterpretCastExpr, CXXNamedCastExpr>(m, "CXXReinterpretCastExpr")
+    .def("snapshot", &CXXReinterpretCastExpr::Snapshot);
+
+  nb::class_<CXXReinterpretCastExprSnapshot, CXXNamedCastExprSnapshot>(m, "CXXReinterpretCastExprSnapshot");
 }
 } // namespace pasta
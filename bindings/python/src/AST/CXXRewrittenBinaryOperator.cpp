@@ -32,6 +32,15 @@ void RegisterCXXRewrittenBinaryOperator(nb::module_ &m) {
     .def_prop_ro("tokens", &CXXRewrittenBinaryOperator::Tokens)
     .def_prop_ro("is_assignment_operation", &CXXRewrittenBinaryOperator::IsAssignmentOperation)
     .def_prop_ro("is_comparison_operation", &CXXRewrittenBinaryOperator::IsComparisonOperation)
-    .def_prop_ro("is_reversed", &CXXRewrittenBinaryOperator::IsReversed);
+    .def_prop_ro("is_reversed", &CXXRewrittenBinaryOperator::IsReversed)
+    .def("snapshot", &CXXRewrittenBinaryOperator::Snapshot);
+
+  nb::class_<CXXRewrittenBinaryOperatorSnapshot, ExprSnapshot>(m, "CXXRewrittenBinaryOperatorSnapshot")
+    .def_ro("opcode", &CXXRewrittenBinaryOperatorSnapshot::opcode)
+    .def_ro("operator_", &CXXRewrittenBinaryOperatorSnapshot::operator_)
+    .def_ro("operator_token", &CXXRewrittenBinaryOperatorSnapshot::operator_token)
+    .def_ro("is_assignment_operation", &CXXRewrittenBinaryOperatorSnapshot::is_assignment_operation)
+    .def_ro("is_comparison_operation", &CXXRewrittenBinaryOperatorSnapshot::is_comparison_operation)
+    .def_ro("is_reversed", &CXXRewrittenBinaryOperatorSnapshot::is_reversed);
 }
 } // namespace pasta
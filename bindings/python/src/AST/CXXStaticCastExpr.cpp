@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterCXXStaticCastExpr(nb::module_ &m) {
-  nb::class_<CXXStaticCastExpr, CXXNamedCastExpr>(m, "CXXStaticCastExpr");
+  nb::class_<CXXStaticCastExpr, CXXNamedCastExpr>(m, "CXXStaticCastExpr")
+    .def("snapshot", &CXXStaticCastExpr::Snapshot);
+
+  nb::class_<CXXStaticCastExprSnapshot, CXXNamedCastExprSnapshot>(m, "CXXStaticCastExprSnapshot");
 }
 } // namespace pasta
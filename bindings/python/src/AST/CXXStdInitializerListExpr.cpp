@@ -23,6 +23,9 @@ void RegisterCXXStdInitializerListExpr(nb::module_ &m) {
     .def_prop_ro("begin_token", &CXXStdInitializerListExpr::BeginToken)
     .def_prop_ro("end_token", &CXXStdInitializerListExpr::EndToken)
     .def_prop_ro("tokens", &CXXStdInitializerListExpr::Tokens)
-    .def_prop_ro("sub_expression", &CXXStdInitializerListExpr::SubExpression);
+    .def_prop_ro("sub_expression", &CXXStdInitializerListExpr::SubExpression)
+    .def("snapshot", &CXXStdInitializerListExpr::Snapshot);
+
+  nb::class_<CXXStdInitializerListExprSnapshot, ExprSnapshot>(m, "CXXStdInitializerListExprSnapshot");
 }
 } // namespace pasta
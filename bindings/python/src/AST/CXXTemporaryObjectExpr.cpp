@@ -20,6 +20,9 @@ namespace nb = nanobind;
 void RegisterCXXTemporaryObjectExpr(nb::module_ &m) {
   nb::class_<CXXTemporaryObjectExpr, CXXConstructExpr>(m, "CXXTemporaryObjectExpr")
     .def_prop_ro("begin_token", &CXXTemporaryObjectExpr::BeginToken)
-    .def_prop_ro("end_token", &CXXTemporaryObjectExpr::EndToken);
+    .def_prop_ro("end_token", &CXXTemporaryObjectExpr::EndToken)
+    .def("snapshot", &CXXTemporaryObjectExpr::Snapshot);
+
+  nb::class_<CXXTemporaryObjectExprSnapshot, CXXConstructExprSnapshot>(m, "CXXTemporaryObjectExprSnapshot");
 }
 } // namespace pasta
@@ -23,6 +23,11 @@ void RegisterCXXThisExpr(nb::module_ &m) {
     .def_prop_ro("begin_token", &CXXThisExpr::BeginToken)
     .def_prop_ro("end_token", &CXXThisExpr::EndToken)
     .def_prop_ro("token", &CXXThisExpr::Token)
-    .def_prop_ro("is_implicit", &CXXThisExpr::IsImplicit);
+    .def_prop_ro("is_implicit", &CXXThisExpr::IsImplicit)
+    .def("snapshot", &CXXThisExpr::Snapshot);
+
+  nb::class_<CXXThisExprSnapshot, ExprSnapshot>(m, "CXXThisExprSnapshot")
+    .def_ro("token", &CXXThisExprSnapshot::token)
+    .def_ro("is_implicit", &CXXThisExprSnapshot::is_implicit);
 }
 } // namespace pasta
@@ -24,6 +24,11 @@ void RegisterCXXThrowExpr(nb::module_ &m) {
     .def_prop_ro("end_token", &CXXThrowExpr::EndToken)
     .def_prop_ro("sub_expression", &CXXThrowExpr::SubExpression)
     .def_prop_ro("throw_token", &CXXThrowExpr::ThrowToken)
-    .def_prop_ro("is_thrown_variable_in_scope", &CXXThrowExpr::IsThrownVariableInScope);
+    .def_prop_ro("is_thrown_variable_in_scope", &CXXThrowExpr::IsThrownVariableInScope)
+    .def("snapshot", &CXXThrowExpr::Snapshot);
+
+  nb::class_<CXXThrowExprSnapshot, ExprSnapshot>(m, "CXXThrowExprSnapshot")
+    .def_ro("throw_token", &CXXThrowExprSnapshot::throw_token)
+    .def_ro("is_thrown_variable_in_scope", &CXXThrowExprSnapshot::is_thrown_variable_in_scope);
 }
 } // namespace pasta
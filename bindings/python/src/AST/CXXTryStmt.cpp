@@ -24,6 +24,11 @@ void RegisterCXXTryStmt(nb::module_ &m) {
     .def_prop_ro("end_token", &CXXTryStmt::EndToken)
     .def_prop_ro("num_handlers", &CXXTryStmt::NumHandlers)
     .def_prop_ro("try_block", &CXXTryStmt::TryBlock)
-    .def_prop_ro("try_token", &CXXTryStmt::TryToken);
+    .def_prop_ro("try_token", &CXXTryStmt::TryToken)
+    .def("snapshot", &CXXTryStmt::Snapshot);
+
+  nb::class_<CXXTryStmtSnapshot, StmtSnapshot>(m, "CXXTryStmtSnapshot")
+    .def_ro("num_handlers", &CXXTryStmtSnapshot::num_handlers)
+    .def_ro("try_token", &CXXTryStmtSnapshot::try_token);
 }
 } // namespace pasta
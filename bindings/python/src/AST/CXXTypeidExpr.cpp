@@ -28,6 +28,11 @@ void RegisterCXXTypeidExpr(nb::module_ &m) {
     .def_prop_ro("type_operand_source_info", &CXXTypeidExpr::TypeOperandSourceInfo)
     .def_prop_ro("is_most_derived", &CXXTypeidExpr::IsMostDerived)
     .def_prop_ro("is_potentially_evaluated", &CXXTypeidExpr::IsPotentiallyEvaluated)
-    .def_prop_ro("is_type_operand", &CXXTypeidExpr::IsTypeOperand);
+    .def_prop_ro("is_type_operand", &CXXTypeidExpr::IsTypeOperand)
+    .def("snapshot", &CXXTypeidExpr::Snapshot);
+
+  nb::class_<CXXTypeidExprSnapshot, ExprSnapshot>(m, "CXXTypeidExprSnapshot")
+    .def_ro("is_potentially_evaluated", &CXXTypeidExprSnapshot::is_potentially_evaluated)
+    .def_ro("is_type_operand", &CXXTypeidExprSnapshot::is_type_operand);
 }
 } // namespace pasta
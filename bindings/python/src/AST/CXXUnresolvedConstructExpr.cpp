@@ -27,6 +27,13 @@ void RegisterCXXUnresolvedConstructExpr(nb::module_ &m) {
     .def_prop_ro("num_arguments", &CXXUnresolvedConstructExpr::NumArguments)
     .def_prop_ro("r_paren_token", &CXXUnresolvedConstructExpr::RParenToken)
     .def_prop_ro("type_as_written", &CXXUnresolvedConstructExpr::TypeAsWritten)
-    .def_prop_ro("is_list_initialization", &CXXUnresolvedConstructExpr::IsListInitialization);
+    .def_prop_ro("is_list_initialization", &CXXUnresolvedConstructExpr::IsListInitialization)
+    .def("snapshot", &CXXUnresolvedConstructExpr::Snapshot);
+
+  nb::class_<CXXUnresolvedConstructExprSnapshot, ExprSnapshot>(m, "CXXUnresolvedConstructExprSnapshot")
+    .def_ro("l_paren_token", &CXXUnresolvedConstructExprSnapshot::l_paren_token)
+    .def_ro("num_arguments", &CXXUnresolvedConstructExprSnapshot::num_arguments)
+    .def_ro("r_paren_token", &CXXUnresolvedConstructExprSnapshot::r_paren_token)
+    .def_ro("is_list_initialization", &CXXUnresolvedConstructExprSnapshot::is_list_initialization);
 }
 } // namespace pasta
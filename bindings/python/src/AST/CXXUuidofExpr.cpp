@@ -27,6 +27,10 @@ void RegisterCXXUuidofExpr(nb::module_ &m) {
     .def_prop_ro("tokens", &CXXUuidofExpr::Tokens)
     .def_prop_ro("type_operand", &CXXUuidofExpr::TypeOperand)
     .def_prop_ro("type_operand_source_info", &CXXUuidofExpr::TypeOperandSourceInfo)
-    .def_prop_ro("is_type_operand", &CXXUuidofExpr::IsTypeOperand);
+    .def_prop_ro("is_type_operand", &CXXUuidofExpr::IsTypeOperand)
+    .def("snapshot", &CXXUuidofExpr::Snapshot);
+
+  nb::class_<CXXUuidofExprSnapshot, ExprSnapshot>(m, "CXXUuidofExprSnapshot")
+    .def_ro("is_type_operand", &CXXUuidofExprSnapshot::is_type_operand);
 }
 } // namespace pasta
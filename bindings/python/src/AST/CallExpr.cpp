@@ -37,6 +37,19 @@ void RegisterCallExpr(nb::module_ &m) {
     .def_prop_ro("is_builtin_assume_false", &CallExpr::IsBuiltinAssumeFalse)
     .def_prop_ro("is_call_to_std_move", &CallExpr::IsCallToStdMove)
     .def_prop_ro("is_unevaluated_builtin_call", &CallExpr::IsUnevaluatedBuiltinCall)
-    .def_prop_ro("uses_adl", &CallExpr::UsesADL);
+    .def_prop_ro("uses_adl", &CallExpr::UsesADL)
+    .def("snapshot", &CallExpr::Snapshot);
+
+  nb::class_<CallExprSnapshot, ExprSnapshot>(m, "CallExprSnapshot")
+    .def_ro("adl_call_kind", &CallExprSnapshot::adl_call_kind)
+    .def_ro("builtin_callee", &CallExprSnapshot::builtin_callee)
+    .def_ro("num_arguments", &CallExprSnapshot::num_arguments)
+    .def_ro("r_paren_token", &CallExprSnapshot::r_paren_token)
+    .def_ro("has_stored_fp_features", &CallExprSnapshot::has_stored_fp_features)
+    .def_ro("has_unused_result_attribute", &CallExprSnapshot::has_unused_result_attribute)
+    .def_ro("is_builtin_assume_false", &CallExprSnapshot::is_builtin_assume_false)
+    .def_ro("is_call_to_std_move", &CallExprSnapshot::is_call_to_std_move)
+    .def_ro("is_unevaluated_builtin_call", &CallExprSnapshot::is_unevaluated_builtin_call)
+    .def_ro("uses_adl", &CallExprSnapshot::uses_adl);
 }
 } // namespace pasta
@@ -23,6 +23,12 @@ void RegisterCapturedDecl(nb::module_ &m) {
     .def_prop_ro("context_parameter_position", &CapturedDecl::ContextParameterPosition)
     .def_prop_ro("num_parameters", &CapturedDecl::NumParameters)
     .def_prop_ro("is_nothrow", &CapturedDecl::IsNothrow)
-    .def_prop_ro("parameters", &CapturedDecl::Parameters);
+    .def_prop_ro("parameters", &CapturedDecl::Parameters)
+    .def("snapshot", &CapturedDecl::Snapshot);
+
+  nb::class_<CapturedDeclSnapshot, DeclSnapshot>(m, "CapturedDeclSnapshot")
+    .def_ro("context_parameter_position", &CapturedDeclSnapshot::context_parameter_position)
+    .def_ro("num_parameters", &CapturedDeclSnapshot::num_parameters)
+    .def_ro("is_nothrow", &CapturedDeclSnapshot::is_nothrow);
 }
 } // namespace pasta
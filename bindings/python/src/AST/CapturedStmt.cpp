@@ -26,6 +26,10 @@ void RegisterCapturedStmt(nb::module_ &m) {
     .def_prop_ro("captured_region_kind", &CapturedStmt::CapturedRegionKind)
     .def_prop_ro("captured_statement", &CapturedStmt::CapturedStatement)
     .def_prop_ro("end_token", &CapturedStmt::EndToken)
-    .def_prop_ro("tokens", &CapturedStmt::Tokens);
+    .def_prop_ro("tokens", &CapturedStmt::Tokens)
+    .def("snapshot", &CapturedStmt::Snapshot);
+
+  nb::class_<CapturedStmtSnapshot, StmtSnapshot>(m, "CapturedStmtSnapshot")
+    .def_ro("captured_region_kind", &CapturedStmtSnapshot::captured_region_kind);
 }
 } // namespace pasta
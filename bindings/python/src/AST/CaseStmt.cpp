@@ -27,6 +27,12 @@ void RegisterCaseStmt(nb::module_ &m) {
     .def_prop_ro("end_token", &CaseStmt::EndToken)
     .def_prop_ro("lhs", &CaseStmt::LHS)
     .def_prop_ro("rhs", &CaseStmt::RHS)
-    .def_prop_ro("sub_statement", &CaseStmt::SubStatement);
+    .def_prop_ro("sub_statement", &CaseStmt::SubStatement)
+    .def("snapshot", &CaseStmt::Snapshot);
+
+  nb::class_<CaseStmtSnapshot, SwitchCaseSnapshot>(m, "CaseStmtSnapshot")
+    .def_ro("case_statement_is_gnu_range", &CaseStmtSnapshot::case_statement_is_gnu_range)
+    .def_ro("case_token", &CaseStmtSnapshot::case_token)
+    .def_ro("ellipsis_token", &CaseStmtSnapshot::ellipsis_token);
 }
 } // namespace pasta
@@ -26,6 +26,11 @@ void RegisterCastExpr(nb::module_ &m) {
     .def_prop_ro("sub_expression", &CastExpr::SubExpression)
     .def_prop_ro("sub_expression_as_written", &CastExpr::SubExpressionAsWritten)
     .def_prop_ro("target_union_field", &CastExpr::TargetUnionField)
-    .def_prop_ro("has_stored_fp_features", &CastExpr::HasStoredFPFeatures);
+    .def_prop_ro("has_stored_fp_features", &CastExpr::HasStoredFPFeatures)
+    .def("snapshot", &CastExpr::Snapshot);
+
+  nb::class_<CastExprSnapshot, ExprSnapshot>(m, "CastExprSnapshot")
+    .def_ro("cast_kind", &CastExprSnapshot::cast_kind)
+    .def_ro("has_stored_fp_features", &CastExprSnapshot::has_stored_fp_features);
 }
 } // namespace pasta
@@ -24,6 +24,12 @@ void RegisterCharacterLiteral(nb::module_ &m) {
     .def_prop_ro("end_token", &CharacterLiteral::EndToken)
     .def_prop_ro("literal_kind", &CharacterLiteral::LiteralKind)
     .def_prop_ro("token", &CharacterLiteral::Token)
-    .def_prop_ro("value", &CharacterLiteral::Value);
+    .def_prop_ro("value", &CharacterLiteral::Value)
+    .def("snapshot", &CharacterLiteral::Snapshot);
+
+  nb::class_<CharacterLiteralSnapshot, ExprSnapshot>(m, "CharacterLiteralSnapshot")
+    .def_ro("literal_kind", &CharacterLiteralSnapshot::literal_kind)
+    .def_ro("token", &CharacterLiteralSnapshot::token)
+    .def_ro("value", &CharacterLiteralSnapshot::value);
 }
 } // namespace pasta
@@ -29,6 +29,13 @@ void RegisterChooseExpr(nb::module_ &m) {
     .def_prop_ro("rhs", &ChooseExpr::RHS)
     .def_prop_ro("r_paren_token", &ChooseExpr::RParenToken)
     .def_prop_ro("is_condition_dependent", &ChooseExpr::IsConditionDependent)
-    .def_prop_ro("is_condition_true", &ChooseExpr::IsConditionTrue);
+    .def_prop_ro("is_condition_true", &ChooseExpr::IsConditionTrue)
+    .def("snapshot", &ChooseExpr::Snapshot);
+
+  nb::class_<ChooseExprSnapshot, ExprSnapshot>(m, "ChooseExprSnapshot")
+    .def_ro("builtin_token", &ChooseExprSnapshot::builtin_token)
+    .def_ro("r_paren_token", &ChooseExprSnapshot::r_paren_token)
+    .def_ro("is_condition_dependent", &ChooseExprSnapshot::is_condition_dependent)
+    .def_ro("is_condition_true", &ChooseExprSnapshot::is_condition_true);
 }
 } // namespace pasta
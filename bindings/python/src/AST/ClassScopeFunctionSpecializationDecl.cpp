@@ -20,6 +20,10 @@ namespace nb = nanobind;
 void RegisterClassScopeFunctionSpecializationDecl(nb::module_ &m) {
   nb::class_<ClassScopeFunctionSpecializationDecl, Decl>(m, "ClassScopeFunctionSpecializationDecl")
     .def_prop_ro("specialization", &ClassScopeFunctionSpecializationDecl::Specialization)
-    .def_prop_ro("has_explicit_template_arguments", &ClassScopeFunctionSpecializationDecl::HasExplicitTemplateArguments);
+    .def_prop_ro("has_explicit_template_arguments", &ClassScopeFunctionSpecializationDecl::HasExplicitTemplateArguments)
+    .def("snapshot", &ClassScopeFunctionSpecializationDecl::Snapshot);
+
+  nb::class_<ClassScopeFunctionSpecializationDeclSnapshot, DeclSnapshot>(m, "ClassScopeFunctionSpecializationDeclSnapshot")
+    .def_ro("has_explicit_template_arguments", &ClassScopeFunctionSpecializationDeclSnapshot::has_explicit_template_arguments);
 }
 } // namespace pasta
@@ -25,6 +25,10 @@ void RegisterClassTemplateDecl(nb::module_ &m) {
     .def_prop_ro("previous_declaration", &ClassTemplateDecl::PreviousDeclaration)
     .def_prop_ro("templated_declaration", &ClassTemplateDecl::TemplatedDeclaration)
     .def_prop_ro("is_this_declaration_a_definition", &ClassTemplateDecl::IsThisDeclarationADefinition)
-    .def_prop_ro("specializations", &ClassTemplateDecl::Specializations);
+    .def_prop_ro("specializations", &ClassTemplateDecl::Specializations)
+    .def("snapshot", &ClassTemplateDecl::Snapshot);
+
+  nb::class_<ClassTemplateDeclSnapshot, RedeclarableTemplateDeclSnapshot>(m, "ClassTemplateDeclSnapshot")
+    .def_ro("is_this_declaration_a_definition", &ClassTemplateDeclSnapshot::is_this_declaration_a_definition);
 }
 } // namespace pasta
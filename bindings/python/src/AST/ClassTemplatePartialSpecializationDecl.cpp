@@ -23,6 +23,10 @@ void RegisterClassTemplatePartialSpecializationDecl(nb::module_ &m) {
     .def_prop_ro("instantiated_from_member", &ClassTemplatePartialSpecializationDecl::InstantiatedFromMember)
     .def_prop_ro("instantiated_from_member_template", &ClassTemplatePartialSpecializationDecl::InstantiatedFromMemberTemplate)
     .def_prop_ro("template_parameters", &ClassTemplatePartialSpecializationDecl::TemplateParameters)
-    .def_prop_ro("has_associated_constraints", &ClassTemplatePartialSpecializationDecl::HasAssociatedConstraints);
+    .def_prop_ro("has_associated_constraints", &ClassTemplatePartialSpecializationDecl::HasAssociatedConstraints)
+    .def("snapshot", &ClassTemplatePartialSpecializationDecl::Snapshot);
+
+  nb::class_<ClassTemplatePartialSpecializationDeclSnapshot, ClassTemplateSpecializationDeclSnapshot>(m, "ClassTemplatePartialSpecializationDeclSnapshot")
+    .def_ro("has_associated_constraints", &ClassTemplatePartialSpecializationDeclSnapshot::has_associated_constraints);
 }
 } // namespace pasta
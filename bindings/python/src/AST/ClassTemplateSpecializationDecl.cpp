@@ -31,6 +31,16 @@ void RegisterClassTemplateSpecializationDecl(nb::module_ &m) {
     .def_prop_ro("type_as_written", &ClassTemplateSpecializationDecl::TypeAsWritten)
     .def_prop_ro("is_class_scope_explicit_specialization", &ClassTemplateSpecializationDecl::IsClassScopeExplicitSpecialization)
     .def_prop_ro("is_explicit_instantiation_or_specialization", &ClassTemplateSpecializationDecl::IsExplicitInstantiationOrSpecialization)
-    .def_prop_ro("is_explicit_specialization", &ClassTemplateSpecializationDecl::IsExplicitSpecialization);
+    .def_prop_ro("is_explicit_specialization", &ClassTemplateSpecializationDecl::IsExplicitSpecialization)
+    .def("snapshot", &ClassTemplateSpecializationDecl::Snapshot);
+
+  nb::class_<ClassTemplateSpecializationDeclSnapshot, CXXRecordDeclSnapshot>(m, "ClassTemplateSpecializationDeclSnapshot")
+    .def_ro("extern_token", &ClassTemplateSpecializationDeclSnapshot::extern_token)
+    .def_ro("point_of_instantiation", &ClassTemplateSpecializationDeclSnapshot::point_of_instantiation)
+    .def_ro("specialization_kind", &ClassTemplateSpecializationDeclSnapshot::specialization_kind)
+    .def_ro("template_keyword_token", &ClassTemplateSpecializationDeclSnapshot::template_keyword_token)
+    .def_ro("is_class_scope_explicit_specialization", &ClassTemplateSpecializationDeclSnapshot::is_class_scope_explicit_specialization)
+    .def_ro("is_explicit_instantiation_or_specialization", &ClassTemplateSpecializationDeclSnapshot::is_explicit_instantiation_or_specialization)
+    .def_ro("is_explicit_specialization", &ClassTemplateSpecializationDeclSnapshot::is_explicit_specialization);
 }
 } // namespace pasta
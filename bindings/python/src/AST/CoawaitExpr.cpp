@@ -19,6 +19,10 @@ namespace nb = nanobind;
 
 void RegisterCoawaitExpr(nb::module_ &m) {
   nb::class_<CoawaitExpr, CoroutineSuspendExpr>(m, "CoawaitExpr")
-    .def_prop_ro("is_implicit", &CoawaitExpr::IsImplicit);
+    .def_prop_ro("is_implicit", &CoawaitExpr::IsImplicit)
+    .def("snapshot", &CoawaitExpr::Snapshot);
+
+  nb::class_<CoawaitExprSnapshot, CoroutineSuspendExprSnapshot>(m, "CoawaitExprSnapshot")
+    .def_ro("is_implicit", &CoawaitExprSnapshot::is_implicit);
 }
 } // namespace pasta
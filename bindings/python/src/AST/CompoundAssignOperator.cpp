@@ -20,6 +20,9 @@ namespace nb = nanobind;
 void RegisterCompoundAssignOperator(nb::module_ &m) {
   nb::class_<CompoundAssignOperator, BinaryOperator>(m, "CompoundAssignOperator")
     .def_prop_ro("computation_lhs_type", &CompoundAssignOperator::ComputationLHSType)
-    .def_prop_ro("computation_result_type", &CompoundAssignOperator::ComputationResultType);
+    .def_prop_ro("computation_result_type", &CompoundAssignOperator::ComputationResultType)
+    .def("snapshot", &CompoundAssignOperator::Snapshot);
+
+  nb::class_<CompoundAssignOperatorSnapshot, BinaryOperatorSnapshot>(m, "CompoundAssignOperatorSnapshot");
 }
 } // namespace pasta
@@ -24,6 +24,11 @@ void RegisterCompoundLiteralExpr(nb::module_ &m) {
     .def_prop_ro("end_token", &CompoundLiteralExpr::EndToken)
     .def_prop_ro("initializer", &CompoundLiteralExpr::Initializer)
     .def_prop_ro("l_paren_token", &CompoundLiteralExpr::LParenToken)
-    .def_prop_ro("is_file_scope", &CompoundLiteralExpr::IsFileScope);
+    .def_prop_ro("is_file_scope", &CompoundLiteralExpr::IsFileScope)
+    .def("snapshot", &CompoundLiteralExpr::Snapshot);
+
+  nb::class_<CompoundLiteralExprSnapshot, ExprSnapshot>(m, "CompoundLiteralExprSnapshot")
+    .def_ro("l_paren_token", &CompoundLiteralExprSnapshot::l_paren_token)
+    .def_ro("is_file_scope", &CompoundLiteralExprSnapshot::is_file_scope);
 }
 } // namespace pasta
@@ -26,6 +26,13 @@ void RegisterCompoundStmt(nb::module_ &m) {
     .def_prop_ro("right_brace_token", &CompoundStmt::RightBraceToken)
     .def_prop_ro("statement_expression_result", &CompoundStmt::StatementExpressionResult)
     .def_prop_ro("has_stored_fp_features", &CompoundStmt::HasStoredFPFeatures)
-    .def_prop_ro("size", &CompoundStmt::Size);
+    .def_prop_ro("size", &CompoundStmt::Size)
+    .def("snapshot", &CompoundStmt::Snapshot);
+
+  nb::class_<CompoundStmtSnapshot, StmtSnapshot>(m, "CompoundStmtSnapshot")
+    .def_ro("left_brace_token", &CompoundStmtSnapshot::left_brace_token)
+    .def_ro("right_brace_token", &CompoundStmtSnapshot::right_brace_token)
+    .def_ro("has_stored_fp_features", &CompoundStmtSnapshot::has_stored_fp_features)
+    .def_ro("size", &CompoundStmtSnapshot::size);
 }
 } // namespace pasta
@@ -21,6 +21,10 @@ void RegisterConceptDecl(nb::module_ &m) {
   nb::class_<ConceptDecl, TemplateDecl>(m, "ConceptDecl")
     .def_prop_ro("canonical_declaration", &ConceptDecl::CanonicalDeclaration)
     .def_prop_ro("constraint_expression", &ConceptDecl::ConstraintExpression)
-    .def_prop_ro("is_type_concept", &ConceptDecl::IsTypeConcept);
+    .def_prop_ro("is_type_concept", &ConceptDecl::IsTypeConcept)
+    .def("snapshot", &ConceptDecl::Snapshot);
+
+  nb::class_<ConceptDeclSnapshot, TemplateDeclSnapshot>(m, "ConceptDeclSnapshot")
+    .def_ro("is_type_concept", &ConceptDeclSnapshot::is_type_concept);
 }
 } // namespace pasta
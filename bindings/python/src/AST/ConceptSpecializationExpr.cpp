@@ -24,6 +24,10 @@ void RegisterConceptSpecializationExpr(nb::module_ &m) {
     .def_prop_ro("end_token", &ConceptSpecializationExpr::EndToken)
     .def_prop_ro("specialization_declaration", &ConceptSpecializationExpr::SpecializationDeclaration)
     .def_prop_ro("template_arguments", &ConceptSpecializationExpr::TemplateArguments)
-    .def_prop_ro("is_satisfied", &ConceptSpecializationExpr::IsSatisfied);
+    .def_prop_ro("is_satisfied", &ConceptSpecializationExpr::IsSatisfied)
+    .def("snapshot", &ConceptSpecializationExpr::Snapshot);
+
+  nb::class_<ConceptSpecializationExprSnapshot, ExprSnapshot>(m, "ConceptSpecializationExprSnapshot")
+    .def_ro("is_satisfied", &ConceptSpecializationExprSnapshot::is_satisfied);
 }
 } // namespace pasta
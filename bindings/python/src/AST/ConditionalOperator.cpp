@@ -26,6 +26,9 @@ void RegisterConditionalOperator(nb::module_ &m) {
     .def_prop_ro("false_expression", &ConditionalOperator::FalseExpression)
     .def_prop_ro("lhs", &ConditionalOperator::LHS)
     .def_prop_ro("rhs", &ConditionalOperator::RHS)
-    .def_prop_ro("true_expression", &ConditionalOperator::TrueExpression);
+    .def_prop_ro("true_expression", &ConditionalOperator::TrueExpression)
+    .def("snapshot", &ConditionalOperator::Snapshot);
+
+  nb::class_<ConditionalOperatorSnapshot, AbstractConditionalOperatorSnapshot>(m, "ConditionalOperatorSnapshot");
 }
 } // namespace pasta
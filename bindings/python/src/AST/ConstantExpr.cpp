@@ -25,6 +25,12 @@ void RegisterConstantExpr(nb::module_ &m) {
     .def_prop_ro("result_as_aps_int", &ConstantExpr::ResultAsAPSInt)
     .def_prop_ro("result_storage_kind", &ConstantExpr::ResultStorageKind)
     .def_prop_ro("has_ap_value_result", &ConstantExpr::HasAPValueResult)
-    .def_prop_ro("is_immediate_invocation", &ConstantExpr::IsImmediateInvocation);
+    .def_prop_ro("is_immediate_invocation", &ConstantExpr::IsImmediateInvocation)
+    .def("snapshot", &ConstantExpr::Snapshot);
+
+  nb::class_<ConstantExprSnapshot, FullExprSnapshot>(m, "ConstantExprSnapshot")
+    .def_ro("result_storage_kind", &ConstantExprSnapshot::result_storage_kind)
+    .def_ro("has_ap_value_result", &ConstantExprSnapshot::has_ap_value_result)
+    .def_ro("is_immediate_invocation", &ConstantExprSnapshot::is_immediate_invocation);
 }
 } // namespace pasta
@@ -25,6 +25,10 @@ void RegisterConstructorUsingShadowDecl(nb::module_ &m) {
     .def_prop_ro("introducer", &ConstructorUsingShadowDecl::Introducer)
     .def_prop_ro("nominated_base_class", &ConstructorUsingShadowDecl::NominatedBaseClass)
     .def_prop_ro("nominated_base_class_shadow_declaration", &ConstructorUsingShadowDecl::NominatedBaseClassShadowDeclaration)
-    .def_prop_ro("parent", &ConstructorUsingShadowDecl::Parent);
+    .def_prop_ro("parent", &ConstructorUsingShadowDecl::Parent)
+    .def("snapshot", &ConstructorUsingShadowDecl::Snapshot);
+
+  nb::class_<ConstructorUsingShadowDeclSnapshot, UsingShadowDeclSnapshot>(m, "ConstructorUsingShadowDeclSnapshot")
+    .def_ro("constructs_virtual_base", &ConstructorUsingShadowDeclSnapshot::constructs_virtual_base);
 }
 } // namespace pasta
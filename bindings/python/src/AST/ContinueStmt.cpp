@@ -22,6 +22,10 @@ void RegisterContinueStmt(nb::module_ &m) {
     .def_prop_ro("children", &ContinueStmt::Children)
     .def_prop_ro("begin_token", &ContinueStmt::BeginToken)
     .def_prop_ro("continue_token", &ContinueStmt::ContinueToken)
-    .def_prop_ro("end_token", &ContinueStmt::EndToken);
+    .def_prop_ro("end_token", &ContinueStmt::EndToken)
+    .def("snapshot", &ContinueStmt::Snapshot);
+
+  nb::class_<ContinueStmtSnapshot, StmtSnapshot>(m, "ContinueStmtSnapshot")
+    .def_ro("continue_token", &ContinueStmtSnapshot::continue_token);
 }
 } // namespace pasta
@@ -24,6 +24,11 @@ void RegisterConvertVectorExpr(nb::module_ &m) {
     .def_prop_ro("builtin_token", &ConvertVectorExpr::BuiltinToken)
     .def_prop_ro("end_token", &ConvertVectorExpr::EndToken)
     .def_prop_ro("r_paren_token", &ConvertVectorExpr::RParenToken)
-    .def_prop_ro("src_expression", &ConvertVectorExpr::SrcExpression);
+    .def_prop_ro("src_expression", &ConvertVectorExpr::SrcExpression)
+    .def("snapshot", &ConvertVectorExpr::Snapshot);
+
+  nb::class_<ConvertVectorExprSnapshot, ExprSnapshot>(m, "ConvertVectorExprSnapshot")
+    .def_ro("builtin_token", &ConvertVectorExprSnapshot::builtin_token)
+    .def_ro("r_paren_token", &ConvertVectorExprSnapshot::r_paren_token);
 }
 } // namespace pasta
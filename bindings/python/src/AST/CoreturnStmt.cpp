@@ -25,6 +25,11 @@ void RegisterCoreturnStmt(nb::module_ &m) {
     .def_prop_ro("keyword_token", &CoreturnStmt::KeywordToken)
     .def_prop_ro("operand", &CoreturnStmt::Operand)
     .def_prop_ro("promise_call", &CoreturnStmt::PromiseCall)
-    .def_prop_ro("is_implicit", &CoreturnStmt::IsImplicit);
+    .def_prop_ro("is_implicit", &CoreturnStmt::IsImplicit)
+    .def("snapshot", &CoreturnStmt::Snapshot);
+
+  nb::class_<CoreturnStmtSnapshot, StmtSnapshot>(m, "CoreturnStmtSnapshot")
+    .def_ro("keyword_token", &CoreturnStmtSnapshot::keyword_token)
+    .def_ro("is_implicit", &CoreturnStmtSnapshot::is_implicit);
 }
 } // namespace pasta
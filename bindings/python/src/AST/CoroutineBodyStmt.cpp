@@ -38,6 +38,10 @@ void RegisterCoroutineBodyStmt(nb::module_ &m) {
     .def_prop_ro("return_statement_on_alloc_failure", &CoroutineBodyStmt::ReturnStatementOnAllocFailure)
     .def_prop_ro("return_value", &CoroutineBodyStmt::ReturnValue)
     .def_prop_ro("return_value_initializer", &CoroutineBodyStmt::ReturnValueInitializer)
-    .def_prop_ro("has_dependent_promise_type", &CoroutineBodyStmt::HasDependentPromiseType);
+    .def_prop_ro("has_dependent_promise_type", &CoroutineBodyStmt::HasDependentPromiseType)
+    .def("snapshot", &CoroutineBodyStmt::Snapshot);
+
+  nb::class_<CoroutineBodyStmtSnapshot, StmtSnapshot>(m, "CoroutineBodyStmtSnapshot")
+    .def_ro("has_dependent_promise_type", &CoroutineBodyStmtSnapshot::has_dependent_promise_type);
 }
 } // namespace pasta
@@ -28,6 +28,10 @@ void RegisterCoroutineSuspendExpr(nb::module_ &m) {
     .def_prop_ro("operand", &CoroutineSuspendExpr::Operand)
     .def_prop_ro("ready_expression", &CoroutineSuspendExpr::ReadyExpression)
     .def_prop_ro("resume_expression", &CoroutineSuspendExpr::ResumeExpression)
-    .def_prop_ro("suspend_expression", &CoroutineSuspendExpr::SuspendExpression);
+    .def_prop_ro("suspend_expression", &CoroutineSuspendExpr::SuspendExpression)
+    .def("snapshot", &CoroutineSuspendExpr::Snapshot);
+
+  nb::class_<CoroutineSuspendExprSnapshot, ExprSnapshot>(m, "CoroutineSuspendExprSnapshot")
+    .def_ro("keyword_token", &CoroutineSuspendExprSnapshot::keyword_token);
 }
 } // namespace pasta
@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterCoyieldExpr(nb::module_ &m) {
-  nb::class_<CoyieldExpr, CoroutineSuspendExpr>(m, "CoyieldExpr");
+  nb::class_<CoyieldExpr, CoroutineSuspendExpr>(m, "CoyieldExpr")
+    .def("snapshot", &CoyieldExpr::Snapshot);
+
+  nb::class_<CoyieldExprSnapshot, CoroutineSuspendExprSnapshot>(m, "CoyieldExprSnapshot");
 }
 } // namespace pasta
@@ -95,6 +95,57 @@ void RegisterDecl(nb::module_ &m) {
     .def_prop_ro("is_unconditionally_visible", &Decl::IsUnconditionallyVisible)
     .def_prop_ro("is_used", &Decl::IsUsed)
     .def_prop_ro("is_weak_imported", &Decl::IsWeakImported)
-    .def_prop_ro("redeclarations", &Decl::Redeclarations);
+    .def_prop_ro("redeclarations", &Decl::Redeclarations)
+    .def("snapshot", &Decl::Snapshot);
+
+  nb::class_<DeclSnapshot>(m, "DeclSnapshot")
+    .def_ro("access", &DeclSnapshot::access)
+    .def_ro("availability", &DeclSnapshot::availability)
+    .def_ro("begin_token", &DeclSnapshot::begin_token)
+    .def_ro("end_token", &DeclSnapshot::end_token)
+    .def_ro("friend_object_kind", &DeclSnapshot::friend_object_kind)
+    .def_ro("global_id", &DeclSnapshot::global_id)
+    .def_ro("id", &DeclSnapshot::id)
+    .def_ro("identifier_namespace", &DeclSnapshot::identifier_namespace)
+    .def_ro("module_ownership_kind", &DeclSnapshot::module_ownership_kind)
+    .def_ro("owning_module_id", &DeclSnapshot::owning_module_id)
+    .def_ro("template_depth", &DeclSnapshot::template_depth)
+    .def_ro("has_attributes", &DeclSnapshot::has_attributes)
+    .def_ro("has_body", &DeclSnapshot::has_body)
+    .def_ro("has_defining_attribute", &DeclSnapshot::has_defining_attribute)
+    .def_ro("has_owning_module", &DeclSnapshot::has_owning_module)
+    .def_ro("has_tag_identifier_namespace", &DeclSnapshot::has_tag_identifier_namespace)
+    .def_ro("is_canonical_declaration", &DeclSnapshot::is_canonical_declaration)
+    .def_ro("is_defined_outside_function_or_method", &DeclSnapshot::is_defined_outside_function_or_method)
+    .def_ro("is_deprecated", &DeclSnapshot::is_deprecated)
+    .def_ro("is_discarded_in_global_module_fragment", &DeclSnapshot::is_discarded_in_global_module_fragment)
+    .def_ro("is_file_context_declaration", &DeclSnapshot::is_file_context_declaration)
+    .def_ro("is_first_declaration", &DeclSnapshot::is_first_declaration)
+    .def_ro("is_from_ast_file", &DeclSnapshot::is_from_ast_file)
+    .def_ro("is_function_or_function_template", &DeclSnapshot::is_function_or_function_template)
+    .def_ro("is_function_pointer_type", &DeclSnapshot::is_function_pointer_type)
+    .def_ro("is_implicit", &DeclSnapshot::is_implicit)
+    .def_ro("is_in_anonymous_namespace", &DeclSnapshot::is_in_anonymous_namespace)
+    .def_ro("is_in_another_module_unit", &DeclSnapshot::is_in_another_module_unit)
+    .def_ro("is_in_export_declaration_context", &DeclSnapshot::is_in_export_declaration_context)
+    .def_ro("is_in_std_namespace", &DeclSnapshot::is_in_std_namespace)
+    .def_ro("is_invalid_declaration", &DeclSnapshot::is_invalid_declaration)
+    .def_ro("is_invisible_outside_the_owning_module", &DeclSnapshot::is_invisible_outside_the_owning_module)
+    .def_ro("is_local_extern_declaration", &DeclSnapshot::is_local_extern_declaration)
+    .def_ro("is_module_private", &DeclSnapshot::is_module_private)
+    .def_ro("is_out_of_line", &DeclSnapshot::is_out_of_line)
+    .def_ro("is_parameter_pack", &DeclSnapshot::is_parameter_pack)
+    .def_ro("is_reachable", &DeclSnapshot::is_reachable)
+    .def_ro("is_referenced", &DeclSnapshot::is_referenced)
+    .def_ro("is_template_declaration", &DeclSnapshot::is_template_declaration)
+    .def_ro("is_template_parameter", &DeclSnapshot::is_template_parameter)
+    .def_ro("is_template_parameter_pack", &DeclSnapshot::is_template_parameter_pack)
+    .def_ro("is_templated", &DeclSnapshot::is_templated)
+    .def_ro("is_this_declaration_referenced", &DeclSnapshot::is_this_declaration_referenced)
+    .def_ro("is_top_level_declaration_in_obj_c_container", &DeclSnapshot::is_top_level_declaration_in_obj_c_container)
+    .def_ro("is_unavailable", &DeclSnapshot::is_unavailable)
+    .def_ro("is_unconditionally_visible", &DeclSnapshot::is_unconditionally_visible)
+    .def_ro("is_used", &DeclSnapshot::is_used)
+    .def_ro("is_weak_imported", &DeclSnapshot::is_weak_imported);
 }
 } // namespace pasta
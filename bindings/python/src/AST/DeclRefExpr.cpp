@@ -35,6 +35,21 @@ void RegisterDeclRefExpr(nb::module_ &m) {
     .def_prop_ro("has_template_keyword", &DeclRefExpr::HasTemplateKeyword)
     .def_prop_ro("is_immediate_escalating", &DeclRefExpr::IsImmediateEscalating)
     .def_prop_ro("is_non_odr_use", &DeclRefExpr::IsNonOdrUse)
-    .def_prop_ro("refers_to_enclosing_variable_or_capture", &DeclRefExpr::RefersToEnclosingVariableOrCapture);
+    .def_prop_ro("refers_to_enclosing_variable_or_capture", &DeclRefExpr::RefersToEnclosingVariableOrCapture)
+    .def("snapshot", &DeclRefExpr::Snapshot);
+
+  nb::class_<DeclRefExprSnapshot, ExprSnapshot>(m, "DeclRefExprSnapshot")
+    .def_ro("l_angle_token", &DeclRefExprSnapshot::l_angle_token)
+    .def_ro("num_template_arguments", &DeclRefExprSnapshot::num_template_arguments)
+    .def_ro("r_angle_token", &DeclRefExprSnapshot::r_angle_token)
+    .def_ro("template_keyword_token", &DeclRefExprSnapshot::template_keyword_token)
+    .def_ro("had_multiple_candidates", &DeclRefExprSnapshot::had_multiple_candidates)
+    .def_ro("has_explicit_template_arguments", &DeclRefExprSnapshot::has_explicit_template_arguments)
+    .def_ro("has_qualifier", &DeclRefExprSnapshot::has_qualifier)
+    .def_ro("has_template_keyword_and_arguments_info", &DeclRefExprSnapshot::has_template_keyword_and_arguments_info)
+    .def_ro("has_template_keyword", &DeclRefExprSnapshot::has_template_keyword)
+    .def_ro("is_immediate_escalating", &DeclRefExprSnapshot::is_immediate_escalating)
+    .def_ro("is_non_odr_use", &DeclRefExprSnapshot::is_non_odr_use)
+    .def_ro("refers_to_enclosing_variable_or_capture", &DeclRefExprSnapshot::refers_to_enclosing_variable_or_capture);
 }
 } // namespace pasta
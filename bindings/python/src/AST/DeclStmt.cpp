@@ -24,6 +24,10 @@ void RegisterDeclStmt(nb::module_ &m) {
     .def_prop_ro("begin_token", &DeclStmt::BeginToken)
     .def_prop_ro("end_token", &DeclStmt::EndToken)
     .def_prop_ro("single_declaration", &DeclStmt::SingleDeclaration)
-    .def_prop_ro("is_single_declaration", &DeclStmt::IsSingleDeclaration);
+    .def_prop_ro("is_single_declaration", &DeclStmt::IsSingleDeclaration)
+    .def("snapshot", &DeclStmt::Snapshot);
+
+  nb::class_<DeclStmtSnapshot, StmtSnapshot>(m, "DeclStmtSnapshot")
+    .def_ro("is_single_declaration", &DeclStmtSnapshot::is_single_declaration);
 }
 } // namespace pasta
@@ -25,6 +25,14 @@ void RegisterDeclaratorDecl(nb::module_ &m) {
     .def_prop_ro("first_outer_token", &DeclaratorDecl::FirstOuterToken)
     .def_prop_ro("trailing_requires_clause", &DeclaratorDecl::TrailingRequiresClause)
     .def_prop_ro("type_spec_end_token", &DeclaratorDecl::TypeSpecEndToken)
-    .def_prop_ro("type_spec_start_token", &DeclaratorDecl::TypeSpecStartToken);
+    .def_prop_ro("type_spec_start_token", &DeclaratorDecl::TypeSpecStartToken)
+    .def("snapshot", &DeclaratorDecl::Snapshot);
+
+  nb::class_<DeclaratorDeclSnapshot, ValueDeclSnapshot>(m, "DeclaratorDeclSnapshot")
+    .def_ro("first_inner_token", &DeclaratorDeclSnapshot::first_inner_token)
+    .def_ro("num_template_parameter_lists", &DeclaratorDeclSnapshot::num_template_parameter_lists)
+    .def_ro("first_outer_token", &DeclaratorDeclSnapshot::first_outer_token)
+    .def_ro("type_spec_end_token", &DeclaratorDeclSnapshot::type_spec_end_token)
+    .def_ro("type_spec_start_token", &DeclaratorDeclSnapshot::type_spec_start_token);
 }
 } // namespace pasta
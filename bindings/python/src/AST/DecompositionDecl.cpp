@@ -19,6 +19,9 @@ namespace nb = nanobind;
 
 void RegisterDecompositionDecl(nb::module_ &m) {
   nb::class_<DecompositionDecl, VarDecl>(m, "DecompositionDecl")
-    .def_prop_ro("bindings", &DecompositionDecl::Bindings);
+    .def_prop_ro("bindings", &DecompositionDecl::Bindings)
+    .def("snapshot", &DecompositionDecl::Snapshot);
+
+  nb::class_<DecompositionDeclSnapshot, VarDeclSnapshot>(m, "DecompositionDeclSnapshot");
 }
 } // namespace pasta
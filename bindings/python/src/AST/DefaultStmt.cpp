@@ -23,6 +23,10 @@ void RegisterDefaultStmt(nb::module_ &m) {
     .def_prop_ro("begin_token", &DefaultStmt::BeginToken)
     .def_prop_ro("default_token", &DefaultStmt::DefaultToken)
     .def_prop_ro("end_token", &DefaultStmt::EndToken)
-    .def_prop_ro("sub_statement", &DefaultStmt::SubStatement);
+    .def_prop_ro("sub_statement", &DefaultStmt::SubStatement)
+    .def("snapshot", &DefaultStmt::Snapshot);
+
+  nb::class_<DefaultStmtSnapshot, SwitchCaseSnapshot>(m, "DefaultStmtSnapshot")
+    .def_ro("default_token", &DefaultStmtSnapshot::default_token);
 }
 } // namespace pasta
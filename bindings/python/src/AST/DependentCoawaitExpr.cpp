@@ -24,6 +24,10 @@ void RegisterDependentCoawaitExpr(nb::module_ &m) {
     .def_prop_ro("end_token", &DependentCoawaitExpr::EndToken)
     .def_prop_ro("keyword_token", &DependentCoawaitExpr::KeywordToken)
     .def_prop_ro("operand", &DependentCoawaitExpr::Operand)
-    .def_prop_ro("operator_coawait_lookup", &DependentCoawaitExpr::OperatorCoawaitLookup);
+    .def_prop_ro("operator_coawait_lookup", &DependentCoawaitExpr::OperatorCoawaitLookup)
+    .def("snapshot", &DependentCoawaitExpr::Snapshot);
+
+  nb::class_<DependentCoawaitExprSnapshot, ExprSnapshot>(m, "DependentCoawaitExprSnapshot")
+    .def_ro("keyword_token", &DependentCoawaitExprSnapshot::keyword_token);
 }
 } // namespace pasta
@@ -27,6 +27,15 @@ void RegisterDependentScopeDeclRefExpr(nb::module_ &m) {
     .def_prop_ro("r_angle_token", &DependentScopeDeclRefExpr::RAngleToken)
     .def_prop_ro("template_keyword_token", &DependentScopeDeclRefExpr::TemplateKeywordToken)
     .def_prop_ro("has_explicit_template_arguments", &DependentScopeDeclRefExpr::HasExplicitTemplateArguments)
-    .def_prop_ro("has_template_keyword", &DependentScopeDeclRefExpr::HasTemplateKeyword);
+    .def_prop_ro("has_template_keyword", &DependentScopeDeclRefExpr::HasTemplateKeyword)
+    .def("snapshot", &DependentScopeDeclRefExpr::Snapshot);
+
+  nb::class_<DependentScopeDeclRefExprSnapshot, ExprSnapshot>(m, "DependentScopeDeclRefExprSnapshot")
+    .def_ro("l_angle_token", &DependentScopeDeclRefExprSnapshot::l_angle_token)
+    .def_ro("num_template_arguments", &DependentScopeDeclRefExprSnapshot::num_template_arguments)
+    .def_ro("r_angle_token", &DependentScopeDeclRefExprSnapshot::r_angle_token)
+    .def_ro("template_keyword_token", &DependentScopeDeclRefExprSnapshot::template_keyword_token)
+    .def_ro("has_explicit_template_arguments", &DependentScopeDeclRefExprSnapshot::has_explicit_template_arguments)
+    .def_ro("has_template_keyword", &DependentScopeDeclRefExprSnapshot::has_template_keyword);
 }
 } // namespace pasta
@@ -30,6 +30,14 @@ void RegisterDesignatedInitExpr(nb::module_ &m) {
     .def_prop_ro("num_sub_expressions", &DesignatedInitExpr::NumSubExpressions)
     .def_prop_ro("is_direct_initializer", &DesignatedInitExpr::IsDirectInitializer)
     .def_prop_ro("size", &DesignatedInitExpr::Size)
-    .def_prop_ro("uses_gnu_syntax", &DesignatedInitExpr::UsesGNUSyntax);
+    .def_prop_ro("uses_gnu_syntax", &DesignatedInitExpr::UsesGNUSyntax)
+    .def("snapshot", &DesignatedInitExpr::Snapshot);
+
+  nb::class_<DesignatedInitExprSnapshot, ExprSnapshot>(m, "DesignatedInitExprSnapshot")
+    .def_ro("equal_or_colon_token", &DesignatedInitExprSnapshot::equal_or_colon_token)
+    .def_ro("num_sub_expressions", &DesignatedInitExprSnapshot::num_sub_expressions)
+    .def_ro("is_direct_initializer", &DesignatedInitExprSnapshot::is_direct_initializer)
+    .def_ro("size", &DesignatedInitExprSnapshot::size)
+    .def_ro("uses_gnu_syntax", &DesignatedInitExprSnapshot::uses_gnu_syntax);
 }
 } // namespace pasta
@@ -23,6 +23,9 @@ void RegisterDesignatedInitUpdateExpr(nb::module_ &m) {
     .def_prop_ro("base", &DesignatedInitUpdateExpr::Base)
     .def_prop_ro("begin_token", &DesignatedInitUpdateExpr::BeginToken)
     .def_prop_ro("end_token", &DesignatedInitUpdateExpr::EndToken)
-    .def_prop_ro("updater", &DesignatedInitUpdateExpr::Updater);
+    .def_prop_ro("updater", &DesignatedInitUpdateExpr::Updater)
+    .def("snapshot", &DesignatedInitUpdateExpr::Snapshot);
+
+  nb::class_<DesignatedInitUpdateExprSnapshot, ExprSnapshot>(m, "DesignatedInitUpdateExprSnapshot");
 }
 } // namespace pasta
@@ -26,6 +26,12 @@ void RegisterDoStmt(nb::module_ &m) {
     .def_prop_ro("do_token", &DoStmt::DoToken)
     .def_prop_ro("end_token", &DoStmt::EndToken)
     .def_prop_ro("r_paren_token", &DoStmt::RParenToken)
-    .def_prop_ro("while_token", &DoStmt::WhileToken);
+    .def_prop_ro("while_token", &DoStmt::WhileToken)
+    .def("snapshot", &DoStmt::Snapshot);
+
+  nb::class_<DoStmtSnapshot, StmtSnapshot>(m, "DoStmtSnapshot")
+    .def_ro("do_token", &DoStmtSnapshot::do_token)
+    .def_ro("r_paren_token", &DoStmtSnapshot::r_paren_token)
+    .def_ro("while_token", &DoStmtSnapshot::while_token);
 }
 } // namespace pasta
@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterEmptyDecl(nb::module_ &m) {
-  nb::class_<EmptyDecl, Decl>(m, "EmptyDecl");
+  nb::class_<EmptyDecl, Decl>(m, "EmptyDecl")
+    .def("snapshot", &EmptyDecl::Snapshot);
+
+  nb::class_<EmptyDeclSnapshot, DeclSnapshot>(m, "EmptyDeclSnapshot");
 }
 } // namespace pasta
@@ -21,6 +21,9 @@ void RegisterEnumConstantDecl(nb::module_ &m) {
   nb::class_<EnumConstantDecl, ValueDecl>(m, "EnumConstantDecl")
     .def_prop_ro("canonical_declaration", &EnumConstantDecl::CanonicalDeclaration)
     .def_prop_ro("initializer_expression", &EnumConstantDecl::InitializerExpression)
-    .def_prop_ro("initializer_value", &EnumConstantDecl::InitializerValue);
+    .def_prop_ro("initializer_value", &EnumConstantDecl::InitializerValue)
+    .def("snapshot", &EnumConstantDecl::Snapshot);
+
+  nb::class_<EnumConstantDeclSnapshot, ValueDeclSnapshot>(m, "EnumConstantDeclSnapshot");
 }
 } // namespace pasta
@@ -38,6 +38,19 @@ void RegisterEnumDecl(nb::module_ &m) {
     .def_prop_ro("is_complete", &EnumDecl::IsComplete)
     .def_prop_ro("is_fixed", &EnumDecl::IsFixed)
     .def_prop_ro("is_scoped", &EnumDecl::IsScoped)
-    .def_prop_ro("is_scoped_using_class_tag", &EnumDecl::IsScopedUsingClassTag);
+    .def_prop_ro("is_scoped_using_class_tag", &EnumDecl::IsScopedUsingClassTag)
+    .def("snapshot", &EnumDecl::Snapshot);
+
+  nb::class_<EnumDeclSnapshot, TagDeclSnapshot>(m, "EnumDeclSnapshot")
+    .def_ro("num_negative_bits", &EnumDeclSnapshot::num_negative_bits)
+    .def_ro("num_positive_bits", &EnumDeclSnapshot::num_positive_bits)
+    .def_ro("template_specialization_kind", &EnumDeclSnapshot::template_specialization_kind)
+    .def_ro("is_closed", &EnumDeclSnapshot::is_closed)
+    .def_ro("is_closed_flag", &EnumDeclSnapshot::is_closed_flag)
+    .def_ro("is_closed_non_flag", &EnumDeclSnapshot::is_closed_non_flag)
+    .def_ro("is_complete", &EnumDeclSnapshot::is_complete)
+    .def_ro("is_fixed", &EnumDeclSnapshot::is_fixed)
+    .def_ro("is_scoped", &EnumDeclSnapshot::is_scoped)
+    .def_ro("is_scoped_using_class_tag", &EnumDeclSnapshot::is_scoped_using_class_tag);
 }
 } // namespace pasta
@@ -20,6 +20,9 @@ namespace nb = nanobind;
 void RegisterExplicitCastExpr(nb::module_ &m) {
   nb::class_<ExplicitCastExpr, CastExpr>(m, "ExplicitCastExpr")
     .def_prop_ro("type_as_written", &ExplicitCastExpr::TypeAsWritten)
-    .def_prop_ro("type_info_as_written", &ExplicitCastExpr::TypeInfoAsWritten);
+    .def_prop_ro("type_info_as_written", &ExplicitCastExpr::TypeInfoAsWritten)
+    .def("snapshot", &ExplicitCastExpr::Snapshot);
+
+  nb::class_<ExplicitCastExprSnapshot, CastExprSnapshot>(m, "ExplicitCastExprSnapshot");
 }
 } // namespace pasta
@@ -22,6 +22,12 @@ void RegisterExportDecl(nb::module_ &m) {
     .def_prop_ro("end_token", &ExportDecl::EndToken)
     .def_prop_ro("export_token", &ExportDecl::ExportToken)
     .def_prop_ro("r_brace_token", &ExportDecl::RBraceToken)
-    .def_prop_ro("has_braces", &ExportDecl::HasBraces);
+    .def_prop_ro("has_braces", &ExportDecl::HasBraces)
+    .def("snapshot", &ExportDecl::Snapshot);
+
+  nb::class_<ExportDeclSnapshot, DeclSnapshot>(m, "ExportDeclSnapshot")
+    .def_ro("export_token", &ExportDeclSnapshot::export_token)
+    .def_ro("r_brace_token", &ExportDeclSnapshot::r_brace_token)
+    .def_ro("has_braces", &ExportDeclSnapshot::has_braces);
 }
 } // namespace pasta
@@ -71,6 +71,36 @@ void RegisterExpr(nb::module_ &m) {
     .def_prop_ro("refers_to_bit_field", &Expr::RefersToBitField)
     .def_prop_ro("refers_to_global_register_variable", &Expr::RefersToGlobalRegisterVariable)
     .def_prop_ro("refers_to_matrix_element", &Expr::RefersToMatrixElement)
-    .def_prop_ro("refers_to_vector_element", &Expr::RefersToVectorElement);
+    .def_prop_ro("refers_to_vector_element", &Expr::RefersToVectorElement)
+    .def("snapshot", &Expr::Snapshot);
+
+  nb::class_<ExprSnapshot, ValueStmtSnapshot>(m, "ExprSnapshot")
+    .def_ro("classify_l_value", &ExprSnapshot::classify_l_value)
+    .def_ro("has_side_effects", &ExprSnapshot::has_side_effects)
+    .def_ro("contains_errors", &ExprSnapshot::contains_errors)
+    .def_ro("contains_unexpanded_parameter_pack", &ExprSnapshot::contains_unexpanded_parameter_pack)
+    .def_ro("dependence", &ExprSnapshot::dependence)
+    .def_ro("expression_token", &ExprSnapshot::expression_token)
+    .def_ro("object_kind", &ExprSnapshot::object_kind)
+    .def_ro("value_kind", &ExprSnapshot::value_kind)
+    .def_ro("has_non_trivial_call", &ExprSnapshot::has_non_trivial_call)
+    .def_ro("is_bound_member_function", &ExprSnapshot::is_bound_member_function)
+    .def_ro("is_default_argument", &ExprSnapshot::is_default_argument)
+    .def_ro("is_gl_value", &ExprSnapshot::is_gl_value)
+    .def_ro("is_implicit_cxx_this", &ExprSnapshot::is_implicit_cxx_this)
+    .def_ro("is_instantiation_dependent", &ExprSnapshot::is_instantiation_dependent)
+    .def_ro("is_l_value", &ExprSnapshot::is_l_value)
+    .def_ro("is_modifiable_lvalue", &ExprSnapshot::is_modifiable_lvalue)
+    .def_ro("is_objcgc_candidate", &ExprSnapshot::is_objcgc_candidate)
+    .def_ro("is_obj_c_self_expression", &ExprSnapshot::is_obj_c_self_expression)
+    .def_ro("is_ordinary_or_bit_field_object", &ExprSnapshot::is_ordinary_or_bit_field_object)
+    .def_ro("is_pr_value", &ExprSnapshot::is_pr_value)
+    .def_ro("is_type_dependent", &ExprSnapshot::is_type_dependent)
+    .def_ro("is_value_dependent", &ExprSnapshot::is_value_dependent)
+    .def_ro("is_x_value", &ExprSnapshot::is_x_value)
+    .def_ro("refers_to_bit_field", &ExprSnapshot::refers_to_bit_field)
+    .def_ro("refers_to_global_register_variable", &ExprSnapshot::refers_to_global_register_variable)
+    .def_ro("refers_to_matrix_element", &ExprSnapshot::refers_to_matrix_element)
+    .def_ro("refers_to_vector_element", &ExprSnapshot::refers_to_vector_element);
 }
 } // namespace pasta
@@ -23,6 +23,11 @@ void RegisterExprWithCleanups(nb::module_ &m) {
     .def_prop_ro("cleanups_have_side_effects", &ExprWithCleanups::CleanupsHaveSideEffects)
     .def_prop_ro("begin_token", &ExprWithCleanups::BeginToken)
     .def_prop_ro("end_token", &ExprWithCleanups::EndToken)
-    .def_prop_ro("num_objects", &ExprWithCleanups::NumObjects);
+    .def_prop_ro("num_objects", &ExprWithCleanups::NumObjects)
+    .def("snapshot", &ExprWithCleanups::Snapshot);
+
+  nb::class_<ExprWithCleanupsSnapshot, FullExprSnapshot>(m, "ExprWithCleanupsSnapshot")
+    .def_ro("cleanups_have_side_effects", &ExprWithCleanupsSnapshot::cleanups_have_side_effects)
+    .def_ro("num_objects", &ExprWithCleanupsSnapshot::num_objects);
 }
 } // namespace pasta
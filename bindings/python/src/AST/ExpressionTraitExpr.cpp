@@ -24,6 +24,11 @@ void RegisterExpressionTraitExpr(nb::module_ &m) {
     .def_prop_ro("end_token", &ExpressionTraitExpr::EndToken)
     .def_prop_ro("queried_expression", &ExpressionTraitExpr::QueriedExpression)
     .def_prop_ro("trait", &ExpressionTraitExpr::Trait)
-    .def_prop_ro("value", &ExpressionTraitExpr::Value);
+    .def_prop_ro("value", &ExpressionTraitExpr::Value)
+    .def("snapshot", &ExpressionTraitExpr::Snapshot);
+
+  nb::class_<ExpressionTraitExprSnapshot, ExprSnapshot>(m, "ExpressionTraitExprSnapshot")
+    .def_ro("trait", &ExpressionTraitExprSnapshot::trait)
+    .def_ro("value", &ExpressionTraitExprSnapshot::value);
 }
 } // namespace pasta
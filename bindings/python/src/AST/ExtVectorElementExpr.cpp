@@ -26,6 +26,13 @@ void RegisterExtVectorElementExpr(nb::module_ &m) {
     .def_prop_ro("begin_token", &ExtVectorElementExpr::BeginToken)
     .def_prop_ro("end_token", &ExtVectorElementExpr::EndToken)
     .def_prop_ro("num_elements", &ExtVectorElementExpr::NumElements)
-    .def_prop_ro("is_arrow", &ExtVectorElementExpr::IsArrow);
+    .def_prop_ro("is_arrow", &ExtVectorElementExpr::IsArrow)
+    .def("snapshot", &ExtVectorElementExpr::Snapshot);
+
+  nb::class_<ExtVectorElementExprSnapshot, ExprSnapshot>(m, "ExtVectorElementExprSnapshot")
+    .def_ro("contains_duplicate_elements", &ExtVectorElementExprSnapshot::contains_duplicate_elements)
+    .def_ro("accessor_token", &ExtVectorElementExprSnapshot::accessor_token)
+    .def_ro("num_elements", &ExtVectorElementExprSnapshot::num_elements)
+    .def_ro("is_arrow", &ExtVectorElementExprSnapshot::is_arrow);
 }
 } // namespace pasta
@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterExternCContextDecl(nb::module_ &m) {
-  nb::class_<ExternCContextDecl, Decl>(m, "ExternCContextDecl");
+  nb::class_<ExternCContextDecl, Decl>(m, "ExternCContextDecl")
+    .def("snapshot", &ExternCContextDecl::Snapshot);
+
+  nb::class_<ExternCContextDeclSnapshot, DeclSnapshot>(m, "ExternCContextDeclSnapshot");
 }
 } // namespace pasta
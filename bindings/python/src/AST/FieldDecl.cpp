@@ -36,6 +36,22 @@ void RegisterFieldDecl(nb::module_ &m) {
     .def_prop_ro("is_potentially_overlapping", &FieldDecl::IsPotentiallyOverlapping)
     .def_prop_ro("is_unnamed_bitfield", &FieldDecl::IsUnnamedBitfield)
     .def_prop_ro("is_zero_length_bit_field", &FieldDecl::IsZeroLengthBitField)
-    .def_prop_ro("is_zero_size", &FieldDecl::IsZeroSize);
+    .def_prop_ro("is_zero_size", &FieldDecl::IsZeroSize)
+    .def("snapshot", &FieldDecl::Snapshot);
+
+  nb::class_<FieldDeclSnapshot, DeclaratorDeclSnapshot>(m, "FieldDeclSnapshot")
+    .def_ro("bit_width_value", &FieldDeclSnapshot::bit_width_value)
+    .def_ro("field_index", &FieldDeclSnapshot::field_index)
+    .def_ro("in_class_initializer_style", &FieldDeclSnapshot::in_class_initializer_style)
+    .def_ro("has_captured_vla_type", &FieldDeclSnapshot::has_captured_vla_type)
+    .def_ro("has_in_class_initializer", &FieldDeclSnapshot::has_in_class_initializer)
+    .def_ro("has_non_null_in_class_initializer", &FieldDeclSnapshot::has_non_null_in_class_initializer)
+    .def_ro("is_anonymous_struct_or_union", &FieldDeclSnapshot::is_anonymous_struct_or_union)
+    .def_ro("is_bit_field", &FieldDeclSnapshot::is_bit_field)
+    .def_ro("is_mutable", &FieldDeclSnapshot::is_mutable)
+    .def_ro("is_potentially_overlapping", &FieldDeclSnapshot::is_potentially_overlapping)
+    .def_ro("is_unnamed_bitfield", &FieldDeclSnapshot::is_unnamed_bitfield)
+    .def_ro("is_zero_length_bit_field", &FieldDeclSnapshot::is_zero_length_bit_field)
+    .def_ro("is_zero_size", &FieldDeclSnapshot::is_zero_size);
 }
 } // namespace pasta
@@ -21,6 +21,11 @@ void RegisterFileScopeAsmDecl(nb::module_ &m) {
   nb::class_<FileScopeAsmDecl, Decl>(m, "FileScopeAsmDecl")
     .def_prop_ro("assembly_token", &FileScopeAsmDecl::AssemblyToken)
     .def_prop_ro("assembly_string", &FileScopeAsmDecl::AssemblyString)
-    .def_prop_ro("r_paren_token", &FileScopeAsmDecl::RParenToken);
+    .def_prop_ro("r_paren_token", &FileScopeAsmDecl::RParenToken)
+    .def("snapshot", &FileScopeAsmDecl::Snapshot);
+
+  nb::class_<FileScopeAsmDeclSnapshot, DeclSnapshot>(m, "FileScopeAsmDeclSnapshot")
+    .def_ro("assembly_token", &FileScopeAsmDeclSnapshot::assembly_token)
+    .def_ro("r_paren_token", &FileScopeAsmDeclSnapshot::r_paren_token);
 }
 } // namespace pasta
@@ -23,6 +23,11 @@ void RegisterFixedPointLiteral(nb::module_ &m) {
     .def_prop_ro("begin_token", &FixedPointLiteral::BeginToken)
     .def_prop_ro("end_token", &FixedPointLiteral::EndToken)
     .def_prop_ro("token", &FixedPointLiteral::Token)
-    .def_prop_ro("scale", &FixedPointLiteral::Scale);
+    .def_prop_ro("scale", &FixedPointLiteral::Scale)
+    .def("snapshot", &FixedPointLiteral::Snapshot);
+
+  nb::class_<FixedPointLiteralSnapshot, ExprSnapshot>(m, "FixedPointLiteralSnapshot")
+    .def_ro("token", &FixedPointLiteralSnapshot::token)
+    .def_ro("scale", &FixedPointLiteralSnapshot::scale);
 }
 } // namespace pasta
@@ -24,6 +24,12 @@ void RegisterFloatingLiteral(nb::module_ &m) {
     .def_prop_ro("end_token", &FloatingLiteral::EndToken)
     .def_prop_ro("token", &FloatingLiteral::Token)
     .def_prop_ro("value_as_approximate_double", &FloatingLiteral::ValueAsApproximateDouble)
-    .def_prop_ro("is_exact", &FloatingLiteral::IsExact);
+    .def_prop_ro("is_exact", &FloatingLiteral::IsExact)
+    .def("snapshot", &FloatingLiteral::Snapshot);
+
+  nb::class_<FloatingLiteralSnapshot, ExprSnapshot>(m, "FloatingLiteralSnapshot")
+    .def_ro("token", &FloatingLiteralSnapshot::token)
+    .def_ro("value_as_approximate_double", &FloatingLiteralSnapshot::value_as_approximate_double)
+    .def_ro("is_exact", &FloatingLiteralSnapshot::is_exact);
 }
 } // namespace pasta
@@ -30,6 +30,12 @@ void RegisterForStmt(nb::module_ &m) {
     .def_prop_ro("increment", &ForStmt::Increment)
     .def_prop_ro("initializer", &ForStmt::Initializer)
     .def_prop_ro("l_paren_token", &ForStmt::LParenToken)
-    .def_prop_ro("r_paren_token", &ForStmt::RParenToken);
+    .def_prop_ro("r_paren_token", &ForStmt::RParenToken)
+    .def("snapshot", &ForStmt::Snapshot);
+
+  nb::class_<ForStmtSnapshot, StmtSnapshot>(m, "ForStmtSnapshot")
+    .def_ro("for_token", &ForStmtSnapshot::for_token)
+    .def_ro("l_paren_token", &ForStmtSnapshot::l_paren_token)
+    .def_ro("r_paren_token", &ForStmtSnapshot::r_paren_token);
 }
 } // namespace pasta
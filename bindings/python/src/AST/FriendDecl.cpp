@@ -23,6 +23,12 @@ void RegisterFriendDecl(nb::module_ &m) {
     .def_prop_ro("friend_token", &FriendDecl::FriendToken)
     .def_prop_ro("friend_type", &FriendDecl::FriendType)
     .def_prop_ro("friend_type_num_template_parameter_lists", &FriendDecl::FriendTypeNumTemplateParameterLists)
-    .def_prop_ro("is_unsupported_friend", &FriendDecl::IsUnsupportedFriend);
+    .def_prop_ro("is_unsupported_friend", &FriendDecl::IsUnsupportedFriend)
+    .def("snapshot", &FriendDecl::Snapshot);
+
+  nb::class_<FriendDeclSnapshot, DeclSnapshot>(m, "FriendDeclSnapshot")
+    .def_ro("friend_token", &FriendDeclSnapshot::friend_token)
+    .def_ro("friend_type_num_template_parameter_lists", &FriendDeclSnapshot::friend_type_num_template_parameter_lists)
+    .def_ro("is_unsupported_friend", &FriendDeclSnapshot::is_unsupported_friend);
 }
 } // namespace pasta
@@ -22,6 +22,11 @@ void RegisterFriendTemplateDecl(nb::module_ &m) {
     .def_prop_ro("friend_declaration", &FriendTemplateDecl::FriendDeclaration)
     .def_prop_ro("friend_token", &FriendTemplateDecl::FriendToken)
     .def_prop_ro("friend_type", &FriendTemplateDecl::FriendType)
-    .def_prop_ro("num_template_parameters", &FriendTemplateDecl::NumTemplateParameters);
+    .def_prop_ro("num_template_parameters", &FriendTemplateDecl::NumTemplateParameters)
+    .def("snapshot", &FriendTemplateDecl::Snapshot);
+
+  nb::class_<FriendTemplateDeclSnapshot, DeclSnapshot>(m, "FriendTemplateDeclSnapshot")
+    .def_ro("friend_token", &FriendTemplateDeclSnapshot::friend_token)
+    .def_ro("num_template_parameters", &FriendTemplateDeclSnapshot::num_template_parameters);
 }
 } // namespace pasta
@@ -19,6 +19,9 @@ namespace nb = nanobind;
 
 void RegisterFullExpr(nb::module_ &m) {
   nb::class_<FullExpr, Expr>(m, "FullExpr")
-    .def_prop_ro("sub_expression", &FullExpr::SubExpression);
+    .def_prop_ro("sub_expression", &FullExpr::SubExpression)
+    .def("snapshot", &FullExpr::Snapshot);
+
+  nb::class_<FullExprSnapshot, ExprSnapshot>(m, "FullExprSnapshot");
 }
 } // namespace pasta
@@ -107,6 +107,81 @@ void RegisterFunctionDecl(nb::module_ &m) {
     .def_prop_ro("parameters", &FunctionDecl::Parameters)
     .def_prop_ro("uses_seh_try", &FunctionDecl::UsesSEHTry)
     .def_prop_ro("will_have_body", &FunctionDecl::WillHaveBody)
-    .def_prop_ro("body", &FunctionDecl::Body);
+    .def_prop_ro("body", &FunctionDecl::Body)
+    .def("snapshot", &FunctionDecl::Snapshot);
+
+  nb::class_<FunctionDeclSnapshot, DeclaratorDeclSnapshot>(m, "FunctionDeclSnapshot")
+    .def_ro("body_contains_immediate_escalating_expressions", &FunctionDeclSnapshot::body_contains_immediate_escalating_expressions)
+    .def_ro("friend_constraint_refers_to_enclosing_template", &FunctionDeclSnapshot::friend_constraint_refers_to_enclosing_template)
+    .def_ro("uses_fp_intrin", &FunctionDeclSnapshot::uses_fp_intrin)
+    .def_ro("does_this_declaration_have_a_body", &FunctionDeclSnapshot::does_this_declaration_have_a_body)
+    .def_ro("builtin_id", &FunctionDeclSnapshot::builtin_id)
+    .def_ro("constexpr_kind", &FunctionDeclSnapshot::constexpr_kind)
+    .def_ro("default_token", &FunctionDeclSnapshot::default_token)
+    .def_ro("ellipsis_token", &FunctionDeclSnapshot::ellipsis_token)
+    .def_ro("exception_spec_type", &FunctionDeclSnapshot::exception_spec_type)
+    .def_ro("language_linkage", &FunctionDeclSnapshot::language_linkage)
+    .def_ro("memory_function_kind", &FunctionDeclSnapshot::memory_function_kind)
+    .def_ro("min_required_arguments", &FunctionDeclSnapshot::min_required_arguments)
+    .def_ro("multi_version_kind", &FunctionDeclSnapshot::multi_version_kind)
+    .def_ro("num_parameters", &FunctionDeclSnapshot::num_parameters)
+    .def_ro("overloaded_operator", &FunctionDeclSnapshot::overloaded_operator)
+    .def_ro("point_of_instantiation", &FunctionDeclSnapshot::point_of_instantiation)
+    .def_ro("storage_class", &FunctionDeclSnapshot::storage_class)
+    .def_ro("template_specialization_kind", &FunctionDeclSnapshot::template_specialization_kind)
+    .def_ro("template_specialization_kind_for_instantiation", &FunctionDeclSnapshot::template_specialization_kind_for_instantiation)
+    .def_ro("templated_kind", &FunctionDeclSnapshot::templated_kind)
+    .def_ro("has_implicit_return_zero", &FunctionDeclSnapshot::has_implicit_return_zero)
+    .def_ro("has_inherited_prototype", &FunctionDeclSnapshot::has_inherited_prototype)
+    .def_ro("has_one_parameter_or_default_arguments", &FunctionDeclSnapshot::has_one_parameter_or_default_arguments)
+    .def_ro("has_prototype", &FunctionDeclSnapshot::has_prototype)
+    .def_ro("has_skipped_body", &FunctionDeclSnapshot::has_skipped_body)
+    .def_ro("has_trivial_body", &FunctionDeclSnapshot::has_trivial_body)
+    .def_ro("has_written_prototype", &FunctionDeclSnapshot::has_written_prototype)
+    .def_ro("instantiation_is_pending", &FunctionDeclSnapshot::instantiation_is_pending)
+    .def_ro("is_cpu_dispatch_multi_version", &FunctionDeclSnapshot::is_cpu_dispatch_multi_version)
+    .def_ro("is_cpu_specific_multi_version", &FunctionDeclSnapshot::is_cpu_specific_multi_version)
+    .def_ro("is_consteval", &FunctionDeclSnapshot::is_consteval)
+    .def_ro("is_constexpr", &FunctionDeclSnapshot::is_constexpr)
+    .def_ro("is_constexpr_specified", &FunctionDeclSnapshot::is_constexpr_specified)
+    .def_ro("is_defaulted", &FunctionDeclSnapshot::is_defaulted)
+    .def_ro("is_deleted", &FunctionDeclSnapshot::is_deleted)
+    .def_ro("is_deleted_as_written", &FunctionDeclSnapshot::is_deleted_as_written)
+    .def_ro("is_destroying_operator_delete", &FunctionDeclSnapshot::is_destroying_operator_delete)
+    .def_ro("is_explicitly_defaulted", &FunctionDeclSnapshot::is_explicitly_defaulted)
+    .def_ro("is_extern_c", &FunctionDeclSnapshot::is_extern_c)
+    .def_ro("is_function_template_specialization", &FunctionDeclSnapshot::is_function_template_specialization)
+    .def_ro("is_global", &FunctionDeclSnapshot::is_global)
+    .def_ro("is_immediate_escalating", &FunctionDeclSnapshot::is_immediate_escalating)
+    .def_ro("is_immediate_function", &FunctionDeclSnapshot::is_immediate_function)
+    .def_ro("is_implicitly_instantiable", &FunctionDeclSnapshot::is_implicitly_instantiable)
+    .def_ro("is_in_extern_c_context", &FunctionDeclSnapshot::is_in_extern_c_context)
+    .def_ro("is_in_extern_cxx_context", &FunctionDeclSnapshot::is_in_extern_cxx_context)
+    .def_ro("is_ineligible_or_not_selected", &FunctionDeclSnapshot::is_ineligible_or_not_selected)
+    .def_ro("is_inline_builtin_declaration", &FunctionDeclSnapshot::is_inline_builtin_declaration)
+    .def_ro("is_inline_specified", &FunctionDeclSnapshot::is_inline_specified)
+    .def_ro("is_inlined", &FunctionDeclSnapshot::is_inlined)
+    .def_ro("is_late_template_parsed", &FunctionDeclSnapshot::is_late_template_parsed)
+    .def_ro("is_msvcrt_entry_point", &FunctionDeclSnapshot::is_msvcrt_entry_point)
+    .def_ro("is_main", &FunctionDeclSnapshot::is_main)
+    .def_ro("is_member_like_constrained_friend", &FunctionDeclSnapshot::is_member_like_constrained_friend)
+    .def_ro("is_multi_version", &FunctionDeclSnapshot::is_multi_version)
+    .def_ro("is_no_return", &FunctionDeclSnapshot::is_no_return)
+    .def_ro("is_overloaded_operator", &FunctionDeclSnapshot::is_overloaded_operator)
+    .def_ro("is_pure", &FunctionDeclSnapshot::is_pure)
+    .def_ro("is_replaceable_global_allocation_function", &FunctionDeclSnapshot::is_replaceable_global_allocation_function)
+    .def_ro("is_static", &FunctionDeclSnapshot::is_static)
+    .def_ro("is_target_clones_multi_version", &FunctionDeclSnapshot::is_target_clones_multi_version)
+    .def_ro("is_target_multi_version", &FunctionDeclSnapshot::is_target_multi_version)
+    .def_ro("is_template_instantiation", &FunctionDeclSnapshot::is_template_instantiation)
+    .def_ro("is_this_declaration_a_definition", &FunctionDeclSnapshot::is_this_declaration_a_definition)
+    .def_ro("is_this_declaration_instantiated_from_a_friend_definition", &FunctionDeclSnapshot::is_this_declaration_instantiated_from_a_friend_definition)
+    .def_ro("is_trivial", &FunctionDeclSnapshot::is_trivial)
+    .def_ro("is_trivial_for_call", &FunctionDeclSnapshot::is_trivial_for_call)
+    .def_ro("is_user_provided", &FunctionDeclSnapshot::is_user_provided)
+    .def_ro("is_variadic", &FunctionDeclSnapshot::is_variadic)
+    .def_ro("is_virtual_as_written", &FunctionDeclSnapshot::is_virtual_as_written)
+    .def_ro("uses_seh_try", &FunctionDeclSnapshot::uses_seh_try)
+    .def_ro("will_have_body", &FunctionDeclSnapshot::will_have_body);
 }
 } // namespace pasta
@@ -24,6 +24,11 @@ void RegisterFunctionParmPackExpr(nb::module_ &m) {
     .def_prop_ro("end_token", &FunctionParmPackExpr::EndToken)
     .def_prop_ro("num_expansions", &FunctionParmPackExpr::NumExpansions)
     .def_prop_ro("parameter_pack", &FunctionParmPackExpr::ParameterPack)
-    .def_prop_ro("parameter_pack_token", &FunctionParmPackExpr::ParameterPackToken);
+    .def_prop_ro("parameter_pack_token", &FunctionParmPackExpr::ParameterPackToken)
+    .def("snapshot", &FunctionParmPackExpr::Snapshot);
+
+  nb::class_<FunctionParmPackExprSnapshot, ExprSnapshot>(m, "FunctionParmPackExprSnapshot")
+    .def_ro("num_expansions", &FunctionParmPackExprSnapshot::num_expansions)
+    .def_ro("parameter_pack_token", &FunctionParmPackExprSnapshot::parameter_pack_token);
 }
 } // namespace pasta
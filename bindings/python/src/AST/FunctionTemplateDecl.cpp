@@ -26,6 +26,11 @@ void RegisterFunctionTemplateDecl(nb::module_ &m) {
     .def_prop_ro("templated_declaration", &FunctionTemplateDecl::TemplatedDeclaration)
     .def_prop_ro("is_abbreviated", &FunctionTemplateDecl::IsAbbreviated)
     .def_prop_ro("is_this_declaration_a_definition", &FunctionTemplateDecl::IsThisDeclarationADefinition)
-    .def_prop_ro("specializations", &FunctionTemplateDecl::Specializations);
+    .def_prop_ro("specializations", &FunctionTemplateDecl::Specializations)
+    .def("snapshot", &FunctionTemplateDecl::Snapshot);
+
+  nb::class_<FunctionTemplateDeclSnapshot, RedeclarableTemplateDeclSnapshot>(m, "FunctionTemplateDeclSnapshot")
+    .def_ro("is_abbreviated", &FunctionTemplateDeclSnapshot::is_abbreviated)
+    .def_ro("is_this_declaration_a_definition", &FunctionTemplateDeclSnapshot::is_this_declaration_a_definition);
 }
 } // namespace pasta
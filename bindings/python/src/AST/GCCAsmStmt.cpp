@@ -26,6 +26,12 @@ void RegisterGCCAsmStmt(nb::module_ &m) {
     .def_prop_ro("num_labels", &GCCAsmStmt::NumLabels)
     .def_prop_ro("r_paren_token", &GCCAsmStmt::RParenToken)
     .def_prop_ro("is_assembly_goto", &GCCAsmStmt::IsAssemblyGoto)
-    .def_prop_ro("labels", &GCCAsmStmt::Labels);
+    .def_prop_ro("labels", &GCCAsmStmt::Labels)
+    .def("snapshot", &GCCAsmStmt::Snapshot);
+
+  nb::class_<GCCAsmStmtSnapshot, AsmStmtSnapshot>(m, "GCCAsmStmtSnapshot")
+    .def_ro("num_labels", &GCCAsmStmtSnapshot::num_labels)
+    .def_ro("r_paren_token", &GCCAsmStmtSnapshot::r_paren_token)
+    .def_ro("is_assembly_goto", &GCCAsmStmtSnapshot::is_assembly_goto);
 }
 } // namespace pasta
@@ -22,6 +22,10 @@ void RegisterGNUNullExpr(nb::module_ &m) {
     .def_prop_ro("children", &GNUNullExpr::Children)
     .def_prop_ro("begin_token", &GNUNullExpr::BeginToken)
     .def_prop_ro("end_token", &GNUNullExpr::EndToken)
-    .def_prop_ro("token_token", &GNUNullExpr::TokenToken);
+    .def_prop_ro("token_token", &GNUNullExpr::TokenToken)
+    .def("snapshot", &GNUNullExpr::Snapshot);
+
+  nb::class_<GNUNullExprSnapshot, ExprSnapshot>(m, "GNUNullExprSnapshot")
+    .def_ro("token_token", &GNUNullExprSnapshot::token_token);
 }
 } // namespace pasta
@@ -33,6 +33,17 @@ void RegisterGenericSelectionExpr(nb::module_ &m) {
     .def_prop_ro("result_index", &GenericSelectionExpr::ResultIndex)
     .def_prop_ro("is_expression_predicate", &GenericSelectionExpr::IsExpressionPredicate)
     .def_prop_ro("is_result_dependent", &GenericSelectionExpr::IsResultDependent)
-    .def_prop_ro("is_type_predicate", &GenericSelectionExpr::IsTypePredicate);
+    .def_prop_ro("is_type_predicate", &GenericSelectionExpr::IsTypePredicate)
+    .def("snapshot", &GenericSelectionExpr::Snapshot);
+
+  nb::class_<GenericSelectionExprSnapshot, ExprSnapshot>(m, "GenericSelectionExprSnapshot")
+    .def_ro("default_token", &GenericSelectionExprSnapshot::default_token)
+    .def_ro("generic_token", &GenericSelectionExprSnapshot::generic_token)
+    .def_ro("num_associations", &GenericSelectionExprSnapshot::num_associations)
+    .def_ro("r_paren_token", &GenericSelectionExprSnapshot::r_paren_token)
+    .def_ro("result_index", &GenericSelectionExprSnapshot::result_index)
+    .def_ro("is_expression_predicate", &GenericSelectionExprSnapshot::is_expression_predicate)
+    .def_ro("is_result_dependent", &GenericSelectionExprSnapshot::is_result_dependent)
+    .def_ro("is_type_predicate", &GenericSelectionExprSnapshot::is_type_predicate);
 }
 } // namespace pasta
@@ -24,6 +24,11 @@ void RegisterGotoStmt(nb::module_ &m) {
     .def_prop_ro("end_token", &GotoStmt::EndToken)
     .def_prop_ro("goto_token", &GotoStmt::GotoToken)
     .def_prop_ro("label", &GotoStmt::Label)
-    .def_prop_ro("label_token", &GotoStmt::LabelToken);
+    .def_prop_ro("label_token", &GotoStmt::LabelToken)
+    .def("snapshot", &GotoStmt::Snapshot);
+
+  nb::class_<GotoStmtSnapshot, StmtSnapshot>(m, "GotoStmtSnapshot")
+    .def_ro("goto_token", &GotoStmtSnapshot::goto_token)
+    .def_ro("label_token", &GotoStmtSnapshot::label_token);
 }
 } // namespace pasta
@@ -22,6 +22,13 @@ void RegisterHLSLBufferDecl(nb::module_ &m) {
     .def_prop_ro("l_brace_token", &HLSLBufferDecl::LBraceToken)
     .def_prop_ro("token_start", &HLSLBufferDecl::TokenStart)
     .def_prop_ro("r_brace_token", &HLSLBufferDecl::RBraceToken)
-    .def_prop_ro("is_c_buffer", &HLSLBufferDecl::IsCBuffer);
+    .def_prop_ro("is_c_buffer", &HLSLBufferDecl::IsCBuffer)
+    .def("snapshot", &HLSLBufferDecl::Snapshot);
+
+  nb::class_<HLSLBufferDeclSnapshot, NamedDeclSnapshot>(m, "HLSLBufferDeclSnapshot")
+    .def_ro("l_brace_token", &HLSLBufferDeclSnapshot::l_brace_token)
+    .def_ro("token_start", &HLSLBufferDeclSnapshot::token_start)
+    .def_ro("r_brace_token", &HLSLBufferDeclSnapshot::r_brace_token)
+    .def_ro("is_c_buffer", &HLSLBufferDeclSnapshot::is_c_buffer);
 }
 } // namespace pasta
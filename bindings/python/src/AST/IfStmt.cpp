@@ -41,6 +41,22 @@ void RegisterIfStmt(nb::module_ &m) {
     .def_prop_ro("is_constexpr", &IfStmt::IsConstexpr)
     .def_prop_ro("is_negated_consteval", &IfStmt::IsNegatedConsteval)
     .def_prop_ro("is_non_negated_consteval", &IfStmt::IsNonNegatedConsteval)
-    .def_prop_ro("is_obj_c_availability_check", &IfStmt::IsObjCAvailabilityCheck);
+    .def_prop_ro("is_obj_c_availability_check", &IfStmt::IsObjCAvailabilityCheck)
+    .def("snapshot", &IfStmt::Snapshot);
+
+  nb::class_<IfStmtSnapshot, StmtSnapshot>(m, "IfStmtSnapshot")
+    .def_ro("else_token", &IfStmtSnapshot::else_token)
+    .def_ro("if_token", &IfStmtSnapshot::if_token)
+    .def_ro("l_paren_token", &IfStmtSnapshot::l_paren_token)
+    .def_ro("r_paren_token", &IfStmtSnapshot::r_paren_token)
+    .def_ro("statement_kind", &IfStmtSnapshot::statement_kind)
+    .def_ro("has_else_storage", &IfStmtSnapshot::has_else_storage)
+    .def_ro("has_initializer_storage", &IfStmtSnapshot::has_initializer_storage)
+    .def_ro("has_variable_storage", &IfStmtSnapshot::has_variable_storage)
+    .def_ro("is_consteval", &IfStmtSnapshot::is_consteval)
+    .def_ro("is_constexpr", &IfStmtSnapshot::is_constexpr)
+    .def_ro("is_negated_consteval", &IfStmtSnapshot::is_negated_consteval)
+    .def_ro("is_non_negated_consteval", &IfStmtSnapshot::is_non_negated_consteval)
+    .def_ro("is_obj_c_availability_check", &IfStmtSnapshot::is_obj_c_availability_check);
 }
 } // namespace pasta
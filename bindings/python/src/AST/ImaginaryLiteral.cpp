@@ -22,6 +22,9 @@ void RegisterImaginaryLiteral(nb::module_ &m) {
     .def_prop_ro("children", &ImaginaryLiteral::Children)
     .def_prop_ro("begin_token", &ImaginaryLiteral::BeginToken)
     .def_prop_ro("end_token", &ImaginaryLiteral::EndToken)
-    .def_prop_ro("sub_expression", &ImaginaryLiteral::SubExpression);
+    .def_prop_ro("sub_expression", &ImaginaryLiteral::SubExpression)
+    .def("snapshot", &ImaginaryLiteral::Snapshot);
+
+  nb::class_<ImaginaryLiteralSnapshot, ExprSnapshot>(m, "ImaginaryLiteralSnapshot");
 }
 } // namespace pasta
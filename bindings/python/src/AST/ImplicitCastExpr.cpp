@@ -21,6 +21,10 @@ void RegisterImplicitCastExpr(nb::module_ &m) {
   nb::class_<ImplicitCastExpr, CastExpr>(m, "ImplicitCastExpr")
     .def_prop_ro("begin_token", &ImplicitCastExpr::BeginToken)
     .def_prop_ro("end_token", &ImplicitCastExpr::EndToken)
-    .def_prop_ro("is_part_of_explicit_cast", &ImplicitCastExpr::IsPartOfExplicitCast);
+    .def_prop_ro("is_part_of_explicit_cast", &ImplicitCastExpr::IsPartOfExplicitCast)
+    .def("snapshot", &ImplicitCastExpr::Snapshot);
+
+  nb::class_<ImplicitCastExprSnapshot, CastExprSnapshot>(m, "ImplicitCastExprSnapshot")
+    .def_ro("is_part_of_explicit_cast", &ImplicitCastExprSnapshot::is_part_of_explicit_cast);
 }
 } // namespace pasta
@@ -19,6 +19,9 @@ namespace nb = nanobind;
 
 void RegisterImplicitConceptSpecializationDecl(nb::module_ &m) {
   nb::class_<ImplicitConceptSpecializationDecl, Decl>(m, "ImplicitConceptSpecializationDecl")
-    .def_prop_ro("template_arguments", &ImplicitConceptSpecializationDecl::TemplateArguments);
+    .def_prop_ro("template_arguments", &ImplicitConceptSpecializationDecl::TemplateArguments)
+    .def("snapshot", &ImplicitConceptSpecializationDecl::Snapshot);
+
+  nb::class_<ImplicitConceptSpecializationDeclSnapshot, DeclSnapshot>(m, "ImplicitConceptSpecializationDeclSnapshot");
 }
 } // namespace pasta
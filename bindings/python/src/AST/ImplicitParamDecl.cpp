@@ -19,6 +19,10 @@ namespace nb = nanobind;
 
 void RegisterImplicitParamDecl(nb::module_ &m) {
   nb::class_<ImplicitParamDecl, VarDecl>(m, "ImplicitParamDecl")
-    .def_prop_ro("parameter_kind", &ImplicitParamDecl::ParameterKind);
+    .def_prop_ro("parameter_kind", &ImplicitParamDecl::ParameterKind)
+    .def("snapshot", &ImplicitParamDecl::Snapshot);
+
+  nb::class_<ImplicitParamDeclSnapshot, VarDeclSnapshot>(m, "ImplicitParamDeclSnapshot")
+    .def_ro("parameter_kind", &ImplicitParamDeclSnapshot::parameter_kind);
 }
 } // namespace pasta
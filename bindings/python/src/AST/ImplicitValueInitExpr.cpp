@@ -21,6 +21,9 @@ void RegisterImplicitValueInitExpr(nb::module_ &m) {
   nb::class_<ImplicitValueInitExpr, Expr>(m, "ImplicitValueInitExpr")
     .def_prop_ro("children", &ImplicitValueInitExpr::Children)
     .def_prop_ro("begin_token", &ImplicitValueInitExpr::BeginToken)
-    .def_prop_ro("end_token", &ImplicitValueInitExpr::EndToken);
+    .def_prop_ro("end_token", &ImplicitValueInitExpr::EndToken)
+    .def("snapshot", &ImplicitValueInitExpr::Snapshot);
+
+  nb::class_<ImplicitValueInitExprSnapshot, ExprSnapshot>(m, "ImplicitValueInitExprSnapshot");
 }
 } // namespace pasta
@@ -19,6 +19,9 @@ namespace nb = nanobind;
 
 void RegisterImportDecl(nb::module_ &m) {
   nb::class_<ImportDecl, Decl>(m, "ImportDecl")
-    .def_prop_ro("identifier_tokens", &ImportDecl::IdentifierTokens);
+    .def_prop_ro("identifier_tokens", &ImportDecl::IdentifierTokens)
+    .def("snapshot", &ImportDecl::Snapshot);
+
+  nb::class_<ImportDeclSnapshot, DeclSnapshot>(m, "ImportDeclSnapshot");
 }
 } // namespace pasta
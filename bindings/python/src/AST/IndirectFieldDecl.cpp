@@ -23,6 +23,10 @@ void RegisterIndirectFieldDecl(nb::module_ &m) {
     .def_prop_ro("anonymous_field", &IndirectFieldDecl::AnonymousField)
     .def_prop_ro("canonical_declaration", &IndirectFieldDecl::CanonicalDeclaration)
     .def_prop_ro("chaining_size", &IndirectFieldDecl::ChainingSize)
-    .def_prop_ro("variable_declaration", &IndirectFieldDecl::VariableDeclaration);
+    .def_prop_ro("variable_declaration", &IndirectFieldDecl::VariableDeclaration)
+    .def("snapshot", &IndirectFieldDecl::Snapshot);
+
+  nb::class_<IndirectFieldDeclSnapshot, ValueDeclSnapshot>(m, "IndirectFieldDeclSnapshot")
+    .def_ro("chaining_size", &IndirectFieldDeclSnapshot::chaining_size);
 }
 } // namespace pasta
@@ -25,6 +25,11 @@ void RegisterIndirectGotoStmt(nb::module_ &m) {
     .def_prop_ro("end_token", &IndirectGotoStmt::EndToken)
     .def_prop_ro("goto_token", &IndirectGotoStmt::GotoToken)
     .def_prop_ro("star_token", &IndirectGotoStmt::StarToken)
-    .def_prop_ro("target", &IndirectGotoStmt::Target);
+    .def_prop_ro("target", &IndirectGotoStmt::Target)
+    .def("snapshot", &IndirectGotoStmt::Snapshot);
+
+  nb::class_<IndirectGotoStmtSnapshot, StmtSnapshot>(m, "IndirectGotoStmtSnapshot")
+    .def_ro("goto_token", &IndirectGotoStmtSnapshot::goto_token)
+    .def_ro("star_token", &IndirectGotoStmtSnapshot::star_token);
 }
 } // namespace pasta
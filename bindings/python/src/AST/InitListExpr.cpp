@@ -37,6 +37,19 @@ void RegisterInitListExpr(nb::module_ &m) {
     .def_prop_ro("is_semantic_form", &InitListExpr::IsSemanticForm)
     .def_prop_ro("is_string_literal_initializer", &InitListExpr::IsStringLiteralInitializer)
     .def_prop_ro("is_syntactic_form", &InitListExpr::IsSyntacticForm)
-    .def_prop_ro("is_transparent", &InitListExpr::IsTransparent);
+    .def_prop_ro("is_transparent", &InitListExpr::IsTransparent)
+    .def("snapshot", &InitListExpr::Snapshot);
+
+  nb::class_<InitListExprSnapshot, ExprSnapshot>(m, "InitListExprSnapshot")
+    .def_ro("l_brace_token", &InitListExprSnapshot::l_brace_token)
+    .def_ro("num_initializers", &InitListExprSnapshot::num_initializers)
+    .def_ro("r_brace_token", &InitListExprSnapshot::r_brace_token)
+    .def_ro("had_array_range_designator", &InitListExprSnapshot::had_array_range_designator)
+    .def_ro("has_array_filler", &InitListExprSnapshot::has_array_filler)
+    .def_ro("has_designated_initializer", &InitListExprSnapshot::has_designated_initializer)
+    .def_ro("is_explicit", &InitListExprSnapshot::is_explicit)
+    .def_ro("is_semantic_form", &InitListExprSnapshot::is_semantic_form)
+    .def_ro("is_string_literal_initializer", &InitListExprSnapshot::is_string_literal_initializer)
+    .def_ro("is_syntactic_form", &InitListExprSnapshot::is_syntactic_form);
 }
 } // namespace pasta
@@ -22,6 +22,10 @@ void RegisterIntegerLiteral(nb::module_ &m) {
     .def_prop_ro("children", &IntegerLiteral::Children)
     .def_prop_ro("begin_token", &IntegerLiteral::BeginToken)
     .def_prop_ro("end_token", &IntegerLiteral::EndToken)
-    .def_prop_ro("token", &IntegerLiteral::Token);
+    .def_prop_ro("token", &IntegerLiteral::Token)
+    .def("snapshot", &IntegerLiteral::Snapshot);
+
+  nb::class_<IntegerLiteralSnapshot, ExprSnapshot>(m, "IntegerLiteralSnapshot")
+    .def_ro("token", &IntegerLiteralSnapshot::token);
 }
 } // namespace pasta
@@ -23,6 +23,12 @@ void RegisterLabelDecl(nb::module_ &m) {
     .def_prop_ro("statement", &LabelDecl::Statement)
     .def_prop_ro("is_gnu_local", &LabelDecl::IsGnuLocal)
     .def_prop_ro("is_ms_assembly_label", &LabelDecl::IsMSAssemblyLabel)
-    .def_prop_ro("is_resolved_ms_assembly_label", &LabelDecl::IsResolvedMSAssemblyLabel);
+    .def_prop_ro("is_resolved_ms_assembly_label", &LabelDecl::IsResolvedMSAssemblyLabel)
+    .def("snapshot", &LabelDecl::Snapshot);
+
+  nb::class_<LabelDeclSnapshot, NamedDeclSnapshot>(m, "LabelDeclSnapshot")
+    .def_ro("is_gnu_local", &LabelDeclSnapshot::is_gnu_local)
+    .def_ro("is_ms_assembly_label", &LabelDeclSnapshot::is_ms_assembly_label)
+    .def_ro("is_resolved_ms_assembly_label", &LabelDeclSnapshot::is_resolved_ms_assembly_label);
 }
 } // namespace pasta
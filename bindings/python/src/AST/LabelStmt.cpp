@@ -26,6 +26,11 @@ void RegisterLabelStmt(nb::module_ &m) {
     .def_prop_ro("identifier_token", &LabelStmt::IdentifierToken)
     .def_prop_ro("name", &LabelStmt::Name)
     .def_prop_ro("sub_statement", &LabelStmt::SubStatement)
-    .def_prop_ro("is_side_entry", &LabelStmt::IsSideEntry);
+    .def_prop_ro("is_side_entry", &LabelStmt::IsSideEntry)
+    .def("snapshot", &LabelStmt::Snapshot);
+
+  nb::class_<LabelStmtSnapshot, ValueStmtSnapshot>(m, "LabelStmtSnapshot")
+    .def_ro("identifier_token", &LabelStmtSnapshot::identifier_token)
+    .def_ro("is_side_entry", &LabelStmtSnapshot::is_side_entry);
 }
 } // namespace pasta
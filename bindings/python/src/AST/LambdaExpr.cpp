@@ -36,6 +36,15 @@ void RegisterLambdaExpr(nb::module_ &m) {
     .def_prop_ro("has_explicit_parameters", &LambdaExpr::HasExplicitParameters)
     .def_prop_ro("has_explicit_result_type", &LambdaExpr::HasExplicitResultType)
     .def_prop_ro("is_generic_lambda", &LambdaExpr::IsGenericLambda)
-    .def_prop_ro("is_mutable", &LambdaExpr::IsMutable);
+    .def_prop_ro("is_mutable", &LambdaExpr::IsMutable)
+    .def("snapshot", &LambdaExpr::Snapshot);
+
+  nb::class_<LambdaExprSnapshot, ExprSnapshot>(m, "LambdaExprSnapshot")
+    .def_ro("capture_default", &LambdaExprSnapshot::capture_default)
+    .def_ro("capture_default_token", &LambdaExprSnapshot::capture_default_token)
+    .def_ro("has_explicit_parameters", &LambdaExprSnapshot::has_explicit_parameters)
+    .def_ro("has_explicit_result_type", &LambdaExprSnapshot::has_explicit_result_type)
+    .def_ro("is_generic_lambda", &LambdaExprSnapshot::is_generic_lambda)
+    .def_ro("is_mutable", &LambdaExprSnapshot::is_mutable);
 }
 } // namespace pasta
@@ -23,6 +23,11 @@ void RegisterLifetimeExtendedTemporaryDecl(nb::module_ &m) {
     .def_prop_ro("extending_declaration", &LifetimeExtendedTemporaryDecl::ExtendingDeclaration)
     .def_prop_ro("mangling_number", &LifetimeExtendedTemporaryDecl::ManglingNumber)
     .def_prop_ro("storage_duration", &LifetimeExtendedTemporaryDecl::StorageDuration)
-    .def_prop_ro("temporary_expression", &LifetimeExtendedTemporaryDecl::TemporaryExpression);
+    .def_prop_ro("temporary_expression", &LifetimeExtendedTemporaryDecl::TemporaryExpression)
+    .def("snapshot", &LifetimeExtendedTemporaryDecl::Snapshot);
+
+  nb::class_<LifetimeExtendedTemporaryDeclSnapshot, DeclSnapshot>(m, "LifetimeExtendedTemporaryDeclSnapshot")
+    .def_ro("mangling_number", &LifetimeExtendedTemporaryDeclSnapshot::mangling_number)
+    .def_ro("storage_duration", &LifetimeExtendedTemporaryDeclSnapshot::storage_duration);
 }
 } // namespace pasta
@@ -23,6 +23,13 @@ void RegisterLinkageSpecDecl(nb::module_ &m) {
     .def_prop_ro("extern_token", &LinkageSpecDecl::ExternToken)
     .def_prop_ro("language", &LinkageSpecDecl::Language)
     .def_prop_ro("r_brace_token", &LinkageSpecDecl::RBraceToken)
-    .def_prop_ro("has_braces", &LinkageSpecDecl::HasBraces);
+    .def_prop_ro("has_braces", &LinkageSpecDecl::HasBraces)
+    .def("snapshot", &LinkageSpecDecl::Snapshot);
+
+  nb::class_<LinkageSpecDeclSnapshot, DeclSnapshot>(m, "LinkageSpecDeclSnapshot")
+    .def_ro("extern_token", &LinkageSpecDeclSnapshot::extern_token)
+    .def_ro("language", &LinkageSpecDeclSnapshot::language)
+    .def_ro("r_brace_token", &LinkageSpecDeclSnapshot::r_brace_token)
+    .def_ro("has_braces", &LinkageSpecDeclSnapshot::has_braces);
 }
 } // namespace pasta
@@ -28,6 +28,11 @@ void RegisterMSAsmStmt(nb::module_ &m) {
     .def_prop_ro("clobbers", &MSAsmStmt::Clobbers)
     .def_prop_ro("end_token", &MSAsmStmt::EndToken)
     .def_prop_ro("l_brace_token", &MSAsmStmt::LBraceToken)
-    .def_prop_ro("has_braces", &MSAsmStmt::HasBraces);
+    .def_prop_ro("has_braces", &MSAsmStmt::HasBraces)
+    .def("snapshot", &MSAsmStmt::Snapshot);
+
+  nb::class_<MSAsmStmtSnapshot, AsmStmtSnapshot>(m, "MSAsmStmtSnapshot")
+    .def_ro("l_brace_token", &MSAsmStmtSnapshot::l_brace_token)
+    .def_ro("has_braces", &MSAsmStmtSnapshot::has_braces);
 }
 } // namespace pasta
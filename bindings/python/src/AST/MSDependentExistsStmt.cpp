@@ -25,6 +25,12 @@ void RegisterMSDependentExistsStmt(nb::module_ &m) {
     .def_prop_ro("keyword_token", &MSDependentExistsStmt::KeywordToken)
     .def_prop_ro("sub_statement", &MSDependentExistsStmt::SubStatement)
     .def_prop_ro("is_if_exists", &MSDependentExistsStmt::IsIfExists)
-    .def_prop_ro("is_if_not_exists", &MSDependentExistsStmt::IsIfNotExists);
+    .def_prop_ro("is_if_not_exists", &MSDependentExistsStmt::IsIfNotExists)
+    .def("snapshot", &MSDependentExistsStmt::Snapshot);
+
+  nb::class_<MSDependentExistsStmtSnapshot, StmtSnapshot>(m, "MSDependentExistsStmtSnapshot")
+    .def_ro("keyword_token", &MSDependentExistsStmtSnapshot::keyword_token)
+    .def_ro("is_if_exists", &MSDependentExistsStmtSnapshot::is_if_exists)
+    .def_ro("is_if_not_exists", &MSDependentExistsStmtSnapshot::is_if_not_exists);
 }
 } // namespace pasta
@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterMSGuidDecl(nb::module_ &m) {
-  nb::class_<MSGuidDecl, ValueDecl>(m, "MSGuidDecl");
+  nb::class_<MSGuidDecl, ValueDecl>(m, "MSGuidDecl")
+    .def("snapshot", &MSGuidDecl::Snapshot);
+
+  nb::class_<MSGuidDeclSnapshot, ValueDeclSnapshot>(m, "MSGuidDeclSnapshot");
 }
 } // namespace pasta
@@ -20,6 +20,11 @@ namespace nb = nanobind;
 void RegisterMSPropertyDecl(nb::module_ &m) {
   nb::class_<MSPropertyDecl, DeclaratorDecl>(m, "MSPropertyDecl")
     .def_prop_ro("has_getter", &MSPropertyDecl::HasGetter)
-    .def_prop_ro("has_setter", &MSPropertyDecl::HasSetter);
+    .def_prop_ro("has_setter", &MSPropertyDecl::HasSetter)
+    .def("snapshot", &MSPropertyDecl::Snapshot);
+
+  nb::class_<MSPropertyDeclSnapshot, DeclaratorDeclSnapshot>(m, "MSPropertyDeclSnapshot")
+    .def_ro("has_getter", &MSPropertyDeclSnapshot::has_getter)
+    .def_ro("has_setter", &MSPropertyDeclSnapshot::has_setter);
 }
 } // namespace pasta
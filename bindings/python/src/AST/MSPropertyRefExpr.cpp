@@ -27,6 +27,12 @@ void RegisterMSPropertyRefExpr(nb::module_ &m) {
     .def_prop_ro("property_declaration", &MSPropertyRefExpr::PropertyDeclaration)
     .def_prop_ro("tokens", &MSPropertyRefExpr::Tokens)
     .def_prop_ro("is_arrow", &MSPropertyRefExpr::IsArrow)
-    .def_prop_ro("is_implicit_access", &MSPropertyRefExpr::IsImplicitAccess);
+    .def_prop_ro("is_implicit_access", &MSPropertyRefExpr::IsImplicitAccess)
+    .def("snapshot", &MSPropertyRefExpr::Snapshot);
+
+  nb::class_<MSPropertyRefExprSnapshot, ExprSnapshot>(m, "MSPropertyRefExprSnapshot")
+    .def_ro("member_token", &MSPropertyRefExprSnapshot::member_token)
+    .def_ro("is_arrow", &MSPropertyRefExprSnapshot::is_arrow)
+    .def_ro("is_implicit_access", &MSPropertyRefExprSnapshot::is_implicit_access);
 }
 } // namespace pasta
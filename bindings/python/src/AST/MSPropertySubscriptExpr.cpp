@@ -25,6 +25,10 @@ void RegisterMSPropertySubscriptExpr(nb::module_ &m) {
     .def_prop_ro("end_token", &MSPropertySubscriptExpr::EndToken)
     .def_prop_ro("expression_token", &MSPropertySubscriptExpr::ExpressionToken)
     .def_prop_ro("index", &MSPropertySubscriptExpr::Index)
-    .def_prop_ro("r_bracket_token", &MSPropertySubscriptExpr::RBracketToken);
+    .def_prop_ro("r_bracket_token", &MSPropertySubscriptExpr::RBracketToken)
+    .def("snapshot", &MSPropertySubscriptExpr::Snapshot);
+
+  nb::class_<MSPropertySubscriptExprSnapshot, ExprSnapshot>(m, "MSPropertySubscriptExprSnapshot")
+    .def_ro("r_bracket_token", &MSPropertySubscriptExprSnapshot::r_bracket_token);
 }
 } // namespace pasta
@@ -28,6 +28,13 @@ void RegisterMaterializeTemporaryExpr(nb::module_ &m) {
     .def_prop_ro("storage_duration", &MaterializeTemporaryExpr::StorageDuration)
     .def_prop_ro("sub_expression", &MaterializeTemporaryExpr::SubExpression)
     .def_prop_ro("is_bound_to_lvalue_reference", &MaterializeTemporaryExpr::IsBoundToLvalueReference)
-    .def_prop_ro("is_usable_in_constant_expressions", &MaterializeTemporaryExpr::IsUsableInConstantExpressions);
+    .def_prop_ro("is_usable_in_constant_expressions", &MaterializeTemporaryExpr::IsUsableInConstantExpressions)
+    .def("snapshot", &MaterializeTemporaryExpr::Snapshot);
+
+  nb::class_<MaterializeTemporaryExprSnapshot, ExprSnapshot>(m, "MaterializeTemporaryExprSnapshot")
+    .def_ro("mangling_number", &MaterializeTemporaryExprSnapshot::mangling_number)
+    .def_ro("storage_duration", &MaterializeTemporaryExprSnapshot::storage_duration)
+    .def_ro("is_bound_to_lvalue_reference", &MaterializeTemporaryExprSnapshot::is_bound_to_lvalue_reference)
+    .def_ro("is_usable_in_constant_expressions", &MaterializeTemporaryExprSnapshot::is_usable_in_constant_expressions);
 }
 } // namespace pasta
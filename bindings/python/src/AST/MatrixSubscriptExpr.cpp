@@ -27,6 +27,11 @@ void RegisterMatrixSubscriptExpr(nb::module_ &m) {
     .def_prop_ro("expression_token", &MatrixSubscriptExpr::ExpressionToken)
     .def_prop_ro("r_bracket_token", &MatrixSubscriptExpr::RBracketToken)
     .def_prop_ro("row_index", &MatrixSubscriptExpr::RowIndex)
-    .def_prop_ro("is_incomplete", &MatrixSubscriptExpr::IsIncomplete);
+    .def_prop_ro("is_incomplete", &MatrixSubscriptExpr::IsIncomplete)
+    .def("snapshot", &MatrixSubscriptExpr::Snapshot);
+
+  nb::class_<MatrixSubscriptExprSnapshot, ExprSnapshot>(m, "MatrixSubscriptExprSnapshot")
+    .def_ro("r_bracket_token", &MatrixSubscriptExprSnapshot::r_bracket_token)
+    .def_ro("is_incomplete", &MatrixSubscriptExprSnapshot::is_incomplete);
 }
 } // namespace pasta
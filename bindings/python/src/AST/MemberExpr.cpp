@@ -37,6 +37,22 @@ void RegisterMemberExpr(nb::module_ &m) {
     .def_prop_ro("has_template_keyword", &MemberExpr::HasTemplateKeyword)
     .def_prop_ro("is_arrow", &MemberExpr::IsArrow)
     .def_prop_ro("is_implicit_access", &MemberExpr::IsImplicitAccess)
-    .def_prop_ro("is_non_odr_use", &MemberExpr::IsNonOdrUse);
+    .def_prop_ro("is_non_odr_use", &MemberExpr::IsNonOdrUse)
+    .def("snapshot", &MemberExpr::Snapshot);
+
+  nb::class_<MemberExprSnapshot, ExprSnapshot>(m, "MemberExprSnapshot")
+    .def_ro("l_angle_token", &MemberExprSnapshot::l_angle_token)
+    .def_ro("member_token", &MemberExprSnapshot::member_token)
+    .def_ro("num_template_arguments", &MemberExprSnapshot::num_template_arguments)
+    .def_ro("operator_token", &MemberExprSnapshot::operator_token)
+    .def_ro("r_angle_token", &MemberExprSnapshot::r_angle_token)
+    .def_ro("template_keyword_token", &MemberExprSnapshot::template_keyword_token)
+    .def_ro("had_multiple_candidates", &MemberExprSnapshot::had_multiple_candidates)
+    .def_ro("has_explicit_template_arguments", &MemberExprSnapshot::has_explicit_template_arguments)
+    .def_ro("has_qualifier", &MemberExprSnapshot::has_qualifier)
+    .def_ro("has_template_keyword", &MemberExprSnapshot::has_template_keyword)
+    .def_ro("is_arrow", &MemberExprSnapshot::is_arrow)
+    .def_ro("is_implicit_access", &MemberExprSnapshot::is_implicit_access)
+    .def_ro("is_non_odr_use", &MemberExprSnapshot::is_non_odr_use);
 }
 } // namespace pasta
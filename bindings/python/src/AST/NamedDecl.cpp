@@ -34,6 +34,19 @@ void RegisterNamedDecl(nb::module_ &m) {
     .def_prop_ro("is_cxx_instance_member", &NamedDecl::IsCXXInstanceMember)
     .def_prop_ro("is_externally_declarable", &NamedDecl::IsExternallyDeclarable)
     .def_prop_ro("is_externally_visible", &NamedDecl::IsExternallyVisible)
-    .def_prop_ro("is_linkage_valid", &NamedDecl::IsLinkageValid);
+    .def_prop_ro("is_linkage_valid", &NamedDecl::IsLinkageValid)
+    .def("snapshot", &NamedDecl::Snapshot);
+
+  nb::class_<NamedDeclSnapshot, DeclSnapshot>(m, "NamedDeclSnapshot")
+    .def_ro("formal_linkage", &NamedDeclSnapshot::formal_linkage)
+    .def_ro("linkage_internal", &NamedDeclSnapshot::linkage_internal)
+    .def_ro("has_external_formal_linkage", &NamedDeclSnapshot::has_external_formal_linkage)
+    .def_ro("has_linkage", &NamedDeclSnapshot::has_linkage)
+    .def_ro("has_linkage_been_computed", &NamedDeclSnapshot::has_linkage_been_computed)
+    .def_ro("is_cxx_class_member", &NamedDeclSnapshot::is_cxx_class_member)
+    .def_ro("is_cxx_instance_member", &NamedDeclSnapshot::is_cxx_instance_member)
+    .def_ro("is_externally_declarable", &NamedDeclSnapshot::is_externally_declarable)
+    .def_ro("is_externally_visible", &NamedDeclSnapshot::is_externally_visible)
+    .def_ro("is_linkage_valid", &NamedDeclSnapshot::is_linkage_valid);
 }
 } // namespace pasta
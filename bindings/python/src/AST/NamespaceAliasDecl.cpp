@@ -24,6 +24,12 @@ void RegisterNamespaceAliasDecl(nb::module_ &m) {
     .def_prop_ro("canonical_declaration", &NamespaceAliasDecl::CanonicalDeclaration)
     .def_prop_ro("namespace", &NamespaceAliasDecl::Namespace)
     .def_prop_ro("namespace_token", &NamespaceAliasDecl::NamespaceToken)
-    .def_prop_ro("target_name_token", &NamespaceAliasDecl::TargetNameToken);
+    .def_prop_ro("target_name_token", &NamespaceAliasDecl::TargetNameToken)
+    .def("snapshot", &NamespaceAliasDecl::Snapshot);
+
+  nb::class_<NamespaceAliasDeclSnapshot, NamedDeclSnapshot>(m, "NamespaceAliasDeclSnapshot")
+    .def_ro("alias_token", &NamespaceAliasDeclSnapshot::alias_token)
+    .def_ro("namespace_token", &NamespaceAliasDeclSnapshot::namespace_token)
+    .def_ro("target_name_token", &NamespaceAliasDeclSnapshot::target_name_token);
 }
 } // namespace pasta
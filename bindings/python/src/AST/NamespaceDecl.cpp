@@ -27,6 +27,14 @@ void RegisterNamespaceDecl(nb::module_ &m) {
     .def_prop_ro("is_anonymous_namespace", &NamespaceDecl::IsAnonymousNamespace)
     .def_prop_ro("is_inline", &NamespaceDecl::IsInline)
     .def_prop_ro("is_nested", &NamespaceDecl::IsNested)
-    .def_prop_ro("is_original_namespace", &NamespaceDecl::IsOriginalNamespace);
+    .def_prop_ro("is_original_namespace", &NamespaceDecl::IsOriginalNamespace)
+    .def("snapshot", &NamespaceDecl::Snapshot);
+
+  nb::class_<NamespaceDeclSnapshot, NamedDeclSnapshot>(m, "NamespaceDeclSnapshot")
+    .def_ro("r_brace_token", &NamespaceDeclSnapshot::r_brace_token)
+    .def_ro("is_anonymous_namespace", &NamespaceDeclSnapshot::is_anonymous_namespace)
+    .def_ro("is_inline", &NamespaceDeclSnapshot::is_inline)
+    .def_ro("is_nested", &NamespaceDeclSnapshot::is_nested)
+    .def_ro("is_original_namespace", &NamespaceDeclSnapshot::is_original_namespace);
 }
 } // namespace pasta
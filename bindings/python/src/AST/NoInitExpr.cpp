@@ -21,6 +21,9 @@ void RegisterNoInitExpr(nb::module_ &m) {
   nb::class_<NoInitExpr, Expr>(m, "NoInitExpr")
     .def_prop_ro("children", &NoInitExpr::Children)
     .def_prop_ro("begin_token", &NoInitExpr::BeginToken)
-    .def_prop_ro("end_token", &NoInitExpr::EndToken);
+    .def_prop_ro("end_token", &NoInitExpr::EndToken)
+    .def("snapshot", &NoInitExpr::Snapshot);
+
+  nb::class_<NoInitExprSnapshot, ExprSnapshot>(m, "NoInitExprSnapshot");
 }
 } // namespace pasta
@@ -28,6 +28,15 @@ void RegisterNonTypeTemplateParmDecl(nb::module_ &m) {
     .def_prop_ro("has_placeholder_type_constraint", &NonTypeTemplateParmDecl::HasPlaceholderTypeConstraint)
     .def_prop_ro("is_expanded_parameter_pack", &NonTypeTemplateParmDecl::IsExpandedParameterPack)
     .def_prop_ro("is_pack_expansion", &NonTypeTemplateParmDecl::IsPackExpansion)
-    .def_prop_ro("is_parameter_pack", &NonTypeTemplateParmDecl::IsParameterPack);
+    .def_prop_ro("is_parameter_pack", &NonTypeTemplateParmDecl::IsParameterPack)
+    .def("snapshot", &NonTypeTemplateParmDecl::Snapshot);
+
+  nb::class_<NonTypeTemplateParmDeclSnapshot, DeclaratorDeclSnapshot>(m, "NonTypeTemplateParmDeclSnapshot")
+    .def_ro("default_argument_was_inherited", &NonTypeTemplateParmDeclSnapshot::default_argument_was_inherited)
+    .def_ro("default_argument_token", &NonTypeTemplateParmDeclSnapshot::default_argument_token)
+    .def_ro("has_default_argument", &NonTypeTemplateParmDeclSnapshot::has_default_argument)
+    .def_ro("has_placeholder_type_constraint", &NonTypeTemplateParmDeclSnapshot::has_placeholder_type_constraint)
+    .def_ro("is_expanded_parameter_pack", &NonTypeTemplateParmDeclSnapshot::is_expanded_parameter_pack)
+    .def_ro("is_pack_expansion", &NonTypeTemplateParmDeclSnapshot::is_pack_expansion);
 }
 } // namespace pasta
@@ -23,6 +23,11 @@ void RegisterNullStmt(nb::module_ &m) {
     .def_prop_ro("begin_token", &NullStmt::BeginToken)
     .def_prop_ro("end_token", &NullStmt::EndToken)
     .def_prop_ro("semi_token", &NullStmt::SemiToken)
-    .def_prop_ro("has_leading_empty_macro", &NullStmt::HasLeadingEmptyMacro);
+    .def_prop_ro("has_leading_empty_macro", &NullStmt::HasLeadingEmptyMacro)
+    .def("snapshot", &NullStmt::Snapshot);
+
+  nb::class_<NullStmtSnapshot, StmtSnapshot>(m, "NullStmtSnapshot")
+    .def_ro("semi_token", &NullStmtSnapshot::semi_token)
+    .def_ro("has_leading_empty_macro", &NullStmtSnapshot::has_leading_empty_macro);
 }
 } // namespace pasta
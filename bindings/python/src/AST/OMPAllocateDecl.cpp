@@ -19,6 +19,9 @@ namespace nb = nanobind;
 
 void RegisterOMPAllocateDecl(nb::module_ &m) {
   nb::class_<OMPAllocateDecl, OMPDeclarativeDirectiveDecl>(m, "OMPAllocateDecl")
-    .def_prop_ro("varlists", &OMPAllocateDecl::Varlists);
+    .def_prop_ro("varlists", &OMPAllocateDecl::Varlists)
+    .def("snapshot", &OMPAllocateDecl::Snapshot);
+
+  nb::class_<OMPAllocateDeclSnapshot, OMPDeclarativeDirectiveDeclSnapshot>(m, "OMPAllocateDeclSnapshot");
 }
 } // namespace pasta
@@ -29,6 +29,12 @@ void RegisterOMPArraySectionExpr(nb::module_ &m) {
     .def_prop_ro("length", &OMPArraySectionExpr::Length)
     .def_prop_ro("lower_bound", &OMPArraySectionExpr::LowerBound)
     .def_prop_ro("r_bracket_token", &OMPArraySectionExpr::RBracketToken)
-    .def_prop_ro("stride", &OMPArraySectionExpr::Stride);
+    .def_prop_ro("stride", &OMPArraySectionExpr::Stride)
+    .def("snapshot", &OMPArraySectionExpr::Snapshot);
+
+  nb::class_<OMPArraySectionExprSnapshot, ExprSnapshot>(m, "OMPArraySectionExprSnapshot")
+    .def_ro("first_colon_token", &OMPArraySectionExprSnapshot::first_colon_token)
+    .def_ro("second_colon_token", &OMPArraySectionExprSnapshot::second_colon_token)
+    .def_ro("r_bracket_token", &OMPArraySectionExprSnapshot::r_bracket_token);
 }
 } // namespace pasta
@@ -26,6 +26,11 @@ void RegisterOMPArrayShapingExpr(nb::module_ &m) {
     .def_prop_ro("dimensions", &OMPArrayShapingExpr::Dimensions)
     .def_prop_ro("end_token", &OMPArrayShapingExpr::EndToken)
     .def_prop_ro("l_paren_token", &OMPArrayShapingExpr::LParenToken)
-    .def_prop_ro("r_paren_token", &OMPArrayShapingExpr::RParenToken);
+    .def_prop_ro("r_paren_token", &OMPArrayShapingExpr::RParenToken)
+    .def("snapshot", &OMPArrayShapingExpr::Snapshot);
+
+  nb::class_<OMPArrayShapingExprSnapshot, ExprSnapshot>(m, "OMPArrayShapingExprSnapshot")
+    .def_ro("l_paren_token", &OMPArrayShapingExprSnapshot::l_paren_token)
+    .def_ro("r_paren_token", &OMPArrayShapingExprSnapshot::r_paren_token);
 }
 } // namespace pasta
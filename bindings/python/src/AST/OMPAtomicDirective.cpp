@@ -28,6 +28,12 @@ void RegisterOMPAtomicDirective(nb::module_ &m) {
     .def_prop_ro("x", &OMPAtomicDirective::X)
     .def_prop_ro("is_fail_only", &OMPAtomicDirective::IsFailOnly)
     .def_prop_ro("is_postfix_update", &OMPAtomicDirective::IsPostfixUpdate)
-    .def_prop_ro("is_xlhs_in_rhs_part", &OMPAtomicDirective::IsXLHSInRHSPart);
+    .def_prop_ro("is_xlhs_in_rhs_part", &OMPAtomicDirective::IsXLHSInRHSPart)
+    .def("snapshot", &OMPAtomicDirective::Snapshot);
+
+  nb::class_<OMPAtomicDirectiveSnapshot, OMPExecutableDirectiveSnapshot>(m, "OMPAtomicDirectiveSnapshot")
+    .def_ro("is_fail_only", &OMPAtomicDirectiveSnapshot::is_fail_only)
+    .def_ro("is_postfix_update", &OMPAtomicDirectiveSnapshot::is_postfix_update)
+    .def_ro("is_xlhs_in_rhs_part", &OMPAtomicDirectiveSnapshot::is_xlhs_in_rhs_part);
 }
 } // namespace pasta
@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPBarrierDirective(nb::module_ &m) {
-  nb::class_<OMPBarrierDirective, OMPExecutableDirective>(m, "OMPBarrierDirective");
+  nb::class_<OMPBarrierDirective, OMPExecutableDirective>(m, "OMPBarrierDirective")
+    .def("snapshot", &OMPBarrierDirective::Snapshot);
+
+  nb::class_<OMPBarrierDirectiveSnapshot, OMPExecutableDirectiveSnapshot>(m, "OMPBarrierDirectiveSnapshot");
 }
 } // namespace pasta
@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPCancelDirective(nb::module_ &m) {
-  nb::class_<OMPCancelDirective, OMPExecutableDirective>(m, "OMPCancelDirective");
+  nb::class_<OMPCancelDirective, OMPExecutableDirective>(m, "OMPCancelDirective")
+    .def("snapshot", &OMPCancelDirective::Snapshot);
+
+  nb::class_<OMPCancelDirectiveSnapshot, OMPExecutableDirectiveSnapshot>(m, "OMPCancelDirectiveSnapshot");
 }
 } // namespace pasta
@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPCancellationPointDirective(nb::module_ &m) {
-  nb::class_<OMPCancellationPointDirective, OMPExecutableDirective>(m, "OMPCancellationPointDirective");
+  nb::class_<OMPCancellationPointDirective, OMPExecutableDirective>(m, "OMPCancellationPointDirective")
+    .def("snapshot", &OMPCancellationPointDirective::Snapshot);
+
+  nb::class_<OMPCancellationPointDirectiveSnapshot, OMPExecutableDirectiveSnapshot>(m, "OMPCancellationPointDirectiveSnapshot");
 }
 } // namespace pasta
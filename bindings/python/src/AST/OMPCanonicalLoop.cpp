@@ -25,6 +25,9 @@ void RegisterOMPCanonicalLoop(nb::module_ &m) {
     .def_prop_ro("end_token", &OMPCanonicalLoop::EndToken)
     .def_prop_ro("loop_statement", &OMPCanonicalLoop::LoopStatement)
     .def_prop_ro("loop_variable_func", &OMPCanonicalLoop::LoopVariableFunc)
-    .def_prop_ro("loop_variable_reference", &OMPCanonicalLoop::LoopVariableReference);
+    .def_prop_ro("loop_variable_reference", &OMPCanonicalLoop::LoopVariableReference)
+    .def("snapshot", &OMPCanonicalLoop::Snapshot);
+
+  nb::class_<OMPCanonicalLoopSnapshot, StmtSnapshot>(m, "OMPCanonicalLoopSnapshot");
 }
 } // namespace pasta
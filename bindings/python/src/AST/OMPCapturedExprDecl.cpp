@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPCapturedExprDecl(nb::module_ &m) {
-  nb::class_<OMPCapturedExprDecl, VarDecl>(m, "OMPCapturedExprDecl");
+  nb::class_<OMPCapturedExprDecl, VarDecl>(m, "OMPCapturedExprDecl")
+    .def("snapshot", &OMPCapturedExprDecl::Snapshot);
+
+  nb::class_<OMPCapturedExprDeclSnapshot, VarDeclSnapshot>(m, "OMPCapturedExprDeclSnapshot");
 }
 } // namespace pasta
@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPCriticalDirective(nb::module_ &m) {
-  nb::class_<OMPCriticalDirective, OMPExecutableDirective>(m, "OMPCriticalDirective");
+  nb::class_<OMPCriticalDirective, OMPExecutableDirective>(m, "OMPCriticalDirective")
+    .def("snapshot", &OMPCriticalDirective::Snapshot);
+
+  nb::class_<OMPCriticalDirectiveSnapshot, OMPExecutableDirectiveSnapshot>(m, "OMPCriticalDirectiveSnapshot");
 }
 } // namespace pasta
@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPDeclarativeDirectiveDecl(nb::module_ &m) {
-  nb::class_<OMPDeclarativeDirectiveDecl, Decl>(m, "OMPDeclarativeDirectiveDecl");
+  nb::class_<OMPDeclarativeDirectiveDecl, Decl>(m, "OMPDeclarativeDirectiveDecl")
+    .def("snapshot", &OMPDeclarativeDirectiveDecl::Snapshot);
+
+  nb::class_<OMPDeclarativeDirectiveDeclSnapshot, DeclSnapshot>(m, "OMPDeclarativeDirectiveDeclSnapshot");
 }
 } // namespace pasta
@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPDeclarativeDirectiveValueDecl(nb::module_ &m) {
-  nb::class_<OMPDeclarativeDirectiveValueDecl, ValueDecl>(m, "OMPDeclarativeDirectiveValueDecl");
+  nb::class_<OMPDeclarativeDirectiveValueDecl, ValueDecl>(m, "OMPDeclarativeDirectiveValueDecl")
+    .def("snapshot", &OMPDeclarativeDirectiveValueDecl::Snapshot);
+
+  nb::class_<OMPDeclarativeDirectiveValueDeclSnapshot, ValueDeclSnapshot>(m, "OMPDeclarativeDirectiveValueDeclSnapshot");
 }
 } // namespace pasta
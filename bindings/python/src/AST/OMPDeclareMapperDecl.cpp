@@ -20,6 +20,9 @@ namespace nb = nanobind;
 void RegisterOMPDeclareMapperDecl(nb::module_ &m) {
   nb::class_<OMPDeclareMapperDecl, OMPDeclarativeDirectiveValueDecl>(m, "OMPDeclareMapperDecl")
     .def_prop_ro("mapper_variable_reference", &OMPDeclareMapperDecl::MapperVariableReference)
-    .def_prop_ro("prev_declaration_in_scope", &OMPDeclareMapperDecl::PrevDeclarationInScope);
+    .def_prop_ro("prev_declaration_in_scope", &OMPDeclareMapperDecl::PrevDeclarationInScope)
+    .def("snapshot", &OMPDeclareMapperDecl::Snapshot);
+
+  nb::class_<OMPDeclareMapperDeclSnapshot, OMPDeclarativeDirectiveValueDeclSnapshot>(m, "OMPDeclareMapperDeclSnapshot");
 }
 } // namespace pasta
@@ -26,6 +26,10 @@ void RegisterOMPDeclareReductionDecl(nb::module_ &m) {
     .def_prop_ro("initializer_private", &OMPDeclareReductionDecl::InitializerPrivate)
     .def_prop_ro("initializer", &OMPDeclareReductionDecl::Initializer)
     .def_prop_ro("initializer_kind", &OMPDeclareReductionDecl::InitializerKind)
-    .def_prop_ro("prev_declaration_in_scope", &OMPDeclareReductionDecl::PrevDeclarationInScope);
+    .def_prop_ro("prev_declaration_in_scope", &OMPDeclareReductionDecl::PrevDeclarationInScope)
+    .def("snapshot", &OMPDeclareReductionDecl::Snapshot);
+
+  nb::class_<OMPDeclareReductionDeclSnapshot, ValueDeclSnapshot>(m, "OMPDeclareReductionDeclSnapshot")
+    .def_ro("initializer_kind", &OMPDeclareReductionDeclSnapshot::initializer_kind);
 }
 } // namespace pasta
@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPDepobjDirective(nb::module_ &m) {
-  nb::class_<OMPDepobjDirective, OMPExecutableDirective>(m, "OMPDepobjDirective");
+  nb::class_<OMPDepobjDirective, OMPExecutableDirective>(m, "OMPDepobjDirective")
+    .def("snapshot", &OMPDepobjDirective::Snapshot);
+
+  nb::class_<OMPDepobjDirectiveSnapshot, OMPExecutableDirectiveSnapshot>(m, "OMPDepobjDirectiveSnapshot");
 }
 } // namespace pasta
@@ -19,6 +19,10 @@ namespace nb = nanobind;
 
 void RegisterOMPDispatchDirective(nb::module_ &m) {
   nb::class_<OMPDispatchDirective, OMPExecutableDirective>(m, "OMPDispatchDirective")
-    .def_prop_ro("target_call_token", &OMPDispatchDirective::TargetCallToken);
+    .def_prop_ro("target_call_token", &OMPDispatchDirective::TargetCallToken)
+    .def("snapshot", &OMPDispatchDirective::Snapshot);
+
+  nb::class_<OMPDispatchDirectiveSnapshot, OMPExecutableDirectiveSnapshot>(m, "OMPDispatchDirectiveSnapshot")
+    .def_ro("target_call_token", &OMPDispatchDirectiveSnapshot::target_call_token);
 }
 } // namespace pasta
@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPDistributeDirective(nb::module_ &m) {
-  nb::class_<OMPDistributeDirective, OMPLoopDirective>(m, "OMPDistributeDirective");
+  nb::class_<OMPDistributeDirective, OMPLoopDirective>(m, "OMPDistributeDirective")
+    .def("snapshot", &OMPDistributeDirective::Snapshot);
+
+  nb::class_<OMPDistributeDirectiveSnapshot, OMPLoopDirectiveSnapshot>(m, "OMPDistributeDirectiveSnapshot");
 }
 } // namespace pasta
@@ -20,6 +20,10 @@ namespace nb = nanobind;
 void RegisterOMPDistributeParallelForDirective(nb::module_ &m) {
   nb::class_<OMPDistributeParallelForDirective, OMPLoopDirective>(m, "OMPDistributeParallelForDirective")
     .def_prop_ro("task_reduction_reference_expression", &OMPDistributeParallelForDirective::TaskReductionReferenceExpression)
-    .def_prop_ro("has_cancel", &OMPDistributeParallelForDirective::HasCancel);
+    .def_prop_ro("has_cancel", &OMPDistributeParallelForDirective::HasCancel)
+    .def("snapshot", &OMPDistributeParallelForDirective::Snapshot);
+
+  nb::class_<OMPDistributeParallelForDirectiveSnapshot, OMPLoopDirectiveSnapshot>(m, "OMPDistributeParallelForDirectiveSnapshot")
+    .def_ro("has_cancel", &OMPDistributeParallelForDirectiveSnapshot::has_cancel);
 }
 } // namespace pasta
@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPDistributeParallelForSimdDirective(nb::module_ &m) {
-  nb::class_<OMPDistributeParallelForSimdDirective, OMPLoopDirective>(m, "OMPDistributeParallelForSimdDirective");
+  nb::class_<OMPDistributeParallelForSimdDirective, OMPLoopDirective>(m, "OMPDistributeParallelForSimdDirective")
+    .def("snapshot", &OMPDistributeParallelForSimdDirective::Snapshot);
+
+  nb::class_<OMPDistributeParallelForSimdDirectiveSnapshot, OMPLoopDirectiveSnapshot>(m, "OMPDistributeParallelForSimdDirectiveSnapshot");
 }
 } // namespace pasta
@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPDistributeSimdDirective(nb::module_ &m) {
-  nb::class_<OMPDistributeSimdDirective, OMPLoopDirective>(m, "OMPDistributeSimdDirective");
+  nb::class_<OMPDistributeSimdDirective, OMPLoopDirective>(m, "OMPDistributeSimdDirective")
+    .def("snapshot", &OMPDistributeSimdDirective::Snapshot);
+
+  nb::class_<OMPDistributeSimdDirectiveSnapshot, OMPLoopDirectiveSnapshot>(m, "OMPDistributeSimdDirectiveSnapshot");
 }
 } // namespace pasta
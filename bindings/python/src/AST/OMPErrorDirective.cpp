@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPErrorDirective(nb::module_ &m) {
-  nb::class_<OMPErrorDirective, OMPExecutableDirective>(m, "OMPErrorDirective");
+  nb::class_<OMPErrorDirective, OMPExecutableDirective>(m, "OMPErrorDirective")
+    .def("snapshot", &OMPErrorDirective::Snapshot);
+
+  nb::class_<OMPErrorDirectiveSnapshot, OMPExecutableDirectiveSnapshot>(m, "OMPErrorDirectiveSnapshot");
 }
 } // namespace pasta
@@ -28,6 +28,12 @@ void RegisterOMPExecutableDirective(nb::module_ &m) {
     .def_prop_ro("raw_statement", &OMPExecutableDirective::RawStatement)
     .def_prop_ro("structured_block", &OMPExecutableDirective::StructuredBlock)
     .def_prop_ro("has_associated_statement", &OMPExecutableDirective::HasAssociatedStatement)
-    .def_prop_ro("is_standalone_directive", &OMPExecutableDirective::IsStandaloneDirective);
+    .def_prop_ro("is_standalone_directive", &OMPExecutableDirective::IsStandaloneDirective)
+    .def("snapshot", &OMPExecutableDirective::Snapshot);
+
+  nb::class_<OMPExecutableDirectiveSnapshot, StmtSnapshot>(m, "OMPExecutableDirectiveSnapshot")
+    .def_ro("num_clauses", &OMPExecutableDirectiveSnapshot::num_clauses)
+    .def_ro("has_associated_statement", &OMPExecutableDirectiveSnapshot::has_associated_statement)
+    .def_ro("is_standalone_directive", &OMPExecutableDirectiveSnapshot::is_standalone_directive);
 }
 } // namespace pasta
@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPFlushDirective(nb::module_ &m) {
-  nb::class_<OMPFlushDirective, OMPExecutableDirective>(m, "OMPFlushDirective");
+  nb::class_<OMPFlushDirective, OMPExecutableDirective>(m, "OMPFlushDirective")
+    .def("snapshot", &OMPFlushDirective::Snapshot);
+
+  nb::class_<OMPFlushDirectiveSnapshot, OMPExecutableDirectiveSnapshot>(m, "OMPFlushDirectiveSnapshot");
 }
 } // namespace pasta
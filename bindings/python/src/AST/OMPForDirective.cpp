@@ -20,6 +20,10 @@ namespace nb = nanobind;
 void RegisterOMPForDirective(nb::module_ &m) {
   nb::class_<OMPForDirective, OMPLoopDirective>(m, "OMPForDirective")
     .def_prop_ro("task_reduction_reference_expression", &OMPForDirective::TaskReductionReferenceExpression)
-    .def_prop_ro("has_cancel", &OMPForDirective::HasCancel);
+    .def_prop_ro("has_cancel", &OMPForDirective::HasCancel)
+    .def("snapshot", &OMPForDirective::Snapshot);
+
+  nb::class_<OMPForDirectiveSnapshot, OMPLoopDirectiveSnapshot>(m, "OMPForDirectiveSnapshot")
+    .def_ro("has_cancel", &OMPForDirectiveSnapshot::has_cancel);
 }
 } // namespace pasta
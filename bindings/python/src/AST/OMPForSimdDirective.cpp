@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPForSimdDirective(nb::module_ &m) {
-  nb::class_<OMPForSimdDirective, OMPLoopDirective>(m, "OMPForSimdDirective");
+  nb::class_<OMPForSimdDirective, OMPLoopDirective>(m, "OMPForSimdDirective")
+    .def("snapshot", &OMPForSimdDirective::Snapshot);
+
+  nb::class_<OMPForSimdDirectiveSnapshot, OMPLoopDirectiveSnapshot>(m, "OMPForSimdDirectiveSnapshot");
 }
 } // namespace pasta
@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPGenericLoopDirective(nb::module_ &m) {
-  nb::class_<OMPGenericLoopDirective, OMPLoopDirective>(m, "OMPGenericLoopDirective");
+  nb::class_<OMPGenericLoopDirective, OMPLoopDirective>(m, "OMPGenericLoopDirective")
+    .def("snapshot", &OMPGenericLoopDirective::Snapshot);
+
+  nb::class_<OMPGenericLoopDirectiveSnapshot, OMPLoopDirectiveSnapshot>(m, "OMPGenericLoopDirectiveSnapshot");
 }
 } // namespace pasta
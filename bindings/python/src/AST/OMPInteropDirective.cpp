@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPInteropDirective(nb::module_ &m) {
-  nb::class_<OMPInteropDirective, OMPExecutableDirective>(m, "OMPInteropDirective");
+  nb::class_<OMPInteropDirective, OMPExecutableDirective>(m, "OMPInteropDirective")
+    .def("snapshot", &OMPInteropDirective::Snapshot);
+
+  nb::class_<OMPInteropDirectiveSnapshot, OMPExecutableDirectiveSnapshot>(m, "OMPInteropDirectiveSnapshot");
 }
 } // namespace pasta
@@ -25,6 +25,13 @@ void RegisterOMPIteratorExpr(nb::module_ &m) {
     .def_prop_ro("iterator_kw_token", &OMPIteratorExpr::IteratorKwToken)
     .def_prop_ro("l_paren_token", &OMPIteratorExpr::LParenToken)
     .def_prop_ro("r_paren_token", &OMPIteratorExpr::RParenToken)
-    .def_prop_ro("num_of_iterators", &OMPIteratorExpr::NumOfIterators);
+    .def_prop_ro("num_of_iterators", &OMPIteratorExpr::NumOfIterators)
+    .def("snapshot", &OMPIteratorExpr::Snapshot);
+
+  nb::class_<OMPIteratorExprSnapshot, ExprSnapshot>(m, "OMPIteratorExprSnapshot")
+    .def_ro("iterator_kw_token", &OMPIteratorExprSnapshot::iterator_kw_token)
+    .def_ro("l_paren_token", &OMPIteratorExprSnapshot::l_paren_token)
+    .def_ro("r_paren_token", &OMPIteratorExprSnapshot::r_paren_token)
+    .def_ro("num_of_iterators", &OMPIteratorExprSnapshot::num_of_iterators);
 }
 } // namespace pasta
@@ -19,6 +19,10 @@ namespace nb = nanobind;
 
 void RegisterOMPLoopBasedDirective(nb::module_ &m) {
   nb::class_<OMPLoopBasedDirective, OMPExecutableDirective>(m, "OMPLoopBasedDirective")
-    .def_prop_ro("loops_number", &OMPLoopBasedDirective::LoopsNumber);
+    .def_prop_ro("loops_number", &OMPLoopBasedDirective::LoopsNumber)
+    .def("snapshot", &OMPLoopBasedDirective::Snapshot);
+
+  nb::class_<OMPLoopBasedDirectiveSnapshot, OMPExecutableDirectiveSnapshot>(m, "OMPLoopBasedDirectiveSnapshot")
+    .def_ro("loops_number", &OMPLoopBasedDirectiveSnapshot::loops_number);
 }
 } // namespace pasta
@@ -56,6 +56,9 @@ void RegisterOMPLoopDirective(nb::module_ &m) {
     .def_prop_ro("upper_bound_variable", &OMPLoopDirective::UpperBoundVariable)
     .def_prop_ro("initializers", &OMPLoopDirective::Initializers)
     .def_prop_ro("private_counters", &OMPLoopDirective::PrivateCounters)
-    .def_prop_ro("updates", &OMPLoopDirective::Updates);
+    .def_prop_ro("updates", &OMPLoopDirective::Updates)
+    .def("snapshot", &OMPLoopDirective::Snapshot);
+
+  nb::class_<OMPLoopDirectiveSnapshot, OMPLoopBasedDirectiveSnapshot>(m, "OMPLoopDirectiveSnapshot");
 }
 } // namespace pasta
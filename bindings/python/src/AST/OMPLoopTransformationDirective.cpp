@@ -21,6 +21,10 @@ void RegisterOMPLoopTransformationDirective(nb::module_ &m) {
   nb::class_<OMPLoopTransformationDirective, OMPLoopBasedDirective>(m, "OMPLoopTransformationDirective")
     .def_prop_ro("num_associated_loops", &OMPLoopTransformationDirective::NumAssociatedLoops)
     .def_prop_ro("pre_initializers", &OMPLoopTransformationDirective::PreInitializers)
-    .def_prop_ro("transformed_statement", &OMPLoopTransformationDirective::TransformedStatement);
+    .def_prop_ro("transformed_statement", &OMPLoopTransformationDirective::TransformedStatement)
+    .def("snapshot", &OMPLoopTransformationDirective::Snapshot);
+
+  nb::class_<OMPLoopTransformationDirectiveSnapshot, OMPLoopBasedDirectiveSnapshot>(m, "OMPLoopTransformationDirectiveSnapshot")
+    .def_ro("num_associated_loops", &OMPLoopTransformationDirectiveSnapshot::num_associated_loops);
 }
 } // namespace pasta
@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPMaskedDirective(nb::module_ &m) {
-  nb::class_<OMPMaskedDirective, OMPExecutableDirective>(m, "OMPMaskedDirective");
+  nb::class_<OMPMaskedDirective, OMPExecutableDirective>(m, "OMPMaskedDirective")
+    .def("snapshot", &OMPMaskedDirective::Snapshot);
+
+  nb::class_<OMPMaskedDirectiveSnapshot, OMPExecutableDirectiveSnapshot>(m, "OMPMaskedDirectiveSnapshot");
 }
 } // namespace pasta
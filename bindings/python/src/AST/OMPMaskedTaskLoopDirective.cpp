@@ -19,6 +19,10 @@ namespace nb = nanobind;
 
 void RegisterOMPMaskedTaskLoopDirective(nb::module_ &m) {
   nb::class_<OMPMaskedTaskLoopDirective, OMPLoopDirective>(m, "OMPMaskedTaskLoopDirective")
-    .def_prop_ro("has_cancel", &OMPMaskedTaskLoopDirective::HasCancel);
+    .def_prop_ro("has_cancel", &OMPMaskedTaskLoopDirective::HasCancel)
+    .def("snapshot", &OMPMaskedTaskLoopDirective::Snapshot);
+
+  nb::class_<OMPMaskedTaskLoopDirectiveSnapshot, OMPLoopDirectiveSnapshot>(m, "OMPMaskedTaskLoopDirectiveSnapshot")
+    .def_ro("has_cancel", &OMPMaskedTaskLoopDirectiveSnapshot::has_cancel);
 }
 } // namespace pasta
@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPMaskedTaskLoopSimdDirective(nb::module_ &m) {
-  nb::class_<OMPMaskedTaskLoopSimdDirective, OMPLoopDirective>(m, "OMPMaskedTaskLoopSimdDirective");
+  nb::class_<OMPMaskedTaskLoopSimdDirective, OMPLoopDirective>(m, "OMPMaskedTaskLoopSimdDirective")
+    .def("snapshot", &OMPMaskedTaskLoopSimdDirective::Snapshot);
+
+  nb::class_<OMPMaskedTaskLoopSimdDirectiveSnapshot, OMPLoopDirectiveSnapshot>(m, "OMPMaskedTaskLoopSimdDirectiveSnapshot");
 }
 } // namespace pasta
@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPMasterDirective(nb::module_ &m) {
-  nb::class_<OMPMasterDirective, OMPExecutableDirective>(m, "OMPMasterDirective");
+  nb::class_<OMPMasterDirective, OMPExecutableDirective>(m, "OMPMasterDirective")
+    .def("snapshot", &OMPMasterDirective::Snapshot);
+
+  nb::class_<OMPMasterDirectiveSnapshot, OMPExecutableDirectiveSnapshot>(m, "OMPMasterDirectiveSnapshot");
 }
 } // namespace pasta
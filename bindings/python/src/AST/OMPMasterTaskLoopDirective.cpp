@@ -19,6 +19,10 @@ namespace nb = nanobind;
 
 void RegisterOMPMasterTaskLoopDirective(nb::module_ &m) {
   nb::class_<OMPMasterTaskLoopDirective, OMPLoopDirective>(m, "OMPMasterTaskLoopDirective")
-    .def_prop_ro("has_cancel", &OMPMasterTaskLoopDirective::HasCancel);
+    .def_prop_ro("has_cancel", &OMPMasterTaskLoopDirective::HasCancel)
+    .def("snapshot", &OMPMasterTaskLoopDirective::Snapshot);
+
+  nb::class_<OMPMasterTaskLoopDirectiveSnapshot, OMPLoopDirectiveSnapshot>(m, "OMPMasterTaskLoopDirectiveSnapshot")
+    .def_ro("has_cancel", &OMPMasterTaskLoopDirectiveSnapshot::has_cancel);
 }
 } // namespace pasta
@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPMasterTaskLoopSimdDirective(nb::module_ &m) {
-  nb::class_<OMPMasterTaskLoopSimdDirective, OMPLoopDirective>(m, "OMPMasterTaskLoopSimdDirective");
+  nb::class_<OMPMasterTaskLoopSimdDirective, OMPLoopDirective>(m, "OMPMasterTaskLoopSimdDirective")
+    .def("snapshot", &OMPMasterTaskLoopSimdDirective::Snapshot);
+
+  nb::class_<OMPMasterTaskLoopSimdDirectiveSnapshot, OMPLoopDirectiveSnapshot>(m, "OMPMasterTaskLoopSimdDirectiveSnapshot");
 }
 } // namespace pasta
@@ -19,6 +19,9 @@ namespace nb = nanobind;
 
 void RegisterOMPMetaDirective(nb::module_ &m) {
   nb::class_<OMPMetaDirective, OMPExecutableDirective>(m, "OMPMetaDirective")
-    .def_prop_ro("if_statement", &OMPMetaDirective::IfStatement);
+    .def_prop_ro("if_statement", &OMPMetaDirective::IfStatement)
+    .def("snapshot", &OMPMetaDirective::Snapshot);
+
+  nb::class_<OMPMetaDirectiveSnapshot, OMPExecutableDirectiveSnapshot>(m, "OMPMetaDirectiveSnapshot");
 }
 } // namespace pasta
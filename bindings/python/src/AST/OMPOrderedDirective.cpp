@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPOrderedDirective(nb::module_ &m) {
-  nb::class_<OMPOrderedDirective, OMPExecutableDirective>(m, "OMPOrderedDirective");
+  nb::class_<OMPOrderedDirective, OMPExecutableDirective>(m, "OMPOrderedDirective")
+    .def("snapshot", &OMPOrderedDirective::Snapshot);
+
+  nb::class_<OMPOrderedDirectiveSnapshot, OMPExecutableDirectiveSnapshot>(m, "OMPOrderedDirectiveSnapshot");
 }
 } // namespace pasta
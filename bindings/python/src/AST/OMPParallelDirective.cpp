@@ -20,6 +20,10 @@ namespace nb = nanobind;
 void RegisterOMPParallelDirective(nb::module_ &m) {
   nb::class_<OMPParallelDirective, OMPExecutableDirective>(m, "OMPParallelDirective")
     .def_prop_ro("task_reduction_reference_expression", &OMPParallelDirective::TaskReductionReferenceExpression)
-    .def_prop_ro("has_cancel", &OMPParallelDirective::HasCancel);
+    .def_prop_ro("has_cancel", &OMPParallelDirective::HasCancel)
+    .def("snapshot", &OMPParallelDirective::Snapshot);
+
+  nb::class_<OMPParallelDirectiveSnapshot, OMPExecutableDirectiveSnapshot>(m, "OMPParallelDirectiveSnapshot")
+    .def_ro("has_cancel", &OMPParallelDirectiveSnapshot::has_cancel);
 }
 } // namespace pasta
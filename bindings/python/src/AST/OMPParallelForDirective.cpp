@@ -20,6 +20,10 @@ namespace nb = nanobind;
 void RegisterOMPParallelForDirective(nb::module_ &m) {
   nb::class_<OMPParallelForDirective, OMPLoopDirective>(m, "OMPParallelForDirective")
     .def_prop_ro("task_reduction_reference_expression", &OMPParallelForDirective::TaskReductionReferenceExpression)
-    .def_prop_ro("has_cancel", &OMPParallelForDirective::HasCancel);
+    .def_prop_ro("has_cancel", &OMPParallelForDirective::HasCancel)
+    .def("snapshot", &OMPParallelForDirective::Snapshot);
+
+  nb::class_<OMPParallelForDirectiveSnapshot, OMPLoopDirectiveSnapshot>(m, "OMPParallelForDirectiveSnapshot")
+    .def_ro("has_cancel", &OMPParallelForDirectiveSnapshot::has_cancel);
 }
 } // namespace pasta
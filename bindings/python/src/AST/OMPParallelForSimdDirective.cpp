@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPParallelForSimdDirective(nb::module_ &m) {
-  nb::class_<OMPParallelForSimdDirective, OMPLoopDirective>(m, "OMPParallelForSimdDirective");
+  nb::class_<OMPParallelForSimdDirective, OMPLoopDirective>(m, "OMPParallelForSimdDirective")
+    .def("snapshot", &OMPParallelForSimdDirective::Snapshot);
+
+  nb::class_<OMPParallelForSimdDirectiveSnapshot, OMPLoopDirectiveSnapshot>(m, "OMPParallelForSimdDirectiveSnapshot");
 }
 } // namespace pasta
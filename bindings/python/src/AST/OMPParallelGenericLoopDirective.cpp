@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPParallelGenericLoopDirective(nb::module_ &m) {
-  nb::class_<OMPParallelGenericLoopDirective, OMPLoopDirective>(m, "OMPParallelGenericLoopDirective");
+  nb::class_<OMPParallelGenericLoopDirective, OMPLoopDirective>(m, "OMPParallelGenericLoopDirective")
+    .def("snapshot", &OMPParallelGenericLoopDirective::Snapshot);
+
+  nb::class_<OMPParallelGenericLoopDirectiveSnapshot, OMPLoopDirectiveSnapshot>(m, "OMPParallelGenericLoopDirectiveSnapshot");
 }
 } // namespace pasta
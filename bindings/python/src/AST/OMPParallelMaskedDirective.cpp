@@ -19,6 +19,9 @@ namespace nb = nanobind;
 
 void RegisterOMPParallelMaskedDirective(nb::module_ &m) {
   nb::class_<OMPParallelMaskedDirective, OMPExecutableDirective>(m, "OMPParallelMaskedDirective")
-    .def_prop_ro("task_reduction_reference_expression", &OMPParallelMaskedDirective::TaskReductionReferenceExpression);
+    .def_prop_ro("task_reduction_reference_expression", &OMPParallelMaskedDirective::TaskReductionReferenceExpression)
+    .def("snapshot", &OMPParallelMaskedDirective::Snapshot);
+
+  nb::class_<OMPParallelMaskedDirectiveSnapshot, OMPExecutableDirectiveSnapshot>(m, "OMPParallelMaskedDirectiveSnapshot");
 }
 } // namespace pasta
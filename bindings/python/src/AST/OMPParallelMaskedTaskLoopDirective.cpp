@@ -19,6 +19,10 @@ namespace nb = nanobind;
 
 void RegisterOMPParallelMaskedTaskLoopDirective(nb::module_ &m) {
   nb::class_<OMPParallelMaskedTaskLoopDirective, OMPLoopDirective>(m, "OMPParallelMaskedTaskLoopDirective")
-    .def_prop_ro("has_cancel", &OMPParallelMaskedTaskLoopDirective::HasCancel);
+    .def_prop_ro("has_cancel", &OMPParallelMaskedTaskLoopDirective::HasCancel)
+    .def("snapshot", &OMPParallelMaskedTaskLoopDirective::Snapshot);
+
+  nb::class_<OMPParallelMaskedTaskLoopDirectiveSnapshot, OMPLoopDirectiveSnapshot>(m, "OMPParallelMaskedTaskLoopDirectiveSnapshot")
+    .def_ro("has_cancel", &OMPParallelMaskedTaskLoopDirectiveSnapshot::has_cancel);
 }
 } // namespace pasta
@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPParallelMaskedTaskLoopSimdDirective(nb::module_ &m) {
-  nb::class_<OMPParallelMaskedTaskLoopSimdDirective, OMPLoopDirective>(m, "OMPParallelMaskedTaskLoopSimdDirective");
+  nb::class_<OMPParallelMaskedTaskLoopSimdDirective, OMPLoopDirective>(m, "OMPParallelMaskedTaskLoopSimdDirective")
+    .def("snapshot", &OMPParallelMaskedTaskLoopSimdDirective::Snapshot);
+
+  nb::class_<OMPParallelMaskedTaskLoopSimdDirectiveSnapshot, OMPLoopDirectiveSnapshot>(m, "OMPParallelMaskedTaskLoopSimdDirectiveSnapshot");
 }
 } // namespace pasta
@@ -19,6 +19,9 @@ namespace nb = nanobind;
 
 void RegisterOMPParallelMasterDirective(nb::module_ &m) {
   nb::class_<OMPParallelMasterDirective, OMPExecutableDirective>(m, "OMPParallelMasterDirective")
-    .def_prop_ro("task_reduction_reference_expression", &OMPParallelMasterDirective::TaskReductionReferenceExpression);
+    .def_prop_ro("task_reduction_reference_expression", &OMPParallelMasterDirective::TaskReductionReferenceExpression)
+    .def("snapshot", &OMPParallelMasterDirective::Snapshot);
+
+  nb::class_<OMPParallelMasterDirectiveSnapshot, OMPExecutableDirectiveSnapshot>(m, "OMPParallelMasterDirectiveSnapshot");
 }
 } // namespace pasta
@@ -19,6 +19,10 @@ namespace nb = nanobind;
 
 void RegisterOMPParallelMasterTaskLoopDirective(nb::module_ &m) {
   nb::class_<OMPParallelMasterTaskLoopDirective, OMPLoopDirective>(m, "OMPParallelMasterTaskLoopDirective")
-    .def_prop_ro("has_cancel", &OMPParallelMasterTaskLoopDirective::HasCancel);
+    .def_prop_ro("has_cancel", &OMPParallelMasterTaskLoopDirective::HasCancel)
+    .def("snapshot", &OMPParallelMasterTaskLoopDirective::Snapshot);
+
+  nb::class_<OMPParallelMasterTaskLoopDirectiveSnapshot, OMPLoopDirectiveSnapshot>(m, "OMPParallelMasterTaskLoopDirectiveSnapshot")
+    .def_ro("has_cancel", &OMPParallelMasterTaskLoopDirectiveSnapshot::has_cancel);
 }
 } // namespace pasta
@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPParallelMasterTaskLoopSimdDirective(nb::module_ &m) {
-  nb::class_<OMPParallelMasterTaskLoopSimdDirective, OMPLoopDirective>(m, "OMPParallelMasterTaskLoopSimdDirective");
+  nb::class_<OMPParallelMasterTaskLoopSimdDirective, OMPLoopDirective>(m, "OMPParallelMasterTaskLoopSimdDirective")
+    .def("snapshot", &OMPParallelMasterTaskLoopSimdDirective::Snapshot);
+
+  nb::class_<OMPParallelMasterTaskLoopSimdDirectiveSnapshot, OMPLoopDirectiveSnapshot>(m, "OMPParallelMasterTaskLoopSimdDirectiveSnapshot");
 }
 } // namespace pasta
@@ -20,6 +20,10 @@ namespace nb = nanobind;
 void RegisterOMPParallelSectionsDirective(nb::module_ &m) {
   nb::class_<OMPParallelSectionsDirective, OMPExecutableDirective>(m, "OMPParallelSectionsDirective")
     .def_prop_ro("task_reduction_reference_expression", &OMPParallelSectionsDirective::TaskReductionReferenceExpression)
-    .def_prop_ro("has_cancel", &OMPParallelSectionsDirective::HasCancel);
+    .def_prop_ro("has_cancel", &OMPParallelSectionsDirective::HasCancel)
+    .def("snapshot", &OMPParallelSectionsDirective::Snapshot);
+
+  nb::class_<OMPParallelSectionsDirectiveSnapshot, OMPExecutableDirectiveSnapshot>(m, "OMPParallelSectionsDirectiveSnapshot")
+    .def_ro("has_cancel", &OMPParallelSectionsDirectiveSnapshot::has_cancel);
 }
 } // namespace pasta
@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPRequiresDecl(nb::module_ &m) {
-  nb::class_<OMPRequiresDecl, OMPDeclarativeDirectiveDecl>(m, "OMPRequiresDecl");
+  nb::class_<OMPRequiresDecl, OMPDeclarativeDirectiveDecl>(m, "OMPRequiresDecl")
+    .def("snapshot", &OMPRequiresDecl::Snapshot);
+
+  nb::class_<OMPRequiresDeclSnapshot, OMPDeclarativeDirectiveDeclSnapshot>(m, "OMPRequiresDeclSnapshot");
 }
 } // namespace pasta
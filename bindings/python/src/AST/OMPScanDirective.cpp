@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPScanDirective(nb::module_ &m) {
-  nb::class_<OMPScanDirective, OMPExecutableDirective>(m, "OMPScanDirective");
+  nb::class_<OMPScanDirective, OMPExecutableDirective>(m, "OMPScanDirective")
+    .def("snapshot", &OMPScanDirective::Snapshot);
+
+  nb::class_<OMPScanDirectiveSnapshot, OMPExecutableDirectiveSnapshot>(m, "OMPScanDirectiveSnapshot");
 }
 } // namespace pasta
@@ -19,6 +19,10 @@ namespace nb = nanobind;
 
 void RegisterOMPSectionDirective(nb::module_ &m) {
   nb::class_<OMPSectionDirective, OMPExecutableDirective>(m, "OMPSectionDirective")
-    .def_prop_ro("has_cancel", &OMPSectionDirective::HasCancel);
+    .def_prop_ro("has_cancel", &OMPSectionDirective::HasCancel)
+    .def("snapshot", &OMPSectionDirective::Snapshot);
+
+  nb::class_<OMPSectionDirectiveSnapshot, OMPExecutableDirectiveSnapshot>(m, "OMPSectionDirectiveSnapshot")
+    .def_ro("has_cancel", &OMPSectionDirectiveSnapshot::has_cancel);
 }
 } // namespace pasta
@@ -20,6 +20,10 @@ namespace nb = nanobind;
 void RegisterOMPSectionsDirective(nb::module_ &m) {
   nb::class_<OMPSectionsDirective, OMPExecutableDirective>(m, "OMPSectionsDirective")
     .def_prop_ro("task_reduction_reference_expression", &OMPSectionsDirective::TaskReductionReferenceExpression)
-    .def_prop_ro("has_cancel", &OMPSectionsDirective::HasCancel);
+    .def_prop_ro("has_cancel", &OMPSectionsDirective::HasCancel)
+    .def("snapshot", &OMPSectionsDirective::Snapshot);
+
+  nb::class_<OMPSectionsDirectiveSnapshot, OMPExecutableDirectiveSnapshot>(m, "OMPSectionsDirectiveSnapshot")
+    .def_ro("has_cancel", &OMPSectionsDirectiveSnapshot::has_cancel);
 }
 } // namespace pasta
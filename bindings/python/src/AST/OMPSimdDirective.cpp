@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPSimdDirective(nb::module_ &m) {
-  nb::class_<OMPSimdDirective, OMPLoopDirective>(m, "OMPSimdDirective");
+  nb::class_<OMPSimdDirective, OMPLoopDirective>(m, "OMPSimdDirective")
+    .def("snapshot", &OMPSimdDirective::Snapshot);
+
+  nb::class_<OMPSimdDirectiveSnapshot, OMPLoopDirectiveSnapshot>(m, "OMPSimdDirectiveSnapshot");
 }
 } // namespace pasta
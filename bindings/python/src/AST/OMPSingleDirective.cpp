@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPSingleDirective(nb::module_ &m) {
-  nb::class_<OMPSingleDirective, OMPExecutableDirective>(m, "OMPSingleDirective");
+  nb::class_<OMPSingleDirective, OMPExecutableDirective>(m, "OMPSingleDirective")
+    .def("snapshot", &OMPSingleDirective::Snapshot);
+
+  nb::class_<OMPSingleDirectiveSnapshot, OMPExecutableDirectiveSnapshot>(m, "OMPSingleDirectiveSnapshot");
 }
 } // namespace pasta
@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPTargetDataDirective(nb::module_ &m) {
-  nb::class_<OMPTargetDataDirective, OMPExecutableDirective>(m, "OMPTargetDataDirective");
+  nb::class_<OMPTargetDataDirective, OMPExecutableDirective>(m, "OMPTargetDataDirective")
+    .def("snapshot", &OMPTargetDataDirective::Snapshot);
+
+  nb::class_<OMPTargetDataDirectiveSnapshot, OMPExecutableDirectiveSnapshot>(m, "OMPTargetDataDirectiveSnapshot");
 }
 } // namespace pasta
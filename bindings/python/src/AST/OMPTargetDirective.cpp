@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPTargetDirective(nb::module_ &m) {
-  nb::class_<OMPTargetDirective, OMPExecutableDirective>(m, "OMPTargetDirective");
+  nb::class_<OMPTargetDirective, OMPExecutableDirective>(m, "OMPTargetDirective")
+    .def("snapshot", &OMPTargetDirective::Snapshot);
+
+  nb::class_<OMPTargetDirectiveSnapshot, OMPExecutableDirectiveSnapshot>(m, "OMPTargetDirectiveSnapshot");
 }
 } // namespace pasta
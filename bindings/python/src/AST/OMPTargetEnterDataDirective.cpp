@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPTargetEnterDataDirective(nb::module_ &m) {
-  nb::class_<OMPTargetEnterDataDirective, OMPExecutableDirective>(m, "OMPTargetEnterDataDirective");
+  nb::class_<OMPTargetEnterDataDirective, OMPExecutableDirective>(m, "OMPTargetEnterDataDirective")
+    .def("snapshot", &OMPTargetEnterDataDirective::Snapshot);
+
+  nb::class_<OMPTargetEnterDataDirectiveSnapshot, OMPExecutableDirectiveSnapshot>(m, "OMPTargetEnterDataDirectiveSnapshot");
 }
 } // namespace pasta
@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPTargetExitDataDirective(nb::module_ &m) {
-  nb::class_<OMPTargetExitDataDirective, OMPExecutableDirective>(m, "OMPTargetExitDataDirective");
+  nb::class_<OMPTargetExitDataDirective, OMPExecutableDirective>(m, "OMPTargetExitDataDirective")
+    .def("snapshot", &OMPTargetExitDataDirective::Snapshot);
+
+  nb::class_<OMPTargetExitDataDirectiveSnapshot, OMPExecutableDirectiveSnapshot>(m, "OMPTargetExitDataDirectiveSnapshot");
 }
 } // namespace pasta
@@ -20,6 +20,10 @@ namespace nb = nanobind;
 void RegisterOMPTargetParallelDirective(nb::module_ &m) {
   nb::class_<OMPTargetParallelDirective, OMPExecutableDirective>(m, "OMPTargetParallelDirective")
     .def_prop_ro("task_reduction_reference_expression", &OMPTargetParallelDirective::TaskReductionReferenceExpression)
-    .def_prop_ro("has_cancel", &OMPTargetParallelDirective::HasCancel);
+    .def_prop_ro("has_cancel", &OMPTargetParallelDirective::HasCancel)
+    .def("snapshot", &OMPTargetParallelDirective::Snapshot);
+
+  nb::class_<OMPTargetParallelDirectiveSnapshot, OMPExecutableDirectiveSnapshot>(m, "OMPTargetParallelDirectiveSnapshot")
+    .def_ro("has_cancel", &OMPTargetParallelDirectiveSnapshot::has_cancel);
 }
 } // namespace pasta
@@ -20,6 +20,10 @@ namespace nb = nanobind;
 void RegisterOMPTargetParallelForDirective(nb::module_ &m) {
   nb::class_<OMPTargetParallelForDirective, OMPLoopDirective>(m, "OMPTargetParallelForDirective")
     .def_prop_ro("task_reduction_reference_expression", &OMPTargetParallelForDirective::TaskReductionReferenceExpression)
-    .def_prop_ro("has_cancel", &OMPTargetParallelForDirective::HasCancel);
+    .def_prop_ro("has_cancel", &OMPTargetParallelForDirective::HasCancel)
+    .def("snapshot", &OMPTargetParallelForDirective::Snapshot);
+
+  nb::class_<OMPTargetParallelForDirectiveSnapshot, OMPLoopDirectiveSnapshot>(m, "OMPTargetParallelForDirectiveSnapshot")
+    .def_ro("has_cancel", &OMPTargetParallelForDirectiveSnapshot::has_cancel);
 }
 } // namespace pasta
@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPTargetParallelForSimdDirective(nb::module_ &m) {
-  nb::class_<OMPTargetParallelForSimdDirective, OMPLoopDirective>(m, "OMPTargetParallelForSimdDirective");
+  nb::class_<OMPTargetParallelForSimdDirective, OMPLoopDirective>(m, "OMPTargetParallelForSimdDirective")
+    .def("snapshot", &OMPTargetParallelForSimdDirective::Snapshot);
+
+  nb::class_<OMPTargetParallelForSimdDirectiveSnapshot, OMPLoopDirectiveSnapshot>(m, "OMPTargetParallelForSimdDirectiveSnapshot");
 }
 } // namespace pasta
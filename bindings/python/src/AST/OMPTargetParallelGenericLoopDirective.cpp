@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPTargetParallelGenericLoopDirective(nb::module_ &m) {
-  nb::class_<OMPTargetParallelGenericLoopDirective, OMPLoopDirective>(m, "OMPTargetParallelGenericLoopDirective");
+  nb::class_<OMPTargetParallelGenericLoopDirective, OMPLoopDirective>(m, "OMPTargetParallelGenericLoopDirective")
+    .def("snapshot", &OMPTargetParallelGenericLoopDirective::Snapshot);
+
+  nb::class_<OMPTargetParallelGenericLoopDirectiveSnapshot, OMPLoopDirectiveSnapshot>(m, "OMPTargetParallelGenericLoopDirectiveSnapshot");
 }
 } // namespace pasta
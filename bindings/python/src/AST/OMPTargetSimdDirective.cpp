@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPTargetSimdDirective(nb::module_ &m) {
-  nb::class_<OMPTargetSimdDirective, OMPLoopDirective>(m, "OMPTargetSimdDirective");
+  nb::class_<OMPTargetSimdDirective, OMPLoopDirective>(m, "OMPTargetSimdDirective")
+    .def("snapshot", &OMPTargetSimdDirective::Snapshot);
+
+  nb::class_<OMPTargetSimdDirectiveSnapshot, OMPLoopDirectiveSnapshot>(m, "OMPTargetSimdDirectiveSnapshot");
 }
 } // namespace pasta
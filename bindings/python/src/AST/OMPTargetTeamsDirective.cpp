@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPTargetTeamsDirective(nb::module_ &m) {
-  nb::class_<OMPTargetTeamsDirective, OMPExecutableDirective>(m, "OMPTargetTeamsDirective");
+  nb::class_<OMPTargetTeamsDirective, OMPExecutableDirective>(m, "OMPTargetTeamsDirective")
+    .def("snapshot", &OMPTargetTeamsDirective::Snapshot);
+
+  nb::class_<OMPTargetTeamsDirectiveSnapshot, OMPExecutableDirectiveSnapshot>(m, "OMPTargetTeamsDirectiveSnapshot");
 }
 } // namespace pasta
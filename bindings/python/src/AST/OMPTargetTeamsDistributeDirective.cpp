@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPTargetTeamsDistributeDirective(nb::module_ &m) {
-  nb::class_<OMPTargetTeamsDistributeDirective, OMPLoopDirective>(m, "OMPTargetTeamsDistributeDirective");
+  nb::class_<OMPTargetTeamsDistributeDirective, OMPLoopDirective>(m, "OMPTargetTeamsDistributeDirective")
+    .def("snapshot", &OMPTargetTeamsDistributeDirective::Snapshot);
+
+  nb::class_<OMPTargetTeamsDistributeDirectiveSnapshot, OMPLoopDirectiveSnapshot>(m, "OMPTargetTeamsDistributeDirectiveSnapshot");
 }
 } // namespace pasta
@@ -20,6 +20,10 @@ namespace nb = nanobind;
 void RegisterOMPTargetTeamsDistributeParallelForDirective(nb::module_ &m) {
   nb::class_<OMPTargetTeamsDistributeParallelForDirective, OMPLoopDirective>(m, "OMPTargetTeamsDistributeParallelForDirective")
     .def_prop_ro("task_reduction_reference_expression", &OMPTargetTeamsDistributeParallelForDirective::TaskReductionReferenceExpression)
-    .def_prop_ro("has_cancel", &OMPTargetTeamsDistributeParallelForDirective::HasCancel);
+    .def_prop_ro("has_cancel", &OMPTargetTeamsDistributeParallelForDirective::HasCancel)
+    .def("snapshot", &OMPTargetTeamsDistributeParallelForDirective::Snapshot);
+
+  nb::class_<OMPTargetTeamsDistributeParallelForDirectiveSnapshot, OMPLoopDirectiveSnapshot>(m, "OMPTargetTeamsDistributeParallelForDirectiveSnapshot")
+    .def_ro("has_cancel", &OMPTargetTeamsDistributeParallelForDirectiveSnapshot::has_cancel);
 }
 } // namespace pasta
@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPTargetTeamsDistributeParallelForSimdDirective(nb::module_ &m) {
-  nb::class_<OMPTargetTeamsDistributeParallelForSimdDirective, OMPLoopDirective>(m, "OMPTargetTeamsDistributeParallelForSimdDirective");
+  nb::class_<OMPTargetTeamsDistributeParallelForSimdDirective, OMPLoopDirective>(m, "OMPTargetTeamsDistributeParallelForSimdDirective")
+    .def("snapshot", &OMPTargetTeamsDistributeParallelForSimdDirective::Snapshot);
+
+  nb::class_<OMPTargetTeamsDistributeParallelForSimdDirectiveSnapshot, OMPLoopDirectiveSnapshot>(m, "OMPTargetTeamsDistributeParallelForSimdDirectiveSnapshot");
 }
 } // namespace pasta
@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPTargetTeamsDistributeSimdDirective(nb::module_ &m) {
-  nb::class_<OMPTargetTeamsDistributeSimdDirective, OMPLoopDirective>(m, "OMPTargetTeamsDistributeSimdDirective");
+  nb::class_<OMPTargetTeamsDistributeSimdDirective, OMPLoopDirective>(m, "OMPTargetTeamsDistributeSimdDirective")
+    .def("snapshot", &OMPTargetTeamsDistributeSimdDirective::Snapshot);
+
+  nb::class_<OMPTargetTeamsDistributeSimdDirectiveSnapshot, OMPLoopDirectiveSnapshot>(m, "OMPTargetTeamsDistributeSimdDirectiveSnapshot");
 }
 } // namespace pasta
@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPTargetTeamsGenericLoopDirective(nb::module_ &m) {
-  nb::class_<OMPTargetTeamsGenericLoopDirective, OMPLoopDirective>(m, "OMPTargetTeamsGenericLoopDirective");
+  nb::class_<OMPTargetTeamsGenericLoopDirective, OMPLoopDirective>(m, "OMPTargetTeamsGenericLoopDirective")
+    .def("snapshot", &OMPTargetTeamsGenericLoopDirective::Snapshot);
+
+  nb::class_<OMPTargetTeamsGenericLoopDirectiveSnapshot, OMPLoopDirectiveSnapshot>(m, "OMPTargetTeamsGenericLoopDirectiveSnapshot");
 }
 } // namespace pasta
@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPTargetUpdateDirective(nb::module_ &m) {
-  nb::class_<OMPTargetUpdateDirective, OMPExecutableDirective>(m, "OMPTargetUpdateDirective");
+  nb::class_<OMPTargetUpdateDirective, OMPExecutableDirective>(m, "OMPTargetUpdateDirective")
+    .def("snapshot", &OMPTargetUpdateDirective::Snapshot);
+
+  nb::class_<OMPTargetUpdateDirectiveSnapshot, OMPExecutableDirectiveSnapshot>(m, "OMPTargetUpdateDirectiveSnapshot");
 }
 } // namespace pasta
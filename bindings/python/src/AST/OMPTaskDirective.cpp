@@ -19,6 +19,10 @@ namespace nb = nanobind;
 
 void RegisterOMPTaskDirective(nb::module_ &m) {
   nb::class_<OMPTaskDirective, OMPExecutableDirective>(m, "OMPTaskDirective")
-    .def_prop_ro("has_cancel", &OMPTaskDirective::HasCancel);
+    .def_prop_ro("has_cancel", &OMPTaskDirective::HasCancel)
+    .def("snapshot", &OMPTaskDirective::Snapshot);
+
+  nb::class_<OMPTaskDirectiveSnapshot, OMPExecutableDirectiveSnapshot>(m, "OMPTaskDirectiveSnapshot")
+    .def_ro("has_cancel", &OMPTaskDirectiveSnapshot::has_cancel);
 }
 } // namespace pasta
@@ -19,6 +19,10 @@ namespace nb = nanobind;
 
 void RegisterOMPTaskLoopDirective(nb::module_ &m) {
   nb::class_<OMPTaskLoopDirective, OMPLoopDirective>(m, "OMPTaskLoopDirective")
-    .def_prop_ro("has_cancel", &OMPTaskLoopDirective::HasCancel);
+    .def_prop_ro("has_cancel", &OMPTaskLoopDirective::HasCancel)
+    .def("snapshot", &OMPTaskLoopDirective::Snapshot);
+
+  nb::class_<OMPTaskLoopDirectiveSnapshot, OMPLoopDirectiveSnapshot>(m, "OMPTaskLoopDirectiveSnapshot")
+    .def_ro("has_cancel", &OMPTaskLoopDirectiveSnapshot::has_cancel);
 }
 } // namespace pasta
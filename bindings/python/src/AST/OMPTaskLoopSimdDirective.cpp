@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPTaskLoopSimdDirective(nb::module_ &m) {
-  nb::class_<OMPTaskLoopSimdDirective, OMPLoopDirective>(m, "OMPTaskLoopSimdDirective");
+  nb::class_<OMPTaskLoopSimdDirective, OMPLoopDirective>(m, "OMPTaskLoopSimdDirective")
+    .def("snapshot", &OMPTaskLoopSimdDirective::Snapshot);
+
+  nb::class_<OMPTaskLoopSimdDirectiveSnapshot, OMPLoopDirectiveSnapshot>(m, "OMPTaskLoopSimdDirectiveSnapshot");
 }
 } // namespace pasta
@@ -19,6 +19,9 @@ namespace nb = nanobind;
 
 void RegisterOMPTaskgroupDirective(nb::module_ &m) {
   nb::class_<OMPTaskgroupDirective, OMPExecutableDirective>(m, "OMPTaskgroupDirective")
-    .def_prop_ro("reduction_reference", &OMPTaskgroupDirective::ReductionReference);
+    .def_prop_ro("reduction_reference", &OMPTaskgroupDirective::ReductionReference)
+    .def("snapshot", &OMPTaskgroupDirective::Snapshot);
+
+  nb::class_<OMPTaskgroupDirectiveSnapshot, OMPExecutableDirectiveSnapshot>(m, "OMPTaskgroupDirectiveSnapshot");
 }
 } // namespace pasta
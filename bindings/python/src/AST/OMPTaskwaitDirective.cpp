@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPTaskwaitDirective(nb::module_ &m) {
-  nb::class_<OMPTaskwaitDirective, OMPExecutableDirective>(m, "OMPTaskwaitDirective");
+  nb::class_<OMPTaskwaitDirective, OMPExecutableDirective>(m, "OMPTaskwaitDirective")
+    .def("snapshot", &OMPTaskwaitDirective::Snapshot);
+
+  nb::class_<OMPTaskwaitDirectiveSnapshot, OMPExecutableDirectiveSnapshot>(m, "OMPTaskwaitDirectiveSnapshot");
 }
 } // namespace pasta
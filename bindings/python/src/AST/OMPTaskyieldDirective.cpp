@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPTaskyieldDirective(nb::module_ &m) {
-  nb::class_<OMPTaskyieldDirective, OMPExecutableDirective>(m, "OMPTaskyieldDirective");
+  nb::class_<OMPTaskyieldDirective, OMPExecutableDirective>(m, "OMPTaskyieldDirective")
+    .def("snapshot", &OMPTaskyieldDirective::Snapshot);
+
+  nb::class_<OMPTaskyieldDirectiveSnapshot, OMPExecutableDirectiveSnapshot>(m, "OMPTaskyieldDirectiveSnapshot");
 }
 } // namespace pasta
@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPTeamsDirective(nb::module_ &m) {
-  nb::class_<OMPTeamsDirective, OMPExecutableDirective>(m, "OMPTeamsDirective");
+  nb::class_<OMPTeamsDirective, OMPExecutableDirective>(m, "OMPTeamsDirective")
+    .def("snapshot", &OMPTeamsDirective::Snapshot);
+
+  nb::class_<OMPTeamsDirectiveSnapshot, OMPExecutableDirectiveSnapshot>(m, "OMPTeamsDirectiveSnapshot");
 }
 } // namespace pasta
@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPTeamsDistributeDirective(nb::module_ &m) {
-  nb::class_<OMPTeamsDistributeDirective, OMPLoopDirective>(m, "OMPTeamsDistributeDirective");
+  nb::class_<OMPTeamsDistributeDirective, OMPLoopDirective>(m, "OMPTeamsDistributeDirective")
+    .def("snapshot", &OMPTeamsDistributeDirective::Snapshot);
+
+  nb::class_<OMPTeamsDistributeDirectiveSnapshot, OMPLoopDirectiveSnapshot>(m, "OMPTeamsDistributeDirectiveSnapshot");
 }
 } // namespace pasta
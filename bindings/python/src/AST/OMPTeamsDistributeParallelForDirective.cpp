@@ -20,6 +20,10 @@ namespace nb = nanobind;
 void RegisterOMPTeamsDistributeParallelForDirective(nb::module_ &m) {
   nb::class_<OMPTeamsDistributeParallelForDirective, OMPLoopDirective>(m, "OMPTeamsDistributeParallelForDirective")
     .def_prop_ro("task_reduction_reference_expression", &OMPTeamsDistributeParallelForDirective::TaskReductionReferenceExpression)
-    .def_prop_ro("has_cancel", &OMPTeamsDistributeParallelForDirective::HasCancel);
+    .def_prop_ro("has_cancel", &OMPTeamsDistributeParallelForDirective::HasCancel)
+    .def("snapshot", &OMPTeamsDistributeParallelForDirective::Snapshot);
+
+  nb::class_<OMPTeamsDistributeParallelForDirectiveSnapshot, OMPLoopDirectiveSnapshot>(m, "OMPTeamsDistributeParallelForDirectiveSnapshot")
+    .def_ro("has_cancel", &OMPTeamsDistributeParallelForDirectiveSnapshot::has_cancel);
 }
 } // namespace pasta
@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPTeamsDistributeParallelForSimdDirective(nb::module_ &m) {
-  nb::class_<OMPTeamsDistributeParallelForSimdDirective, OMPLoopDirective>(m, "OMPTeamsDistributeParallelForSimdDirective");
+  nb::class_<OMPTeamsDistributeParallelForSimdDirective, OMPLoopDirective>(m, "OMPTeamsDistributeParallelForSimdDirective")
+    .def("snapshot", &OMPTeamsDistributeParallelForSimdDirective::Snapshot);
+
+  nb::class_<OMPTeamsDistributeParallelForSimdDirectiveSnapshot, OMPLoopDirectiveSnapshot>(m, "OMPTeamsDistributeParallelForSimdDirectiveSnapshot");
 }
 } // namespace pasta
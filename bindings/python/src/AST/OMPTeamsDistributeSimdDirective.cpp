@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPTeamsDistributeSimdDirective(nb::module_ &m) {
-  nb::class_<OMPTeamsDistributeSimdDirective, OMPLoopDirective>(m, "OMPTeamsDistributeSimdDirective");
+  nb::class_<OMPTeamsDistributeSimdDirective, OMPLoopDirective>(m, "OMPTeamsDistributeSimdDirective")
+    .def("snapshot", &OMPTeamsDistributeSimdDirective::Snapshot);
+
+  nb::class_<OMPTeamsDistributeSimdDirectiveSnapshot, OMPLoopDirectiveSnapshot>(m, "OMPTeamsDistributeSimdDirectiveSnapshot");
 }
 } // namespace pasta
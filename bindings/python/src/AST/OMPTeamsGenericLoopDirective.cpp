@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterOMPTeamsGenericLoopDirective(nb::module_ &m) {
-  nb::class_<OMPTeamsGenericLoopDirective, OMPLoopDirective>(m, "OMPTeamsGenericLoopDirective");
+  nb::class_<OMPTeamsGenericLoopDirective, OMPLoopDirective>(m, "OMPTeamsGenericLoopDirective")
+    .def("snapshot", &OMPTeamsGenericLoopDirective::Snapshot);
+
+  nb::class_<OMPTeamsGenericLoopDirectiveSnapshot, OMPLoopDirectiveSnapshot>(m, "OMPTeamsGenericLoopDirectiveSnapshot");
 }
 } // namespace pasta
@@ -19,6 +19,9 @@ namespace nb = nanobind;
 
 void RegisterOMPThreadPrivateDecl(nb::module_ &m) {
   nb::class_<OMPThreadPrivateDecl, OMPDeclarativeDirectiveDecl>(m, "OMPThreadPrivateDecl")
-    .def_prop_ro("varlists", &OMPThreadPrivateDecl::Varlists);
+    .def_prop_ro("varlists", &OMPThreadPrivateDecl::Varlists)
+    .def("snapshot", &OMPThreadPrivateDecl::Snapshot);
+
+  nb::class_<OMPThreadPrivateDeclSnapshot, OMPDeclarativeDirectiveDeclSnapshot>(m, "OMPThreadPrivateDeclSnapshot");
 }
 } // namespace pasta
@@ -20,6 +20,9 @@ namespace nb = nanobind;
 void RegisterOMPTileDirective(nb::module_ &m) {
   nb::class_<OMPTileDirective, OMPLoopTransformationDirective>(m, "OMPTileDirective")
     .def_prop_ro("pre_initializers", &OMPTileDirective::PreInitializers)
-    .def_prop_ro("transformed_statement", &OMPTileDirective::TransformedStatement);
+    .def_prop_ro("transformed_statement", &OMPTileDirective::TransformedStatement)
+    .def("snapshot", &OMPTileDirective::Snapshot);
+
+  nb::class_<OMPTileDirectiveSnapshot, OMPLoopTransformationDirectiveSnapshot>(m, "OMPTileDirectiveSnapshot");
 }
 } // namespace pasta
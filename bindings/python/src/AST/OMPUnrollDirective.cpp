@@ -20,6 +20,9 @@ namespace nb = nanobind;
 void RegisterOMPUnrollDirective(nb::module_ &m) {
   nb::class_<OMPUnrollDirective, OMPLoopTransformationDirective>(m, "OMPUnrollDirective")
     .def_prop_ro("pre_initializers", &OMPUnrollDirective::PreInitializers)
-    .def_prop_ro("transformed_statement", &OMPUnrollDirective::TransformedStatement);
+    .def_prop_ro("transformed_statement", &OMPUnrollDirective::TransformedStatement)
+    .def("snapshot", &OMPUnrollDirective::Snapshot);
+
+  nb::class_<OMPUnrollDirectiveSnapshot, OMPLoopTransformationDirectiveSnapshot>(m, "OMPUnrollDirectiveSnapshot");
 }
 } // namespace pasta
@@ -24,6 +24,10 @@ void RegisterObjCArrayLiteral(nb::module_ &m) {
     .def_prop_ro("begin_token", &ObjCArrayLiteral::BeginToken)
     .def_prop_ro("end_token", &ObjCArrayLiteral::EndToken)
     .def_prop_ro("num_elements", &ObjCArrayLiteral::NumElements)
-    .def_prop_ro("tokens", &ObjCArrayLiteral::Tokens);
+    .def_prop_ro("tokens", &ObjCArrayLiteral::Tokens)
+    .def("snapshot", &ObjCArrayLiteral::Snapshot);
+
+  nb::class_<ObjCArrayLiteralSnapshot, ExprSnapshot>(m, "ObjCArrayLiteralSnapshot")
+    .def_ro("num_elements", &ObjCArrayLiteralSnapshot::num_elements);
 }
 } // namespace pasta
@@ -26,6 +26,12 @@ void RegisterObjCAtCatchStmt(nb::module_ &m) {
     .def_prop_ro("catch_parameter_declaration", &ObjCAtCatchStmt::CatchParameterDeclaration)
     .def_prop_ro("end_token", &ObjCAtCatchStmt::EndToken)
     .def_prop_ro("r_paren_token", &ObjCAtCatchStmt::RParenToken)
-    .def_prop_ro("has_ellipsis", &ObjCAtCatchStmt::HasEllipsis);
+    .def_prop_ro("has_ellipsis", &ObjCAtCatchStmt::HasEllipsis)
+    .def("snapshot", &ObjCAtCatchStmt::Snapshot);
+
+  nb::class_<ObjCAtCatchStmtSnapshot, StmtSnapshot>(m, "ObjCAtCatchStmtSnapshot")
+    .def_ro("at_catch_token", &ObjCAtCatchStmtSnapshot::at_catch_token)
+    .def_ro("r_paren_token", &ObjCAtCatchStmtSnapshot::r_paren_token)
+    .def_ro("has_ellipsis", &ObjCAtCatchStmtSnapshot::has_ellipsis);
 }
 } // namespace pasta
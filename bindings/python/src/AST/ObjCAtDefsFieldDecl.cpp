@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterObjCAtDefsFieldDecl(nb::module_ &m) {
-  nb::class_<ObjCAtDefsFieldDecl, FieldDecl>(m, "ObjCAtDefsFieldDecl");
+  nb::class_<ObjCAtDefsFieldDecl, FieldDecl>(m, "ObjCAtDefsFieldDecl")
+    .def("snapshot", &ObjCAtDefsFieldDecl::Snapshot);
+
+  nb::class_<ObjCAtDefsFieldDeclSnapshot, FieldDeclSnapshot>(m, "ObjCAtDefsFieldDeclSnapshot");
 }
 } // namespace pasta
@@ -23,6 +23,10 @@ void RegisterObjCAtFinallyStmt(nb::module_ &m) {
     .def_prop_ro("at_finally_token", &ObjCAtFinallyStmt::AtFinallyToken)
     .def_prop_ro("begin_token", &ObjCAtFinallyStmt::BeginToken)
     .def_prop_ro("end_token", &ObjCAtFinallyStmt::EndToken)
-    .def_prop_ro("finally_body", &ObjCAtFinallyStmt::FinallyBody);
+    .def_prop_ro("finally_body", &ObjCAtFinallyStmt::FinallyBody)
+    .def("snapshot", &ObjCAtFinallyStmt::Snapshot);
+
+  nb::class_<ObjCAtFinallyStmtSnapshot, StmtSnapshot>(m, "ObjCAtFinallyStmtSnapshot")
+    .def_ro("at_finally_token", &ObjCAtFinallyStmtSnapshot::at_finally_token);
 }
 } // namespace pasta
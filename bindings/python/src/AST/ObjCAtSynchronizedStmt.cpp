@@ -24,6 +24,10 @@ void RegisterObjCAtSynchronizedStmt(nb::module_ &m) {
     .def_prop_ro("begin_token", &ObjCAtSynchronizedStmt::BeginToken)
     .def_prop_ro("end_token", &ObjCAtSynchronizedStmt::EndToken)
     .def_prop_ro("synch_body", &ObjCAtSynchronizedStmt::SynchBody)
-    .def_prop_ro("synch_expression", &ObjCAtSynchronizedStmt::SynchExpression);
+    .def_prop_ro("synch_expression", &ObjCAtSynchronizedStmt::SynchExpression)
+    .def("snapshot", &ObjCAtSynchronizedStmt::Snapshot);
+
+  nb::class_<ObjCAtSynchronizedStmtSnapshot, StmtSnapshot>(m, "ObjCAtSynchronizedStmtSnapshot")
+    .def_ro("at_synchronized_token", &ObjCAtSynchronizedStmtSnapshot::at_synchronized_token);
 }
 } // namespace pasta
@@ -23,6 +23,10 @@ void RegisterObjCAtThrowStmt(nb::module_ &m) {
     .def_prop_ro("begin_token", &ObjCAtThrowStmt::BeginToken)
     .def_prop_ro("end_token", &ObjCAtThrowStmt::EndToken)
     .def_prop_ro("throw_expression", &ObjCAtThrowStmt::ThrowExpression)
-    .def_prop_ro("throw_token", &ObjCAtThrowStmt::ThrowToken);
+    .def_prop_ro("throw_token", &ObjCAtThrowStmt::ThrowToken)
+    .def("snapshot", &ObjCAtThrowStmt::Snapshot);
+
+  nb::class_<ObjCAtThrowStmtSnapshot, StmtSnapshot>(m, "ObjCAtThrowStmtSnapshot")
+    .def_ro("throw_token", &ObjCAtThrowStmtSnapshot::throw_token);
 }
 } // namespace pasta
@@ -25,6 +25,11 @@ void RegisterObjCAtTryStmt(nb::module_ &m) {
     .def_prop_ro("end_token", &ObjCAtTryStmt::EndToken)
     .def_prop_ro("finally_statement", &ObjCAtTryStmt::FinallyStatement)
     .def_prop_ro("num_catch_statements", &ObjCAtTryStmt::NumCatchStatements)
-    .def_prop_ro("try_body", &ObjCAtTryStmt::TryBody);
+    .def_prop_ro("try_body", &ObjCAtTryStmt::TryBody)
+    .def("snapshot", &ObjCAtTryStmt::Snapshot);
+
+  nb::class_<ObjCAtTryStmtSnapshot, StmtSnapshot>(m, "ObjCAtTryStmtSnapshot")
+    .def_ro("at_try_token", &ObjCAtTryStmtSnapshot::at_try_token)
+    .def_ro("num_catch_statements", &ObjCAtTryStmtSnapshot::num_catch_statements);
 }
 } // namespace pasta
@@ -23,6 +23,10 @@ void RegisterObjCAutoreleasePoolStmt(nb::module_ &m) {
     .def_prop_ro("at_token", &ObjCAutoreleasePoolStmt::AtToken)
     .def_prop_ro("begin_token", &ObjCAutoreleasePoolStmt::BeginToken)
     .def_prop_ro("end_token", &ObjCAutoreleasePoolStmt::EndToken)
-    .def_prop_ro("sub_statement", &ObjCAutoreleasePoolStmt::SubStatement);
+    .def_prop_ro("sub_statement", &ObjCAutoreleasePoolStmt::SubStatement)
+    .def("snapshot", &ObjCAutoreleasePoolStmt::Snapshot);
+
+  nb::class_<ObjCAutoreleasePoolStmtSnapshot, StmtSnapshot>(m, "ObjCAutoreleasePoolStmtSnapshot")
+    .def_ro("at_token", &ObjCAutoreleasePoolStmtSnapshot::at_token);
 }
 } // namespace pasta
@@ -23,6 +23,10 @@ void RegisterObjCAvailabilityCheckExpr(nb::module_ &m) {
     .def_prop_ro("begin_token", &ObjCAvailabilityCheckExpr::BeginToken)
     .def_prop_ro("end_token", &ObjCAvailabilityCheckExpr::EndToken)
     .def_prop_ro("tokens", &ObjCAvailabilityCheckExpr::Tokens)
-    .def_prop_ro("has_version", &ObjCAvailabilityCheckExpr::HasVersion);
+    .def_prop_ro("has_version", &ObjCAvailabilityCheckExpr::HasVersion)
+    .def("snapshot", &ObjCAvailabilityCheckExpr::Snapshot);
+
+  nb::class_<ObjCAvailabilityCheckExprSnapshot, ExprSnapshot>(m, "ObjCAvailabilityCheckExprSnapshot")
+    .def_ro("has_version", &ObjCAvailabilityCheckExprSnapshot::has_version);
 }
 } // namespace pasta
@@ -23,6 +23,11 @@ void RegisterObjCBoolLiteralExpr(nb::module_ &m) {
     .def_prop_ro("begin_token", &ObjCBoolLiteralExpr::BeginToken)
     .def_prop_ro("end_token", &ObjCBoolLiteralExpr::EndToken)
     .def_prop_ro("token", &ObjCBoolLiteralExpr::Token)
-    .def_prop_ro("value", &ObjCBoolLiteralExpr::Value);
+    .def_prop_ro("value", &ObjCBoolLiteralExpr::Value)
+    .def("snapshot", &ObjCBoolLiteralExpr::Snapshot);
+
+  nb::class_<ObjCBoolLiteralExprSnapshot, ExprSnapshot>(m, "ObjCBoolLiteralExprSnapshot")
+    .def_ro("token", &ObjCBoolLiteralExprSnapshot::token)
+    .def_ro("value", &ObjCBoolLiteralExprSnapshot::value);
 }
 } // namespace pasta
@@ -26,6 +26,11 @@ void RegisterObjCBoxedExpr(nb::module_ &m) {
     .def_prop_ro("end_token", &ObjCBoxedExpr::EndToken)
     .def_prop_ro("tokens", &ObjCBoxedExpr::Tokens)
     .def_prop_ro("sub_expression", &ObjCBoxedExpr::SubExpression)
-    .def_prop_ro("is_expressible_as_constant_initializer", &ObjCBoxedExpr::IsExpressibleAsConstantInitializer);
+    .def_prop_ro("is_expressible_as_constant_initializer", &ObjCBoxedExpr::IsExpressibleAsConstantInitializer)
+    .def("snapshot", &ObjCBoxedExpr::Snapshot);
+
+  nb::class_<ObjCBoxedExprSnapshot, ExprSnapshot>(m, "ObjCBoxedExprSnapshot")
+    .def_ro("at_token", &ObjCBoxedExprSnapshot::at_token)
+    .def_ro("is_expressible_as_constant_initializer", &ObjCBoxedExprSnapshot::is_expressible_as_constant_initializer);
 }
 } // namespace pasta
@@ -24,6 +24,12 @@ void RegisterObjCBridgedCastExpr(nb::module_ &m) {
     .def_prop_ro("bridge_kind", &ObjCBridgedCastExpr::BridgeKind)
     .def_prop_ro("bridge_kind_name", &ObjCBridgedCastExpr::BridgeKindName)
     .def_prop_ro("end_token", &ObjCBridgedCastExpr::EndToken)
-    .def_prop_ro("l_paren_token", &ObjCBridgedCastExpr::LParenToken);
+    .def_prop_ro("l_paren_token", &ObjCBridgedCastExpr::LParenToken)
+    .def("snapshot", &ObjCBridgedCastExpr::Snapshot);
+
+  nb::class_<ObjCBridgedCastExprSnapshot, ExplicitCastExprSnapshot>(m, "ObjCBridgedCastExprSnapshot")
+    .def_ro("bridge_keyword_token", &ObjCBridgedCastExprSnapshot::bridge_keyword_token)
+    .def_ro("bridge_kind", &ObjCBridgedCastExprSnapshot::bridge_kind)
+    .def_ro("l_paren_token", &ObjCBridgedCastExprSnapshot::l_paren_token);
 }
 } // namespace pasta
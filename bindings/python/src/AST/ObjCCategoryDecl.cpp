@@ -29,6 +29,13 @@ void RegisterObjCCategoryDecl(nb::module_ &m) {
     .def_prop_ro("next_class_category_raw", &ObjCCategoryDecl::NextClassCategoryRaw)
     .def_prop_ro("instance_variables", &ObjCCategoryDecl::InstanceVariables)
     .def_prop_ro("protocol_tokens", &ObjCCategoryDecl::ProtocolTokens)
-    .def_prop_ro("protocols", &ObjCCategoryDecl::Protocols);
+    .def_prop_ro("protocols", &ObjCCategoryDecl::Protocols)
+    .def("snapshot", &ObjCCategoryDecl::Snapshot);
+
+  nb::class_<ObjCCategoryDeclSnapshot, ObjCContainerDeclSnapshot>(m, "ObjCCategoryDeclSnapshot")
+    .def_ro("is_class_extension", &ObjCCategoryDeclSnapshot::is_class_extension)
+    .def_ro("category_name_token", &ObjCCategoryDeclSnapshot::category_name_token)
+    .def_ro("instance_variable_l_brace_token", &ObjCCategoryDeclSnapshot::instance_variable_l_brace_token)
+    .def_ro("instance_variable_r_brace_token", &ObjCCategoryDeclSnapshot::instance_variable_r_brace_token);
 }
 } // namespace pasta
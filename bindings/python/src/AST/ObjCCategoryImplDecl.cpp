@@ -20,6 +20,10 @@ namespace nb = nanobind;
 void RegisterObjCCategoryImplDecl(nb::module_ &m) {
   nb::class_<ObjCCategoryImplDecl, ObjCImplDecl>(m, "ObjCCategoryImplDecl")
     .def_prop_ro("category_declaration", &ObjCCategoryImplDecl::CategoryDeclaration)
-    .def_prop_ro("category_name_token", &ObjCCategoryImplDecl::CategoryNameToken);
+    .def_prop_ro("category_name_token", &ObjCCategoryImplDecl::CategoryNameToken)
+    .def("snapshot", &ObjCCategoryImplDecl::Snapshot);
+
+  nb::class_<ObjCCategoryImplDeclSnapshot, ObjCImplDeclSnapshot>(m, "ObjCCategoryImplDeclSnapshot")
+    .def_ro("category_name_token", &ObjCCategoryImplDeclSnapshot::category_name_token);
 }
 } // namespace pasta
@@ -19,6 +19,9 @@ namespace nb = nanobind;
 
 void RegisterObjCCompatibleAliasDecl(nb::module_ &m) {
   nb::class_<ObjCCompatibleAliasDecl, NamedDecl>(m, "ObjCCompatibleAliasDecl")
-    .def_prop_ro("class_interface", &ObjCCompatibleAliasDecl::ClassInterface);
+    .def_prop_ro("class_interface", &ObjCCompatibleAliasDecl::ClassInterface)
+    .def("snapshot", &ObjCCompatibleAliasDecl::Snapshot);
+
+  nb::class_<ObjCCompatibleAliasDeclSnapshot, NamedDeclSnapshot>(m, "ObjCCompatibleAliasDeclSnapshot");
 }
 } // namespace pasta
@@ -26,6 +26,10 @@ void RegisterObjCContainerDecl(nb::module_ &m) {
     .def_prop_ro("instance_methods", &ObjCContainerDecl::InstanceMethods)
     .def_prop_ro("instance_properties", &ObjCContainerDecl::InstanceProperties)
     .def_prop_ro("methods", &ObjCContainerDecl::Methods)
-    .def_prop_ro("properties", &ObjCContainerDecl::Properties);
+    .def_prop_ro("properties", &ObjCContainerDecl::Properties)
+    .def("snapshot", &ObjCContainerDecl::Snapshot);
+
+  nb::class_<ObjCContainerDeclSnapshot, NamedDeclSnapshot>(m, "ObjCContainerDeclSnapshot")
+    .def_ro("at_start_token", &ObjCContainerDeclSnapshot::at_start_token);
 }
 } // namespace pasta
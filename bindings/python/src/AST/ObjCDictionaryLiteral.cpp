@@ -24,6 +24,10 @@ void RegisterObjCDictionaryLiteral(nb::module_ &m) {
     .def_prop_ro("dictionary_with_objects_method", &ObjCDictionaryLiteral::DictionaryWithObjectsMethod)
     .def_prop_ro("end_token", &ObjCDictionaryLiteral::EndToken)
     .def_prop_ro("num_elements", &ObjCDictionaryLiteral::NumElements)
-    .def_prop_ro("tokens", &ObjCDictionaryLiteral::Tokens);
+    .def_prop_ro("tokens", &ObjCDictionaryLiteral::Tokens)
+    .def("snapshot", &ObjCDictionaryLiteral::Snapshot);
+
+  nb::class_<ObjCDictionaryLiteralSnapshot, ExprSnapshot>(m, "ObjCDictionaryLiteralSnapshot")
+    .def_ro("num_elements", &ObjCDictionaryLiteralSnapshot::num_elements);
 }
 } // namespace pasta
@@ -24,6 +24,11 @@ void RegisterObjCEncodeExpr(nb::module_ &m) {
     .def_prop_ro("begin_token", &ObjCEncodeExpr::BeginToken)
     .def_prop_ro("encoded_type", &ObjCEncodeExpr::EncodedType)
     .def_prop_ro("end_token", &ObjCEncodeExpr::EndToken)
-    .def_prop_ro("r_paren_token", &ObjCEncodeExpr::RParenToken);
+    .def_prop_ro("r_paren_token", &ObjCEncodeExpr::RParenToken)
+    .def("snapshot", &ObjCEncodeExpr::Snapshot);
+
+  nb::class_<ObjCEncodeExprSnapshot, ExprSnapshot>(m, "ObjCEncodeExprSnapshot")
+    .def_ro("at_token", &ObjCEncodeExprSnapshot::at_token)
+    .def_ro("r_paren_token", &ObjCEncodeExprSnapshot::r_paren_token);
 }
 } // namespace pasta
@@ -26,6 +26,11 @@ void RegisterObjCForCollectionStmt(nb::module_ &m) {
     .def_prop_ro("element", &ObjCForCollectionStmt::Element)
     .def_prop_ro("end_token", &ObjCForCollectionStmt::EndToken)
     .def_prop_ro("for_token", &ObjCForCollectionStmt::ForToken)
-    .def_prop_ro("r_paren_token", &ObjCForCollectionStmt::RParenToken);
+    .def_prop_ro("r_paren_token", &ObjCForCollectionStmt::RParenToken)
+    .def("snapshot", &ObjCForCollectionStmt::Snapshot);
+
+  nb::class_<ObjCForCollectionStmtSnapshot, StmtSnapshot>(m, "ObjCForCollectionStmtSnapshot")
+    .def_ro("for_token", &ObjCForCollectionStmtSnapshot::for_token)
+    .def_ro("r_paren_token", &ObjCForCollectionStmtSnapshot::r_paren_token);
 }
 } // namespace pasta
@@ -20,6 +20,9 @@ namespace nb = nanobind;
 void RegisterObjCImplDecl(nb::module_ &m) {
   nb::class_<ObjCImplDecl, ObjCContainerDecl>(m, "ObjCImplDecl")
     .def_prop_ro("class_interface", &ObjCImplDecl::ClassInterface)
-    .def_prop_ro("property_implementations", &ObjCImplDecl::PropertyImplementations);
+    .def_prop_ro("property_implementations", &ObjCImplDecl::PropertyImplementations)
+    .def("snapshot", &ObjCImplDecl::Snapshot);
+
+  nb::class_<ObjCImplDeclSnapshot, ObjCContainerDeclSnapshot>(m, "ObjCImplDeclSnapshot");
 }
 } // namespace pasta
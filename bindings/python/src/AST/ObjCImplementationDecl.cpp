@@ -28,6 +28,15 @@ void RegisterObjCImplementationDecl(nb::module_ &m) {
     .def_prop_ro("super_class_token", &ObjCImplementationDecl::SuperClassToken)
     .def_prop_ro("has_destructors", &ObjCImplementationDecl::HasDestructors)
     .def_prop_ro("has_non_zero_constructors", &ObjCImplementationDecl::HasNonZeroConstructors)
-    .def_prop_ro("instance_variables", &ObjCImplementationDecl::InstanceVariables);
+    .def_prop_ro("instance_variables", &ObjCImplementationDecl::InstanceVariables)
+    .def("snapshot", &ObjCImplementationDecl::Snapshot);
+
+  nb::class_<ObjCImplementationDeclSnapshot, ObjCImplDeclSnapshot>(m, "ObjCImplementationDeclSnapshot")
+    .def_ro("instance_variable_l_brace_token", &ObjCImplementationDeclSnapshot::instance_variable_l_brace_token)
+    .def_ro("instance_variable_r_brace_token", &ObjCImplementationDeclSnapshot::instance_variable_r_brace_token)
+    .def_ro("num_instance_variable_initializers", &ObjCImplementationDeclSnapshot::num_instance_variable_initializers)
+    .def_ro("super_class_token", &ObjCImplementationDeclSnapshot::super_class_token)
+    .def_ro("has_destructors", &ObjCImplementationDeclSnapshot::has_destructors)
+    .def_ro("has_non_zero_constructors", &ObjCImplementationDeclSnapshot::has_non_zero_constructors);
 }
 } // namespace pasta
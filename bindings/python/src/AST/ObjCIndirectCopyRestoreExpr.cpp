@@ -24,6 +24,10 @@ void RegisterObjCIndirectCopyRestoreExpr(nb::module_ &m) {
     .def_prop_ro("end_token", &ObjCIndirectCopyRestoreExpr::EndToken)
     .def_prop_ro("expression_token", &ObjCIndirectCopyRestoreExpr::ExpressionToken)
     .def_prop_ro("sub_expression", &ObjCIndirectCopyRestoreExpr::SubExpression)
-    .def_prop_ro("should_copy", &ObjCIndirectCopyRestoreExpr::ShouldCopy);
+    .def_prop_ro("should_copy", &ObjCIndirectCopyRestoreExpr::ShouldCopy)
+    .def("snapshot", &ObjCIndirectCopyRestoreExpr::Snapshot);
+
+  nb::class_<ObjCIndirectCopyRestoreExprSnapshot, ExprSnapshot>(m, "ObjCIndirectCopyRestoreExprSnapshot")
+    .def_ro("should_copy", &ObjCIndirectCopyRestoreExprSnapshot::should_copy);
 }
 } // namespace pasta
@@ -44,6 +44,17 @@ void RegisterObjCInterfaceDecl(nb::module_ &m) {
     .def_prop_ro("protocol_tokens", &ObjCInterfaceDecl::ProtocolTokens)
     .def_prop_ro("protocols", &ObjCInterfaceDecl::Protocols)
     .def_prop_ro("visible_categories", &ObjCInterfaceDecl::VisibleCategories)
-    .def_prop_ro("visible_extensions", &ObjCInterfaceDecl::VisibleExtensions);
+    .def_prop_ro("visible_extensions", &ObjCInterfaceDecl::VisibleExtensions)
+    .def("snapshot", &ObjCInterfaceDecl::Snapshot);
+
+  nb::class_<ObjCInterfaceDeclSnapshot, ObjCContainerDeclSnapshot>(m, "ObjCInterfaceDeclSnapshot")
+    .def_ro("declares_or_inherits_designated_initializers", &ObjCInterfaceDeclSnapshot::declares_or_inherits_designated_initializers)
+    .def_ro("end_of_definition_token", &ObjCInterfaceDeclSnapshot::end_of_definition_token)
+    .def_ro("super_class_token", &ObjCInterfaceDeclSnapshot::super_class_token)
+    .def_ro("has_definition", &ObjCInterfaceDeclSnapshot::has_definition)
+    .def_ro("has_designated_initializers", &ObjCInterfaceDeclSnapshot::has_designated_initializers)
+    .def_ro("is_arc_weakref_unavailable", &ObjCInterfaceDeclSnapshot::is_arc_weakref_unavailable)
+    .def_ro("is_implicit_interface_declaration", &ObjCInterfaceDeclSnapshot::is_implicit_interface_declaration)
+    .def_ro("is_this_declaration_a_definition", &ObjCInterfaceDeclSnapshot::is_this_declaration_a_definition);
 }
 } // namespace pasta
@@ -27,6 +27,13 @@ void RegisterObjCIsaExpr(nb::module_ &m) {
     .def_prop_ro("expression_token", &ObjCIsaExpr::ExpressionToken)
     .def_prop_ro("isa_member_token", &ObjCIsaExpr::IsaMemberToken)
     .def_prop_ro("operation_token", &ObjCIsaExpr::OperationToken)
-    .def_prop_ro("is_arrow", &ObjCIsaExpr::IsArrow);
+    .def_prop_ro("is_arrow", &ObjCIsaExpr::IsArrow)
+    .def("snapshot", &ObjCIsaExpr::Snapshot);
+
+  nb::class_<ObjCIsaExprSnapshot, ExprSnapshot>(m, "ObjCIsaExprSnapshot")
+    .def_ro("base_token_end", &ObjCIsaExprSnapshot::base_token_end)
+    .def_ro("isa_member_token", &ObjCIsaExprSnapshot::isa_member_token)
+    .def_ro("operation_token", &ObjCIsaExprSnapshot::operation_token)
+    .def_ro("is_arrow", &ObjCIsaExprSnapshot::is_arrow);
 }
 } // namespace pasta
@@ -24,6 +24,12 @@ void RegisterObjCIvarDecl(nb::module_ &m) {
     .def_prop_ro("canonical_declaration", &ObjCIvarDecl::CanonicalDeclaration)
     .def_prop_ro("containing_interface", &ObjCIvarDecl::ContainingInterface)
     .def_prop_ro("next_instance_variable", &ObjCIvarDecl::NextInstanceVariable)
-    .def_prop_ro("synthesize", &ObjCIvarDecl::Synthesize);
+    .def_prop_ro("synthesize", &ObjCIvarDecl::Synthesize)
+    .def("snapshot", &ObjCIvarDecl::Snapshot);
+
+  nb::class_<ObjCIvarDeclSnapshot, FieldDeclSnapshot>(m, "ObjCIvarDeclSnapshot")
+    .def_ro("access_control", &ObjCIvarDeclSnapshot::access_control)
+    .def_ro("canonical_access_control", &ObjCIvarDeclSnapshot::canonical_access_control)
+    .def_ro("synthesize", &ObjCIvarDeclSnapshot::synthesize);
 }
 } // namespace pasta
@@ -27,6 +27,13 @@ void RegisterObjCIvarRefExpr(nb::module_ &m) {
     .def_prop_ro("token", &ObjCIvarRefExpr::Token)
     .def_prop_ro("operation_token", &ObjCIvarRefExpr::OperationToken)
     .def_prop_ro("is_arrow", &ObjCIvarRefExpr::IsArrow)
-    .def_prop_ro("is_free_instance_variable", &ObjCIvarRefExpr::IsFreeInstanceVariable);
+    .def_prop_ro("is_free_instance_variable", &ObjCIvarRefExpr::IsFreeInstanceVariable)
+    .def("snapshot", &ObjCIvarRefExpr::Snapshot);
+
+  nb::class_<ObjCIvarRefExprSnapshot, ExprSnapshot>(m, "ObjCIvarRefExprSnapshot")
+    .def_ro("token", &ObjCIvarRefExprSnapshot::token)
+    .def_ro("operation_token", &ObjCIvarRefExprSnapshot::operation_token)
+    .def_ro("is_arrow", &ObjCIvarRefExprSnapshot::is_arrow)
+    .def_ro("is_free_instance_variable", &ObjCIvarRefExprSnapshot::is_free_instance_variable);
 }
 } // namespace pasta
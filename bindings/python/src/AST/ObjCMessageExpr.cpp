@@ -42,6 +42,21 @@ void RegisterObjCMessageExpr(nb::module_ &m) {
     .def_prop_ro("is_class_message", &ObjCMessageExpr::IsClassMessage)
     .def_prop_ro("is_delegate_initializer_call", &ObjCMessageExpr::IsDelegateInitializerCall)
     .def_prop_ro("is_implicit", &ObjCMessageExpr::IsImplicit)
-    .def_prop_ro("is_instance_message", &ObjCMessageExpr::IsInstanceMessage);
+    .def_prop_ro("is_instance_message", &ObjCMessageExpr::IsInstanceMessage)
+    .def("snapshot", &ObjCMessageExpr::Snapshot);
+
+  nb::class_<ObjCMessageExprSnapshot, ExprSnapshot>(m, "ObjCMessageExprSnapshot")
+    .def_ro("left_token", &ObjCMessageExprSnapshot::left_token)
+    .def_ro("method_family", &ObjCMessageExprSnapshot::method_family)
+    .def_ro("num_arguments", &ObjCMessageExprSnapshot::num_arguments)
+    .def_ro("num_selector_tokens", &ObjCMessageExprSnapshot::num_selector_tokens)
+    .def_ro("receiver_kind", &ObjCMessageExprSnapshot::receiver_kind)
+    .def_ro("right_token", &ObjCMessageExprSnapshot::right_token)
+    .def_ro("selector_start_token", &ObjCMessageExprSnapshot::selector_start_token)
+    .def_ro("super_token", &ObjCMessageExprSnapshot::super_token)
+    .def_ro("is_class_message", &ObjCMessageExprSnapshot::is_class_message)
+    .def_ro("is_delegate_initializer_call", &ObjCMessageExprSnapshot::is_delegate_initializer_call)
+    .def_ro("is_implicit", &ObjCMessageExprSnapshot::is_implicit)
+    .def_ro("is_instance_message", &ObjCMessageExprSnapshot::is_instance_message);
 }
 } // namespace pasta
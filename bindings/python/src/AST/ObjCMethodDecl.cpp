@@ -53,6 +53,33 @@ void RegisterObjCMethodDecl(nb::module_ &m) {
     .def_prop_ro("is_this_declaration_a_definition", &ObjCMethodDecl::IsThisDeclarationADefinition)
     .def_prop_ro("is_this_declaration_a_designated_initializer", &ObjCMethodDecl::IsThisDeclarationADesignatedInitializer)
     .def_prop_ro("is_variadic", &ObjCMethodDecl::IsVariadic)
-    .def_prop_ro("parameters", &ObjCMethodDecl::Parameters);
+    .def_prop_ro("parameters", &ObjCMethodDecl::Parameters)
+    .def("snapshot", &ObjCMethodDecl::Snapshot);
+
+  nb::class_<ObjCMethodDeclSnapshot, NamedDeclSnapshot>(m, "ObjCMethodDeclSnapshot")
+    .def_ro("defined_in_ns_object", &ObjCMethodDeclSnapshot::defined_in_ns_object)
+    .def_ro("declarator_end_token", &ObjCMethodDeclSnapshot::declarator_end_token)
+    .def_ro("implementation_control", &ObjCMethodDeclSnapshot::implementation_control)
+    .def_ro("method_family", &ObjCMethodDeclSnapshot::method_family)
+    .def_ro("num_selector_tokens", &ObjCMethodDeclSnapshot::num_selector_tokens)
+    .def_ro("obj_c_decl_qualifier", &ObjCMethodDeclSnapshot::obj_c_decl_qualifier)
+    .def_ro("selector_start_token", &ObjCMethodDeclSnapshot::selector_start_token)
+    .def_ro("has_parameter_destroyed_in_callee", &ObjCMethodDeclSnapshot::has_parameter_destroyed_in_callee)
+    .def_ro("has_redeclaration", &ObjCMethodDeclSnapshot::has_redeclaration)
+    .def_ro("has_related_result_type", &ObjCMethodDeclSnapshot::has_related_result_type)
+    .def_ro("has_skipped_body", &ObjCMethodDeclSnapshot::has_skipped_body)
+    .def_ro("is_class_method", &ObjCMethodDeclSnapshot::is_class_method)
+    .def_ro("is_defined", &ObjCMethodDeclSnapshot::is_defined)
+    .def_ro("is_designated_initializer_for_the_interface", &ObjCMethodDeclSnapshot::is_designated_initializer_for_the_interface)
+    .def_ro("is_direct_method", &ObjCMethodDeclSnapshot::is_direct_method)
+    .def_ro("is_instance_method", &ObjCMethodDeclSnapshot::is_instance_method)
+    .def_ro("is_optional", &ObjCMethodDeclSnapshot::is_optional)
+    .def_ro("is_overriding", &ObjCMethodDeclSnapshot::is_overriding)
+    .def_ro("is_property_accessor", &ObjCMethodDeclSnapshot::is_property_accessor)
+    .def_ro("is_redeclaration", &ObjCMethodDeclSnapshot::is_redeclaration)
+    .def_ro("is_synthesized_accessor_stub", &ObjCMethodDeclSnapshot::is_synthesized_accessor_stub)
+    .def_ro("is_this_declaration_a_definition", &ObjCMethodDeclSnapshot::is_this_declaration_a_definition)
+    .def_ro("is_this_declaration_a_designated_initializer", &ObjCMethodDeclSnapshot::is_this_declaration_a_designated_initializer)
+    .def_ro("is_variadic", &ObjCMethodDeclSnapshot::is_variadic);
 }
 } // namespace pasta
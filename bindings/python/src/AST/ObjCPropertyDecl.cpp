@@ -36,6 +36,23 @@ void RegisterObjCPropertyDecl(nb::module_ &m) {
     .def_prop_ro("is_instance_property", &ObjCPropertyDecl::IsInstanceProperty)
     .def_prop_ro("is_optional", &ObjCPropertyDecl::IsOptional)
     .def_prop_ro("is_read_only", &ObjCPropertyDecl::IsReadOnly)
-    .def_prop_ro("is_retaining", &ObjCPropertyDecl::IsRetaining);
+    .def_prop_ro("is_retaining", &ObjCPropertyDecl::IsRetaining)
+    .def("snapshot", &ObjCPropertyDecl::Snapshot);
+
+  nb::class_<ObjCPropertyDeclSnapshot, NamedDeclSnapshot>(m, "ObjCPropertyDeclSnapshot")
+    .def_ro("at_token", &ObjCPropertyDeclSnapshot::at_token)
+    .def_ro("getter_name_token", &ObjCPropertyDeclSnapshot::getter_name_token)
+    .def_ro("l_paren_token", &ObjCPropertyDeclSnapshot::l_paren_token)
+    .def_ro("property_implementation", &ObjCPropertyDeclSnapshot::property_implementation)
+    .def_ro("query_kind", &ObjCPropertyDeclSnapshot::query_kind)
+    .def_ro("setter_kind", &ObjCPropertyDeclSnapshot::setter_kind)
+    .def_ro("setter_name_token", &ObjCPropertyDeclSnapshot::setter_name_token)
+    .def_ro("is_atomic", &ObjCPropertyDeclSnapshot::is_atomic)
+    .def_ro("is_class_property", &ObjCPropertyDeclSnapshot::is_class_property)
+    .def_ro("is_direct_property", &ObjCPropertyDeclSnapshot::is_direct_property)
+    .def_ro("is_instance_property", &ObjCPropertyDeclSnapshot::is_instance_property)
+    .def_ro("is_optional", &ObjCPropertyDeclSnapshot::is_optional)
+    .def_ro("is_read_only", &ObjCPropertyDeclSnapshot::is_read_only)
+    .def_ro("is_retaining", &ObjCPropertyDeclSnapshot::is_retaining);
 }
 } // namespace pasta
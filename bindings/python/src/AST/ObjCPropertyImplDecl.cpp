@@ -28,6 +28,12 @@ void RegisterObjCPropertyImplDecl(nb::module_ &m) {
     .def_prop_ro("property_instance_variable_declaration_token", &ObjCPropertyImplDecl::PropertyInstanceVariableDeclarationToken)
     .def_prop_ro("setter_cxx_assignment", &ObjCPropertyImplDecl::SetterCXXAssignment)
     .def_prop_ro("setter_method_declaration", &ObjCPropertyImplDecl::SetterMethodDeclaration)
-    .def_prop_ro("is_instance_variable_name_specified", &ObjCPropertyImplDecl::IsInstanceVariableNameSpecified);
+    .def_prop_ro("is_instance_variable_name_specified", &ObjCPropertyImplDecl::IsInstanceVariableNameSpecified)
+    .def("snapshot", &ObjCPropertyImplDecl::Snapshot);
+
+  nb::class_<ObjCPropertyImplDeclSnapshot, DeclSnapshot>(m, "ObjCPropertyImplDeclSnapshot")
+    .def_ro("property_implementation", &ObjCPropertyImplDeclSnapshot::property_implementation)
+    .def_ro("property_instance_variable_declaration_token", &ObjCPropertyImplDeclSnapshot::property_instance_variable_declaration_token)
+    .def_ro("is_instance_variable_name_specified", &ObjCPropertyImplDeclSnapshot::is_instance_variable_name_specified);
 }
 } // namespace pasta
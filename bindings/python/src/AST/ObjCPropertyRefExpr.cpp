@@ -37,6 +37,18 @@ void RegisterObjCPropertyRefExpr(nb::module_ &m) {
     .def_prop_ro("is_messaging_getter", &ObjCPropertyRefExpr::IsMessagingGetter)
     .def_prop_ro("is_messaging_setter", &ObjCPropertyRefExpr::IsMessagingSetter)
     .def_prop_ro("is_object_receiver", &ObjCPropertyRefExpr::IsObjectReceiver)
-    .def_prop_ro("is_super_receiver", &ObjCPropertyRefExpr::IsSuperReceiver);
+    .def_prop_ro("is_super_receiver", &ObjCPropertyRefExpr::IsSuperReceiver)
+    .def("snapshot", &ObjCPropertyRefExpr::Snapshot);
+
+  nb::class_<ObjCPropertyRefExprSnapshot, ExprSnapshot>(m, "ObjCPropertyRefExprSnapshot")
+    .def_ro("token", &ObjCPropertyRefExprSnapshot::token)
+    .def_ro("receiver_token", &ObjCPropertyRefExprSnapshot::receiver_token)
+    .def_ro("is_class_receiver", &ObjCPropertyRefExprSnapshot::is_class_receiver)
+    .def_ro("is_explicit_property", &ObjCPropertyRefExprSnapshot::is_explicit_property)
+    .def_ro("is_implicit_property", &ObjCPropertyRefExprSnapshot::is_implicit_property)
+    .def_ro("is_messaging_getter", &ObjCPropertyRefExprSnapshot::is_messaging_getter)
+    .def_ro("is_messaging_setter", &ObjCPropertyRefExprSnapshot::is_messaging_setter)
+    .def_ro("is_object_receiver", &ObjCPropertyRefExprSnapshot::is_object_receiver)
+    .def_ro("is_super_receiver", &ObjCPropertyRefExprSnapshot::is_super_receiver);
 }
 } // namespace pasta
@@ -26,6 +26,12 @@ void RegisterObjCProtocolDecl(nb::module_ &m) {
     .def_prop_ro("is_non_runtime_protocol", &ObjCProtocolDecl::IsNonRuntimeProtocol)
     .def_prop_ro("is_this_declaration_a_definition", &ObjCProtocolDecl::IsThisDeclarationADefinition)
     .def_prop_ro("protocol_tokens", &ObjCProtocolDecl::ProtocolTokens)
-    .def_prop_ro("protocols", &ObjCProtocolDecl::Protocols);
+    .def_prop_ro("protocols", &ObjCProtocolDecl::Protocols)
+    .def("snapshot", &ObjCProtocolDecl::Snapshot);
+
+  nb::class_<ObjCProtocolDeclSnapshot, ObjCContainerDeclSnapshot>(m, "ObjCProtocolDeclSnapshot")
+    .def_ro("has_definition", &ObjCProtocolDeclSnapshot::has_definition)
+    .def_ro("is_non_runtime_protocol", &ObjCProtocolDeclSnapshot::is_non_runtime_protocol)
+    .def_ro("is_this_declaration_a_definition", &ObjCProtocolDeclSnapshot::is_this_declaration_a_definition);
 }
 } // namespace pasta
@@ -25,6 +25,12 @@ void RegisterObjCProtocolExpr(nb::module_ &m) {
     .def_prop_ro("end_token", &ObjCProtocolExpr::EndToken)
     .def_prop_ro("protocol", &ObjCProtocolExpr::Protocol)
     .def_prop_ro("protocol_id_token", &ObjCProtocolExpr::ProtocolIdToken)
-    .def_prop_ro("r_paren_token", &ObjCProtocolExpr::RParenToken);
+    .def_prop_ro("r_paren_token", &ObjCProtocolExpr::RParenToken)
+    .def("snapshot", &ObjCProtocolExpr::Snapshot);
+
+  nb::class_<ObjCProtocolExprSnapshot, ExprSnapshot>(m, "ObjCProtocolExprSnapshot")
+    .def_ro("at_token", &ObjCProtocolExprSnapshot::at_token)
+    .def_ro("protocol_id_token", &ObjCProtocolExprSnapshot::protocol_id_token)
+    .def_ro("r_paren_token", &ObjCProtocolExprSnapshot::r_paren_token);
 }
 } // namespace pasta
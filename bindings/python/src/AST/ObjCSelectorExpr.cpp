@@ -24,6 +24,12 @@ void RegisterObjCSelectorExpr(nb::module_ &m) {
     .def_prop_ro("begin_token", &ObjCSelectorExpr::BeginToken)
     .def_prop_ro("end_token", &ObjCSelectorExpr::EndToken)
     .def_prop_ro("num_arguments", &ObjCSelectorExpr::NumArguments)
-    .def_prop_ro("r_paren_token", &ObjCSelectorExpr::RParenToken);
+    .def_prop_ro("r_paren_token", &ObjCSelectorExpr::RParenToken)
+    .def("snapshot", &ObjCSelectorExpr::Snapshot);
+
+  nb::class_<ObjCSelectorExprSnapshot, ExprSnapshot>(m, "ObjCSelectorExprSnapshot")
+    .def_ro("at_token", &ObjCSelectorExprSnapshot::at_token)
+    .def_ro("num_arguments", &ObjCSelectorExprSnapshot::num_arguments)
+    .def_ro("r_paren_token", &ObjCSelectorExprSnapshot::r_paren_token);
 }
 } // namespace pasta
@@ -23,6 +23,10 @@ void RegisterObjCStringLiteral(nb::module_ &m) {
     .def_prop_ro("at_token", &ObjCStringLiteral::AtToken)
     .def_prop_ro("begin_token", &ObjCStringLiteral::BeginToken)
     .def_prop_ro("end_token", &ObjCStringLiteral::EndToken)
-    .def_prop_ro("string", &ObjCStringLiteral::String);
+    .def_prop_ro("string", &ObjCStringLiteral::String)
+    .def("snapshot", &ObjCStringLiteral::Snapshot);
+
+  nb::class_<ObjCStringLiteralSnapshot, ExprSnapshot>(m, "ObjCStringLiteralSnapshot")
+    .def_ro("at_token", &ObjCStringLiteralSnapshot::at_token);
 }
 } // namespace pasta
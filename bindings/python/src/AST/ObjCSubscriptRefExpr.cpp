@@ -26,6 +26,11 @@ void RegisterObjCSubscriptRefExpr(nb::module_ &m) {
     .def_prop_ro("end_token", &ObjCSubscriptRefExpr::EndToken)
     .def_prop_ro("key_expression", &ObjCSubscriptRefExpr::KeyExpression)
     .def_prop_ro("r_bracket_token", &ObjCSubscriptRefExpr::RBracketToken)
-    .def_prop_ro("is_array_subscript_reference_expression", &ObjCSubscriptRefExpr::IsArraySubscriptReferenceExpression);
+    .def_prop_ro("is_array_subscript_reference_expression", &ObjCSubscriptRefExpr::IsArraySubscriptReferenceExpression)
+    .def("snapshot", &ObjCSubscriptRefExpr::Snapshot);
+
+  nb::class_<ObjCSubscriptRefExprSnapshot, ExprSnapshot>(m, "ObjCSubscriptRefExprSnapshot")
+    .def_ro("r_bracket_token", &ObjCSubscriptRefExprSnapshot::r_bracket_token)
+    .def_ro("is_array_subscript_reference_expression", &ObjCSubscriptRefExprSnapshot::is_array_subscript_reference_expression);
 }
 } // namespace pasta
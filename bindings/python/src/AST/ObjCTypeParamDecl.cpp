@@ -23,6 +23,14 @@ void RegisterObjCTypeParamDecl(nb::module_ &m) {
     .def_prop_ro("index", &ObjCTypeParamDecl::Index)
     .def_prop_ro("variance", &ObjCTypeParamDecl::Variance)
     .def_prop_ro("variance_token", &ObjCTypeParamDecl::VarianceToken)
-    .def_prop_ro("has_explicit_bound", &ObjCTypeParamDecl::HasExplicitBound);
+    .def_prop_ro("has_explicit_bound", &ObjCTypeParamDecl::HasExplicitBound)
+    .def("snapshot", &ObjCTypeParamDecl::Snapshot);
+
+  nb::class_<ObjCTypeParamDeclSnapshot, TypedefNameDeclSnapshot>(m, "ObjCTypeParamDeclSnapshot")
+    .def_ro("colon_token", &ObjCTypeParamDeclSnapshot::colon_token)
+    .def_ro("index", &ObjCTypeParamDeclSnapshot::index)
+    .def_ro("variance", &ObjCTypeParamDeclSnapshot::variance)
+    .def_ro("variance_token", &ObjCTypeParamDeclSnapshot::variance_token)
+    .def_ro("has_explicit_bound", &ObjCTypeParamDeclSnapshot::has_explicit_bound);
 }
 } // namespace pasta
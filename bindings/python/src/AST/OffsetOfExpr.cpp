@@ -25,6 +25,13 @@ void RegisterOffsetOfExpr(nb::module_ &m) {
     .def_prop_ro("num_components", &OffsetOfExpr::NumComponents)
     .def_prop_ro("num_expressions", &OffsetOfExpr::NumExpressions)
     .def_prop_ro("operator_token", &OffsetOfExpr::OperatorToken)
-    .def_prop_ro("r_paren_token", &OffsetOfExpr::RParenToken);
+    .def_prop_ro("r_paren_token", &OffsetOfExpr::RParenToken)
+    .def("snapshot", &OffsetOfExpr::Snapshot);
+
+  nb::class_<OffsetOfExprSnapshot, ExprSnapshot>(m, "OffsetOfExprSnapshot")
+    .def_ro("num_components", &OffsetOfExprSnapshot::num_components)
+    .def_ro("num_expressions", &OffsetOfExprSnapshot::num_expressions)
+    .def_ro("operator_token", &OffsetOfExprSnapshot::operator_token)
+    .def_ro("r_paren_token", &OffsetOfExprSnapshot::r_paren_token);
 }
 } // namespace pasta
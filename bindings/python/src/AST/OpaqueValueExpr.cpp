@@ -25,6 +25,11 @@ void RegisterOpaqueValueExpr(nb::module_ &m) {
     .def_prop_ro("expression_token", &OpaqueValueExpr::ExpressionToken)
     .def_prop_ro("token", &OpaqueValueExpr::Token)
     .def_prop_ro("source_expression", &OpaqueValueExpr::SourceExpression)
-    .def_prop_ro("is_unique", &OpaqueValueExpr::IsUnique);
+    .def_prop_ro("is_unique", &OpaqueValueExpr::IsUnique)
+    .def("snapshot", &OpaqueValueExpr::Snapshot);
+
+  nb::class_<OpaqueValueExprSnapshot, ExprSnapshot>(m, "OpaqueValueExprSnapshot")
+    .def_ro("token", &OpaqueValueExprSnapshot::token)
+    .def_ro("is_unique", &OpaqueValueExprSnapshot::is_unique);
 }
 } // namespace pasta
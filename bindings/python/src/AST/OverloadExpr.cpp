@@ -27,6 +27,17 @@ void RegisterOverloadExpr(nb::module_ &m) {
     .def_prop_ro("r_angle_token", &OverloadExpr::RAngleToken)
     .def_prop_ro("template_keyword_token", &OverloadExpr::TemplateKeywordToken)
     .def_prop_ro("has_explicit_template_arguments", &OverloadExpr::HasExplicitTemplateArguments)
-    .def_prop_ro("has_template_keyword", &OverloadExpr::HasTemplateKeyword);
+    .def_prop_ro("has_template_keyword", &OverloadExpr::HasTemplateKeyword)
+    .def("snapshot", &OverloadExpr::Snapshot);
+
+  nb::class_<OverloadExprSnapshot, ExprSnapshot>(m, "OverloadExprSnapshot")
+    .def_ro("l_angle_token", &OverloadExprSnapshot::l_angle_token)
+    .def_ro("name_token", &OverloadExprSnapshot::name_token)
+    .def_ro("num_declarations", &OverloadExprSnapshot::num_declarations)
+    .def_ro("num_template_arguments", &OverloadExprSnapshot::num_template_arguments)
+    .def_ro("r_angle_token", &OverloadExprSnapshot::r_angle_token)
+    .def_ro("template_keyword_token", &OverloadExprSnapshot::template_keyword_token)
+    .def_ro("has_explicit_template_arguments", &OverloadExprSnapshot::has_explicit_template_arguments)
+    .def_ro("has_template_keyword", &OverloadExprSnapshot::has_template_keyword);
 }
 } // namespace pasta
@@ -24,6 +24,10 @@ void RegisterPackExpansionExpr(nb::module_ &m) {
     .def_prop_ro("ellipsis_token", &PackExpansionExpr::EllipsisToken)
     .def_prop_ro("end_token", &PackExpansionExpr::EndToken)
     .def_prop_ro("num_expansions", &PackExpansionExpr::NumExpansions)
-    .def_prop_ro("pattern", &PackExpansionExpr::Pattern);
+    .def_prop_ro("pattern", &PackExpansionExpr::Pattern)
+    .def("snapshot", &PackExpansionExpr::Snapshot);
+
+  nb::class_<PackExpansionExprSnapshot, ExprSnapshot>(m, "PackExpansionExprSnapshot")
+    .def_ro("ellipsis_token", &PackExpansionExprSnapshot::ellipsis_token);
 }
 } // namespace pasta
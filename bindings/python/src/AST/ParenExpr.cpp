@@ -24,6 +24,11 @@ void RegisterParenExpr(nb::module_ &m) {
     .def_prop_ro("end_token", &ParenExpr::EndToken)
     .def_prop_ro("l_paren_token", &ParenExpr::LParenToken)
     .def_prop_ro("r_paren_token", &ParenExpr::RParenToken)
-    .def_prop_ro("sub_expression", &ParenExpr::SubExpression);
+    .def_prop_ro("sub_expression", &ParenExpr::SubExpression)
+    .def("snapshot", &ParenExpr::Snapshot);
+
+  nb::class_<ParenExprSnapshot, ExprSnapshot>(m, "ParenExprSnapshot")
+    .def_ro("l_paren_token", &ParenExprSnapshot::l_paren_token)
+    .def_ro("r_paren_token", &ParenExprSnapshot::r_paren_token);
 }
 } // namespace pasta
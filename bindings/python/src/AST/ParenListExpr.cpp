@@ -24,6 +24,12 @@ void RegisterParenListExpr(nb::module_ &m) {
     .def_prop_ro("end_token", &ParenListExpr::EndToken)
     .def_prop_ro("l_paren_token", &ParenListExpr::LParenToken)
     .def_prop_ro("num_expressions", &ParenListExpr::NumExpressions)
-    .def_prop_ro("r_paren_token", &ParenListExpr::RParenToken);
+    .def_prop_ro("r_paren_token", &ParenListExpr::RParenToken)
+    .def("snapshot", &ParenListExpr::Snapshot);
+
+  nb::class_<ParenListExprSnapshot, ExprSnapshot>(m, "ParenListExprSnapshot")
+    .def_ro("l_paren_token", &ParenListExprSnapshot::l_paren_token)
+    .def_ro("num_expressions", &ParenListExprSnapshot::num_expressions)
+    .def_ro("r_paren_token", &ParenListExprSnapshot::r_paren_token);
 }
 } // namespace pasta
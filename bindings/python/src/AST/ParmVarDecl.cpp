@@ -32,6 +32,19 @@ void RegisterParmVarDecl(nb::module_ &m) {
     .def_prop_ro("has_unparsed_default_argument", &ParmVarDecl::HasUnparsedDefaultArgument)
     .def_prop_ro("is_destroyed_in_callee", &ParmVarDecl::IsDestroyedInCallee)
     .def_prop_ro("is_knr_promoted", &ParmVarDecl::IsKNRPromoted)
-    .def_prop_ro("is_obj_c_method_parameter", &ParmVarDecl::IsObjCMethodParameter);
+    .def_prop_ro("is_obj_c_method_parameter", &ParmVarDecl::IsObjCMethodParameter)
+    .def("snapshot", &ParmVarDecl::Snapshot);
+
+  nb::class_<ParmVarDeclSnapshot, VarDeclSnapshot>(m, "ParmVarDeclSnapshot")
+    .def_ro("function_scope_depth", &ParmVarDeclSnapshot::function_scope_depth)
+    .def_ro("function_scope_index", &ParmVarDeclSnapshot::function_scope_index)
+    .def_ro("obj_c_decl_qualifier", &ParmVarDeclSnapshot::obj_c_decl_qualifier)
+    .def_ro("has_default_argument", &ParmVarDeclSnapshot::has_default_argument)
+    .def_ro("has_inherited_default_argument", &ParmVarDeclSnapshot::has_inherited_default_argument)
+    .def_ro("has_uninstantiated_default_argument", &ParmVarDeclSnapshot::has_uninstantiated_default_argument)
+    .def_ro("has_unparsed_default_argument", &ParmVarDeclSnapshot::has_unparsed_default_argument)
+    .def_ro("is_destroyed_in_callee", &ParmVarDeclSnapshot::is_destroyed_in_callee)
+    .def_ro("is_knr_promoted", &ParmVarDeclSnapshot::is_knr_promoted)
+    .def_ro("is_obj_c_method_parameter", &ParmVarDeclSnapshot::is_obj_c_method_parameter);
 }
 } // namespace pasta
@@ -20,6 +20,10 @@ namespace nb = nanobind;
 void RegisterPragmaCommentDecl(nb::module_ &m) {
   nb::class_<PragmaCommentDecl, Decl>(m, "PragmaCommentDecl")
     .def_prop_ro("argument", &PragmaCommentDecl::Argument)
-    .def_prop_ro("comment_kind", &PragmaCommentDecl::CommentKind);
+    .def_prop_ro("comment_kind", &PragmaCommentDecl::CommentKind)
+    .def("snapshot", &PragmaCommentDecl::Snapshot);
+
+  nb::class_<PragmaCommentDeclSnapshot, DeclSnapshot>(m, "PragmaCommentDeclSnapshot")
+    .def_ro("comment_kind", &PragmaCommentDeclSnapshot::comment_kind);
 }
 } // namespace pasta
@@ -20,6 +20,9 @@ namespace nb = nanobind;
 void RegisterPragmaDetectMismatchDecl(nb::module_ &m) {
   nb::class_<PragmaDetectMismatchDecl, Decl>(m, "PragmaDetectMismatchDecl")
     .def_prop_ro("name", &PragmaDetectMismatchDecl::Name)
-    .def_prop_ro("value", &PragmaDetectMismatchDecl::Value);
+    .def_prop_ro("value", &PragmaDetectMismatchDecl::Value)
+    .def("snapshot", &PragmaDetectMismatchDecl::Snapshot);
+
+  nb::class_<PragmaDetectMismatchDeclSnapshot, DeclSnapshot>(m, "PragmaDetectMismatchDeclSnapshot");
 }
 } // namespace pasta
@@ -26,6 +26,12 @@ void RegisterPredefinedExpr(nb::module_ &m) {
     .def_prop_ro("identifier_kind", &PredefinedExpr::IdentifierKind)
     .def_prop_ro("identifier_kind_name", &PredefinedExpr::IdentifierKindName)
     .def_prop_ro("token", &PredefinedExpr::Token)
-    .def_prop_ro("is_transparent", &PredefinedExpr::IsTransparent);
+    .def_prop_ro("is_transparent", &PredefinedExpr::IsTransparent)
+    .def("snapshot", &PredefinedExpr::Snapshot);
+
+  nb::class_<PredefinedExprSnapshot, ExprSnapshot>(m, "PredefinedExprSnapshot")
+    .def_ro("identifier_kind", &PredefinedExprSnapshot::identifier_kind)
+    .def_ro("token", &PredefinedExprSnapshot::token)
+    .def_ro("is_transparent", &PredefinedExprSnapshot::is_transparent);
 }
 } // namespace pasta
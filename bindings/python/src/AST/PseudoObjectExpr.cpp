@@ -27,6 +27,11 @@ void RegisterPseudoObjectExpr(nb::module_ &m) {
     .def_prop_ro("result_expression", &PseudoObjectExpr::ResultExpression)
     .def_prop_ro("result_expression_index", &PseudoObjectExpr::ResultExpressionIndex)
     .def_prop_ro("syntactic_form", &PseudoObjectExpr::SyntacticForm)
-    .def_prop_ro("semantics", &PseudoObjectExpr::Semantics);
+    .def_prop_ro("semantics", &PseudoObjectExpr::Semantics)
+    .def("snapshot", &PseudoObjectExpr::Snapshot);
+
+  nb::class_<PseudoObjectExprSnapshot, ExprSnapshot>(m, "PseudoObjectExprSnapshot")
+    .def_ro("num_semantic_expressions", &PseudoObjectExprSnapshot::num_semantic_expressions)
+    .def_ro("result_expression_index", &PseudoObjectExprSnapshot::result_expression_index);
 }
 } // namespace pasta
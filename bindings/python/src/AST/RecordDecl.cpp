@@ -47,6 +47,30 @@ void RegisterRecordDecl(nb::module_ &m) {
     .def_prop_ro("is_or_contains_union", &RecordDecl::IsOrContainsUnion)
     .def_prop_ro("is_parameter_destroyed_in_callee", &RecordDecl::IsParameterDestroyedInCallee)
     .def_prop_ro("is_randomized", &RecordDecl::IsRandomized)
-    .def_prop_ro("may_insert_extra_padding", &RecordDecl::MayInsertExtraPadding);
+    .def_prop_ro("may_insert_extra_padding", &RecordDecl::MayInsertExtraPadding)
+    .def("snapshot", &RecordDecl::Snapshot);
+
+  nb::class_<RecordDeclSnapshot, TagDeclSnapshot>(m, "RecordDeclSnapshot")
+    .def_ro("can_pass_in_registers", &RecordDeclSnapshot::can_pass_in_registers)
+    .def_ro("argument_passing_restrictions", &RecordDeclSnapshot::argument_passing_restrictions)
+    .def_ro("has_flexible_array_member", &RecordDeclSnapshot::has_flexible_array_member)
+    .def_ro("has_loaded_fields_from_external_storage", &RecordDeclSnapshot::has_loaded_fields_from_external_storage)
+    .def_ro("has_non_trivial_to_primitive_copy_c_union", &RecordDeclSnapshot::has_non_trivial_to_primitive_copy_c_union)
+    .def_ro("has_non_trivial_to_primitive_default_initialize_c_union", &RecordDeclSnapshot::has_non_trivial_to_primitive_default_initialize_c_union)
+    .def_ro("has_non_trivial_to_primitive_destruct_c_union", &RecordDeclSnapshot::has_non_trivial_to_primitive_destruct_c_union)
+    .def_ro("has_object_member", &RecordDeclSnapshot::has_object_member)
+    .def_ro("has_volatile_member", &RecordDeclSnapshot::has_volatile_member)
+    .def_ro("is_anonymous_struct_or_union", &RecordDeclSnapshot::is_anonymous_struct_or_union)
+    .def_ro("is_captured_record", &RecordDeclSnapshot::is_captured_record)
+    .def_ro("is_injected_class_name", &RecordDeclSnapshot::is_injected_class_name)
+    .def_ro("is_lambda", &RecordDeclSnapshot::is_lambda)
+    .def_ro("is_ms_struct", &RecordDeclSnapshot::is_ms_struct)
+    .def_ro("is_non_trivial_to_primitive_copy", &RecordDeclSnapshot::is_non_trivial_to_primitive_copy)
+    .def_ro("is_non_trivial_to_primitive_default_initialize", &RecordDeclSnapshot::is_non_trivial_to_primitive_default_initialize)
+    .def_ro("is_non_trivial_to_primitive_destroy", &RecordDeclSnapshot::is_non_trivial_to_primitive_destroy)
+    .def_ro("is_or_contains_union", &RecordDeclSnapshot::is_or_contains_union)
+    .def_ro("is_parameter_destroyed_in_callee", &RecordDeclSnapshot::is_parameter_destroyed_in_callee)
+    .def_ro("is_randomized", &RecordDeclSnapshot::is_randomized)
+    .def_ro("may_insert_extra_padding", &RecordDeclSnapshot::may_insert_extra_padding);
 }
 } // namespace pasta
@@ -21,6 +21,9 @@ void RegisterRecoveryExpr(nb::module_ &m) {
   nb::class_<RecoveryExpr, Expr>(m, "RecoveryExpr")
     .def_prop_ro("begin_token", &RecoveryExpr::BeginToken)
     .def_prop_ro("end_token", &RecoveryExpr::EndToken)
-    .def_prop_ro("sub_expressions", &RecoveryExpr::SubExpressions);
+    .def_prop_ro("sub_expressions", &RecoveryExpr::SubExpressions)
+    .def("snapshot", &RecoveryExpr::Snapshot);
+
+  nb::class_<RecoveryExprSnapshot, ExprSnapshot>(m, "RecoveryExprSnapshot");
 }
 } // namespace pasta
@@ -21,6 +21,10 @@ void RegisterRedeclarableTemplateDecl(nb::module_ &m) {
   nb::class_<RedeclarableTemplateDecl, TemplateDecl>(m, "RedeclarableTemplateDecl")
     .def_prop_ro("canonical_declaration", &RedeclarableTemplateDecl::CanonicalDeclaration)
     .def_prop_ro("instantiated_from_member_template", &RedeclarableTemplateDecl::InstantiatedFromMemberTemplate)
-    .def_prop_ro("is_member_specialization", &RedeclarableTemplateDecl::IsMemberSpecialization);
+    .def_prop_ro("is_member_specialization", &RedeclarableTemplateDecl::IsMemberSpecialization)
+    .def("snapshot", &RedeclarableTemplateDecl::Snapshot);
+
+  nb::class_<RedeclarableTemplateDeclSnapshot, TemplateDeclSnapshot>(m, "RedeclarableTemplateDeclSnapshot")
+    .def_ro("is_member_specialization", &RedeclarableTemplateDeclSnapshot::is_member_specialization);
 }
 } // namespace pasta
@@ -26,6 +26,12 @@ void RegisterRequiresExpr(nb::module_ &m) {
     .def_prop_ro("local_parameters", &RequiresExpr::LocalParameters)
     .def_prop_ro("r_brace_token", &RequiresExpr::RBraceToken)
     .def_prop_ro("requires_keyword_token", &RequiresExpr::RequiresKeywordToken)
-    .def_prop_ro("is_satisfied", &RequiresExpr::IsSatisfied);
+    .def_prop_ro("is_satisfied", &RequiresExpr::IsSatisfied)
+    .def("snapshot", &RequiresExpr::Snapshot);
+
+  nb::class_<RequiresExprSnapshot, ExprSnapshot>(m, "RequiresExprSnapshot")
+    .def_ro("r_brace_token", &RequiresExprSnapshot::r_brace_token)
+    .def_ro("requires_keyword_token", &RequiresExprSnapshot::requires_keyword_token)
+    .def_ro("is_satisfied", &RequiresExprSnapshot::is_satisfied);
 }
 } // namespace pasta
@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterRequiresExprBodyDecl(nb::module_ &m) {
-  nb::class_<RequiresExprBodyDecl, Decl>(m, "RequiresExprBodyDecl");
+  nb::class_<RequiresExprBodyDecl, Decl>(m, "RequiresExprBodyDecl")
+    .def("snapshot", &RequiresExprBodyDecl::Snapshot);
+
+  nb::class_<RequiresExprBodyDeclSnapshot, DeclSnapshot>(m, "RequiresExprBodyDeclSnapshot");
 }
 } // namespace pasta
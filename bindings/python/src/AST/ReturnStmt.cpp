@@ -24,6 +24,10 @@ void RegisterReturnStmt(nb::module_ &m) {
     .def_prop_ro("end_token", &ReturnStmt::EndToken)
     .def_prop_ro("nrvo_candidate", &ReturnStmt::NRVOCandidate)
     .def_prop_ro("return_value", &ReturnStmt::ReturnValue)
-    .def_prop_ro("return_token", &ReturnStmt::ReturnToken);
+    .def_prop_ro("return_token", &ReturnStmt::ReturnToken)
+    .def("snapshot", &ReturnStmt::Snapshot);
+
+  nb::class_<ReturnStmtSnapshot, StmtSnapshot>(m, "ReturnStmtSnapshot")
+    .def_ro("return_token", &ReturnStmtSnapshot::return_token);
 }
 } // namespace pasta
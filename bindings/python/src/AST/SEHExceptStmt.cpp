@@ -24,6 +24,10 @@ void RegisterSEHExceptStmt(nb::module_ &m) {
     .def_prop_ro("block", &SEHExceptStmt::Block)
     .def_prop_ro("end_token", &SEHExceptStmt::EndToken)
     .def_prop_ro("except_token", &SEHExceptStmt::ExceptToken)
-    .def_prop_ro("filter_expression", &SEHExceptStmt::FilterExpression);
+    .def_prop_ro("filter_expression", &SEHExceptStmt::FilterExpression)
+    .def("snapshot", &SEHExceptStmt::Snapshot);
+
+  nb::class_<SEHExceptStmtSnapshot, StmtSnapshot>(m, "SEHExceptStmtSnapshot")
+    .def_ro("except_token", &SEHExceptStmtSnapshot::except_token);
 }
 } // namespace pasta
@@ -23,6 +23,10 @@ void RegisterSEHFinallyStmt(nb::module_ &m) {
     .def_prop_ro("begin_token", &SEHFinallyStmt::BeginToken)
     .def_prop_ro("block", &SEHFinallyStmt::Block)
     .def_prop_ro("end_token", &SEHFinallyStmt::EndToken)
-    .def_prop_ro("finally_token", &SEHFinallyStmt::FinallyToken);
+    .def_prop_ro("finally_token", &SEHFinallyStmt::FinallyToken)
+    .def("snapshot", &SEHFinallyStmt::Snapshot);
+
+  nb::class_<SEHFinallyStmtSnapshot, StmtSnapshot>(m, "SEHFinallyStmtSnapshot")
+    .def_ro("finally_token", &SEHFinallyStmtSnapshot::finally_token);
 }
 } // namespace pasta
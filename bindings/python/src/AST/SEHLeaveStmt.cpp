@@ -22,6 +22,10 @@ void RegisterSEHLeaveStmt(nb::module_ &m) {
     .def_prop_ro("children", &SEHLeaveStmt::Children)
     .def_prop_ro("begin_token", &SEHLeaveStmt::BeginToken)
     .def_prop_ro("end_token", &SEHLeaveStmt::EndToken)
-    .def_prop_ro("leave_token", &SEHLeaveStmt::LeaveToken);
+    .def_prop_ro("leave_token", &SEHLeaveStmt::LeaveToken)
+    .def("snapshot", &SEHLeaveStmt::Snapshot);
+
+  nb::class_<SEHLeaveStmtSnapshot, StmtSnapshot>(m, "SEHLeaveStmtSnapshot")
+    .def_ro("leave_token", &SEHLeaveStmtSnapshot::leave_token);
 }
 } // namespace pasta
@@ -27,6 +27,11 @@ void RegisterSEHTryStmt(nb::module_ &m) {
     .def_prop_ro("handler", &SEHTryStmt::Handler)
     .def_prop_ro("is_cxx_try", &SEHTryStmt::IsCXXTry)
     .def_prop_ro("try_block", &SEHTryStmt::TryBlock)
-    .def_prop_ro("try_token", &SEHTryStmt::TryToken);
+    .def_prop_ro("try_token", &SEHTryStmt::TryToken)
+    .def("snapshot", &SEHTryStmt::Snapshot);
+
+  nb::class_<SEHTryStmtSnapshot, StmtSnapshot>(m, "SEHTryStmtSnapshot")
+    .def_ro("is_cxx_try", &SEHTryStmtSnapshot::is_cxx_try)
+    .def_ro("try_token", &SEHTryStmtSnapshot::try_token);
 }
 } // namespace pasta
@@ -25,6 +25,12 @@ void RegisterSYCLUniqueStableNameExpr(nb::module_ &m) {
     .def_prop_ro("end_token", &SYCLUniqueStableNameExpr::EndToken)
     .def_prop_ro("l_paren_token", &SYCLUniqueStableNameExpr::LParenToken)
     .def_prop_ro("token", &SYCLUniqueStableNameExpr::Token)
-    .def_prop_ro("r_paren_token", &SYCLUniqueStableNameExpr::RParenToken);
+    .def_prop_ro("r_paren_token", &SYCLUniqueStableNameExpr::RParenToken)
+    .def("snapshot", &SYCLUniqueStableNameExpr::Snapshot);
+
+  nb::class_<SYCLUniqueStableNameExprSnapshot, ExprSnapshot>(m, "SYCLUniqueStableNameExprSnapshot")
+    .def_ro("l_paren_token", &SYCLUniqueStableNameExprSnapshot::l_paren_token)
+    .def_ro("token", &SYCLUniqueStableNameExprSnapshot::token)
+    .def_ro("r_paren_token", &SYCLUniqueStableNameExprSnapshot::r_paren_token);
 }
 } // namespace pasta
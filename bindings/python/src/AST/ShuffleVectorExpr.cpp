@@ -24,6 +24,12 @@ void RegisterShuffleVectorExpr(nb::module_ &m) {
     .def_prop_ro("builtin_token", &ShuffleVectorExpr::BuiltinToken)
     .def_prop_ro("end_token", &ShuffleVectorExpr::EndToken)
     .def_prop_ro("num_sub_expressions", &ShuffleVectorExpr::NumSubExpressions)
-    .def_prop_ro("r_paren_token", &ShuffleVectorExpr::RParenToken);
+    .def_prop_ro("r_paren_token", &ShuffleVectorExpr::RParenToken)
+    .def("snapshot", &ShuffleVectorExpr::Snapshot);
+
+  nb::class_<ShuffleVectorExprSnapshot, ExprSnapshot>(m, "ShuffleVectorExprSnapshot")
+    .def_ro("builtin_token", &ShuffleVectorExprSnapshot::builtin_token)
+    .def_ro("num_sub_expressions", &ShuffleVectorExprSnapshot::num_sub_expressions)
+    .def_ro("r_paren_token", &ShuffleVectorExprSnapshot::r_paren_token);
 }
 } // namespace pasta
@@ -28,6 +28,13 @@ void RegisterSizeOfPackExpr(nb::module_ &m) {
     .def_prop_ro("pack_token", &SizeOfPackExpr::PackToken)
     .def_prop_ro("partial_arguments", &SizeOfPackExpr::PartialArguments)
     .def_prop_ro("r_paren_token", &SizeOfPackExpr::RParenToken)
-    .def_prop_ro("is_partially_substituted", &SizeOfPackExpr::IsPartiallySubstituted);
+    .def_prop_ro("is_partially_substituted", &SizeOfPackExpr::IsPartiallySubstituted)
+    .def("snapshot", &SizeOfPackExpr::Snapshot);
+
+  nb::class_<SizeOfPackExprSnapshot, ExprSnapshot>(m, "SizeOfPackExprSnapshot")
+    .def_ro("operator_token", &SizeOfPackExprSnapshot::operator_token)
+    .def_ro("pack_token", &SizeOfPackExprSnapshot::pack_token)
+    .def_ro("r_paren_token", &SizeOfPackExprSnapshot::r_paren_token)
+    .def_ro("is_partially_substituted", &SizeOfPackExprSnapshot::is_partially_substituted);
 }
 } // namespace pasta
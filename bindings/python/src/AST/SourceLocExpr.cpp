@@ -26,6 +26,12 @@ void RegisterSourceLocExpr(nb::module_ &m) {
     .def_prop_ro("identifier_kind", &SourceLocExpr::IdentifierKind)
     .def_prop_ro("token", &SourceLocExpr::Token)
     .def_prop_ro("parent_context", &SourceLocExpr::ParentContext)
-    .def_prop_ro("is_int_type", &SourceLocExpr::IsIntType);
+    .def_prop_ro("is_int_type", &SourceLocExpr::IsIntType)
+    .def("snapshot", &SourceLocExpr::Snapshot);
+
+  nb::class_<SourceLocExprSnapshot, ExprSnapshot>(m, "SourceLocExprSnapshot")
+    .def_ro("identifier_kind", &SourceLocExprSnapshot::identifier_kind)
+    .def_ro("token", &SourceLocExprSnapshot::token)
+    .def_ro("is_int_type", &SourceLocExprSnapshot::is_int_type);
 }
 } // namespace pasta
@@ -22,6 +22,11 @@ void RegisterStaticAssertDecl(nb::module_ &m) {
     .def_prop_ro("assert_expression", &StaticAssertDecl::AssertExpression)
     .def_prop_ro("message", &StaticAssertDecl::Message)
     .def_prop_ro("r_paren_token", &StaticAssertDecl::RParenToken)
-    .def_prop_ro("is_failed", &StaticAssertDecl::IsFailed);
+    .def_prop_ro("is_failed", &StaticAssertDecl::IsFailed)
+    .def("snapshot", &StaticAssertDecl::Snapshot);
+
+  nb::class_<StaticAssertDeclSnapshot, DeclSnapshot>(m, "StaticAssertDeclSnapshot")
+    .def_ro("r_paren_token", &StaticAssertDeclSnapshot::r_paren_token)
+    .def_ro("is_failed", &StaticAssertDeclSnapshot::is_failed);
 }
 } // namespace pasta
@@ -31,6 +31,12 @@ void RegisterStmt(nb::module_ &m) {
     .def_prop_ro("tokens", &Stmt::Tokens)
     .def_prop_ro("kind", &Stmt::Kind)
     .def_prop_ro("kind_name", &Stmt::KindName)
-    .def_prop_ro("strip_label_like_statements", &Stmt::StripLabelLikeStatements);
+    .def_prop_ro("strip_label_like_statements", &Stmt::StripLabelLikeStatements)
+    .def("snapshot", &Stmt::Snapshot);
+
+  nb::class_<StmtSnapshot>(m, "StmtSnapshot")
+    .def_ro("begin_token", &StmtSnapshot::begin_token)
+    .def_ro("end_token", &StmtSnapshot::end_token)
+    .def_ro("id", &StmtSnapshot::id);
 }
 } // namespace pasta
@@ -25,6 +25,12 @@ void RegisterStmtExpr(nb::module_ &m) {
     .def_prop_ro("l_paren_token", &StmtExpr::LParenToken)
     .def_prop_ro("r_paren_token", &StmtExpr::RParenToken)
     .def_prop_ro("sub_statement", &StmtExpr::SubStatement)
-    .def_prop_ro("template_depth", &StmtExpr::TemplateDepth);
+    .def_prop_ro("template_depth", &StmtExpr::TemplateDepth)
+    .def("snapshot", &StmtExpr::Snapshot);
+
+  nb::class_<StmtExprSnapshot, ExprSnapshot>(m, "StmtExprSnapshot")
+    .def_ro("l_paren_token", &StmtExprSnapshot::l_paren_token)
+    .def_ro("r_paren_token", &StmtExprSnapshot::r_paren_token)
+    .def_ro("template_depth", &StmtExprSnapshot::template_depth);
 }
 } // namespace pasta
@@ -37,6 +37,21 @@ void RegisterStringLiteral(nb::module_ &m) {
     .def_prop_ro("is_utf32", &StringLiteral::IsUTF32)
     .def_prop_ro("is_utf8", &StringLiteral::IsUTF8)
     .def_prop_ro("is_unevaluated", &StringLiteral::IsUnevaluated)
-    .def_prop_ro("is_wide", &StringLiteral::IsWide);
+    .def_prop_ro("is_wide", &StringLiteral::IsWide)
+    .def("snapshot", &StringLiteral::Snapshot);
+
+  nb::class_<StringLiteralSnapshot, ExprSnapshot>(m, "StringLiteralSnapshot")
+    .def_ro("byte_length", &StringLiteralSnapshot::byte_length)
+    .def_ro("character_byte_width", &StringLiteralSnapshot::character_byte_width)
+    .def_ro("literal_kind", &StringLiteralSnapshot::literal_kind)
+    .def_ro("length", &StringLiteralSnapshot::length)
+    .def_ro("num_concatenated", &StringLiteralSnapshot::num_concatenated)
+    .def_ro("is_ordinary", &StringLiteralSnapshot::is_ordinary)
+    .def_ro("is_pascal", &StringLiteralSnapshot::is_pascal)
+    .def_ro("is_utf16", &StringLiteralSnapshot::is_utf16)
+    .def_ro("is_utf32", &StringLiteralSnapshot::is_utf32)
+    .def_ro("is_utf8", &StringLiteralSnapshot::is_utf8)
+    .def_ro("is_unevaluated", &StringLiteralSnapshot::is_unevaluated)
+    .def_ro("is_wide", &StringLiteralSnapshot::is_wide);
 }
 } // namespace pasta
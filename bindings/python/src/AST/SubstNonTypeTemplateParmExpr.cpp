@@ -29,6 +29,12 @@ void RegisterSubstNonTypeTemplateParmExpr(nb::module_ &m) {
     .def_prop_ro("parameter", &SubstNonTypeTemplateParmExpr::Parameter)
     .def_prop_ro("parameter_type", &SubstNonTypeTemplateParmExpr::ParameterType)
     .def_prop_ro("replacement", &SubstNonTypeTemplateParmExpr::Replacement)
-    .def_prop_ro("is_reference_parameter", &SubstNonTypeTemplateParmExpr::IsReferenceParameter);
+    .def_prop_ro("is_reference_parameter", &SubstNonTypeTemplateParmExpr::IsReferenceParameter)
+    .def("snapshot", &SubstNonTypeTemplateParmExpr::Snapshot);
+
+  nb::class_<SubstNonTypeTemplateParmExprSnapshot, ExprSnapshot>(m, "SubstNonTypeTemplateParmExprSnapshot")
+    .def_ro("index", &SubstNonTypeTemplateParmExprSnapshot::index)
+    .def_ro("name_token", &SubstNonTypeTemplateParmExprSnapshot::name_token)
+    .def_ro("is_reference_parameter", &SubstNonTypeTemplateParmExprSnapshot::is_reference_parameter);
 }
 } // namespace pasta
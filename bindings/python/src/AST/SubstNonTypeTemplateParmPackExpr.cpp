@@ -25,6 +25,11 @@ void RegisterSubstNonTypeTemplateParmPackExpr(nb::module_ &m) {
     .def_prop_ro("end_token", &SubstNonTypeTemplateParmPackExpr::EndToken)
     .def_prop_ro("index", &SubstNonTypeTemplateParmPackExpr::Index)
     .def_prop_ro("parameter_pack", &SubstNonTypeTemplateParmPackExpr::ParameterPack)
-    .def_prop_ro("parameter_pack_token", &SubstNonTypeTemplateParmPackExpr::ParameterPackToken);
+    .def_prop_ro("parameter_pack_token", &SubstNonTypeTemplateParmPackExpr::ParameterPackToken)
+    .def("snapshot", &SubstNonTypeTemplateParmPackExpr::Snapshot);
+
+  nb::class_<SubstNonTypeTemplateParmPackExprSnapshot, ExprSnapshot>(m, "SubstNonTypeTemplateParmPackExprSnapshot")
+    .def_ro("index", &SubstNonTypeTemplateParmPackExprSnapshot::index)
+    .def_ro("parameter_pack_token", &SubstNonTypeTemplateParmPackExprSnapshot::parameter_pack_token);
 }
 } // namespace pasta
@@ -24,6 +24,11 @@ void RegisterSwitchCase(nb::module_ &m) {
     .def_prop_ro("end_token", &SwitchCase::EndToken)
     .def_prop_ro("keyword_token", &SwitchCase::KeywordToken)
     .def_prop_ro("next_switch_case", &SwitchCase::NextSwitchCase)
-    .def_prop_ro("sub_statement", &SwitchCase::SubStatement);
+    .def_prop_ro("sub_statement", &SwitchCase::SubStatement)
+    .def("snapshot", &SwitchCase::Snapshot);
+
+  nb::class_<SwitchCaseSnapshot, StmtSnapshot>(m, "SwitchCaseSnapshot")
+    .def_ro("colon_token", &SwitchCaseSnapshot::colon_token)
+    .def_ro("keyword_token", &SwitchCaseSnapshot::keyword_token);
 }
 } // namespace pasta
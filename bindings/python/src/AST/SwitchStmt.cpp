@@ -33,6 +33,15 @@ void RegisterSwitchStmt(nb::module_ &m) {
     .def_prop_ro("switch_token", &SwitchStmt::SwitchToken)
     .def_prop_ro("has_initializer_storage", &SwitchStmt::HasInitializerStorage)
     .def_prop_ro("has_variable_storage", &SwitchStmt::HasVariableStorage)
-    .def_prop_ro("is_all_enum_cases_covered", &SwitchStmt::IsAllEnumCasesCovered);
+    .def_prop_ro("is_all_enum_cases_covered", &SwitchStmt::IsAllEnumCasesCovered)
+    .def("snapshot", &SwitchStmt::Snapshot);
+
+  nb::class_<SwitchStmtSnapshot, StmtSnapshot>(m, "SwitchStmtSnapshot")
+    .def_ro("l_paren_token", &SwitchStmtSnapshot::l_paren_token)
+    .def_ro("r_paren_token", &SwitchStmtSnapshot::r_paren_token)
+    .def_ro("switch_token", &SwitchStmtSnapshot::switch_token)
+    .def_ro("has_initializer_storage", &SwitchStmtSnapshot::has_initializer_storage)
+    .def_ro("has_variable_storage", &SwitchStmtSnapshot::has_variable_storage)
+    .def_ro("is_all_enum_cases_covered", &SwitchStmtSnapshot::is_all_enum_cases_covered);
 }
 } // namespace pasta
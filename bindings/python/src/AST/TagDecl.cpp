@@ -42,6 +42,28 @@ void RegisterTagDecl(nb::module_ &m) {
     .def_prop_ro("is_this_declaration_a_definition", &TagDecl::IsThisDeclarationADefinition)
     .def_prop_ro("is_this_declaration_a_demoted_definition", &TagDecl::IsThisDeclarationADemotedDefinition)
     .def_prop_ro("is_union", &TagDecl::IsUnion)
-    .def_prop_ro("may_have_out_of_date_definition", &TagDecl::MayHaveOutOfDateDefinition);
+    .def_prop_ro("may_have_out_of_date_definition", &TagDecl::MayHaveOutOfDateDefinition)
+    .def("snapshot", &TagDecl::Snapshot);
+
+  nb::class_<TagDeclSnapshot, TypeDeclSnapshot>(m, "TagDeclSnapshot")
+    .def_ro("first_inner_token", &TagDeclSnapshot::first_inner_token)
+    .def_ro("num_template_parameter_lists", &TagDeclSnapshot::num_template_parameter_lists)
+    .def_ro("first_outer_token", &TagDeclSnapshot::first_outer_token)
+    .def_ro("tag_kind", &TagDeclSnapshot::tag_kind)
+    .def_ro("has_name_for_linkage", &TagDeclSnapshot::has_name_for_linkage)
+    .def_ro("is_being_defined", &TagDeclSnapshot::is_being_defined)
+    .def_ro("is_class", &TagDeclSnapshot::is_class)
+    .def_ro("is_complete_definition", &TagDeclSnapshot::is_complete_definition)
+    .def_ro("is_complete_definition_required", &TagDeclSnapshot::is_complete_definition_required)
+    .def_ro("is_dependent_type", &TagDeclSnapshot::is_dependent_type)
+    .def_ro("is_embedded_in_declarator", &TagDeclSnapshot::is_embedded_in_declarator)
+    .def_ro("is_enum", &TagDeclSnapshot::is_enum)
+    .def_ro("is_free_standing", &TagDeclSnapshot::is_free_standing)
+    .def_ro("is_interface", &TagDeclSnapshot::is_interface)
+    .def_ro("is_struct", &TagDeclSnapshot::is_struct)
+    .def_ro("is_this_declaration_a_definition", &TagDeclSnapshot::is_this_declaration_a_definition)
+    .def_ro("is_this_declaration_a_demoted_definition", &TagDeclSnapshot::is_this_declaration_a_demoted_definition)
+    .def_ro("is_union", &TagDeclSnapshot::is_union)
+    .def_ro("may_have_out_of_date_definition", &TagDeclSnapshot::may_have_out_of_date_definition);
 }
 } // namespace pasta
@@ -22,6 +22,11 @@ void RegisterTemplateDecl(nb::module_ &m) {
     .def_prop_ro("template_parameters", &TemplateDecl::TemplateParameters)
     .def_prop_ro("templated_declaration", &TemplateDecl::TemplatedDeclaration)
     .def_prop_ro("has_associated_constraints", &TemplateDecl::HasAssociatedConstraints)
-    .def_prop_ro("is_type_alias", &TemplateDecl::IsTypeAlias);
+    .def_prop_ro("is_type_alias", &TemplateDecl::IsTypeAlias)
+    .def("snapshot", &TemplateDecl::Snapshot);
+
+  nb::class_<TemplateDeclSnapshot, NamedDeclSnapshot>(m, "TemplateDeclSnapshot")
+    .def_ro("has_associated_constraints", &TemplateDeclSnapshot::has_associated_constraints)
+    .def_ro("is_type_alias", &TemplateDeclSnapshot::is_type_alias);
 }
 } // namespace pasta
@@ -19,6 +19,9 @@ namespace nb = nanobind;
 
 void RegisterTemplateParamObjectDecl(nb::module_ &m) {
   nb::class_<TemplateParamObjectDecl, ValueDecl>(m, "TemplateParamObjectDecl")
-    .def_prop_ro("canonical_declaration", &TemplateParamObjectDecl::CanonicalDeclaration);
+    .def_prop_ro("canonical_declaration", &TemplateParamObjectDecl::CanonicalDeclaration)
+    .def("snapshot", &TemplateParamObjectDecl::Snapshot);
+
+  nb::class_<TemplateParamObjectDeclSnapshot, ValueDeclSnapshot>(m, "TemplateParamObjectDeclSnapshot");
 }
 } // namespace pasta
@@ -25,6 +25,15 @@ void RegisterTemplateTemplateParmDecl(nb::module_ &m) {
     .def_prop_ro("has_default_argument", &TemplateTemplateParmDecl::HasDefaultArgument)
     .def_prop_ro("is_expanded_parameter_pack", &TemplateTemplateParmDecl::IsExpandedParameterPack)
     .def_prop_ro("is_pack_expansion", &TemplateTemplateParmDecl::IsPackExpansion)
-    .def_prop_ro("is_parameter_pack", &TemplateTemplateParmDecl::IsParameterPack);
+    .def_prop_ro("is_parameter_pack", &TemplateTemplateParmDecl::IsParameterPack)
+    .def("snapshot", &TemplateTemplateParmDecl::Snapshot);
+
+  nb::class_<TemplateTemplateParmDeclSnapshot, TemplateDeclSnapshot>(m, "TemplateTemplateParmDeclSnapshot")
+    .def_ro("default_argument_was_inherited", &TemplateTemplateParmDeclSnapshot::default_argument_was_inherited)
+    .def_ro("default_argument_token", &TemplateTemplateParmDeclSnapshot::default_argument_token)
+    .def_ro("num_expansion_template_parameters", &TemplateTemplateParmDeclSnapshot::num_expansion_template_parameters)
+    .def_ro("has_default_argument", &TemplateTemplateParmDeclSnapshot::has_default_argument)
+    .def_ro("is_expanded_parameter_pack", &TemplateTemplateParmDeclSnapshot::is_expanded_parameter_pack)
+    .def_ro("is_pack_expansion", &TemplateTemplateParmDeclSnapshot::is_pack_expansion);
 }
 } // namespace pasta
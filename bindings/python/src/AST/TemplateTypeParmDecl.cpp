@@ -31,6 +31,19 @@ void RegisterTemplateTypeParmDecl(nb::module_ &m) {
     .def_prop_ro("is_expanded_parameter_pack", &TemplateTypeParmDecl::IsExpandedParameterPack)
     .def_prop_ro("is_pack_expansion", &TemplateTypeParmDecl::IsPackExpansion)
     .def_prop_ro("is_parameter_pack", &TemplateTypeParmDecl::IsParameterPack)
-    .def_prop_ro("was_declared_with_typename", &TemplateTypeParmDecl::WasDeclaredWithTypename);
+    .def_prop_ro("was_declared_with_typename", &TemplateTypeParmDecl::WasDeclaredWithTypename)
+    .def("snapshot", &TemplateTypeParmDecl::Snapshot);
+
+  nb::class_<TemplateTypeParmDeclSnapshot, TypeDeclSnapshot>(m, "TemplateTypeParmDeclSnapshot")
+    .def_ro("default_argument_was_inherited", &TemplateTypeParmDeclSnapshot::default_argument_was_inherited)
+    .def_ro("default_argument_token", &TemplateTypeParmDeclSnapshot::default_argument_token)
+    .def_ro("depth", &TemplateTypeParmDeclSnapshot::depth)
+    .def_ro("index", &TemplateTypeParmDeclSnapshot::index)
+    .def_ro("num_expansion_parameters", &TemplateTypeParmDeclSnapshot::num_expansion_parameters)
+    .def_ro("has_default_argument", &TemplateTypeParmDeclSnapshot::has_default_argument)
+    .def_ro("has_type_constraint", &TemplateTypeParmDeclSnapshot::has_type_constraint)
+    .def_ro("is_expanded_parameter_pack", &TemplateTypeParmDeclSnapshot::is_expanded_parameter_pack)
+    .def_ro("is_pack_expansion", &TemplateTypeParmDeclSnapshot::is_pack_expansion)
+    .def_ro("was_declared_with_typename", &TemplateTypeParmDeclSnapshot::was_declared_with_typename);
 }
 } // namespace pasta
@@ -20,6 +20,10 @@ namespace nb = nanobind;
 void RegisterTopLevelStmtDecl(nb::module_ &m) {
   nb::class_<TopLevelStmtDecl, Decl>(m, "TopLevelStmtDecl")
     .def_prop_ro("statement", &TopLevelStmtDecl::Statement)
-    .def_prop_ro("is_semi_missing", &TopLevelStmtDecl::IsSemiMissing);
+    .def_prop_ro("is_semi_missing", &TopLevelStmtDecl::IsSemiMissing)
+    .def("snapshot", &TopLevelStmtDecl::Snapshot);
+
+  nb::class_<TopLevelStmtDeclSnapshot, DeclSnapshot>(m, "TopLevelStmtDeclSnapshot")
+    .def_ro("is_semi_missing", &TopLevelStmtDeclSnapshot::is_semi_missing);
 }
 } // namespace pasta
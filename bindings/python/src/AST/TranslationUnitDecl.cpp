@@ -19,6 +19,9 @@ namespace nb = nanobind;
 
 void RegisterTranslationUnitDecl(nb::module_ &m) {
   nb::class_<TranslationUnitDecl, Decl>(m, "TranslationUnitDecl")
-    .def_prop_ro("anonymous_namespace", &TranslationUnitDecl::AnonymousNamespace);
+    .def_prop_ro("anonymous_namespace", &TranslationUnitDecl::AnonymousNamespace)
+    .def("snapshot", &TranslationUnitDecl::Snapshot);
+
+  nb::class_<TranslationUnitDeclSnapshot, DeclSnapshot>(m, "TranslationUnitDeclSnapshot");
 }
 } // namespace pasta
@@ -19,6 +19,9 @@ namespace nb = nanobind;
 
 void RegisterTypeAliasDecl(nb::module_ &m) {
   nb::class_<TypeAliasDecl, TypedefNameDecl>(m, "TypeAliasDecl")
-    .def_prop_ro("described_alias_template", &TypeAliasDecl::DescribedAliasTemplate);
+    .def_prop_ro("described_alias_template", &TypeAliasDecl::DescribedAliasTemplate)
+    .def("snapshot", &TypeAliasDecl::Snapshot);
+
+  nb::class_<TypeAliasDeclSnapshot, TypedefNameDeclSnapshot>(m, "TypeAliasDeclSnapshot");
 }
 } // namespace pasta
@@ -22,6 +22,9 @@ void RegisterTypeAliasTemplateDecl(nb::module_ &m) {
     .def_prop_ro("canonical_declaration", &TypeAliasTemplateDecl::CanonicalDeclaration)
     .def_prop_ro("instantiated_from_member_template", &TypeAliasTemplateDecl::InstantiatedFromMemberTemplate)
     .def_prop_ro("previous_declaration", &TypeAliasTemplateDecl::PreviousDeclaration)
-    .def_prop_ro("templated_declaration", &TypeAliasTemplateDecl::TemplatedDeclaration);
+    .def_prop_ro("templated_declaration", &TypeAliasTemplateDecl::TemplatedDeclaration)
+    .def("snapshot", &TypeAliasTemplateDecl::Snapshot);
+
+  nb::class_<TypeAliasTemplateDeclSnapshot, RedeclarableTemplateDeclSnapshot>(m, "TypeAliasTemplateDeclSnapshot");
 }
 } // namespace pasta
@@ -20,6 +20,9 @@ namespace nb = nanobind;
 void RegisterTypeDecl(nb::module_ &m) {
   nb::class_<TypeDecl, NamedDecl>(m, "TypeDecl")
     .def_prop_ro("begin_token", &TypeDecl::BeginToken)
-    .def_prop_ro("type_for_declaration", &TypeDecl::TypeForDeclaration);
+    .def_prop_ro("type_for_declaration", &TypeDecl::TypeForDeclaration)
+    .def("snapshot", &TypeDecl::Snapshot);
+
+  nb::class_<TypeDeclSnapshot, NamedDeclSnapshot>(m, "TypeDeclSnapshot");
 }
 } // namespace pasta
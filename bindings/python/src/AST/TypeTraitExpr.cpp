@@ -24,6 +24,11 @@ void RegisterTypeTraitExpr(nb::module_ &m) {
     .def_prop_ro("end_token", &TypeTraitExpr::EndToken)
     .def_prop_ro("num_arguments", &TypeTraitExpr::NumArguments)
     .def_prop_ro("trait", &TypeTraitExpr::Trait)
-    .def_prop_ro("value", &TypeTraitExpr::Value);
+    .def_prop_ro("value", &TypeTraitExpr::Value)
+    .def("snapshot", &TypeTraitExpr::Snapshot);
+
+  nb::class_<TypeTraitExprSnapshot, ExprSnapshot>(m, "TypeTraitExprSnapshot")
+    .def_ro("num_arguments", &TypeTraitExprSnapshot::num_arguments)
+    .def_ro("trait", &TypeTraitExprSnapshot::trait);
 }
 } // namespace pasta
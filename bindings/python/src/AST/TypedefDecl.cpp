@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterTypedefDecl(nb::module_ &m) {
-  nb::class_<TypedefDecl, TypedefNameDecl>(m, "TypedefDecl");
+  nb::class_<TypedefDecl, TypedefNameDecl>(m, "TypedefDecl")
+    .def("snapshot", &TypedefDecl::Snapshot);
+
+  nb::class_<TypedefDeclSnapshot, TypedefNameDeclSnapshot>(m, "TypedefDeclSnapshot");
 }
 } // namespace pasta
@@ -23,6 +23,11 @@ void RegisterTypedefNameDecl(nb::module_ &m) {
     .def_prop_ro("canonical_declaration", &TypedefNameDecl::CanonicalDeclaration)
     .def_prop_ro("underlying_type", &TypedefNameDecl::UnderlyingType)
     .def_prop_ro("is_moded", &TypedefNameDecl::IsModed)
-    .def_prop_ro("is_transparent_tag", &TypedefNameDecl::IsTransparentTag);
+    .def_prop_ro("is_transparent_tag", &TypedefNameDecl::IsTransparentTag)
+    .def("snapshot", &TypedefNameDecl::Snapshot);
+
+  nb::class_<TypedefNameDeclSnapshot, TypeDeclSnapshot>(m, "TypedefNameDeclSnapshot")
+    .def_ro("is_moded", &TypedefNameDeclSnapshot::is_moded)
+    .def_ro("is_transparent_tag", &TypedefNameDeclSnapshot::is_transparent_tag);
 }
 } // namespace pasta
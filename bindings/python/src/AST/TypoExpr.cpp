@@ -21,6 +21,9 @@ void RegisterTypoExpr(nb::module_ &m) {
   nb::class_<TypoExpr, Expr>(m, "TypoExpr")
     .def_prop_ro("children", &TypoExpr::Children)
     .def_prop_ro("begin_token", &TypoExpr::BeginToken)
-    .def_prop_ro("end_token", &TypoExpr::EndToken);
+    .def_prop_ro("end_token", &TypoExpr::EndToken)
+    .def("snapshot", &TypoExpr::Snapshot);
+
+  nb::class_<TypoExprSnapshot, ExprSnapshot>(m, "TypoExprSnapshot");
 }
 } // namespace pasta
@@ -28,6 +28,13 @@ void RegisterUnaryExprOrTypeTraitExpr(nb::module_ &m) {
     .def_prop_ro("operator_token", &UnaryExprOrTypeTraitExpr::OperatorToken)
     .def_prop_ro("r_paren_token", &UnaryExprOrTypeTraitExpr::RParenToken)
     .def_prop_ro("type_of_argument", &UnaryExprOrTypeTraitExpr::TypeOfArgument)
-    .def_prop_ro("is_argument_type", &UnaryExprOrTypeTraitExpr::IsArgumentType);
+    .def_prop_ro("is_argument_type", &UnaryExprOrTypeTraitExpr::IsArgumentType)
+    .def("snapshot", &UnaryExprOrTypeTraitExpr::Snapshot);
+
+  nb::class_<UnaryExprOrTypeTraitExprSnapshot, ExprSnapshot>(m, "UnaryExprOrTypeTraitExprSnapshot")
+    .def_ro("keyword_kind", &UnaryExprOrTypeTraitExprSnapshot::keyword_kind)
+    .def_ro("operator_token", &UnaryExprOrTypeTraitExprSnapshot::operator_token)
+    .def_ro("r_paren_token", &UnaryExprOrTypeTraitExprSnapshot::r_paren_token)
+    .def_ro("is_argument_type", &UnaryExprOrTypeTraitExprSnapshot::is_argument_type);
 }
 } // namespace pasta
@@ -33,6 +33,19 @@ void RegisterUnaryOperator(nb::module_ &m) {
     .def_prop_ro("is_increment_decrement_operation", &UnaryOperator::IsIncrementDecrementOperation)
     .def_prop_ro("is_increment_operation", &UnaryOperator::IsIncrementOperation)
     .def_prop_ro("is_postfix", &UnaryOperator::IsPostfix)
-    .def_prop_ro("is_prefix", &UnaryOperator::IsPrefix);
+    .def_prop_ro("is_prefix", &UnaryOperator::IsPrefix)
+    .def("snapshot", &UnaryOperator::Snapshot);
+
+  nb::class_<UnaryOperatorSnapshot, ExprSnapshot>(m, "UnaryOperatorSnapshot")
+    .def_ro("can_overflow", &UnaryOperatorSnapshot::can_overflow)
+    .def_ro("opcode", &UnaryOperatorSnapshot::opcode)
+    .def_ro("operator_token", &UnaryOperatorSnapshot::operator_token)
+    .def_ro("has_stored_fp_features", &UnaryOperatorSnapshot::has_stored_fp_features)
+    .def_ro("is_arithmetic_operation", &UnaryOperatorSnapshot::is_arithmetic_operation)
+    .def_ro("is_decrement_operation", &UnaryOperatorSnapshot::is_decrement_operation)
+    .def_ro("is_increment_decrement_operation", &UnaryOperatorSnapshot::is_increment_decrement_operation)
+    .def_ro("is_increment_operation", &UnaryOperatorSnapshot::is_increment_operation)
+    .def_ro("is_postfix", &UnaryOperatorSnapshot::is_postfix)
+    .def_ro("is_prefix", &UnaryOperatorSnapshot::is_prefix);
 }
 } // namespace pasta
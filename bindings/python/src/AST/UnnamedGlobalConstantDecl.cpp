@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterUnnamedGlobalConstantDecl(nb::module_ &m) {
-  nb::class_<UnnamedGlobalConstantDecl, ValueDecl>(m, "UnnamedGlobalConstantDecl");
+  nb::class_<UnnamedGlobalConstantDecl, ValueDecl>(m, "UnnamedGlobalConstantDecl")
+    .def("snapshot", &UnnamedGlobalConstantDecl::Snapshot);
+
+  nb::class_<UnnamedGlobalConstantDeclSnapshot, ValueDeclSnapshot>(m, "UnnamedGlobalConstantDeclSnapshot");
 }
 } // namespace pasta
@@ -24,6 +24,11 @@ void RegisterUnresolvedLookupExpr(nb::module_ &m) {
     .def_prop_ro("end_token", &UnresolvedLookupExpr::EndToken)
     .def_prop_ro("naming_class", &UnresolvedLookupExpr::NamingClass)
     .def_prop_ro("is_overloaded", &UnresolvedLookupExpr::IsOverloaded)
-    .def_prop_ro("requires_adl", &UnresolvedLookupExpr::RequiresADL);
+    .def_prop_ro("requires_adl", &UnresolvedLookupExpr::RequiresADL)
+    .def("snapshot", &UnresolvedLookupExpr::Snapshot);
+
+  nb::class_<UnresolvedLookupExprSnapshot, OverloadExprSnapshot>(m, "UnresolvedLookupExprSnapshot")
+    .def_ro("is_overloaded", &UnresolvedLookupExprSnapshot::is_overloaded)
+    .def_ro("requires_adl", &UnresolvedLookupExprSnapshot::requires_adl);
 }
 } // namespace pasta
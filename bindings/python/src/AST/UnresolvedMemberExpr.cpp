@@ -30,6 +30,14 @@ void RegisterUnresolvedMemberExpr(nb::module_ &m) {
     .def_prop_ro("operator_token", &UnresolvedMemberExpr::OperatorToken)
     .def_prop_ro("has_unresolved_using", &UnresolvedMemberExpr::HasUnresolvedUsing)
     .def_prop_ro("is_arrow", &UnresolvedMemberExpr::IsArrow)
-    .def_prop_ro("is_implicit_access", &UnresolvedMemberExpr::IsImplicitAccess);
+    .def_prop_ro("is_implicit_access", &UnresolvedMemberExpr::IsImplicitAccess)
+    .def("snapshot", &UnresolvedMemberExpr::Snapshot);
+
+  nb::class_<UnresolvedMemberExprSnapshot, OverloadExprSnapshot>(m, "UnresolvedMemberExprSnapshot")
+    .def_ro("member_token", &UnresolvedMemberExprSnapshot::member_token)
+    .def_ro("operator_token", &UnresolvedMemberExprSnapshot::operator_token)
+    .def_ro("has_unresolved_using", &UnresolvedMemberExprSnapshot::has_unresolved_using)
+    .def_ro("is_arrow", &UnresolvedMemberExprSnapshot::is_arrow)
+    .def_ro("is_implicit_access", &UnresolvedMemberExprSnapshot::is_implicit_access);
 }
 } // namespace pasta
@@ -18,6 +18,9 @@ namespace pasta {
 namespace nb = nanobind;
 
 void RegisterUnresolvedUsingIfExistsDecl(nb::module_ &m) {
-  nb::class_<UnresolvedUsingIfExistsDecl, NamedDecl>(m, "UnresolvedUsingIfExistsDecl");
+  nb::class_<UnresolvedUsingIfExistsDecl, NamedDecl>(m, "UnresolvedUsingIfExistsDecl")
+    .def("snapshot", &UnresolvedUsingIfExistsDecl::Snapshot);
+
+  nb::class_<UnresolvedUsingIfExistsDeclSnapshot, NamedDeclSnapshot>(m, "UnresolvedUsingIfExistsDeclSnapshot");
 }
 } // namespace pasta
@@ -23,6 +23,13 @@ void RegisterUnresolvedUsingTypenameDecl(nb::module_ &m) {
     .def_prop_ro("ellipsis_token", &UnresolvedUsingTypenameDecl::EllipsisToken)
     .def_prop_ro("typename_token", &UnresolvedUsingTypenameDecl::TypenameToken)
     .def_prop_ro("using_token", &UnresolvedUsingTypenameDecl::UsingToken)
-    .def_prop_ro("is_pack_expansion", &UnresolvedUsingTypenameDecl::IsPackExpansion);
+    .def_prop_ro("is_pack_expansion", &UnresolvedUsingTypenameDecl::IsPackExpansion)
+    .def("snapshot", &UnresolvedUsingTypenameDecl::Snapshot);
+
+  nb::class_<UnresolvedUsingTypenameDeclSnapshot, TypeDeclSnapshot>(m, "UnresolvedUsingTypenameDeclSnapshot")
+    .def_ro("ellipsis_token", &UnresolvedUsingTypenameDeclSnapshot::ellipsis_token)
+    .def_ro("typename_token", &UnresolvedUsingTypenameDeclSnapshot::typename_token)
+    .def_ro("using_token", &UnresolvedUsingTypenameDeclSnapshot::using_token)
+    .def_ro("is_pack_expansion", &UnresolvedUsingTypenameDeclSnapshot::is_pack_expansion);
 }
 } // namespace pasta
@@ -23,6 +23,13 @@ void RegisterUnresolvedUsingValueDecl(nb::module_ &m) {
     .def_prop_ro("ellipsis_token", &UnresolvedUsingValueDecl::EllipsisToken)
     .def_prop_ro("using_token", &UnresolvedUsingValueDecl::UsingToken)
     .def_prop_ro("is_access_declaration", &UnresolvedUsingValueDecl::IsAccessDeclaration)
-    .def_prop_ro("is_pack_expansion", &UnresolvedUsingValueDecl::IsPackExpansion);
+    .def_prop_ro("is_pack_expansion", &UnresolvedUsingValueDecl::IsPackExpansion)
+    .def("snapshot", &UnresolvedUsingValueDecl::Snapshot);
+
+  nb::class_<UnresolvedUsingValueDeclSnapshot, ValueDeclSnapshot>(m, "UnresolvedUsingValueDeclSnapshot")
+    .def_ro("ellipsis_token", &UnresolvedUsingValueDeclSnapshot::ellipsis_token)
+    .def_ro("using_token", &UnresolvedUsingValueDeclSnapshot::using_token)
+    .def_ro("is_access_declaration", &UnresolvedUsingValueDeclSnapshot::is_access_declaration)
+    .def_ro("is_pack_expansion", &UnresolvedUsingValueDeclSnapshot::is_pack_expansion);
 }
 } // namespace pasta
@@ -23,6 +23,11 @@ void RegisterUserDefinedLiteral(nb::module_ &m) {
     .def_prop_ro("cooked_literal", &UserDefinedLiteral::CookedLiteral)
     .def_prop_ro("end_token", &UserDefinedLiteral::EndToken)
     .def_prop_ro("literal_operator_kind", &UserDefinedLiteral::LiteralOperatorKind)
-    .def_prop_ro("ud_suffix_token", &UserDefinedLiteral::UDSuffixToken);
+    .def_prop_ro("ud_suffix_token", &UserDefinedLiteral::UDSuffixToken)
+    .def("snapshot", &UserDefinedLiteral::Snapshot);
+
+  nb::class_<UserDefinedLiteralSnapshot, CallExprSnapshot>(m, "UserDefinedLiteralSnapshot")
+    .def_ro("literal_operator_kind", &UserDefinedLiteralSnapshot::literal_operator_kind)
+    .def_ro("ud_suffix_token", &UserDefinedLiteralSnapshot::ud_suffix_token);
 }
 } // namespace pasta
@@ -22,6 +22,12 @@ void RegisterUsingDecl(nb::module_ &m) {
     .def_prop_ro("canonical_declaration", &UsingDecl::CanonicalDeclaration)
     .def_prop_ro("using_token", &UsingDecl::UsingToken)
     .def_prop_ro("has_typename", &UsingDecl::HasTypename)
-    .def_prop_ro("is_access_declaration", &UsingDecl::IsAccessDeclaration);
+    .def_prop_ro("is_access_declaration", &UsingDecl::IsAccessDeclaration)
+    .def("snapshot", &UsingDecl::Snapshot);
+
+  nb::class_<UsingDeclSnapshot, BaseUsingDeclSnapshot>(m, "UsingDeclSnapshot")
+    .def_ro("using_token", &UsingDeclSnapshot::using_token)
+    .def_ro("has_typename", &UsingDeclSnapshot::has_typename)
+    .def_ro("is_access_declaration", &UsingDeclSnapshot::is_access_declaration);
 }
 } // namespace pasta
@@ -24,6 +24,12 @@ void RegisterUsingDirectiveDecl(nb::module_ &m) {
     .def_prop_ro("namespace_key_token", &UsingDirectiveDecl::NamespaceKeyToken)
     .def_prop_ro("nominated_namespace", &UsingDirectiveDecl::NominatedNamespace)
     .def_prop_ro("nominated_namespace_as_written", &UsingDirectiveDecl::NominatedNamespaceAsWritten)
-    .def_prop_ro("using_token", &UsingDirectiveDecl::UsingToken);
+    .def_prop_ro("using_token", &UsingDirectiveDecl::UsingToken)
+    .def("snapshot", &UsingDirectiveDecl::Snapshot);
+
+  nb::class_<UsingDirectiveDeclSnapshot, NamedDeclSnapshot>(m, "UsingDirectiveDeclSnapshot")
+    .def_ro("identifier_token", &UsingDirectiveDeclSnapshot::identifier_token)
+    .def_ro("namespace_key_token", &UsingDirectiveDeclSnapshot::namespace_key_token)
+    .def_ro("using_token", &UsingDirectiveDeclSnapshot::using_token);
 }
 } // namespace pasta
@@ -23,6 +23,11 @@ void RegisterUsingEnumDecl(nb::module_ &m) {
     .def_prop_ro("enum_declaration", &UsingEnumDecl::EnumDeclaration)
     .def_prop_ro("enum_token", &UsingEnumDecl::EnumToken)
     .def_prop_ro("enum_type", &UsingEnumDecl::EnumType)
-    .def_prop_ro("using_token", &UsingEnumDecl::UsingToken);
+    .def_prop_ro("using_token", &UsingEnumDecl::UsingToken)
+    .def("snapshot", &UsingEnumDecl::Snapshot);
+
+  nb::class_<UsingEnumDeclSnapshot, BaseUsingDeclSnapshot>(m, "UsingEnumDeclSnapshot")
+    .def_ro("enum_token", &UsingEnumDeclSnapshot::enum_token)
+    .def_ro("using_token", &UsingEnumDeclSnapshot::using_token);
 }
 } // namespace pasta
@@ -21,6 +21,9 @@ void RegisterUsingPackDecl(nb::module_ &m) {
   nb::class_<UsingPackDecl, NamedDecl>(m, "UsingPackDecl")
     .def_prop_ro("expansions", &UsingPackDecl::Expansions)
     .def_prop_ro("canonical_declaration", &UsingPackDecl::CanonicalDeclaration)
-    .def_prop_ro("instantiated_from_using_declaration", &UsingPackDecl::InstantiatedFromUsingDeclaration);
+    .def_prop_ro("instantiated_from_using_declaration", &UsingPackDecl::InstantiatedFromUsingDeclaration)
+    .def("snapshot", &UsingPackDecl::Snapshot);
+
+  nb::class_<UsingPackDeclSnapshot, NamedDeclSnapshot>(m, "UsingPackDeclSnapshot");
 }
 } // namespace pasta
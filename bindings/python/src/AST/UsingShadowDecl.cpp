@@ -22,6 +22,9 @@ void RegisterUsingShadowDecl(nb::module_ &m) {
     .def_prop_ro("canonical_declaration", &UsingShadowDecl::CanonicalDeclaration)
     .def_prop_ro("introducer", &UsingShadowDecl::Introducer)
     .def_prop_ro("next_using_shadow_declaration", &UsingShadowDecl::NextUsingShadowDeclaration)
-    .def_prop_ro("target_declaration", &UsingShadowDecl::TargetDeclaration);
+    .def_prop_ro("target_declaration", &UsingShadowDecl::TargetDeclaration)
+    .def("snapshot", &UsingShadowDecl::Snapshot);
+
+  nb::class_<UsingShadowDeclSnapshot, NamedDeclSnapshot>(m, "UsingShadowDeclSnapshot");
 }
 } // namespace pasta
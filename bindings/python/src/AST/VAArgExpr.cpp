@@ -25,6 +25,12 @@ void RegisterVAArgExpr(nb::module_ &m) {
     .def_prop_ro("end_token", &VAArgExpr::EndToken)
     .def_prop_ro("r_paren_token", &VAArgExpr::RParenToken)
     .def_prop_ro("sub_expression", &VAArgExpr::SubExpression)
-    .def_prop_ro("is_microsoft_abi", &VAArgExpr::IsMicrosoftABI);
+    .def_prop_ro("is_microsoft_abi", &VAArgExpr::IsMicrosoftABI)
+    .def("snapshot", &VAArgExpr::Snapshot);
+
+  nb::class_<VAArgExprSnapshot, ExprSnapshot>(m, "VAArgExprSnapshot")
+    .def_ro("builtin_token", &VAArgExprSnapshot::builtin_token)
+    .def_ro("r_paren_token", &VAArgExprSnapshot::r_paren_token)
+    .def_ro("is_microsoft_abi", &VAArgExprSnapshot::is_microsoft_abi);
 }
 } // namespace pasta
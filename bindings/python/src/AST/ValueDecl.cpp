@@ -22,6 +22,11 @@ void RegisterValueDecl(nb::module_ &m) {
     .def_prop_ro("potentially_decomposed_variable_declaration", &ValueDecl::PotentiallyDecomposedVariableDeclaration)
     .def_prop_ro("type", &ValueDecl::Type)
     .def_prop_ro("is_initializer_capture", &ValueDecl::IsInitializerCapture)
-    .def_prop_ro("is_weak", &ValueDecl::IsWeak);
+    .def_prop_ro("is_weak", &ValueDecl::IsWeak)
+    .def("snapshot", &ValueDecl::Snapshot);
+
+  nb::class_<ValueDeclSnapshot, NamedDeclSnapshot>(m, "ValueDeclSnapshot")
+    .def_ro("is_initializer_capture", &ValueDeclSnapshot::is_initializer_capture)
+    .def_ro("is_weak", &ValueDeclSnapshot::is_weak);
 }
 } // namespace pasta
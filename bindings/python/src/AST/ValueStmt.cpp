@@ -19,6 +19,9 @@ namespace nb = nanobind;
 
 void RegisterValueStmt(nb::module_ &m) {
   nb::class_<ValueStmt, Stmt>(m, "ValueStmt")
-    .def_prop_ro("expression_statement", &ValueStmt::ExpressionStatement);
+    .def_prop_ro("expression_statement", &ValueStmt::ExpressionStatement)
+    .def("snapshot", &ValueStmt::Snapshot);
+
+  nb::class_<ValueStmtSnapshot, StmtSnapshot>(m, "ValueStmtSnapshot");
 }
 } // namespace pasta
@@ -70,6 +70,50 @@ void RegisterVarDecl(nb::module_ &m) {
     .def_prop_ro("is_static_local", &VarDecl::IsStaticLocal)
     .def_prop_ro("is_this_declaration_a_demoted_definition", &VarDecl::IsThisDeclarationADemotedDefinition)
     .def_prop_ro("is_usable_in_constant_expressions", &VarDecl::IsUsableInConstantExpressions)
-    .def_prop_ro("might_be_usable_in_constant_expressions", &VarDecl::MightBeUsableInConstantExpressions);
+    .def_prop_ro("might_be_usable_in_constant_expressions", &VarDecl::MightBeUsableInConstantExpressions)
+    .def("snapshot", &VarDecl::Snapshot);
+
+  nb::class_<VarDeclSnapshot, DeclaratorDeclSnapshot>(m, "VarDeclSnapshot")
+    .def_ro("initializer_style", &VarDeclSnapshot::initializer_style)
+    .def_ro("language_linkage", &VarDeclSnapshot::language_linkage)
+    .def_ro("point_of_instantiation", &VarDeclSnapshot::point_of_instantiation)
+    .def_ro("storage_class", &VarDeclSnapshot::storage_class)
+    .def_ro("storage_duration", &VarDeclSnapshot::storage_duration)
+    .def_ro("tls_kind", &VarDeclSnapshot::tls_kind)
+    .def_ro("tsc_spec", &VarDeclSnapshot::tsc_spec)
+    .def_ro("template_specialization_kind", &VarDeclSnapshot::template_specialization_kind)
+    .def_ro("template_specialization_kind_for_instantiation", &VarDeclSnapshot::template_specialization_kind_for_instantiation)
+    .def_ro("has_constant_initialization", &VarDeclSnapshot::has_constant_initialization)
+    .def_ro("has_dependent_alignment", &VarDeclSnapshot::has_dependent_alignment)
+    .def_ro("has_external_storage", &VarDeclSnapshot::has_external_storage)
+    .def_ro("has_global_storage", &VarDeclSnapshot::has_global_storage)
+    .def_ro("has_initializer", &VarDeclSnapshot::has_initializer)
+    .def_ro("has_local_storage", &VarDeclSnapshot::has_local_storage)
+    .def_ro("is_arc_pseudo_strong", &VarDeclSnapshot::is_arc_pseudo_strong)
+    .def_ro("is_cxx_for_range_declaration", &VarDeclSnapshot::is_cxx_for_range_declaration)
+    .def_ro("is_constexpr", &VarDeclSnapshot::is_constexpr)
+    .def_ro("is_direct_initializer", &VarDeclSnapshot::is_direct_initializer)
+    .def_ro("is_escaping_byref", &VarDeclSnapshot::is_escaping_byref)
+    .def_ro("is_exception_variable", &VarDeclSnapshot::is_exception_variable)
+    .def_ro("is_extern_c", &VarDeclSnapshot::is_extern_c)
+    .def_ro("is_file_variable_declaration", &VarDeclSnapshot::is_file_variable_declaration)
+    .def_ro("is_function_or_method_variable_declaration", &VarDeclSnapshot::is_function_or_method_variable_declaration)
+    .def_ro("is_in_extern_c_context", &VarDeclSnapshot::is_in_extern_c_context)
+    .def_ro("is_in_extern_cxx_context", &VarDeclSnapshot::is_in_extern_cxx_context)
+    .def_ro("is_inline", &VarDeclSnapshot::is_inline)
+    .def_ro("is_inline_specified", &VarDeclSnapshot::is_inline_specified)
+    .def_ro("is_known_to_be_defined", &VarDeclSnapshot::is_known_to_be_defined)
+    .def_ro("is_local_variable_declaration", &VarDeclSnapshot::is_local_variable_declaration)
+    .def_ro("is_local_variable_declaration_or_parm", &VarDeclSnapshot::is_local_variable_declaration_or_parm)
+    .def_ro("is_nrvo_variable", &VarDeclSnapshot::is_nrvo_variable)
+    .def_ro("is_no_destroy", &VarDeclSnapshot::is_no_destroy)
+    .def_ro("is_non_escaping_byref", &VarDeclSnapshot::is_non_escaping_byref)
+    .def_ro("is_obj_c_for_declaration", &VarDeclSnapshot::is_obj_c_for_declaration)
+    .def_ro("is_previous_declaration_in_same_block_scope", &VarDeclSnapshot::is_previous_declaration_in_same_block_scope)
+    .def_ro("is_static_data_member", &VarDeclSnapshot::is_static_data_member)
+    .def_ro("is_static_local", &VarDeclSnapshot::is_static_local)
+    .def_ro("is_this_declaration_a_demoted_definition", &VarDeclSnapshot::is_this_declaration_a_demoted_definition)
+    .def_ro("is_usable_in_constant_expressions", &VarDeclSnapshot::is_usable_in_constant_expressions)
+    .def_ro("might_be_usable_in_constant_expressions", &VarDeclSnapshot::might_be_usable_in_constant_expressions);
 }
 } // namespace pasta
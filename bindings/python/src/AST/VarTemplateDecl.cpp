@@ -25,6 +25,10 @@ void RegisterVarTemplateDecl(nb::module_ &m) {
     .def_prop_ro("previous_declaration", &VarTemplateDecl::PreviousDeclaration)
     .def_prop_ro("templated_declaration", &VarTemplateDecl::TemplatedDeclaration)
     .def_prop_ro("is_this_declaration_a_definition", &VarTemplateDecl::IsThisDeclarationADefinition)
-    .def_prop_ro("specializations", &VarTemplateDecl::Specializations);
+    .def_prop_ro("specializations", &VarTemplateDecl::Specializations)
+    .def("snapshot", &VarTemplateDecl::Snapshot);
+
+  nb::class_<VarTemplateDeclSnapshot, RedeclarableTemplateDeclSnapshot>(m, "VarTemplateDeclSnapshot")
+    .def_ro("is_this_declaration_a_definition", &VarTemplateDeclSnapshot::is_this_declaration_a_definition);
 }
 } // namespace pasta
@@ -21,6 +21,10 @@ void RegisterVarTemplatePartialSpecializationDecl(nb::module_ &m) {
   nb::class_<VarTemplatePartialSpecializationDecl, VarTemplateSpecializationDecl>(m, "VarTemplatePartialSpecializationDecl")
     .def_prop_ro("instantiated_from_member", &VarTemplatePartialSpecializationDecl::InstantiatedFromMember)
     .def_prop_ro("template_parameters", &VarTemplatePartialSpecializationDecl::TemplateParameters)
-    .def_prop_ro("has_associated_constraints", &VarTemplatePartialSpecializationDecl::HasAssociatedConstraints);
+    .def_prop_ro("has_associated_constraints", &VarTemplatePartialSpecializationDecl::HasAssociatedConstraints)
+    .def("snapshot", &VarTemplatePartialSpecializationDecl::Snapshot);
+
+  nb::class_<VarTemplatePartialSpecializationDeclSnapshot, VarTemplateSpecializationDeclSnapshot>(m, "VarTemplatePartialSpecializationDeclSnapshot")
+    .def_ro("has_associated_constraints", &VarTemplatePartialSpecializationDeclSnapshot::has_associated_constraints);
 }
 } // namespace pasta
@@ -31,6 +31,15 @@ void RegisterVarTemplateSpecializationDecl(nb::module_ &m) {
     .def_prop_ro("type_as_written", &VarTemplateSpecializationDecl::TypeAsWritten)
     .def_prop_ro("is_class_scope_explicit_specialization", &VarTemplateSpecializationDecl::IsClassScopeExplicitSpecialization)
     .def_prop_ro("is_explicit_instantiation_or_specialization", &VarTemplateSpecializationDecl::IsExplicitInstantiationOrSpecialization)
-    .def_prop_ro("is_explicit_specialization", &VarTemplateSpecializationDecl::IsExplicitSpecialization);
+    .def_prop_ro("is_explicit_specialization", &VarTemplateSpecializationDecl::IsExplicitSpecialization)
+    .def("snapshot", &VarTemplateSpecializationDecl::Snapshot);
+
+  nb::class_<VarTemplateSpecializationDeclSnapshot, VarDeclSnapshot>(m, "VarTemplateSpecializationDeclSnapshot")
+    .def_ro("extern_token", &VarTemplateSpecializationDeclSnapshot::extern_token)
+    .def_ro("specialization_kind", &VarTemplateSpecializationDeclSnapshot::specialization_kind)
+    .def_ro("template_keyword_token", &VarTemplateSpecializationDeclSnapshot::template_keyword_token)
+    .def_ro("is_class_scope_explicit_specialization", &VarTemplateSpecializationDeclSnapshot::is_class_scope_explicit_specialization)
+    .def_ro("is_explicit_instantiation_or_specialization", &VarTemplateSpecializationDeclSnapshot::is_explicit_instantiation_or_specialization)
+    .def_ro("is_explicit_specialization", &VarTemplateSpecializationDeclSnapshot::is_explicit_specialization);
 }
 } // namespace pasta
@@ -29,6 +29,13 @@ void RegisterWhileStmt(nb::module_ &m) {
     .def_prop_ro("l_paren_token", &WhileStmt::LParenToken)
     .def_prop_ro("r_paren_token", &WhileStmt::RParenToken)
     .def_prop_ro("while_token", &WhileStmt::WhileToken)
-    .def_prop_ro("has_variable_storage", &WhileStmt::HasVariableStorage);
+    .def_prop_ro("has_variable_storage", &WhileStmt::HasVariableStorage)
+    .def("snapshot", &WhileStmt::Snapshot);
+
+  nb::class_<WhileStmtSnapshot, StmtSnapshot>(m, "WhileStmtSnapshot")
+    .def_ro("l_paren_token", &WhileStmtSnapshot::l_paren_token)
+    .def_ro("r_paren_token", &WhileStmtSnapshot::r_paren_token)
+    .def_ro("while_token", &WhileStmtSnapshot::while_token)
+    .def_ro("has_variable_storage", &WhileStmtSnapshot::has_variable_storage);
 }
 } // namespace pasta
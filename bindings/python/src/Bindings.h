@@ -59,6 +59,23 @@ const std::type_info *TypeInfoFromKind(MacroKind kind);
 } // namespace pasta
 namespace nanobind::detail {
 
+// Lazy ranges are materialized into Python lists.
+template <typename T>
+struct type_caster<::pasta::LazyRange<T>> {
+  using VectorCaster = make_caster<std::vector<T>>;
+
+  NB_TYPE_CASTER(::pasta::LazyRange<T>, VectorCaster::Name)
+
+  bool from_python(handle, uint8_t, cleanup_list *) noexcept {
+    return false;
+  }
+
+  static handle from_cpp(const ::pasta::LazyRange<T> &range, rv_policy policy,
+                         cleanup_list *cleanup) {
+    return VectorCaster::from_cpp(range.to_vector(), policy, cleanup);
+  }
+};
+
 #define DECLARE_HOOK(t, suffix) \
     template <> \
     struct type_hook<::pasta::t ## suffix> { \
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "Decl.h"
+#include "LazyRange.h"
 #include "Macro.h"
 #include "Stmt.h"
 #include "Token.h"
@@ -91,6 +92,46 @@ class AST {
   // construction of this AST.
   const std::vector<::pasta::File> &ParsedFiles(void) const;
 
+  // Enable memoization of `PrintedTokenRange::Create` on the declarations,
+  // statements, and types of this AST, retaining approximately at most
+  // `max_bytes` worth of printed token ranges, and evicting the least recently
+  // used ones first. Only printing policies with a `CacheKey` are cached.
+  // Cached printed token ranges are shared, and so things like
+  // `PrintedTokenRange::Align` will operate on private copies of them.
+  //
+  // NOTE(pag): This must not be called concurrently with printing.
+  void EnablePrintCache(size_t max_bytes) const;
+
+  // Disable memoization of `PrintedTokenRange::Create`.
+  void DisablePrintCache(void) const;
+
+  // Return all declarations of kind `kind`, in source order. The first call to
+  // this, or to any of the other `...OfKind` methods, walks the whole AST (as
+  // in `Walker::Walk`) to build an index from kinds to compact arrays of
+  // entities; subsequent calls return ranges over those arrays. These methods
+  // are safe to call concurrently.
+  LazyRange<Decl> DeclsOfKind(DeclKind kind) const;
+
+  // Return all statements of kind `kind`, in source order.
+  LazyRange<Stmt> StmtsOfKind(StmtKind kind) const;
+
+  // Return all declarations that are a `T`, or are derived from `T`, in source
+  // order, e.g. `ast.DeclsOfKind<FunctionDecl>()` also returns the
+  // `CXXMethodDecl`s, and `ast.DeclsOfKind<TagDecl>()` returns all records and
+  // enums.
+  //
+  // NOTE(pag): When `T` covers more than one kind, the first call merges the
+  //            entities of those kinds back into source order, and keeps the
+  //            merged array for later calls.
+  template <typename T>
+  LazyRange<T> DeclsOfKind(void) const;
+
+  // Return all statements that are a `T`, or are derived from `T`, in source
+  // order, e.g. `ast.StmtsOfKind<CallExpr>()` also returns the
+  // `CXXMemberCallExpr`s.
+  template <typename T>
+  LazyRange<T> StmtsOfKind(void) const;
+
 #ifndef PASTA_IN_BOOTSTRAP
   Token Adopt(const clang::SourceLocation &loc) const;
   Attr Adopt(const clang::Attr *attr) const;
@@ -101,10 +142,14 @@ class AST {
 
  private:
   friend class ASTImpl;
+  friend class CompileCache;
   friend class Compiler;
   friend class CompileJob;
   friend class DeclBase;
   friend class DeclPrinter;
+  friend class EntityExport;
+  friend class TokenSnapshot;
+  friend class WalkerImpl;
 
   AST(void) = delete;
 
@@ -113,5 +158,45 @@ class AST {
   std::shared_ptr<ASTImpl> impl;
 };
 
+// The result of only preprocessing a compile job, i.e. without parsing the
+// preprocessed code into an AST. This provides the same token and macro APIs
+// as `AST`, but none of the declaration, statement, or type APIs.
+class PreprocessedTranslationUnit {
+ public:
+  ~PreprocessedTranslationUnit(void);
+  PreprocessedTranslationUnit(const PreprocessedTranslationUnit &);
+  PreprocessedTranslationUnit(PreprocessedTranslationUnit &&) noexcept;
+  PreprocessedTranslationUnit &operator=(const PreprocessedTranslationUnit &);
+  PreprocessedTranslationUnit &operator=(
+      PreprocessedTranslationUnit &&) noexcept;
+
+  // Return the raw pre-processed code
+  std::string_view PreprocessedCode(void) const;
+
+  // Return all lexed tokens.
+  TokenRange Tokens(void) const;
+
+  // Return all top-level macro nodes (expansions, directives, substitutions,
+  // etc.).
+  MacroRange Macros(void) const;
+
+  clang::Preprocessor &UnderlyingPP(void) const;
+
+  // Return the main file which was preprocessed.
+  File MainFile(void) const;
+
+  // Return the list of all source files which were preprocessed.
+  const std::vector<::pasta::File> &ParsedFiles(void) const;
+
+ private:
+  friend class CompileJob;
+  friend class TokenSnapshot;
+
+  PreprocessedTranslationUnit(void) = delete;
+
+  PreprocessedTranslationUnit(std::shared_ptr<ASTImpl> impl_);
+
+  std::shared_ptr<ASTImpl> impl;
+};
 
 }  // namespace pasta
@@ -0,0 +1,465 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Decl.h"
+#include "Macro.h"
+#include "Stmt.h"
+#include "Token.h"
+#include "Type.h"
+
+// Borrowed handles are non-owning counterparts of `Decl`, `Stmt`, `Type`,
+// `Token`, `TokenRange`, and `Macro`. The owning handles each hold a
+// `std::shared_ptr<ASTImpl>`, and so every copy of one, e.g. of a returned
+// value or of an element of a `Children()` list, increments and decrements an
+// atomic reference count that is shared by all handles into the same AST. A
+// borrowed handle instead holds a raw pointer to the AST, is trivially
+// copyable, and is only valid for as long as some owning handle (e.g. the
+// `AST` itself) keeps the AST alive.
+//
+// Borrowed handles can be converted to/from their owning counterparts with
+// explicit conversions. Borrowed handles only have a few hot accessors, e.g.
+// `Kind()`, `Tokens()`, or `Children()`, and these return borrowed handles
+// without touching any reference counts. All other accessors are reached via
+// `View()`, or `operator->`, which produce a `BorrowedView`. A view holds an
+// owning handle, and so it costs one reference count increment/decrement, and
+// the handles returned by its accessors are themselves owning.
+//
+// NOTE(pag): Converting a borrowed handle to an owning handle, including via
+//            `View()`, `operator->`, or `As<T>()`, requires that the AST still
+//            be owned, i.e. alive.
+
+namespace pasta {
+namespace detail {
+
+// Returns a `std::shared_ptr` that shares ownership of `ast`.
+std::shared_ptr<ASTImpl> OwnedAST(const ASTImpl *ast);
+
+// What `View()`, or `operator->`, of a borrowed handle returns. This exposes
+// all of the accessors of the owning handle `T`. A view can be neither copied
+// nor moved, and so it is only usable within the full expression that made it,
+// or via a reference bound to it, e.g. `const auto &view = decl.View()`. To
+// keep the entity, copy `*view`, which is an owning handle.
+template <typename T>
+class BorrowedView {
+ private:
+  T entity;
+
+ public:
+  inline explicit BorrowedView(T entity_)
+      : entity(std::move(entity_)) {}
+
+  BorrowedView(const BorrowedView<T> &) = delete;
+  BorrowedView(BorrowedView<T> &&) noexcept = delete;
+  BorrowedView<T> &operator=(const BorrowedView<T> &) = delete;
+  BorrowedView<T> &operator=(BorrowedView<T> &&) noexcept = delete;
+
+  inline const T *operator->(void) const noexcept {
+    return &entity;
+  }
+
+  inline const T &operator*(void) const noexcept {
+    return entity;
+  }
+};
+
+}  // namespace detail
+
+class BorrowedToken;
+class BorrowedTokenRange;
+class WalkerImpl;
+
+// A borrowed `Decl`.
+class BorrowedDecl {
+ private:
+  friend class WalkerImpl;
+
+  const ASTImpl *ast;
+  const ::clang::Decl *decl;
+
+  inline explicit BorrowedDecl(const ASTImpl *ast_,
+                               const ::clang::Decl *decl_) noexcept
+      : ast(ast_),
+        decl(decl_) {}
+
+ public:
+  BorrowedDecl(void) = delete;
+
+  inline explicit BorrowedDecl(const Decl &that) noexcept
+      : ast(that.ast.get()),
+        decl(that.u.Decl) {}
+
+  // Returns an owning handle to this declaration.
+  explicit operator Decl(void) const;
+
+  // Returns a view on which all accessors of `Decl` are available.
+  inline detail::BorrowedView<Decl> View(void) const {
+    return detail::BorrowedView<Decl>(static_cast<Decl>(*this));
+  }
+
+  inline detail::BorrowedView<Decl> operator->(void) const {
+    return View();
+  }
+
+  // Try to downcast this declaration, e.g. `decl.As<FunctionDecl>()`. The
+  // returned declaration is an owning handle.
+  template <typename T>
+  inline std::optional<T> As(void) const {
+    return T::From(static_cast<Decl>(*this));
+  }
+
+  inline const ::clang::Decl *RawDecl(void) const noexcept {
+    return decl;
+  }
+
+  DeclKind Kind(void) const;
+  std::string_view KindName(void) const;
+
+  ::pasta::BorrowedToken Token(void) const;
+  ::pasta::BorrowedTokenRange Tokens(void) const;
+
+  inline uint64_t Hash(void) const noexcept {
+    return std::hash<const void *>{}(decl);
+  }
+
+  inline bool operator==(const BorrowedDecl &that) const noexcept {
+    return decl == that.decl;
+  }
+
+  inline bool operator!=(const BorrowedDecl &that) const noexcept {
+    return decl != that.decl;
+  }
+
+  inline bool operator<(const BorrowedDecl &that) const noexcept {
+    return decl < that.decl;
+  }
+};
+
+// A borrowed `Stmt`.
+class BorrowedStmt {
+ private:
+  friend class WalkerImpl;
+
+  const ASTImpl *ast;
+  const ::clang::Stmt *stmt;
+
+  inline explicit BorrowedStmt(const ASTImpl *ast_,
+                               const ::clang::Stmt *stmt_) noexcept
+      : ast(ast_),
+        stmt(stmt_) {}
+
+ public:
+  BorrowedStmt(void) = delete;
+
+  inline explicit BorrowedStmt(const Stmt &that) noexcept
+      : ast(that.ast.get()),
+        stmt(that.u.Stmt) {}
+
+  // Returns an owning handle to this statement.
+  explicit operator Stmt(void) const;
+
+  // Returns a view on which all accessors of `Stmt` are available.
+  inline detail::BorrowedView<Stmt> View(void) const {
+    return detail::BorrowedView<Stmt>(static_cast<Stmt>(*this));
+  }
+
+  inline detail::BorrowedView<Stmt> operator->(void) const {
+    return View();
+  }
+
+  // Try to downcast this statement, e.g. `stmt.As<CallExpr>()`. The returned
+  // statement is an owning handle.
+  template <typename T>
+  inline std::optional<T> As(void) const {
+    return T::From(static_cast<Stmt>(*this));
+  }
+
+  inline const ::clang::Stmt *RawStmt(void) const noexcept {
+    return stmt;
+  }
+
+  StmtKind Kind(void) const;
+  std::string_view KindName(void) const;
+
+  std::vector<BorrowedStmt> Children(void) const;
+  ::pasta::BorrowedToken BeginToken(void) const;
+  ::pasta::BorrowedToken EndToken(void) const;
+  ::pasta::BorrowedTokenRange Tokens(void) const;
+
+  inline uint64_t Hash(void) const noexcept {
+    return std::hash<const void *>{}(stmt);
+  }
+
+  inline bool operator==(const BorrowedStmt &that) const noexcept {
+    return stmt == that.stmt;
+  }
+
+  inline bool operator!=(const BorrowedStmt &that) const noexcept {
+    return stmt != that.stmt;
+  }
+
+  inline bool operator<(const BorrowedStmt &that) const noexcept {
+    return stmt < that.stmt;
+  }
+};
+
+// A borrowed `Type`.
+//
+// NOTE(pag): Unlike the other borrowed handles, this is three words rather
+//            than two: two pointers, plus the kind and qualifiers of the type,
+//            as the qualifiers can't be recovered from the `clang::Type`
+//            alone.
+class BorrowedType {
+ private:
+  const ASTImpl *ast;
+  const ::clang::Type *type;
+  TypeKind kind;
+  uint32_t qualifiers;
+
+ public:
+  BorrowedType(void) = delete;
+
+  inline explicit BorrowedType(const Type &that) noexcept
+      : ast(that.ast.get()),
+        type(that.u.Type),
+        kind(that.kind),
+        qualifiers(that.qualifiers) {}
+
+  // Returns an owning handle to this type.
+  explicit operator Type(void) const;
+
+  // Returns a view on which all accessors of `Type` are available.
+  inline detail::BorrowedView<Type> View(void) const {
+    return detail::BorrowedView<Type>(static_cast<Type>(*this));
+  }
+
+  inline detail::BorrowedView<Type> operator->(void) const {
+    return View();
+  }
+
+  // Try to downcast this type, e.g. `type.As<PointerType>()`. The returned
+  // type is an owning handle.
+  template <typename T>
+  inline std::optional<T> As(void) const {
+    return T::From(static_cast<Type>(*this));
+  }
+
+  inline const ::clang::Type *RawType(void) const noexcept {
+    return type;
+  }
+
+  inline uint32_t RawQualifiers(void) const noexcept {
+    return qualifiers;
+  }
+
+  inline TypeKind Kind(void) const noexcept {
+    return kind;
+  }
+
+  std::string_view KindName(void) const;
+
+  inline bool operator==(const BorrowedType &that) const noexcept {
+    return type == that.type && qualifiers == that.qualifiers;
+  }
+
+  inline bool operator!=(const BorrowedType &that) const noexcept {
+    return !(*this == that);
+  }
+};
+
+// A borrowed `Token`.
+class BorrowedToken {
+ private:
+  friend class BorrowedTokenRange;
+
+  const ASTImpl *ast;
+  const TokenImpl *impl;
+
+  inline explicit BorrowedToken(const ASTImpl *ast_,
+                                const TokenImpl *impl_) noexcept
+      : ast(ast_),
+        impl(impl_) {}
+
+ public:
+  BorrowedToken(void) = delete;
+
+  inline explicit BorrowedToken(const Token &that) noexcept
+      : ast(that.ast.get()),
+        impl(that.impl) {}
+
+  // Returns an owning handle to this token.
+  explicit operator Token(void) const;
+
+  // Returns a view on which all accessors of `Token` are available.
+  inline detail::BorrowedView<Token> View(void) const {
+    return detail::BorrowedView<Token>(static_cast<Token>(*this));
+  }
+
+  inline detail::BorrowedView<Token> operator->(void) const {
+    return View();
+  }
+
+  inline const void *RawToken(void) const noexcept {
+    return impl;
+  }
+
+  std::string_view Data(void) const;
+  uint64_t Index(void) const;
+  TokenKind Kind(void) const noexcept;
+  TokenRole Role(void) const noexcept;
+  const char *KindName(void) const noexcept;
+  unsigned DerivationDepth(void) const noexcept;
+
+  inline operator bool(void) const noexcept {
+    return !!impl;
+  }
+
+  inline uint64_t Hash(void) const noexcept {
+    return std::hash<const TokenImpl *>{}(impl);
+  }
+
+  inline bool operator==(const BorrowedToken &that) const noexcept {
+    return impl == that.impl;
+  }
+
+  inline bool operator!=(const BorrowedToken &that) const noexcept {
+    return impl != that.impl;
+  }
+
+  inline bool operator<(const BorrowedToken &that) const noexcept {
+    return impl < that.impl;
+  }
+};
+
+// A borrowed `TokenRange`. To fit in two words, this holds the indices of the
+// first and after-last tokens of the range in the AST's token list.
+class BorrowedTokenRange {
+ private:
+  const ASTImpl *ast;
+  uint32_t first;
+  uint32_t after_last;
+
+ public:
+  BorrowedTokenRange(void) = delete;
+
+  explicit BorrowedTokenRange(const TokenRange &that) noexcept;
+
+  // Returns an owning handle to this token range.
+  explicit operator TokenRange(void) const;
+
+  // Returns a view on which all accessors of `TokenRange` are available.
+  inline detail::BorrowedView<TokenRange> View(void) const {
+    return detail::BorrowedView<TokenRange>(static_cast<TokenRange>(*this));
+  }
+
+  inline detail::BorrowedView<TokenRange> operator->(void) const {
+    return View();
+  }
+
+  inline size_t Size(void) const noexcept {
+    return after_last - first;
+  }
+
+  inline size_t size(void) const noexcept {
+    return Size();
+  }
+
+  inline bool empty(void) const noexcept {
+    return first == after_last;
+  }
+
+  // Unsafe indexed access into the token range.
+  BorrowedToken operator[](size_t index) const noexcept;
+
+  inline operator bool(void) const noexcept {
+    return first < after_last;
+  }
+
+  inline bool operator==(const BorrowedTokenRange &that) const noexcept {
+    return ast == that.ast && first == that.first &&
+           after_last == that.after_last;
+  }
+
+  inline bool operator!=(const BorrowedTokenRange &that) const noexcept {
+    return !(*this == that);
+  }
+};
+
+// A borrowed `Macro`.
+class BorrowedMacro {
+ private:
+  const ASTImpl *ast;
+  const void *impl;
+
+ public:
+  BorrowedMacro(void) = delete;
+
+  inline explicit BorrowedMacro(const Macro &that) noexcept
+      : ast(that.ast.get()),
+        impl(that.impl) {}
+
+  // Returns an owning handle to this macro node.
+  explicit operator Macro(void) const;
+
+  // Returns a view on which all accessors of `Macro` are available.
+  inline detail::BorrowedView<Macro> View(void) const {
+    return detail::BorrowedView<Macro>(static_cast<Macro>(*this));
+  }
+
+  inline detail::BorrowedView<Macro> operator->(void) const {
+    return View();
+  }
+
+  // Try to downcast this macro node, e.g. `macro.As<MacroExpansion>()`. The
+  // returned node is an owning handle.
+  template <typename T>
+  inline std::optional<T> As(void) const {
+    return T::From(static_cast<Macro>(*this));
+  }
+
+  inline const void *RawMacro(void) const noexcept {
+    return impl;
+  }
+
+  MacroKind Kind(void) const noexcept;
+  std::string_view KindName(void) const noexcept;
+
+  inline bool operator==(const BorrowedMacro &that) const noexcept {
+    return impl == that.impl;
+  }
+
+  inline bool operator!=(const BorrowedMacro &that) const noexcept {
+    return impl != that.impl;
+  }
+
+  inline bool operator<(const BorrowedMacro &that) const noexcept {
+    return impl < that.impl;
+  }
+};
+
+static_assert(sizeof(BorrowedDecl) == (2 * sizeof(void *)));
+static_assert(sizeof(BorrowedStmt) == (2 * sizeof(void *)));
+static_assert(sizeof(BorrowedToken) == (2 * sizeof(void *)));
+static_assert(sizeof(BorrowedTokenRange) == (2 * sizeof(void *)));
+static_assert(sizeof(BorrowedMacro) == (2 * sizeof(void *)));
+static_assert(sizeof(BorrowedType) == (3 * sizeof(void *)));
+
+static_assert(std::is_trivially_copyable_v<BorrowedDecl>);
+static_assert(std::is_trivially_copyable_v<BorrowedStmt>);
+static_assert(std::is_trivially_copyable_v<BorrowedType>);
+static_assert(std::is_trivially_copyable_v<BorrowedToken>);
+static_assert(std::is_trivially_copyable_v<BorrowedTokenRange>);
+static_assert(std::is_trivially_copyable_v<BorrowedMacro>);
+
+}  // namespace pasta
@@ -12,6 +12,7 @@
 #include <variant>
 #include <vector>
 #include <pasta/Util/Compiler.h>
+#include "LazyRange.h"
 #include "Forward.h"
 
 #include "Attr.h"
@@ -185,7 +186,7 @@ class DeclContext {
   // ContainsDeclaration: (bool)
   // ContainsDeclarationAndLoad: (bool)
   // Ddiags: (llvm::iterator_range<clang::DeclContext::ddiag_iterator>)
-  std::vector<::pasta::Decl> Declarations(void) const;
+  ::pasta::LazyRange<::pasta::Decl> Declarations(void) const;
   enum ::pasta::DeclKind DeclarationKind(void) const;
   std::string_view DeclarationKindName(void) const;
   std::optional<::pasta::DeclContext> EnclosingNamespaceContext(void) const;
@@ -221,7 +222,7 @@ class DeclContext {
   bool IsTransparentContext(void) const;
   // Lookup: (clang::DeclContextLookupResult)
   // Lookups: (llvm::iterator_range<clang::DeclContext::all_lookups_iterator>)
-  std::vector<::pasta::Decl> AlreadyLoadedDeclarations(void) const;
+  ::pasta::LazyRange<::pasta::Decl> AlreadyLoadedDeclarations(void) const;
   // NoloadLookups: (llvm::iterator_range<clang::DeclContext::all_lookups_iterator>)
   bool ShouldUseQualifiedLookup(void) const;
   // UsingDirectives: (llvm::iterator_range<clang::DeclContext::udir_iterator>)
@@ -244,9 +245,112 @@ class DeclContext {
   }
 };
 
+struct DeclSnapshot;
+struct EmptyDeclSnapshot;
+struct ExportDeclSnapshot;
+struct ExternCContextDeclSnapshot;
+struct FileScopeAsmDeclSnapshot;
+struct FriendDeclSnapshot;
+struct FriendTemplateDeclSnapshot;
+struct ImplicitConceptSpecializationDeclSnapshot;
+struct ImportDeclSnapshot;
+struct LifetimeExtendedTemporaryDeclSnapshot;
+struct LinkageSpecDeclSnapshot;
+struct NamedDeclSnapshot;
+struct NamespaceAliasDeclSnapshot;
+struct NamespaceDeclSnapshot;
+struct ObjCCompatibleAliasDeclSnapshot;
+struct ObjCContainerDeclSnapshot;
+struct ObjCImplDeclSnapshot;
+struct ObjCImplementationDeclSnapshot;
+struct ObjCInterfaceDeclSnapshot;
+struct ObjCMethodDeclSnapshot;
+struct ObjCPropertyDeclSnapshot;
+struct ObjCPropertyImplDeclSnapshot;
+struct ObjCProtocolDeclSnapshot;
+struct PragmaCommentDeclSnapshot;
+struct PragmaDetectMismatchDeclSnapshot;
+struct RequiresExprBodyDeclSnapshot;
+struct StaticAssertDeclSnapshot;
+struct TemplateDeclSnapshot;
+struct TemplateTemplateParmDeclSnapshot;
+struct TopLevelStmtDeclSnapshot;
+struct TranslationUnitDeclSnapshot;
+struct TypeDeclSnapshot;
+struct TypedefNameDeclSnapshot;
+struct UnresolvedUsingIfExistsDeclSnapshot;
+struct UnresolvedUsingTypenameDeclSnapshot;
+struct UsingDirectiveDeclSnapshot;
+struct UsingPackDeclSnapshot;
+struct UsingShadowDeclSnapshot;
+struct ValueDeclSnapshot;
+struct OMPDeclarativeDirectiveDeclSnapshot;
+struct OMPDeclarativeDirectiveValueDeclSnapshot;
+struct AccessSpecDeclSnapshot;
+struct BaseUsingDeclSnapshot;
+struct BindingDeclSnapshot;
+struct BlockDeclSnapshot;
+struct BuiltinTemplateDeclSnapshot;
+struct CapturedDeclSnapshot;
+struct ClassScopeFunctionSpecializationDeclSnapshot;
+struct ConceptDeclSnapshot;
+struct ConstructorUsingShadowDeclSnapshot;
+struct DeclaratorDeclSnapshot;
+struct EnumConstantDeclSnapshot;
+struct FieldDeclSnapshot;
+struct FunctionDeclSnapshot;
+struct HLSLBufferDeclSnapshot;
+struct IndirectFieldDeclSnapshot;
+struct LabelDeclSnapshot;
+struct MSGuidDeclSnapshot;
+struct MSPropertyDeclSnapshot;
+struct NonTypeTemplateParmDeclSnapshot;
+struct OMPAllocateDeclSnapshot;
+struct OMPDeclareMapperDeclSnapshot;
+struct OMPDeclareReductionDeclSnapshot;
+struct OMPRequiresDeclSnapshot;
+struct OMPThreadPrivateDeclSnapshot;
+struct ObjCAtDefsFieldDeclSnapshot;
+struct ObjCCategoryDeclSnapshot;
+struct ObjCCategoryImplDeclSnapshot;
+struct ObjCIvarDeclSnapshot;
+struct ObjCTypeParamDeclSnapshot;
+struct RedeclarableTemplateDeclSnapshot;
+struct TagDeclSnapshot;
+struct TemplateParamObjectDeclSnapshot;
+struct TemplateTypeParmDeclSnapshot;
+struct TypeAliasDeclSnapshot;
+struct TypeAliasTemplateDeclSnapshot;
+struct TypedefDeclSnapshot;
+struct UnnamedGlobalConstantDeclSnapshot;
+struct UnresolvedUsingValueDeclSnapshot;
+struct UsingDeclSnapshot;
+struct UsingEnumDeclSnapshot;
+struct VarDeclSnapshot;
+struct VarTemplateDeclSnapshot;
+struct VarTemplateSpecializationDeclSnapshot;
+struct CXXDeductionGuideDeclSnapshot;
+struct CXXMethodDeclSnapshot;
+struct ClassTemplateDeclSnapshot;
+struct DecompositionDeclSnapshot;
+struct EnumDeclSnapshot;
+struct FunctionTemplateDeclSnapshot;
+struct ImplicitParamDeclSnapshot;
+struct OMPCapturedExprDeclSnapshot;
+struct ParmVarDeclSnapshot;
+struct RecordDeclSnapshot;
+struct VarTemplatePartialSpecializationDeclSnapshot;
+struct CXXConstructorDeclSnapshot;
+struct CXXConversionDeclSnapshot;
+struct CXXDestructorDeclSnapshot;
+struct CXXRecordDeclSnapshot;
+struct ClassTemplateSpecializationDeclSnapshot;
+struct ClassTemplatePartialSpecializationDeclSnapshot;
+
 class Decl {
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(Decl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {0, 87};
   PASTA_DECLARE_DERIVED_OPERATORS(Decl, AccessSpecDecl)
   PASTA_DECLARE_DERIVED_OPERATORS(Decl, BaseUsingDecl)
   PASTA_DECLARE_DERIVED_OPERATORS(Decl, BindingDecl)
@@ -423,17 +527,26 @@ class Decl {
   bool IsUnconditionallyVisible(void) const;
   bool IsUsed(void) const;
   bool IsWeakImported(void) const;
-  std::vector<::pasta::Decl> Redeclarations(void) const;
+  ::pasta::LazyRange<::pasta::Decl> Redeclarations(void) const;
+  ::pasta::DeclSnapshot Snapshot(void) const;
   PASTA_DECLARE_DERIVED_OPERATORS(Decl, DeclContext)
 
   inline DeclKind Kind(void) const {
     return kind;
   }
 
+  // Returns `true` if this is a `T`, or is derived from `T`.
+  template <typename T>
+  inline bool Is(void) const noexcept {
+    return ::pasta::detail::IsInKindRange(
+        ::pasta::detail::DeclKindOrder(kind), T::kKindRange);
+  }
+
   ::pasta::DeclCategory Category(void) const noexcept;
   std::string_view KindName(void) const noexcept;
   ::pasta::Token Token(void) const noexcept;
   ::pasta::TokenRange Tokens(void) const noexcept;
+  std::optional<::pasta::Decl> ParentDeclaration(void) const;
 
   inline bool operator==(const Decl &that) const noexcept {
     return u.opaque == that.u.opaque;
@@ -441,6 +554,7 @@ class Decl {
   static std::optional<::pasta::Decl> From(const TokenContext &);
   static std::optional<::pasta::Decl> From(const DeclContext &);
  protected:
+  friend class BorrowedDecl;
   friend class TokenContext;
 
   std::shared_ptr<ASTImpl> ast;
@@ -563,63 +677,140 @@ class Decl {
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(Decl)
 };
 
+struct DeclSnapshot {
+  enum AccessSpecifier access;
+  enum AvailabilityResult availability;
+  uint32_t begin_token;
+  uint32_t end_token;
+  enum DeclFriendObjectKind friend_object_kind;
+  uint32_t global_id;
+  int64_t id;
+  uint32_t identifier_namespace;
+  enum DeclModuleOwnershipKind module_ownership_kind;
+  uint32_t owning_module_id;
+  uint32_t template_depth;
+  bool has_attributes;
+  bool has_body;
+  bool has_defining_attribute;
+  bool has_owning_module;
+  bool has_tag_identifier_namespace;
+  bool is_canonical_declaration;
+  bool is_defined_outside_function_or_method;
+  bool is_deprecated;
+  bool is_discarded_in_global_module_fragment;
+  bool is_file_context_declaration;
+  bool is_first_declaration;
+  bool is_from_ast_file;
+  bool is_function_or_function_template;
+  bool is_function_pointer_type;
+  bool is_implicit;
+  bool is_in_anonymous_namespace;
+  bool is_in_another_module_unit;
+  bool is_in_export_declaration_context;
+  bool is_in_std_namespace;
+  bool is_invalid_declaration;
+  bool is_invisible_outside_the_owning_module;
+  bool is_local_extern_declaration;
+  bool is_module_private;
+  bool is_out_of_line;
+  bool is_parameter_pack;
+  bool is_reachable;
+  bool is_referenced;
+  bool is_template_declaration;
+  bool is_template_parameter;
+  bool is_template_parameter_pack;
+  bool is_templated;
+  bool is_this_declaration_referenced;
+  bool is_top_level_declaration_in_obj_c_container;
+  bool is_unavailable;
+  bool is_unconditionally_visible;
+  bool is_used;
+  bool is_weak_imported;
+};
+
 class EmptyDecl : public Decl {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(EmptyDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {4, 5};
   PASTA_DECLARE_BASE_OPERATORS(Decl, EmptyDecl)
+  ::pasta::EmptyDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(EmptyDecl)
 };
 
+struct EmptyDeclSnapshot : public DeclSnapshot {
+};
+
 static_assert(sizeof(Decl) == sizeof(EmptyDecl));
 
 class ExportDecl : public Decl {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ExportDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {5, 6};
   PASTA_DECLARE_BASE_OPERATORS(DeclContext, ExportDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, ExportDecl)
   ::pasta::Token EndToken(void) const;
   ::pasta::Token ExportToken(void) const;
   ::pasta::Token RBraceToken(void) const;
   bool HasBraces(void) const;
+  ::pasta::ExportDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(ExportDecl)
 };
 
+struct ExportDeclSnapshot : public DeclSnapshot {
+  uint32_t export_token;
+  uint32_t r_brace_token;
+  bool has_braces;
+};
+
 static_assert(sizeof(Decl) == sizeof(ExportDecl));
 
 class ExternCContextDecl : public Decl {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ExternCContextDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {6, 7};
   PASTA_DECLARE_BASE_OPERATORS(DeclContext, ExternCContextDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, ExternCContextDecl)
+  ::pasta::ExternCContextDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(ExternCContextDecl)
 };
 
+struct ExternCContextDeclSnapshot : public DeclSnapshot {
+};
+
 static_assert(sizeof(Decl) == sizeof(ExternCContextDecl));
 
 class FileScopeAsmDecl : public Decl {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(FileScopeAsmDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {7, 8};
   PASTA_DECLARE_BASE_OPERATORS(Decl, FileScopeAsmDecl)
   ::pasta::Token AssemblyToken(void) const;
   ::pasta::StringLiteral AssemblyString(void) const;
   ::pasta::Token RParenToken(void) const;
+  ::pasta::FileScopeAsmDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(FileScopeAsmDecl)
 };
 
+struct FileScopeAsmDeclSnapshot : public DeclSnapshot {
+  uint32_t assembly_token;
+  uint32_t r_paren_token;
+};
+
 static_assert(sizeof(Decl) == sizeof(FileScopeAsmDecl));
 
 class FriendDecl : public Decl {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(FriendDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {8, 9};
   PASTA_DECLARE_BASE_OPERATORS(Decl, FriendDecl)
   std::optional<::pasta::NamedDecl> FriendDeclaration(void) const;
   ::pasta::Token FriendToken(void) const;
@@ -628,16 +819,24 @@ class FriendDecl : public Decl {
   // FriendTypeTemplateParameterList: (clang::TemplateParameterList *)
   bool IsUnsupportedFriend(void) const;
   std::vector<::pasta::TemplateParameterList> FriendTypeTemplateParameterLists(void) const;
+  ::pasta::FriendDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(FriendDecl)
 };
 
+struct FriendDeclSnapshot : public DeclSnapshot {
+  uint32_t friend_token;
+  uint32_t friend_type_num_template_parameter_lists;
+  bool is_unsupported_friend;
+};
+
 static_assert(sizeof(Decl) == sizeof(FriendDecl));
 
 class FriendTemplateDecl : public Decl {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(FriendTemplateDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {9, 10};
   PASTA_DECLARE_BASE_OPERATORS(Decl, FriendTemplateDecl)
   ::pasta::NamedDecl FriendDeclaration(void) const;
   ::pasta::Token FriendToken(void) const;
@@ -645,59 +844,83 @@ class FriendTemplateDecl : public Decl {
   uint32_t NumTemplateParameters(void) const;
   // TemplateParameterList: (clang::TemplateParameterList *)
   std::vector<::pasta::TemplateParameterList> TemplateParameterLists(void) const;
+  ::pasta::FriendTemplateDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(FriendTemplateDecl)
 };
 
+struct FriendTemplateDeclSnapshot : public DeclSnapshot {
+  uint32_t friend_token;
+  uint32_t num_template_parameters;
+};
+
 static_assert(sizeof(Decl) == sizeof(FriendTemplateDecl));
 
 class ImplicitConceptSpecializationDecl : public Decl {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ImplicitConceptSpecializationDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {10, 11};
   PASTA_DECLARE_BASE_OPERATORS(Decl, ImplicitConceptSpecializationDecl)
   std::vector<::pasta::TemplateArgument> TemplateArguments(void) const;
+  ::pasta::ImplicitConceptSpecializationDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(ImplicitConceptSpecializationDecl)
 };
 
+struct ImplicitConceptSpecializationDeclSnapshot : public DeclSnapshot {
+};
+
 static_assert(sizeof(Decl) == sizeof(ImplicitConceptSpecializationDecl));
 
 class ImportDecl : public Decl {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ImportDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {11, 12};
   PASTA_DECLARE_BASE_OPERATORS(Decl, ImportDecl)
   std::vector<::pasta::Token> IdentifierTokens(void) const;
   // ImportedModule: (clang::Module *)
+  ::pasta::ImportDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(ImportDecl)
 };
 
+struct ImportDeclSnapshot : public DeclSnapshot {
+};
+
 static_assert(sizeof(Decl) == sizeof(ImportDecl));
 
 class LifetimeExtendedTemporaryDecl : public Decl {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(LifetimeExtendedTemporaryDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {12, 13};
   PASTA_DECLARE_BASE_OPERATORS(Decl, LifetimeExtendedTemporaryDecl)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::ValueDecl ExtendingDeclaration(void) const;
   uint32_t ManglingNumber(void) const;
   // OrCreateValue: (clang::APValue *)
   enum StorageDuration StorageDuration(void) const;
   ::pasta::Expr TemporaryExpression(void) const;
   // Value: (clang::APValue *)
+  ::pasta::LifetimeExtendedTemporaryDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(LifetimeExtendedTemporaryDecl)
 };
 
+struct LifetimeExtendedTemporaryDeclSnapshot : public DeclSnapshot {
+  uint32_t mangling_number;
+  enum StorageDuration storage_duration;
+};
+
 static_assert(sizeof(Decl) == sizeof(LifetimeExtendedTemporaryDecl));
 
 class LinkageSpecDecl : public Decl {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(LinkageSpecDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {13, 14};
   PASTA_DECLARE_BASE_OPERATORS(DeclContext, LinkageSpecDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, LinkageSpecDecl)
   ::pasta::Token EndToken(void) const;
@@ -705,16 +928,25 @@ class LinkageSpecDecl : public Decl {
   enum LinkageSpecDeclLanguageIDs Language(void) const;
   ::pasta::Token RBraceToken(void) const;
   bool HasBraces(void) const;
+  ::pasta::LinkageSpecDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(LinkageSpecDecl)
 };
 
+struct LinkageSpecDeclSnapshot : public DeclSnapshot {
+  uint32_t extern_token;
+  enum LinkageSpecDeclLanguageIDs language;
+  uint32_t r_brace_token;
+  bool has_braces;
+};
+
 static_assert(sizeof(Decl) == sizeof(LinkageSpecDecl));
 
 class NamedDecl : public Decl {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(NamedDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {14, 77};
   PASTA_DECLARE_BASE_OPERATORS(Decl, NamedDecl)
   PASTA_DECLARE_DERIVED_OPERATORS(NamedDecl, BaseUsingDecl)
   PASTA_DECLARE_DERIVED_OPERATORS(NamedDecl, BindingDecl)
@@ -812,10 +1044,24 @@ class NamedDecl : public Decl {
   bool IsExternallyVisible(void) const;
   bool IsLinkageValid(void) const;
   // IsReserved: (clang::ReservedIdentifierStatus)
+  ::pasta::NamedDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(NamedDecl)
 };
 
+struct NamedDeclSnapshot : public DeclSnapshot {
+  enum Linkage formal_linkage;
+  enum Linkage linkage_internal;
+  bool has_external_formal_linkage;
+  bool has_linkage;
+  bool has_linkage_been_computed;
+  bool is_cxx_class_member;
+  bool is_cxx_instance_member;
+  bool is_externally_declarable;
+  bool is_externally_visible;
+  bool is_linkage_valid;
+};
+
 static_assert(sizeof(Decl) == sizeof(NamedDecl));
 
 class NamespaceAliasDecl : public NamedDecl {
@@ -823,6 +1069,7 @@ class NamespaceAliasDecl : public NamedDecl {
   using NamedDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(NamespaceAliasDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {18, 19};
   PASTA_DECLARE_BASE_OPERATORS(Decl, NamespaceAliasDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, NamespaceAliasDecl)
   ::pasta::Token AliasToken(void) const;
@@ -833,10 +1080,17 @@ class NamespaceAliasDecl : public NamedDecl {
   // Qualifier: (clang::NestedNameSpecifier *)
   // QualifierToken: (clang::NestedNameSpecifierLoc)
   ::pasta::Token TargetNameToken(void) const;
+  ::pasta::NamespaceAliasDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(NamespaceAliasDecl)
 };
 
+struct NamespaceAliasDeclSnapshot : public NamedDeclSnapshot {
+  uint32_t alias_token;
+  uint32_t namespace_token;
+  uint32_t target_name_token;
+};
+
 static_assert(sizeof(Decl) == sizeof(NamespaceAliasDecl));
 
 class NamespaceDecl : public NamedDecl {
@@ -844,6 +1098,7 @@ class NamespaceDecl : public NamedDecl {
   using NamedDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(NamespaceDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {19, 20};
   PASTA_DECLARE_BASE_OPERATORS(DeclContext, NamespaceDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, NamespaceDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, NamespaceDecl)
@@ -857,10 +1112,19 @@ class NamespaceDecl : public NamedDecl {
   bool IsNested(void) const;
   bool IsOriginalNamespace(void) const;
   // IsRedundantInlineQualifierFor: (bool)
+  ::pasta::NamespaceDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(NamespaceDecl)
 };
 
+struct NamespaceDeclSnapshot : public NamedDeclSnapshot {
+  uint32_t r_brace_token;
+  bool is_anonymous_namespace;
+  bool is_inline;
+  bool is_nested;
+  bool is_original_namespace;
+};
+
 static_assert(sizeof(Decl) == sizeof(NamespaceDecl));
 
 class ObjCCompatibleAliasDecl : public NamedDecl {
@@ -868,13 +1132,18 @@ class ObjCCompatibleAliasDecl : public NamedDecl {
   using NamedDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCCompatibleAliasDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {20, 21};
   PASTA_DECLARE_BASE_OPERATORS(Decl, ObjCCompatibleAliasDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, ObjCCompatibleAliasDecl)
   ::pasta::ObjCInterfaceDecl ClassInterface(void) const;
+  ::pasta::ObjCCompatibleAliasDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(ObjCCompatibleAliasDecl)
 };
 
+struct ObjCCompatibleAliasDeclSnapshot : public NamedDeclSnapshot {
+};
+
 static_assert(sizeof(Decl) == sizeof(ObjCCompatibleAliasDecl));
 
 class ObjCContainerDecl : public NamedDecl {
@@ -882,6 +1151,7 @@ class ObjCContainerDecl : public NamedDecl {
   using NamedDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCContainerDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {21, 26};
   PASTA_DECLARE_BASE_OPERATORS(DeclContext, ObjCContainerDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, ObjCContainerDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, ObjCContainerDecl)
@@ -893,8 +1163,8 @@ class ObjCContainerDecl : public NamedDecl {
   PASTA_DECLARE_DERIVED_OPERATORS(ObjCContainerDecl, ObjCProtocolDecl)
   // FindPropertyDeclaration: (clang::ObjCPropertyDecl *)
   // HasUserDeclaredSetterMethod: (bool)
-  std::vector<::pasta::ObjCMethodDecl> ClassMethods(void) const;
-  std::vector<::pasta::ObjCPropertyDecl> ClassProperties(void) const;
+  ::pasta::LazyRange<::pasta::ObjCMethodDecl> ClassMethods(void) const;
+  ::pasta::LazyRange<::pasta::ObjCPropertyDecl> ClassProperties(void) const;
   ::pasta::TokenRange AtEndRange(void) const;
   ::pasta::Token AtStartToken(void) const;
   // ClassMethod: (clang::ObjCMethodDecl *)
@@ -902,14 +1172,19 @@ class ObjCContainerDecl : public NamedDecl {
   // InstanceVariableDeclaration: (clang::ObjCIvarDecl *)
   // Method: (clang::ObjCMethodDecl *)
   // Property: (clang::ObjCPropertyDecl *)
-  std::vector<::pasta::ObjCMethodDecl> InstanceMethods(void) const;
-  std::vector<::pasta::ObjCPropertyDecl> InstanceProperties(void) const;
-  std::vector<::pasta::ObjCMethodDecl> Methods(void) const;
-  std::vector<::pasta::ObjCPropertyDecl> Properties(void) const;
+  ::pasta::LazyRange<::pasta::ObjCMethodDecl> InstanceMethods(void) const;
+  ::pasta::LazyRange<::pasta::ObjCPropertyDecl> InstanceProperties(void) const;
+  ::pasta::LazyRange<::pasta::ObjCMethodDecl> Methods(void) const;
+  ::pasta::LazyRange<::pasta::ObjCPropertyDecl> Properties(void) const;
+  ::pasta::ObjCContainerDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(ObjCContainerDecl)
 };
 
+struct ObjCContainerDeclSnapshot : public NamedDeclSnapshot {
+  uint32_t at_start_token;
+};
+
 static_assert(sizeof(Decl) == sizeof(ObjCContainerDecl));
 
 class ObjCImplDecl : public ObjCContainerDecl {
@@ -917,6 +1192,7 @@ class ObjCImplDecl : public ObjCContainerDecl {
   using ObjCContainerDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCImplDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {22, 24};
   PASTA_DECLARE_BASE_OPERATORS(DeclContext, ObjCImplDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, ObjCImplDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, ObjCImplDecl)
@@ -926,11 +1202,15 @@ class ObjCImplDecl : public ObjCContainerDecl {
   // FindPropertyImplementationDeclaration: (clang::ObjCPropertyImplDecl *)
   // FindPropertyImplementationInstanceVariableDeclaration: (clang::ObjCPropertyImplDecl *)
   ::pasta::ObjCInterfaceDecl ClassInterface(void) const;
-  std::vector<::pasta::ObjCPropertyImplDecl> PropertyImplementations(void) const;
+  ::pasta::LazyRange<::pasta::ObjCPropertyImplDecl> PropertyImplementations(void) const;
+  ::pasta::ObjCImplDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(ObjCImplDecl)
 };
 
+struct ObjCImplDeclSnapshot : public ObjCContainerDeclSnapshot {
+};
+
 static_assert(sizeof(Decl) == sizeof(ObjCImplDecl));
 
 class ObjCImplementationDecl : public ObjCImplDecl {
@@ -938,6 +1218,7 @@ class ObjCImplementationDecl : public ObjCImplDecl {
   using ObjCImplDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCImplementationDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {23, 24};
   PASTA_DECLARE_BASE_OPERATORS(DeclContext, ObjCImplementationDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, ObjCImplementationDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, ObjCImplementationDecl)
@@ -954,11 +1235,21 @@ class ObjCImplementationDecl : public ObjCImplDecl {
   bool HasDestructors(void) const;
   bool HasNonZeroConstructors(void) const;
   std::vector<::pasta::CXXCtorInitializer> Initializers(void) const;
-  std::vector<::pasta::ObjCIvarDecl> InstanceVariables(void) const;
+  ::pasta::LazyRange<::pasta::ObjCIvarDecl> InstanceVariables(void) const;
+  ::pasta::ObjCImplementationDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(ObjCImplementationDecl)
 };
 
+struct ObjCImplementationDeclSnapshot : public ObjCImplDeclSnapshot {
+  uint32_t instance_variable_l_brace_token;
+  uint32_t instance_variable_r_brace_token;
+  uint32_t num_instance_variable_initializers;
+  uint32_t super_class_token;
+  bool has_destructors;
+  bool has_non_zero_constructors;
+};
+
 static_assert(sizeof(Decl) == sizeof(ObjCImplementationDecl));
 
 class ObjCInterfaceDecl : public ObjCContainerDecl {
@@ -966,13 +1257,14 @@ class ObjCInterfaceDecl : public ObjCContainerDecl {
   using ObjCContainerDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCInterfaceDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {24, 25};
   PASTA_DECLARE_BASE_OPERATORS(DeclContext, ObjCInterfaceDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, ObjCInterfaceDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, ObjCInterfaceDecl)
   PASTA_DECLARE_BASE_OPERATORS(ObjCContainerDecl, ObjCInterfaceDecl)
   // FindCategoryDeclaration: (clang::ObjCCategoryDecl *)
   // FindPropertyVisibleInPrimaryClass: (clang::ObjCPropertyDecl *)
-  std::vector<::pasta::ObjCProtocolDecl> AllReferencedProtocols(void) const;
+  ::pasta::LazyRange<::pasta::ObjCProtocolDecl> AllReferencedProtocols(void) const;
   bool DeclaresOrInheritsDesignatedInitializers(void) const;
   ::pasta::ObjCInterfaceDecl CanonicalDeclaration(void) const;
   // CategoryClassMethod: (clang::ObjCMethodDecl *)
@@ -999,22 +1291,34 @@ class ObjCInterfaceDecl : public ObjCContainerDecl {
   ::pasta::ObjCInterfaceDecl IsObjCRequiresPropertyDefinitions(void) const;
   // IsSuperClassOf: (bool)
   bool IsThisDeclarationADefinition(void) const;
-  std::vector<::pasta::ObjCIvarDecl> InstanceVariables(void) const;
-  std::vector<::pasta::ObjCCategoryDecl> KnownCategories(void) const;
-  std::vector<::pasta::ObjCCategoryDecl> KnownExtensions(void) const;
+  ::pasta::LazyRange<::pasta::ObjCIvarDecl> InstanceVariables(void) const;
+  ::pasta::LazyRange<::pasta::ObjCCategoryDecl> KnownCategories(void) const;
+  ::pasta::LazyRange<::pasta::ObjCCategoryDecl> KnownExtensions(void) const;
   // LookupClassMethod: (clang::ObjCMethodDecl *)
   // LookupInstanceMethod: (clang::ObjCMethodDecl *)
   // LookupMethod: (clang::ObjCMethodDecl *)
   // LookupPrivateMethod: (clang::ObjCMethodDecl *)
   // LookupPropertyAccessor: (clang::ObjCMethodDecl *)
   std::vector<::pasta::Token> ProtocolTokens(void) const;
-  std::vector<::pasta::ObjCProtocolDecl> Protocols(void) const;
-  std::vector<::pasta::ObjCCategoryDecl> VisibleCategories(void) const;
-  std::vector<::pasta::ObjCCategoryDecl> VisibleExtensions(void) const;
+  ::pasta::LazyRange<::pasta::ObjCProtocolDecl> Protocols(void) const;
+  ::pasta::LazyRange<::pasta::ObjCCategoryDecl> VisibleCategories(void) const;
+  ::pasta::LazyRange<::pasta::ObjCCategoryDecl> VisibleExtensions(void) const;
+  ::pasta::ObjCInterfaceDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(ObjCInterfaceDecl)
 };
 
+struct ObjCInterfaceDeclSnapshot : public ObjCContainerDeclSnapshot {
+  bool declares_or_inherits_designated_initializers;
+  uint32_t end_of_definition_token;
+  uint32_t super_class_token;
+  bool has_definition;
+  bool has_designated_initializers{};
+  bool is_arc_weakref_unavailable;
+  bool is_implicit_interface_declaration;
+  bool is_this_declaration_a_definition;
+};
+
 static_assert(sizeof(Decl) == sizeof(ObjCInterfaceDecl));
 
 class ObjCMethodDecl : public NamedDecl {
@@ -1022,6 +1326,7 @@ class ObjCMethodDecl : public NamedDecl {
   using NamedDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCMethodDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {26, 27};
   PASTA_DECLARE_BASE_OPERATORS(DeclContext, ObjCMethodDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, ObjCMethodDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, ObjCMethodDecl)
@@ -1063,12 +1368,40 @@ class ObjCMethodDecl : public NamedDecl {
   bool IsThisDeclarationADefinition(void) const;
   bool IsThisDeclarationADesignatedInitializer(void) const;
   bool IsVariadic(void) const;
-  std::vector<::pasta::ParmVarDecl> Parameters(void) const;
+  ::pasta::LazyRange<::pasta::ParmVarDecl> Parameters(void) const;
   std::vector<::pasta::Token> SelectorTokens(void) const;
+  ::pasta::ObjCMethodDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(ObjCMethodDecl)
 };
 
+struct ObjCMethodDeclSnapshot : public NamedDeclSnapshot {
+  bool defined_in_ns_object;
+  uint32_t declarator_end_token;
+  enum ObjCMethodDeclImplementationControl implementation_control;
+  enum ObjCMethodFamily method_family;
+  uint32_t num_selector_tokens;
+  enum DeclObjCDeclQualifier obj_c_decl_qualifier;
+  uint32_t selector_start_token;
+  bool has_parameter_destroyed_in_callee;
+  bool has_redeclaration;
+  bool has_related_result_type;
+  bool has_skipped_body;
+  bool is_class_method;
+  bool is_defined;
+  bool is_designated_initializer_for_the_interface;
+  bool is_direct_method;
+  bool is_instance_method;
+  bool is_optional;
+  bool is_overriding;
+  bool is_property_accessor;
+  bool is_redeclaration;
+  bool is_synthesized_accessor_stub;
+  bool is_this_declaration_a_definition;
+  bool is_this_declaration_a_designated_initializer;
+  bool is_variadic;
+};
+
 static_assert(sizeof(Decl) == sizeof(ObjCMethodDecl));
 
 class ObjCPropertyDecl : public NamedDecl {
@@ -1076,6 +1409,7 @@ class ObjCPropertyDecl : public NamedDecl {
   using NamedDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCPropertyDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {27, 28};
   PASTA_DECLARE_BASE_OPERATORS(Decl, ObjCPropertyDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, ObjCPropertyDecl)
   ::pasta::Token AtToken(void) const;
@@ -1102,16 +1436,35 @@ class ObjCPropertyDecl : public NamedDecl {
   bool IsOptional(void) const;
   bool IsReadOnly(void) const;
   bool IsRetaining(void) const;
+  ::pasta::ObjCPropertyDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(ObjCPropertyDecl)
 };
 
+struct ObjCPropertyDeclSnapshot : public NamedDeclSnapshot {
+  uint32_t at_token;
+  uint32_t getter_name_token;
+  uint32_t l_paren_token;
+  enum ObjCPropertyDeclPropertyControl property_implementation;
+  enum ObjCPropertyQueryKind query_kind;
+  enum ObjCPropertyDeclSetterKind setter_kind;
+  uint32_t setter_name_token;
+  bool is_atomic;
+  bool is_class_property;
+  bool is_direct_property;
+  bool is_instance_property;
+  bool is_optional;
+  bool is_read_only;
+  bool is_retaining;
+};
+
 static_assert(sizeof(Decl) == sizeof(ObjCPropertyDecl));
 
 class ObjCPropertyImplDecl : public Decl {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCPropertyImplDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {80, 81};
   PASTA_DECLARE_BASE_OPERATORS(Decl, ObjCPropertyImplDecl)
   ::pasta::Token BeginToken(void) const;
   ::pasta::Expr GetterCXXConstructor(void) const;
@@ -1123,10 +1476,17 @@ class ObjCPropertyImplDecl : public Decl {
   ::pasta::Expr SetterCXXAssignment(void) const;
   ::pasta::ObjCMethodDecl SetterMethodDeclaration(void) const;
   bool IsInstanceVariableNameSpecified(void) const;
+  ::pasta::ObjCPropertyImplDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(ObjCPropertyImplDecl)
 };
 
+struct ObjCPropertyImplDeclSnapshot : public DeclSnapshot {
+  enum ObjCPropertyImplDeclKind property_implementation;
+  uint32_t property_instance_variable_declaration_token;
+  bool is_instance_variable_name_specified;
+};
+
 static_assert(sizeof(Decl) == sizeof(ObjCPropertyImplDecl));
 
 class ObjCProtocolDecl : public ObjCContainerDecl {
@@ -1134,6 +1494,7 @@ class ObjCProtocolDecl : public ObjCContainerDecl {
   using ObjCContainerDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCProtocolDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {25, 26};
   PASTA_DECLARE_BASE_OPERATORS(DeclContext, ObjCProtocolDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, ObjCProtocolDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, ObjCProtocolDecl)
@@ -1149,64 +1510,94 @@ class ObjCProtocolDecl : public ObjCContainerDecl {
   // LookupInstanceMethod: (clang::ObjCMethodDecl *)
   // LookupMethod: (clang::ObjCMethodDecl *)
   std::vector<::pasta::Token> ProtocolTokens(void) const;
-  std::vector<::pasta::ObjCProtocolDecl> Protocols(void) const;
+  ::pasta::LazyRange<::pasta::ObjCProtocolDecl> Protocols(void) const;
+  ::pasta::ObjCProtocolDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(ObjCProtocolDecl)
 };
 
+struct ObjCProtocolDeclSnapshot : public ObjCContainerDeclSnapshot {
+  bool has_definition;
+  bool is_non_runtime_protocol;
+  bool is_this_declaration_a_definition;
+};
+
 static_assert(sizeof(Decl) == sizeof(ObjCProtocolDecl));
 
 class PragmaCommentDecl : public Decl {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(PragmaCommentDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {81, 82};
   PASTA_DECLARE_BASE_OPERATORS(Decl, PragmaCommentDecl)
   std::string_view Argument(void) const;
   enum PragmaMSCommentKind CommentKind(void) const;
+  ::pasta::PragmaCommentDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(PragmaCommentDecl)
 };
 
+struct PragmaCommentDeclSnapshot : public DeclSnapshot {
+  enum PragmaMSCommentKind comment_kind;
+};
+
 static_assert(sizeof(Decl) == sizeof(PragmaCommentDecl));
 
 class PragmaDetectMismatchDecl : public Decl {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(PragmaDetectMismatchDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {82, 83};
   PASTA_DECLARE_BASE_OPERATORS(Decl, PragmaDetectMismatchDecl)
   std::string_view Name(void) const;
   std::string_view Value(void) const;
+  ::pasta::PragmaDetectMismatchDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(PragmaDetectMismatchDecl)
 };
 
+struct PragmaDetectMismatchDeclSnapshot : public DeclSnapshot {
+};
+
 static_assert(sizeof(Decl) == sizeof(PragmaDetectMismatchDecl));
 
 class RequiresExprBodyDecl : public Decl {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(RequiresExprBodyDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {83, 84};
   PASTA_DECLARE_BASE_OPERATORS(DeclContext, RequiresExprBodyDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, RequiresExprBodyDecl)
+  ::pasta::RequiresExprBodyDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(RequiresExprBodyDecl)
 };
 
+struct RequiresExprBodyDeclSnapshot : public DeclSnapshot {
+};
+
 static_assert(sizeof(Decl) == sizeof(RequiresExprBodyDecl));
 
 class StaticAssertDecl : public Decl {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(StaticAssertDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {84, 85};
   PASTA_DECLARE_BASE_OPERATORS(Decl, StaticAssertDecl)
   ::pasta::Expr AssertExpression(void) const;
   std::optional<::pasta::Expr> Message(void) const;
   ::pasta::Token RParenToken(void) const;
   bool IsFailed(void) const;
+  ::pasta::StaticAssertDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(StaticAssertDecl)
 };
 
+struct StaticAssertDeclSnapshot : public DeclSnapshot {
+  uint32_t r_paren_token;
+  bool is_failed;
+};
+
 static_assert(sizeof(Decl) == sizeof(StaticAssertDecl));
 
 class TemplateDecl : public NamedDecl {
@@ -1214,6 +1605,7 @@ class TemplateDecl : public NamedDecl {
   using NamedDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(TemplateDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {28, 35};
   PASTA_DECLARE_BASE_OPERATORS(Decl, TemplateDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, TemplateDecl)
   PASTA_DECLARE_DERIVED_OPERATORS(TemplateDecl, BuiltinTemplateDecl)
@@ -1228,10 +1620,16 @@ class TemplateDecl : public NamedDecl {
   std::optional<::pasta::NamedDecl> TemplatedDeclaration(void) const;
   bool HasAssociatedConstraints(void) const;
   bool IsTypeAlias(void) const;
+  ::pasta::TemplateDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(TemplateDecl)
 };
 
+struct TemplateDeclSnapshot : public NamedDeclSnapshot {
+  bool has_associated_constraints;
+  bool is_type_alias;
+};
+
 static_assert(sizeof(Decl) == sizeof(TemplateDecl));
 
 class TemplateTemplateParmDecl : public TemplateDecl {
@@ -1239,6 +1637,7 @@ class TemplateTemplateParmDecl : public TemplateDecl {
   using TemplateDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(TemplateTemplateParmDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {34, 35};
   PASTA_DECLARE_BASE_OPERATORS(Decl, TemplateTemplateParmDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, TemplateTemplateParmDecl)
   PASTA_DECLARE_BASE_OPERATORS(TemplateDecl, TemplateTemplateParmDecl)
@@ -1252,37 +1651,58 @@ class TemplateTemplateParmDecl : public TemplateDecl {
   bool IsExpandedParameterPack(void) const;
   bool IsPackExpansion(void) const;
   bool IsParameterPack(void) const;
+  ::pasta::TemplateTemplateParmDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(TemplateTemplateParmDecl)
 };
 
+struct TemplateTemplateParmDeclSnapshot : public TemplateDeclSnapshot {
+  bool default_argument_was_inherited;
+  uint32_t default_argument_token;
+  uint32_t num_expansion_template_parameters{};
+  bool has_default_argument;
+  bool is_expanded_parameter_pack;
+  bool is_pack_expansion;
+};
+
 static_assert(sizeof(Decl) == sizeof(TemplateTemplateParmDecl));
 
 class TopLevelStmtDecl : public Decl {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(TopLevelStmtDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {85, 86};
   PASTA_DECLARE_BASE_OPERATORS(Decl, TopLevelStmtDecl)
   ::pasta::Stmt Statement(void) const;
   bool IsSemiMissing(void) const;
+  ::pasta::TopLevelStmtDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(TopLevelStmtDecl)
 };
 
+struct TopLevelStmtDeclSnapshot : public DeclSnapshot {
+  bool is_semi_missing;
+};
+
 static_assert(sizeof(Decl) == sizeof(TopLevelStmtDecl));
 
 class TranslationUnitDecl : public Decl {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(TranslationUnitDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {86, 87};
   PASTA_DECLARE_BASE_OPERATORS(DeclContext, TranslationUnitDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, TranslationUnitDecl)
   // ASTContext: (clang::ASTContext &)
   std::optional<::pasta::NamespaceDecl> AnonymousNamespace(void) const;
+  ::pasta::TranslationUnitDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(TranslationUnitDecl)
 };
 
+struct TranslationUnitDeclSnapshot : public DeclSnapshot {
+};
+
 static_assert(sizeof(Decl) == sizeof(TranslationUnitDecl));
 
 class TypeDecl : public NamedDecl {
@@ -1290,6 +1710,7 @@ class TypeDecl : public NamedDecl {
   using NamedDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(TypeDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {35, 45};
   PASTA_DECLARE_BASE_OPERATORS(Decl, TypeDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, TypeDecl)
   PASTA_DECLARE_DERIVED_OPERATORS(TypeDecl, CXXRecordDecl)
@@ -1306,10 +1727,14 @@ class TypeDecl : public NamedDecl {
   PASTA_DECLARE_DERIVED_OPERATORS(TypeDecl, UnresolvedUsingTypenameDecl)
   ::pasta::Token BeginToken(void) const;
   std::optional<::pasta::Type> TypeForDeclaration(void) const;
+  ::pasta::TypeDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(TypeDecl)
 };
 
+struct TypeDeclSnapshot : public NamedDeclSnapshot {
+};
+
 static_assert(sizeof(Decl) == sizeof(TypeDecl));
 
 class TypedefNameDecl : public TypeDecl {
@@ -1317,6 +1742,7 @@ class TypedefNameDecl : public TypeDecl {
   using TypeDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(TypedefNameDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {41, 44};
   PASTA_DECLARE_BASE_OPERATORS(Decl, TypedefNameDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, TypedefNameDecl)
   PASTA_DECLARE_BASE_OPERATORS(TypeDecl, TypedefNameDecl)
@@ -1328,10 +1754,16 @@ class TypedefNameDecl : public TypeDecl {
   ::pasta::Type UnderlyingType(void) const;
   bool IsModed(void) const;
   bool IsTransparentTag(void) const;
+  ::pasta::TypedefNameDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(TypedefNameDecl)
 };
 
+struct TypedefNameDeclSnapshot : public TypeDeclSnapshot {
+  bool is_moded;
+  bool is_transparent_tag;
+};
+
 static_assert(sizeof(Decl) == sizeof(TypedefNameDecl));
 
 class UnresolvedUsingIfExistsDecl : public NamedDecl {
@@ -1339,12 +1771,17 @@ class UnresolvedUsingIfExistsDecl : public NamedDecl {
   using NamedDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(UnresolvedUsingIfExistsDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {45, 46};
   PASTA_DECLARE_BASE_OPERATORS(Decl, UnresolvedUsingIfExistsDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, UnresolvedUsingIfExistsDecl)
+  ::pasta::UnresolvedUsingIfExistsDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(UnresolvedUsingIfExistsDecl)
 };
 
+struct UnresolvedUsingIfExistsDeclSnapshot : public NamedDeclSnapshot {
+};
+
 static_assert(sizeof(Decl) == sizeof(UnresolvedUsingIfExistsDecl));
 
 class UnresolvedUsingTypenameDecl : public TypeDecl {
@@ -1352,6 +1789,7 @@ class UnresolvedUsingTypenameDecl : public TypeDecl {
   using TypeDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(UnresolvedUsingTypenameDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {44, 45};
   PASTA_DECLARE_BASE_OPERATORS(Decl, UnresolvedUsingTypenameDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, UnresolvedUsingTypenameDecl)
   PASTA_DECLARE_BASE_OPERATORS(TypeDecl, UnresolvedUsingTypenameDecl)
@@ -1363,10 +1801,18 @@ class UnresolvedUsingTypenameDecl : public TypeDecl {
   ::pasta::Token TypenameToken(void) const;
   ::pasta::Token UsingToken(void) const;
   bool IsPackExpansion(void) const;
+  ::pasta::UnresolvedUsingTypenameDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(UnresolvedUsingTypenameDecl)
 };
 
+struct UnresolvedUsingTypenameDeclSnapshot : public TypeDeclSnapshot {
+  uint32_t ellipsis_token;
+  uint32_t typename_token;
+  uint32_t using_token;
+  bool is_pack_expansion;
+};
+
 static_assert(sizeof(Decl) == sizeof(UnresolvedUsingTypenameDecl));
 
 class UsingDirectiveDecl : public NamedDecl {
@@ -1374,6 +1820,7 @@ class UsingDirectiveDecl : public NamedDecl {
   using NamedDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(UsingDirectiveDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {46, 47};
   PASTA_DECLARE_BASE_OPERATORS(Decl, UsingDirectiveDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, UsingDirectiveDecl)
   ::pasta::DeclContext CommonAncestor(void) const;
@@ -1384,10 +1831,17 @@ class UsingDirectiveDecl : public NamedDecl {
   // Qualifier: (clang::NestedNameSpecifier *)
   // QualifierToken: (clang::NestedNameSpecifierLoc)
   ::pasta::Token UsingToken(void) const;
+  ::pasta::UsingDirectiveDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(UsingDirectiveDecl)
 };
 
+struct UsingDirectiveDeclSnapshot : public NamedDeclSnapshot {
+  uint32_t identifier_token;
+  uint32_t namespace_key_token;
+  uint32_t using_token;
+};
+
 static_assert(sizeof(Decl) == sizeof(UsingDirectiveDecl));
 
 class UsingPackDecl : public NamedDecl {
@@ -1395,15 +1849,20 @@ class UsingPackDecl : public NamedDecl {
   using NamedDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(UsingPackDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {47, 48};
   PASTA_DECLARE_BASE_OPERATORS(Decl, UsingPackDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, UsingPackDecl)
-  std::vector<::pasta::NamedDecl> Expansions(void) const;
+  ::pasta::LazyRange<::pasta::NamedDecl> Expansions(void) const;
   ::pasta::UsingPackDecl CanonicalDeclaration(void) const;
   ::pasta::NamedDecl InstantiatedFromUsingDeclaration(void) const;
+  ::pasta::UsingPackDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(UsingPackDecl)
 };
 
+struct UsingPackDeclSnapshot : public NamedDeclSnapshot {
+};
+
 static_assert(sizeof(Decl) == sizeof(UsingPackDecl));
 
 class UsingShadowDecl : public NamedDecl {
@@ -1411,6 +1870,7 @@ class UsingShadowDecl : public NamedDecl {
   using NamedDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(UsingShadowDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {48, 50};
   PASTA_DECLARE_BASE_OPERATORS(Decl, UsingShadowDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, UsingShadowDecl)
   PASTA_DECLARE_DERIVED_OPERATORS(UsingShadowDecl, ConstructorUsingShadowDecl)
@@ -1418,10 +1878,14 @@ class UsingShadowDecl : public NamedDecl {
   ::pasta::BaseUsingDecl Introducer(void) const;
   std::optional<::pasta::UsingShadowDecl> NextUsingShadowDeclaration(void) const;
   ::pasta::NamedDecl TargetDeclaration(void) const;
+  ::pasta::UsingShadowDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(UsingShadowDecl)
 };
 
+struct UsingShadowDeclSnapshot : public NamedDeclSnapshot {
+};
+
 static_assert(sizeof(Decl) == sizeof(UsingShadowDecl));
 
 class ValueDecl : public NamedDecl {
@@ -1429,6 +1893,7 @@ class ValueDecl : public NamedDecl {
   using NamedDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ValueDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {50, 77};
   PASTA_DECLARE_BASE_OPERATORS(Decl, ValueDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, ValueDecl)
   PASTA_DECLARE_DERIVED_OPERATORS(ValueDecl, BindingDecl)
@@ -1464,24 +1929,35 @@ class ValueDecl : public NamedDecl {
   ::pasta::Type Type(void) const;
   bool IsInitializerCapture(void) const;
   bool IsWeak(void) const;
+  ::pasta::ValueDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(ValueDecl)
 };
 
+struct ValueDeclSnapshot : public NamedDeclSnapshot {
+  bool is_initializer_capture;
+  bool is_weak;
+};
+
 static_assert(sizeof(Decl) == sizeof(ValueDecl));
 
 class OMPDeclarativeDirectiveDecl : public Decl {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPDeclarativeDirectiveDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {77, 80};
   PASTA_DECLARE_BASE_OPERATORS(Decl, OMPDeclarativeDirectiveDecl)
   PASTA_DECLARE_DERIVED_OPERATORS(OMPDeclarativeDirectiveDecl, OMPAllocateDecl)
   PASTA_DECLARE_DERIVED_OPERATORS(OMPDeclarativeDirectiveDecl, OMPRequiresDecl)
   PASTA_DECLARE_DERIVED_OPERATORS(OMPDeclarativeDirectiveDecl, OMPThreadPrivateDecl)
+  ::pasta::OMPDeclarativeDirectiveDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(OMPDeclarativeDirectiveDecl)
 };
 
+struct OMPDeclarativeDirectiveDeclSnapshot : public DeclSnapshot {
+};
+
 static_assert(sizeof(Decl) == sizeof(OMPDeclarativeDirectiveDecl));
 
 class OMPDeclarativeDirectiveValueDecl : public ValueDecl {
@@ -1489,27 +1965,39 @@ class OMPDeclarativeDirectiveValueDecl : public ValueDecl {
   using ValueDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPDeclarativeDirectiveValueDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {72, 73};
   PASTA_DECLARE_BASE_OPERATORS(Decl, OMPDeclarativeDirectiveValueDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, OMPDeclarativeDirectiveValueDecl)
   PASTA_DECLARE_BASE_OPERATORS(ValueDecl, OMPDeclarativeDirectiveValueDecl)
   PASTA_DECLARE_DERIVED_OPERATORS(OMPDeclarativeDirectiveValueDecl, OMPDeclareMapperDecl)
+  ::pasta::OMPDeclarativeDirectiveValueDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(OMPDeclarativeDirectiveValueDecl)
 };
 
+struct OMPDeclarativeDirectiveValueDeclSnapshot : public ValueDeclSnapshot {
+};
+
 static_assert(sizeof(Decl) == sizeof(OMPDeclarativeDirectiveValueDecl));
 
 class AccessSpecDecl : public Decl {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(AccessSpecDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {0, 1};
   PASTA_DECLARE_BASE_OPERATORS(Decl, AccessSpecDecl)
   ::pasta::Token AccessSpecifierToken(void) const;
   ::pasta::Token ColonToken(void) const;
+  ::pasta::AccessSpecDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(AccessSpecDecl)
 };
 
+struct AccessSpecDeclSnapshot : public DeclSnapshot {
+  uint32_t access_specifier_token;
+  uint32_t colon_token;
+};
+
 static_assert(sizeof(Decl) == sizeof(AccessSpecDecl));
 
 class BaseUsingDecl : public NamedDecl {
@@ -1517,15 +2005,20 @@ class BaseUsingDecl : public NamedDecl {
   using NamedDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(BaseUsingDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {14, 16};
   PASTA_DECLARE_BASE_OPERATORS(Decl, BaseUsingDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, BaseUsingDecl)
   PASTA_DECLARE_DERIVED_OPERATORS(BaseUsingDecl, UsingDecl)
   PASTA_DECLARE_DERIVED_OPERATORS(BaseUsingDecl, UsingEnumDecl)
-  std::vector<::pasta::UsingShadowDecl> Shadows(void) const;
+  ::pasta::LazyRange<::pasta::UsingShadowDecl> Shadows(void) const;
+  ::pasta::BaseUsingDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(BaseUsingDecl)
 };
 
+struct BaseUsingDeclSnapshot : public NamedDeclSnapshot {
+};
+
 static_assert(sizeof(Decl) == sizeof(BaseUsingDecl));
 
 class BindingDecl : public ValueDecl {
@@ -1533,22 +2026,28 @@ class BindingDecl : public ValueDecl {
   using ValueDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(BindingDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {50, 51};
   PASTA_DECLARE_BASE_OPERATORS(Decl, BindingDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, BindingDecl)
   PASTA_DECLARE_BASE_OPERATORS(ValueDecl, BindingDecl)
   ::pasta::Expr Binding(void) const;
   ::pasta::ValueDecl DecomposedDeclaration(void) const;
   ::pasta::VarDecl HoldingVariable(void) const;
+  ::pasta::BindingDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(BindingDecl)
 };
 
+struct BindingDeclSnapshot : public ValueDeclSnapshot {
+};
+
 static_assert(sizeof(Decl) == sizeof(BindingDecl));
 
 class BlockDecl : public Decl {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(BlockDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {1, 2};
   PASTA_DECLARE_BASE_OPERATORS(DeclContext, BlockDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, BlockDecl)
   bool BlockMissingReturnType(void) const;
@@ -1568,12 +2067,27 @@ class BlockDecl : public Decl {
   bool HasCaptures(void) const;
   bool IsConversionFromLambda(void) const;
   bool IsVariadic(void) const;
-  std::vector<::pasta::ParmVarDecl> Parameters(void) const;
+  ::pasta::LazyRange<::pasta::ParmVarDecl> Parameters(void) const;
   std::vector<::pasta::ParmVarDecl> ParameterDeclarations(void) const;
+  ::pasta::BlockDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(BlockDecl)
 };
 
+struct BlockDeclSnapshot : public DeclSnapshot {
+  bool block_missing_return_type;
+  bool can_avoid_copy_to_heap;
+  bool captures_cxx_this;
+  bool does_not_escape;
+  uint32_t block_mangling_number;
+  uint32_t caret_token;
+  uint32_t num_captures;
+  uint32_t num_parameters;
+  bool has_captures;
+  bool is_conversion_from_lambda;
+  bool is_variadic;
+};
+
 static_assert(sizeof(Decl) == sizeof(BlockDecl));
 
 class BuiltinTemplateDecl : public TemplateDecl {
@@ -1581,20 +2095,26 @@ class BuiltinTemplateDecl : public TemplateDecl {
   using TemplateDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(BuiltinTemplateDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {28, 29};
   PASTA_DECLARE_BASE_OPERATORS(Decl, BuiltinTemplateDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, BuiltinTemplateDecl)
   PASTA_DECLARE_BASE_OPERATORS(TemplateDecl, BuiltinTemplateDecl)
   // BuiltinTemplateKind: (clang::BuiltinTemplateKind)
+  ::pasta::BuiltinTemplateDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(BuiltinTemplateDecl)
 };
 
+struct BuiltinTemplateDeclSnapshot : public TemplateDeclSnapshot {
+};
+
 static_assert(sizeof(Decl) == sizeof(BuiltinTemplateDecl));
 
 class CapturedDecl : public Decl {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CapturedDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {2, 3};
   PASTA_DECLARE_BASE_OPERATORS(DeclContext, CapturedDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, CapturedDecl)
   ::pasta::ImplicitParamDecl ContextParameter(void) const;
@@ -1602,25 +2122,38 @@ class CapturedDecl : public Decl {
   uint32_t NumParameters(void) const;
   // Parameter: (clang::ImplicitParamDecl *)
   bool IsNothrow(void) const;
-  std::vector<::pasta::ImplicitParamDecl> Parameters(void) const;
+  ::pasta::LazyRange<::pasta::ImplicitParamDecl> Parameters(void) const;
+  ::pasta::CapturedDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(CapturedDecl)
 };
 
+struct CapturedDeclSnapshot : public DeclSnapshot {
+  uint32_t context_parameter_position;
+  uint32_t num_parameters;
+  bool is_nothrow;
+};
+
 static_assert(sizeof(Decl) == sizeof(CapturedDecl));
 
 class ClassScopeFunctionSpecializationDecl : public Decl {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ClassScopeFunctionSpecializationDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {3, 4};
   PASTA_DECLARE_BASE_OPERATORS(Decl, ClassScopeFunctionSpecializationDecl)
   ::pasta::CXXMethodDecl Specialization(void) const;
   // TemplateArgumentsAsWritten: (const clang::ASTTemplateArgumentListInfo *)
   bool HasExplicitTemplateArguments(void) const;
+  ::pasta::ClassScopeFunctionSpecializationDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(ClassScopeFunctionSpecializationDecl)
 };
 
+struct ClassScopeFunctionSpecializationDeclSnapshot : public DeclSnapshot {
+  bool has_explicit_template_arguments;
+};
+
 static_assert(sizeof(Decl) == sizeof(ClassScopeFunctionSpecializationDecl));
 
 class ConceptDecl : public TemplateDecl {
@@ -1628,16 +2161,22 @@ class ConceptDecl : public TemplateDecl {
   using TemplateDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ConceptDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {29, 30};
   PASTA_DECLARE_BASE_OPERATORS(Decl, ConceptDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, ConceptDecl)
   PASTA_DECLARE_BASE_OPERATORS(TemplateDecl, ConceptDecl)
   ::pasta::ConceptDecl CanonicalDeclaration(void) const;
   ::pasta::Expr ConstraintExpression(void) const;
   bool IsTypeConcept(void) const;
+  ::pasta::ConceptDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(ConceptDecl)
 };
 
+struct ConceptDeclSnapshot : public TemplateDeclSnapshot {
+  bool is_type_concept;
+};
+
 static_assert(sizeof(Decl) == sizeof(ConceptDecl));
 
 class ConstructorUsingShadowDecl : public UsingShadowDecl {
@@ -1645,6 +2184,7 @@ class ConstructorUsingShadowDecl : public UsingShadowDecl {
   using UsingShadowDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ConstructorUsingShadowDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {49, 50};
   PASTA_DECLARE_BASE_OPERATORS(Decl, ConstructorUsingShadowDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, ConstructorUsingShadowDecl)
   PASTA_DECLARE_BASE_OPERATORS(UsingShadowDecl, ConstructorUsingShadowDecl)
@@ -1655,10 +2195,15 @@ class ConstructorUsingShadowDecl : public UsingShadowDecl {
   ::pasta::CXXRecordDecl NominatedBaseClass(void) const;
   std::optional<::pasta::ConstructorUsingShadowDecl> NominatedBaseClassShadowDeclaration(void) const;
   ::pasta::CXXRecordDecl Parent(void) const;
+  ::pasta::ConstructorUsingShadowDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(ConstructorUsingShadowDecl)
 };
 
+struct ConstructorUsingShadowDeclSnapshot : public UsingShadowDeclSnapshot {
+  bool constructs_virtual_base;
+};
+
 static_assert(sizeof(Decl) == sizeof(ConstructorUsingShadowDecl));
 
 class DeclaratorDecl : public ValueDecl {
@@ -1666,6 +2211,7 @@ class DeclaratorDecl : public ValueDecl {
   using ValueDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(DeclaratorDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {51, 69};
   PASTA_DECLARE_BASE_OPERATORS(Decl, DeclaratorDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, DeclaratorDecl)
   PASTA_DECLARE_BASE_OPERATORS(ValueDecl, DeclaratorDecl)
@@ -1698,10 +2244,19 @@ class DeclaratorDecl : public ValueDecl {
   ::pasta::Token TypeSpecEndToken(void) const;
   ::pasta::Token TypeSpecStartToken(void) const;
   std::vector<::pasta::TemplateParameterList> TemplateParameterLists(void) const;
+  ::pasta::DeclaratorDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(DeclaratorDecl)
 };
 
+struct DeclaratorDeclSnapshot : public ValueDeclSnapshot {
+  uint32_t first_inner_token;
+  uint32_t num_template_parameter_lists;
+  uint32_t first_outer_token;
+  uint32_t type_spec_end_token;
+  uint32_t type_spec_start_token;
+};
+
 static_assert(sizeof(Decl) == sizeof(DeclaratorDecl));
 
 class EnumConstantDecl : public ValueDecl {
@@ -1709,16 +2264,21 @@ class EnumConstantDecl : public ValueDecl {
   using ValueDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(EnumConstantDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {69, 70};
   PASTA_DECLARE_BASE_OPERATORS(Decl, EnumConstantDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, EnumConstantDecl)
   PASTA_DECLARE_BASE_OPERATORS(ValueDecl, EnumConstantDecl)
   ::pasta::EnumConstantDecl CanonicalDeclaration(void) const;
   std::optional<::pasta::Expr> InitializerExpression(void) const;
   llvm::APSInt InitializerValue(void) const;
+  ::pasta::EnumConstantDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(EnumConstantDecl)
 };
 
+struct EnumConstantDeclSnapshot : public ValueDeclSnapshot {
+};
+
 static_assert(sizeof(Decl) == sizeof(EnumConstantDecl));
 
 class FieldDecl : public DeclaratorDecl {
@@ -1726,6 +2286,7 @@ class FieldDecl : public DeclaratorDecl {
   using DeclaratorDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(FieldDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {51, 54};
   PASTA_DECLARE_BASE_OPERATORS(Decl, FieldDecl)
   PASTA_DECLARE_BASE_OPERATORS(DeclaratorDecl, FieldDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, FieldDecl)
@@ -1751,11 +2312,28 @@ class FieldDecl : public DeclaratorDecl {
   bool IsZeroLengthBitField(void) const;
   bool IsZeroSize(void) const;
   std::vector<::pasta::TemplateParameterList> TemplateParameterLists(void) const;
+  ::pasta::FieldDeclSnapshot Snapshot(void) const;
   std::optional<uint64_t> OffsetInBits(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(FieldDecl)
 };
 
+struct FieldDeclSnapshot : public DeclaratorDeclSnapshot {
+  uint32_t bit_width_value{};
+  uint32_t field_index;
+  enum InClassInitStyle in_class_initializer_style;
+  bool has_captured_vla_type;
+  bool has_in_class_initializer;
+  bool has_non_null_in_class_initializer;
+  bool is_anonymous_struct_or_union;
+  bool is_bit_field;
+  bool is_mutable;
+  bool is_potentially_overlapping;
+  bool is_unnamed_bitfield;
+  bool is_zero_length_bit_field{};
+  bool is_zero_size{};
+};
+
 static_assert(sizeof(Decl) == sizeof(FieldDecl));
 
 class FunctionDecl : public DeclaratorDecl {
@@ -1763,6 +2341,7 @@ class FunctionDecl : public DeclaratorDecl {
   using DeclaratorDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(FunctionDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {54, 60};
   PASTA_DECLARE_BASE_OPERATORS(DeclContext, FunctionDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, FunctionDecl)
   PASTA_DECLARE_BASE_OPERATORS(DeclaratorDecl, FunctionDecl)
@@ -1870,16 +2449,92 @@ class FunctionDecl : public DeclaratorDecl {
   bool IsUserProvided(void) const;
   bool IsVariadic(void) const;
   bool IsVirtualAsWritten(void) const;
-  std::vector<::pasta::ParmVarDecl> Parameters(void) const;
+  ::pasta::LazyRange<::pasta::ParmVarDecl> Parameters(void) const;
   bool UsesSEHTry(void) const;
   bool WillHaveBody(void) const;
   std::vector<::pasta::TemplateParameterList> TemplateParameterLists(void) const;
   std::vector<::pasta::ParmVarDecl> ParameterDeclarations(void) const;
+  ::pasta::FunctionDeclSnapshot Snapshot(void) const;
   std::optional<::pasta::Stmt> Body(void) const noexcept;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(FunctionDecl)
 };
 
+struct FunctionDeclSnapshot : public DeclaratorDeclSnapshot {
+  bool body_contains_immediate_escalating_expressions;
+  bool friend_constraint_refers_to_enclosing_template;
+  bool uses_fp_intrin;
+  bool does_this_declaration_have_a_body;
+  uint32_t builtin_id;
+  enum ConstexprSpecKind constexpr_kind;
+  uint32_t default_token;
+  uint32_t ellipsis_token;
+  enum ExceptionSpecificationType exception_spec_type;
+  enum LanguageLinkage language_linkage;
+  uint32_t memory_function_kind;
+  uint32_t min_required_arguments;
+  enum MultiVersionKind multi_version_kind;
+  uint32_t num_parameters;
+  enum OverloadedOperatorKind overloaded_operator;
+  uint32_t point_of_instantiation;
+  enum StorageClass storage_class;
+  enum TemplateSpecializationKind template_specialization_kind;
+  enum TemplateSpecializationKind template_specialization_kind_for_instantiation;
+  enum FunctionDeclTemplatedKind templated_kind;
+  bool has_implicit_return_zero;
+  bool has_inherited_prototype;
+  bool has_one_parameter_or_default_arguments;
+  bool has_prototype;
+  bool has_skipped_body;
+  bool has_trivial_body;
+  bool has_written_prototype;
+  bool instantiation_is_pending;
+  bool is_cpu_dispatch_multi_version;
+  bool is_cpu_specific_multi_version;
+  bool is_consteval;
+  bool is_constexpr;
+  bool is_constexpr_specified;
+  bool is_defaulted;
+  bool is_deleted;
+  bool is_deleted_as_written;
+  bool is_destroying_operator_delete;
+  bool is_explicitly_defaulted;
+  bool is_extern_c;
+  bool is_function_template_specialization;
+  bool is_global;
+  bool is_immediate_escalating;
+  bool is_immediate_function;
+  bool is_implicitly_instantiable;
+  bool is_in_extern_c_context;
+  bool is_in_extern_cxx_context;
+  bool is_ineligible_or_not_selected;
+  bool is_inline_builtin_declaration;
+  bool is_inline_specified;
+  bool is_inlined;
+  bool is_late_template_parsed;
+  bool is_msvcrt_entry_point;
+  bool is_main;
+  bool is_member_like_constrained_friend;
+  bool is_multi_version;
+  bool is_no_return;
+  bool is_overloaded_operator;
+  bool is_pure;
+  bool is_replaceable_global_allocation_function;
+  bool is_static;
+  bool is_target_clones_multi_version;
+  bool is_target_multi_version;
+  bool is_template_instantiation;
+  bool is_this_declaration_a_definition;
+  bool is_this_declaration_instantiated_from_a_friend_definition;
+  bool is_trivial;
+  bool is_trivial_for_call;
+  bool is_user_provided;
+  bool is_variadic;
+  bool is_virtual_as_written;
+  bool uses_seh_try;
+  bool will_have_body;
+};
+
 static_assert(sizeof(Decl) == sizeof(FunctionDecl));
 
 class HLSLBufferDecl : public NamedDecl {
@@ -1887,6 +2542,7 @@ class HLSLBufferDecl : public NamedDecl {
   using NamedDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(HLSLBufferDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {16, 17};
   PASTA_DECLARE_BASE_OPERATORS(DeclContext, HLSLBufferDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, HLSLBufferDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, HLSLBufferDecl)
@@ -1894,10 +2550,18 @@ class HLSLBufferDecl : public NamedDecl {
   ::pasta::Token TokenStart(void) const;
   ::pasta::Token RBraceToken(void) const;
   bool IsCBuffer(void) const;
+  ::pasta::HLSLBufferDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(HLSLBufferDecl)
 };
 
+struct HLSLBufferDeclSnapshot : public NamedDeclSnapshot {
+  uint32_t l_brace_token;
+  uint32_t token_start;
+  uint32_t r_brace_token;
+  bool is_c_buffer;
+};
+
 static_assert(sizeof(Decl) == sizeof(HLSLBufferDecl));
 
 class IndirectFieldDecl : public ValueDecl {
@@ -1905,18 +2569,24 @@ class IndirectFieldDecl : public ValueDecl {
   using ValueDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(IndirectFieldDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {70, 71};
   PASTA_DECLARE_BASE_OPERATORS(Decl, IndirectFieldDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, IndirectFieldDecl)
   PASTA_DECLARE_BASE_OPERATORS(ValueDecl, IndirectFieldDecl)
-  std::vector<::pasta::NamedDecl> Chain(void) const;
+  ::pasta::LazyRange<::pasta::NamedDecl> Chain(void) const;
   std::optional<::pasta::FieldDecl> AnonymousField(void) const;
   ::pasta::IndirectFieldDecl CanonicalDeclaration(void) const;
   uint32_t ChainingSize(void) const;
   std::optional<::pasta::VarDecl> VariableDeclaration(void) const;
+  ::pasta::IndirectFieldDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(IndirectFieldDecl)
 };
 
+struct IndirectFieldDeclSnapshot : public ValueDeclSnapshot {
+  uint32_t chaining_size;
+};
+
 static_assert(sizeof(Decl) == sizeof(IndirectFieldDecl));
 
 class LabelDecl : public NamedDecl {
@@ -1924,6 +2594,7 @@ class LabelDecl : public NamedDecl {
   using NamedDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(LabelDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {17, 18};
   PASTA_DECLARE_BASE_OPERATORS(Decl, LabelDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, LabelDecl)
   std::string_view MSAssemblyLabel(void) const;
@@ -1931,10 +2602,17 @@ class LabelDecl : public NamedDecl {
   bool IsGnuLocal(void) const;
   bool IsMSAssemblyLabel(void) const;
   bool IsResolvedMSAssemblyLabel(void) const;
+  ::pasta::LabelDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(LabelDecl)
 };
 
+struct LabelDeclSnapshot : public NamedDeclSnapshot {
+  bool is_gnu_local;
+  bool is_ms_assembly_label;
+  bool is_resolved_ms_assembly_label;
+};
+
 static_assert(sizeof(Decl) == sizeof(LabelDecl));
 
 class MSGuidDecl : public ValueDecl {
@@ -1942,15 +2620,20 @@ class MSGuidDecl : public ValueDecl {
   using ValueDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(MSGuidDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {71, 72};
   PASTA_DECLARE_BASE_OPERATORS(Decl, MSGuidDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, MSGuidDecl)
   PASTA_DECLARE_BASE_OPERATORS(ValueDecl, MSGuidDecl)
   // AsAPValue: (clang::APValue &)
   // Parts: (clang::MSGuidDeclParts)
+  ::pasta::MSGuidDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(MSGuidDecl)
 };
 
+struct MSGuidDeclSnapshot : public ValueDeclSnapshot {
+};
+
 static_assert(sizeof(Decl) == sizeof(MSGuidDecl));
 
 class MSPropertyDecl : public DeclaratorDecl {
@@ -1958,6 +2641,7 @@ class MSPropertyDecl : public DeclaratorDecl {
   using DeclaratorDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(MSPropertyDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {60, 61};
   PASTA_DECLARE_BASE_OPERATORS(Decl, MSPropertyDecl)
   PASTA_DECLARE_BASE_OPERATORS(DeclaratorDecl, MSPropertyDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, MSPropertyDecl)
@@ -1967,10 +2651,16 @@ class MSPropertyDecl : public DeclaratorDecl {
   bool HasGetter(void) const;
   bool HasSetter(void) const;
   std::vector<::pasta::TemplateParameterList> TemplateParameterLists(void) const;
+  ::pasta::MSPropertyDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(MSPropertyDecl)
 };
 
+struct MSPropertyDeclSnapshot : public DeclaratorDeclSnapshot {
+  bool has_getter;
+  bool has_setter;
+};
+
 static_assert(sizeof(Decl) == sizeof(MSPropertyDecl));
 
 class NonTypeTemplateParmDecl : public DeclaratorDecl {
@@ -1978,6 +2668,7 @@ class NonTypeTemplateParmDecl : public DeclaratorDecl {
   using DeclaratorDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(NonTypeTemplateParmDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {61, 62};
   PASTA_DECLARE_BASE_OPERATORS(Decl, NonTypeTemplateParmDecl)
   PASTA_DECLARE_BASE_OPERATORS(DeclaratorDecl, NonTypeTemplateParmDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, NonTypeTemplateParmDecl)
@@ -1997,10 +2688,20 @@ class NonTypeTemplateParmDecl : public DeclaratorDecl {
   std::vector<::pasta::TemplateParameterList> TemplateParameterLists(void) const;
   std::vector<::pasta::Type> ExpansionTypes(void) const;
   // !!! ExpansionType getNumExpansionTypes getExpansionTypeSourceInfo (bad CxxName)
+  ::pasta::NonTypeTemplateParmDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(NonTypeTemplateParmDecl)
 };
 
+struct NonTypeTemplateParmDeclSnapshot : public DeclaratorDeclSnapshot {
+  bool default_argument_was_inherited;
+  uint32_t default_argument_token;
+  bool has_default_argument;
+  bool has_placeholder_type_constraint;
+  bool is_expanded_parameter_pack;
+  bool is_pack_expansion;
+};
+
 static_assert(sizeof(Decl) == sizeof(NonTypeTemplateParmDecl));
 
 class OMPAllocateDecl : public OMPDeclarativeDirectiveDecl {
@@ -2008,14 +2709,19 @@ class OMPAllocateDecl : public OMPDeclarativeDirectiveDecl {
   using OMPDeclarativeDirectiveDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPAllocateDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {77, 78};
   PASTA_DECLARE_BASE_OPERATORS(Decl, OMPAllocateDecl)
   PASTA_DECLARE_BASE_OPERATORS(OMPDeclarativeDirectiveDecl, OMPAllocateDecl)
   // Clauses: (llvm::iterator_range<const clang::OMPClause *const *>)
-  std::vector<::pasta::Expr> Varlists(void) const;
+  ::pasta::LazyRange<::pasta::Expr> Varlists(void) const;
+  ::pasta::OMPAllocateDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(OMPAllocateDecl)
 };
 
+struct OMPAllocateDeclSnapshot : public OMPDeclarativeDirectiveDeclSnapshot {
+};
+
 static_assert(sizeof(Decl) == sizeof(OMPAllocateDecl));
 
 class OMPDeclareMapperDecl : public OMPDeclarativeDirectiveValueDecl {
@@ -2023,6 +2729,7 @@ class OMPDeclareMapperDecl : public OMPDeclarativeDirectiveValueDecl {
   using OMPDeclarativeDirectiveValueDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPDeclareMapperDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {72, 73};
   PASTA_DECLARE_BASE_OPERATORS(DeclContext, OMPDeclareMapperDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, OMPDeclareMapperDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, OMPDeclareMapperDecl)
@@ -2031,10 +2738,14 @@ class OMPDeclareMapperDecl : public OMPDeclarativeDirectiveValueDecl {
   // Clauses: (llvm::iterator_range<const clang::OMPClause *const *>)
   ::pasta::Expr MapperVariableReference(void) const;
   ::pasta::OMPDeclareMapperDecl PrevDeclarationInScope(void) const;
+  ::pasta::OMPDeclareMapperDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(OMPDeclareMapperDecl)
 };
 
+struct OMPDeclareMapperDeclSnapshot : public OMPDeclarativeDirectiveValueDeclSnapshot {
+};
+
 static_assert(sizeof(Decl) == sizeof(OMPDeclareMapperDecl));
 
 class OMPDeclareReductionDecl : public ValueDecl {
@@ -2042,6 +2753,7 @@ class OMPDeclareReductionDecl : public ValueDecl {
   using ValueDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPDeclareReductionDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {73, 74};
   PASTA_DECLARE_BASE_OPERATORS(DeclContext, OMPDeclareReductionDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, OMPDeclareReductionDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, OMPDeclareReductionDecl)
@@ -2054,10 +2766,15 @@ class OMPDeclareReductionDecl : public ValueDecl {
   ::pasta::Expr Initializer(void) const;
   enum OMPDeclareReductionDeclInitKind InitializerKind(void) const;
   ::pasta::OMPDeclareReductionDecl PrevDeclarationInScope(void) const;
+  ::pasta::OMPDeclareReductionDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(OMPDeclareReductionDecl)
 };
 
+struct OMPDeclareReductionDeclSnapshot : public ValueDeclSnapshot {
+  enum OMPDeclareReductionDeclInitKind initializer_kind;
+};
+
 static_assert(sizeof(Decl) == sizeof(OMPDeclareReductionDecl));
 
 class OMPRequiresDecl : public OMPDeclarativeDirectiveDecl {
@@ -2065,13 +2782,18 @@ class OMPRequiresDecl : public OMPDeclarativeDirectiveDecl {
   using OMPDeclarativeDirectiveDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPRequiresDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {78, 79};
   PASTA_DECLARE_BASE_OPERATORS(Decl, OMPRequiresDecl)
   PASTA_DECLARE_BASE_OPERATORS(OMPDeclarativeDirectiveDecl, OMPRequiresDecl)
   // Clauses: (llvm::iterator_range<const clang::OMPClause *const *>)
+  ::pasta::OMPRequiresDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(OMPRequiresDecl)
 };
 
+struct OMPRequiresDeclSnapshot : public OMPDeclarativeDirectiveDeclSnapshot {
+};
+
 static_assert(sizeof(Decl) == sizeof(OMPRequiresDecl));
 
 class OMPThreadPrivateDecl : public OMPDeclarativeDirectiveDecl {
@@ -2079,13 +2801,18 @@ class OMPThreadPrivateDecl : public OMPDeclarativeDirectiveDecl {
   using OMPDeclarativeDirectiveDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPThreadPrivateDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {79, 80};
   PASTA_DECLARE_BASE_OPERATORS(Decl, OMPThreadPrivateDecl)
   PASTA_DECLARE_BASE_OPERATORS(OMPDeclarativeDirectiveDecl, OMPThreadPrivateDecl)
-  std::vector<::pasta::Expr> Varlists(void) const;
+  ::pasta::LazyRange<::pasta::Expr> Varlists(void) const;
+  ::pasta::OMPThreadPrivateDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(OMPThreadPrivateDecl)
 };
 
+struct OMPThreadPrivateDeclSnapshot : public OMPDeclarativeDirectiveDeclSnapshot {
+};
+
 static_assert(sizeof(Decl) == sizeof(OMPThreadPrivateDecl));
 
 class ObjCAtDefsFieldDecl : public FieldDecl {
@@ -2093,16 +2820,21 @@ class ObjCAtDefsFieldDecl : public FieldDecl {
   using FieldDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCAtDefsFieldDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {52, 53};
   PASTA_DECLARE_BASE_OPERATORS(Decl, ObjCAtDefsFieldDecl)
   PASTA_DECLARE_BASE_OPERATORS(DeclaratorDecl, ObjCAtDefsFieldDecl)
   PASTA_DECLARE_BASE_OPERATORS(FieldDecl, ObjCAtDefsFieldDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, ObjCAtDefsFieldDecl)
   PASTA_DECLARE_BASE_OPERATORS(ValueDecl, ObjCAtDefsFieldDecl)
   std::vector<::pasta::TemplateParameterList> TemplateParameterLists(void) const;
+  ::pasta::ObjCAtDefsFieldDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(ObjCAtDefsFieldDecl)
 };
 
+struct ObjCAtDefsFieldDeclSnapshot : public FieldDeclSnapshot {
+};
+
 static_assert(sizeof(Decl) == sizeof(ObjCAtDefsFieldDecl));
 
 class ObjCCategoryDecl : public ObjCContainerDecl {
@@ -2110,6 +2842,7 @@ class ObjCCategoryDecl : public ObjCContainerDecl {
   using ObjCContainerDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCCategoryDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {21, 22};
   PASTA_DECLARE_BASE_OPERATORS(DeclContext, ObjCCategoryDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, ObjCCategoryDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, ObjCCategoryDecl)
@@ -2124,13 +2857,21 @@ class ObjCCategoryDecl : public ObjCContainerDecl {
   ::pasta::ObjCCategoryDecl NextClassCategoryRaw(void) const;
   // ReferencedProtocols: (const clang::ObjCProtocolList &)
   // TypeParameterList: (clang::ObjCTypeParamList *)
-  std::vector<::pasta::ObjCIvarDecl> InstanceVariables(void) const;
+  ::pasta::LazyRange<::pasta::ObjCIvarDecl> InstanceVariables(void) const;
   std::vector<::pasta::Token> ProtocolTokens(void) const;
-  std::vector<::pasta::ObjCProtocolDecl> Protocols(void) const;
+  ::pasta::LazyRange<::pasta::ObjCProtocolDecl> Protocols(void) const;
+  ::pasta::ObjCCategoryDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(ObjCCategoryDecl)
 };
 
+struct ObjCCategoryDeclSnapshot : public ObjCContainerDeclSnapshot {
+  bool is_class_extension;
+  uint32_t category_name_token;
+  uint32_t instance_variable_l_brace_token;
+  uint32_t instance_variable_r_brace_token;
+};
+
 static_assert(sizeof(Decl) == sizeof(ObjCCategoryDecl));
 
 class ObjCCategoryImplDecl : public ObjCImplDecl {
@@ -2138,6 +2879,7 @@ class ObjCCategoryImplDecl : public ObjCImplDecl {
   using ObjCImplDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCCategoryImplDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {22, 23};
   PASTA_DECLARE_BASE_OPERATORS(DeclContext, ObjCCategoryImplDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, ObjCCategoryImplDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, ObjCCategoryImplDecl)
@@ -2145,10 +2887,15 @@ class ObjCCategoryImplDecl : public ObjCImplDecl {
   PASTA_DECLARE_BASE_OPERATORS(ObjCImplDecl, ObjCCategoryImplDecl)
   ::pasta::ObjCCategoryDecl CategoryDeclaration(void) const;
   ::pasta::Token CategoryNameToken(void) const;
+  ::pasta::ObjCCategoryImplDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(ObjCCategoryImplDecl)
 };
 
+struct ObjCCategoryImplDeclSnapshot : public ObjCImplDeclSnapshot {
+  uint32_t category_name_token;
+};
+
 static_assert(sizeof(Decl) == sizeof(ObjCCategoryImplDecl));
 
 class ObjCIvarDecl : public FieldDecl {
@@ -2156,6 +2903,7 @@ class ObjCIvarDecl : public FieldDecl {
   using FieldDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCIvarDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {53, 54};
   PASTA_DECLARE_BASE_OPERATORS(Decl, ObjCIvarDecl)
   PASTA_DECLARE_BASE_OPERATORS(DeclaratorDecl, ObjCIvarDecl)
   PASTA_DECLARE_BASE_OPERATORS(FieldDecl, ObjCIvarDecl)
@@ -2169,10 +2917,17 @@ class ObjCIvarDecl : public FieldDecl {
   bool Synthesize(void) const;
   // UsageType: (clang::QualType)
   std::vector<::pasta::TemplateParameterList> TemplateParameterLists(void) const;
+  ::pasta::ObjCIvarDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(ObjCIvarDecl)
 };
 
+struct ObjCIvarDeclSnapshot : public FieldDeclSnapshot {
+  enum ObjCIvarDeclAccessControl access_control;
+  enum ObjCIvarDeclAccessControl canonical_access_control;
+  bool synthesize;
+};
+
 static_assert(sizeof(Decl) == sizeof(ObjCIvarDecl));
 
 class ObjCTypeParamDecl : public TypedefNameDecl {
@@ -2180,6 +2935,7 @@ class ObjCTypeParamDecl : public TypedefNameDecl {
   using TypedefNameDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCTypeParamDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {41, 42};
   PASTA_DECLARE_BASE_OPERATORS(Decl, ObjCTypeParamDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, ObjCTypeParamDecl)
   PASTA_DECLARE_BASE_OPERATORS(TypeDecl, ObjCTypeParamDecl)
@@ -2189,10 +2945,19 @@ class ObjCTypeParamDecl : public TypedefNameDecl {
   enum ObjCTypeParamVariance Variance(void) const;
   ::pasta::Token VarianceToken(void) const;
   bool HasExplicitBound(void) const;
+  ::pasta::ObjCTypeParamDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(ObjCTypeParamDecl)
 };
 
+struct ObjCTypeParamDeclSnapshot : public TypedefNameDeclSnapshot {
+  uint32_t colon_token;
+  uint32_t index;
+  enum ObjCTypeParamVariance variance;
+  uint32_t variance_token;
+  bool has_explicit_bound;
+};
+
 static_assert(sizeof(Decl) == sizeof(ObjCTypeParamDecl));
 
 class RedeclarableTemplateDecl : public TemplateDecl {
@@ -2200,6 +2965,7 @@ class RedeclarableTemplateDecl : public TemplateDecl {
   using TemplateDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(RedeclarableTemplateDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {30, 34};
   PASTA_DECLARE_BASE_OPERATORS(Decl, RedeclarableTemplateDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, RedeclarableTemplateDecl)
   PASTA_DECLARE_BASE_OPERATORS(TemplateDecl, RedeclarableTemplateDecl)
@@ -2210,10 +2976,15 @@ class RedeclarableTemplateDecl : public TemplateDecl {
   ::pasta::RedeclarableTemplateDecl CanonicalDeclaration(void) const;
   std::optional<::pasta::RedeclarableTemplateDecl> InstantiatedFromMemberTemplate(void) const;
   bool IsMemberSpecialization(void) const;
+  ::pasta::RedeclarableTemplateDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(RedeclarableTemplateDecl)
 };
 
+struct RedeclarableTemplateDeclSnapshot : public TemplateDeclSnapshot {
+  bool is_member_specialization;
+};
+
 static_assert(sizeof(Decl) == sizeof(RedeclarableTemplateDecl));
 
 class TagDecl : public TypeDecl {
@@ -2221,6 +2992,7 @@ class TagDecl : public TypeDecl {
   using TypeDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(TagDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {35, 40};
   PASTA_DECLARE_BASE_OPERATORS(DeclContext, TagDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, TagDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, TagDecl)
@@ -2258,10 +3030,33 @@ class TagDecl : public TypeDecl {
   bool IsUnion(void) const;
   bool MayHaveOutOfDateDefinition(void) const;
   std::vector<::pasta::TemplateParameterList> TemplateParameterLists(void) const;
+  ::pasta::TagDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(TagDecl)
 };
 
+struct TagDeclSnapshot : public TypeDeclSnapshot {
+  uint32_t first_inner_token;
+  uint32_t num_template_parameter_lists;
+  uint32_t first_outer_token;
+  enum TagTypeKind tag_kind;
+  bool has_name_for_linkage;
+  bool is_being_defined;
+  bool is_class;
+  bool is_complete_definition;
+  bool is_complete_definition_required;
+  bool is_dependent_type;
+  bool is_embedded_in_declarator;
+  bool is_enum;
+  bool is_free_standing;
+  bool is_interface;
+  bool is_struct;
+  bool is_this_declaration_a_definition;
+  bool is_this_declaration_a_demoted_definition;
+  bool is_union;
+  bool may_have_out_of_date_definition;
+};
+
 static_assert(sizeof(Decl) == sizeof(TagDecl));
 
 class TemplateParamObjectDecl : public ValueDecl {
@@ -2269,15 +3064,20 @@ class TemplateParamObjectDecl : public ValueDecl {
   using ValueDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(TemplateParamObjectDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {74, 75};
   PASTA_DECLARE_BASE_OPERATORS(Decl, TemplateParamObjectDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, TemplateParamObjectDecl)
   PASTA_DECLARE_BASE_OPERATORS(ValueDecl, TemplateParamObjectDecl)
   ::pasta::TemplateParamObjectDecl CanonicalDeclaration(void) const;
   // Value: (const clang::APValue &)
+  ::pasta::TemplateParamObjectDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(TemplateParamObjectDecl)
 };
 
+struct TemplateParamObjectDeclSnapshot : public ValueDeclSnapshot {
+};
+
 static_assert(sizeof(Decl) == sizeof(TemplateParamObjectDecl));
 
 class TemplateTypeParmDecl : public TypeDecl {
@@ -2285,6 +3085,7 @@ class TemplateTypeParmDecl : public TypeDecl {
   using TypeDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(TemplateTypeParmDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {40, 41};
   PASTA_DECLARE_BASE_OPERATORS(Decl, TemplateTypeParmDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, TemplateTypeParmDecl)
   PASTA_DECLARE_BASE_OPERATORS(TypeDecl, TemplateTypeParmDecl)
@@ -2303,10 +3104,24 @@ class TemplateTypeParmDecl : public TypeDecl {
   bool IsPackExpansion(void) const;
   bool IsParameterPack(void) const;
   bool WasDeclaredWithTypename(void) const;
+  ::pasta::TemplateTypeParmDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(TemplateTypeParmDecl)
 };
 
+struct TemplateTypeParmDeclSnapshot : public TypeDeclSnapshot {
+  bool default_argument_was_inherited;
+  uint32_t default_argument_token;
+  uint32_t depth;
+  uint32_t index;
+  uint32_t num_expansion_parameters{};
+  bool has_default_argument;
+  bool has_type_constraint;
+  bool is_expanded_parameter_pack;
+  bool is_pack_expansion;
+  bool was_declared_with_typename;
+};
+
 static_assert(sizeof(Decl) == sizeof(TemplateTypeParmDecl));
 
 class TypeAliasDecl : public TypedefNameDecl {
@@ -2314,15 +3129,20 @@ class TypeAliasDecl : public TypedefNameDecl {
   using TypedefNameDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(TypeAliasDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {42, 43};
   PASTA_DECLARE_BASE_OPERATORS(Decl, TypeAliasDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, TypeAliasDecl)
   PASTA_DECLARE_BASE_OPERATORS(TypeDecl, TypeAliasDecl)
   PASTA_DECLARE_BASE_OPERATORS(TypedefNameDecl, TypeAliasDecl)
   std::optional<::pasta::TypeAliasTemplateDecl> DescribedAliasTemplate(void) const;
+  ::pasta::TypeAliasDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(TypeAliasDecl)
 };
 
+struct TypeAliasDeclSnapshot : public TypedefNameDeclSnapshot {
+};
+
 static_assert(sizeof(Decl) == sizeof(TypeAliasDecl));
 
 class TypeAliasTemplateDecl : public RedeclarableTemplateDecl {
@@ -2330,6 +3150,7 @@ class TypeAliasTemplateDecl : public RedeclarableTemplateDecl {
   using RedeclarableTemplateDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(TypeAliasTemplateDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {32, 33};
   PASTA_DECLARE_BASE_OPERATORS(Decl, TypeAliasTemplateDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, TypeAliasTemplateDecl)
   PASTA_DECLARE_BASE_OPERATORS(RedeclarableTemplateDecl, TypeAliasTemplateDecl)
@@ -2338,10 +3159,14 @@ class TypeAliasTemplateDecl : public RedeclarableTemplateDecl {
   std::optional<::pasta::TypeAliasTemplateDecl> InstantiatedFromMemberTemplate(void) const;
   std::optional<::pasta::TypeAliasTemplateDecl> PreviousDeclaration(void) const;
   ::pasta::TypeAliasDecl TemplatedDeclaration(void) const;
+  ::pasta::TypeAliasTemplateDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(TypeAliasTemplateDecl)
 };
 
+struct TypeAliasTemplateDeclSnapshot : public RedeclarableTemplateDeclSnapshot {
+};
+
 static_assert(sizeof(Decl) == sizeof(TypeAliasTemplateDecl));
 
 class TypedefDecl : public TypedefNameDecl {
@@ -2349,14 +3174,19 @@ class TypedefDecl : public TypedefNameDecl {
   using TypedefNameDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(TypedefDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {43, 44};
   PASTA_DECLARE_BASE_OPERATORS(Decl, TypedefDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, TypedefDecl)
   PASTA_DECLARE_BASE_OPERATORS(TypeDecl, TypedefDecl)
   PASTA_DECLARE_BASE_OPERATORS(TypedefNameDecl, TypedefDecl)
+  ::pasta::TypedefDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(TypedefDecl)
 };
 
+struct TypedefDeclSnapshot : public TypedefNameDeclSnapshot {
+};
+
 static_assert(sizeof(Decl) == sizeof(TypedefDecl));
 
 class UnnamedGlobalConstantDecl : public ValueDecl {
@@ -2364,14 +3194,19 @@ class UnnamedGlobalConstantDecl : public ValueDecl {
   using ValueDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(UnnamedGlobalConstantDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {75, 76};
   PASTA_DECLARE_BASE_OPERATORS(Decl, UnnamedGlobalConstantDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, UnnamedGlobalConstantDecl)
   PASTA_DECLARE_BASE_OPERATORS(ValueDecl, UnnamedGlobalConstantDecl)
   // Value: (const clang::APValue &)
+  ::pasta::UnnamedGlobalConstantDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(UnnamedGlobalConstantDecl)
 };
 
+struct UnnamedGlobalConstantDeclSnapshot : public ValueDeclSnapshot {
+};
+
 static_assert(sizeof(Decl) == sizeof(UnnamedGlobalConstantDecl));
 
 class UnresolvedUsingValueDecl : public ValueDecl {
@@ -2379,6 +3214,7 @@ class UnresolvedUsingValueDecl : public ValueDecl {
   using ValueDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(UnresolvedUsingValueDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {76, 77};
   PASTA_DECLARE_BASE_OPERATORS(Decl, UnresolvedUsingValueDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, UnresolvedUsingValueDecl)
   PASTA_DECLARE_BASE_OPERATORS(ValueDecl, UnresolvedUsingValueDecl)
@@ -2390,10 +3226,18 @@ class UnresolvedUsingValueDecl : public ValueDecl {
   ::pasta::Token UsingToken(void) const;
   bool IsAccessDeclaration(void) const;
   bool IsPackExpansion(void) const;
+  ::pasta::UnresolvedUsingValueDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(UnresolvedUsingValueDecl)
 };
 
+struct UnresolvedUsingValueDeclSnapshot : public ValueDeclSnapshot {
+  uint32_t ellipsis_token;
+  uint32_t using_token;
+  bool is_access_declaration;
+  bool is_pack_expansion;
+};
+
 static_assert(sizeof(Decl) == sizeof(UnresolvedUsingValueDecl));
 
 class UsingDecl : public BaseUsingDecl {
@@ -2401,6 +3245,7 @@ class UsingDecl : public BaseUsingDecl {
   using BaseUsingDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(UsingDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {14, 15};
   PASTA_DECLARE_BASE_OPERATORS(BaseUsingDecl, UsingDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, UsingDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, UsingDecl)
@@ -2411,10 +3256,17 @@ class UsingDecl : public BaseUsingDecl {
   ::pasta::Token UsingToken(void) const;
   bool HasTypename(void) const;
   bool IsAccessDeclaration(void) const;
+  ::pasta::UsingDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(UsingDecl)
 };
 
+struct UsingDeclSnapshot : public BaseUsingDeclSnapshot {
+  uint32_t using_token;
+  bool has_typename;
+  bool is_access_declaration;
+};
+
 static_assert(sizeof(Decl) == sizeof(UsingDecl));
 
 class UsingEnumDecl : public BaseUsingDecl {
@@ -2422,6 +3274,7 @@ class UsingEnumDecl : public BaseUsingDecl {
   using BaseUsingDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(UsingEnumDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {15, 16};
   PASTA_DECLARE_BASE_OPERATORS(BaseUsingDecl, UsingEnumDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, UsingEnumDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, UsingEnumDecl)
@@ -2433,10 +3286,16 @@ class UsingEnumDecl : public BaseUsingDecl {
   // Qualifier: (clang::NestedNameSpecifier *)
   // QualifierToken: (clang::NestedNameSpecifierLoc)
   ::pasta::Token UsingToken(void) const;
+  ::pasta::UsingEnumDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(UsingEnumDecl)
 };
 
+struct UsingEnumDeclSnapshot : public BaseUsingDeclSnapshot {
+  uint32_t enum_token;
+  uint32_t using_token;
+};
+
 static_assert(sizeof(Decl) == sizeof(UsingEnumDecl));
 
 class VarDecl : public DeclaratorDecl {
@@ -2444,6 +3303,7 @@ class VarDecl : public DeclaratorDecl {
   using DeclaratorDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(VarDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {62, 69};
   PASTA_DECLARE_BASE_OPERATORS(Decl, VarDecl)
   PASTA_DECLARE_BASE_OPERATORS(DeclaratorDecl, VarDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, VarDecl)
@@ -2516,10 +3376,55 @@ class VarDecl : public DeclaratorDecl {
   bool MightBeUsableInConstantExpressions(void) const;
   // NeedsDestruction: (clang::QualType::DestructionKind)
   std::vector<::pasta::TemplateParameterList> TemplateParameterLists(void) const;
+  ::pasta::VarDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(VarDecl)
 };
 
+struct VarDeclSnapshot : public DeclaratorDeclSnapshot {
+  enum VarDeclInitializationStyle initializer_style;
+  enum LanguageLinkage language_linkage;
+  uint32_t point_of_instantiation;
+  enum StorageClass storage_class;
+  enum StorageDuration storage_duration;
+  enum VarDeclTLSKind tls_kind;
+  enum ThreadStorageClassSpecifier tsc_spec;
+  enum TemplateSpecializationKind template_specialization_kind;
+  enum TemplateSpecializationKind template_specialization_kind_for_instantiation;
+  bool has_constant_initialization;
+  bool has_dependent_alignment;
+  bool has_external_storage;
+  bool has_global_storage;
+  bool has_initializer;
+  bool has_local_storage;
+  bool is_arc_pseudo_strong;
+  bool is_cxx_for_range_declaration;
+  bool is_constexpr;
+  bool is_direct_initializer;
+  bool is_escaping_byref;
+  bool is_exception_variable;
+  bool is_extern_c;
+  bool is_file_variable_declaration;
+  bool is_function_or_method_variable_declaration;
+  bool is_in_extern_c_context;
+  bool is_in_extern_cxx_context;
+  bool is_inline;
+  bool is_inline_specified;
+  bool is_known_to_be_defined;
+  bool is_local_variable_declaration;
+  bool is_local_variable_declaration_or_parm;
+  bool is_nrvo_variable;
+  bool is_no_destroy;
+  bool is_non_escaping_byref;
+  bool is_obj_c_for_declaration;
+  bool is_previous_declaration_in_same_block_scope;
+  bool is_static_data_member;
+  bool is_static_local;
+  bool is_this_declaration_a_demoted_definition;
+  bool is_usable_in_constant_expressions;
+  bool might_be_usable_in_constant_expressions;
+};
+
 static_assert(sizeof(Decl) == sizeof(VarDecl));
 
 class VarTemplateDecl : public RedeclarableTemplateDecl {
@@ -2527,6 +3432,7 @@ class VarTemplateDecl : public RedeclarableTemplateDecl {
   using RedeclarableTemplateDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(VarTemplateDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {33, 34};
   PASTA_DECLARE_BASE_OPERATORS(Decl, VarTemplateDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, VarTemplateDecl)
   PASTA_DECLARE_BASE_OPERATORS(RedeclarableTemplateDecl, VarTemplateDecl)
@@ -2537,11 +3443,16 @@ class VarTemplateDecl : public RedeclarableTemplateDecl {
   std::optional<::pasta::VarTemplateDecl> PreviousDeclaration(void) const;
   ::pasta::VarDecl TemplatedDeclaration(void) const;
   bool IsThisDeclarationADefinition(void) const;
-  std::vector<::pasta::VarTemplateSpecializationDecl> Specializations(void) const;
+  ::pasta::LazyRange<::pasta::VarTemplateSpecializationDecl> Specializations(void) const;
+  ::pasta::VarTemplateDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(VarTemplateDecl)
 };
 
+struct VarTemplateDeclSnapshot : public RedeclarableTemplateDeclSnapshot {
+  bool is_this_declaration_a_definition;
+};
+
 static_assert(sizeof(Decl) == sizeof(VarTemplateDecl));
 
 class VarTemplateSpecializationDecl : public VarDecl {
@@ -2549,6 +3460,7 @@ class VarTemplateSpecializationDecl : public VarDecl {
   using VarDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(VarTemplateSpecializationDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {67, 69};
   PASTA_DECLARE_BASE_OPERATORS(Decl, VarTemplateSpecializationDecl)
   PASTA_DECLARE_BASE_OPERATORS(DeclaratorDecl, VarTemplateSpecializationDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, VarTemplateSpecializationDecl)
@@ -2570,10 +3482,20 @@ class VarTemplateSpecializationDecl : public VarDecl {
   bool IsExplicitInstantiationOrSpecialization(void) const;
   bool IsExplicitSpecialization(void) const;
   std::vector<::pasta::TemplateParameterList> TemplateParameterLists(void) const;
+  ::pasta::VarTemplateSpecializationDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(VarTemplateSpecializationDecl)
 };
 
+struct VarTemplateSpecializationDeclSnapshot : public VarDeclSnapshot {
+  uint32_t extern_token;
+  enum TemplateSpecializationKind specialization_kind;
+  uint32_t template_keyword_token;
+  bool is_class_scope_explicit_specialization;
+  bool is_explicit_instantiation_or_specialization;
+  bool is_explicit_specialization;
+};
+
 static_assert(sizeof(Decl) == sizeof(VarTemplateSpecializationDecl));
 
 class CXXDeductionGuideDecl : public FunctionDecl {
@@ -2581,6 +3503,7 @@ class CXXDeductionGuideDecl : public FunctionDecl {
   using FunctionDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXDeductionGuideDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {55, 56};
   PASTA_DECLARE_BASE_OPERATORS(DeclContext, CXXDeductionGuideDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, CXXDeductionGuideDecl)
   PASTA_DECLARE_BASE_OPERATORS(DeclaratorDecl, CXXDeductionGuideDecl)
@@ -2594,10 +3517,16 @@ class CXXDeductionGuideDecl : public FunctionDecl {
   bool IsExplicit(void) const;
   std::vector<::pasta::TemplateParameterList> TemplateParameterLists(void) const;
   std::vector<::pasta::ParmVarDecl> ParameterDeclarations(void) const;
+  ::pasta::CXXDeductionGuideDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(CXXDeductionGuideDecl)
 };
 
+struct CXXDeductionGuideDeclSnapshot : public FunctionDeclSnapshot {
+  enum DeductionCandidate deduction_candidate_kind;
+  bool is_explicit;
+};
+
 static_assert(sizeof(Decl) == sizeof(CXXDeductionGuideDecl));
 
 class CXXMethodDecl : public FunctionDecl {
@@ -2605,6 +3534,7 @@ class CXXMethodDecl : public FunctionDecl {
   using FunctionDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXMethodDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {56, 60};
   PASTA_DECLARE_BASE_OPERATORS(DeclContext, CXXMethodDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, CXXMethodDecl)
   PASTA_DECLARE_BASE_OPERATORS(DeclaratorDecl, CXXMethodDecl)
@@ -2634,14 +3564,28 @@ class CXXMethodDecl : public FunctionDecl {
   // IsUsualDeallocationFunction: (bool)
   bool IsVirtual(void) const;
   bool IsVolatile(void) const;
-  std::vector<::pasta::CXXMethodDecl> OverriddenMethods(void) const;
+  ::pasta::LazyRange<::pasta::CXXMethodDecl> OverriddenMethods(void) const;
   uint32_t SizeOverriddenMethods(void) const;
   std::vector<::pasta::TemplateParameterList> TemplateParameterLists(void) const;
   std::vector<::pasta::ParmVarDecl> ParameterDeclarations(void) const;
+  ::pasta::CXXMethodDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(CXXMethodDecl)
 };
 
+struct CXXMethodDeclSnapshot : public FunctionDeclSnapshot {
+  enum RefQualifierKind reference_qualifier;
+  bool has_inline_body;
+  bool is_const;
+  bool is_copy_assignment_operator;
+  bool is_instance;
+  bool is_lambda_static_invoker;
+  bool is_move_assignment_operator;
+  bool is_virtual;
+  bool is_volatile;
+  uint32_t size_overridden_methods;
+};
+
 static_assert(sizeof(Decl) == sizeof(CXXMethodDecl));
 
 class ClassTemplateDecl : public RedeclarableTemplateDecl {
@@ -2649,6 +3593,7 @@ class ClassTemplateDecl : public RedeclarableTemplateDecl {
   using RedeclarableTemplateDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ClassTemplateDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {30, 31};
   PASTA_DECLARE_BASE_OPERATORS(Decl, ClassTemplateDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, ClassTemplateDecl)
   PASTA_DECLARE_BASE_OPERATORS(RedeclarableTemplateDecl, ClassTemplateDecl)
@@ -2659,11 +3604,16 @@ class ClassTemplateDecl : public RedeclarableTemplateDecl {
   std::optional<::pasta::ClassTemplateDecl> PreviousDeclaration(void) const;
   ::pasta::CXXRecordDecl TemplatedDeclaration(void) const;
   bool IsThisDeclarationADefinition(void) const;
-  std::vector<::pasta::ClassTemplateSpecializationDecl> Specializations(void) const;
+  ::pasta::LazyRange<::pasta::ClassTemplateSpecializationDecl> Specializations(void) const;
+  ::pasta::ClassTemplateDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(ClassTemplateDecl)
 };
 
+struct ClassTemplateDeclSnapshot : public RedeclarableTemplateDeclSnapshot {
+  bool is_this_declaration_a_definition;
+};
+
 static_assert(sizeof(Decl) == sizeof(ClassTemplateDecl));
 
 class DecompositionDecl : public VarDecl {
@@ -2671,17 +3621,22 @@ class DecompositionDecl : public VarDecl {
   using VarDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(DecompositionDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {63, 64};
   PASTA_DECLARE_BASE_OPERATORS(Decl, DecompositionDecl)
   PASTA_DECLARE_BASE_OPERATORS(DeclaratorDecl, DecompositionDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, DecompositionDecl)
   PASTA_DECLARE_BASE_OPERATORS(ValueDecl, DecompositionDecl)
   PASTA_DECLARE_BASE_OPERATORS(VarDecl, DecompositionDecl)
-  std::vector<::pasta::BindingDecl> Bindings(void) const;
+  ::pasta::LazyRange<::pasta::BindingDecl> Bindings(void) const;
   std::vector<::pasta::TemplateParameterList> TemplateParameterLists(void) const;
+  ::pasta::DecompositionDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(DecompositionDecl)
 };
 
+struct DecompositionDeclSnapshot : public VarDeclSnapshot {
+};
+
 static_assert(sizeof(Decl) == sizeof(DecompositionDecl));
 
 class EnumDecl : public TagDecl {
@@ -2689,6 +3644,7 @@ class EnumDecl : public TagDecl {
   using TagDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(EnumDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {35, 36};
   PASTA_DECLARE_BASE_OPERATORS(DeclContext, EnumDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, EnumDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, EnumDecl)
@@ -2717,10 +3673,24 @@ class EnumDecl : public TagDecl {
   bool IsScoped(void) const;
   bool IsScopedUsingClassTag(void) const;
   std::vector<::pasta::TemplateParameterList> TemplateParameterLists(void) const;
+  ::pasta::EnumDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(EnumDecl)
 };
 
+struct EnumDeclSnapshot : public TagDeclSnapshot {
+  uint32_t num_negative_bits;
+  uint32_t num_positive_bits;
+  enum TemplateSpecializationKind template_specialization_kind;
+  bool is_closed;
+  bool is_closed_flag;
+  bool is_closed_non_flag;
+  bool is_complete;
+  bool is_fixed;
+  bool is_scoped;
+  bool is_scoped_using_class_tag;
+};
+
 static_assert(sizeof(Decl) == sizeof(EnumDecl));
 
 class FunctionTemplateDecl : public RedeclarableTemplateDecl {
@@ -2728,6 +3698,7 @@ class FunctionTemplateDecl : public RedeclarableTemplateDecl {
   using RedeclarableTemplateDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(FunctionTemplateDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {31, 32};
   PASTA_DECLARE_BASE_OPERATORS(Decl, FunctionTemplateDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, FunctionTemplateDecl)
   PASTA_DECLARE_BASE_OPERATORS(RedeclarableTemplateDecl, FunctionTemplateDecl)
@@ -2739,11 +3710,17 @@ class FunctionTemplateDecl : public RedeclarableTemplateDecl {
   ::pasta::FunctionDecl TemplatedDeclaration(void) const;
   bool IsAbbreviated(void) const;
   bool IsThisDeclarationADefinition(void) const;
-  std::vector<::pasta::FunctionDecl> Specializations(void) const;
+  ::pasta::LazyRange<::pasta::FunctionDecl> Specializations(void) const;
+  ::pasta::FunctionTemplateDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(FunctionTemplateDecl)
 };
 
+struct FunctionTemplateDeclSnapshot : public RedeclarableTemplateDeclSnapshot {
+  bool is_abbreviated;
+  bool is_this_declaration_a_definition;
+};
+
 static_assert(sizeof(Decl) == sizeof(FunctionTemplateDecl));
 
 class ImplicitParamDecl : public VarDecl {
@@ -2751,6 +3728,7 @@ class ImplicitParamDecl : public VarDecl {
   using VarDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ImplicitParamDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {64, 65};
   PASTA_DECLARE_BASE_OPERATORS(Decl, ImplicitParamDecl)
   PASTA_DECLARE_BASE_OPERATORS(DeclaratorDecl, ImplicitParamDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, ImplicitParamDecl)
@@ -2758,10 +3736,15 @@ class ImplicitParamDecl : public VarDecl {
   PASTA_DECLARE_BASE_OPERATORS(VarDecl, ImplicitParamDecl)
   enum ImplicitParamDeclImplicitParamKind ParameterKind(void) const;
   std::vector<::pasta::TemplateParameterList> TemplateParameterLists(void) const;
+  ::pasta::ImplicitParamDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(ImplicitParamDecl)
 };
 
+struct ImplicitParamDeclSnapshot : public VarDeclSnapshot {
+  enum ImplicitParamDeclImplicitParamKind parameter_kind;
+};
+
 static_assert(sizeof(Decl) == sizeof(ImplicitParamDecl));
 
 class OMPCapturedExprDecl : public VarDecl {
@@ -2769,16 +3752,21 @@ class OMPCapturedExprDecl : public VarDecl {
   using VarDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPCapturedExprDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {65, 66};
   PASTA_DECLARE_BASE_OPERATORS(Decl, OMPCapturedExprDecl)
   PASTA_DECLARE_BASE_OPERATORS(DeclaratorDecl, OMPCapturedExprDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, OMPCapturedExprDecl)
   PASTA_DECLARE_BASE_OPERATORS(ValueDecl, OMPCapturedExprDecl)
   PASTA_DECLARE_BASE_OPERATORS(VarDecl, OMPCapturedExprDecl)
   std::vector<::pasta::TemplateParameterList> TemplateParameterLists(void) const;
+  ::pasta::OMPCapturedExprDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(OMPCapturedExprDecl)
 };
 
+struct OMPCapturedExprDeclSnapshot : public VarDeclSnapshot {
+};
+
 static_assert(sizeof(Decl) == sizeof(OMPCapturedExprDecl));
 
 class ParmVarDecl : public VarDecl {
@@ -2786,6 +3774,7 @@ class ParmVarDecl : public VarDecl {
   using VarDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ParmVarDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {66, 67};
   PASTA_DECLARE_BASE_OPERATORS(Decl, ParmVarDecl)
   PASTA_DECLARE_BASE_OPERATORS(DeclaratorDecl, ParmVarDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, ParmVarDecl)
@@ -2806,10 +3795,24 @@ class ParmVarDecl : public VarDecl {
   bool IsKNRPromoted(void) const;
   bool IsObjCMethodParameter(void) const;
   std::vector<::pasta::TemplateParameterList> TemplateParameterLists(void) const;
+  ::pasta::ParmVarDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(ParmVarDecl)
 };
 
+struct ParmVarDeclSnapshot : public VarDeclSnapshot {
+  uint32_t function_scope_depth;
+  uint32_t function_scope_index;
+  enum DeclObjCDeclQualifier obj_c_decl_qualifier;
+  bool has_default_argument;
+  bool has_inherited_default_argument;
+  bool has_uninstantiated_default_argument;
+  bool has_unparsed_default_argument;
+  bool is_destroyed_in_callee;
+  bool is_knr_promoted;
+  bool is_obj_c_method_parameter;
+};
+
 static_assert(sizeof(Decl) == sizeof(ParmVarDecl));
 
 class RecordDecl : public TagDecl {
@@ -2817,6 +3820,7 @@ class RecordDecl : public TagDecl {
   using TagDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(RecordDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {36, 40};
   PASTA_DECLARE_BASE_OPERATORS(DeclContext, RecordDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, RecordDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, RecordDecl)
@@ -2826,7 +3830,7 @@ class RecordDecl : public TagDecl {
   PASTA_DECLARE_DERIVED_OPERATORS(RecordDecl, ClassTemplatePartialSpecializationDecl)
   PASTA_DECLARE_DERIVED_OPERATORS(RecordDecl, ClassTemplateSpecializationDecl)
   bool CanPassInRegisters(void) const;
-  std::vector<::pasta::FieldDecl> Fields(void) const;
+  ::pasta::LazyRange<::pasta::FieldDecl> Fields(void) const;
   std::optional<::pasta::FieldDecl> FirstNamedDataMember(void) const;
   enum RecordDeclArgPassingKind ArgumentPassingRestrictions(void) const;
   std::optional<::pasta::RecordDecl> Definition(void) const;
@@ -2852,6 +3856,7 @@ class RecordDecl : public TagDecl {
   bool IsRandomized(void) const;
   bool MayInsertExtraPadding(void) const;
   std::vector<::pasta::TemplateParameterList> TemplateParameterLists(void) const;
+  ::pasta::RecordDeclSnapshot Snapshot(void) const;
   std::optional<uint64_t> Size(void) const noexcept;  // In bytes.
   std::optional<uint64_t> Alignment(void) const noexcept;  // In bytes.
   std::optional<uint64_t> SizeWithoutTrailingPadding(void) const noexcept;
@@ -2859,6 +3864,30 @@ class RecordDecl : public TagDecl {
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(RecordDecl)
 };
 
+struct RecordDeclSnapshot : public TagDeclSnapshot {
+  bool can_pass_in_registers;
+  enum RecordDeclArgPassingKind argument_passing_restrictions;
+  bool has_flexible_array_member;
+  bool has_loaded_fields_from_external_storage;
+  bool has_non_trivial_to_primitive_copy_c_union;
+  bool has_non_trivial_to_primitive_default_initialize_c_union;
+  bool has_non_trivial_to_primitive_destruct_c_union;
+  bool has_object_member;
+  bool has_volatile_member;
+  bool is_anonymous_struct_or_union;
+  bool is_captured_record;
+  bool is_injected_class_name;
+  bool is_lambda;
+  bool is_ms_struct;
+  bool is_non_trivial_to_primitive_copy;
+  bool is_non_trivial_to_primitive_default_initialize;
+  bool is_non_trivial_to_primitive_destroy;
+  bool is_or_contains_union;
+  bool is_parameter_destroyed_in_callee;
+  bool is_randomized;
+  bool may_insert_extra_padding;
+};
+
 static_assert(sizeof(Decl) == sizeof(RecordDecl));
 
 class VarTemplatePartialSpecializationDecl : public VarTemplateSpecializationDecl {
@@ -2866,6 +3895,7 @@ class VarTemplatePartialSpecializationDecl : public VarTemplateSpecializationDec
   using VarTemplateSpecializationDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(VarTemplatePartialSpecializationDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {68, 69};
   PASTA_DECLARE_BASE_OPERATORS(Decl, VarTemplatePartialSpecializationDecl)
   PASTA_DECLARE_BASE_OPERATORS(DeclaratorDecl, VarTemplatePartialSpecializationDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, VarTemplatePartialSpecializationDecl)
@@ -2877,10 +3907,15 @@ class VarTemplatePartialSpecializationDecl : public VarTemplateSpecializationDec
   ::pasta::TemplateParameterList TemplateParameters(void) const;
   bool HasAssociatedConstraints(void) const;
   std::vector<::pasta::TemplateParameterList> TemplateParameterLists(void) const;
+  ::pasta::VarTemplatePartialSpecializationDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(VarTemplatePartialSpecializationDecl)
 };
 
+struct VarTemplatePartialSpecializationDeclSnapshot : public VarTemplateSpecializationDeclSnapshot {
+  bool has_associated_constraints;
+};
+
 static_assert(sizeof(Decl) == sizeof(VarTemplatePartialSpecializationDecl));
 
 class CXXConstructorDecl : public CXXMethodDecl {
@@ -2888,6 +3923,7 @@ class CXXConstructorDecl : public CXXMethodDecl {
   using CXXMethodDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXConstructorDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {57, 58};
   PASTA_DECLARE_BASE_OPERATORS(DeclContext, CXXConstructorDecl)
   PASTA_DECLARE_BASE_OPERATORS(CXXMethodDecl, CXXConstructorDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, CXXConstructorDecl)
@@ -2909,10 +3945,20 @@ class CXXConstructorDecl : public CXXMethodDecl {
   bool IsSpecializationCopyingObject(void) const;
   std::vector<::pasta::TemplateParameterList> TemplateParameterLists(void) const;
   std::vector<::pasta::ParmVarDecl> ParameterDeclarations(void) const;
+  ::pasta::CXXConstructorDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(CXXConstructorDecl)
 };
 
+struct CXXConstructorDeclSnapshot : public CXXMethodDeclSnapshot {
+  uint32_t num_constructor_initializers;
+  bool is_default_constructor;
+  bool is_delegating_constructor;
+  bool is_explicit;
+  bool is_inheriting_constructor;
+  bool is_specialization_copying_object;
+};
+
 static_assert(sizeof(Decl) == sizeof(CXXConstructorDecl));
 
 class CXXConversionDecl : public CXXMethodDecl {
@@ -2920,6 +3966,7 @@ class CXXConversionDecl : public CXXMethodDecl {
   using CXXMethodDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXConversionDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {58, 59};
   PASTA_DECLARE_BASE_OPERATORS(DeclContext, CXXConversionDecl)
   PASTA_DECLARE_BASE_OPERATORS(CXXMethodDecl, CXXConversionDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, CXXConversionDecl)
@@ -2934,10 +3981,16 @@ class CXXConversionDecl : public CXXMethodDecl {
   bool IsLambdaToBlockPointerConversion(void) const;
   std::vector<::pasta::TemplateParameterList> TemplateParameterLists(void) const;
   std::vector<::pasta::ParmVarDecl> ParameterDeclarations(void) const;
+  ::pasta::CXXConversionDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(CXXConversionDecl)
 };
 
+struct CXXConversionDeclSnapshot : public CXXMethodDeclSnapshot {
+  bool is_explicit;
+  bool is_lambda_to_block_pointer_conversion;
+};
+
 static_assert(sizeof(Decl) == sizeof(CXXConversionDecl));
 
 class CXXDestructorDecl : public CXXMethodDecl {
@@ -2945,6 +3998,7 @@ class CXXDestructorDecl : public CXXMethodDecl {
   using CXXMethodDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXDestructorDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {59, 60};
   PASTA_DECLARE_BASE_OPERATORS(DeclContext, CXXDestructorDecl)
   PASTA_DECLARE_BASE_OPERATORS(CXXMethodDecl, CXXDestructorDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, CXXDestructorDecl)
@@ -2957,10 +4011,14 @@ class CXXDestructorDecl : public CXXMethodDecl {
   std::optional<::pasta::Expr> OperatorDeleteThisArgument(void) const;
   std::vector<::pasta::TemplateParameterList> TemplateParameterLists(void) const;
   std::vector<::pasta::ParmVarDecl> ParameterDeclarations(void) const;
+  ::pasta::CXXDestructorDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(CXXDestructorDecl)
 };
 
+struct CXXDestructorDeclSnapshot : public CXXMethodDeclSnapshot {
+};
+
 static_assert(sizeof(Decl) == sizeof(CXXDestructorDecl));
 
 class CXXRecordDecl : public RecordDecl {
@@ -2968,6 +4026,7 @@ class CXXRecordDecl : public RecordDecl {
   using RecordDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXRecordDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {37, 40};
   PASTA_DECLARE_BASE_OPERATORS(DeclContext, CXXRecordDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, CXXRecordDecl)
   PASTA_DECLARE_BASE_OPERATORS(NamedDecl, CXXRecordDecl)
@@ -2980,7 +4039,7 @@ class CXXRecordDecl : public RecordDecl {
   std::optional<std::vector<::pasta::CXXBaseSpecifier>> Bases(void) const;
   std::optional<enum MSInheritanceModel> CalculateInheritanceModel(void) const;
   // Captures: (llvm::iterator_range<const clang::LambdaCapture *>)
-  std::vector<::pasta::CXXConstructorDecl> Constructors(void) const;
+  ::pasta::LazyRange<::pasta::CXXConstructorDecl> Constructors(void) const;
   std::optional<bool> DefaultedCopyConstructorIsDeleted(void) const;
   std::optional<bool> DefaultedDefaultConstructorIsConstexpr(void) const;
   std::optional<bool> DefaultedDestructorIsConstexpr(void) const;
@@ -3121,6 +4180,7 @@ class CXXRecordDecl : public RecordDecl {
   std::optional<bool> NullFieldOffsetIsZero(void) const;
   std::optional<std::vector<::pasta::CXXBaseSpecifier>> VirtualBases(void) const;
   std::vector<::pasta::TemplateParameterList> TemplateParameterLists(void) const;
+  ::pasta::CXXRecordDeclSnapshot Snapshot(void) const;
   std::optional<uint64_t> SizeWithoutVirtualBases(void) const noexcept;
   std::optional<CXXRecordDecl> PrimaryBase(void) const noexcept;
   std::optional<bool> HasOwnVirtualFunctionTablePointer(void) const noexcept;
@@ -3131,6 +4191,17 @@ class CXXRecordDecl : public RecordDecl {
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(CXXRecordDecl)
 };
 
+struct CXXRecordDeclSnapshot : public RecordDeclSnapshot {
+  uint32_t device_lambda_mangling_number{};
+  uint32_t lambda_dependency_kind;
+  uint32_t lambda_index_in_context{};
+  enum MSVtorDispMode ms_vtor_disp_mode;
+  enum TemplateSpecializationKind template_specialization_kind;
+  bool is_dependent_lambda;
+  bool is_generic_lambda;
+  bool is_never_dependent_lambda;
+};
+
 static_assert(sizeof(Decl) == sizeof(CXXRecordDecl));
 
 class ClassTemplateSpecializationDecl : public CXXRecordDecl {
@@ -3138,6 +4209,7 @@ class ClassTemplateSpecializationDecl : public CXXRecordDecl {
   using CXXRecordDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ClassTemplateSpecializationDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {38, 40};
   PASTA_DECLARE_BASE_OPERATORS(DeclContext, ClassTemplateSpecializationDecl)
   PASTA_DECLARE_BASE_OPERATORS(CXXRecordDecl, ClassTemplateSpecializationDecl)
   PASTA_DECLARE_BASE_OPERATORS(Decl, ClassTemplateSpecializationDecl)
@@ -3160,10 +4232,21 @@ class ClassTemplateSpecializationDecl : public CXXRecordDecl {
   bool IsExplicitInstantiationOrSpecialization(void) const;
   bool IsExplicitSpecialization(void) const;
   std::vector<::pasta::TemplateParameterList> TemplateParameterLists(void) const;
+  ::pasta::ClassTemplateSpecializationDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(ClassTemplateSpecializationDecl)
 };
 
+struct ClassTemplateSpecializationDeclSnapshot : public CXXRecordDeclSnapshot {
+  uint32_t extern_token;
+  uint32_t point_of_instantiation;
+  enum TemplateSpecializationKind specialization_kind;
+  uint32_t template_keyword_token;
+  bool is_class_scope_explicit_specialization;
+  bool is_explicit_instantiation_or_specialization;
+  bool is_explicit_specialization;
+};
+
 static_assert(sizeof(Decl) == sizeof(ClassTemplateSpecializationDecl));
 
 class ClassTemplatePartialSpecializationDecl : public ClassTemplateSpecializationDecl {
@@ -3171,6 +4254,7 @@ class ClassTemplatePartialSpecializationDecl : public ClassTemplateSpecializatio
   using ClassTemplateSpecializationDecl::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ClassTemplatePartialSpecializationDecl)
+  static constexpr ::pasta::detail::KindRange kKindRange = {39, 40};
   PASTA_DECLARE_BASE_OPERATORS(DeclContext, ClassTemplatePartialSpecializationDecl)
   PASTA_DECLARE_BASE_OPERATORS(CXXRecordDecl, ClassTemplatePartialSpecializationDecl)
   PASTA_DECLARE_BASE_OPERATORS(ClassTemplateSpecializationDecl, ClassTemplatePartialSpecializationDecl)
@@ -3186,10 +4270,15 @@ class ClassTemplatePartialSpecializationDecl : public ClassTemplateSpecializatio
   ::pasta::TemplateParameterList TemplateParameters(void) const;
   bool HasAssociatedConstraints(void) const;
   std::vector<::pasta::TemplateParameterList> TemplateParameterLists(void) const;
+  ::pasta::ClassTemplatePartialSpecializationDeclSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_DECL_CONSTRUCTOR(ClassTemplatePartialSpecializationDecl)
 };
 
+struct ClassTemplatePartialSpecializationDeclSnapshot : public ClassTemplateSpecializationDeclSnapshot {
+  bool has_associated_constraints;
+};
+
 static_assert(sizeof(Decl) == sizeof(ClassTemplatePartialSpecializationDecl));
 
 }  // namespace pasta
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+#include <pasta/Util/Result.h>
+
+namespace pasta {
+
+class AST;
+
+// Index used in an entity export for a missing entity.
+static constexpr uint32_t kInvalidExportIndex = ~0u;
+
+enum class ExportedEntityCategory : uint8_t {
+  kDeclaration,
+  kStatement,
+};
+
+// A declaration or statement in an entity export. Entities are in the same
+// order as they are visited by `Walker::Walk`, and so entity `0` is the
+// translation unit, and every entity comes after its parent.
+struct ExportedEntity {
+
+  // Index of the parent entity, or `kInvalidExportIndex` for the translation
+  // unit.
+  uint32_t parent;
+
+  // `Token::Index`s of the first and last tokens of Clang's source range of
+  // this entity, or `kInvalidTokenIndex`. For declarations, this range can be
+  // narrower than `Decl::Tokens`.
+  uint32_t first_token;
+  uint32_t last_token;
+
+  // `Token::Index` of `Decl::Token` for declarations, and of
+  // `Stmt::BeginToken` for statements, or `kInvalidTokenIndex`.
+  uint32_t token;
+
+  // Name of a named declaration, in the string table of the export.
+  uint32_t name_offset;
+  uint32_t name_length;
+
+  // A `DeclKind` for declarations, and a `StmtKind` for statements.
+  uint16_t kind;
+  ExportedEntityCategory category;
+  uint8_t reserved;
+};
+
+enum class ExportedReferenceKind : uint8_t {
+
+  // The declaration referenced by a `DeclRefExpr` or `MemberExpr`.
+  kReferencedDeclaration,
+
+  // The declaration called by a `CallExpr`.
+  kCalledDeclaration,
+
+  // The canonical declaration of a redeclaration.
+  kCanonicalDeclaration,
+};
+
+// A relationship between two entities of an entity export. References to
+// declarations that weren't exported, e.g. implicit builtin functions, are
+// omitted.
+struct ExportedReference {
+  uint32_t from;
+  uint32_t to;
+  ExportedReferenceKind kind;
+  uint8_t reserved[3];
+};
+
+class EntityExportImpl;
+
+// A compact, flat export of the declarations and statements of an AST, their
+// token ranges, and the references between them. The serialized format is a
+// header, followed by an array of `ExportedEntity`, an array of
+// `ExportedReference`, and then a string table.
+//
+// `EntityExport::Serialize` partitions the AST by top-level declaration, and
+// exports the partitions concurrently. It reads the underlying Clang nodes
+// directly, and doesn't create any owning `Decl`s, `Stmt`s, or `Token`s.
+class EntityExport {
+ public:
+  // Version of the binary format. Loading an export with a different version
+  // fails.
+  static constexpr uint32_t kVersion = 1u;
+
+  // Export the declarations and statements of `ast` using `num_threads`
+  // worker threads. If `num_threads` is zero, then one thread per hardware
+  // thread is used. The result is the same regardless of `num_threads`.
+  static std::string Serialize(const AST &ast, unsigned num_threads = 0u);
+
+  // Validate the serialized entity export in `data`, taking ownership of it.
+  static Result<EntityExport, std::error_code> Load(std::string data);
+
+  // All exported entities.
+  std::span<const ExportedEntity> Entities(void) const noexcept;
+
+  // All exported references, in the order of their `from` entities.
+  std::span<const ExportedReference> References(void) const noexcept;
+
+  // Return the name of `entity`, which must be an entity of this export. This
+  // is empty for unnamed declarations and for statements.
+  std::string_view Name(const ExportedEntity &entity) const noexcept;
+
+ private:
+  EntityExport(void) = delete;
+
+  inline explicit EntityExport(std::shared_ptr<const EntityExportImpl> impl_)
+      : impl(std::move(impl_)) {}
+
+  std::shared_ptr<const EntityExportImpl> impl;
+};
+
+}  // namespace pasta
@@ -7798,6 +7798,420 @@ enum class Visibility : unsigned int {
 #define PASTA_FOR_EACH_ATTR_KIND(m) \
     PASTA_FOR_EACH_ATTR_IMPL(m, PASTA_IGNORE_ABSTRACT)
 
+namespace detail {
+
+static constexpr uint16_t kInvalidKindOrder = 0xFFFFu;
+
+// The half-open range of kind orders of a class and its concrete
+// derived classes.
+struct KindRange {
+  uint16_t begin;
+  uint16_t end;
+};
+
+inline constexpr bool IsInKindRange(uint16_t order,
+                                    KindRange range) noexcept {
+  return range.begin <= order && order < range.end;
+}
+
+inline constexpr uint16_t DeclKindOrder(DeclKind kind) noexcept {
+  switch (kind) {
+    case DeclKind::kAccessSpec: return 0;
+    case DeclKind::kBlock: return 1;
+    case DeclKind::kCaptured: return 2;
+    case DeclKind::kClassScopeFunctionSpecialization: return 3;
+    case DeclKind::kEmpty: return 4;
+    case DeclKind::kExport: return 5;
+    case DeclKind::kExternCContext: return 6;
+    case DeclKind::kFileScopeAsm: return 7;
+    case DeclKind::kFriend: return 8;
+    case DeclKind::kFriendTemplate: return 9;
+    case DeclKind::kImplicitConceptSpecialization: return 10;
+    case DeclKind::kImport: return 11;
+    case DeclKind::kLifetimeExtendedTemporary: return 12;
+    case DeclKind::kLinkageSpec: return 13;
+    case DeclKind::kUsing: return 14;
+    case DeclKind::kUsingEnum: return 15;
+    case DeclKind::kHLSLBuffer: return 16;
+    case DeclKind::kLabel: return 17;
+    case DeclKind::kNamespaceAlias: return 18;
+    case DeclKind::kNamespace: return 19;
+    case DeclKind::kObjCCompatibleAlias: return 20;
+    case DeclKind::kObjCCategory: return 21;
+    case DeclKind::kObjCCategoryImpl: return 22;
+    case DeclKind::kObjCImplementation: return 23;
+    case DeclKind::kObjCInterface: return 24;
+    case DeclKind::kObjCProtocol: return 25;
+    case DeclKind::kObjCMethod: return 26;
+    case DeclKind::kObjCProperty: return 27;
+    case DeclKind::kBuiltinTemplate: return 28;
+    case DeclKind::kConcept: return 29;
+    case DeclKind::kClassTemplate: return 30;
+    case DeclKind::kFunctionTemplate: return 31;
+    case DeclKind::kTypeAliasTemplate: return 32;
+    case DeclKind::kVarTemplate: return 33;
+    case DeclKind::kTemplateTemplateParm: return 34;
+    case DeclKind::kEnum: return 35;
+    case DeclKind::kRecord: return 36;
+    case DeclKind::kCXXRecord: return 37;
+    case DeclKind::kClassTemplateSpecialization: return 38;
+    case DeclKind::kClassTemplatePartialSpecialization: return 39;
+    case DeclKind::kTemplateTypeParm: return 40;
+    case DeclKind::kObjCTypeParam: return 41;
+    case DeclKind::kTypeAlias: return 42;
+    case DeclKind::kTypedef: return 43;
+    case DeclKind::kUnresolvedUsingTypename: return 44;
+    case DeclKind::kUnresolvedUsingIfExists: return 45;
+    case DeclKind::kUsingDirective: return 46;
+    case DeclKind::kUsingPack: return 47;
+    case DeclKind::kUsingShadow: return 48;
+    case DeclKind::kConstructorUsingShadow: return 49;
+    case DeclKind::kBinding: return 50;
+    case DeclKind::kField: return 51;
+    case DeclKind::kObjCAtDefsField: return 52;
+    case DeclKind::kObjCIvar: return 53;
+    case DeclKind::kFunction: return 54;
+    case DeclKind::kCXXDeductionGuide: return 55;
+    case DeclKind::kCXXMethod: return 56;
+    case DeclKind::kCXXConstructor: return 57;
+    case DeclKind::kCXXConversion: return 58;
+    case DeclKind::kCXXDestructor: return 59;
+    case DeclKind::kMSProperty: return 60;
+    case DeclKind::kNonTypeTemplateParm: return 61;
+    case DeclKind::kVar: return 62;
+    case DeclKind::kDecomposition: return 63;
+    case DeclKind::kImplicitParam: return 64;
+    case DeclKind::kOMPCapturedExpr: return 65;
+    case DeclKind::kParmVar: return 66;
+    case DeclKind::kVarTemplateSpecialization: return 67;
+    case DeclKind::kVarTemplatePartialSpecialization: return 68;
+    case DeclKind::kEnumConstant: return 69;
+    case DeclKind::kIndirectField: return 70;
+    case DeclKind::kMSGuid: return 71;
+    case DeclKind::kOMPDeclareMapper: return 72;
+    case DeclKind::kOMPDeclareReduction: return 73;
+    case DeclKind::kTemplateParamObject: return 74;
+    case DeclKind::kUnnamedGlobalConstant: return 75;
+    case DeclKind::kUnresolvedUsingValue: return 76;
+    case DeclKind::kOMPAllocate: return 77;
+    case DeclKind::kOMPRequires: return 78;
+    case DeclKind::kOMPThreadPrivate: return 79;
+    case DeclKind::kObjCPropertyImpl: return 80;
+    case DeclKind::kPragmaComment: return 81;
+    case DeclKind::kPragmaDetectMismatch: return 82;
+    case DeclKind::kRequiresExprBody: return 83;
+    case DeclKind::kStaticAssert: return 84;
+    case DeclKind::kTopLevelStmt: return 85;
+    case DeclKind::kTranslationUnit: return 86;
+    default: break;
+  }
+  return kInvalidKindOrder;
+}
+
+inline constexpr uint16_t StmtKindOrder(StmtKind kind) noexcept {
+  switch (kind) {
+    case StmtKind::kGCCAsmStmt: return 0;
+    case StmtKind::kMSAsmStmt: return 1;
+    case StmtKind::kBreakStmt: return 2;
+    case StmtKind::kCXXCatchStmt: return 3;
+    case StmtKind::kCXXForRangeStmt: return 4;
+    case StmtKind::kCXXTryStmt: return 5;
+    case StmtKind::kCapturedStmt: return 6;
+    case StmtKind::kCompoundStmt: return 7;
+    case StmtKind::kContinueStmt: return 8;
+    case StmtKind::kCoreturnStmt: return 9;
+    case StmtKind::kCoroutineBodyStmt: return 10;
+    case StmtKind::kDeclStmt: return 11;
+    case StmtKind::kDoStmt: return 12;
+    case StmtKind::kForStmt: return 13;
+    case StmtKind::kGotoStmt: return 14;
+    case StmtKind::kIfStmt: return 15;
+    case StmtKind::kIndirectGotoStmt: return 16;
+    case StmtKind::kMSDependentExistsStmt: return 17;
+    case StmtKind::kNullStmt: return 18;
+    case StmtKind::kOMPCanonicalLoop: return 19;
+    case StmtKind::kOMPAtomicDirective: return 20;
+    case StmtKind::kOMPBarrierDirective: return 21;
+    case StmtKind::kOMPCancelDirective: return 22;
+    case StmtKind::kOMPCancellationPointDirective: return 23;
+    case StmtKind::kOMPCriticalDirective: return 24;
+    case StmtKind::kOMPDepobjDirective: return 25;
+    case StmtKind::kOMPDispatchDirective: return 26;
+    case StmtKind::kOMPErrorDirective: return 27;
+    case StmtKind::kOMPFlushDirective: return 28;
+    case StmtKind::kOMPInteropDirective: return 29;
+    case StmtKind::kOMPDistributeDirective: return 30;
+    case StmtKind::kOMPDistributeParallelForDirective: return 31;
+    case StmtKind::kOMPDistributeParallelForSimdDirective: return 32;
+    case StmtKind::kOMPDistributeSimdDirective: return 33;
+    case StmtKind::kOMPForDirective: return 34;
+    case StmtKind::kOMPForSimdDirective: return 35;
+    case StmtKind::kOMPGenericLoopDirective: return 36;
+    case StmtKind::kOMPMaskedTaskLoopDirective: return 37;
+    case StmtKind::kOMPMaskedTaskLoopSimdDirective: return 38;
+    case StmtKind::kOMPMasterTaskLoopDirective: return 39;
+    case StmtKind::kOMPMasterTaskLoopSimdDirective: return 40;
+    case StmtKind::kOMPParallelForDirective: return 41;
+    case StmtKind::kOMPParallelForSimdDirective: return 42;
+    case StmtKind::kOMPParallelGenericLoopDirective: return 43;
+    case StmtKind::kOMPParallelMaskedTaskLoopDirective: return 44;
+    case StmtKind::kOMPParallelMaskedTaskLoopSimdDirective: return 45;
+    case StmtKind::kOMPParallelMasterTaskLoopDirective: return 46;
+    case StmtKind::kOMPParallelMasterTaskLoopSimdDirective: return 47;
+    case StmtKind::kOMPSimdDirective: return 48;
+    case StmtKind::kOMPTargetParallelForDirective: return 49;
+    case StmtKind::kOMPTargetParallelForSimdDirective: return 50;
+    case StmtKind::kOMPTargetParallelGenericLoopDirective: return 51;
+    case StmtKind::kOMPTargetSimdDirective: return 52;
+    case StmtKind::kOMPTargetTeamsDistributeDirective: return 53;
+    case StmtKind::kOMPTargetTeamsDistributeParallelForDirective: return 54;
+    case StmtKind::kOMPTargetTeamsDistributeParallelForSimdDirective: return 55;
+    case StmtKind::kOMPTargetTeamsDistributeSimdDirective: return 56;
+    case StmtKind::kOMPTargetTeamsGenericLoopDirective: return 57;
+    case StmtKind::kOMPTaskLoopDirective: return 58;
+    case StmtKind::kOMPTaskLoopSimdDirective: return 59;
+    case StmtKind::kOMPTeamsDistributeDirective: return 60;
+    case StmtKind::kOMPTeamsDistributeParallelForDirective: return 61;
+    case StmtKind::kOMPTeamsDistributeParallelForSimdDirective: return 62;
+    case StmtKind::kOMPTeamsDistributeSimdDirective: return 63;
+    case StmtKind::kOMPTeamsGenericLoopDirective: return 64;
+    case StmtKind::kOMPTileDirective: return 65;
+    case StmtKind::kOMPUnrollDirective: return 66;
+    case StmtKind::kOMPMaskedDirective: return 67;
+    case StmtKind::kOMPMasterDirective: return 68;
+    case StmtKind::kOMPMetaDirective: return 69;
+    case StmtKind::kOMPOrderedDirective: return 70;
+    case StmtKind::kOMPParallelDirective: return 71;
+    case StmtKind::kOMPParallelMaskedDirective: return 72;
+    case StmtKind::kOMPParallelMasterDirective: return 73;
+    case StmtKind::kOMPParallelSectionsDirective: return 74;
+    case StmtKind::kOMPScanDirective: return 75;
+    case StmtKind::kOMPSectionDirective: return 76;
+    case StmtKind::kOMPSectionsDirective: return 77;
+    case StmtKind::kOMPSingleDirective: return 78;
+    case StmtKind::kOMPTargetDataDirective: return 79;
+    case StmtKind::kOMPTargetDirective: return 80;
+    case StmtKind::kOMPTargetEnterDataDirective: return 81;
+    case StmtKind::kOMPTargetExitDataDirective: return 82;
+    case StmtKind::kOMPTargetParallelDirective: return 83;
+    case StmtKind::kOMPTargetTeamsDirective: return 84;
+    case StmtKind::kOMPTargetUpdateDirective: return 85;
+    case StmtKind::kOMPTaskDirective: return 86;
+    case StmtKind::kOMPTaskgroupDirective: return 87;
+    case StmtKind::kOMPTaskwaitDirective: return 88;
+    case StmtKind::kOMPTaskyieldDirective: return 89;
+    case StmtKind::kOMPTeamsDirective: return 90;
+    case StmtKind::kObjCAtCatchStmt: return 91;
+    case StmtKind::kObjCAtFinallyStmt: return 92;
+    case StmtKind::kObjCAtSynchronizedStmt: return 93;
+    case StmtKind::kObjCAtThrowStmt: return 94;
+    case StmtKind::kObjCAtTryStmt: return 95;
+    case StmtKind::kObjCAutoreleasePoolStmt: return 96;
+    case StmtKind::kObjCForCollectionStmt: return 97;
+    case StmtKind::kReturnStmt: return 98;
+    case StmtKind::kSEHExceptStmt: return 99;
+    case StmtKind::kSEHFinallyStmt: return 100;
+    case StmtKind::kSEHLeaveStmt: return 101;
+    case StmtKind::kSEHTryStmt: return 102;
+    case StmtKind::kCaseStmt: return 103;
+    case StmtKind::kDefaultStmt: return 104;
+    case StmtKind::kSwitchStmt: return 105;
+    case StmtKind::kAttributedStmt: return 106;
+    case StmtKind::kBinaryConditionalOperator: return 107;
+    case StmtKind::kConditionalOperator: return 108;
+    case StmtKind::kAddrLabelExpr: return 109;
+    case StmtKind::kArrayInitIndexExpr: return 110;
+    case StmtKind::kArrayInitLoopExpr: return 111;
+    case StmtKind::kArraySubscriptExpr: return 112;
+    case StmtKind::kArrayTypeTraitExpr: return 113;
+    case StmtKind::kAsTypeExpr: return 114;
+    case StmtKind::kAtomicExpr: return 115;
+    case StmtKind::kBinaryOperator: return 116;
+    case StmtKind::kCompoundAssignOperator: return 117;
+    case StmtKind::kBlockExpr: return 118;
+    case StmtKind::kCXXBindTemporaryExpr: return 119;
+    case StmtKind::kCXXBoolLiteralExpr: return 120;
+    case StmtKind::kCXXConstructExpr: return 121;
+    case StmtKind::kCXXTemporaryObjectExpr: return 122;
+    case StmtKind::kCXXDefaultArgExpr: return 123;
+    case StmtKind::kCXXDefaultInitExpr: return 124;
+    case StmtKind::kCXXDeleteExpr: return 125;
+    case StmtKind::kCXXDependentScopeMemberExpr: return 126;
+    case StmtKind::kCXXFoldExpr: return 127;
+    case StmtKind::kCXXInheritedCtorInitExpr: return 128;
+    case StmtKind::kCXXNewExpr: return 129;
+    case StmtKind::kCXXNoexceptExpr: return 130;
+    case StmtKind::kCXXNullPtrLiteralExpr: return 131;
+    case StmtKind::kCXXParenListInitExpr: return 132;
+    case StmtKind::kCXXPseudoDestructorExpr: return 133;
+    case StmtKind::kCXXRewrittenBinaryOperator: return 134;
+    case StmtKind::kCXXScalarValueInitExpr: return 135;
+    case StmtKind::kCXXStdInitializerListExpr: return 136;
+    case StmtKind::kCXXThisExpr: return 137;
+    case StmtKind::kCXXThrowExpr: return 138;
+    case StmtKind::kCXXTypeidExpr: return 139;
+    case StmtKind::kCXXUnresolvedConstructExpr: return 140;
+    case StmtKind::kCXXUuidofExpr: return 141;
+    case StmtKind::kCallExpr: return 142;
+    case StmtKind::kCUDAKernelCallExpr: return 143;
+    case StmtKind::kCXXMemberCallExpr: return 144;
+    case StmtKind::kCXXOperatorCallExpr: return 145;
+    case StmtKind::kUserDefinedLiteral: return 146;
+    case StmtKind::kBuiltinBitCastExpr: return 147;
+    case StmtKind::kCStyleCastExpr: return 148;
+    case StmtKind::kCXXFunctionalCastExpr: return 149;
+    case StmtKind::kCXXAddrspaceCastExpr: return 150;
+    case StmtKind::kCXXConstCastExpr: return 151;
+    case StmtKind::kCXXDynamicCastExpr: return 152;
+    case StmtKind::kCXXReinterpretCastExpr: return 153;
+    case StmtKind::kCXXStaticCastExpr: return 154;
+    case StmtKind::kObjCBridgedCastExpr: return 155;
+    case StmtKind::kImplicitCastExpr: return 156;
+    case StmtKind::kCharacterLiteral: return 157;
+    case StmtKind::kChooseExpr: return 158;
+    case StmtKind::kCompoundLiteralExpr: return 159;
+    case StmtKind::kConceptSpecializationExpr: return 160;
+    case StmtKind::kConvertVectorExpr: return 161;
+    case StmtKind::kCoawaitExpr: return 162;
+    case StmtKind::kCoyieldExpr: return 163;
+    case StmtKind::kDeclRefExpr: return 164;
+    case StmtKind::kDependentCoawaitExpr: return 165;
+    case StmtKind::kDependentScopeDeclRefExpr: return 166;
+    case StmtKind::kDesignatedInitExpr: return 167;
+    case StmtKind::kDesignatedInitUpdateExpr: return 168;
+    case StmtKind::kExpressionTraitExpr: return 169;
+    case StmtKind::kExtVectorElementExpr: return 170;
+    case StmtKind::kFixedPointLiteral: return 171;
+    case StmtKind::kFloatingLiteral: return 172;
+    case StmtKind::kConstantExpr: return 173;
+    case StmtKind::kExprWithCleanups: return 174;
+    case StmtKind::kFunctionParmPackExpr: return 175;
+    case StmtKind::kGNUNullExpr: return 176;
+    case StmtKind::kGenericSelectionExpr: return 177;
+    case StmtKind::kImaginaryLiteral: return 178;
+    case StmtKind::kImplicitValueInitExpr: return 179;
+    case StmtKind::kInitListExpr: return 180;
+    case StmtKind::kIntegerLiteral: return 181;
+    case StmtKind::kLambdaExpr: return 182;
+    case StmtKind::kMSPropertyRefExpr: return 183;
+    case StmtKind::kMSPropertySubscriptExpr: return 184;
+    case StmtKind::kMaterializeTemporaryExpr: return 185;
+    case StmtKind::kMatrixSubscriptExpr: return 186;
+    case StmtKind::kMemberExpr: return 187;
+    case StmtKind::kNoInitExpr: return 188;
+    case StmtKind::kOMPArraySectionExpr: return 189;
+    case StmtKind::kOMPArrayShapingExpr: return 190;
+    case StmtKind::kOMPIteratorExpr: return 191;
+    case StmtKind::kObjCArrayLiteral: return 192;
+    case StmtKind::kObjCAvailabilityCheckExpr: return 193;
+    case StmtKind::kObjCBoolLiteralExpr: return 194;
+    case StmtKind::kObjCBoxedExpr: return 195;
+    case StmtKind::kObjCDictionaryLiteral: return 196;
+    case StmtKind::kObjCEncodeExpr: return 197;
+    case StmtKind::kObjCIndirectCopyRestoreExpr: return 198;
+    case StmtKind::kObjCIsaExpr: return 199;
+    case StmtKind::kObjCIvarRefExpr: return 200;
+    case StmtKind::kObjCMessageExpr: return 201;
+    case StmtKind::kObjCPropertyRefExpr: return 202;
+    case StmtKind::kObjCProtocolExpr: return 203;
+    case StmtKind::kObjCSelectorExpr: return 204;
+    case StmtKind::kObjCStringLiteral: return 205;
+    case StmtKind::kObjCSubscriptRefExpr: return 206;
+    case StmtKind::kOffsetOfExpr: return 207;
+    case StmtKind::kOpaqueValueExpr: return 208;
+    case StmtKind::kUnresolvedLookupExpr: return 209;
+    case StmtKind::kUnresolvedMemberExpr: return 210;
+    case StmtKind::kPackExpansionExpr: return 211;
+    case StmtKind::kParenExpr: return 212;
+    case StmtKind::kParenListExpr: return 213;
+    case StmtKind::kPredefinedExpr: return 214;
+    case StmtKind::kPseudoObjectExpr: return 215;
+    case StmtKind::kRecoveryExpr: return 216;
+    case StmtKind::kRequiresExpr: return 217;
+    case StmtKind::kSYCLUniqueStableNameExpr: return 218;
+    case StmtKind::kShuffleVectorExpr: return 219;
+    case StmtKind::kSizeOfPackExpr: return 220;
+    case StmtKind::kSourceLocExpr: return 221;
+    case StmtKind::kStmtExpr: return 222;
+    case StmtKind::kStringLiteral: return 223;
+    case StmtKind::kSubstNonTypeTemplateParmExpr: return 224;
+    case StmtKind::kSubstNonTypeTemplateParmPackExpr: return 225;
+    case StmtKind::kTypeTraitExpr: return 226;
+    case StmtKind::kTypoExpr: return 227;
+    case StmtKind::kUnaryExprOrTypeTraitExpr: return 228;
+    case StmtKind::kUnaryOperator: return 229;
+    case StmtKind::kVAArgExpr: return 230;
+    case StmtKind::kLabelStmt: return 231;
+    case StmtKind::kWhileStmt: return 232;
+    default: break;
+  }
+  return kInvalidKindOrder;
+}
+
+inline constexpr uint16_t TypeKindOrder(TypeKind kind) noexcept {
+  switch (kind) {
+    case TypeKind::kAdjusted: return 0;
+    case TypeKind::kDecayed: return 1;
+    case TypeKind::kConstantArray: return 2;
+    case TypeKind::kDependentSizedArray: return 3;
+    case TypeKind::kIncompleteArray: return 4;
+    case TypeKind::kVariableArray: return 5;
+    case TypeKind::kAtomic: return 6;
+    case TypeKind::kAttributed: return 7;
+    case TypeKind::kBTFTagAttributed: return 8;
+    case TypeKind::kBitInt: return 9;
+    case TypeKind::kBlockPointer: return 10;
+    case TypeKind::kBuiltin: return 11;
+    case TypeKind::kComplex: return 12;
+    case TypeKind::kDecltype: return 13;
+    case TypeKind::kAuto: return 14;
+    case TypeKind::kDeducedTemplateSpecialization: return 15;
+    case TypeKind::kDependentAddressSpace: return 16;
+    case TypeKind::kDependentBitInt: return 17;
+    case TypeKind::kDependentSizedExtVector: return 18;
+    case TypeKind::kDependentVector: return 19;
+    case TypeKind::kFunctionNoProto: return 20;
+    case TypeKind::kFunctionProto: return 21;
+    case TypeKind::kInjectedClassName: return 22;
+    case TypeKind::kMacroQualified: return 23;
+    case TypeKind::kConstantMatrix: return 24;
+    case TypeKind::kDependentSizedMatrix: return 25;
+    case TypeKind::kMemberPointer: return 26;
+    case TypeKind::kObjCObjectPointer: return 27;
+    case TypeKind::kObjCObject: return 28;
+    case TypeKind::kObjCInterface: return 29;
+    case TypeKind::kObjCTypeParam: return 30;
+    case TypeKind::kPackExpansion: return 31;
+    case TypeKind::kParen: return 32;
+    case TypeKind::kPipe: return 33;
+    case TypeKind::kPointer: return 34;
+    case TypeKind::kQualified: return 35;
+    case TypeKind::kLValueReference: return 36;
+    case TypeKind::kRValueReference: return 37;
+    case TypeKind::kSubstTemplateTypeParmPack: return 38;
+    case TypeKind::kSubstTemplateTypeParm: return 39;
+    case TypeKind::kEnum: return 40;
+    case TypeKind::kRecord: return 41;
+    case TypeKind::kTemplateSpecialization: return 42;
+    case TypeKind::kTemplateTypeParm: return 43;
+    case TypeKind::kTypeOfExpr: return 44;
+    case TypeKind::kTypeOf: return 45;
+    case TypeKind::kDependentName: return 46;
+    case TypeKind::kDependentTemplateSpecialization: return 47;
+    case TypeKind::kElaborated: return 48;
+    case TypeKind::kTypedef: return 49;
+    case TypeKind::kUnaryTransform: return 50;
+    case TypeKind::kUnresolvedUsing: return 51;
+    case TypeKind::kUsing: return 52;
+    case TypeKind::kVector: return 53;
+    case TypeKind::kExtVector: return 54;
+    default: break;
+  }
+  return kInvalidKindOrder;
+}
+
+}  // namespace detail
+
 class OMPDeclarativeDirectiveDecl;
 class OMPDeclarativeDirectiveValueDecl;
 class ExceptionSpecification;
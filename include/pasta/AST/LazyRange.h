@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace pasta {
+
+class ASTImpl;
+class LazyRangeBuilder;
+
+namespace detail {
+
+// Opaque storage for the position of an underlying Clang iterator.
+struct LazyRangeCursor {
+  uintptr_t words[3];
+};
+
+// Operations on the cursors of a specific kind of underlying Clang range.
+template <typename T>
+struct LazyRangeOps {
+
+  // Advance `cursor` to the next non-null element, or to `end`.
+  void (*advance)(LazyRangeCursor &cursor, const LazyRangeCursor &end);
+
+  // Are `a` and `b` at the same position?
+  bool (*equal)(const LazyRangeCursor &a, const LazyRangeCursor &b);
+
+  // Convert the element at `cursor` into a PASTA entity.
+  T (*dereference)(const std::shared_ptr<ASTImpl> &ast,
+                   const LazyRangeCursor &cursor);
+};
+
+}  // namespace detail
+
+// A lazily evaluated, forward-iterable range of entities, e.g. of the
+// declarations in a declaration context, or the children of a statement. This
+// adapts the underlying Clang range, and so iterating over it doesn't allocate
+// anything, unlike materializing the whole list into a `std::vector`.
+//
+// NOTE(pag): Iterators are self-contained, i.e. they copy what they need out
+//            of their range, and so `auto it = dc.Declarations().begin()` is
+//            fine. A `begin()` iterator also shares ownership of the AST.
+template <typename T>
+class LazyRange {
+ private:
+  friend class LazyRangeBuilder;
+
+  std::shared_ptr<ASTImpl> ast;
+  const detail::LazyRangeOps<T> *ops{nullptr};
+  detail::LazyRangeCursor first{};
+  detail::LazyRangeCursor after_last{};
+
+  inline explicit LazyRange(std::shared_ptr<ASTImpl> ast_,
+                            const detail::LazyRangeOps<T> *ops_,
+                            const detail::LazyRangeCursor &first_,
+                            const detail::LazyRangeCursor &after_last_)
+      : ast(std::move(ast_)),
+        ops(ops_),
+        first(first_),
+        after_last(after_last_) {}
+
+ public:
+  class Iterator {
+   private:
+    friend class LazyRange<T>;
+
+    std::shared_ptr<ASTImpl> ast;
+    const detail::LazyRangeOps<T> *ops{nullptr};
+    detail::LazyRangeCursor cursor{};
+    detail::LazyRangeCursor after_last{};
+
+    inline explicit Iterator(std::shared_ptr<ASTImpl> ast_,
+                             const detail::LazyRangeOps<T> *ops_,
+                             const detail::LazyRangeCursor &cursor_,
+                             const detail::LazyRangeCursor &after_last_)
+        : ast(std::move(ast_)),
+          ops(ops_),
+          cursor(cursor_),
+          after_last(after_last_) {}
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = T;
+
+    Iterator(void) = default;
+    Iterator(const Iterator &) = default;
+    Iterator(Iterator &&) noexcept = default;
+    Iterator &operator=(const Iterator &) = default;
+    Iterator &operator=(Iterator &&) noexcept = default;
+
+    inline T operator*(void) const {
+      return ops->dereference(ast, cursor);
+    }
+
+    inline Iterator &operator++(void) {
+      ops->advance(cursor, after_last);
+      return *this;
+    }
+
+    inline Iterator operator++(int) {
+      Iterator ret = *this;
+      ops->advance(cursor, after_last);
+      return ret;
+    }
+
+    inline bool operator==(const Iterator &that) const noexcept {
+      return ops == that.ops && (!ops || ops->equal(cursor, that.cursor));
+    }
+
+    inline bool operator!=(const Iterator &that) const noexcept {
+      return !(*this == that);
+    }
+  };
+
+  using iterator = Iterator;
+  using const_iterator = Iterator;
+  using value_type = T;
+
+  // An empty range.
+  LazyRange(void) = default;
+
+  LazyRange(const LazyRange<T> &) = default;
+  LazyRange(LazyRange<T> &&) noexcept = default;
+  LazyRange<T> &operator=(const LazyRange<T> &) = default;
+  LazyRange<T> &operator=(LazyRange<T> &&) noexcept = default;
+
+  inline Iterator begin(void) const noexcept {
+    return Iterator(ast, ops, first, after_last);
+  }
+
+  // NOTE(pag): The end iterator is only compared against, and so it doesn't
+  //            need to share ownership of the AST.
+  inline Iterator end(void) const noexcept {
+    return Iterator(nullptr, ops, after_last, after_last);
+  }
+
+  inline bool empty(void) const noexcept {
+    return !ops || ops->equal(first, after_last);
+  }
+
+  // Number of elements in this range. This takes linear time.
+  size_t Size(void) const {
+    size_t size = 0u;
+    for (auto it = begin(), it_end = end(); it != it_end; ++it) {
+      ++size;
+    }
+    return size;
+  }
+
+  // NOTE(pag): The below let code that expected the accessors returning this
+  //            range to return a `std::vector` continue to work, albeit with
+  //            different costs: `size()`, `operator[]`, and `back()` take
+  //            linear time, as they walk the range from its beginning.
+  inline size_t size(void) const {
+    return Size();
+  }
+
+  // Return the `index`th element. `index` must be less than `size()`.
+  T operator[](size_t index) const {
+    auto it = begin();
+    for (; index; --index) {
+      ++it;
+    }
+    return *it;
+  }
+
+  // Return the first element. The range must not be empty.
+  inline T front(void) const {
+    return *begin();
+  }
+
+  // Return the last element. The range must not be empty.
+  T back(void) const {
+    auto last = begin();
+    for (auto it = last, it_end = end(); ++it != it_end; ) {
+      last = it;
+    }
+    return *last;
+  }
+
+  // Materialize this range.
+  std::vector<T> to_vector(void) const {
+    std::vector<T> ret;
+    for (auto it = begin(), it_end = end(); it != it_end; ++it) {
+      ret.emplace_back(*it);
+    }
+    return ret;
+  }
+
+  inline operator std::vector<T>(void) const {
+    return to_vector();
+  }
+};
+
+}  // namespace pasta
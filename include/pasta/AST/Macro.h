@@ -9,8 +9,11 @@
 #include <memory>
 #include <optional>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
+#include <pasta/Util/MacroDefinition.h>
+
 namespace pasta {
 
 class AST;
@@ -99,6 +102,7 @@ enum class TokenKind : unsigned short;
 class Macro {
  protected:
   friend class AST;
+  friend class BorrowedMacro;
   friend class MacroIterator;
   friend class MacroRange;
   friend class PatchedMacroTracker;
@@ -341,6 +345,13 @@ class DefineMacroDirective final : public MacroDirective {
 
   // Parameters of this macro definition.
   MacroRange Parameters(void) const noexcept;
+
+  // The canonical definition of this macro. Equivalent definitions, i.e. ones
+  // with the same name, parameters, and body spelling, from ASTs sharing the
+  // same `FileManager` share the same canonical definition. This returns
+  // `std::nullopt` unless `FileManager::EnableMacroDefinitionSharing` was
+  // called before this macro's AST was made.
+  std::optional<MacroDefinition> CanonicalDefinition(void) const noexcept;
 };
 
 static_assert(sizeof(DefineMacroDirective) == sizeof(Macro));
@@ -463,6 +474,17 @@ class MacroExpansion final : public MacroSubstitution {
   std::map<MacroParameter, std::vector<pasta::Stmt>>
   AlignedParameterSubstitutions(const pasta::Stmt &stmt) const noexcept;
 
+  // Like the above, but rather than finding the aligned substitutions of each
+  // statement in the subtree of `stmt`, this looks them up in `stmt_subs`,
+  // keyed by `Stmt::RawStmt`, e.g. as found for all statements at once by the
+  // static `TokenRange::AlignedSubstitutions`. Statements missing from
+  // `stmt_subs` align with nothing.
+  std::map<MacroParameter, std::vector<pasta::Stmt>>
+  AlignedParameterSubstitutions(
+      const pasta::Stmt &stmt,
+      const std::unordered_map<const void *, std::vector<MacroSubstitution>>
+          &stmt_subs) const noexcept;
+
   // Maps each of the macro's parameters to the number of times it is used in
   // the expansion.
   std::map<MacroParameter, unsigned>
@@ -638,6 +660,7 @@ class MacroRange {
   friend class DefineMacroDirective;
   friend class IncludeLikeMacroDirective;
   friend class MacroToken;
+  friend class PreprocessedTranslationUnit;
 
   std::shared_ptr<ASTImpl> ast;
   const void *first;
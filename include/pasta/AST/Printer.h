@@ -4,9 +4,11 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <pasta/Util/Result.h>
+#include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
@@ -40,6 +42,7 @@ PASTA_FOR_EACH_TOKEN_CONTEXT_KIND(PASTA_FORWARD_DECLARE_CLASS)
 }  // namespace clang
 namespace pasta {
 
+class AlignmentSessionImpl;
 class AST;
 class ASTImpl;
 class ClassTemplateDecl;
@@ -52,6 +55,7 @@ class PrintedTokenIterator;
 class PrintedTokenImpl;
 class PrintedTokenRange;
 class PrintedTokenRangeImpl;
+class PrintedTokenRopeImpl;
 class Stmt;
 class TagDecl;
 class TemplateDecl;
@@ -321,6 +325,11 @@ class PrintingPolicy {
   // to a function, which then decays into a pointer.
   virtual bool ShouldPrintOriginalTypeOfDecayedType(void) const;
 
+  // Should the tokens printed for a type be recorded, and then re-used when
+  // the same type is printed again within the same printing request? This
+  // never changes what is printed, and is only worth disabling for testing.
+  virtual bool ShouldCachePrintedTypes(void) const;
+
   virtual bool ShouldPrintTemplate(const TemplateDecl &) const;
   
   virtual bool ShouldPrintTemplate(
@@ -337,6 +346,13 @@ class PrintingPolicy {
 
   virtual bool ShouldPrintSpecialization(
       const VarTemplateDecl &, const VarTemplateSpecializationDecl &) const;
+
+  // Returns a key summarizing all printing decisions made by this policy, or
+  // `std::nullopt` if printed token ranges produced with this policy must not
+  // be cached (see `AST::EnablePrintCache`). Any two policies with the same
+  // key must make identical decisions. By default, only an unspecialized
+  // `PrintingPolicy` has a key.
+  virtual std::optional<uint64_t> CacheKey(void) const;
 };
 
 class ProxyPrintingPolicy : public PrintingPolicy {
@@ -354,6 +370,7 @@ class ProxyPrintingPolicy : public PrintingPolicy {
   bool ShouldPrintConstantExpressionsInTypes(void) const override;
   bool ShouldPrintOriginalTypeOfAdjustedType(void) const override;
   bool ShouldPrintOriginalTypeOfDecayedType(void) const override;
+  bool ShouldCachePrintedTypes(void) const override;
 
   bool ShouldPrintTemplate(const TemplateDecl &) const override;
 
@@ -376,6 +393,29 @@ class ProxyPrintingPolicy : public PrintingPolicy {
   bool ShouldPrintSpecialization(
       const VarTemplateDecl &,
       const VarTemplateSpecializationDecl &) const override;
+
+  std::optional<uint64_t> CacheKey(void) const override;
+};
+
+// Receives printed tokens in chunks. See `PrintedTokenRange::Stream`. Each
+// chunk is a self-contained printed token range, and is not retained after
+// `Accept` returns unless the sink itself holds on to it.
+class PrintedTokenSink {
+ public:
+  virtual ~PrintedTokenSink(void);
+
+  // Called with each printed chunk. The default implementation renders the
+  // tokens of `tokens` to text (including leading whitespace), and passes the
+  // text along to `AcceptText`.
+  virtual void Accept(const PrintedTokenRange &tokens);
+
+  // Called with the rendered text of each printed chunk.
+  virtual void AcceptText(std::string_view text);
+
+ protected:
+
+  // Re-used across calls to `Accept` to render chunks to text.
+  std::string text_buffer;
 };
 
 class PrintedTokenRangeImpl;
@@ -410,8 +450,27 @@ class PrintedTokenRange {
   static PrintedTokenRange Create(
       const Type &type_, const PrintingPolicy &pp_=PrintingPolicy());
 
+  // Print `decl_`, passing the printed tokens to `sink_` in chunks. If
+  // `decl_` is a translation unit, then each top-level declaration (or group
+  // of declarations that must be printed together, e.g. `struct {int x;} a;`)
+  // is printed into its own chunk, which is passed to `sink_` as soon as it
+  // is finished. Peak memory usage is thus bounded by the largest top-level
+  // declaration, and not by the whole translation unit. Otherwise, `decl_` is
+  // printed into a single chunk, as if by `Create`.
+  static void Stream(const Decl &decl_, PrintedTokenSink &sink_,
+                     const PrintingPolicy &pp_=PrintingPolicy());
+
+  // Print the top-level declarations of `ast_`'s translation unit using up to
+  // `num_threads_` threads, and concatenate the printed declarations together
+  // in order. The printing policy `pp_` must be safe to use concurrently from
+  // multiple threads.
+  static PrintedTokenRange PrintTopLevelDecls(
+      const AST &ast_, unsigned num_threads_,
+      const PrintingPolicy &pp_=PrintingPolicy());
+
   // Create a new printed token range by concatenating two printed token ranges
-  // together.
+  // together. This copies the tokens of both `a` and `b`; use
+  // `PrintedTokenRope` when assembling a range out of many smaller ranges.
   //
   // Returns `std::nullopt` if `a` and/or `b` have corresponding ASTs that don't
   // match.
@@ -423,10 +482,30 @@ class PrintedTokenRange {
   // mechanism of relating parsedtokens back to AST nodes, when `with_locs` is
   // derived from `Adopt` below.
   //
-  // NOTE(pag): Both `with_locs` and `with_contexts` are mutated in-place.
+  // NOTE(pag): Both `with_locs` and `with_contexts` are mutated in-place. When
+  //            aligning many ranges, prefer re-using an `AlignmentSession`.
   static std::optional<std::string> Align(PrintedTokenRange &with_locs,
                                           PrintedTokenRange &with_contexts);
 
+  // Align every top-level declaration of `ast_`'s translation unit, using up to
+  // `num_threads_` threads, and concatenate the aligned ranges together in
+  // order. Each top-level declaration's parsed tokens are adopted (as if by
+  // `Adopt`), then aligned (as if by `Align`) with the declaration printed
+  // using `pp_`. Declarations whose parsed tokens overlap, e.g. `a` and `b` in
+  // `struct {int x;} a, b;`, are aligned together. Parsed tokens between the
+  // top-level declarations, e.g. stray semicolons, are adopted as-is, so that
+  // the returned range covers every parsed token of the translation unit. If
+  // the parsed tokens of some top-level declaration can't be found, then the
+  // whole translation unit is aligned at once instead.
+  //
+  // If a declaration fails to align, then its adopted tokens are used as-is,
+  // and the error is added to `errors_`, if it is non-null. The printing policy
+  // `pp_` must be safe to use concurrently from multiple threads.
+  static PrintedTokenRange AlignTopLevelDecls(
+      const AST &ast_, unsigned num_threads_,
+      const PrintingPolicy &pp_=PrintingPolicy(),
+      std::vector<std::string> *errors_=nullptr);
+
   // Create a new printed token range, where the token data is taken from `a`.
   // The only token contexts in an adopted range are AST contexts. The only
   // tokens in a printed token range are file tokens and complete macro
@@ -482,10 +561,14 @@ class PrintedTokenRange {
   }
 
  private:
+  friend class AlignmentSession;
   friend class AST;
   friend class ASTImpl;
   friend class DeclPrinter;
+  friend class PrintCache;
   friend class PrintedTokenRangeImpl;
+  friend class PrintedTokenRope;
+  friend class PrintedTokenSink;
 
   PrintedTokenRange(void) = delete;
 
@@ -521,6 +604,94 @@ class PrintedTokenRange {
   PrintedTokenImpl *after_last;
 };
 
+// Re-usable state for aligning many pairs of printed token ranges, e.g. each
+// top-level declaration of a translation unit. The scratch buffers used during
+// alignment are kept between calls to `Align`, and so they grow to fit the
+// largest pair of ranges aligned so far, rather than being re-allocated for
+// every pair. `PrintedTokenRange::Align` uses a fresh session for each call.
+//
+// NOTE(pag): A session is not thread-safe; use one session per thread.
+class AlignmentSession {
+ public:
+  AlignmentSession(void);
+  ~AlignmentSession(void);
+  AlignmentSession(AlignmentSession &&) noexcept;
+  AlignmentSession &operator=(AlignmentSession &&) noexcept;
+
+  // Align the token locations from `with_locs` with the token contexts from
+  // `with_contexts`. This behaves like `PrintedTokenRange::Align`.
+  std::optional<std::string> Align(PrintedTokenRange &with_locs,
+                                   PrintedTokenRange &with_contexts);
+
+  // Enable or disable anchoring the tokens left unmatched by the structural
+  // phases of alignment on the tokens that are unique to both sides, before
+  // greedily matching whatever remains. This is enabled by default. It speeds
+  // up alignment of ranges with many repeated tokens, and is meant to produce
+  // the same alignments as the greedy matching alone.
+  void EnableAnchoredMatching(bool enable);
+
+ private:
+  AlignmentSession(const AlignmentSession &) = delete;
+  AlignmentSession &operator=(const AlignmentSession &) = delete;
+
+  std::unique_ptr<AlignmentSessionImpl> impl;
+};
+
+// A lazily concatenated sequence of printed token ranges. Concatenating ropes
+// takes constant time, and doesn't copy any tokens, token contexts, or token
+// data; instead, a rope references its segments. The segments are copied
+// into a single contiguous printed token range only when `Flatten` is first
+// called.
+class PrintedTokenRope {
+ public:
+  PrintedTokenRope(const PrintedTokenRange &range);
+  PrintedTokenRope(const PrintedTokenRope &) = default;
+  PrintedTokenRope(PrintedTokenRope &&) noexcept = default;
+  PrintedTokenRope &operator=(const PrintedTokenRope &) = default;
+  PrintedTokenRope &operator=(PrintedTokenRope &&) noexcept = default;
+
+  // Create a new rope that references the segments of `a` followed by the
+  // segments of `b`.
+  //
+  // Returns `std::nullopt` if `a` and/or `b` have corresponding ASTs that don't
+  // match.
+  static std::optional<PrintedTokenRope>
+  Concatenate(const PrintedTokenRope &a, const PrintedTokenRope &b);
+
+  // Number of tokens in this rope.
+  size_t Size(void) const noexcept;
+
+  inline size_t size(void) const noexcept {
+    return Size();
+  }
+
+  inline bool empty(void) const noexcept {
+    return !Size();
+  }
+
+  // Number of non-empty printed token ranges referenced by this rope.
+  size_t NumSegments(void) const noexcept;
+
+  // Return the non-empty printed token ranges referenced by this rope, in
+  // order. Iterating over the tokens of each segment visits the same tokens
+  // as iterating over `Flatten()`, but without copying them.
+  std::vector<PrintedTokenRange> Segments(void) const;
+
+  // Return a single contiguous printed token range containing all tokens in
+  // this rope. The flattened range is computed once, and then shared, until a
+  // rope containing this rope is flattened, at which point it is released.
+  PrintedTokenRange Flatten(void) const;
+
+ private:
+  PrintedTokenRope(void) = delete;
+
+  inline explicit PrintedTokenRope(
+      std::shared_ptr<const PrintedTokenRopeImpl> impl_)
+      : impl(std::move(impl_)) {}
+
+  std::shared_ptr<const PrintedTokenRopeImpl> impl;
+};
+
 } // namespace pasta
 namespace std {
 
@@ -12,6 +12,7 @@
 #include <variant>
 #include <vector>
 #include <pasta/Util/Compiler.h>
+#include "LazyRange.h"
 #include "Attr.h"
 #include "DeclHead.h"
 
@@ -291,13 +292,275 @@ class StmtVisitor {
   virtual void VisitCXXDynamicCastExpr(const CXXDynamicCastExpr &);
 };
 
+struct StmtSnapshot;
+struct SwitchCaseSnapshot;
+struct SwitchStmtSnapshot;
+struct ValueStmtSnapshot;
+struct WhileStmtSnapshot;
+struct AsmStmtSnapshot;
+struct AttributedStmtSnapshot;
+struct BreakStmtSnapshot;
+struct CXXCatchStmtSnapshot;
+struct CXXForRangeStmtSnapshot;
+struct CXXTryStmtSnapshot;
+struct CapturedStmtSnapshot;
+struct CaseStmtSnapshot;
+struct CompoundStmtSnapshot;
+struct ContinueStmtSnapshot;
+struct CoreturnStmtSnapshot;
+struct CoroutineBodyStmtSnapshot;
+struct DeclStmtSnapshot;
+struct DefaultStmtSnapshot;
+struct DoStmtSnapshot;
+struct ExprSnapshot;
+struct ExpressionTraitExprSnapshot;
+struct ExtVectorElementExprSnapshot;
+struct FixedPointLiteralSnapshot;
+struct FloatingLiteralSnapshot;
+struct ForStmtSnapshot;
+struct FullExprSnapshot;
+struct FunctionParmPackExprSnapshot;
+struct GCCAsmStmtSnapshot;
+struct GNUNullExprSnapshot;
+struct GenericSelectionExprSnapshot;
+struct GotoStmtSnapshot;
+struct IfStmtSnapshot;
+struct ImaginaryLiteralSnapshot;
+struct ImplicitValueInitExprSnapshot;
+struct IndirectGotoStmtSnapshot;
+struct InitListExprSnapshot;
+struct IntegerLiteralSnapshot;
+struct LabelStmtSnapshot;
+struct LambdaExprSnapshot;
+struct MSAsmStmtSnapshot;
+struct MSDependentExistsStmtSnapshot;
+struct MSPropertyRefExprSnapshot;
+struct MSPropertySubscriptExprSnapshot;
+struct MaterializeTemporaryExprSnapshot;
+struct MatrixSubscriptExprSnapshot;
+struct MemberExprSnapshot;
+struct NoInitExprSnapshot;
+struct NullStmtSnapshot;
+struct OMPArraySectionExprSnapshot;
+struct OMPArrayShapingExprSnapshot;
+struct OMPCanonicalLoopSnapshot;
+struct OMPExecutableDirectiveSnapshot;
+struct OMPFlushDirectiveSnapshot;
+struct OMPInteropDirectiveSnapshot;
+struct OMPIteratorExprSnapshot;
+struct OMPLoopBasedDirectiveSnapshot;
+struct OMPLoopDirectiveSnapshot;
+struct OMPLoopTransformationDirectiveSnapshot;
+struct OMPMaskedDirectiveSnapshot;
+struct OMPMaskedTaskLoopDirectiveSnapshot;
+struct OMPMaskedTaskLoopSimdDirectiveSnapshot;
+struct OMPMasterDirectiveSnapshot;
+struct OMPMasterTaskLoopDirectiveSnapshot;
+struct OMPMasterTaskLoopSimdDirectiveSnapshot;
+struct OMPMetaDirectiveSnapshot;
+struct OMPOrderedDirectiveSnapshot;
+struct OMPParallelDirectiveSnapshot;
+struct OMPParallelForDirectiveSnapshot;
+struct OMPParallelForSimdDirectiveSnapshot;
+struct OMPParallelGenericLoopDirectiveSnapshot;
+struct OMPParallelMaskedDirectiveSnapshot;
+struct OMPParallelMaskedTaskLoopDirectiveSnapshot;
+struct OMPParallelMaskedTaskLoopSimdDirectiveSnapshot;
+struct OMPParallelMasterDirectiveSnapshot;
+struct OMPParallelMasterTaskLoopDirectiveSnapshot;
+struct OMPParallelMasterTaskLoopSimdDirectiveSnapshot;
+struct OMPParallelSectionsDirectiveSnapshot;
+struct OMPScanDirectiveSnapshot;
+struct OMPSectionDirectiveSnapshot;
+struct OMPSectionsDirectiveSnapshot;
+struct OMPSimdDirectiveSnapshot;
+struct OMPSingleDirectiveSnapshot;
+struct OMPTargetDataDirectiveSnapshot;
+struct OMPTargetDirectiveSnapshot;
+struct OMPTargetEnterDataDirectiveSnapshot;
+struct OMPTargetExitDataDirectiveSnapshot;
+struct OMPTargetParallelDirectiveSnapshot;
+struct OMPTargetParallelForDirectiveSnapshot;
+struct OMPTargetParallelForSimdDirectiveSnapshot;
+struct OMPTargetParallelGenericLoopDirectiveSnapshot;
+struct OMPTargetSimdDirectiveSnapshot;
+struct OMPTargetTeamsDirectiveSnapshot;
+struct OMPTargetTeamsDistributeDirectiveSnapshot;
+struct OMPTargetTeamsDistributeParallelForDirectiveSnapshot;
+struct OMPTargetTeamsDistributeParallelForSimdDirectiveSnapshot;
+struct OMPTargetTeamsDistributeSimdDirectiveSnapshot;
+struct OMPTargetTeamsGenericLoopDirectiveSnapshot;
+struct OMPTargetUpdateDirectiveSnapshot;
+struct OMPTaskDirectiveSnapshot;
+struct OMPTaskLoopDirectiveSnapshot;
+struct OMPTaskLoopSimdDirectiveSnapshot;
+struct OMPTaskgroupDirectiveSnapshot;
+struct OMPTaskwaitDirectiveSnapshot;
+struct OMPTaskyieldDirectiveSnapshot;
+struct OMPTeamsDirectiveSnapshot;
+struct OMPTeamsDistributeDirectiveSnapshot;
+struct OMPTeamsDistributeParallelForDirectiveSnapshot;
+struct OMPTeamsDistributeParallelForSimdDirectiveSnapshot;
+struct OMPTeamsDistributeSimdDirectiveSnapshot;
+struct OMPTeamsGenericLoopDirectiveSnapshot;
+struct OMPTileDirectiveSnapshot;
+struct OMPUnrollDirectiveSnapshot;
+struct ObjCArrayLiteralSnapshot;
+struct ObjCAtCatchStmtSnapshot;
+struct ObjCAtFinallyStmtSnapshot;
+struct ObjCAtSynchronizedStmtSnapshot;
+struct ObjCAtThrowStmtSnapshot;
+struct ObjCAtTryStmtSnapshot;
+struct ObjCAutoreleasePoolStmtSnapshot;
+struct ObjCAvailabilityCheckExprSnapshot;
+struct ObjCBoolLiteralExprSnapshot;
+struct ObjCBoxedExprSnapshot;
+struct ObjCDictionaryLiteralSnapshot;
+struct ObjCEncodeExprSnapshot;
+struct ObjCForCollectionStmtSnapshot;
+struct ObjCIndirectCopyRestoreExprSnapshot;
+struct ObjCIsaExprSnapshot;
+struct ObjCIvarRefExprSnapshot;
+struct ObjCMessageExprSnapshot;
+struct ObjCPropertyRefExprSnapshot;
+struct ObjCProtocolExprSnapshot;
+struct ObjCSelectorExprSnapshot;
+struct ObjCStringLiteralSnapshot;
+struct ObjCSubscriptRefExprSnapshot;
+struct OffsetOfExprSnapshot;
+struct OpaqueValueExprSnapshot;
+struct OverloadExprSnapshot;
+struct PackExpansionExprSnapshot;
+struct ParenExprSnapshot;
+struct ParenListExprSnapshot;
+struct PredefinedExprSnapshot;
+struct PseudoObjectExprSnapshot;
+struct RecoveryExprSnapshot;
+struct RequiresExprSnapshot;
+struct ReturnStmtSnapshot;
+struct SEHExceptStmtSnapshot;
+struct SEHFinallyStmtSnapshot;
+struct SEHLeaveStmtSnapshot;
+struct SEHTryStmtSnapshot;
+struct SYCLUniqueStableNameExprSnapshot;
+struct ShuffleVectorExprSnapshot;
+struct SizeOfPackExprSnapshot;
+struct SourceLocExprSnapshot;
+struct StmtExprSnapshot;
+struct StringLiteralSnapshot;
+struct SubstNonTypeTemplateParmExprSnapshot;
+struct SubstNonTypeTemplateParmPackExprSnapshot;
+struct TypeTraitExprSnapshot;
+struct TypoExprSnapshot;
+struct UnaryExprOrTypeTraitExprSnapshot;
+struct UnaryOperatorSnapshot;
+struct UnresolvedLookupExprSnapshot;
+struct UnresolvedMemberExprSnapshot;
+struct VAArgExprSnapshot;
+struct AbstractConditionalOperatorSnapshot;
+struct AddrLabelExprSnapshot;
+struct ArrayInitIndexExprSnapshot;
+struct ArrayInitLoopExprSnapshot;
+struct ArraySubscriptExprSnapshot;
+struct ArrayTypeTraitExprSnapshot;
+struct AsTypeExprSnapshot;
+struct AtomicExprSnapshot;
+struct BinaryConditionalOperatorSnapshot;
+struct BinaryOperatorSnapshot;
+struct BlockExprSnapshot;
+struct CXXBindTemporaryExprSnapshot;
+struct CXXBoolLiteralExprSnapshot;
+struct CXXConstructExprSnapshot;
+struct CXXDefaultArgExprSnapshot;
+struct CXXDefaultInitExprSnapshot;
+struct CXXDeleteExprSnapshot;
+struct CXXDependentScopeMemberExprSnapshot;
+struct CXXFoldExprSnapshot;
+struct CXXInheritedCtorInitExprSnapshot;
+struct CXXNewExprSnapshot;
+struct CXXNoexceptExprSnapshot;
+struct CXXNullPtrLiteralExprSnapshot;
+struct CXXParenListInitExprSnapshot;
+struct CXXPseudoDestructorExprSnapshot;
+struct CXXRewrittenBinaryOperatorSnapshot;
+struct CXXScalarValueInitExprSnapshot;
+struct CXXStdInitializerListExprSnapshot;
+struct CXXTemporaryObjectExprSnapshot;
+struct CXXThisExprSnapshot;
+struct CXXThrowExprSnapshot;
+struct CXXTypeidExprSnapshot;
+struct CXXUnresolvedConstructExprSnapshot;
+struct CXXUuidofExprSnapshot;
+struct CallExprSnapshot;
+struct CastExprSnapshot;
+struct CharacterLiteralSnapshot;
+struct ChooseExprSnapshot;
+struct CompoundAssignOperatorSnapshot;
+struct CompoundLiteralExprSnapshot;
+struct ConceptSpecializationExprSnapshot;
+struct ConditionalOperatorSnapshot;
+struct ConstantExprSnapshot;
+struct ConvertVectorExprSnapshot;
+struct CoroutineSuspendExprSnapshot;
+struct CoyieldExprSnapshot;
+struct DeclRefExprSnapshot;
+struct DependentCoawaitExprSnapshot;
+struct DependentScopeDeclRefExprSnapshot;
+struct DesignatedInitExprSnapshot;
+struct DesignatedInitUpdateExprSnapshot;
+struct ExplicitCastExprSnapshot;
+struct ExprWithCleanupsSnapshot;
+struct ImplicitCastExprSnapshot;
+struct OMPAtomicDirectiveSnapshot;
+struct OMPBarrierDirectiveSnapshot;
+struct OMPCancelDirectiveSnapshot;
+struct OMPCancellationPointDirectiveSnapshot;
+struct OMPCriticalDirectiveSnapshot;
+struct OMPDepobjDirectiveSnapshot;
+struct OMPDispatchDirectiveSnapshot;
+struct OMPDistributeDirectiveSnapshot;
+struct OMPDistributeParallelForDirectiveSnapshot;
+struct OMPDistributeParallelForSimdDirectiveSnapshot;
+struct OMPDistributeSimdDirectiveSnapshot;
+struct OMPErrorDirectiveSnapshot;
+struct OMPForDirectiveSnapshot;
+struct OMPForSimdDirectiveSnapshot;
+struct OMPGenericLoopDirectiveSnapshot;
+struct ObjCBridgedCastExprSnapshot;
+struct UserDefinedLiteralSnapshot;
+struct BuiltinBitCastExprSnapshot;
+struct CStyleCastExprSnapshot;
+struct CUDAKernelCallExprSnapshot;
+struct CXXFunctionalCastExprSnapshot;
+struct CXXMemberCallExprSnapshot;
+struct CXXNamedCastExprSnapshot;
+struct CXXOperatorCallExprSnapshot;
+struct CXXReinterpretCastExprSnapshot;
+struct CXXStaticCastExprSnapshot;
+struct CoawaitExprSnapshot;
+struct CXXAddrspaceCastExprSnapshot;
+struct CXXConstCastExprSnapshot;
+struct CXXDynamicCastExprSnapshot;
+
 class Stmt {
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(Stmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {0, 233};
+  friend class BorrowedStmt;
   friend class TokenContext;
   static std::optional<::pasta::Stmt> From(const TokenContext &);
   std::vector<::pasta::MacroSubstitution> AlignedSubstitutions(bool heuristic = true) const noexcept;
   bool AlignsWith(::pasta::Macro &) const noexcept;
+  std::optional<::pasta::Stmt> Parent(void) const;
+  std::optional<::pasta::Decl> ParentDeclaration(void) const;
+
+  // Returns `true` if this is a `T`, or is derived from `T`.
+  template <typename T>
+  inline bool Is(void) const noexcept {
+    return ::pasta::detail::IsInKindRange(
+        ::pasta::detail::StmtKindOrder(kind), T::kKindRange);
+  }
+
   PASTA_DECLARE_DERIVED_OPERATORS(Stmt, AbstractConditionalOperator)
   PASTA_DECLARE_DERIVED_OPERATORS(Stmt, AddrLabelExpr)
   PASTA_DECLARE_DERIVED_OPERATORS(Stmt, ArrayInitIndexExpr)
@@ -547,14 +810,17 @@ class Stmt {
   PASTA_DECLARE_DERIVED_OPERATORS(Stmt, ValueStmt)
   PASTA_DECLARE_DERIVED_OPERATORS(Stmt, WhileStmt)
   ::pasta::Stmt IgnoreContainers(void) const;
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   int64_t ID(void) const;
   ::pasta::TokenRange Tokens(void) const;
-  ::pasta::StmtKind Kind(void) const;
+  inline ::pasta::StmtKind Kind(void) const noexcept {
+    return kind;
+  }
   std::string_view KindName(void) const;
   ::pasta::Stmt StripLabelLikeStatements(void) const;
+  ::pasta::StmtSnapshot Snapshot(void) const;
   inline bool operator==(const Stmt &that) const noexcept {
     return u.opaque == that.u.opaque;
   }
@@ -827,10 +1093,17 @@ class Stmt {
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(Stmt)
 };
 
+struct StmtSnapshot {
+  uint32_t begin_token;
+  uint32_t end_token;
+  int64_t id;
+};
+
 class SwitchCase : public Stmt {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(SwitchCase)
+  static constexpr ::pasta::detail::KindRange kKindRange = {103, 105};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, SwitchCase)
   PASTA_DECLARE_DERIVED_OPERATORS(SwitchCase, CaseStmt)
   PASTA_DECLARE_DERIVED_OPERATORS(SwitchCase, DefaultStmt)
@@ -840,18 +1113,25 @@ class SwitchCase : public Stmt {
   ::pasta::Token KeywordToken(void) const;
   std::optional<::pasta::SwitchCase> NextSwitchCase(void) const;
   ::pasta::Stmt SubStatement(void) const;
+  ::pasta::SwitchCaseSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(SwitchCase)
 };
 
+struct SwitchCaseSnapshot : public StmtSnapshot {
+  uint32_t colon_token;
+  uint32_t keyword_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(SwitchCase));
 
 class SwitchStmt : public Stmt {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(SwitchStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {105, 106};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, SwitchStmt)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Stmt Body(void) const;
   ::pasta::Expr Condition(void) const;
@@ -866,16 +1146,27 @@ class SwitchStmt : public Stmt {
   bool HasInitializerStorage(void) const;
   bool HasVariableStorage(void) const;
   bool IsAllEnumCasesCovered(void) const;
+  ::pasta::SwitchStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(SwitchStmt)
 };
 
+struct SwitchStmtSnapshot : public StmtSnapshot {
+  uint32_t l_paren_token;
+  uint32_t r_paren_token;
+  uint32_t switch_token;
+  bool has_initializer_storage;
+  bool has_variable_storage;
+  bool is_all_enum_cases_covered;
+};
+
 static_assert(sizeof(Stmt) == sizeof(SwitchStmt));
 
 class ValueStmt : public Stmt {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ValueStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {106, 232};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ValueStmt)
   PASTA_DECLARE_DERIVED_OPERATORS(ValueStmt, AbstractConditionalOperator)
   PASTA_DECLARE_DERIVED_OPERATORS(ValueStmt, AddrLabelExpr)
@@ -1012,18 +1303,23 @@ class ValueStmt : public Stmt {
   PASTA_DECLARE_DERIVED_OPERATORS(ValueStmt, UserDefinedLiteral)
   PASTA_DECLARE_DERIVED_OPERATORS(ValueStmt, VAArgExpr)
   std::optional<::pasta::Expr> ExpressionStatement(void) const;
+  ::pasta::ValueStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ValueStmt)
 };
 
+struct ValueStmtSnapshot : public StmtSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(ValueStmt));
 
 class WhileStmt : public Stmt {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(WhileStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {232, 233};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, WhileStmt)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Stmt Body(void) const;
   ::pasta::Expr Condition(void) const;
@@ -1034,20 +1330,29 @@ class WhileStmt : public Stmt {
   ::pasta::Token RParenToken(void) const;
   ::pasta::Token WhileToken(void) const;
   bool HasVariableStorage(void) const;
+  ::pasta::WhileStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(WhileStmt)
 };
 
+struct WhileStmtSnapshot : public StmtSnapshot {
+  uint32_t l_paren_token;
+  uint32_t r_paren_token;
+  uint32_t while_token;
+  bool has_variable_storage;
+};
+
 static_assert(sizeof(Stmt) == sizeof(WhileStmt));
 
 class AsmStmt : public Stmt {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(AsmStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {0, 2};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, AsmStmt)
   PASTA_DECLARE_DERIVED_OPERATORS(AsmStmt, GCCAsmStmt)
   PASTA_DECLARE_DERIVED_OPERATORS(AsmStmt, MSAsmStmt)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   std::string GenerateAssemblyString(void) const;
   ::pasta::Token AssemblyToken(void) const;
   ::pasta::Token BeginToken(void) const;
@@ -1061,20 +1366,31 @@ class AsmStmt : public Stmt {
   uint32_t NumPlusOperands(void) const;
   // OutputConstraint: (llvm::StringRef)
   // OutputExpression: (const clang::Expr *)
-  std::vector<::pasta::Expr> Inputs(void) const;
+  ::pasta::LazyRange<::pasta::Expr> Inputs(void) const;
   // IsOutputPlusConstraint: (bool)
   bool IsSimple(void) const;
   bool IsVolatile(void) const;
-  std::vector<::pasta::Expr> Outputs(void) const;
+  ::pasta::LazyRange<::pasta::Expr> Outputs(void) const;
   std::vector<std::string_view> OutputConstraints(void) const;
   std::vector<::pasta::Expr> OutputExpressions(void) const;
   std::vector<std::string_view> InputConstraints(void) const;
   std::vector<::pasta::Expr> InputExpressions(void) const;
   std::vector<std::string_view> Clobbers(void) const;
+  ::pasta::AsmStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(AsmStmt)
 };
 
+struct AsmStmtSnapshot : public StmtSnapshot {
+  uint32_t assembly_token;
+  uint32_t num_clobbers;
+  uint32_t num_inputs;
+  uint32_t num_outputs;
+  uint32_t num_plus_operands;
+  bool is_simple;
+  bool is_volatile;
+};
+
 static_assert(sizeof(Stmt) == sizeof(AsmStmt));
 
 class AttributedStmt : public ValueStmt {
@@ -1082,59 +1398,78 @@ class AttributedStmt : public ValueStmt {
   using ValueStmt::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(AttributedStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {106, 107};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, AttributedStmt)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, AttributedStmt)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token AttributeToken(void) const;
   std::vector<::pasta::Attr> Attributes(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Stmt SubStatement(void) const;
+  ::pasta::AttributedStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(AttributedStmt)
 };
 
+struct AttributedStmtSnapshot : public ValueStmtSnapshot {
+  uint32_t attribute_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(AttributedStmt));
 
 class BreakStmt : public Stmt {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(BreakStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {2, 3};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, BreakStmt)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token BreakToken(void) const;
   ::pasta::Token EndToken(void) const;
+  ::pasta::BreakStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(BreakStmt)
 };
 
+struct BreakStmtSnapshot : public StmtSnapshot {
+  uint32_t break_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(BreakStmt));
 
 class CXXCatchStmt : public Stmt {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXCatchStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {3, 4};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXCatchStmt)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token CatchToken(void) const;
   std::optional<::pasta::Type> CaughtType(void) const;
   ::pasta::Token EndToken(void) const;
   std::optional<::pasta::VarDecl> ExceptionDeclaration(void) const;
   ::pasta::Stmt HandlerBlock(void) const;
+  ::pasta::CXXCatchStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXCatchStmt)
 };
 
+struct CXXCatchStmtSnapshot : public StmtSnapshot {
+  uint32_t catch_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CXXCatchStmt));
 
 class CXXForRangeStmt : public Stmt {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXForRangeStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {4, 5};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXForRangeStmt)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   std::optional<::pasta::DeclStmt> BeginStatement(void) const;
   ::pasta::Stmt Body(void) const;
@@ -1151,18 +1486,27 @@ class CXXForRangeStmt : public Stmt {
   ::pasta::Token RParenToken(void) const;
   ::pasta::Expr RangeInitializer(void) const;
   ::pasta::DeclStmt RangeStatement(void) const;
+  ::pasta::CXXForRangeStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXForRangeStmt)
 };
 
+struct CXXForRangeStmtSnapshot : public StmtSnapshot {
+  uint32_t coawait_token;
+  uint32_t colon_token;
+  uint32_t for_token;
+  uint32_t r_paren_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CXXForRangeStmt));
 
 class CXXTryStmt : public Stmt {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXTryStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {5, 6};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXTryStmt)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   // Handler: (const clang::CXXCatchStmt *)
@@ -1170,21 +1514,28 @@ class CXXTryStmt : public Stmt {
   ::pasta::CompoundStmt TryBlock(void) const;
   ::pasta::Token TryToken(void) const;
   std::vector<::pasta::CXXCatchStmt> Handlers(void) const;
+  ::pasta::CXXTryStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXTryStmt)
 };
 
+struct CXXTryStmtSnapshot : public StmtSnapshot {
+  uint32_t num_handlers;
+  uint32_t try_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CXXTryStmt));
 
 class CapturedStmt : public Stmt {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CapturedStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {6, 7};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CapturedStmt)
   // CaptureInitializers: (llvm::iterator_range<clang::Expr *const *>)
   // Captures: (llvm::iterator_range<const clang::CapturedStmt::Capture *>)
   // CapturesVariable: (bool)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::CapturedDecl CapturedDeclaration(void) const;
   ::pasta::RecordDecl CapturedRecordDeclaration(void) const;
@@ -1192,10 +1543,15 @@ class CapturedStmt : public Stmt {
   ::pasta::Stmt CapturedStatement(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::TokenRange Tokens(void) const;
+  ::pasta::CapturedStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CapturedStmt)
 };
 
+struct CapturedStmtSnapshot : public StmtSnapshot {
+  enum CapturedRegionKind captured_region_kind;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CapturedStmt));
 
 class CaseStmt : public SwitchCase {
@@ -1203,10 +1559,11 @@ class CaseStmt : public SwitchCase {
   using SwitchCase::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CaseStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {103, 104};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CaseStmt)
   PASTA_DECLARE_BASE_OPERATORS(SwitchCase, CaseStmt)
   bool CaseStatementIsGNURange(void) const;
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token CaseToken(void) const;
   ::pasta::Token EllipsisToken(void) const;
@@ -1214,19 +1571,27 @@ class CaseStmt : public SwitchCase {
   ::pasta::Expr LHS(void) const;
   std::optional<::pasta::Expr> RHS(void) const;
   ::pasta::Stmt SubStatement(void) const;
+  ::pasta::CaseStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CaseStmt)
 };
 
+struct CaseStmtSnapshot : public SwitchCaseSnapshot {
+  bool case_statement_is_gnu_range;
+  uint32_t case_token;
+  uint32_t ellipsis_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CaseStmt));
 
 class CompoundStmt : public Stmt {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CompoundStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {7, 8};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CompoundStmt)
   // Body: (llvm::iterator_range<clang::Stmt *const *>)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Token LeftBraceToken(void) const;
@@ -1235,52 +1600,74 @@ class CompoundStmt : public Stmt {
   // StoredFPFeatures: (clang::FPOptionsOverride)
   bool HasStoredFPFeatures(void) const;
   uint32_t Size(void) const;
+  ::pasta::CompoundStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CompoundStmt)
 };
 
+struct CompoundStmtSnapshot : public StmtSnapshot {
+  uint32_t left_brace_token;
+  uint32_t right_brace_token;
+  bool has_stored_fp_features;
+  uint32_t size;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CompoundStmt));
 
 class ContinueStmt : public Stmt {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ContinueStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {8, 9};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ContinueStmt)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token ContinueToken(void) const;
   ::pasta::Token EndToken(void) const;
+  ::pasta::ContinueStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ContinueStmt)
 };
 
+struct ContinueStmtSnapshot : public StmtSnapshot {
+  uint32_t continue_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(ContinueStmt));
 
 class CoreturnStmt : public Stmt {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CoreturnStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {9, 10};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CoreturnStmt)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Token KeywordToken(void) const;
   ::pasta::Expr Operand(void) const;
   ::pasta::Expr PromiseCall(void) const;
   bool IsImplicit(void) const;
+  ::pasta::CoreturnStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CoreturnStmt)
 };
 
+struct CoreturnStmtSnapshot : public StmtSnapshot {
+  uint32_t keyword_token;
+  bool is_implicit;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CoreturnStmt));
 
 class CoroutineBodyStmt : public Stmt {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CoroutineBodyStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {10, 11};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CoroutineBodyStmt)
-  std::vector<::pasta::Stmt> Children(void) const;
-  std::vector<::pasta::Stmt> ChildrenExclBody(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> ChildrenExclBody(void) const;
   ::pasta::Expr Allocate(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::CompoundStmt Body(void) const;
@@ -1290,7 +1677,7 @@ class CoroutineBodyStmt : public Stmt {
   ::pasta::Stmt FallthroughHandler(void) const;
   ::pasta::Stmt FinalSuspendStatement(void) const;
   ::pasta::Stmt InitializerSuspendStatement(void) const;
-  std::vector<::pasta::Stmt> ParameterMoves(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> ParameterMoves(void) const;
   ::pasta::VarDecl PromiseDeclaration(void) const;
   ::pasta::Stmt PromiseDeclarationStatement(void) const;
   std::optional<::pasta::Stmt> ResultDeclaration(void) const;
@@ -1299,28 +1686,39 @@ class CoroutineBodyStmt : public Stmt {
   ::pasta::Expr ReturnValue(void) const;
   ::pasta::Expr ReturnValueInitializer(void) const;
   bool HasDependentPromiseType(void) const;
+  ::pasta::CoroutineBodyStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CoroutineBodyStmt)
 };
 
+struct CoroutineBodyStmtSnapshot : public StmtSnapshot {
+  bool has_dependent_promise_type;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CoroutineBodyStmt));
 
 class DeclStmt : public Stmt {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(DeclStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {11, 12};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, DeclStmt)
-  std::vector<::pasta::Stmt> Children(void) const;
-  std::vector<::pasta::Decl> Declarations(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Decl> Declarations(void) const;
   ::pasta::Token BeginToken(void) const;
   // DeclarationGroup: (const clang::DeclGroupRef)
   ::pasta::Token EndToken(void) const;
   std::optional<::pasta::Decl> SingleDeclaration(void) const;
   bool IsSingleDeclaration(void) const;
+  ::pasta::DeclStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(DeclStmt)
 };
 
+struct DeclStmtSnapshot : public StmtSnapshot {
+  bool is_single_declaration;
+};
+
 static_assert(sizeof(Stmt) == sizeof(DeclStmt));
 
 class DefaultStmt : public SwitchCase {
@@ -1328,25 +1726,32 @@ class DefaultStmt : public SwitchCase {
   using SwitchCase::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(DefaultStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {104, 105};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, DefaultStmt)
   PASTA_DECLARE_BASE_OPERATORS(SwitchCase, DefaultStmt)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token DefaultToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Stmt SubStatement(void) const;
+  ::pasta::DefaultStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(DefaultStmt)
 };
 
+struct DefaultStmtSnapshot : public SwitchCaseSnapshot {
+  uint32_t default_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(DefaultStmt));
 
 class DoStmt : public Stmt {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(DoStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {12, 13};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, DoStmt)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Stmt Body(void) const;
   ::pasta::Expr Condition(void) const;
@@ -1354,10 +1759,17 @@ class DoStmt : public Stmt {
   ::pasta::Token EndToken(void) const;
   ::pasta::Token RParenToken(void) const;
   ::pasta::Token WhileToken(void) const;
+  ::pasta::DoStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(DoStmt)
 };
 
+struct DoStmtSnapshot : public StmtSnapshot {
+  uint32_t do_token;
+  uint32_t r_paren_token;
+  uint32_t while_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(DoStmt));
 
 class Expr : public ValueStmt {
@@ -1365,6 +1777,7 @@ class Expr : public ValueStmt {
   using ValueStmt::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(Expr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {107, 231};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, Expr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, Expr)
   PASTA_DECLARE_DERIVED_OPERATORS(Expr, AbstractConditionalOperator)
@@ -1572,10 +1985,41 @@ class Expr : public ValueStmt {
   bool RefersToVectorElement(void) const;
   // TryEvaluateObjectSize: (bool)
   // TryEvaluateStringLen: (bool)
+  ::pasta::ExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(Expr)
 };
 
+struct ExprSnapshot : public ValueStmtSnapshot {
+  enum ExprLValueClassification classify_l_value;
+  bool has_side_effects;
+  bool contains_errors;
+  bool contains_unexpanded_parameter_pack;
+  ::pasta::ExprDependence dependence;
+  uint32_t expression_token;
+  enum ExprObjectKind object_kind;
+  enum ExprValueKind value_kind;
+  bool has_non_trivial_call;
+  bool is_bound_member_function;
+  bool is_default_argument;
+  bool is_gl_value;
+  bool is_implicit_cxx_this;
+  bool is_instantiation_dependent;
+  bool is_l_value;
+  enum ExprisModifiableLvalueResult is_modifiable_lvalue;
+  bool is_objcgc_candidate;
+  bool is_obj_c_self_expression;
+  bool is_ordinary_or_bit_field_object;
+  bool is_pr_value;
+  bool is_type_dependent;
+  bool is_value_dependent;
+  bool is_x_value;
+  bool refers_to_bit_field;
+  bool refers_to_global_register_variable;
+  bool refers_to_matrix_element;
+  bool refers_to_vector_element;
+};
+
 static_assert(sizeof(Stmt) == sizeof(Expr));
 
 class ExpressionTraitExpr : public Expr {
@@ -1583,19 +2027,26 @@ class ExpressionTraitExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ExpressionTraitExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {169, 170};
   PASTA_DECLARE_BASE_OPERATORS(Expr, ExpressionTraitExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ExpressionTraitExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ExpressionTraitExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Expr QueriedExpression(void) const;
   enum ExpressionTrait Trait(void) const;
   bool Value(void) const;
+  ::pasta::ExpressionTraitExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ExpressionTraitExpr)
 };
 
+struct ExpressionTraitExprSnapshot : public ExprSnapshot {
+  enum ExpressionTrait trait;
+  bool value;
+};
+
 static_assert(sizeof(Stmt) == sizeof(ExpressionTraitExpr));
 
 class ExtVectorElementExpr : public Expr {
@@ -1603,10 +2054,11 @@ class ExtVectorElementExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ExtVectorElementExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {170, 171};
   PASTA_DECLARE_BASE_OPERATORS(Expr, ExtVectorElementExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ExtVectorElementExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ExtVectorElementExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   bool ContainsDuplicateElements(void) const;
   // Accessor: (clang::IdentifierInfo &)
   ::pasta::Token AccessorToken(void) const;
@@ -1615,10 +2067,18 @@ class ExtVectorElementExpr : public Expr {
   ::pasta::Token EndToken(void) const;
   uint32_t NumElements(void) const;
   bool IsArrow(void) const;
+  ::pasta::ExtVectorElementExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ExtVectorElementExpr)
 };
 
+struct ExtVectorElementExprSnapshot : public ExprSnapshot {
+  bool contains_duplicate_elements;
+  uint32_t accessor_token;
+  uint32_t num_elements;
+  bool is_arrow;
+};
+
 static_assert(sizeof(Stmt) == sizeof(ExtVectorElementExpr));
 
 class FixedPointLiteral : public Expr {
@@ -1626,19 +2086,26 @@ class FixedPointLiteral : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(FixedPointLiteral)
+  static constexpr ::pasta::detail::KindRange kKindRange = {171, 172};
   PASTA_DECLARE_BASE_OPERATORS(Expr, FixedPointLiteral)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, FixedPointLiteral)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, FixedPointLiteral)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Token Token(void) const;
   uint32_t Scale(void) const;
   // ValueAsString: (std::string)
+  ::pasta::FixedPointLiteralSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(FixedPointLiteral)
 };
 
+struct FixedPointLiteralSnapshot : public ExprSnapshot {
+  uint32_t token;
+  uint32_t scale;
+};
+
 static_assert(sizeof(Stmt) == sizeof(FixedPointLiteral));
 
 class FloatingLiteral : public Expr {
@@ -1646,10 +2113,11 @@ class FloatingLiteral : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(FloatingLiteral)
+  static constexpr ::pasta::detail::KindRange kKindRange = {172, 173};
   PASTA_DECLARE_BASE_OPERATORS(Expr, FloatingLiteral)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, FloatingLiteral)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, FloatingLiteral)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Token Token(void) const;
@@ -1658,18 +2126,26 @@ class FloatingLiteral : public Expr {
   // Value: (llvm::APFloat)
   double ValueAsApproximateDouble(void) const;
   bool IsExact(void) const;
+  ::pasta::FloatingLiteralSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(FloatingLiteral)
 };
 
+struct FloatingLiteralSnapshot : public ExprSnapshot {
+  uint32_t token;
+  double value_as_approximate_double;
+  bool is_exact;
+};
+
 static_assert(sizeof(Stmt) == sizeof(FloatingLiteral));
 
 class ForStmt : public Stmt {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ForStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {13, 14};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ForStmt)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Stmt Body(void) const;
   std::optional<::pasta::Expr> Condition(void) const;
@@ -1681,10 +2157,17 @@ class ForStmt : public Stmt {
   std::optional<::pasta::Stmt> Initializer(void) const;
   ::pasta::Token LParenToken(void) const;
   ::pasta::Token RParenToken(void) const;
+  ::pasta::ForStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ForStmt)
 };
 
+struct ForStmtSnapshot : public StmtSnapshot {
+  uint32_t for_token;
+  uint32_t l_paren_token;
+  uint32_t r_paren_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(ForStmt));
 
 class FullExpr : public Expr {
@@ -1692,16 +2175,21 @@ class FullExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(FullExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {173, 175};
   PASTA_DECLARE_BASE_OPERATORS(Expr, FullExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, FullExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, FullExpr)
   PASTA_DECLARE_DERIVED_OPERATORS(FullExpr, ConstantExpr)
   PASTA_DECLARE_DERIVED_OPERATORS(FullExpr, ExprWithCleanups)
   ::pasta::Expr SubExpression(void) const;
+  ::pasta::FullExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(FullExpr)
 };
 
+struct FullExprSnapshot : public ExprSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(FullExpr));
 
 class FunctionParmPackExpr : public Expr {
@@ -1709,10 +2197,11 @@ class FunctionParmPackExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(FunctionParmPackExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {175, 176};
   PASTA_DECLARE_BASE_OPERATORS(Expr, FunctionParmPackExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, FunctionParmPackExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, FunctionParmPackExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   // Expansion: (clang::VarDecl *)
@@ -1720,10 +2209,16 @@ class FunctionParmPackExpr : public Expr {
   ::pasta::VarDecl ParameterPack(void) const;
   ::pasta::Token ParameterPackToken(void) const;
   std::vector<::pasta::VarDecl> Expansions(void) const;
+  ::pasta::FunctionParmPackExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(FunctionParmPackExpr)
 };
 
+struct FunctionParmPackExprSnapshot : public ExprSnapshot {
+  uint32_t num_expansions;
+  uint32_t parameter_pack_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(FunctionParmPackExpr));
 
 class GCCAsmStmt : public AsmStmt {
@@ -1731,6 +2226,7 @@ class GCCAsmStmt : public AsmStmt {
   using AsmStmt::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(GCCAsmStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {0, 1};
   PASTA_DECLARE_BASE_OPERATORS(AsmStmt, GCCAsmStmt)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, GCCAsmStmt)
   // AnalyzeAssemblyString: (unsigned int)
@@ -1757,7 +2253,7 @@ class GCCAsmStmt : public AsmStmt {
   // OutputName: (llvm::StringRef)
   ::pasta::Token RParenToken(void) const;
   bool IsAssemblyGoto(void) const;
-  std::vector<::pasta::AddrLabelExpr> Labels(void) const;
+  ::pasta::LazyRange<::pasta::AddrLabelExpr> Labels(void) const;
   std::vector<std::string_view> OutputConstraints(void) const;
   std::vector<::pasta::StringLiteral> OutputConstraintLiterals(void) const;
   std::vector<::pasta::Expr> OutputExpressions(void) const;
@@ -1773,10 +2269,17 @@ class GCCAsmStmt : public AsmStmt {
   std::vector<::pasta::AddrLabelExpr> LabelExpressions(void) const;
   // !!! Label getNumLabels getLabelIdentifier (empty ret type = (clang::IdentifierInfo *))
   std::vector<std::string_view> LabelNames(void) const;
+  ::pasta::GCCAsmStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(GCCAsmStmt)
 };
 
+struct GCCAsmStmtSnapshot : public AsmStmtSnapshot {
+  uint32_t num_labels;
+  uint32_t r_paren_token;
+  bool is_assembly_goto;
+};
+
 static_assert(sizeof(Stmt) == sizeof(GCCAsmStmt));
 
 class GNUNullExpr : public Expr {
@@ -1784,17 +2287,23 @@ class GNUNullExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(GNUNullExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {176, 177};
   PASTA_DECLARE_BASE_OPERATORS(Expr, GNUNullExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, GNUNullExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, GNUNullExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Token TokenToken(void) const;
+  ::pasta::GNUNullExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(GNUNullExpr)
 };
 
+struct GNUNullExprSnapshot : public ExprSnapshot {
+  uint32_t token_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(GNUNullExpr));
 
 class GenericSelectionExpr : public Expr {
@@ -1802,12 +2311,13 @@ class GenericSelectionExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(GenericSelectionExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {177, 178};
   PASTA_DECLARE_BASE_OPERATORS(Expr, GenericSelectionExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, GenericSelectionExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, GenericSelectionExpr)
   // Associations: (llvm::iterator_range<clang::GenericSelectionExpr::AssociationIteratorTy<true>>)
-  std::vector<::pasta::Stmt> Children(void) const;
-  std::vector<::pasta::Expr> AssociationExpressions(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Expr> AssociationExpressions(void) const;
   // Association: (clang::GenericSelectionExpr::AssociationTy<true>)
   ::pasta::Token BeginToken(void) const;
   std::optional<::pasta::Expr> ControllingExpression(void) const;
@@ -1822,35 +2332,55 @@ class GenericSelectionExpr : public Expr {
   bool IsExpressionPredicate(void) const;
   bool IsResultDependent(void) const;
   bool IsTypePredicate(void) const;
+  ::pasta::GenericSelectionExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(GenericSelectionExpr)
 };
 
+struct GenericSelectionExprSnapshot : public ExprSnapshot {
+  uint32_t default_token;
+  uint32_t generic_token;
+  uint32_t num_associations;
+  uint32_t r_paren_token;
+  uint32_t result_index{};
+  bool is_expression_predicate;
+  bool is_result_dependent;
+  bool is_type_predicate;
+};
+
 static_assert(sizeof(Stmt) == sizeof(GenericSelectionExpr));
 
 class GotoStmt : public Stmt {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(GotoStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {14, 15};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, GotoStmt)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Token GotoToken(void) const;
   ::pasta::LabelDecl Label(void) const;
   ::pasta::Token LabelToken(void) const;
+  ::pasta::GotoStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(GotoStmt)
 };
 
+struct GotoStmtSnapshot : public StmtSnapshot {
+  uint32_t goto_token;
+  uint32_t label_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(GotoStmt));
 
 class IfStmt : public Stmt {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(IfStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {15, 16};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, IfStmt)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Expr Condition(void) const;
   std::optional<::pasta::VarDecl> ConditionVariable(void) const;
@@ -1873,10 +2403,27 @@ class IfStmt : public Stmt {
   bool IsNegatedConsteval(void) const;
   bool IsNonNegatedConsteval(void) const;
   bool IsObjCAvailabilityCheck(void) const;
+  ::pasta::IfStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(IfStmt)
 };
 
+struct IfStmtSnapshot : public StmtSnapshot {
+  uint32_t else_token;
+  uint32_t if_token;
+  uint32_t l_paren_token;
+  uint32_t r_paren_token;
+  enum IfStatementKind statement_kind;
+  bool has_else_storage;
+  bool has_initializer_storage;
+  bool has_variable_storage;
+  bool is_consteval;
+  bool is_constexpr;
+  bool is_negated_consteval;
+  bool is_non_negated_consteval;
+  bool is_obj_c_availability_check;
+};
+
 static_assert(sizeof(Stmt) == sizeof(IfStmt));
 
 class ImaginaryLiteral : public Expr {
@@ -1884,17 +2431,22 @@ class ImaginaryLiteral : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ImaginaryLiteral)
+  static constexpr ::pasta::detail::KindRange kKindRange = {178, 179};
   PASTA_DECLARE_BASE_OPERATORS(Expr, ImaginaryLiteral)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ImaginaryLiteral)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ImaginaryLiteral)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Expr SubExpression(void) const;
+  ::pasta::ImaginaryLiteralSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ImaginaryLiteral)
 };
 
+struct ImaginaryLiteralSnapshot : public ExprSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(ImaginaryLiteral));
 
 class ImplicitValueInitExpr : public Expr {
@@ -1902,34 +2454,46 @@ class ImplicitValueInitExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ImplicitValueInitExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {179, 180};
   PASTA_DECLARE_BASE_OPERATORS(Expr, ImplicitValueInitExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ImplicitValueInitExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ImplicitValueInitExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
+  ::pasta::ImplicitValueInitExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ImplicitValueInitExpr)
 };
 
+struct ImplicitValueInitExprSnapshot : public ExprSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(ImplicitValueInitExpr));
 
 class IndirectGotoStmt : public Stmt {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(IndirectGotoStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {16, 17};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, IndirectGotoStmt)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   std::optional<::pasta::LabelDecl> ConstantTarget(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Token GotoToken(void) const;
   ::pasta::Token StarToken(void) const;
   ::pasta::Expr Target(void) const;
+  ::pasta::IndirectGotoStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(IndirectGotoStmt)
 };
 
+struct IndirectGotoStmtSnapshot : public StmtSnapshot {
+  uint32_t goto_token;
+  uint32_t star_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(IndirectGotoStmt));
 
 class InitListExpr : public Expr {
@@ -1937,10 +2501,11 @@ class InitListExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(InitListExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {180, 181};
   PASTA_DECLARE_BASE_OPERATORS(Expr, InitListExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, InitListExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, InitListExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   std::optional<::pasta::Expr> ArrayFiller(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
@@ -1955,17 +2520,31 @@ class InitListExpr : public Expr {
   bool HadArrayRangeDesignator(void) const;
   bool HasArrayFiller(void) const;
   bool HasDesignatedInitializer(void) const;
-  std::vector<::pasta::Expr> Initializers(void) const;
+  ::pasta::LazyRange<::pasta::Expr> Initializers(void) const;
   bool IsExplicit(void) const;
   // IsIdiomaticZeroInitializer: (bool)
   bool IsSemanticForm(void) const;
   bool IsStringLiteralInitializer(void) const;
   bool IsSyntacticForm(void) const;
   std::optional<bool> IsTransparent(void) const;
+  ::pasta::InitListExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(InitListExpr)
 };
 
+struct InitListExprSnapshot : public ExprSnapshot {
+  uint32_t l_brace_token;
+  uint32_t num_initializers;
+  uint32_t r_brace_token;
+  bool had_array_range_designator;
+  bool has_array_filler;
+  bool has_designated_initializer;
+  bool is_explicit;
+  bool is_semantic_form;
+  bool is_string_literal_initializer;
+  bool is_syntactic_form;
+};
+
 static_assert(sizeof(Stmt) == sizeof(InitListExpr));
 
 class IntegerLiteral : public Expr {
@@ -1973,17 +2552,23 @@ class IntegerLiteral : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(IntegerLiteral)
+  static constexpr ::pasta::detail::KindRange kKindRange = {181, 182};
   PASTA_DECLARE_BASE_OPERATORS(Expr, IntegerLiteral)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, IntegerLiteral)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, IntegerLiteral)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Token Token(void) const;
+  ::pasta::IntegerLiteralSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(IntegerLiteral)
 };
 
+struct IntegerLiteralSnapshot : public ExprSnapshot {
+  uint32_t token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(IntegerLiteral));
 
 class LabelStmt : public ValueStmt {
@@ -1991,9 +2576,10 @@ class LabelStmt : public ValueStmt {
   using ValueStmt::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(LabelStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {231, 232};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, LabelStmt)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, LabelStmt)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::LabelDecl Declaration(void) const;
   ::pasta::Token EndToken(void) const;
@@ -2001,10 +2587,16 @@ class LabelStmt : public ValueStmt {
   std::string_view Name(void) const;
   ::pasta::Stmt SubStatement(void) const;
   bool IsSideEntry(void) const;
+  ::pasta::LabelStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(LabelStmt)
 };
 
+struct LabelStmtSnapshot : public ValueStmtSnapshot {
+  uint32_t identifier_token;
+  bool is_side_entry;
+};
+
 static_assert(sizeof(Stmt) == sizeof(LabelStmt));
 
 class LambdaExpr : public Expr {
@@ -2012,12 +2604,13 @@ class LambdaExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(LambdaExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {182, 183};
   PASTA_DECLARE_BASE_OPERATORS(Expr, LambdaExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, LambdaExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, LambdaExpr)
   // CaptureInitializers: (llvm::iterator_range<clang::Expr *const *>)
   // Captures: (llvm::iterator_range<const clang::LambdaCapture *>)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   // ExplicitCaptures: (llvm::iterator_range<const clang::LambdaCapture *>)
   ::pasta::Token BeginToken(void) const;
   ::pasta::Stmt Body(void) const;
@@ -2027,7 +2620,7 @@ class LambdaExpr : public Expr {
   ::pasta::CompoundStmt CompoundStatementBody(void) const;
   std::optional<::pasta::FunctionTemplateDecl> DependentCallOperator(void) const;
   ::pasta::Token EndToken(void) const;
-  std::vector<::pasta::NamedDecl> ExplicitTemplateParameters(void) const;
+  ::pasta::LazyRange<::pasta::NamedDecl> ExplicitTemplateParameters(void) const;
   ::pasta::TokenRange IntroducerRange(void) const;
   ::pasta::CXXRecordDecl LambdaClass(void) const;
   std::optional<::pasta::TemplateParameterList> TemplateParameterList(void) const;
@@ -2038,10 +2631,20 @@ class LambdaExpr : public Expr {
   bool IsGenericLambda(void) const;
   // IsInitializerCapture: (bool)
   bool IsMutable(void) const;
+  ::pasta::LambdaExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(LambdaExpr)
 };
 
+struct LambdaExprSnapshot : public ExprSnapshot {
+  enum LambdaCaptureDefault capture_default;
+  uint32_t capture_default_token;
+  bool has_explicit_parameters;
+  bool has_explicit_result_type;
+  bool is_generic_lambda;
+  bool is_mutable;
+};
+
 static_assert(sizeof(Stmt) == sizeof(LambdaExpr));
 
 class MSAsmStmt : public AsmStmt {
@@ -2049,12 +2652,13 @@ class MSAsmStmt : public AsmStmt {
   using AsmStmt::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(MSAsmStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {1, 2};
   PASTA_DECLARE_BASE_OPERATORS(AsmStmt, MSAsmStmt)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, MSAsmStmt)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   std::string GenerateAssemblyString(void) const;
   std::vector<std::string_view> AllConstraints(void) const;
-  std::vector<::pasta::Expr> AllExpressions(void) const;
+  ::pasta::LazyRange<::pasta::Expr> AllExpressions(void) const;
   std::string_view AssemblyString(void) const;
   ::pasta::Token BeginToken(void) const;
   // Clobber: (llvm::StringRef)
@@ -2070,18 +2674,25 @@ class MSAsmStmt : public AsmStmt {
   std::vector<::pasta::Expr> OutputExpressions(void) const;
   std::vector<std::string_view> InputConstraints(void) const;
   std::vector<::pasta::Expr> InputExpressions(void) const;
+  ::pasta::MSAsmStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(MSAsmStmt)
 };
 
+struct MSAsmStmtSnapshot : public AsmStmtSnapshot {
+  uint32_t l_brace_token;
+  bool has_braces;
+};
+
 static_assert(sizeof(Stmt) == sizeof(MSAsmStmt));
 
 class MSDependentExistsStmt : public Stmt {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(MSDependentExistsStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {17, 18};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, MSDependentExistsStmt)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Token KeywordToken(void) const;
@@ -2090,10 +2701,17 @@ class MSDependentExistsStmt : public Stmt {
   ::pasta::CompoundStmt SubStatement(void) const;
   bool IsIfExists(void) const;
   bool IsIfNotExists(void) const;
+  ::pasta::MSDependentExistsStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(MSDependentExistsStmt)
 };
 
+struct MSDependentExistsStmtSnapshot : public StmtSnapshot {
+  uint32_t keyword_token;
+  bool is_if_exists;
+  bool is_if_not_exists;
+};
+
 static_assert(sizeof(Stmt) == sizeof(MSDependentExistsStmt));
 
 class MSPropertyRefExpr : public Expr {
@@ -2101,10 +2719,11 @@ class MSPropertyRefExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(MSPropertyRefExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {183, 184};
   PASTA_DECLARE_BASE_OPERATORS(Expr, MSPropertyRefExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, MSPropertyRefExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, MSPropertyRefExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Expr BaseExpression(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
@@ -2114,10 +2733,17 @@ class MSPropertyRefExpr : public Expr {
   ::pasta::TokenRange Tokens(void) const;
   bool IsArrow(void) const;
   bool IsImplicitAccess(void) const;
+  ::pasta::MSPropertyRefExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(MSPropertyRefExpr)
 };
 
+struct MSPropertyRefExprSnapshot : public ExprSnapshot {
+  uint32_t member_token;
+  bool is_arrow;
+  bool is_implicit_access;
+};
+
 static_assert(sizeof(Stmt) == sizeof(MSPropertyRefExpr));
 
 class MSPropertySubscriptExpr : public Expr {
@@ -2125,20 +2751,26 @@ class MSPropertySubscriptExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(MSPropertySubscriptExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {184, 185};
   PASTA_DECLARE_BASE_OPERATORS(Expr, MSPropertySubscriptExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, MSPropertySubscriptExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, MSPropertySubscriptExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Expr Base(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Token ExpressionToken(void) const;
   ::pasta::Expr Index(void) const;
   ::pasta::Token RBracketToken(void) const;
+  ::pasta::MSPropertySubscriptExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(MSPropertySubscriptExpr)
 };
 
+struct MSPropertySubscriptExprSnapshot : public ExprSnapshot {
+  uint32_t r_bracket_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(MSPropertySubscriptExpr));
 
 class MaterializeTemporaryExpr : public Expr {
@@ -2146,10 +2778,11 @@ class MaterializeTemporaryExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(MaterializeTemporaryExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {185, 186};
   PASTA_DECLARE_BASE_OPERATORS(Expr, MaterializeTemporaryExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, MaterializeTemporaryExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, MaterializeTemporaryExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   std::optional<::pasta::ValueDecl> ExtendingDeclaration(void) const;
@@ -2160,10 +2793,18 @@ class MaterializeTemporaryExpr : public Expr {
   ::pasta::Expr SubExpression(void) const;
   bool IsBoundToLvalueReference(void) const;
   bool IsUsableInConstantExpressions(void) const;
+  ::pasta::MaterializeTemporaryExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(MaterializeTemporaryExpr)
 };
 
+struct MaterializeTemporaryExprSnapshot : public ExprSnapshot {
+  uint32_t mangling_number;
+  enum StorageDuration storage_duration;
+  bool is_bound_to_lvalue_reference;
+  bool is_usable_in_constant_expressions;
+};
+
 static_assert(sizeof(Stmt) == sizeof(MaterializeTemporaryExpr));
 
 class MatrixSubscriptExpr : public Expr {
@@ -2171,10 +2812,11 @@ class MatrixSubscriptExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(MatrixSubscriptExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {186, 187};
   PASTA_DECLARE_BASE_OPERATORS(Expr, MatrixSubscriptExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, MatrixSubscriptExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, MatrixSubscriptExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Expr Base(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Expr ColumnIndex(void) const;
@@ -2183,10 +2825,16 @@ class MatrixSubscriptExpr : public Expr {
   ::pasta::Token RBracketToken(void) const;
   ::pasta::Expr RowIndex(void) const;
   bool IsIncomplete(void) const;
+  ::pasta::MatrixSubscriptExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(MatrixSubscriptExpr)
 };
 
+struct MatrixSubscriptExprSnapshot : public ExprSnapshot {
+  uint32_t r_bracket_token;
+  bool is_incomplete;
+};
+
 static_assert(sizeof(Stmt) == sizeof(MatrixSubscriptExpr));
 
 class MemberExpr : public Expr {
@@ -2194,10 +2842,11 @@ class MemberExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(MemberExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {187, 188};
   PASTA_DECLARE_BASE_OPERATORS(Expr, MemberExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, MemberExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, MemberExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Expr Base(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
@@ -2223,10 +2872,27 @@ class MemberExpr : public Expr {
   enum NonOdrUseReason IsNonOdrUse(void) const;
   // PerformsVirtualDispatch: (bool)
   // TemplateArguments: (llvm::ArrayRef<clang::TemplateArgumentLoc>)
+  ::pasta::MemberExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(MemberExpr)
 };
 
+struct MemberExprSnapshot : public ExprSnapshot {
+  uint32_t l_angle_token;
+  uint32_t member_token;
+  uint32_t num_template_arguments;
+  uint32_t operator_token;
+  uint32_t r_angle_token;
+  uint32_t template_keyword_token;
+  bool had_multiple_candidates;
+  bool has_explicit_template_arguments;
+  bool has_qualifier;
+  bool has_template_keyword;
+  bool is_arrow;
+  bool is_implicit_access;
+  enum NonOdrUseReason is_non_odr_use;
+};
+
 static_assert(sizeof(Stmt) == sizeof(MemberExpr));
 
 class NoInitExpr : public Expr {
@@ -2234,32 +2900,44 @@ class NoInitExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(NoInitExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {188, 189};
   PASTA_DECLARE_BASE_OPERATORS(Expr, NoInitExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, NoInitExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, NoInitExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
+  ::pasta::NoInitExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(NoInitExpr)
 };
 
+struct NoInitExprSnapshot : public ExprSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(NoInitExpr));
 
 class NullStmt : public Stmt {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(NullStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {18, 19};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, NullStmt)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Token SemiToken(void) const;
   bool HasLeadingEmptyMacro(void) const;
+  ::pasta::NullStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(NullStmt)
 };
 
+struct NullStmtSnapshot : public StmtSnapshot {
+  uint32_t semi_token;
+  bool has_leading_empty_macro;
+};
+
 static_assert(sizeof(Stmt) == sizeof(NullStmt));
 
 class OMPArraySectionExpr : public Expr {
@@ -2267,10 +2945,11 @@ class OMPArraySectionExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPArraySectionExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {189, 190};
   PASTA_DECLARE_BASE_OPERATORS(Expr, OMPArraySectionExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPArraySectionExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, OMPArraySectionExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Expr Base(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token FirstColonToken(void) const;
@@ -2281,10 +2960,17 @@ class OMPArraySectionExpr : public Expr {
   ::pasta::Expr LowerBound(void) const;
   ::pasta::Token RBracketToken(void) const;
   ::pasta::Expr Stride(void) const;
+  ::pasta::OMPArraySectionExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPArraySectionExpr)
 };
 
+struct OMPArraySectionExprSnapshot : public ExprSnapshot {
+  uint32_t first_colon_token;
+  uint32_t second_colon_token;
+  uint32_t r_bracket_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPArraySectionExpr));
 
 class OMPArrayShapingExpr : public Expr {
@@ -2292,45 +2978,58 @@ class OMPArrayShapingExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPArrayShapingExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {190, 191};
   PASTA_DECLARE_BASE_OPERATORS(Expr, OMPArrayShapingExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPArrayShapingExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, OMPArrayShapingExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Expr Base(void) const;
   ::pasta::Token BeginToken(void) const;
   std::vector<::pasta::TokenRange> BracketsRanges(void) const;
-  std::vector<::pasta::Expr> Dimensions(void) const;
+  ::pasta::LazyRange<::pasta::Expr> Dimensions(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Token LParenToken(void) const;
   ::pasta::Token RParenToken(void) const;
+  ::pasta::OMPArrayShapingExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPArrayShapingExpr)
 };
 
+struct OMPArrayShapingExprSnapshot : public ExprSnapshot {
+  uint32_t l_paren_token;
+  uint32_t r_paren_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPArrayShapingExpr));
 
 class OMPCanonicalLoop : public Stmt {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPCanonicalLoop)
+  static constexpr ::pasta::detail::KindRange kKindRange = {19, 20};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPCanonicalLoop)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::CapturedStmt DistanceFunc(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Stmt LoopStatement(void) const;
   ::pasta::CapturedStmt LoopVariableFunc(void) const;
   ::pasta::DeclRefExpr LoopVariableReference(void) const;
+  ::pasta::OMPCanonicalLoopSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPCanonicalLoop)
 };
 
+struct OMPCanonicalLoopSnapshot : public StmtSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPCanonicalLoop));
 
 class OMPExecutableDirective : public Stmt {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPExecutableDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {20, 91};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPExecutableDirective)
   PASTA_DECLARE_DERIVED_OPERATORS(OMPExecutableDirective, OMPAtomicDirective)
   PASTA_DECLARE_DERIVED_OPERATORS(OMPExecutableDirective, OMPBarrierDirective)
@@ -2406,7 +3105,7 @@ class OMPExecutableDirective : public Stmt {
   PASTA_DECLARE_DERIVED_OPERATORS(OMPExecutableDirective, OMPTeamsGenericLoopDirective)
   PASTA_DECLARE_DERIVED_OPERATORS(OMPExecutableDirective, OMPTileDirective)
   PASTA_DECLARE_DERIVED_OPERATORS(OMPExecutableDirective, OMPUnrollDirective)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   // Clauses: (llvm::ArrayRef<clang::OMPClause *>)
   ::pasta::Stmt AssociatedStatement(void) const;
   ::pasta::Token BeginToken(void) const;
@@ -2421,10 +3120,17 @@ class OMPExecutableDirective : public Stmt {
   bool HasAssociatedStatement(void) const;
   bool IsStandaloneDirective(void) const;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPExecutableDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPExecutableDirective)
 };
 
+struct OMPExecutableDirectiveSnapshot : public StmtSnapshot {
+  uint32_t num_clauses;
+  bool has_associated_statement;
+  bool is_standalone_directive;
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPExecutableDirective));
 
 class OMPFlushDirective : public OMPExecutableDirective {
@@ -2432,13 +3138,18 @@ class OMPFlushDirective : public OMPExecutableDirective {
   using OMPExecutableDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPFlushDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {28, 29};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPFlushDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPFlushDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPFlushDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPFlushDirective)
 };
 
+struct OMPFlushDirectiveSnapshot : public OMPExecutableDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPFlushDirective));
 
 class OMPInteropDirective : public OMPExecutableDirective {
@@ -2446,13 +3157,18 @@ class OMPInteropDirective : public OMPExecutableDirective {
   using OMPExecutableDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPInteropDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {29, 30};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPInteropDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPInteropDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPInteropDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPInteropDirective)
 };
 
+struct OMPInteropDirectiveSnapshot : public OMPExecutableDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPInteropDirective));
 
 class OMPIteratorExpr : public Expr {
@@ -2460,10 +3176,11 @@ class OMPIteratorExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPIteratorExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {191, 192};
   PASTA_DECLARE_BASE_OPERATORS(Expr, OMPIteratorExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPIteratorExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, OMPIteratorExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   // AssignToken: (clang::SourceLocation)
   ::pasta::Token BeginToken(void) const;
   // ColonToken: (clang::SourceLocation)
@@ -2476,10 +3193,18 @@ class OMPIteratorExpr : public Expr {
   ::pasta::Token RParenToken(void) const;
   // SecondColonToken: (clang::SourceLocation)
   uint32_t NumOfIterators(void) const;
+  ::pasta::OMPIteratorExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPIteratorExpr)
 };
 
+struct OMPIteratorExprSnapshot : public ExprSnapshot {
+  uint32_t iterator_kw_token;
+  uint32_t l_paren_token;
+  uint32_t r_paren_token;
+  uint32_t num_of_iterators;
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPIteratorExpr));
 
 class OMPLoopBasedDirective : public OMPExecutableDirective {
@@ -2487,6 +3212,7 @@ class OMPLoopBasedDirective : public OMPExecutableDirective {
   using OMPExecutableDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPLoopBasedDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {30, 67};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPLoopBasedDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPLoopBasedDirective)
   PASTA_DECLARE_DERIVED_OPERATORS(OMPLoopBasedDirective, OMPDistributeDirective)
@@ -2530,10 +3256,15 @@ class OMPLoopBasedDirective : public OMPExecutableDirective {
   PASTA_DECLARE_DERIVED_OPERATORS(OMPLoopBasedDirective, OMPUnrollDirective)
   uint32_t LoopsNumber(void) const;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPLoopBasedDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPLoopBasedDirective)
 };
 
+struct OMPLoopBasedDirectiveSnapshot : public OMPExecutableDirectiveSnapshot {
+  uint32_t loops_number;
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPLoopBasedDirective));
 
 class OMPLoopDirective : public OMPLoopBasedDirective {
@@ -2541,6 +3272,7 @@ class OMPLoopDirective : public OMPLoopBasedDirective {
   using OMPLoopBasedDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPLoopDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {30, 65};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPLoopDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPLoopDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPLoopDirective)
@@ -2579,11 +3311,11 @@ class OMPLoopDirective : public OMPLoopBasedDirective {
   PASTA_DECLARE_DERIVED_OPERATORS(OMPLoopDirective, OMPTeamsDistributeParallelForSimdDirective)
   PASTA_DECLARE_DERIVED_OPERATORS(OMPLoopDirective, OMPTeamsDistributeSimdDirective)
   PASTA_DECLARE_DERIVED_OPERATORS(OMPLoopDirective, OMPTeamsGenericLoopDirective)
-  std::vector<::pasta::Expr> Counters(void) const;
-  std::vector<::pasta::Expr> DependentCounters(void) const;
-  std::vector<::pasta::Expr> DependentInitializers(void) const;
-  std::vector<::pasta::Expr> Finals(void) const;
-  std::vector<::pasta::Expr> FinalsConditions(void) const;
+  ::pasta::LazyRange<::pasta::Expr> Counters(void) const;
+  ::pasta::LazyRange<::pasta::Expr> DependentCounters(void) const;
+  ::pasta::LazyRange<::pasta::Expr> DependentInitializers(void) const;
+  ::pasta::LazyRange<::pasta::Expr> Finals(void) const;
+  ::pasta::LazyRange<::pasta::Expr> FinalsConditions(void) const;
   ::pasta::Stmt Body(void) const;
   ::pasta::Expr CalculateLastIteration(void) const;
   ::pasta::Expr CombinedCondition(void) const;
@@ -2614,14 +3346,18 @@ class OMPLoopDirective : public OMPLoopBasedDirective {
   ::pasta::Expr PrevUpperBoundVariable(void) const;
   ::pasta::Expr StrideVariable(void) const;
   ::pasta::Expr UpperBoundVariable(void) const;
-  std::vector<::pasta::Expr> Initializers(void) const;
-  std::vector<::pasta::Expr> PrivateCounters(void) const;
-  std::vector<::pasta::Expr> Updates(void) const;
+  ::pasta::LazyRange<::pasta::Expr> Initializers(void) const;
+  ::pasta::LazyRange<::pasta::Expr> PrivateCounters(void) const;
+  ::pasta::LazyRange<::pasta::Expr> Updates(void) const;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPLoopDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPLoopDirective)
 };
 
+struct OMPLoopDirectiveSnapshot : public OMPLoopBasedDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPLoopDirective));
 
 class OMPLoopTransformationDirective : public OMPLoopBasedDirective {
@@ -2629,6 +3365,7 @@ class OMPLoopTransformationDirective : public OMPLoopBasedDirective {
   using OMPLoopBasedDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPLoopTransformationDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {65, 67};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPLoopTransformationDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPLoopTransformationDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPLoopTransformationDirective)
@@ -2638,10 +3375,15 @@ class OMPLoopTransformationDirective : public OMPLoopBasedDirective {
   ::pasta::Stmt PreInitializers(void) const;
   ::pasta::Stmt TransformedStatement(void) const;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPLoopTransformationDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPLoopTransformationDirective)
 };
 
+struct OMPLoopTransformationDirectiveSnapshot : public OMPLoopBasedDirectiveSnapshot {
+  uint32_t num_associated_loops;
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPLoopTransformationDirective));
 
 class OMPMaskedDirective : public OMPExecutableDirective {
@@ -2649,13 +3391,18 @@ class OMPMaskedDirective : public OMPExecutableDirective {
   using OMPExecutableDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPMaskedDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {67, 68};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPMaskedDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPMaskedDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPMaskedDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPMaskedDirective)
 };
 
+struct OMPMaskedDirectiveSnapshot : public OMPExecutableDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPMaskedDirective));
 
 class OMPMaskedTaskLoopDirective : public OMPLoopDirective {
@@ -2663,16 +3410,22 @@ class OMPMaskedTaskLoopDirective : public OMPLoopDirective {
   using OMPLoopDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPMaskedTaskLoopDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {37, 38};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPMaskedTaskLoopDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPMaskedTaskLoopDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPMaskedTaskLoopDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPMaskedTaskLoopDirective)
   bool HasCancel(void) const;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPMaskedTaskLoopDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPMaskedTaskLoopDirective)
 };
 
+struct OMPMaskedTaskLoopDirectiveSnapshot : public OMPLoopDirectiveSnapshot {
+  bool has_cancel;
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPMaskedTaskLoopDirective));
 
 class OMPMaskedTaskLoopSimdDirective : public OMPLoopDirective {
@@ -2680,15 +3433,20 @@ class OMPMaskedTaskLoopSimdDirective : public OMPLoopDirective {
   using OMPLoopDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPMaskedTaskLoopSimdDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {38, 39};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPMaskedTaskLoopSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPMaskedTaskLoopSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPMaskedTaskLoopSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPMaskedTaskLoopSimdDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPMaskedTaskLoopSimdDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPMaskedTaskLoopSimdDirective)
 };
 
+struct OMPMaskedTaskLoopSimdDirectiveSnapshot : public OMPLoopDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPMaskedTaskLoopSimdDirective));
 
 class OMPMasterDirective : public OMPExecutableDirective {
@@ -2696,13 +3454,18 @@ class OMPMasterDirective : public OMPExecutableDirective {
   using OMPExecutableDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPMasterDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {68, 69};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPMasterDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPMasterDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPMasterDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPMasterDirective)
 };
 
+struct OMPMasterDirectiveSnapshot : public OMPExecutableDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPMasterDirective));
 
 class OMPMasterTaskLoopDirective : public OMPLoopDirective {
@@ -2710,16 +3473,22 @@ class OMPMasterTaskLoopDirective : public OMPLoopDirective {
   using OMPLoopDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPMasterTaskLoopDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {39, 40};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPMasterTaskLoopDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPMasterTaskLoopDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPMasterTaskLoopDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPMasterTaskLoopDirective)
   bool HasCancel(void) const;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPMasterTaskLoopDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPMasterTaskLoopDirective)
 };
 
+struct OMPMasterTaskLoopDirectiveSnapshot : public OMPLoopDirectiveSnapshot {
+  bool has_cancel;
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPMasterTaskLoopDirective));
 
 class OMPMasterTaskLoopSimdDirective : public OMPLoopDirective {
@@ -2727,15 +3496,20 @@ class OMPMasterTaskLoopSimdDirective : public OMPLoopDirective {
   using OMPLoopDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPMasterTaskLoopSimdDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {40, 41};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPMasterTaskLoopSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPMasterTaskLoopSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPMasterTaskLoopSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPMasterTaskLoopSimdDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPMasterTaskLoopSimdDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPMasterTaskLoopSimdDirective)
 };
 
+struct OMPMasterTaskLoopSimdDirectiveSnapshot : public OMPLoopDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPMasterTaskLoopSimdDirective));
 
 class OMPMetaDirective : public OMPExecutableDirective {
@@ -2743,14 +3517,19 @@ class OMPMetaDirective : public OMPExecutableDirective {
   using OMPExecutableDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPMetaDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {69, 70};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPMetaDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPMetaDirective)
   ::pasta::Stmt IfStatement(void) const;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPMetaDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPMetaDirective)
 };
 
+struct OMPMetaDirectiveSnapshot : public OMPExecutableDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPMetaDirective));
 
 class OMPOrderedDirective : public OMPExecutableDirective {
@@ -2758,13 +3537,18 @@ class OMPOrderedDirective : public OMPExecutableDirective {
   using OMPExecutableDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPOrderedDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {70, 71};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPOrderedDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPOrderedDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPOrderedDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPOrderedDirective)
 };
 
+struct OMPOrderedDirectiveSnapshot : public OMPExecutableDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPOrderedDirective));
 
 class OMPParallelDirective : public OMPExecutableDirective {
@@ -2772,15 +3556,21 @@ class OMPParallelDirective : public OMPExecutableDirective {
   using OMPExecutableDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPParallelDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {71, 72};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPParallelDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPParallelDirective)
   ::pasta::Expr TaskReductionReferenceExpression(void) const;
   bool HasCancel(void) const;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPParallelDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPParallelDirective)
 };
 
+struct OMPParallelDirectiveSnapshot : public OMPExecutableDirectiveSnapshot {
+  bool has_cancel;
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPParallelDirective));
 
 class OMPParallelForDirective : public OMPLoopDirective {
@@ -2788,6 +3578,7 @@ class OMPParallelForDirective : public OMPLoopDirective {
   using OMPLoopDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPParallelForDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {41, 42};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPParallelForDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPParallelForDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPParallelForDirective)
@@ -2795,10 +3586,15 @@ class OMPParallelForDirective : public OMPLoopDirective {
   ::pasta::Expr TaskReductionReferenceExpression(void) const;
   bool HasCancel(void) const;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPParallelForDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPParallelForDirective)
 };
 
+struct OMPParallelForDirectiveSnapshot : public OMPLoopDirectiveSnapshot {
+  bool has_cancel;
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPParallelForDirective));
 
 class OMPParallelForSimdDirective : public OMPLoopDirective {
@@ -2806,15 +3602,20 @@ class OMPParallelForSimdDirective : public OMPLoopDirective {
   using OMPLoopDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPParallelForSimdDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {42, 43};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPParallelForSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPParallelForSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPParallelForSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPParallelForSimdDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPParallelForSimdDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPParallelForSimdDirective)
 };
 
+struct OMPParallelForSimdDirectiveSnapshot : public OMPLoopDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPParallelForSimdDirective));
 
 class OMPParallelGenericLoopDirective : public OMPLoopDirective {
@@ -2822,15 +3623,20 @@ class OMPParallelGenericLoopDirective : public OMPLoopDirective {
   using OMPLoopDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPParallelGenericLoopDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {43, 44};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPParallelGenericLoopDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPParallelGenericLoopDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPParallelGenericLoopDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPParallelGenericLoopDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPParallelGenericLoopDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPParallelGenericLoopDirective)
 };
 
+struct OMPParallelGenericLoopDirectiveSnapshot : public OMPLoopDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPParallelGenericLoopDirective));
 
 class OMPParallelMaskedDirective : public OMPExecutableDirective {
@@ -2838,14 +3644,19 @@ class OMPParallelMaskedDirective : public OMPExecutableDirective {
   using OMPExecutableDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPParallelMaskedDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {72, 73};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPParallelMaskedDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPParallelMaskedDirective)
   ::pasta::Expr TaskReductionReferenceExpression(void) const;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPParallelMaskedDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPParallelMaskedDirective)
 };
 
+struct OMPParallelMaskedDirectiveSnapshot : public OMPExecutableDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPParallelMaskedDirective));
 
 class OMPParallelMaskedTaskLoopDirective : public OMPLoopDirective {
@@ -2853,16 +3664,22 @@ class OMPParallelMaskedTaskLoopDirective : public OMPLoopDirective {
   using OMPLoopDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPParallelMaskedTaskLoopDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {44, 45};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPParallelMaskedTaskLoopDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPParallelMaskedTaskLoopDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPParallelMaskedTaskLoopDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPParallelMaskedTaskLoopDirective)
   bool HasCancel(void) const;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPParallelMaskedTaskLoopDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPParallelMaskedTaskLoopDirective)
 };
 
+struct OMPParallelMaskedTaskLoopDirectiveSnapshot : public OMPLoopDirectiveSnapshot {
+  bool has_cancel;
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPParallelMaskedTaskLoopDirective));
 
 class OMPParallelMaskedTaskLoopSimdDirective : public OMPLoopDirective {
@@ -2870,15 +3687,20 @@ class OMPParallelMaskedTaskLoopSimdDirective : public OMPLoopDirective {
   using OMPLoopDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPParallelMaskedTaskLoopSimdDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {45, 46};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPParallelMaskedTaskLoopSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPParallelMaskedTaskLoopSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPParallelMaskedTaskLoopSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPParallelMaskedTaskLoopSimdDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPParallelMaskedTaskLoopSimdDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPParallelMaskedTaskLoopSimdDirective)
 };
 
+struct OMPParallelMaskedTaskLoopSimdDirectiveSnapshot : public OMPLoopDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPParallelMaskedTaskLoopSimdDirective));
 
 class OMPParallelMasterDirective : public OMPExecutableDirective {
@@ -2886,14 +3708,19 @@ class OMPParallelMasterDirective : public OMPExecutableDirective {
   using OMPExecutableDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPParallelMasterDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {73, 74};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPParallelMasterDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPParallelMasterDirective)
   ::pasta::Expr TaskReductionReferenceExpression(void) const;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPParallelMasterDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPParallelMasterDirective)
 };
 
+struct OMPParallelMasterDirectiveSnapshot : public OMPExecutableDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPParallelMasterDirective));
 
 class OMPParallelMasterTaskLoopDirective : public OMPLoopDirective {
@@ -2901,16 +3728,22 @@ class OMPParallelMasterTaskLoopDirective : public OMPLoopDirective {
   using OMPLoopDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPParallelMasterTaskLoopDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {46, 47};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPParallelMasterTaskLoopDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPParallelMasterTaskLoopDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPParallelMasterTaskLoopDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPParallelMasterTaskLoopDirective)
   bool HasCancel(void) const;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPParallelMasterTaskLoopDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPParallelMasterTaskLoopDirective)
 };
 
+struct OMPParallelMasterTaskLoopDirectiveSnapshot : public OMPLoopDirectiveSnapshot {
+  bool has_cancel;
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPParallelMasterTaskLoopDirective));
 
 class OMPParallelMasterTaskLoopSimdDirective : public OMPLoopDirective {
@@ -2918,15 +3751,20 @@ class OMPParallelMasterTaskLoopSimdDirective : public OMPLoopDirective {
   using OMPLoopDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPParallelMasterTaskLoopSimdDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {47, 48};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPParallelMasterTaskLoopSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPParallelMasterTaskLoopSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPParallelMasterTaskLoopSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPParallelMasterTaskLoopSimdDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPParallelMasterTaskLoopSimdDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPParallelMasterTaskLoopSimdDirective)
 };
 
+struct OMPParallelMasterTaskLoopSimdDirectiveSnapshot : public OMPLoopDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPParallelMasterTaskLoopSimdDirective));
 
 class OMPParallelSectionsDirective : public OMPExecutableDirective {
@@ -2934,15 +3772,21 @@ class OMPParallelSectionsDirective : public OMPExecutableDirective {
   using OMPExecutableDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPParallelSectionsDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {74, 75};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPParallelSectionsDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPParallelSectionsDirective)
   ::pasta::Expr TaskReductionReferenceExpression(void) const;
   bool HasCancel(void) const;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPParallelSectionsDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPParallelSectionsDirective)
 };
 
+struct OMPParallelSectionsDirectiveSnapshot : public OMPExecutableDirectiveSnapshot {
+  bool has_cancel;
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPParallelSectionsDirective));
 
 class OMPScanDirective : public OMPExecutableDirective {
@@ -2950,13 +3794,18 @@ class OMPScanDirective : public OMPExecutableDirective {
   using OMPExecutableDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPScanDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {75, 76};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPScanDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPScanDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPScanDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPScanDirective)
 };
 
+struct OMPScanDirectiveSnapshot : public OMPExecutableDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPScanDirective));
 
 class OMPSectionDirective : public OMPExecutableDirective {
@@ -2964,14 +3813,20 @@ class OMPSectionDirective : public OMPExecutableDirective {
   using OMPExecutableDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPSectionDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {76, 77};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPSectionDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPSectionDirective)
   bool HasCancel(void) const;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPSectionDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPSectionDirective)
 };
 
+struct OMPSectionDirectiveSnapshot : public OMPExecutableDirectiveSnapshot {
+  bool has_cancel;
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPSectionDirective));
 
 class OMPSectionsDirective : public OMPExecutableDirective {
@@ -2979,15 +3834,21 @@ class OMPSectionsDirective : public OMPExecutableDirective {
   using OMPExecutableDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPSectionsDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {77, 78};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPSectionsDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPSectionsDirective)
   ::pasta::Expr TaskReductionReferenceExpression(void) const;
   bool HasCancel(void) const;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPSectionsDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPSectionsDirective)
 };
 
+struct OMPSectionsDirectiveSnapshot : public OMPExecutableDirectiveSnapshot {
+  bool has_cancel;
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPSectionsDirective));
 
 class OMPSimdDirective : public OMPLoopDirective {
@@ -2995,15 +3856,20 @@ class OMPSimdDirective : public OMPLoopDirective {
   using OMPLoopDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPSimdDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {48, 49};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPSimdDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPSimdDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPSimdDirective)
 };
 
+struct OMPSimdDirectiveSnapshot : public OMPLoopDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPSimdDirective));
 
 class OMPSingleDirective : public OMPExecutableDirective {
@@ -3011,13 +3877,18 @@ class OMPSingleDirective : public OMPExecutableDirective {
   using OMPExecutableDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPSingleDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {78, 79};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPSingleDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPSingleDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPSingleDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPSingleDirective)
 };
 
+struct OMPSingleDirectiveSnapshot : public OMPExecutableDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPSingleDirective));
 
 class OMPTargetDataDirective : public OMPExecutableDirective {
@@ -3025,13 +3896,18 @@ class OMPTargetDataDirective : public OMPExecutableDirective {
   using OMPExecutableDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPTargetDataDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {79, 80};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPTargetDataDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPTargetDataDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPTargetDataDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPTargetDataDirective)
 };
 
+struct OMPTargetDataDirectiveSnapshot : public OMPExecutableDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPTargetDataDirective));
 
 class OMPTargetDirective : public OMPExecutableDirective {
@@ -3039,13 +3915,18 @@ class OMPTargetDirective : public OMPExecutableDirective {
   using OMPExecutableDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPTargetDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {80, 81};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPTargetDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPTargetDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPTargetDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPTargetDirective)
 };
 
+struct OMPTargetDirectiveSnapshot : public OMPExecutableDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPTargetDirective));
 
 class OMPTargetEnterDataDirective : public OMPExecutableDirective {
@@ -3053,13 +3934,18 @@ class OMPTargetEnterDataDirective : public OMPExecutableDirective {
   using OMPExecutableDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPTargetEnterDataDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {81, 82};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPTargetEnterDataDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPTargetEnterDataDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPTargetEnterDataDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPTargetEnterDataDirective)
 };
 
+struct OMPTargetEnterDataDirectiveSnapshot : public OMPExecutableDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPTargetEnterDataDirective));
 
 class OMPTargetExitDataDirective : public OMPExecutableDirective {
@@ -3067,13 +3953,18 @@ class OMPTargetExitDataDirective : public OMPExecutableDirective {
   using OMPExecutableDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPTargetExitDataDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {82, 83};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPTargetExitDataDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPTargetExitDataDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPTargetExitDataDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPTargetExitDataDirective)
 };
 
+struct OMPTargetExitDataDirectiveSnapshot : public OMPExecutableDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPTargetExitDataDirective));
 
 class OMPTargetParallelDirective : public OMPExecutableDirective {
@@ -3081,15 +3972,21 @@ class OMPTargetParallelDirective : public OMPExecutableDirective {
   using OMPExecutableDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPTargetParallelDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {83, 84};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPTargetParallelDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPTargetParallelDirective)
   ::pasta::Expr TaskReductionReferenceExpression(void) const;
   bool HasCancel(void) const;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPTargetParallelDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPTargetParallelDirective)
 };
 
+struct OMPTargetParallelDirectiveSnapshot : public OMPExecutableDirectiveSnapshot {
+  bool has_cancel;
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPTargetParallelDirective));
 
 class OMPTargetParallelForDirective : public OMPLoopDirective {
@@ -3097,6 +3994,7 @@ class OMPTargetParallelForDirective : public OMPLoopDirective {
   using OMPLoopDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPTargetParallelForDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {49, 50};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPTargetParallelForDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPTargetParallelForDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPTargetParallelForDirective)
@@ -3104,10 +4002,15 @@ class OMPTargetParallelForDirective : public OMPLoopDirective {
   ::pasta::Expr TaskReductionReferenceExpression(void) const;
   bool HasCancel(void) const;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPTargetParallelForDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPTargetParallelForDirective)
 };
 
+struct OMPTargetParallelForDirectiveSnapshot : public OMPLoopDirectiveSnapshot {
+  bool has_cancel;
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPTargetParallelForDirective));
 
 class OMPTargetParallelForSimdDirective : public OMPLoopDirective {
@@ -3115,15 +4018,20 @@ class OMPTargetParallelForSimdDirective : public OMPLoopDirective {
   using OMPLoopDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPTargetParallelForSimdDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {50, 51};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPTargetParallelForSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPTargetParallelForSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPTargetParallelForSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPTargetParallelForSimdDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPTargetParallelForSimdDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPTargetParallelForSimdDirective)
 };
 
+struct OMPTargetParallelForSimdDirectiveSnapshot : public OMPLoopDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPTargetParallelForSimdDirective));
 
 class OMPTargetParallelGenericLoopDirective : public OMPLoopDirective {
@@ -3131,15 +4039,20 @@ class OMPTargetParallelGenericLoopDirective : public OMPLoopDirective {
   using OMPLoopDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPTargetParallelGenericLoopDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {51, 52};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPTargetParallelGenericLoopDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPTargetParallelGenericLoopDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPTargetParallelGenericLoopDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPTargetParallelGenericLoopDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPTargetParallelGenericLoopDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPTargetParallelGenericLoopDirective)
 };
 
+struct OMPTargetParallelGenericLoopDirectiveSnapshot : public OMPLoopDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPTargetParallelGenericLoopDirective));
 
 class OMPTargetSimdDirective : public OMPLoopDirective {
@@ -3147,15 +4060,20 @@ class OMPTargetSimdDirective : public OMPLoopDirective {
   using OMPLoopDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPTargetSimdDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {52, 53};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPTargetSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPTargetSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPTargetSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPTargetSimdDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPTargetSimdDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPTargetSimdDirective)
 };
 
+struct OMPTargetSimdDirectiveSnapshot : public OMPLoopDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPTargetSimdDirective));
 
 class OMPTargetTeamsDirective : public OMPExecutableDirective {
@@ -3163,13 +4081,18 @@ class OMPTargetTeamsDirective : public OMPExecutableDirective {
   using OMPExecutableDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPTargetTeamsDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {84, 85};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPTargetTeamsDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPTargetTeamsDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPTargetTeamsDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPTargetTeamsDirective)
 };
 
+struct OMPTargetTeamsDirectiveSnapshot : public OMPExecutableDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPTargetTeamsDirective));
 
 class OMPTargetTeamsDistributeDirective : public OMPLoopDirective {
@@ -3177,15 +4100,20 @@ class OMPTargetTeamsDistributeDirective : public OMPLoopDirective {
   using OMPLoopDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPTargetTeamsDistributeDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {53, 54};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPTargetTeamsDistributeDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPTargetTeamsDistributeDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPTargetTeamsDistributeDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPTargetTeamsDistributeDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPTargetTeamsDistributeDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPTargetTeamsDistributeDirective)
 };
 
+struct OMPTargetTeamsDistributeDirectiveSnapshot : public OMPLoopDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPTargetTeamsDistributeDirective));
 
 class OMPTargetTeamsDistributeParallelForDirective : public OMPLoopDirective {
@@ -3193,6 +4121,7 @@ class OMPTargetTeamsDistributeParallelForDirective : public OMPLoopDirective {
   using OMPLoopDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPTargetTeamsDistributeParallelForDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {54, 55};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPTargetTeamsDistributeParallelForDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPTargetTeamsDistributeParallelForDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPTargetTeamsDistributeParallelForDirective)
@@ -3200,10 +4129,15 @@ class OMPTargetTeamsDistributeParallelForDirective : public OMPLoopDirective {
   ::pasta::Expr TaskReductionReferenceExpression(void) const;
   bool HasCancel(void) const;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPTargetTeamsDistributeParallelForDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPTargetTeamsDistributeParallelForDirective)
 };
 
+struct OMPTargetTeamsDistributeParallelForDirectiveSnapshot : public OMPLoopDirectiveSnapshot {
+  bool has_cancel;
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPTargetTeamsDistributeParallelForDirective));
 
 class OMPTargetTeamsDistributeParallelForSimdDirective : public OMPLoopDirective {
@@ -3211,15 +4145,20 @@ class OMPTargetTeamsDistributeParallelForSimdDirective : public OMPLoopDirective
   using OMPLoopDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPTargetTeamsDistributeParallelForSimdDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {55, 56};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPTargetTeamsDistributeParallelForSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPTargetTeamsDistributeParallelForSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPTargetTeamsDistributeParallelForSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPTargetTeamsDistributeParallelForSimdDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPTargetTeamsDistributeParallelForSimdDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPTargetTeamsDistributeParallelForSimdDirective)
 };
 
+struct OMPTargetTeamsDistributeParallelForSimdDirectiveSnapshot : public OMPLoopDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPTargetTeamsDistributeParallelForSimdDirective));
 
 class OMPTargetTeamsDistributeSimdDirective : public OMPLoopDirective {
@@ -3227,15 +4166,20 @@ class OMPTargetTeamsDistributeSimdDirective : public OMPLoopDirective {
   using OMPLoopDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPTargetTeamsDistributeSimdDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {56, 57};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPTargetTeamsDistributeSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPTargetTeamsDistributeSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPTargetTeamsDistributeSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPTargetTeamsDistributeSimdDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPTargetTeamsDistributeSimdDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPTargetTeamsDistributeSimdDirective)
 };
 
+struct OMPTargetTeamsDistributeSimdDirectiveSnapshot : public OMPLoopDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPTargetTeamsDistributeSimdDirective));
 
 class OMPTargetTeamsGenericLoopDirective : public OMPLoopDirective {
@@ -3243,15 +4187,20 @@ class OMPTargetTeamsGenericLoopDirective : public OMPLoopDirective {
   using OMPLoopDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPTargetTeamsGenericLoopDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {57, 58};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPTargetTeamsGenericLoopDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPTargetTeamsGenericLoopDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPTargetTeamsGenericLoopDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPTargetTeamsGenericLoopDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPTargetTeamsGenericLoopDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPTargetTeamsGenericLoopDirective)
 };
 
+struct OMPTargetTeamsGenericLoopDirectiveSnapshot : public OMPLoopDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPTargetTeamsGenericLoopDirective));
 
 class OMPTargetUpdateDirective : public OMPExecutableDirective {
@@ -3259,13 +4208,18 @@ class OMPTargetUpdateDirective : public OMPExecutableDirective {
   using OMPExecutableDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPTargetUpdateDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {85, 86};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPTargetUpdateDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPTargetUpdateDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPTargetUpdateDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPTargetUpdateDirective)
 };
 
+struct OMPTargetUpdateDirectiveSnapshot : public OMPExecutableDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPTargetUpdateDirective));
 
 class OMPTaskDirective : public OMPExecutableDirective {
@@ -3273,14 +4227,20 @@ class OMPTaskDirective : public OMPExecutableDirective {
   using OMPExecutableDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPTaskDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {86, 87};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPTaskDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPTaskDirective)
   bool HasCancel(void) const;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPTaskDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPTaskDirective)
 };
 
+struct OMPTaskDirectiveSnapshot : public OMPExecutableDirectiveSnapshot {
+  bool has_cancel;
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPTaskDirective));
 
 class OMPTaskLoopDirective : public OMPLoopDirective {
@@ -3288,16 +4248,22 @@ class OMPTaskLoopDirective : public OMPLoopDirective {
   using OMPLoopDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPTaskLoopDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {58, 59};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPTaskLoopDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPTaskLoopDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPTaskLoopDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPTaskLoopDirective)
   bool HasCancel(void) const;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPTaskLoopDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPTaskLoopDirective)
 };
 
+struct OMPTaskLoopDirectiveSnapshot : public OMPLoopDirectiveSnapshot {
+  bool has_cancel;
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPTaskLoopDirective));
 
 class OMPTaskLoopSimdDirective : public OMPLoopDirective {
@@ -3305,15 +4271,20 @@ class OMPTaskLoopSimdDirective : public OMPLoopDirective {
   using OMPLoopDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPTaskLoopSimdDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {59, 60};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPTaskLoopSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPTaskLoopSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPTaskLoopSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPTaskLoopSimdDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPTaskLoopSimdDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPTaskLoopSimdDirective)
 };
 
+struct OMPTaskLoopSimdDirectiveSnapshot : public OMPLoopDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPTaskLoopSimdDirective));
 
 class OMPTaskgroupDirective : public OMPExecutableDirective {
@@ -3321,14 +4292,19 @@ class OMPTaskgroupDirective : public OMPExecutableDirective {
   using OMPExecutableDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPTaskgroupDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {87, 88};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPTaskgroupDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPTaskgroupDirective)
   ::pasta::Expr ReductionReference(void) const;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPTaskgroupDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPTaskgroupDirective)
 };
 
+struct OMPTaskgroupDirectiveSnapshot : public OMPExecutableDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPTaskgroupDirective));
 
 class OMPTaskwaitDirective : public OMPExecutableDirective {
@@ -3336,13 +4312,18 @@ class OMPTaskwaitDirective : public OMPExecutableDirective {
   using OMPExecutableDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPTaskwaitDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {88, 89};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPTaskwaitDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPTaskwaitDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPTaskwaitDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPTaskwaitDirective)
 };
 
+struct OMPTaskwaitDirectiveSnapshot : public OMPExecutableDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPTaskwaitDirective));
 
 class OMPTaskyieldDirective : public OMPExecutableDirective {
@@ -3350,13 +4331,18 @@ class OMPTaskyieldDirective : public OMPExecutableDirective {
   using OMPExecutableDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPTaskyieldDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {89, 90};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPTaskyieldDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPTaskyieldDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPTaskyieldDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPTaskyieldDirective)
 };
 
+struct OMPTaskyieldDirectiveSnapshot : public OMPExecutableDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPTaskyieldDirective));
 
 class OMPTeamsDirective : public OMPExecutableDirective {
@@ -3364,13 +4350,18 @@ class OMPTeamsDirective : public OMPExecutableDirective {
   using OMPExecutableDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPTeamsDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {90, 91};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPTeamsDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPTeamsDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPTeamsDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPTeamsDirective)
 };
 
+struct OMPTeamsDirectiveSnapshot : public OMPExecutableDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPTeamsDirective));
 
 class OMPTeamsDistributeDirective : public OMPLoopDirective {
@@ -3378,15 +4369,20 @@ class OMPTeamsDistributeDirective : public OMPLoopDirective {
   using OMPLoopDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPTeamsDistributeDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {60, 61};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPTeamsDistributeDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPTeamsDistributeDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPTeamsDistributeDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPTeamsDistributeDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPTeamsDistributeDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPTeamsDistributeDirective)
 };
 
+struct OMPTeamsDistributeDirectiveSnapshot : public OMPLoopDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPTeamsDistributeDirective));
 
 class OMPTeamsDistributeParallelForDirective : public OMPLoopDirective {
@@ -3394,6 +4390,7 @@ class OMPTeamsDistributeParallelForDirective : public OMPLoopDirective {
   using OMPLoopDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPTeamsDistributeParallelForDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {61, 62};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPTeamsDistributeParallelForDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPTeamsDistributeParallelForDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPTeamsDistributeParallelForDirective)
@@ -3401,10 +4398,15 @@ class OMPTeamsDistributeParallelForDirective : public OMPLoopDirective {
   ::pasta::Expr TaskReductionReferenceExpression(void) const;
   bool HasCancel(void) const;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPTeamsDistributeParallelForDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPTeamsDistributeParallelForDirective)
 };
 
+struct OMPTeamsDistributeParallelForDirectiveSnapshot : public OMPLoopDirectiveSnapshot {
+  bool has_cancel;
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPTeamsDistributeParallelForDirective));
 
 class OMPTeamsDistributeParallelForSimdDirective : public OMPLoopDirective {
@@ -3412,15 +4414,20 @@ class OMPTeamsDistributeParallelForSimdDirective : public OMPLoopDirective {
   using OMPLoopDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPTeamsDistributeParallelForSimdDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {62, 63};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPTeamsDistributeParallelForSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPTeamsDistributeParallelForSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPTeamsDistributeParallelForSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPTeamsDistributeParallelForSimdDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPTeamsDistributeParallelForSimdDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPTeamsDistributeParallelForSimdDirective)
 };
 
+struct OMPTeamsDistributeParallelForSimdDirectiveSnapshot : public OMPLoopDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPTeamsDistributeParallelForSimdDirective));
 
 class OMPTeamsDistributeSimdDirective : public OMPLoopDirective {
@@ -3428,15 +4435,20 @@ class OMPTeamsDistributeSimdDirective : public OMPLoopDirective {
   using OMPLoopDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPTeamsDistributeSimdDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {63, 64};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPTeamsDistributeSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPTeamsDistributeSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPTeamsDistributeSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPTeamsDistributeSimdDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPTeamsDistributeSimdDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPTeamsDistributeSimdDirective)
 };
 
+struct OMPTeamsDistributeSimdDirectiveSnapshot : public OMPLoopDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPTeamsDistributeSimdDirective));
 
 class OMPTeamsGenericLoopDirective : public OMPLoopDirective {
@@ -3444,15 +4456,20 @@ class OMPTeamsGenericLoopDirective : public OMPLoopDirective {
   using OMPLoopDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPTeamsGenericLoopDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {64, 65};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPTeamsGenericLoopDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPTeamsGenericLoopDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPTeamsGenericLoopDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPTeamsGenericLoopDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPTeamsGenericLoopDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPTeamsGenericLoopDirective)
 };
 
+struct OMPTeamsGenericLoopDirectiveSnapshot : public OMPLoopDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPTeamsGenericLoopDirective));
 
 class OMPTileDirective : public OMPLoopTransformationDirective {
@@ -3460,6 +4477,7 @@ class OMPTileDirective : public OMPLoopTransformationDirective {
   using OMPLoopTransformationDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPTileDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {65, 66};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPTileDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPTileDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopTransformationDirective, OMPTileDirective)
@@ -3467,10 +4485,14 @@ class OMPTileDirective : public OMPLoopTransformationDirective {
   ::pasta::Stmt PreInitializers(void) const;
   ::pasta::Stmt TransformedStatement(void) const;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPTileDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPTileDirective)
 };
 
+struct OMPTileDirectiveSnapshot : public OMPLoopTransformationDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPTileDirective));
 
 class OMPUnrollDirective : public OMPLoopTransformationDirective {
@@ -3478,6 +4500,7 @@ class OMPUnrollDirective : public OMPLoopTransformationDirective {
   using OMPLoopTransformationDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPUnrollDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {66, 67};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPUnrollDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPUnrollDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopTransformationDirective, OMPUnrollDirective)
@@ -3485,10 +4508,14 @@ class OMPUnrollDirective : public OMPLoopTransformationDirective {
   ::pasta::Stmt PreInitializers(void) const;
   ::pasta::Stmt TransformedStatement(void) const;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPUnrollDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPUnrollDirective)
 };
 
+struct OMPUnrollDirectiveSnapshot : public OMPLoopTransformationDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPUnrollDirective));
 
 class ObjCArrayLiteral : public Expr {
@@ -3496,10 +4523,11 @@ class ObjCArrayLiteral : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCArrayLiteral)
+  static constexpr ::pasta::detail::KindRange kKindRange = {192, 193};
   PASTA_DECLARE_BASE_OPERATORS(Expr, ObjCArrayLiteral)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ObjCArrayLiteral)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ObjCArrayLiteral)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::ObjCMethodDecl ArrayWithObjectsMethod(void) const;
   ::pasta::Token BeginToken(void) const;
   // Element: (const clang::Expr *)
@@ -3508,18 +4536,24 @@ class ObjCArrayLiteral : public Expr {
   uint32_t NumElements(void) const;
   ::pasta::TokenRange Tokens(void) const;
   std::vector<::pasta::Expr> Elements(void) const;
+  ::pasta::ObjCArrayLiteralSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCArrayLiteral)
 };
 
+struct ObjCArrayLiteralSnapshot : public ExprSnapshot {
+  uint32_t num_elements;
+};
+
 static_assert(sizeof(Stmt) == sizeof(ObjCArrayLiteral));
 
 class ObjCAtCatchStmt : public Stmt {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCAtCatchStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {91, 92};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ObjCAtCatchStmt)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token AtCatchToken(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Stmt CatchBody(void) const;
@@ -3527,68 +4561,94 @@ class ObjCAtCatchStmt : public Stmt {
   ::pasta::Token EndToken(void) const;
   ::pasta::Token RParenToken(void) const;
   bool HasEllipsis(void) const;
+  ::pasta::ObjCAtCatchStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCAtCatchStmt)
 };
 
+struct ObjCAtCatchStmtSnapshot : public StmtSnapshot {
+  uint32_t at_catch_token;
+  uint32_t r_paren_token;
+  bool has_ellipsis;
+};
+
 static_assert(sizeof(Stmt) == sizeof(ObjCAtCatchStmt));
 
 class ObjCAtFinallyStmt : public Stmt {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCAtFinallyStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {92, 93};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ObjCAtFinallyStmt)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token AtFinallyToken(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Stmt FinallyBody(void) const;
+  ::pasta::ObjCAtFinallyStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCAtFinallyStmt)
 };
 
+struct ObjCAtFinallyStmtSnapshot : public StmtSnapshot {
+  uint32_t at_finally_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(ObjCAtFinallyStmt));
 
 class ObjCAtSynchronizedStmt : public Stmt {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCAtSynchronizedStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {93, 94};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ObjCAtSynchronizedStmt)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token AtSynchronizedToken(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::CompoundStmt SynchBody(void) const;
   ::pasta::Expr SynchExpression(void) const;
+  ::pasta::ObjCAtSynchronizedStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCAtSynchronizedStmt)
 };
 
+struct ObjCAtSynchronizedStmtSnapshot : public StmtSnapshot {
+  uint32_t at_synchronized_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(ObjCAtSynchronizedStmt));
 
 class ObjCAtThrowStmt : public Stmt {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCAtThrowStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {94, 95};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ObjCAtThrowStmt)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Expr ThrowExpression(void) const;
   ::pasta::Token ThrowToken(void) const;
+  ::pasta::ObjCAtThrowStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCAtThrowStmt)
 };
 
+struct ObjCAtThrowStmtSnapshot : public StmtSnapshot {
+  uint32_t throw_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(ObjCAtThrowStmt));
 
 class ObjCAtTryStmt : public Stmt {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCAtTryStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {95, 96};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ObjCAtTryStmt)
   // CatchStatements: (llvm::iterator_range<clang::Stmt::CastIterator<clang::ObjCAtCatchStmt, const clang::ObjCAtCatchStmt *const, const clang::Stmt *const>>)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token AtTryToken(void) const;
   ::pasta::Token BeginToken(void) const;
   // CatchStatement: (const clang::ObjCAtCatchStmt *)
@@ -3597,26 +4657,38 @@ class ObjCAtTryStmt : public Stmt {
   uint32_t NumCatchStatements(void) const;
   ::pasta::Stmt TryBody(void) const;
   std::vector<::pasta::ObjCAtCatchStmt> CatchStatements(void) const;
+  ::pasta::ObjCAtTryStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCAtTryStmt)
 };
 
+struct ObjCAtTryStmtSnapshot : public StmtSnapshot {
+  uint32_t at_try_token;
+  uint32_t num_catch_statements;
+};
+
 static_assert(sizeof(Stmt) == sizeof(ObjCAtTryStmt));
 
 class ObjCAutoreleasePoolStmt : public Stmt {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCAutoreleasePoolStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {96, 97};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ObjCAutoreleasePoolStmt)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token AtToken(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Stmt SubStatement(void) const;
+  ::pasta::ObjCAutoreleasePoolStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCAutoreleasePoolStmt)
 };
 
+struct ObjCAutoreleasePoolStmtSnapshot : public StmtSnapshot {
+  uint32_t at_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(ObjCAutoreleasePoolStmt));
 
 class ObjCAvailabilityCheckExpr : public Expr {
@@ -3624,19 +4696,25 @@ class ObjCAvailabilityCheckExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCAvailabilityCheckExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {193, 194};
   PASTA_DECLARE_BASE_OPERATORS(Expr, ObjCAvailabilityCheckExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ObjCAvailabilityCheckExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ObjCAvailabilityCheckExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::TokenRange Tokens(void) const;
   // Version: (llvm::VersionTuple)
   bool HasVersion(void) const;
+  ::pasta::ObjCAvailabilityCheckExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCAvailabilityCheckExpr)
 };
 
+struct ObjCAvailabilityCheckExprSnapshot : public ExprSnapshot {
+  bool has_version;
+};
+
 static_assert(sizeof(Stmt) == sizeof(ObjCAvailabilityCheckExpr));
 
 class ObjCBoolLiteralExpr : public Expr {
@@ -3644,18 +4722,25 @@ class ObjCBoolLiteralExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCBoolLiteralExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {194, 195};
   PASTA_DECLARE_BASE_OPERATORS(Expr, ObjCBoolLiteralExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ObjCBoolLiteralExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ObjCBoolLiteralExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Token Token(void) const;
   bool Value(void) const;
+  ::pasta::ObjCBoolLiteralExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCBoolLiteralExpr)
 };
 
+struct ObjCBoolLiteralExprSnapshot : public ExprSnapshot {
+  uint32_t token;
+  bool value;
+};
+
 static_assert(sizeof(Stmt) == sizeof(ObjCBoolLiteralExpr));
 
 class ObjCBoxedExpr : public Expr {
@@ -3663,10 +4748,11 @@ class ObjCBoxedExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCBoxedExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {195, 196};
   PASTA_DECLARE_BASE_OPERATORS(Expr, ObjCBoxedExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ObjCBoxedExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ObjCBoxedExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token AtToken(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::ObjCMethodDecl BoxingMethod(void) const;
@@ -3674,10 +4760,16 @@ class ObjCBoxedExpr : public Expr {
   ::pasta::TokenRange Tokens(void) const;
   ::pasta::Expr SubExpression(void) const;
   bool IsExpressibleAsConstantInitializer(void) const;
+  ::pasta::ObjCBoxedExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCBoxedExpr)
 };
 
+struct ObjCBoxedExprSnapshot : public ExprSnapshot {
+  uint32_t at_token;
+  bool is_expressible_as_constant_initializer;
+};
+
 static_assert(sizeof(Stmt) == sizeof(ObjCBoxedExpr));
 
 class ObjCDictionaryLiteral : public Expr {
@@ -3685,20 +4777,26 @@ class ObjCDictionaryLiteral : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCDictionaryLiteral)
+  static constexpr ::pasta::detail::KindRange kKindRange = {196, 197};
   PASTA_DECLARE_BASE_OPERATORS(Expr, ObjCDictionaryLiteral)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ObjCDictionaryLiteral)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ObjCDictionaryLiteral)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::ObjCMethodDecl DictionaryWithObjectsMethod(void) const;
   ::pasta::Token EndToken(void) const;
   // KeyValueElement: (clang::ObjCDictionaryElement)
   uint32_t NumElements(void) const;
   ::pasta::TokenRange Tokens(void) const;
+  ::pasta::ObjCDictionaryLiteralSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCDictionaryLiteral)
 };
 
+struct ObjCDictionaryLiteralSnapshot : public ExprSnapshot {
+  uint32_t num_elements;
+};
+
 static_assert(sizeof(Stmt) == sizeof(ObjCDictionaryLiteral));
 
 class ObjCEncodeExpr : public Expr {
@@ -3706,27 +4804,35 @@ class ObjCEncodeExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCEncodeExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {197, 198};
   PASTA_DECLARE_BASE_OPERATORS(Expr, ObjCEncodeExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ObjCEncodeExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ObjCEncodeExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token AtToken(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Type EncodedType(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Token RParenToken(void) const;
+  ::pasta::ObjCEncodeExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCEncodeExpr)
 };
 
+struct ObjCEncodeExprSnapshot : public ExprSnapshot {
+  uint32_t at_token;
+  uint32_t r_paren_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(ObjCEncodeExpr));
 
 class ObjCForCollectionStmt : public Stmt {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCForCollectionStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {97, 98};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ObjCForCollectionStmt)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Stmt Body(void) const;
   ::pasta::Expr Collection(void) const;
@@ -3734,10 +4840,16 @@ class ObjCForCollectionStmt : public Stmt {
   ::pasta::Token EndToken(void) const;
   ::pasta::Token ForToken(void) const;
   ::pasta::Token RParenToken(void) const;
+  ::pasta::ObjCForCollectionStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCForCollectionStmt)
 };
 
+struct ObjCForCollectionStmtSnapshot : public StmtSnapshot {
+  uint32_t for_token;
+  uint32_t r_paren_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(ObjCForCollectionStmt));
 
 class ObjCIndirectCopyRestoreExpr : public Expr {
@@ -3745,19 +4857,25 @@ class ObjCIndirectCopyRestoreExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCIndirectCopyRestoreExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {198, 199};
   PASTA_DECLARE_BASE_OPERATORS(Expr, ObjCIndirectCopyRestoreExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ObjCIndirectCopyRestoreExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ObjCIndirectCopyRestoreExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Token ExpressionToken(void) const;
   ::pasta::Expr SubExpression(void) const;
   bool ShouldCopy(void) const;
+  ::pasta::ObjCIndirectCopyRestoreExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCIndirectCopyRestoreExpr)
 };
 
+struct ObjCIndirectCopyRestoreExprSnapshot : public ExprSnapshot {
+  bool should_copy;
+};
+
 static_assert(sizeof(Stmt) == sizeof(ObjCIndirectCopyRestoreExpr));
 
 class ObjCIsaExpr : public Expr {
@@ -3765,10 +4883,11 @@ class ObjCIsaExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCIsaExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {199, 200};
   PASTA_DECLARE_BASE_OPERATORS(Expr, ObjCIsaExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ObjCIsaExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ObjCIsaExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Expr Base(void) const;
   ::pasta::Token BaseTokenEnd(void) const;
   ::pasta::Token BeginToken(void) const;
@@ -3777,10 +4896,18 @@ class ObjCIsaExpr : public Expr {
   ::pasta::Token IsaMemberToken(void) const;
   ::pasta::Token OperationToken(void) const;
   bool IsArrow(void) const;
+  ::pasta::ObjCIsaExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCIsaExpr)
 };
 
+struct ObjCIsaExprSnapshot : public ExprSnapshot {
+  uint32_t base_token_end;
+  uint32_t isa_member_token;
+  uint32_t operation_token;
+  bool is_arrow;
+};
+
 static_assert(sizeof(Stmt) == sizeof(ObjCIsaExpr));
 
 class ObjCIvarRefExpr : public Expr {
@@ -3788,10 +4915,11 @@ class ObjCIvarRefExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCIvarRefExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {200, 201};
   PASTA_DECLARE_BASE_OPERATORS(Expr, ObjCIvarRefExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ObjCIvarRefExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ObjCIvarRefExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Expr Base(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::ObjCIvarDecl Declaration(void) const;
@@ -3800,10 +4928,18 @@ class ObjCIvarRefExpr : public Expr {
   ::pasta::Token OperationToken(void) const;
   bool IsArrow(void) const;
   bool IsFreeInstanceVariable(void) const;
+  ::pasta::ObjCIvarRefExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCIvarRefExpr)
 };
 
+struct ObjCIvarRefExprSnapshot : public ExprSnapshot {
+  uint32_t token;
+  uint32_t operation_token;
+  bool is_arrow;
+  bool is_free_instance_variable;
+};
+
 static_assert(sizeof(Stmt) == sizeof(ObjCIvarRefExpr));
 
 class ObjCMessageExpr : public Expr {
@@ -3811,11 +4947,12 @@ class ObjCMessageExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCMessageExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {201, 202};
   PASTA_DECLARE_BASE_OPERATORS(Expr, ObjCMessageExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ObjCMessageExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ObjCMessageExpr)
-  std::vector<::pasta::Expr> Arguments(void) const;
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Expr> Arguments(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   // Argument: (const clang::Expr *)
   // Arguments: (const clang::Expr *const *)
   ::pasta::Token BeginToken(void) const;
@@ -3843,10 +4980,26 @@ class ObjCMessageExpr : public Expr {
   bool IsImplicit(void) const;
   bool IsInstanceMessage(void) const;
   std::vector<::pasta::Token> SelectorTokens(void) const;
+  ::pasta::ObjCMessageExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCMessageExpr)
 };
 
+struct ObjCMessageExprSnapshot : public ExprSnapshot {
+  uint32_t left_token;
+  enum ObjCMethodFamily method_family;
+  uint32_t num_arguments;
+  uint32_t num_selector_tokens;
+  enum ObjCMessageExprReceiverKind receiver_kind;
+  uint32_t right_token;
+  uint32_t selector_start_token;
+  uint32_t super_token;
+  bool is_class_message;
+  bool is_delegate_initializer_call;
+  bool is_implicit;
+  bool is_instance_message;
+};
+
 static_assert(sizeof(Stmt) == sizeof(ObjCMessageExpr));
 
 class ObjCPropertyRefExpr : public Expr {
@@ -3854,10 +5007,11 @@ class ObjCPropertyRefExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCPropertyRefExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {202, 203};
   PASTA_DECLARE_BASE_OPERATORS(Expr, ObjCPropertyRefExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ObjCPropertyRefExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ObjCPropertyRefExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Expr Base(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::ObjCInterfaceDecl ClassReceiver(void) const;
@@ -3878,10 +5032,23 @@ class ObjCPropertyRefExpr : public Expr {
   bool IsMessagingSetter(void) const;
   bool IsObjectReceiver(void) const;
   bool IsSuperReceiver(void) const;
+  ::pasta::ObjCPropertyRefExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCPropertyRefExpr)
 };
 
+struct ObjCPropertyRefExprSnapshot : public ExprSnapshot {
+  uint32_t token;
+  uint32_t receiver_token;
+  bool is_class_receiver;
+  bool is_explicit_property;
+  bool is_implicit_property;
+  bool is_messaging_getter;
+  bool is_messaging_setter;
+  bool is_object_receiver;
+  bool is_super_receiver;
+};
+
 static_assert(sizeof(Stmt) == sizeof(ObjCPropertyRefExpr));
 
 class ObjCProtocolExpr : public Expr {
@@ -3889,20 +5056,28 @@ class ObjCProtocolExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCProtocolExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {203, 204};
   PASTA_DECLARE_BASE_OPERATORS(Expr, ObjCProtocolExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ObjCProtocolExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ObjCProtocolExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token AtToken(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::ObjCProtocolDecl Protocol(void) const;
   ::pasta::Token ProtocolIdToken(void) const;
   ::pasta::Token RParenToken(void) const;
+  ::pasta::ObjCProtocolExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCProtocolExpr)
 };
 
+struct ObjCProtocolExprSnapshot : public ExprSnapshot {
+  uint32_t at_token;
+  uint32_t protocol_id_token;
+  uint32_t r_paren_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(ObjCProtocolExpr));
 
 class ObjCSelectorExpr : public Expr {
@@ -3910,20 +5085,28 @@ class ObjCSelectorExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCSelectorExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {204, 205};
   PASTA_DECLARE_BASE_OPERATORS(Expr, ObjCSelectorExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ObjCSelectorExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ObjCSelectorExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token AtToken(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   uint32_t NumArguments(void) const;
   ::pasta::Token RParenToken(void) const;
   // Selector: (clang::Selector)
+  ::pasta::ObjCSelectorExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCSelectorExpr)
 };
 
+struct ObjCSelectorExprSnapshot : public ExprSnapshot {
+  uint32_t at_token;
+  uint32_t num_arguments;
+  uint32_t r_paren_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(ObjCSelectorExpr));
 
 class ObjCStringLiteral : public Expr {
@@ -3931,18 +5114,24 @@ class ObjCStringLiteral : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCStringLiteral)
+  static constexpr ::pasta::detail::KindRange kKindRange = {205, 206};
   PASTA_DECLARE_BASE_OPERATORS(Expr, ObjCStringLiteral)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ObjCStringLiteral)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ObjCStringLiteral)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token AtToken(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::StringLiteral String(void) const;
+  ::pasta::ObjCStringLiteralSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCStringLiteral)
 };
 
+struct ObjCStringLiteralSnapshot : public ExprSnapshot {
+  uint32_t at_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(ObjCStringLiteral));
 
 class ObjCSubscriptRefExpr : public Expr {
@@ -3950,10 +5139,11 @@ class ObjCSubscriptRefExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCSubscriptRefExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {206, 207};
   PASTA_DECLARE_BASE_OPERATORS(Expr, ObjCSubscriptRefExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ObjCSubscriptRefExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ObjCSubscriptRefExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::ObjCMethodDecl AtIndexMethodDeclaration(void) const;
   ::pasta::Expr BaseExpression(void) const;
   ::pasta::Token BeginToken(void) const;
@@ -3961,10 +5151,16 @@ class ObjCSubscriptRefExpr : public Expr {
   ::pasta::Expr KeyExpression(void) const;
   ::pasta::Token RBracketToken(void) const;
   bool IsArraySubscriptReferenceExpression(void) const;
+  ::pasta::ObjCSubscriptRefExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCSubscriptRefExpr)
 };
 
+struct ObjCSubscriptRefExprSnapshot : public ExprSnapshot {
+  uint32_t r_bracket_token;
+  bool is_array_subscript_reference_expression;
+};
+
 static_assert(sizeof(Stmt) == sizeof(ObjCSubscriptRefExpr));
 
 class OffsetOfExpr : public Expr {
@@ -3972,10 +5168,11 @@ class OffsetOfExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OffsetOfExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {207, 208};
   PASTA_DECLARE_BASE_OPERATORS(Expr, OffsetOfExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OffsetOfExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, OffsetOfExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   // Component: (const clang::OffsetOfNode &)
   ::pasta::Token EndToken(void) const;
@@ -3985,10 +5182,18 @@ class OffsetOfExpr : public Expr {
   ::pasta::Token OperatorToken(void) const;
   ::pasta::Token RParenToken(void) const;
   // !!! Component getNumComponents getComponent (empty ret type = (const clang::OffsetOfNode &))
+  ::pasta::OffsetOfExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OffsetOfExpr)
 };
 
+struct OffsetOfExprSnapshot : public ExprSnapshot {
+  uint32_t num_components;
+  uint32_t num_expressions;
+  uint32_t operator_token;
+  uint32_t r_paren_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(OffsetOfExpr));
 
 class OpaqueValueExpr : public Expr {
@@ -3996,20 +5201,27 @@ class OpaqueValueExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OpaqueValueExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {208, 209};
   PASTA_DECLARE_BASE_OPERATORS(Expr, OpaqueValueExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OpaqueValueExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, OpaqueValueExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Token ExpressionToken(void) const;
   ::pasta::Token Token(void) const;
   std::optional<::pasta::Expr> SourceExpression(void) const;
   bool IsUnique(void) const;
+  ::pasta::OpaqueValueExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OpaqueValueExpr)
 };
 
+struct OpaqueValueExprSnapshot : public ExprSnapshot {
+  uint32_t token;
+  bool is_unique;
+};
+
 static_assert(sizeof(Stmt) == sizeof(OpaqueValueExpr));
 
 class OverloadExpr : public Expr {
@@ -4017,6 +5229,7 @@ class OverloadExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OverloadExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {209, 211};
   PASTA_DECLARE_BASE_OPERATORS(Expr, OverloadExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OverloadExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, OverloadExpr)
@@ -4038,10 +5251,22 @@ class OverloadExpr : public Expr {
   bool HasExplicitTemplateArguments(void) const;
   bool HasTemplateKeyword(void) const;
   // TemplateArguments: (llvm::ArrayRef<clang::TemplateArgumentLoc>)
+  ::pasta::OverloadExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OverloadExpr)
 };
 
+struct OverloadExprSnapshot : public ExprSnapshot {
+  uint32_t l_angle_token;
+  uint32_t name_token;
+  uint32_t num_declarations;
+  uint32_t num_template_arguments;
+  uint32_t r_angle_token;
+  uint32_t template_keyword_token;
+  bool has_explicit_template_arguments;
+  bool has_template_keyword;
+};
+
 static_assert(sizeof(Stmt) == sizeof(OverloadExpr));
 
 class PackExpansionExpr : public Expr {
@@ -4049,19 +5274,25 @@ class PackExpansionExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(PackExpansionExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {211, 212};
   PASTA_DECLARE_BASE_OPERATORS(Expr, PackExpansionExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, PackExpansionExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, PackExpansionExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EllipsisToken(void) const;
   ::pasta::Token EndToken(void) const;
   std::optional<unsigned> NumExpansions(void) const;
   ::pasta::Expr Pattern(void) const;
+  ::pasta::PackExpansionExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(PackExpansionExpr)
 };
 
+struct PackExpansionExprSnapshot : public ExprSnapshot {
+  uint32_t ellipsis_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(PackExpansionExpr));
 
 class ParenExpr : public Expr {
@@ -4069,19 +5300,26 @@ class ParenExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ParenExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {212, 213};
   PASTA_DECLARE_BASE_OPERATORS(Expr, ParenExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ParenExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ParenExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Token LParenToken(void) const;
   ::pasta::Token RParenToken(void) const;
   ::pasta::Expr SubExpression(void) const;
+  ::pasta::ParenExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ParenExpr)
 };
 
+struct ParenExprSnapshot : public ExprSnapshot {
+  uint32_t l_paren_token;
+  uint32_t r_paren_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(ParenExpr));
 
 class ParenListExpr : public Expr {
@@ -4089,10 +5327,11 @@ class ParenListExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ParenListExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {213, 214};
   PASTA_DECLARE_BASE_OPERATORS(Expr, ParenListExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ParenListExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ParenListExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   // Expression: (const clang::Expr *)
@@ -4100,10 +5339,17 @@ class ParenListExpr : public Expr {
   uint32_t NumExpressions(void) const;
   ::pasta::Token RParenToken(void) const;
   std::vector<::pasta::Expr> Expressions(void) const;
+  ::pasta::ParenListExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ParenListExpr)
 };
 
+struct ParenListExprSnapshot : public ExprSnapshot {
+  uint32_t l_paren_token;
+  uint32_t num_expressions;
+  uint32_t r_paren_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(ParenListExpr));
 
 class PredefinedExpr : public Expr {
@@ -4111,10 +5357,11 @@ class PredefinedExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(PredefinedExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {214, 215};
   PASTA_DECLARE_BASE_OPERATORS(Expr, PredefinedExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, PredefinedExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, PredefinedExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   std::optional<::pasta::StringLiteral> FunctionName(void) const;
@@ -4122,10 +5369,17 @@ class PredefinedExpr : public Expr {
   std::string_view IdentifierKindName(void) const;
   ::pasta::Token Token(void) const;
   bool IsTransparent(void) const;
+  ::pasta::PredefinedExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(PredefinedExpr)
 };
 
+struct PredefinedExprSnapshot : public ExprSnapshot {
+  enum PredefinedExprIdentKind identifier_kind;
+  uint32_t token;
+  bool is_transparent;
+};
+
 static_assert(sizeof(Stmt) == sizeof(PredefinedExpr));
 
 class PseudoObjectExpr : public Expr {
@@ -4133,10 +5387,11 @@ class PseudoObjectExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(PseudoObjectExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {215, 216};
   PASTA_DECLARE_BASE_OPERATORS(Expr, PseudoObjectExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, PseudoObjectExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, PseudoObjectExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Token ExpressionToken(void) const;
@@ -4145,12 +5400,18 @@ class PseudoObjectExpr : public Expr {
   uint32_t ResultExpressionIndex(void) const;
   // SemanticExpression: (const clang::Expr *)
   ::pasta::Expr SyntacticForm(void) const;
-  std::vector<::pasta::Expr> Semantics(void) const;
+  ::pasta::LazyRange<::pasta::Expr> Semantics(void) const;
   std::vector<::pasta::Expr> SemanticExpressions(void) const;
+  ::pasta::PseudoObjectExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(PseudoObjectExpr)
 };
 
+struct PseudoObjectExprSnapshot : public ExprSnapshot {
+  uint32_t num_semantic_expressions;
+  uint32_t result_expression_index;
+};
+
 static_assert(sizeof(Stmt) == sizeof(PseudoObjectExpr));
 
 class RecoveryExpr : public Expr {
@@ -4158,16 +5419,21 @@ class RecoveryExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(RecoveryExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {216, 217};
   PASTA_DECLARE_BASE_OPERATORS(Expr, RecoveryExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, RecoveryExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, RecoveryExpr)
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
-  std::vector<::pasta::Expr> SubExpressions(void) const;
+  ::pasta::LazyRange<::pasta::Expr> SubExpressions(void) const;
+  ::pasta::RecoveryExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(RecoveryExpr)
 };
 
+struct RecoveryExprSnapshot : public ExprSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(RecoveryExpr));
 
 class RequiresExpr : public Expr {
@@ -4175,95 +5441,128 @@ class RequiresExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(RequiresExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {217, 218};
   PASTA_DECLARE_BASE_OPERATORS(Expr, RequiresExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, RequiresExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, RequiresExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::RequiresExprBodyDecl Body(void) const;
   ::pasta::Token EndToken(void) const;
-  std::vector<::pasta::ParmVarDecl> LocalParameters(void) const;
+  ::pasta::LazyRange<::pasta::ParmVarDecl> LocalParameters(void) const;
   ::pasta::Token RBraceToken(void) const;
   // Requirements: (llvm::ArrayRef<clang::concepts::Requirement *>)
   ::pasta::Token RequiresKeywordToken(void) const;
   bool IsSatisfied(void) const;
+  ::pasta::RequiresExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(RequiresExpr)
 };
 
+struct RequiresExprSnapshot : public ExprSnapshot {
+  uint32_t r_brace_token;
+  uint32_t requires_keyword_token;
+  bool is_satisfied{};
+};
+
 static_assert(sizeof(Stmt) == sizeof(RequiresExpr));
 
 class ReturnStmt : public Stmt {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ReturnStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {98, 99};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ReturnStmt)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   std::optional<::pasta::VarDecl> NRVOCandidate(void) const;
   std::optional<::pasta::Expr> ReturnValue(void) const;
   ::pasta::Token ReturnToken(void) const;
+  ::pasta::ReturnStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ReturnStmt)
 };
 
+struct ReturnStmtSnapshot : public StmtSnapshot {
+  uint32_t return_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(ReturnStmt));
 
 class SEHExceptStmt : public Stmt {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(SEHExceptStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {99, 100};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, SEHExceptStmt)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::CompoundStmt Block(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Token ExceptToken(void) const;
   ::pasta::Expr FilterExpression(void) const;
+  ::pasta::SEHExceptStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(SEHExceptStmt)
 };
 
+struct SEHExceptStmtSnapshot : public StmtSnapshot {
+  uint32_t except_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(SEHExceptStmt));
 
 class SEHFinallyStmt : public Stmt {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(SEHFinallyStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {100, 101};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, SEHFinallyStmt)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::CompoundStmt Block(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Token FinallyToken(void) const;
+  ::pasta::SEHFinallyStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(SEHFinallyStmt)
 };
 
+struct SEHFinallyStmtSnapshot : public StmtSnapshot {
+  uint32_t finally_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(SEHFinallyStmt));
 
 class SEHLeaveStmt : public Stmt {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(SEHLeaveStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {101, 102};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, SEHLeaveStmt)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Token LeaveToken(void) const;
+  ::pasta::SEHLeaveStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(SEHLeaveStmt)
 };
 
+struct SEHLeaveStmtSnapshot : public StmtSnapshot {
+  uint32_t leave_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(SEHLeaveStmt));
 
 class SEHTryStmt : public Stmt {
  private:
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(SEHTryStmt)
+  static constexpr ::pasta::detail::KindRange kKindRange = {102, 103};
   PASTA_DECLARE_BASE_OPERATORS(Stmt, SEHTryStmt)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::SEHExceptStmt ExceptHandler(void) const;
@@ -4272,10 +5571,16 @@ class SEHTryStmt : public Stmt {
   bool IsCXXTry(void) const;
   ::pasta::CompoundStmt TryBlock(void) const;
   ::pasta::Token TryToken(void) const;
+  ::pasta::SEHTryStmtSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(SEHTryStmt)
 };
 
+struct SEHTryStmtSnapshot : public StmtSnapshot {
+  bool is_cxx_try;
+  uint32_t try_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(SEHTryStmt));
 
 class SYCLUniqueStableNameExpr : public Expr {
@@ -4283,20 +5588,28 @@ class SYCLUniqueStableNameExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(SYCLUniqueStableNameExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {218, 219};
   PASTA_DECLARE_BASE_OPERATORS(Expr, SYCLUniqueStableNameExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, SYCLUniqueStableNameExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, SYCLUniqueStableNameExpr)
   std::string ComputeName(void) const;
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Token LParenToken(void) const;
   ::pasta::Token Token(void) const;
   ::pasta::Token RParenToken(void) const;
+  ::pasta::SYCLUniqueStableNameExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(SYCLUniqueStableNameExpr)
 };
 
+struct SYCLUniqueStableNameExprSnapshot : public ExprSnapshot {
+  uint32_t l_paren_token;
+  uint32_t token;
+  uint32_t r_paren_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(SYCLUniqueStableNameExpr));
 
 class ShuffleVectorExpr : public Expr {
@@ -4304,10 +5617,11 @@ class ShuffleVectorExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ShuffleVectorExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {219, 220};
   PASTA_DECLARE_BASE_OPERATORS(Expr, ShuffleVectorExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ShuffleVectorExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ShuffleVectorExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token BuiltinToken(void) const;
   ::pasta::Token EndToken(void) const;
@@ -4315,10 +5629,17 @@ class ShuffleVectorExpr : public Expr {
   uint32_t NumSubExpressions(void) const;
   ::pasta::Token RParenToken(void) const;
   // ShuffleMaskIndex: (llvm::APSInt)
+  ::pasta::ShuffleVectorExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ShuffleVectorExpr)
 };
 
+struct ShuffleVectorExprSnapshot : public ExprSnapshot {
+  uint32_t builtin_token;
+  uint32_t num_sub_expressions;
+  uint32_t r_paren_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(ShuffleVectorExpr));
 
 class SizeOfPackExpr : public Expr {
@@ -4326,10 +5647,11 @@ class SizeOfPackExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(SizeOfPackExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {220, 221};
   PASTA_DECLARE_BASE_OPERATORS(Expr, SizeOfPackExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, SizeOfPackExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, SizeOfPackExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Token OperatorToken(void) const;
@@ -4339,10 +5661,18 @@ class SizeOfPackExpr : public Expr {
   std::optional<std::vector<::pasta::TemplateArgument>> PartialArguments(void) const;
   ::pasta::Token RParenToken(void) const;
   bool IsPartiallySubstituted(void) const;
+  ::pasta::SizeOfPackExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(SizeOfPackExpr)
 };
 
+struct SizeOfPackExprSnapshot : public ExprSnapshot {
+  uint32_t operator_token;
+  uint32_t pack_token;
+  uint32_t r_paren_token;
+  bool is_partially_substituted;
+};
+
 static_assert(sizeof(Stmt) == sizeof(SizeOfPackExpr));
 
 class SourceLocExpr : public Expr {
@@ -4350,11 +5680,12 @@ class SourceLocExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(SourceLocExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {221, 222};
   PASTA_DECLARE_BASE_OPERATORS(Expr, SourceLocExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, SourceLocExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, SourceLocExpr)
   // EvaluateInContext: (clang::APValue)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   std::string_view BuiltinString(void) const;
   ::pasta::Token EndToken(void) const;
@@ -4362,10 +5693,17 @@ class SourceLocExpr : public Expr {
   ::pasta::Token Token(void) const;
   ::pasta::DeclContext ParentContext(void) const;
   bool IsIntType(void) const;
+  ::pasta::SourceLocExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(SourceLocExpr)
 };
 
+struct SourceLocExprSnapshot : public ExprSnapshot {
+  enum SourceLocExprIdentKind identifier_kind;
+  uint32_t token;
+  bool is_int_type;
+};
+
 static_assert(sizeof(Stmt) == sizeof(SourceLocExpr));
 
 class StmtExpr : public Expr {
@@ -4373,20 +5711,28 @@ class StmtExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(StmtExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {222, 223};
   PASTA_DECLARE_BASE_OPERATORS(Expr, StmtExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, StmtExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, StmtExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Token LParenToken(void) const;
   ::pasta::Token RParenToken(void) const;
   ::pasta::CompoundStmt SubStatement(void) const;
   uint32_t TemplateDepth(void) const;
+  ::pasta::StmtExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(StmtExpr)
 };
 
+struct StmtExprSnapshot : public ExprSnapshot {
+  uint32_t l_paren_token;
+  uint32_t r_paren_token;
+  uint32_t template_depth;
+};
+
 static_assert(sizeof(Stmt) == sizeof(StmtExpr));
 
 class StringLiteral : public Expr {
@@ -4394,10 +5740,11 @@ class StringLiteral : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(StringLiteral)
+  static constexpr ::pasta::detail::KindRange kKindRange = {223, 224};
   PASTA_DECLARE_BASE_OPERATORS(Expr, StringLiteral)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, StringLiteral)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, StringLiteral)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   std::optional<bool> ContainsNonAscii(void) const;
   std::optional<bool> ContainsNonAsciiOrNull(void) const;
   ::pasta::Token BeginToken(void) const;
@@ -4419,10 +5766,26 @@ class StringLiteral : public Expr {
   bool IsUTF8(void) const;
   bool IsUnevaluated(void) const;
   bool IsWide(void) const;
+  ::pasta::StringLiteralSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(StringLiteral)
 };
 
+struct StringLiteralSnapshot : public ExprSnapshot {
+  uint32_t byte_length;
+  uint32_t character_byte_width;
+  enum StringLiteralStringKind literal_kind;
+  uint32_t length;
+  uint32_t num_concatenated;
+  bool is_ordinary;
+  bool is_pascal;
+  bool is_utf16;
+  bool is_utf32;
+  bool is_utf8;
+  bool is_unevaluated;
+  bool is_wide;
+};
+
 static_assert(sizeof(Stmt) == sizeof(StringLiteral));
 
 class SubstNonTypeTemplateParmExpr : public Expr {
@@ -4430,10 +5793,11 @@ class SubstNonTypeTemplateParmExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(SubstNonTypeTemplateParmExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {224, 225};
   PASTA_DECLARE_BASE_OPERATORS(Expr, SubstNonTypeTemplateParmExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, SubstNonTypeTemplateParmExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, SubstNonTypeTemplateParmExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Decl AssociatedDeclaration(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
@@ -4444,10 +5808,17 @@ class SubstNonTypeTemplateParmExpr : public Expr {
   ::pasta::Type ParameterType(void) const;
   ::pasta::Expr Replacement(void) const;
   bool IsReferenceParameter(void) const;
+  ::pasta::SubstNonTypeTemplateParmExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(SubstNonTypeTemplateParmExpr)
 };
 
+struct SubstNonTypeTemplateParmExprSnapshot : public ExprSnapshot {
+  uint32_t index;
+  uint32_t name_token;
+  bool is_reference_parameter;
+};
+
 static_assert(sizeof(Stmt) == sizeof(SubstNonTypeTemplateParmExpr));
 
 class SubstNonTypeTemplateParmPackExpr : public Expr {
@@ -4455,10 +5826,11 @@ class SubstNonTypeTemplateParmPackExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(SubstNonTypeTemplateParmPackExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {225, 226};
   PASTA_DECLARE_BASE_OPERATORS(Expr, SubstNonTypeTemplateParmPackExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, SubstNonTypeTemplateParmPackExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, SubstNonTypeTemplateParmPackExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   // ArgumentPack: (clang::TemplateArgument)
   ::pasta::Decl AssociatedDeclaration(void) const;
   ::pasta::Token BeginToken(void) const;
@@ -4466,10 +5838,16 @@ class SubstNonTypeTemplateParmPackExpr : public Expr {
   uint32_t Index(void) const;
   ::pasta::NonTypeTemplateParmDecl ParameterPack(void) const;
   ::pasta::Token ParameterPackToken(void) const;
+  ::pasta::SubstNonTypeTemplateParmPackExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(SubstNonTypeTemplateParmPackExpr)
 };
 
+struct SubstNonTypeTemplateParmPackExprSnapshot : public ExprSnapshot {
+  uint32_t index;
+  uint32_t parameter_pack_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(SubstNonTypeTemplateParmPackExpr));
 
 class TypeTraitExpr : public Expr {
@@ -4477,10 +5855,11 @@ class TypeTraitExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(TypeTraitExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {226, 227};
   PASTA_DECLARE_BASE_OPERATORS(Expr, TypeTraitExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, TypeTraitExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, TypeTraitExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   // Argument: (clang::TypeSourceInfo *)
   // Arguments: (llvm::ArrayRef<clang::TypeSourceInfo *>)
   ::pasta::Token BeginToken(void) const;
@@ -4489,10 +5868,16 @@ class TypeTraitExpr : public Expr {
   enum TypeTrait Trait(void) const;
   std::optional<bool> Value(void) const;
   std::vector<::pasta::Type> Arguments(void) const;
+  ::pasta::TypeTraitExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(TypeTraitExpr)
 };
 
+struct TypeTraitExprSnapshot : public ExprSnapshot {
+  uint32_t num_arguments;
+  enum TypeTrait trait;
+};
+
 static_assert(sizeof(Stmt) == sizeof(TypeTraitExpr));
 
 class TypoExpr : public Expr {
@@ -4500,16 +5885,21 @@ class TypoExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(TypoExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {227, 228};
   PASTA_DECLARE_BASE_OPERATORS(Expr, TypoExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, TypoExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, TypoExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
+  ::pasta::TypoExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(TypoExpr)
 };
 
+struct TypoExprSnapshot : public ExprSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(TypoExpr));
 
 class UnaryExprOrTypeTraitExpr : public Expr {
@@ -4517,10 +5907,11 @@ class UnaryExprOrTypeTraitExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(UnaryExprOrTypeTraitExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {228, 229};
   PASTA_DECLARE_BASE_OPERATORS(Expr, UnaryExprOrTypeTraitExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, UnaryExprOrTypeTraitExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, UnaryExprOrTypeTraitExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   std::optional<::pasta::Expr> ArgumentExpression(void) const;
   std::optional<::pasta::Type> ArgumentType(void) const;
   ::pasta::Token BeginToken(void) const;
@@ -4530,10 +5921,18 @@ class UnaryExprOrTypeTraitExpr : public Expr {
   ::pasta::Token RParenToken(void) const;
   ::pasta::Type TypeOfArgument(void) const;
   bool IsArgumentType(void) const;
+  ::pasta::UnaryExprOrTypeTraitExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(UnaryExprOrTypeTraitExpr)
 };
 
+struct UnaryExprOrTypeTraitExprSnapshot : public ExprSnapshot {
+  enum UnaryExprOrTypeTrait keyword_kind;
+  uint32_t operator_token;
+  uint32_t r_paren_token;
+  bool is_argument_type;
+};
+
 static_assert(sizeof(Stmt) == sizeof(UnaryExprOrTypeTraitExpr));
 
 class UnaryOperator : public Expr {
@@ -4541,11 +5940,12 @@ class UnaryOperator : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(UnaryOperator)
+  static constexpr ::pasta::detail::KindRange kKindRange = {229, 230};
   PASTA_DECLARE_BASE_OPERATORS(Expr, UnaryOperator)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, UnaryOperator)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, UnaryOperator)
   bool CanOverflow(void) const;
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Token ExpressionToken(void) const;
@@ -4564,10 +5964,24 @@ class UnaryOperator : public Expr {
   bool IsIncrementOperation(void) const;
   bool IsPostfix(void) const;
   bool IsPrefix(void) const;
+  ::pasta::UnaryOperatorSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(UnaryOperator)
 };
 
+struct UnaryOperatorSnapshot : public ExprSnapshot {
+  bool can_overflow;
+  enum UnaryOperatorKind opcode;
+  uint32_t operator_token;
+  bool has_stored_fp_features;
+  bool is_arithmetic_operation;
+  bool is_decrement_operation;
+  bool is_increment_decrement_operation;
+  bool is_increment_operation;
+  bool is_postfix;
+  bool is_prefix;
+};
+
 static_assert(sizeof(Stmt) == sizeof(UnaryOperator));
 
 class UnresolvedLookupExpr : public OverloadExpr {
@@ -4575,20 +5989,27 @@ class UnresolvedLookupExpr : public OverloadExpr {
   using OverloadExpr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(UnresolvedLookupExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {209, 210};
   PASTA_DECLARE_BASE_OPERATORS(Expr, UnresolvedLookupExpr)
   PASTA_DECLARE_BASE_OPERATORS(OverloadExpr, UnresolvedLookupExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, UnresolvedLookupExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, UnresolvedLookupExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   std::optional<::pasta::CXXRecordDecl> NamingClass(void) const;
   bool IsOverloaded(void) const;
   bool RequiresADL(void) const;
+  ::pasta::UnresolvedLookupExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(UnresolvedLookupExpr)
 };
 
+struct UnresolvedLookupExprSnapshot : public OverloadExprSnapshot {
+  bool is_overloaded;
+  bool requires_adl;
+};
+
 static_assert(sizeof(Stmt) == sizeof(UnresolvedLookupExpr));
 
 class UnresolvedMemberExpr : public OverloadExpr {
@@ -4596,11 +6017,12 @@ class UnresolvedMemberExpr : public OverloadExpr {
   using OverloadExpr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(UnresolvedMemberExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {210, 211};
   PASTA_DECLARE_BASE_OPERATORS(Expr, UnresolvedMemberExpr)
   PASTA_DECLARE_BASE_OPERATORS(OverloadExpr, UnresolvedMemberExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, UnresolvedMemberExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, UnresolvedMemberExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Expr Base(void) const;
   ::pasta::Type BaseType(void) const;
   ::pasta::Token BeginToken(void) const;
@@ -4614,10 +6036,19 @@ class UnresolvedMemberExpr : public OverloadExpr {
   bool HasUnresolvedUsing(void) const;
   bool IsArrow(void) const;
   bool IsImplicitAccess(void) const;
+  ::pasta::UnresolvedMemberExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(UnresolvedMemberExpr)
 };
 
+struct UnresolvedMemberExprSnapshot : public OverloadExprSnapshot {
+  uint32_t member_token;
+  uint32_t operator_token;
+  bool has_unresolved_using;
+  bool is_arrow;
+  bool is_implicit_access;
+};
+
 static_assert(sizeof(Stmt) == sizeof(UnresolvedMemberExpr));
 
 class VAArgExpr : public Expr {
@@ -4625,20 +6056,28 @@ class VAArgExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(VAArgExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {230, 231};
   PASTA_DECLARE_BASE_OPERATORS(Expr, VAArgExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, VAArgExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, VAArgExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token BuiltinToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Token RParenToken(void) const;
   ::pasta::Expr SubExpression(void) const;
   bool IsMicrosoftABI(void) const;
+  ::pasta::VAArgExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(VAArgExpr)
 };
 
+struct VAArgExprSnapshot : public ExprSnapshot {
+  uint32_t builtin_token;
+  uint32_t r_paren_token;
+  bool is_microsoft_abi;
+};
+
 static_assert(sizeof(Stmt) == sizeof(VAArgExpr));
 
 class AbstractConditionalOperator : public Expr {
@@ -4646,6 +6085,7 @@ class AbstractConditionalOperator : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(AbstractConditionalOperator)
+  static constexpr ::pasta::detail::KindRange kKindRange = {107, 109};
   PASTA_DECLARE_BASE_OPERATORS(Expr, AbstractConditionalOperator)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, AbstractConditionalOperator)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, AbstractConditionalOperator)
@@ -4656,10 +6096,16 @@ class AbstractConditionalOperator : public Expr {
   ::pasta::Expr FalseExpression(void) const;
   ::pasta::Token QuestionToken(void) const;
   ::pasta::Expr TrueExpression(void) const;
+  ::pasta::AbstractConditionalOperatorSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(AbstractConditionalOperator)
 };
 
+struct AbstractConditionalOperatorSnapshot : public ExprSnapshot {
+  uint32_t colon_token;
+  uint32_t question_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(AbstractConditionalOperator));
 
 class AddrLabelExpr : public Expr {
@@ -4667,19 +6113,26 @@ class AddrLabelExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(AddrLabelExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {109, 110};
   PASTA_DECLARE_BASE_OPERATORS(Expr, AddrLabelExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, AddrLabelExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, AddrLabelExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token AmpAmpToken(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::LabelDecl Label(void) const;
   ::pasta::Token LabelToken(void) const;
+  ::pasta::AddrLabelExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(AddrLabelExpr)
 };
 
+struct AddrLabelExprSnapshot : public ExprSnapshot {
+  uint32_t amp_amp_token;
+  uint32_t label_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(AddrLabelExpr));
 
 class ArrayInitIndexExpr : public Expr {
@@ -4687,16 +6140,21 @@ class ArrayInitIndexExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ArrayInitIndexExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {110, 111};
   PASTA_DECLARE_BASE_OPERATORS(Expr, ArrayInitIndexExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ArrayInitIndexExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ArrayInitIndexExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
+  ::pasta::ArrayInitIndexExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ArrayInitIndexExpr)
 };
 
+struct ArrayInitIndexExprSnapshot : public ExprSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(ArrayInitIndexExpr));
 
 class ArrayInitLoopExpr : public Expr {
@@ -4704,19 +6162,24 @@ class ArrayInitLoopExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ArrayInitLoopExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {111, 112};
   PASTA_DECLARE_BASE_OPERATORS(Expr, ArrayInitLoopExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ArrayInitLoopExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ArrayInitLoopExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   llvm::APInt ArraySize(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::OpaqueValueExpr CommonExpression(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Expr SubExpression(void) const;
+  ::pasta::ArrayInitLoopExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ArrayInitLoopExpr)
 };
 
+struct ArrayInitLoopExprSnapshot : public ExprSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(ArrayInitLoopExpr));
 
 class ArraySubscriptExpr : public Expr {
@@ -4724,10 +6187,11 @@ class ArraySubscriptExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ArraySubscriptExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {112, 113};
   PASTA_DECLARE_BASE_OPERATORS(Expr, ArraySubscriptExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ArraySubscriptExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ArraySubscriptExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Expr Base(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
@@ -4736,10 +6200,15 @@ class ArraySubscriptExpr : public Expr {
   ::pasta::Expr LHS(void) const;
   ::pasta::Token RBracketToken(void) const;
   ::pasta::Expr RHS(void) const;
+  ::pasta::ArraySubscriptExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ArraySubscriptExpr)
 };
 
+struct ArraySubscriptExprSnapshot : public ExprSnapshot {
+  uint32_t r_bracket_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(ArraySubscriptExpr));
 
 class ArrayTypeTraitExpr : public Expr {
@@ -4747,20 +6216,27 @@ class ArrayTypeTraitExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ArrayTypeTraitExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {113, 114};
   PASTA_DECLARE_BASE_OPERATORS(Expr, ArrayTypeTraitExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ArrayTypeTraitExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ArrayTypeTraitExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Expr DimensionExpression(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Type QueriedType(void) const;
   enum ArrayTypeTrait Trait(void) const;
   uint64_t Value(void) const;
+  ::pasta::ArrayTypeTraitExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ArrayTypeTraitExpr)
 };
 
+struct ArrayTypeTraitExprSnapshot : public ExprSnapshot {
+  enum ArrayTypeTrait trait;
+  uint64_t value;
+};
+
 static_assert(sizeof(Stmt) == sizeof(ArrayTypeTraitExpr));
 
 class AsTypeExpr : public Expr {
@@ -4768,19 +6244,26 @@ class AsTypeExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(AsTypeExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {114, 115};
   PASTA_DECLARE_BASE_OPERATORS(Expr, AsTypeExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, AsTypeExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, AsTypeExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token BuiltinToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Token RParenToken(void) const;
   ::pasta::Expr SrcExpression(void) const;
+  ::pasta::AsTypeExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(AsTypeExpr)
 };
 
+struct AsTypeExprSnapshot : public ExprSnapshot {
+  uint32_t builtin_token;
+  uint32_t r_paren_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(AsTypeExpr));
 
 class AtomicExpr : public Expr {
@@ -4788,10 +6271,11 @@ class AtomicExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(AtomicExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {115, 116};
   PASTA_DECLARE_BASE_OPERATORS(Expr, AtomicExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, AtomicExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, AtomicExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token BuiltinToken(void) const;
   ::pasta::Token EndToken(void) const;
@@ -4812,10 +6296,21 @@ class AtomicExpr : public Expr {
   bool IsOpenCL(void) const;
   bool IsVolatile(void) const;
   std::vector<::pasta::Expr> SubExpressions(void) const;
+  ::pasta::AtomicExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(AtomicExpr)
 };
 
+struct AtomicExprSnapshot : public ExprSnapshot {
+  uint32_t builtin_token;
+  uint32_t num_sub_expressions;
+  enum AtomicExprAtomicOp operation;
+  uint32_t r_paren_token;
+  bool is_cmp_x_chg;
+  bool is_open_cl;
+  bool is_volatile;
+};
+
 static_assert(sizeof(Stmt) == sizeof(AtomicExpr));
 
 class BinaryConditionalOperator : public AbstractConditionalOperator {
@@ -4823,11 +6318,12 @@ class BinaryConditionalOperator : public AbstractConditionalOperator {
   using AbstractConditionalOperator::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(BinaryConditionalOperator)
+  static constexpr ::pasta::detail::KindRange kKindRange = {107, 108};
   PASTA_DECLARE_BASE_OPERATORS(AbstractConditionalOperator, BinaryConditionalOperator)
   PASTA_DECLARE_BASE_OPERATORS(Expr, BinaryConditionalOperator)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, BinaryConditionalOperator)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, BinaryConditionalOperator)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Expr Common(void) const;
   ::pasta::Expr Condition(void) const;
@@ -4835,10 +6331,14 @@ class BinaryConditionalOperator : public AbstractConditionalOperator {
   ::pasta::Expr FalseExpression(void) const;
   ::pasta::OpaqueValueExpr OpaqueValue(void) const;
   ::pasta::Expr TrueExpression(void) const;
+  ::pasta::BinaryConditionalOperatorSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(BinaryConditionalOperator)
 };
 
+struct BinaryConditionalOperatorSnapshot : public AbstractConditionalOperatorSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(BinaryConditionalOperator));
 
 class BinaryOperator : public Expr {
@@ -4846,11 +6346,12 @@ class BinaryOperator : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(BinaryOperator)
+  static constexpr ::pasta::detail::KindRange kKindRange = {116, 118};
   PASTA_DECLARE_BASE_OPERATORS(Expr, BinaryOperator)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, BinaryOperator)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, BinaryOperator)
   PASTA_DECLARE_DERIVED_OPERATORS(BinaryOperator, CompoundAssignOperator)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Token ExpressionToken(void) const;
@@ -4878,10 +6379,30 @@ class BinaryOperator : public Expr {
   bool IsRelationalOperation(void) const;
   bool IsShiftAssignOperation(void) const;
   bool IsShiftOperation(void) const;
+  ::pasta::BinaryOperatorSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(BinaryOperator)
 };
 
+struct BinaryOperatorSnapshot : public ExprSnapshot {
+  enum BinaryOperatorKind opcode;
+  uint32_t operator_token;
+  bool has_stored_fp_features;
+  bool is_additive_operation;
+  bool is_assignment_operation;
+  bool is_bitwise_operation;
+  bool is_comma_operation;
+  bool is_comparison_operation;
+  bool is_compound_assignment_operation;
+  bool is_equality_operation;
+  bool is_logical_operation;
+  bool is_multiplicative_operation;
+  bool is_pointer_memory_operation;
+  bool is_relational_operation;
+  bool is_shift_assign_operation;
+  bool is_shift_operation;
+};
+
 static_assert(sizeof(Stmt) == sizeof(BinaryOperator));
 
 class BlockExpr : public Expr {
@@ -4889,20 +6410,26 @@ class BlockExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(BlockExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {118, 119};
   PASTA_DECLARE_BASE_OPERATORS(Expr, BlockExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, BlockExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, BlockExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::BlockDecl BlockDeclaration(void) const;
   ::pasta::Stmt Body(void) const;
   ::pasta::Token CaretToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::FunctionProtoType FunctionType(void) const;
+  ::pasta::BlockExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(BlockExpr)
 };
 
+struct BlockExprSnapshot : public ExprSnapshot {
+  uint32_t caret_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(BlockExpr));
 
 class CXXBindTemporaryExpr : public Expr {
@@ -4910,18 +6437,23 @@ class CXXBindTemporaryExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXBindTemporaryExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {119, 120};
   PASTA_DECLARE_BASE_OPERATORS(Expr, CXXBindTemporaryExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXBindTemporaryExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXBindTemporaryExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Expr SubExpression(void) const;
   // Temporary: (const clang::CXXTemporary *)
+  ::pasta::CXXBindTemporaryExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXBindTemporaryExpr)
 };
 
+struct CXXBindTemporaryExprSnapshot : public ExprSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(CXXBindTemporaryExpr));
 
 class CXXBoolLiteralExpr : public Expr {
@@ -4929,18 +6461,25 @@ class CXXBoolLiteralExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXBoolLiteralExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {120, 121};
   PASTA_DECLARE_BASE_OPERATORS(Expr, CXXBoolLiteralExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXBoolLiteralExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXBoolLiteralExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Token Token(void) const;
   bool Value(void) const;
+  ::pasta::CXXBoolLiteralExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXBoolLiteralExpr)
 };
 
+struct CXXBoolLiteralExprSnapshot : public ExprSnapshot {
+  uint32_t token;
+  bool value;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CXXBoolLiteralExpr));
 
 class CXXConstructExpr : public Expr {
@@ -4948,12 +6487,13 @@ class CXXConstructExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXConstructExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {121, 123};
   PASTA_DECLARE_BASE_OPERATORS(Expr, CXXConstructExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXConstructExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXConstructExpr)
   PASTA_DECLARE_DERIVED_OPERATORS(CXXConstructExpr, CXXTemporaryObjectExpr)
-  std::vector<::pasta::Expr> Arguments(void) const;
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Expr> Arguments(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   // Argument: (const clang::Expr *)
   // Arguments: (const clang::Expr *const *)
   ::pasta::Token BeginToken(void) const;
@@ -4969,10 +6509,23 @@ class CXXConstructExpr : public Expr {
   bool IsListInitialization(void) const;
   bool IsStdInitializerListInitialization(void) const;
   bool RequiresZeroInitialization(void) const;
+  ::pasta::CXXConstructExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXConstructExpr)
 };
 
+struct CXXConstructExprSnapshot : public ExprSnapshot {
+  enum CXXConstructExprConstructionKind construction_kind;
+  uint32_t token;
+  uint32_t num_arguments;
+  bool had_multiple_candidates;
+  bool is_elidable;
+  bool is_immediate_escalating;
+  bool is_list_initialization;
+  bool is_std_initializer_list_initialization;
+  bool requires_zero_initialization;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CXXConstructExpr));
 
 class CXXDefaultArgExpr : public Expr {
@@ -4980,10 +6533,11 @@ class CXXDefaultArgExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXDefaultArgExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {123, 124};
   PASTA_DECLARE_BASE_OPERATORS(Expr, CXXDefaultArgExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXDefaultArgExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXDefaultArgExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Expr AdjustedRewrittenExpression(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
@@ -4994,10 +6548,16 @@ class CXXDefaultArgExpr : public Expr {
   ::pasta::DeclContext UsedContext(void) const;
   ::pasta::Token UsedToken(void) const;
   bool HasRewrittenInitializer(void) const;
+  ::pasta::CXXDefaultArgExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXDefaultArgExpr)
 };
 
+struct CXXDefaultArgExprSnapshot : public ExprSnapshot {
+  uint32_t used_token;
+  bool has_rewritten_initializer;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CXXDefaultArgExpr));
 
 class CXXDefaultInitExpr : public Expr {
@@ -5005,10 +6565,11 @@ class CXXDefaultInitExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXDefaultInitExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {124, 125};
   PASTA_DECLARE_BASE_OPERATORS(Expr, CXXDefaultInitExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXDefaultInitExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXDefaultInitExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   std::optional<::pasta::Expr> Expression(void) const;
@@ -5017,10 +6578,16 @@ class CXXDefaultInitExpr : public Expr {
   ::pasta::DeclContext UsedContext(void) const;
   ::pasta::Token UsedToken(void) const;
   bool HasRewrittenInitializer(void) const;
+  ::pasta::CXXDefaultInitExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXDefaultInitExpr)
 };
 
+struct CXXDefaultInitExprSnapshot : public ExprSnapshot {
+  uint32_t used_token;
+  bool has_rewritten_initializer;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CXXDefaultInitExpr));
 
 class CXXDeleteExpr : public Expr {
@@ -5028,10 +6595,11 @@ class CXXDeleteExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXDeleteExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {125, 126};
   PASTA_DECLARE_BASE_OPERATORS(Expr, CXXDeleteExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXDeleteExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXDeleteExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   bool DoesUsualArrayDeleteWantSize(void) const;
   ::pasta::Expr Argument(void) const;
   ::pasta::Token BeginToken(void) const;
@@ -5041,10 +6609,18 @@ class CXXDeleteExpr : public Expr {
   bool IsArrayForm(void) const;
   bool IsArrayFormAsWritten(void) const;
   bool IsGlobalDelete(void) const;
+  ::pasta::CXXDeleteExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXDeleteExpr)
 };
 
+struct CXXDeleteExprSnapshot : public ExprSnapshot {
+  bool does_usual_array_delete_want_size;
+  bool is_array_form;
+  bool is_array_form_as_written;
+  bool is_global_delete;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CXXDeleteExpr));
 
 class CXXDependentScopeMemberExpr : public Expr {
@@ -5052,10 +6628,11 @@ class CXXDependentScopeMemberExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXDependentScopeMemberExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {126, 127};
   PASTA_DECLARE_BASE_OPERATORS(Expr, CXXDependentScopeMemberExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXDependentScopeMemberExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXDependentScopeMemberExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   std::optional<::pasta::Expr> Base(void) const;
   ::pasta::Type BaseType(void) const;
   ::pasta::Token BeginToken(void) const;
@@ -5077,10 +6654,24 @@ class CXXDependentScopeMemberExpr : public Expr {
   bool IsArrow(void) const;
   bool IsImplicitAccess(void) const;
   // TemplateArguments: (llvm::ArrayRef<clang::TemplateArgumentLoc>)
+  ::pasta::CXXDependentScopeMemberExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXDependentScopeMemberExpr)
 };
 
+struct CXXDependentScopeMemberExprSnapshot : public ExprSnapshot {
+  uint32_t l_angle_token;
+  uint32_t member_token;
+  uint32_t num_template_arguments;
+  uint32_t operator_token;
+  uint32_t r_angle_token;
+  uint32_t template_keyword_token;
+  bool has_explicit_template_arguments;
+  bool has_template_keyword;
+  bool is_arrow;
+  bool is_implicit_access;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CXXDependentScopeMemberExpr));
 
 class CXXFoldExpr : public Expr {
@@ -5088,10 +6679,11 @@ class CXXFoldExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXFoldExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {127, 128};
   PASTA_DECLARE_BASE_OPERATORS(Expr, CXXFoldExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXFoldExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXFoldExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   std::optional<::pasta::UnresolvedLookupExpr> Callee(void) const;
   ::pasta::Token EllipsisToken(void) const;
@@ -5106,10 +6698,20 @@ class CXXFoldExpr : public Expr {
   ::pasta::Token RParenToken(void) const;
   bool IsLeftFold(void) const;
   bool IsRightFold(void) const;
+  ::pasta::CXXFoldExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXFoldExpr)
 };
 
+struct CXXFoldExprSnapshot : public ExprSnapshot {
+  uint32_t ellipsis_token;
+  uint32_t l_paren_token;
+  enum BinaryOperatorKind operator_;
+  uint32_t r_paren_token;
+  bool is_left_fold;
+  bool is_right_fold;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CXXFoldExpr));
 
 class CXXInheritedCtorInitExpr : public Expr {
@@ -5117,10 +6719,11 @@ class CXXInheritedCtorInitExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXInheritedCtorInitExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {128, 129};
   PASTA_DECLARE_BASE_OPERATORS(Expr, CXXInheritedCtorInitExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXInheritedCtorInitExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXInheritedCtorInitExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   bool ConstructsVirtualBase(void) const;
   ::pasta::Token BeginToken(void) const;
   enum CXXConstructExprConstructionKind ConstructionKind(void) const;
@@ -5128,10 +6731,18 @@ class CXXInheritedCtorInitExpr : public Expr {
   ::pasta::Token EndToken(void) const;
   ::pasta::Token Token(void) const;
   bool InheritedFromVirtualBase(void) const;
+  ::pasta::CXXInheritedCtorInitExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXInheritedCtorInitExpr)
 };
 
+struct CXXInheritedCtorInitExprSnapshot : public ExprSnapshot {
+  bool constructs_virtual_base;
+  enum CXXConstructExprConstructionKind construction_kind;
+  uint32_t token;
+  bool inherited_from_virtual_base;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CXXInheritedCtorInitExpr));
 
 class CXXNewExpr : public Expr {
@@ -5139,10 +6750,11 @@ class CXXNewExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXNewExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {129, 130};
   PASTA_DECLARE_BASE_OPERATORS(Expr, CXXNewExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXNewExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXNewExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   bool DoesUsualArrayDeleteWantSize(void) const;
   ::pasta::Type AllocatedType(void) const;
   std::optional<::pasta::Expr> ArraySize(void) const;
@@ -5163,12 +6775,25 @@ class CXXNewExpr : public Expr {
   bool IsGlobalNew(void) const;
   bool IsParenthesisTypeId(void) const;
   bool PassAlignment(void) const;
-  std::vector<::pasta::Expr> PlacementArguments(void) const;
+  ::pasta::LazyRange<::pasta::Expr> PlacementArguments(void) const;
   bool ShouldNullCheckAllocation(void) const;
+  ::pasta::CXXNewExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXNewExpr)
 };
 
+struct CXXNewExprSnapshot : public ExprSnapshot {
+  bool does_usual_array_delete_want_size;
+  enum CXXNewExprInitializationStyle initialization_style;
+  uint32_t num_placement_arguments;
+  bool has_initializer;
+  bool is_array;
+  bool is_global_new;
+  bool is_parenthesis_type_id;
+  bool pass_alignment;
+  bool should_null_check_allocation;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CXXNewExpr));
 
 class CXXNoexceptExpr : public Expr {
@@ -5176,19 +6801,25 @@ class CXXNoexceptExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXNoexceptExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {130, 131};
   PASTA_DECLARE_BASE_OPERATORS(Expr, CXXNoexceptExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXNoexceptExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXNoexceptExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Expr Operand(void) const;
   ::pasta::TokenRange Tokens(void) const;
   bool Value(void) const;
+  ::pasta::CXXNoexceptExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXNoexceptExpr)
 };
 
+struct CXXNoexceptExprSnapshot : public ExprSnapshot {
+  bool value;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CXXNoexceptExpr));
 
 class CXXNullPtrLiteralExpr : public Expr {
@@ -5196,17 +6827,23 @@ class CXXNullPtrLiteralExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXNullPtrLiteralExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {131, 132};
   PASTA_DECLARE_BASE_OPERATORS(Expr, CXXNullPtrLiteralExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXNullPtrLiteralExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXNullPtrLiteralExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Token Token(void) const;
+  ::pasta::CXXNullPtrLiteralExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXNullPtrLiteralExpr)
 };
 
+struct CXXNullPtrLiteralExprSnapshot : public ExprSnapshot {
+  uint32_t token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CXXNullPtrLiteralExpr));
 
 class CXXParenListInitExpr : public Expr {
@@ -5214,10 +6851,11 @@ class CXXParenListInitExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXParenListInitExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {132, 133};
   PASTA_DECLARE_BASE_OPERATORS(Expr, CXXParenListInitExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXParenListInitExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXParenListInitExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Expr ArrayFiller(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
@@ -5226,10 +6864,15 @@ class CXXParenListInitExpr : public Expr {
   ::pasta::FieldDecl InitializedFieldInUnion(void) const;
   ::pasta::TokenRange Tokens(void) const;
   // UserSpecifiedInitializerExpressions: (const llvm::ArrayRef<clang::Expr *>)
+  ::pasta::CXXParenListInitExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXParenListInitExpr)
 };
 
+struct CXXParenListInitExprSnapshot : public ExprSnapshot {
+  uint32_t initializer_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CXXParenListInitExpr));
 
 class CXXPseudoDestructorExpr : public Expr {
@@ -5237,10 +6880,11 @@ class CXXPseudoDestructorExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXPseudoDestructorExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {133, 134};
   PASTA_DECLARE_BASE_OPERATORS(Expr, CXXPseudoDestructorExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXPseudoDestructorExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXPseudoDestructorExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Expr Base(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token ColonColonToken(void) const;
@@ -5254,10 +6898,20 @@ class CXXPseudoDestructorExpr : public Expr {
   ::pasta::Token TildeToken(void) const;
   bool HasQualifier(void) const;
   bool IsArrow(void) const;
+  ::pasta::CXXPseudoDestructorExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXPseudoDestructorExpr)
 };
 
+struct CXXPseudoDestructorExprSnapshot : public ExprSnapshot {
+  uint32_t colon_colon_token;
+  uint32_t destroyed_type_token;
+  uint32_t operator_token;
+  uint32_t tilde_token;
+  bool has_qualifier;
+  bool is_arrow;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CXXPseudoDestructorExpr));
 
 class CXXRewrittenBinaryOperator : public Expr {
@@ -5265,6 +6919,7 @@ class CXXRewrittenBinaryOperator : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXRewrittenBinaryOperator)
+  static constexpr ::pasta::detail::KindRange kKindRange = {134, 135};
   PASTA_DECLARE_BASE_OPERATORS(Expr, CXXRewrittenBinaryOperator)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXRewrittenBinaryOperator)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXRewrittenBinaryOperator)
@@ -5283,10 +6938,20 @@ class CXXRewrittenBinaryOperator : public Expr {
   bool IsAssignmentOperation(void) const;
   bool IsComparisonOperation(void) const;
   bool IsReversed(void) const;
+  ::pasta::CXXRewrittenBinaryOperatorSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXRewrittenBinaryOperator)
 };
 
+struct CXXRewrittenBinaryOperatorSnapshot : public ExprSnapshot {
+  enum BinaryOperatorKind opcode;
+  enum BinaryOperatorKind operator_;
+  uint32_t operator_token;
+  bool is_assignment_operation;
+  bool is_comparison_operation;
+  bool is_reversed;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CXXRewrittenBinaryOperator));
 
 class CXXScalarValueInitExpr : public Expr {
@@ -5294,17 +6959,23 @@ class CXXScalarValueInitExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXScalarValueInitExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {135, 136};
   PASTA_DECLARE_BASE_OPERATORS(Expr, CXXScalarValueInitExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXScalarValueInitExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXScalarValueInitExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Token RParenToken(void) const;
+  ::pasta::CXXScalarValueInitExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXScalarValueInitExpr)
 };
 
+struct CXXScalarValueInitExprSnapshot : public ExprSnapshot {
+  uint32_t r_paren_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CXXScalarValueInitExpr));
 
 class CXXStdInitializerListExpr : public Expr {
@@ -5312,18 +6983,23 @@ class CXXStdInitializerListExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXStdInitializerListExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {136, 137};
   PASTA_DECLARE_BASE_OPERATORS(Expr, CXXStdInitializerListExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXStdInitializerListExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXStdInitializerListExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::TokenRange Tokens(void) const;
   ::pasta::Expr SubExpression(void) const;
+  ::pasta::CXXStdInitializerListExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXStdInitializerListExpr)
 };
 
+struct CXXStdInitializerListExprSnapshot : public ExprSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(CXXStdInitializerListExpr));
 
 class CXXTemporaryObjectExpr : public CXXConstructExpr {
@@ -5331,6 +7007,7 @@ class CXXTemporaryObjectExpr : public CXXConstructExpr {
   using CXXConstructExpr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXTemporaryObjectExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {122, 123};
   PASTA_DECLARE_BASE_OPERATORS(CXXConstructExpr, CXXTemporaryObjectExpr)
   PASTA_DECLARE_BASE_OPERATORS(Expr, CXXTemporaryObjectExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXTemporaryObjectExpr)
@@ -5338,10 +7015,14 @@ class CXXTemporaryObjectExpr : public CXXConstructExpr {
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   std::vector<::pasta::Expr> Arguments(void) const;
+  ::pasta::CXXTemporaryObjectExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXTemporaryObjectExpr)
 };
 
+struct CXXTemporaryObjectExprSnapshot : public CXXConstructExprSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(CXXTemporaryObjectExpr));
 
 class CXXThisExpr : public Expr {
@@ -5349,18 +7030,25 @@ class CXXThisExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXThisExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {137, 138};
   PASTA_DECLARE_BASE_OPERATORS(Expr, CXXThisExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXThisExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXThisExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Token Token(void) const;
   bool IsImplicit(void) const;
+  ::pasta::CXXThisExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXThisExpr)
 };
 
+struct CXXThisExprSnapshot : public ExprSnapshot {
+  uint32_t token;
+  bool is_implicit;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CXXThisExpr));
 
 class CXXThrowExpr : public Expr {
@@ -5368,19 +7056,26 @@ class CXXThrowExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXThrowExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {138, 139};
   PASTA_DECLARE_BASE_OPERATORS(Expr, CXXThrowExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXThrowExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXThrowExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   std::optional<::pasta::Expr> SubExpression(void) const;
   ::pasta::Token ThrowToken(void) const;
   bool IsThrownVariableInScope(void) const;
+  ::pasta::CXXThrowExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXThrowExpr)
 };
 
+struct CXXThrowExprSnapshot : public ExprSnapshot {
+  uint32_t throw_token;
+  bool is_thrown_variable_in_scope;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CXXThrowExpr));
 
 class CXXTypeidExpr : public Expr {
@@ -5388,10 +7083,11 @@ class CXXTypeidExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXTypeidExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {139, 140};
   PASTA_DECLARE_BASE_OPERATORS(Expr, CXXTypeidExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXTypeidExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXTypeidExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   std::optional<::pasta::Expr> ExpressionOperand(void) const;
@@ -5401,10 +7097,16 @@ class CXXTypeidExpr : public Expr {
   std::optional<bool> IsMostDerived(void) const;
   bool IsPotentiallyEvaluated(void) const;
   bool IsTypeOperand(void) const;
+  ::pasta::CXXTypeidExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXTypeidExpr)
 };
 
+struct CXXTypeidExprSnapshot : public ExprSnapshot {
+  bool is_potentially_evaluated;
+  bool is_type_operand;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CXXTypeidExpr));
 
 class CXXUnresolvedConstructExpr : public Expr {
@@ -5412,11 +7114,12 @@ class CXXUnresolvedConstructExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXUnresolvedConstructExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {140, 141};
   PASTA_DECLARE_BASE_OPERATORS(Expr, CXXUnresolvedConstructExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXUnresolvedConstructExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXUnresolvedConstructExpr)
-  std::vector<::pasta::Expr> Arguments(void) const;
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Expr> Arguments(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   // Argument: (const clang::Expr *)
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
@@ -5425,10 +7128,18 @@ class CXXUnresolvedConstructExpr : public Expr {
   ::pasta::Token RParenToken(void) const;
   ::pasta::Type TypeAsWritten(void) const;
   bool IsListInitialization(void) const;
+  ::pasta::CXXUnresolvedConstructExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXUnresolvedConstructExpr)
 };
 
+struct CXXUnresolvedConstructExprSnapshot : public ExprSnapshot {
+  uint32_t l_paren_token;
+  uint32_t num_arguments;
+  uint32_t r_paren_token;
+  bool is_list_initialization;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CXXUnresolvedConstructExpr));
 
 class CXXUuidofExpr : public Expr {
@@ -5436,10 +7147,11 @@ class CXXUuidofExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXUuidofExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {141, 142};
   PASTA_DECLARE_BASE_OPERATORS(Expr, CXXUuidofExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXUuidofExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXUuidofExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   std::optional<::pasta::Expr> ExpressionOperand(void) const;
@@ -5448,10 +7160,15 @@ class CXXUuidofExpr : public Expr {
   ::pasta::Type TypeOperand(void) const;
   ::pasta::Type TypeOperandSourceInfo(void) const;
   bool IsTypeOperand(void) const;
+  ::pasta::CXXUuidofExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXUuidofExpr)
 };
 
+struct CXXUuidofExprSnapshot : public ExprSnapshot {
+  bool is_type_operand;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CXXUuidofExpr));
 
 class CallExpr : public Expr {
@@ -5459,6 +7176,7 @@ class CallExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CallExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {142, 147};
   PASTA_DECLARE_BASE_OPERATORS(Expr, CallExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CallExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CallExpr)
@@ -5466,8 +7184,8 @@ class CallExpr : public Expr {
   PASTA_DECLARE_DERIVED_OPERATORS(CallExpr, CXXMemberCallExpr)
   PASTA_DECLARE_DERIVED_OPERATORS(CallExpr, CXXOperatorCallExpr)
   PASTA_DECLARE_DERIVED_OPERATORS(CallExpr, UserDefinedLiteral)
-  std::vector<::pasta::Expr> Arguments(void) const;
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Expr> Arguments(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   enum CallExprADLCallKind ADLCallKind(void) const;
   // Argument: (const clang::Expr *)
   // Arguments: (const clang::Expr *const *)
@@ -5490,10 +7208,24 @@ class CallExpr : public Expr {
   bool IsCallToStdMove(void) const;
   bool IsUnevaluatedBuiltinCall(void) const;
   bool UsesADL(void) const;
+  ::pasta::CallExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CallExpr)
 };
 
+struct CallExprSnapshot : public ExprSnapshot {
+  enum CallExprADLCallKind adl_call_kind;
+  uint32_t builtin_callee;
+  uint32_t num_arguments;
+  uint32_t r_paren_token;
+  bool has_stored_fp_features;
+  bool has_unused_result_attribute{};
+  bool is_builtin_assume_false;
+  bool is_call_to_std_move;
+  bool is_unevaluated_builtin_call;
+  bool uses_adl;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CallExpr));
 
 class CastExpr : public Expr {
@@ -5501,6 +7233,7 @@ class CastExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CastExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {147, 157};
   PASTA_DECLARE_BASE_OPERATORS(Expr, CastExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CastExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CastExpr)
@@ -5516,7 +7249,7 @@ class CastExpr : public Expr {
   PASTA_DECLARE_DERIVED_OPERATORS(CastExpr, ExplicitCastExpr)
   PASTA_DECLARE_DERIVED_OPERATORS(CastExpr, ImplicitCastExpr)
   PASTA_DECLARE_DERIVED_OPERATORS(CastExpr, ObjCBridgedCastExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   enum CastKind CastKind(void) const;
   std::string_view CastKindName(void) const;
   std::optional<::pasta::NamedDecl> ConversionFunction(void) const;
@@ -5528,10 +7261,16 @@ class CastExpr : public Expr {
   std::optional<::pasta::FieldDecl> TargetUnionField(void) const;
   bool HasStoredFPFeatures(void) const;
   // Path: (llvm::iterator_range<const clang::CXXBaseSpecifier *const *>)
+  ::pasta::CastExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CastExpr)
 };
 
+struct CastExprSnapshot : public ExprSnapshot {
+  enum CastKind cast_kind;
+  bool has_stored_fp_features;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CastExpr));
 
 class CharacterLiteral : public Expr {
@@ -5539,19 +7278,27 @@ class CharacterLiteral : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CharacterLiteral)
+  static constexpr ::pasta::detail::KindRange kKindRange = {157, 158};
   PASTA_DECLARE_BASE_OPERATORS(Expr, CharacterLiteral)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CharacterLiteral)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CharacterLiteral)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   enum CharacterLiteralCharacterKind LiteralKind(void) const;
   ::pasta::Token Token(void) const;
   uint32_t Value(void) const;
+  ::pasta::CharacterLiteralSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CharacterLiteral)
 };
 
+struct CharacterLiteralSnapshot : public ExprSnapshot {
+  enum CharacterLiteralCharacterKind literal_kind;
+  uint32_t token;
+  uint32_t value;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CharacterLiteral));
 
 class ChooseExpr : public Expr {
@@ -5559,10 +7306,11 @@ class ChooseExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ChooseExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {158, 159};
   PASTA_DECLARE_BASE_OPERATORS(Expr, ChooseExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ChooseExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ChooseExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token BuiltinToken(void) const;
   ::pasta::Expr ChosenSubExpression(void) const;
@@ -5573,10 +7321,18 @@ class ChooseExpr : public Expr {
   ::pasta::Token RParenToken(void) const;
   bool IsConditionDependent(void) const;
   bool IsConditionTrue(void) const;
+  ::pasta::ChooseExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ChooseExpr)
 };
 
+struct ChooseExprSnapshot : public ExprSnapshot {
+  uint32_t builtin_token;
+  uint32_t r_paren_token;
+  bool is_condition_dependent;
+  bool is_condition_true{};
+};
+
 static_assert(sizeof(Stmt) == sizeof(ChooseExpr));
 
 class CompoundAssignOperator : public BinaryOperator {
@@ -5584,16 +7340,21 @@ class CompoundAssignOperator : public BinaryOperator {
   using BinaryOperator::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CompoundAssignOperator)
+  static constexpr ::pasta::detail::KindRange kKindRange = {117, 118};
   PASTA_DECLARE_BASE_OPERATORS(BinaryOperator, CompoundAssignOperator)
   PASTA_DECLARE_BASE_OPERATORS(Expr, CompoundAssignOperator)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CompoundAssignOperator)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CompoundAssignOperator)
   ::pasta::Type ComputationLHSType(void) const;
   ::pasta::Type ComputationResultType(void) const;
+  ::pasta::CompoundAssignOperatorSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CompoundAssignOperator)
 };
 
+struct CompoundAssignOperatorSnapshot : public BinaryOperatorSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(CompoundAssignOperator));
 
 class CompoundLiteralExpr : public Expr {
@@ -5601,19 +7362,26 @@ class CompoundLiteralExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CompoundLiteralExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {159, 160};
   PASTA_DECLARE_BASE_OPERATORS(Expr, CompoundLiteralExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CompoundLiteralExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CompoundLiteralExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Expr Initializer(void) const;
   ::pasta::Token LParenToken(void) const;
   bool IsFileScope(void) const;
+  ::pasta::CompoundLiteralExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CompoundLiteralExpr)
 };
 
+struct CompoundLiteralExprSnapshot : public ExprSnapshot {
+  uint32_t l_paren_token;
+  bool is_file_scope;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CompoundLiteralExpr));
 
 class ConceptSpecializationExpr : public Expr {
@@ -5621,20 +7389,26 @@ class ConceptSpecializationExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ConceptSpecializationExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {160, 161};
   PASTA_DECLARE_BASE_OPERATORS(Expr, ConceptSpecializationExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ConceptSpecializationExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ConceptSpecializationExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   // Satisfaction: (const clang::ASTConstraintSatisfaction &)
   ::pasta::ImplicitConceptSpecializationDecl SpecializationDeclaration(void) const;
   std::vector<::pasta::TemplateArgument> TemplateArguments(void) const;
   bool IsSatisfied(void) const;
+  ::pasta::ConceptSpecializationExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ConceptSpecializationExpr)
 };
 
+struct ConceptSpecializationExprSnapshot : public ExprSnapshot {
+  bool is_satisfied{};
+};
+
 static_assert(sizeof(Stmt) == sizeof(ConceptSpecializationExpr));
 
 class ConditionalOperator : public AbstractConditionalOperator {
@@ -5642,11 +7416,12 @@ class ConditionalOperator : public AbstractConditionalOperator {
   using AbstractConditionalOperator::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ConditionalOperator)
+  static constexpr ::pasta::detail::KindRange kKindRange = {108, 109};
   PASTA_DECLARE_BASE_OPERATORS(AbstractConditionalOperator, ConditionalOperator)
   PASTA_DECLARE_BASE_OPERATORS(Expr, ConditionalOperator)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ConditionalOperator)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ConditionalOperator)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Expr Condition(void) const;
   ::pasta::Token EndToken(void) const;
@@ -5654,10 +7429,14 @@ class ConditionalOperator : public AbstractConditionalOperator {
   ::pasta::Expr LHS(void) const;
   ::pasta::Expr RHS(void) const;
   ::pasta::Expr TrueExpression(void) const;
+  ::pasta::ConditionalOperatorSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ConditionalOperator)
 };
 
+struct ConditionalOperatorSnapshot : public AbstractConditionalOperatorSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(ConditionalOperator));
 
 class ConstantExpr : public FullExpr {
@@ -5665,11 +7444,12 @@ class ConstantExpr : public FullExpr {
   using FullExpr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ConstantExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {173, 174};
   PASTA_DECLARE_BASE_OPERATORS(Expr, ConstantExpr)
   PASTA_DECLARE_BASE_OPERATORS(FullExpr, ConstantExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ConstantExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ConstantExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   // APValueResult: (clang::APValue)
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
@@ -5679,10 +7459,17 @@ class ConstantExpr : public FullExpr {
   enum ConstantExprResultStorageKind ResultStorageKind(void) const;
   bool HasAPValueResult(void) const;
   bool IsImmediateInvocation(void) const;
+  ::pasta::ConstantExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ConstantExpr)
 };
 
+struct ConstantExprSnapshot : public FullExprSnapshot {
+  enum ConstantExprResultStorageKind result_storage_kind;
+  bool has_ap_value_result;
+  bool is_immediate_invocation;
+};
+
 static_assert(sizeof(Stmt) == sizeof(ConstantExpr));
 
 class ConvertVectorExpr : public Expr {
@@ -5690,19 +7477,26 @@ class ConvertVectorExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ConvertVectorExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {161, 162};
   PASTA_DECLARE_BASE_OPERATORS(Expr, ConvertVectorExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ConvertVectorExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ConvertVectorExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token BuiltinToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Token RParenToken(void) const;
   ::pasta::Expr SrcExpression(void) const;
+  ::pasta::ConvertVectorExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ConvertVectorExpr)
 };
 
+struct ConvertVectorExprSnapshot : public ExprSnapshot {
+  uint32_t builtin_token;
+  uint32_t r_paren_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(ConvertVectorExpr));
 
 class CoroutineSuspendExpr : public Expr {
@@ -5710,12 +7504,13 @@ class CoroutineSuspendExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CoroutineSuspendExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {162, 164};
   PASTA_DECLARE_BASE_OPERATORS(Expr, CoroutineSuspendExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CoroutineSuspendExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CoroutineSuspendExpr)
   PASTA_DECLARE_DERIVED_OPERATORS(CoroutineSuspendExpr, CoawaitExpr)
   PASTA_DECLARE_DERIVED_OPERATORS(CoroutineSuspendExpr, CoyieldExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Expr CommonExpression(void) const;
   ::pasta::Token EndToken(void) const;
@@ -5725,10 +7520,15 @@ class CoroutineSuspendExpr : public Expr {
   ::pasta::Expr ReadyExpression(void) const;
   ::pasta::Expr ResumeExpression(void) const;
   ::pasta::Expr SuspendExpression(void) const;
+  ::pasta::CoroutineSuspendExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CoroutineSuspendExpr)
 };
 
+struct CoroutineSuspendExprSnapshot : public ExprSnapshot {
+  uint32_t keyword_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CoroutineSuspendExpr));
 
 class CoyieldExpr : public CoroutineSuspendExpr {
@@ -5736,14 +7536,19 @@ class CoyieldExpr : public CoroutineSuspendExpr {
   using CoroutineSuspendExpr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CoyieldExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {163, 164};
   PASTA_DECLARE_BASE_OPERATORS(CoroutineSuspendExpr, CoyieldExpr)
   PASTA_DECLARE_BASE_OPERATORS(Expr, CoyieldExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CoyieldExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CoyieldExpr)
+  ::pasta::CoyieldExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CoyieldExpr)
 };
 
+struct CoyieldExprSnapshot : public CoroutineSuspendExprSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(CoyieldExpr));
 
 class DeclRefExpr : public Expr {
@@ -5751,10 +7556,11 @@ class DeclRefExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(DeclRefExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {164, 165};
   PASTA_DECLARE_BASE_OPERATORS(Expr, DeclRefExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, DeclRefExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, DeclRefExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::ValueDecl Declaration(void) const;
   ::pasta::Token EndToken(void) const;
@@ -5776,10 +7582,26 @@ class DeclRefExpr : public Expr {
   enum NonOdrUseReason IsNonOdrUse(void) const;
   bool RefersToEnclosingVariableOrCapture(void) const;
   // TemplateArguments: (llvm::ArrayRef<clang::TemplateArgumentLoc>)
+  ::pasta::DeclRefExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(DeclRefExpr)
 };
 
+struct DeclRefExprSnapshot : public ExprSnapshot {
+  uint32_t l_angle_token;
+  uint32_t num_template_arguments;
+  uint32_t r_angle_token;
+  uint32_t template_keyword_token;
+  bool had_multiple_candidates;
+  bool has_explicit_template_arguments;
+  bool has_qualifier;
+  bool has_template_keyword_and_arguments_info;
+  bool has_template_keyword;
+  bool is_immediate_escalating;
+  enum NonOdrUseReason is_non_odr_use;
+  bool refers_to_enclosing_variable_or_capture;
+};
+
 static_assert(sizeof(Stmt) == sizeof(DeclRefExpr));
 
 class DependentCoawaitExpr : public Expr {
@@ -5787,19 +7609,25 @@ class DependentCoawaitExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(DependentCoawaitExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {165, 166};
   PASTA_DECLARE_BASE_OPERATORS(Expr, DependentCoawaitExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, DependentCoawaitExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, DependentCoawaitExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Token KeywordToken(void) const;
   ::pasta::Expr Operand(void) const;
   ::pasta::UnresolvedLookupExpr OperatorCoawaitLookup(void) const;
+  ::pasta::DependentCoawaitExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(DependentCoawaitExpr)
 };
 
+struct DependentCoawaitExprSnapshot : public ExprSnapshot {
+  uint32_t keyword_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(DependentCoawaitExpr));
 
 class DependentScopeDeclRefExpr : public Expr {
@@ -5807,10 +7635,11 @@ class DependentScopeDeclRefExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(DependentScopeDeclRefExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {166, 167};
   PASTA_DECLARE_BASE_OPERATORS(Expr, DependentScopeDeclRefExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, DependentScopeDeclRefExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, DependentScopeDeclRefExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Token BeginToken(void) const;
   // DeclarationName: (clang::DeclarationName)
   ::pasta::Token EndToken(void) const;
@@ -5825,10 +7654,20 @@ class DependentScopeDeclRefExpr : public Expr {
   bool HasExplicitTemplateArguments(void) const;
   bool HasTemplateKeyword(void) const;
   // TemplateArguments: (llvm::ArrayRef<clang::TemplateArgumentLoc>)
+  ::pasta::DependentScopeDeclRefExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(DependentScopeDeclRefExpr)
 };
 
+struct DependentScopeDeclRefExprSnapshot : public ExprSnapshot {
+  uint32_t l_angle_token;
+  uint32_t num_template_arguments;
+  uint32_t r_angle_token;
+  uint32_t template_keyword_token;
+  bool has_explicit_template_arguments;
+  bool has_template_keyword;
+};
+
 static_assert(sizeof(Stmt) == sizeof(DependentScopeDeclRefExpr));
 
 class DesignatedInitExpr : public Expr {
@@ -5836,10 +7675,11 @@ class DesignatedInitExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(DesignatedInitExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {167, 168};
   PASTA_DECLARE_BASE_OPERATORS(Expr, DesignatedInitExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, DesignatedInitExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, DesignatedInitExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   std::vector<::pasta::Designator> Designators(void) const;
   // ArrayIndex: (clang::Expr *)
   // ArrayRangeEnd: (clang::Expr *)
@@ -5856,10 +7696,19 @@ class DesignatedInitExpr : public Expr {
   uint32_t Size(void) const;
   bool UsesGNUSyntax(void) const;
   std::vector<::pasta::Expr> SubExpressions(void) const;
+  ::pasta::DesignatedInitExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(DesignatedInitExpr)
 };
 
+struct DesignatedInitExprSnapshot : public ExprSnapshot {
+  uint32_t equal_or_colon_token;
+  uint32_t num_sub_expressions;
+  bool is_direct_initializer;
+  uint32_t size;
+  bool uses_gnu_syntax;
+};
+
 static_assert(sizeof(Stmt) == sizeof(DesignatedInitExpr));
 
 class DesignatedInitUpdateExpr : public Expr {
@@ -5867,18 +7716,23 @@ class DesignatedInitUpdateExpr : public Expr {
   using Expr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(DesignatedInitUpdateExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {168, 169};
   PASTA_DECLARE_BASE_OPERATORS(Expr, DesignatedInitUpdateExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, DesignatedInitUpdateExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, DesignatedInitUpdateExpr)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   ::pasta::Expr Base(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::InitListExpr Updater(void) const;
+  ::pasta::DesignatedInitUpdateExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(DesignatedInitUpdateExpr)
 };
 
+struct DesignatedInitUpdateExprSnapshot : public ExprSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(DesignatedInitUpdateExpr));
 
 class ExplicitCastExpr : public CastExpr {
@@ -5886,6 +7740,7 @@ class ExplicitCastExpr : public CastExpr {
   using CastExpr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ExplicitCastExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {147, 156};
   PASTA_DECLARE_BASE_OPERATORS(CastExpr, ExplicitCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(Expr, ExplicitCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ExplicitCastExpr)
@@ -5902,10 +7757,14 @@ class ExplicitCastExpr : public CastExpr {
   PASTA_DECLARE_DERIVED_OPERATORS(ExplicitCastExpr, ObjCBridgedCastExpr)
   ::pasta::Type TypeAsWritten(void) const;
   ::pasta::Type TypeInfoAsWritten(void) const;
+  ::pasta::ExplicitCastExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ExplicitCastExpr)
 };
 
+struct ExplicitCastExprSnapshot : public CastExprSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(ExplicitCastExpr));
 
 class ExprWithCleanups : public FullExpr {
@@ -5913,11 +7772,12 @@ class ExprWithCleanups : public FullExpr {
   using FullExpr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ExprWithCleanups)
+  static constexpr ::pasta::detail::KindRange kKindRange = {174, 175};
   PASTA_DECLARE_BASE_OPERATORS(Expr, ExprWithCleanups)
   PASTA_DECLARE_BASE_OPERATORS(FullExpr, ExprWithCleanups)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ExprWithCleanups)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, ExprWithCleanups)
-  std::vector<::pasta::Stmt> Children(void) const;
+  ::pasta::LazyRange<::pasta::Stmt> Children(void) const;
   bool CleanupsHaveSideEffects(void) const;
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
@@ -5925,10 +7785,16 @@ class ExprWithCleanups : public FullExpr {
   // Object: (llvm::PointerUnion<clang::BlockDecl *, clang::CompoundLiteralExpr *>)
   // Objects: (llvm::ArrayRef<llvm::PointerUnion<clang::BlockDecl *, clang::CompoundLiteralExpr *>>)
   std::vector<std::variant<std::monostate, ::pasta::BlockDecl, ::pasta::CompoundLiteralExpr>> Objects(void) const;
+  ::pasta::ExprWithCleanupsSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ExprWithCleanups)
 };
 
+struct ExprWithCleanupsSnapshot : public FullExprSnapshot {
+  bool cleanups_have_side_effects;
+  uint32_t num_objects;
+};
+
 static_assert(sizeof(Stmt) == sizeof(ExprWithCleanups));
 
 class ImplicitCastExpr : public CastExpr {
@@ -5936,6 +7802,7 @@ class ImplicitCastExpr : public CastExpr {
   using CastExpr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ImplicitCastExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {156, 157};
   PASTA_DECLARE_BASE_OPERATORS(CastExpr, ImplicitCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(Expr, ImplicitCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, ImplicitCastExpr)
@@ -5943,10 +7810,15 @@ class ImplicitCastExpr : public CastExpr {
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
   bool IsPartOfExplicitCast(void) const;
+  ::pasta::ImplicitCastExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ImplicitCastExpr)
 };
 
+struct ImplicitCastExprSnapshot : public CastExprSnapshot {
+  bool is_part_of_explicit_cast;
+};
+
 static_assert(sizeof(Stmt) == sizeof(ImplicitCastExpr));
 
 class OMPAtomicDirective : public OMPExecutableDirective {
@@ -5954,6 +7826,7 @@ class OMPAtomicDirective : public OMPExecutableDirective {
   using OMPExecutableDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPAtomicDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {20, 21};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPAtomicDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPAtomicDirective)
   ::pasta::Expr ConditionExpression(void) const;
@@ -5967,10 +7840,17 @@ class OMPAtomicDirective : public OMPExecutableDirective {
   bool IsPostfixUpdate(void) const;
   bool IsXLHSInRHSPart(void) const;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPAtomicDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPAtomicDirective)
 };
 
+struct OMPAtomicDirectiveSnapshot : public OMPExecutableDirectiveSnapshot {
+  bool is_fail_only;
+  bool is_postfix_update;
+  bool is_xlhs_in_rhs_part;
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPAtomicDirective));
 
 class OMPBarrierDirective : public OMPExecutableDirective {
@@ -5978,13 +7858,18 @@ class OMPBarrierDirective : public OMPExecutableDirective {
   using OMPExecutableDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPBarrierDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {21, 22};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPBarrierDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPBarrierDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPBarrierDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPBarrierDirective)
 };
 
+struct OMPBarrierDirectiveSnapshot : public OMPExecutableDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPBarrierDirective));
 
 class OMPCancelDirective : public OMPExecutableDirective {
@@ -5992,14 +7877,19 @@ class OMPCancelDirective : public OMPExecutableDirective {
   using OMPExecutableDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPCancelDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {22, 23};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPCancelDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPCancelDirective)
   // CancelRegion: (llvm::omp::Directive)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPCancelDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPCancelDirective)
 };
 
+struct OMPCancelDirectiveSnapshot : public OMPExecutableDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPCancelDirective));
 
 class OMPCancellationPointDirective : public OMPExecutableDirective {
@@ -6007,14 +7897,19 @@ class OMPCancellationPointDirective : public OMPExecutableDirective {
   using OMPExecutableDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPCancellationPointDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {23, 24};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPCancellationPointDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPCancellationPointDirective)
   // CancelRegion: (llvm::omp::Directive)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPCancellationPointDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPCancellationPointDirective)
 };
 
+struct OMPCancellationPointDirectiveSnapshot : public OMPExecutableDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPCancellationPointDirective));
 
 class OMPCriticalDirective : public OMPExecutableDirective {
@@ -6022,14 +7917,19 @@ class OMPCriticalDirective : public OMPExecutableDirective {
   using OMPExecutableDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPCriticalDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {24, 25};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPCriticalDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPCriticalDirective)
   // DirectiveName: (clang::DeclarationNameInfo)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPCriticalDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPCriticalDirective)
 };
 
+struct OMPCriticalDirectiveSnapshot : public OMPExecutableDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPCriticalDirective));
 
 class OMPDepobjDirective : public OMPExecutableDirective {
@@ -6037,13 +7937,18 @@ class OMPDepobjDirective : public OMPExecutableDirective {
   using OMPExecutableDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPDepobjDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {25, 26};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPDepobjDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPDepobjDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPDepobjDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPDepobjDirective)
 };
 
+struct OMPDepobjDirectiveSnapshot : public OMPExecutableDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPDepobjDirective));
 
 class OMPDispatchDirective : public OMPExecutableDirective {
@@ -6051,14 +7956,20 @@ class OMPDispatchDirective : public OMPExecutableDirective {
   using OMPExecutableDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPDispatchDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {26, 27};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPDispatchDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPDispatchDirective)
   ::pasta::Token TargetCallToken(void) const;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPDispatchDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPDispatchDirective)
 };
 
+struct OMPDispatchDirectiveSnapshot : public OMPExecutableDirectiveSnapshot {
+  uint32_t target_call_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPDispatchDirective));
 
 class OMPDistributeDirective : public OMPLoopDirective {
@@ -6066,15 +7977,20 @@ class OMPDistributeDirective : public OMPLoopDirective {
   using OMPLoopDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPDistributeDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {30, 31};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPDistributeDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPDistributeDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPDistributeDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPDistributeDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPDistributeDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPDistributeDirective)
 };
 
+struct OMPDistributeDirectiveSnapshot : public OMPLoopDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPDistributeDirective));
 
 class OMPDistributeParallelForDirective : public OMPLoopDirective {
@@ -6082,6 +7998,7 @@ class OMPDistributeParallelForDirective : public OMPLoopDirective {
   using OMPLoopDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPDistributeParallelForDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {31, 32};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPDistributeParallelForDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPDistributeParallelForDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPDistributeParallelForDirective)
@@ -6089,10 +8006,15 @@ class OMPDistributeParallelForDirective : public OMPLoopDirective {
   ::pasta::Expr TaskReductionReferenceExpression(void) const;
   bool HasCancel(void) const;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPDistributeParallelForDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPDistributeParallelForDirective)
 };
 
+struct OMPDistributeParallelForDirectiveSnapshot : public OMPLoopDirectiveSnapshot {
+  bool has_cancel;
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPDistributeParallelForDirective));
 
 class OMPDistributeParallelForSimdDirective : public OMPLoopDirective {
@@ -6100,15 +8022,20 @@ class OMPDistributeParallelForSimdDirective : public OMPLoopDirective {
   using OMPLoopDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPDistributeParallelForSimdDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {32, 33};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPDistributeParallelForSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPDistributeParallelForSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPDistributeParallelForSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPDistributeParallelForSimdDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPDistributeParallelForSimdDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPDistributeParallelForSimdDirective)
 };
 
+struct OMPDistributeParallelForSimdDirectiveSnapshot : public OMPLoopDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPDistributeParallelForSimdDirective));
 
 class OMPDistributeSimdDirective : public OMPLoopDirective {
@@ -6116,15 +8043,20 @@ class OMPDistributeSimdDirective : public OMPLoopDirective {
   using OMPLoopDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPDistributeSimdDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {33, 34};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPDistributeSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPDistributeSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPDistributeSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPDistributeSimdDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPDistributeSimdDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPDistributeSimdDirective)
 };
 
+struct OMPDistributeSimdDirectiveSnapshot : public OMPLoopDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPDistributeSimdDirective));
 
 class OMPErrorDirective : public OMPExecutableDirective {
@@ -6132,13 +8064,18 @@ class OMPErrorDirective : public OMPExecutableDirective {
   using OMPExecutableDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPErrorDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {27, 28};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPErrorDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPErrorDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPErrorDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPErrorDirective)
 };
 
+struct OMPErrorDirectiveSnapshot : public OMPExecutableDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPErrorDirective));
 
 class OMPForDirective : public OMPLoopDirective {
@@ -6146,6 +8083,7 @@ class OMPForDirective : public OMPLoopDirective {
   using OMPLoopDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPForDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {34, 35};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPForDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPForDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPForDirective)
@@ -6153,10 +8091,15 @@ class OMPForDirective : public OMPLoopDirective {
   ::pasta::Expr TaskReductionReferenceExpression(void) const;
   bool HasCancel(void) const;
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPForDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPForDirective)
 };
 
+struct OMPForDirectiveSnapshot : public OMPLoopDirectiveSnapshot {
+  bool has_cancel;
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPForDirective));
 
 class OMPForSimdDirective : public OMPLoopDirective {
@@ -6164,15 +8107,20 @@ class OMPForSimdDirective : public OMPLoopDirective {
   using OMPLoopDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPForSimdDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {35, 36};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPForSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPForSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPForSimdDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPForSimdDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPForSimdDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPForSimdDirective)
 };
 
+struct OMPForSimdDirectiveSnapshot : public OMPLoopDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPForSimdDirective));
 
 class OMPGenericLoopDirective : public OMPLoopDirective {
@@ -6180,15 +8128,20 @@ class OMPGenericLoopDirective : public OMPLoopDirective {
   using OMPLoopDirective::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(OMPGenericLoopDirective)
+  static constexpr ::pasta::detail::KindRange kKindRange = {36, 37};
   PASTA_DECLARE_BASE_OPERATORS(OMPExecutableDirective, OMPGenericLoopDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopBasedDirective, OMPGenericLoopDirective)
   PASTA_DECLARE_BASE_OPERATORS(OMPLoopDirective, OMPGenericLoopDirective)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, OMPGenericLoopDirective)
   // !!! Clause getNumClauses getClause (empty ret type = (clang::OMPClause *))
+  ::pasta::OMPGenericLoopDirectiveSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(OMPGenericLoopDirective)
 };
 
+struct OMPGenericLoopDirectiveSnapshot : public OMPLoopDirectiveSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(OMPGenericLoopDirective));
 
 class ObjCBridgedCastExpr : public ExplicitCastExpr {
@@ -6196,6 +8149,7 @@ class ObjCBridgedCastExpr : public ExplicitCastExpr {
   using ExplicitCastExpr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCBridgedCastExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {155, 156};
   PASTA_DECLARE_BASE_OPERATORS(CastExpr, ObjCBridgedCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(ExplicitCastExpr, ObjCBridgedCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(Expr, ObjCBridgedCastExpr)
@@ -6207,10 +8161,17 @@ class ObjCBridgedCastExpr : public ExplicitCastExpr {
   std::string_view BridgeKindName(void) const;
   ::pasta::Token EndToken(void) const;
   ::pasta::Token LParenToken(void) const;
+  ::pasta::ObjCBridgedCastExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(ObjCBridgedCastExpr)
 };
 
+struct ObjCBridgedCastExprSnapshot : public ExplicitCastExprSnapshot {
+  uint32_t bridge_keyword_token;
+  enum ObjCBridgeCastKind bridge_kind;
+  uint32_t l_paren_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(ObjCBridgedCastExpr));
 
 class UserDefinedLiteral : public CallExpr {
@@ -6218,6 +8179,7 @@ class UserDefinedLiteral : public CallExpr {
   using CallExpr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(UserDefinedLiteral)
+  static constexpr ::pasta::detail::KindRange kKindRange = {146, 147};
   PASTA_DECLARE_BASE_OPERATORS(CallExpr, UserDefinedLiteral)
   PASTA_DECLARE_BASE_OPERATORS(Expr, UserDefinedLiteral)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, UserDefinedLiteral)
@@ -6229,10 +8191,16 @@ class UserDefinedLiteral : public CallExpr {
   // UDSuffix: (const clang::IdentifierInfo *)
   ::pasta::Token UDSuffixToken(void) const;
   std::vector<::pasta::Expr> Arguments(void) const;
+  ::pasta::UserDefinedLiteralSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(UserDefinedLiteral)
 };
 
+struct UserDefinedLiteralSnapshot : public CallExprSnapshot {
+  enum UserDefinedLiteralLiteralOperatorKind literal_operator_kind;
+  uint32_t ud_suffix_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(UserDefinedLiteral));
 
 class BuiltinBitCastExpr : public ExplicitCastExpr {
@@ -6240,6 +8208,7 @@ class BuiltinBitCastExpr : public ExplicitCastExpr {
   using ExplicitCastExpr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(BuiltinBitCastExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {147, 148};
   PASTA_DECLARE_BASE_OPERATORS(CastExpr, BuiltinBitCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(ExplicitCastExpr, BuiltinBitCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(Expr, BuiltinBitCastExpr)
@@ -6247,10 +8216,14 @@ class BuiltinBitCastExpr : public ExplicitCastExpr {
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, BuiltinBitCastExpr)
   ::pasta::Token BeginToken(void) const;
   ::pasta::Token EndToken(void) const;
+  ::pasta::BuiltinBitCastExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(BuiltinBitCastExpr)
 };
 
+struct BuiltinBitCastExprSnapshot : public ExplicitCastExprSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(BuiltinBitCastExpr));
 
 class CStyleCastExpr : public ExplicitCastExpr {
@@ -6258,6 +8231,7 @@ class CStyleCastExpr : public ExplicitCastExpr {
   using ExplicitCastExpr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CStyleCastExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {148, 149};
   PASTA_DECLARE_BASE_OPERATORS(CastExpr, CStyleCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(ExplicitCastExpr, CStyleCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(Expr, CStyleCastExpr)
@@ -6267,10 +8241,16 @@ class CStyleCastExpr : public ExplicitCastExpr {
   ::pasta::Token EndToken(void) const;
   ::pasta::Token LParenToken(void) const;
   ::pasta::Token RParenToken(void) const;
+  ::pasta::CStyleCastExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CStyleCastExpr)
 };
 
+struct CStyleCastExprSnapshot : public ExplicitCastExprSnapshot {
+  uint32_t l_paren_token;
+  uint32_t r_paren_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CStyleCastExpr));
 
 class CUDAKernelCallExpr : public CallExpr {
@@ -6278,16 +8258,21 @@ class CUDAKernelCallExpr : public CallExpr {
   using CallExpr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CUDAKernelCallExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {143, 144};
   PASTA_DECLARE_BASE_OPERATORS(CallExpr, CUDAKernelCallExpr)
   PASTA_DECLARE_BASE_OPERATORS(Expr, CUDAKernelCallExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CUDAKernelCallExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CUDAKernelCallExpr)
   ::pasta::CallExpr Config(void) const;
   std::vector<::pasta::Expr> Arguments(void) const;
+  ::pasta::CUDAKernelCallExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CUDAKernelCallExpr)
 };
 
+struct CUDAKernelCallExprSnapshot : public CallExprSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(CUDAKernelCallExpr));
 
 class CXXFunctionalCastExpr : public ExplicitCastExpr {
@@ -6295,6 +8280,7 @@ class CXXFunctionalCastExpr : public ExplicitCastExpr {
   using ExplicitCastExpr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXFunctionalCastExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {149, 150};
   PASTA_DECLARE_BASE_OPERATORS(CastExpr, CXXFunctionalCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(ExplicitCastExpr, CXXFunctionalCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(Expr, CXXFunctionalCastExpr)
@@ -6305,10 +8291,17 @@ class CXXFunctionalCastExpr : public ExplicitCastExpr {
   ::pasta::Token LParenToken(void) const;
   ::pasta::Token RParenToken(void) const;
   bool IsListInitialization(void) const;
+  ::pasta::CXXFunctionalCastExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXFunctionalCastExpr)
 };
 
+struct CXXFunctionalCastExprSnapshot : public ExplicitCastExprSnapshot {
+  uint32_t l_paren_token;
+  uint32_t r_paren_token;
+  bool is_list_initialization;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CXXFunctionalCastExpr));
 
 class CXXMemberCallExpr : public CallExpr {
@@ -6316,6 +8309,7 @@ class CXXMemberCallExpr : public CallExpr {
   using CallExpr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXMemberCallExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {144, 145};
   PASTA_DECLARE_BASE_OPERATORS(CallExpr, CXXMemberCallExpr)
   PASTA_DECLARE_BASE_OPERATORS(Expr, CXXMemberCallExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXMemberCallExpr)
@@ -6326,10 +8320,14 @@ class CXXMemberCallExpr : public CallExpr {
   ::pasta::Type ObjectType(void) const;
   ::pasta::CXXRecordDecl RecordDeclaration(void) const;
   std::vector<::pasta::Expr> Arguments(void) const;
+  ::pasta::CXXMemberCallExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXMemberCallExpr)
 };
 
+struct CXXMemberCallExprSnapshot : public CallExprSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(CXXMemberCallExpr));
 
 class CXXNamedCastExpr : public ExplicitCastExpr {
@@ -6337,6 +8335,7 @@ class CXXNamedCastExpr : public ExplicitCastExpr {
   using ExplicitCastExpr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXNamedCastExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {150, 155};
   PASTA_DECLARE_BASE_OPERATORS(CastExpr, CXXNamedCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(ExplicitCastExpr, CXXNamedCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(Expr, CXXNamedCastExpr)
@@ -6353,10 +8352,16 @@ class CXXNamedCastExpr : public ExplicitCastExpr {
   ::pasta::Token EndToken(void) const;
   ::pasta::Token OperatorToken(void) const;
   ::pasta::Token RParenToken(void) const;
+  ::pasta::CXXNamedCastExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXNamedCastExpr)
 };
 
+struct CXXNamedCastExprSnapshot : public ExplicitCastExprSnapshot {
+  uint32_t operator_token;
+  uint32_t r_paren_token;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CXXNamedCastExpr));
 
 class CXXOperatorCallExpr : public CallExpr {
@@ -6364,6 +8369,7 @@ class CXXOperatorCallExpr : public CallExpr {
   using CallExpr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXOperatorCallExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {145, 146};
   PASTA_DECLARE_BASE_OPERATORS(CallExpr, CXXOperatorCallExpr)
   PASTA_DECLARE_BASE_OPERATORS(Expr, CXXOperatorCallExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXOperatorCallExpr)
@@ -6378,10 +8384,19 @@ class CXXOperatorCallExpr : public CallExpr {
   bool IsComparisonOperation(void) const;
   bool IsInfixBinaryOperation(void) const;
   std::vector<::pasta::Expr> Arguments(void) const;
+  ::pasta::CXXOperatorCallExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXOperatorCallExpr)
 };
 
+struct CXXOperatorCallExprSnapshot : public CallExprSnapshot {
+  enum OverloadedOperatorKind operator_;
+  uint32_t operator_token;
+  bool is_assignment_operation;
+  bool is_comparison_operation;
+  bool is_infix_binary_operation;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CXXOperatorCallExpr));
 
 class CXXReinterpretCastExpr : public CXXNamedCastExpr {
@@ -6389,16 +8404,21 @@ class CXXReinterpretCastExpr : public CXXNamedCastExpr {
   using CXXNamedCastExpr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXReinterpretCastExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {153, 154};
   PASTA_DECLARE_BASE_OPERATORS(CXXNamedCastExpr, CXXReinterpretCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(CastExpr, CXXReinterpretCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(ExplicitCastExpr, CXXReinterpretCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(Expr, CXXReinterpretCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXReinterpretCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXReinterpretCastExpr)
+  ::pasta::CXXReinterpretCastExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXReinterpretCastExpr)
 };
 
+struct CXXReinterpretCastExprSnapshot : public CXXNamedCastExprSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(CXXReinterpretCastExpr));
 
 class CXXStaticCastExpr : public CXXNamedCastExpr {
@@ -6406,16 +8426,21 @@ class CXXStaticCastExpr : public CXXNamedCastExpr {
   using CXXNamedCastExpr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXStaticCastExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {154, 155};
   PASTA_DECLARE_BASE_OPERATORS(CXXNamedCastExpr, CXXStaticCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(CastExpr, CXXStaticCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(ExplicitCastExpr, CXXStaticCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(Expr, CXXStaticCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXStaticCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXStaticCastExpr)
+  ::pasta::CXXStaticCastExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXStaticCastExpr)
 };
 
+struct CXXStaticCastExprSnapshot : public CXXNamedCastExprSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(CXXStaticCastExpr));
 
 class CoawaitExpr : public CoroutineSuspendExpr {
@@ -6423,15 +8448,21 @@ class CoawaitExpr : public CoroutineSuspendExpr {
   using CoroutineSuspendExpr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CoawaitExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {162, 163};
   PASTA_DECLARE_BASE_OPERATORS(CoroutineSuspendExpr, CoawaitExpr)
   PASTA_DECLARE_BASE_OPERATORS(Expr, CoawaitExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CoawaitExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CoawaitExpr)
   bool IsImplicit(void) const;
+  ::pasta::CoawaitExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CoawaitExpr)
 };
 
+struct CoawaitExprSnapshot : public CoroutineSuspendExprSnapshot {
+  bool is_implicit;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CoawaitExpr));
 
 class CXXAddrspaceCastExpr : public CXXNamedCastExpr {
@@ -6439,16 +8470,21 @@ class CXXAddrspaceCastExpr : public CXXNamedCastExpr {
   using CXXNamedCastExpr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXAddrspaceCastExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {150, 151};
   PASTA_DECLARE_BASE_OPERATORS(CXXNamedCastExpr, CXXAddrspaceCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(CastExpr, CXXAddrspaceCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(ExplicitCastExpr, CXXAddrspaceCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(Expr, CXXAddrspaceCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXAddrspaceCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXAddrspaceCastExpr)
+  ::pasta::CXXAddrspaceCastExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXAddrspaceCastExpr)
 };
 
+struct CXXAddrspaceCastExprSnapshot : public CXXNamedCastExprSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(CXXAddrspaceCastExpr));
 
 class CXXConstCastExpr : public CXXNamedCastExpr {
@@ -6456,16 +8492,21 @@ class CXXConstCastExpr : public CXXNamedCastExpr {
   using CXXNamedCastExpr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXConstCastExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {151, 152};
   PASTA_DECLARE_BASE_OPERATORS(CXXNamedCastExpr, CXXConstCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(CastExpr, CXXConstCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(ExplicitCastExpr, CXXConstCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(Expr, CXXConstCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXConstCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXConstCastExpr)
+  ::pasta::CXXConstCastExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXConstCastExpr)
 };
 
+struct CXXConstCastExprSnapshot : public CXXNamedCastExprSnapshot {
+};
+
 static_assert(sizeof(Stmt) == sizeof(CXXConstCastExpr));
 
 class CXXDynamicCastExpr : public CXXNamedCastExpr {
@@ -6473,6 +8514,7 @@ class CXXDynamicCastExpr : public CXXNamedCastExpr {
   using CXXNamedCastExpr::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(CXXDynamicCastExpr)
+  static constexpr ::pasta::detail::KindRange kKindRange = {152, 153};
   PASTA_DECLARE_BASE_OPERATORS(CXXNamedCastExpr, CXXDynamicCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(CastExpr, CXXDynamicCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(ExplicitCastExpr, CXXDynamicCastExpr)
@@ -6480,10 +8522,15 @@ class CXXDynamicCastExpr : public CXXNamedCastExpr {
   PASTA_DECLARE_BASE_OPERATORS(Stmt, CXXDynamicCastExpr)
   PASTA_DECLARE_BASE_OPERATORS(ValueStmt, CXXDynamicCastExpr)
   bool IsAlwaysNull(void) const;
+  ::pasta::CXXDynamicCastExprSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_STMT_CONSTRUCTOR(CXXDynamicCastExpr)
 };
 
+struct CXXDynamicCastExprSnapshot : public CXXNamedCastExprSnapshot {
+  bool is_always_null;
+};
+
 static_assert(sizeof(Stmt) == sizeof(CXXDynamicCastExpr));
 
 }  // namespace pasta
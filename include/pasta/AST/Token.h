@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <iterator>
 #include <memory>
 #include <optional>
@@ -65,6 +66,10 @@ std::string TokenRoleName(const TokenRole role);
 bool IsIdentifierTokenKind(TokenKind) noexcept;
 const char *KeywordSpellingOrNull(TokenKind) noexcept;
 
+// Index of an invalid token in the AST's token list, e.g. as stored in the
+// token fields of entity snapshots.
+static constexpr uint32_t kInvalidTokenIndex = ~0u;
+
 // Represents a token that has been pre-processed and parsed.
 class Token {
  private:
@@ -91,6 +96,10 @@ class Token {
   // is the first token this token was derived from.
   std::vector<Token> DerivationChain(void) const;
 
+  // The number of tokens from which this token is derived, i.e. one less than
+  // the size of `DerivationChain()`. This takes constant time.
+  unsigned DerivationDepth(void) const noexcept;
+
   // Location of the token in a file.
   std::optional<FileToken> FileLocation(void) const;
 
@@ -159,6 +168,7 @@ class Token {
  private:
   friend class AST;
   friend class ASTImpl;
+  friend class BorrowedToken;
   friend class CXXBaseSpecifier;
   friend class FunctionDecl;
   friend class MacroToken;
@@ -312,9 +322,27 @@ class TokenRange {
   // Returns the list of macros that align with this token range, in the order
   // of most-nested to least. The optional heuristic determines whether or not
   // to try and match macro expansions that contain semicolons.
+  //
+  // NOTE(pag): When finding the aligned substitutions of many token ranges,
+  //            e.g. of every statement in a translation unit, prefer using
+  //            the below static version.
   std::vector<MacroSubstitution>
   AlignedSubstitutions(bool heuristic) noexcept;
 
+  // Returns the aligned substitutions of each of `ranges`, in the same order
+  // as `ranges`, i.e. `result[i]` is `ranges[i].AlignedSubstitutions(...)`.
+  //
+  // This is done in one forward sweep over the ranges, sorted by their first
+  // tokens. The derivation chain and macro tree walk from a first token is
+  // done once, and shared by all ranges starting at that token. The walk from
+  // a last token is done once, and kept only until the sweep passes it, i.e.
+  // while some later range can still end at that token. Thus, each token is
+  // walked at most twice, and the kept walks are bounded by how deeply the
+  // ranges nest, e.g. by how deep the statement trees are.
+  static std::vector<std::vector<MacroSubstitution>>
+  AlignedSubstitutions(const std::vector<TokenRange> &ranges,
+                       bool heuristic) noexcept;
+
   // Is this token range valid?
   inline operator bool(void) const noexcept {
     return first < after_last;
@@ -323,9 +351,11 @@ class TokenRange {
  private:
   friend class AST;
   friend class ASTImpl;
+  friend class BorrowedTokenRange;
   friend class CXXBaseSpecifier;
   friend class DeclPrinter;
   friend class FunctionDecl;
+  friend class PreprocessedTranslationUnit;
   friend class PrintedTokenRange;
   friend class Token;
 
@@ -0,0 +1,291 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <variant>
+
+#include <pasta/Util/Result.h>
+#include <pasta/Util/StdFileSystem.h>
+
+#include "Token.h"
+
+namespace pasta {
+
+class AST;
+class PreprocessedTranslationUnit;
+class TokenSnapshot;
+class TokenSnapshotFile;
+class TokenSnapshotImpl;
+class TokenSnapshotMacro;
+enum class MacroKind : unsigned char;
+
+// A token of a file in a token snapshot. This mirrors `FileToken`.
+class TokenSnapshotFileToken {
+ public:
+  TokenKind Kind(void) const noexcept;
+
+  // Return the data associated with this token.
+  std::string_view Data(void) const noexcept;
+
+  // Return the line number associated with this token.
+  unsigned Line(void) const noexcept;
+
+  // Return the column number associated with this token.
+  unsigned Column(void) const noexcept;
+
+  // The offset in the file of this token's data.
+  unsigned Offset(void) const noexcept;
+
+  // Index of this token within its file.
+  uint32_t Index(void) const noexcept;
+
+  // Return the file containing this token.
+  TokenSnapshotFile File(void) const noexcept;
+
+  inline bool operator==(const TokenSnapshotFileToken &that) const noexcept {
+    return impl == that.impl && index == that.index;
+  }
+
+  inline bool operator!=(const TokenSnapshotFileToken &that) const noexcept {
+    return impl != that.impl || index != that.index;
+  }
+
+ private:
+  friend class TokenSnapshot;
+  friend class TokenSnapshotFile;
+  friend class TokenSnapshotToken;
+
+  TokenSnapshotFileToken(void) = delete;
+
+  inline TokenSnapshotFileToken(std::shared_ptr<const TokenSnapshotImpl> impl_,
+                                uint32_t index_)
+      : impl(std::move(impl_)),
+        index(index_) {}
+
+  std::shared_ptr<const TokenSnapshotImpl> impl;
+
+  // Index of this token across all files of the snapshot.
+  uint32_t index;
+};
+
+// A file in a token snapshot. This mirrors `File`.
+class TokenSnapshotFile {
+ public:
+
+  // Return the path of this file, as it was when the snapshot was made.
+  std::filesystem::path Path(void) const noexcept;
+
+  // Return the contents of this file.
+  std::string_view Data(void) const noexcept;
+
+  // Return a hash of the data. This is the same as `File::DataHash`.
+  uint64_t DataHash(void) const noexcept;
+
+  // Number of tokens in this file.
+  uint32_t NumTokens(void) const noexcept;
+
+  // Return the `index`th token of this file, if any.
+  std::optional<TokenSnapshotFileToken> Token(uint32_t index) const noexcept;
+
+  // Index of this file in the snapshot.
+  inline uint32_t Index(void) const noexcept {
+    return index;
+  }
+
+  inline bool operator==(const TokenSnapshotFile &that) const noexcept {
+    return impl == that.impl && index == that.index;
+  }
+
+  inline bool operator!=(const TokenSnapshotFile &that) const noexcept {
+    return impl != that.impl || index != that.index;
+  }
+
+ private:
+  friend class TokenSnapshot;
+  friend class TokenSnapshotFileToken;
+
+  TokenSnapshotFile(void) = delete;
+
+  inline TokenSnapshotFile(std::shared_ptr<const TokenSnapshotImpl> impl_,
+                           uint32_t index_)
+      : impl(std::move(impl_)),
+        index(index_) {}
+
+  std::shared_ptr<const TokenSnapshotImpl> impl;
+  uint32_t index;
+};
+
+// A parsed token in a token snapshot. This mirrors `Token`.
+class TokenSnapshotToken {
+ public:
+  TokenKind Kind(void) const noexcept;
+
+  TokenRole Role(void) const noexcept;
+
+  // Return the data associated with this token.
+  std::string_view Data(void) const noexcept;
+
+  // Index of this token in the snapshot's token list. This is the same as
+  // `Token::Index` of the token in the original AST.
+  inline uint32_t Index(void) const noexcept {
+    return index;
+  }
+
+  // Is this token associated with a macro definition?
+  bool IsMacroName(void) const noexcept;
+
+  // Location of the token in a file.
+  std::optional<TokenSnapshotFileToken> FileLocation(void) const noexcept;
+
+  // The token from which this token was derived, if this token was produced
+  // by a macro expansion.
+  std::optional<TokenSnapshotToken> DerivedLocation(void) const noexcept;
+
+  // The macro node containing the macro token corresponding to this token,
+  // if this token has a macro role.
+  std::optional<TokenSnapshotMacro> Macro(void) const noexcept;
+
+  inline bool operator==(const TokenSnapshotToken &that) const noexcept {
+    return impl == that.impl && index == that.index;
+  }
+
+  inline bool operator!=(const TokenSnapshotToken &that) const noexcept {
+    return impl != that.impl || index != that.index;
+  }
+
+ private:
+  friend class TokenSnapshot;
+  friend class TokenSnapshotMacro;
+
+  TokenSnapshotToken(void) = delete;
+
+  inline TokenSnapshotToken(std::shared_ptr<const TokenSnapshotImpl> impl_,
+                            uint32_t index_)
+      : impl(std::move(impl_)),
+        index(index_) {}
+
+  std::shared_ptr<const TokenSnapshotImpl> impl;
+  uint32_t index;
+};
+
+// A child of a macro node in a token snapshot. Macro tokens are represented by
+// the parsed tokens to which they correspond.
+using TokenSnapshotMacroChild =
+    std::variant<TokenSnapshotMacro, TokenSnapshotToken>;
+
+// A macro node in a token snapshot. This mirrors `Macro`, but not any of its
+// derived classes.
+class TokenSnapshotMacro {
+ public:
+  MacroKind Kind(void) const noexcept;
+
+  // Return the macro node containing this node.
+  std::optional<TokenSnapshotMacro> Parent(void) const noexcept;
+
+  // Children of this macro. These are the same as `Macro::Children`.
+  uint32_t NumChildren(void) const noexcept;
+  std::optional<TokenSnapshotMacroChild> Child(uint32_t index) const noexcept;
+
+  // Replacement children of this macro, assuming it is a substitution. These
+  // are the same as `MacroSubstitution::ReplacementChildren`.
+  uint32_t NumReplacementChildren(void) const noexcept;
+  std::optional<TokenSnapshotMacroChild> ReplacementChild(
+      uint32_t index) const noexcept;
+
+  // Index of this macro node in the snapshot.
+  inline uint32_t Index(void) const noexcept {
+    return index;
+  }
+
+  inline bool operator==(const TokenSnapshotMacro &that) const noexcept {
+    return impl == that.impl && index == that.index;
+  }
+
+  inline bool operator!=(const TokenSnapshotMacro &that) const noexcept {
+    return impl != that.impl || index != that.index;
+  }
+
+ private:
+  friend class TokenSnapshot;
+  friend class TokenSnapshotToken;
+
+  TokenSnapshotMacro(void) = delete;
+
+  inline TokenSnapshotMacro(std::shared_ptr<const TokenSnapshotImpl> impl_,
+                            uint32_t index_)
+      : impl(std::move(impl_)),
+        index(index_) {}
+
+  // Decode an entry in the children of a macro node.
+  static TokenSnapshotMacroChild DecodeChild(
+      const std::shared_ptr<const TokenSnapshotImpl> &impl, uint32_t child);
+
+  std::shared_ptr<const TokenSnapshotImpl> impl;
+  uint32_t index;
+};
+
+// A read-only view of the parsed tokens, macros, and file tokens of an AST or
+// of a preprocessed translation unit, which doesn't depend on any Clang state.
+// Token snapshots are serialized into a versioned binary format by
+// `TokenSnapshot::Serialize`, and can then be loaded by a later pipeline
+// stage, or on another machine, without recompiling anything. Loaded files are
+// memory-mapped, and accessing the snapshot only reads from the mapping.
+class TokenSnapshot {
+ public:
+  // Version of the binary format. Loading a snapshot with a different version
+  // fails.
+  static constexpr uint32_t kVersion = 1u;
+
+  // Serialize the tokens, macros, and file tokens of `ast`. This fails with
+  // `std::errc::value_too_large` if a count or offset in the snapshot doesn't
+  // fit into 32 bits, e.g. if the pre-processed code is 4 GiB or more.
+  static Result<std::string, std::error_code> Serialize(const AST &ast);
+  static Result<std::string, std::error_code> Serialize(
+      const PreprocessedTranslationUnit &tu);
+
+  // Memory-map and validate the serialized token snapshot in the file at
+  // `path`, starting `offset` bytes into the file. `offset` should be a
+  // multiple of eight, otherwise the snapshot is copied out of the mapping.
+  static Result<TokenSnapshot, std::error_code> Load(
+      const std::filesystem::path &path, uint64_t offset = 0u);
+
+  // Validate the serialized token snapshot in `data`, taking ownership of it.
+  static Result<TokenSnapshot, std::error_code> Load(std::string data);
+
+  // Return the main file.
+  TokenSnapshotFile MainFile(void) const noexcept;
+
+  // The files which were parsed, in the same order as in
+  // `AST::ParsedFiles`.
+  uint32_t NumFiles(void) const noexcept;
+  std::optional<TokenSnapshotFile> File(uint32_t index) const noexcept;
+
+  // All parsed tokens, in the same order as in `AST::Tokens`.
+  uint32_t NumTokens(void) const noexcept;
+  std::optional<TokenSnapshotToken> Token(uint32_t index) const noexcept;
+
+  // Top-level macro nodes, in the same order as in `AST::Macros`.
+  uint32_t NumMacros(void) const noexcept;
+  std::optional<TokenSnapshotMacroChild> Macro(uint32_t index) const noexcept;
+
+  // Return the raw pre-processed code.
+  std::string_view PreprocessedCode(void) const noexcept;
+
+ private:
+  TokenSnapshot(void) = delete;
+
+  inline explicit TokenSnapshot(std::shared_ptr<const TokenSnapshotImpl> impl_)
+      : impl(std::move(impl_)) {}
+
+  std::shared_ptr<const TokenSnapshotImpl> impl;
+};
+
+}  // namespace pasta
@@ -9,9 +9,11 @@
 #ifdef PASTA_IN_BOOTSTRAP
 #  include "TypeBootstrap.h"
 #else
+#include <type_traits>
 #include <variant>
 #include <vector>
 #include <pasta/Util/Compiler.h>
+#include "LazyRange.h"
 #include "TypeManual.h"
 
 #define PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(base) \
@@ -107,6 +109,70 @@ class TypeVisitor {
   virtual void VisitRecordType(const RecordType &);
 };
 
+struct TypeSnapshot;
+struct TypeOfExprTypeSnapshot;
+struct TypeOfTypeSnapshot;
+struct TypedefTypeSnapshot;
+struct UnaryTransformTypeSnapshot;
+struct UnresolvedUsingTypeSnapshot;
+struct UsingTypeSnapshot;
+struct VectorTypeSnapshot;
+struct TypeWithKeywordSnapshot;
+struct AdjustedTypeSnapshot;
+struct ArrayTypeSnapshot;
+struct AtomicTypeSnapshot;
+struct AttributedTypeSnapshot;
+struct BTFTagAttributedTypeSnapshot;
+struct BitIntTypeSnapshot;
+struct BlockPointerTypeSnapshot;
+struct BuiltinTypeSnapshot;
+struct ComplexTypeSnapshot;
+struct ConstantArrayTypeSnapshot;
+struct DecayedTypeSnapshot;
+struct DecltypeTypeSnapshot;
+struct DeducedTypeSnapshot;
+struct DependentAddressSpaceTypeSnapshot;
+struct DependentBitIntTypeSnapshot;
+struct DependentNameTypeSnapshot;
+struct DependentSizedArrayTypeSnapshot;
+struct DependentSizedExtVectorTypeSnapshot;
+struct DependentTemplateSpecializationTypeSnapshot;
+struct DependentVectorTypeSnapshot;
+struct ElaboratedTypeSnapshot;
+struct ExtVectorTypeSnapshot;
+struct FunctionTypeSnapshot;
+struct IncompleteArrayTypeSnapshot;
+struct InjectedClassNameTypeSnapshot;
+struct MacroQualifiedTypeSnapshot;
+struct MatrixTypeSnapshot;
+struct MemberPointerTypeSnapshot;
+struct ObjCObjectPointerTypeSnapshot;
+struct ObjCObjectTypeSnapshot;
+struct ObjCTypeParamTypeSnapshot;
+struct PackExpansionTypeSnapshot;
+struct ParenTypeSnapshot;
+struct PipeTypeSnapshot;
+struct PointerTypeSnapshot;
+struct QualifiedTypeSnapshot;
+struct ReferenceTypeSnapshot;
+struct SubstTemplateTypeParmPackTypeSnapshot;
+struct SubstTemplateTypeParmTypeSnapshot;
+struct TagTypeSnapshot;
+struct TemplateSpecializationTypeSnapshot;
+struct TemplateTypeParmTypeSnapshot;
+struct VariableArrayTypeSnapshot;
+struct AutoTypeSnapshot;
+struct ConstantMatrixTypeSnapshot;
+struct DeducedTemplateSpecializationTypeSnapshot;
+struct DependentSizedMatrixTypeSnapshot;
+struct EnumTypeSnapshot;
+struct FunctionNoProtoTypeSnapshot;
+struct FunctionProtoTypeSnapshot;
+struct LValueReferenceTypeSnapshot;
+struct ObjCInterfaceTypeSnapshot;
+struct RValueReferenceTypeSnapshot;
+struct RecordTypeSnapshot;
+
 // Wraps a type, including its qualifiers.
 class Type {
  protected:
@@ -115,6 +181,7 @@ class Type {
   friend class TypeBuilder;
   friend class PrintedTokenRange;
 
+  friend class BorrowedType;
   friend class TokenContext;
   std::shared_ptr<ASTImpl> ast;
   union {
@@ -199,6 +266,7 @@ class Type {
 
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(Type)
+  static constexpr ::pasta::detail::KindRange kKindRange = {0, 55};
   clang::QualType RawQualType(void) const noexcept;
 
   inline const clang::Type *RawType(void) const noexcept {
@@ -283,6 +351,19 @@ class Type {
   inline bool IsQualified(void) const noexcept {
     return qualifiers;
   }
+
+  // Returns `true` if this is a `T`, or is derived from `T`. This
+  // ignores qualifiers, except when `T` is `QualifiedType`.
+  template <typename T>
+  inline bool Is(void) const noexcept {
+    if constexpr (std::is_same_v<T, QualifiedType>) {
+      return qualifiers;
+    } else {
+      return ::pasta::detail::IsInKindRange(
+          ::pasta::detail::TypeKindOrder(kind), T::kKindRange);
+    }
+  }
+
   inline Type UnqualifiedType(void) const noexcept {
     return Type(ast, u.Type, kind, 0);
   }
@@ -326,7 +407,9 @@ class Type {
   std::optional<::pasta::Type> RVVElementType(void) const;
   std::optional<enum TypeScalarTypeKind> ScalarTypeKind(void) const;
   std::optional<::pasta::Type> SveElementType(void) const;
-  ::pasta::TypeKind Kind(void) const;
+  inline ::pasta::TypeKind Kind(void) const noexcept {
+    return qualifiers ? ::pasta::TypeKind::kQualified : kind;
+  }
   std::string_view KindName(void) const;
   ::pasta::Type UnqualifiedDesugaredType(void) const;
   enum Visibility Visibility(void) const;
@@ -539,6 +622,216 @@ class Type {
   bool IsWebAssemblyExternrefType(void) const;
   bool IsWebAssemblyTableType(void) const;
   bool IsWideCharacterType(void) const;
+  ::pasta::TypeSnapshot Snapshot(void) const;
+};
+
+struct TypeSnapshot {
+  bool accepts_obj_c_type_parameters;
+  bool can_decay_to_pointer_type;
+  bool can_have_nullability;
+  bool contains_errors;
+  bool contains_unexpanded_parameter_pack;
+  enum Linkage linkage;
+  enum Visibility visibility;
+  bool has_auto_for_trailing_return_type;
+  bool has_floating_representation;
+  bool has_integer_representation;
+  bool has_obj_c_pointer_representation;
+  bool has_pointer_representation;
+  bool has_signed_integer_representation;
+  bool has_sized_vla_type;
+  bool has_unnamed_or_local_type;
+  bool has_unsigned_integer_representation;
+  bool is_align_value_t;
+  bool is_any_character_type;
+  bool is_any_complex_type;
+  bool is_any_pointer_type;
+  bool is_arithmetic_type;
+  bool is_array_type;
+  bool is_atomic_type;
+  bool is_b_float16_type;
+  bool is_bit_int_type;
+  bool is_block_compatible_obj_c_pointer_type;
+  bool is_block_pointer_type;
+  bool is_boolean_type;
+  bool is_builtin_type;
+  bool is_carc_bridgable_type;
+  bool is_cuda_device_builtin_surface_type;
+  bool is_cuda_device_builtin_texture_type;
+  bool is_canonical_unqualified;
+  bool is_char16_type;
+  bool is_char32_type;
+  bool is_char8_type;
+  bool is_character_type;
+  bool is_class_type;
+  bool is_clk_event_t;
+  bool is_complex_integer_type;
+  bool is_complex_type;
+  bool is_compound_type;
+  bool is_constant_array_type;
+  bool is_constant_matrix_type;
+  bool is_decltype_type;
+  bool is_dependent_address_space_type;
+  bool is_dependent_sized_array_type;
+  bool is_dependent_type;
+  bool is_elaborated_type_specifier;
+  bool is_enumeral_type;
+  bool is_event_t;
+  bool is_ext_vector_boolean_type;
+  bool is_ext_vector_type;
+  bool is_fixed_point_or_integer_type;
+  bool is_fixed_point_type;
+  bool is_float128_type;
+  bool is_float16_type;
+  bool is_floating_type;
+  bool is_from_ast;
+  bool is_function_no_proto_type;
+  bool is_function_pointer_type;
+  bool is_function_proto_type;
+  bool is_function_reference_type;
+  bool is_function_type;
+  bool is_fundamental_type;
+  bool is_half_type;
+  bool is_ibm128_type;
+  bool is_image_type;
+  bool is_incomplete_array_type;
+  bool is_incomplete_or_object_type;
+  bool is_incomplete_type;
+  bool is_instantiation_dependent_type;
+  bool is_integer_type;
+  bool is_integral_or_enumeration_type;
+  bool is_integral_or_unscoped_enumeration_type;
+  bool is_integral_type;
+  bool is_interface_type;
+  bool is_l_value_reference_type;
+  bool is_linkage_valid;
+  bool is_matrix_type;
+  bool is_member_data_pointer_type;
+  bool is_member_function_pointer_type;
+  bool is_member_pointer_type;
+  bool is_non_overload_placeholder_type;
+  bool is_nothrow_t;
+  bool is_null_pointer_type;
+  bool is_ocl_ext_opaque_type;
+  bool is_ocl_image_1d_array_ro_type;
+  bool is_ocl_image_1d_array_rw_type;
+  bool is_ocl_image_1d_array_wo_type;
+  bool is_ocl_image_1d_buffer_ro_type;
+  bool is_ocl_image_1d_buffer_rw_type;
+  bool is_ocl_image_1d_buffer_wo_type;
+  bool is_ocl_image_1d_ro_type;
+  bool is_ocl_image_1d_rw_type;
+  bool is_ocl_image_1d_wo_type;
+  bool is_ocl_image_2d_array_depth_ro_type;
+  bool is_ocl_image_2d_array_depth_rw_type;
+  bool is_ocl_image_2d_array_depth_wo_type;
+  bool is_ocl_image_2d_array_msaa_depth_ro_type;
+  bool is_ocl_image_2d_array_msaa_depth_rw_type;
+  bool is_ocl_image_2d_array_msaa_depth_wo_type;
+  bool is_ocl_image_2d_array_msaaro_type;
+  bool is_ocl_image_2d_array_msaarw_type;
+  bool is_ocl_image_2d_array_msaawo_type;
+  bool is_ocl_image_2d_array_ro_type;
+  bool is_ocl_image_2d_array_rw_type;
+  bool is_ocl_image_2d_array_wo_type;
+  bool is_ocl_image_2d_depth_ro_type;
+  bool is_ocl_image_2d_depth_rw_type;
+  bool is_ocl_image_2d_depth_wo_type;
+  bool is_ocl_image_2d_msaa_depth_ro_type;
+  bool is_ocl_image_2d_msaa_depth_rw_type;
+  bool is_ocl_image_2d_msaa_depth_wo_type;
+  bool is_ocl_image_2d_msaaro_type;
+  bool is_ocl_image_2d_msaarw_type;
+  bool is_ocl_image_2d_msaawo_type;
+  bool is_ocl_image_2d_ro_type;
+  bool is_ocl_image_2d_rw_type;
+  bool is_ocl_image_2d_wo_type;
+  bool is_ocl_image_3d_ro_type;
+  bool is_ocl_image_3d_rw_type;
+  bool is_ocl_image_3d_wo_type;
+  bool is_ocl_intel_subgroup_avc_ime_dual_reference_streamin_type;
+  bool is_ocl_intel_subgroup_avc_ime_payload_type;
+  bool is_ocl_intel_subgroup_avc_ime_result_dual_reference_streamout_type;
+  bool is_ocl_intel_subgroup_avc_ime_result_single_reference_streamout_type;
+  bool is_ocl_intel_subgroup_avc_ime_result_type;
+  bool is_ocl_intel_subgroup_avc_ime_single_reference_streamin_type;
+  bool is_ocl_intel_subgroup_avc_mce_payload_type;
+  bool is_ocl_intel_subgroup_avc_mce_result_type;
+  bool is_ocl_intel_subgroup_avc_ref_payload_type;
+  bool is_ocl_intel_subgroup_avc_ref_result_type;
+  bool is_ocl_intel_subgroup_avc_sic_payload_type;
+  bool is_ocl_intel_subgroup_avc_sic_result_type;
+  bool is_ocl_intel_subgroup_avc_type;
+  bool is_obj_carc_bridgable_type;
+  bool is_obj_c_boxable_record_type;
+  bool is_obj_c_builtin_type;
+  bool is_obj_c_class_or_class_kind_of_type;
+  bool is_obj_c_class_type;
+  bool is_obj_c_id_type;
+  bool is_obj_c_independent_class_type;
+  bool is_obj_c_indirect_lifetime_type;
+  bool is_obj_c_inert_unsafe_unretained_type;
+  bool is_obj_c_lifetime_type;
+  bool is_obj_cns_object_type;
+  bool is_obj_c_object_or_interface_type;
+  bool is_obj_c_object_pointer_type;
+  bool is_obj_c_object_type;
+  bool is_obj_c_qualified_class_type;
+  bool is_obj_c_qualified_id_type;
+  bool is_obj_c_qualified_interface_type;
+  bool is_obj_c_retainable_type;
+  bool is_obj_c_sel_type;
+  bool is_object_pointer_type;
+  bool is_object_type;
+  bool is_open_cl_specific_type;
+  bool is_overloadable_type;
+  bool is_pipe_type;
+  bool is_placeholder_type;
+  bool is_pointer_type;
+  bool is_queue_t;
+  bool is_rvv_sizeless_builtin_type;
+  bool is_rvvvls_builtin_type;
+  bool is_r_value_reference_type;
+  bool is_real_floating_type;
+  bool is_real_type;
+  bool is_record_type;
+  bool is_reference_type;
+  bool is_reserve_idt;
+  bool is_sve_sizeless_builtin_type;
+  bool is_sampler_t;
+  bool is_saturated_fixed_point_type;
+  bool is_scalar_type;
+  bool is_scoped_enumeral_type;
+  bool is_signed_fixed_point_type;
+  bool is_signed_integer_or_enumeration_type;
+  bool is_signed_integer_type;
+  bool is_sizeless_builtin_type;
+  bool is_sizeless_type;
+  bool is_specifier_type;
+  bool is_std_byte_type;
+  bool is_structure_or_class_type;
+  bool is_structure_type;
+  bool is_template_type_parm_type;
+  bool is_typedef_name_type;
+  bool is_undeduced_auto_type;
+  bool is_undeduced_type;
+  bool is_union_type;
+  bool is_unresolved_type;
+  bool is_unsaturated_fixed_point_type;
+  bool is_unscoped_enumeration_type;
+  bool is_unsigned_fixed_point_type;
+  bool is_unsigned_integer_or_enumeration_type;
+  bool is_unsigned_integer_type;
+  bool is_vlst_builtin_type;
+  bool is_variable_array_type;
+  bool is_variably_modified_type;
+  bool is_vector_type;
+  bool is_visibility_explicit;
+  bool is_void_pointer_type;
+  bool is_void_type;
+  bool is_web_assembly_externref_type;
+  bool is_web_assembly_table_type;
+  bool is_wide_character_type;
 };
 
 class TypeOfExprType : public Type {
@@ -546,14 +839,21 @@ class TypeOfExprType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(TypeOfExprType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {44, 45};
   PASTA_DECLARE_BASE_OPERATORS(Type, TypeOfExprType)
   ::pasta::Type Desugar(void) const;
   enum TypeOfKind TypeKind(void) const;
   ::pasta::Expr UnderlyingExpression(void) const;
   bool IsSugared(void) const;
+  ::pasta::TypeOfExprTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(TypeOfExprType)
 };
+
+struct TypeOfExprTypeSnapshot : public TypeSnapshot {
+  enum TypeOfKind type_kind;
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(TypeOfExprType));
 
 class TypeOfType : public Type {
@@ -561,14 +861,21 @@ class TypeOfType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(TypeOfType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {45, 46};
   PASTA_DECLARE_BASE_OPERATORS(Type, TypeOfType)
   ::pasta::Type Desugar(void) const;
   enum TypeOfKind TypeKind(void) const;
   ::pasta::Type UnmodifiedType(void) const;
   bool IsSugared(void) const;
+  ::pasta::TypeOfTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(TypeOfType)
 };
+
+struct TypeOfTypeSnapshot : public TypeSnapshot {
+  enum TypeOfKind type_kind;
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(TypeOfType));
 
 class TypedefType : public Type {
@@ -576,14 +883,21 @@ class TypedefType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(TypedefType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {49, 50};
   PASTA_DECLARE_BASE_OPERATORS(Type, TypedefType)
   ::pasta::Type Desugar(void) const;
   ::pasta::TypedefNameDecl Declaration(void) const;
   bool IsSugared(void) const;
   bool TypeMatchesDeclaration(void) const;
+  ::pasta::TypedefTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(TypedefType)
 };
+
+struct TypedefTypeSnapshot : public TypeSnapshot {
+  bool is_sugared;
+  bool type_matches_declaration;
+};
 static_assert(sizeof(Type) == sizeof(TypedefType));
 
 class UnaryTransformType : public Type {
@@ -591,15 +905,22 @@ class UnaryTransformType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(UnaryTransformType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {50, 51};
   PASTA_DECLARE_BASE_OPERATORS(Type, UnaryTransformType)
   std::optional<::pasta::Type> Desugar(void) const;
   std::optional<::pasta::Type> BaseType(void) const;
   enum UnaryTransformTypeUTTKind UTTKind(void) const;
   std::optional<::pasta::Type> UnderlyingType(void) const;
   bool IsSugared(void) const;
+  ::pasta::UnaryTransformTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(UnaryTransformType)
 };
+
+struct UnaryTransformTypeSnapshot : public TypeSnapshot {
+  enum UnaryTransformTypeUTTKind utt_kind;
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(UnaryTransformType));
 
 class UnresolvedUsingType : public Type {
@@ -607,13 +928,19 @@ class UnresolvedUsingType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(UnresolvedUsingType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {51, 52};
   PASTA_DECLARE_BASE_OPERATORS(Type, UnresolvedUsingType)
   ::pasta::Type Desugar(void) const;
   ::pasta::UnresolvedUsingTypenameDecl Declaration(void) const;
   bool IsSugared(void) const;
+  ::pasta::UnresolvedUsingTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(UnresolvedUsingType)
 };
+
+struct UnresolvedUsingTypeSnapshot : public TypeSnapshot {
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(UnresolvedUsingType));
 
 class UsingType : public Type {
@@ -621,15 +948,22 @@ class UsingType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(UsingType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {52, 53};
   PASTA_DECLARE_BASE_OPERATORS(Type, UsingType)
   ::pasta::Type Desugar(void) const;
   ::pasta::UsingShadowDecl FoundDeclaration(void) const;
   ::pasta::Type UnderlyingType(void) const;
   bool IsSugared(void) const;
   bool TypeMatchesDeclaration(void) const;
+  ::pasta::UsingTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(UsingType)
 };
+
+struct UsingTypeSnapshot : public TypeSnapshot {
+  bool is_sugared;
+  bool type_matches_declaration;
+};
 static_assert(sizeof(Type) == sizeof(UsingType));
 
 class VectorType : public Type {
@@ -637,6 +971,7 @@ class VectorType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(VectorType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {53, 55};
   PASTA_DECLARE_BASE_OPERATORS(Type, VectorType)
   PASTA_DECLARE_DERIVED_OPERATORS(VectorType, ExtVectorType)
   ::pasta::Type Desugar(void) const;
@@ -644,9 +979,16 @@ class VectorType : public Type {
   uint32_t NumElements(void) const;
   enum VectorTypeVectorKind VectorKind(void) const;
   bool IsSugared(void) const;
+  ::pasta::VectorTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(VectorType)
 };
+
+struct VectorTypeSnapshot : public TypeSnapshot {
+  uint32_t num_elements;
+  enum VectorTypeVectorKind vector_kind;
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(VectorType));
 
 class TypeWithKeyword : public Type {
@@ -654,14 +996,20 @@ class TypeWithKeyword : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(TypeWithKeyword)
+  static constexpr ::pasta::detail::KindRange kKindRange = {46, 49};
   PASTA_DECLARE_BASE_OPERATORS(Type, TypeWithKeyword)
   PASTA_DECLARE_DERIVED_OPERATORS(TypeWithKeyword, DependentNameType)
   PASTA_DECLARE_DERIVED_OPERATORS(TypeWithKeyword, DependentTemplateSpecializationType)
   PASTA_DECLARE_DERIVED_OPERATORS(TypeWithKeyword, ElaboratedType)
   enum ElaboratedTypeKeyword Keyword(void) const;
+  ::pasta::TypeWithKeywordSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(TypeWithKeyword)
 };
+
+struct TypeWithKeywordSnapshot : public TypeSnapshot {
+  enum ElaboratedTypeKeyword keyword;
+};
 static_assert(sizeof(Type) == sizeof(TypeWithKeyword));
 
 class AdjustedType : public Type {
@@ -669,15 +1017,21 @@ class AdjustedType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(AdjustedType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {0, 2};
   PASTA_DECLARE_BASE_OPERATORS(Type, AdjustedType)
   PASTA_DECLARE_DERIVED_OPERATORS(AdjustedType, DecayedType)
   ::pasta::Type Desugar(void) const;
   ::pasta::Type ResolvedType(void) const;
   ::pasta::Type OriginalType(void) const;
   bool IsSugared(void) const;
+  ::pasta::AdjustedTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(AdjustedType)
 };
+
+struct AdjustedTypeSnapshot : public TypeSnapshot {
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(AdjustedType));
 
 class ArrayType : public Type {
@@ -685,6 +1039,7 @@ class ArrayType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ArrayType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {2, 6};
   PASTA_DECLARE_BASE_OPERATORS(Type, ArrayType)
   PASTA_DECLARE_DERIVED_OPERATORS(ArrayType, ConstantArrayType)
   PASTA_DECLARE_DERIVED_OPERATORS(ArrayType, DependentSizedArrayType)
@@ -694,9 +1049,15 @@ class ArrayType : public Type {
   uint32_t IndexTypeCVRQualifiers(void) const;
   // IndexTypeQualifiers: (clang::Qualifiers)
   enum ArrayTypeArraySizeModifier SizeModifier(void) const;
+  ::pasta::ArrayTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(ArrayType)
 };
+
+struct ArrayTypeSnapshot : public TypeSnapshot {
+  uint32_t index_type_cvr_qualifiers;
+  enum ArrayTypeArraySizeModifier size_modifier;
+};
 static_assert(sizeof(Type) == sizeof(ArrayType));
 
 class AtomicType : public Type {
@@ -704,13 +1065,19 @@ class AtomicType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(AtomicType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {6, 7};
   PASTA_DECLARE_BASE_OPERATORS(Type, AtomicType)
   ::pasta::Type Desugar(void) const;
   ::pasta::Type ValueType(void) const;
   bool IsSugared(void) const;
+  ::pasta::AtomicTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(AtomicType)
 };
+
+struct AtomicTypeSnapshot : public TypeSnapshot {
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(AtomicType));
 
 class AttributedType : public Type {
@@ -718,6 +1085,7 @@ class AttributedType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(AttributedType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {7, 8};
   PASTA_DECLARE_BASE_OPERATORS(Type, AttributedType)
   ::pasta::Type Desugar(void) const;
   std::optional<::pasta::Attr> Attribute(void) const;
@@ -731,9 +1099,20 @@ class AttributedType : public Type {
   bool IsQualifier(void) const;
   bool IsSugared(void) const;
   bool IsWebAssemblyFuncrefSpec(void) const;
+  ::pasta::AttributedTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(AttributedType)
 };
+
+struct AttributedTypeSnapshot : public TypeSnapshot {
+  enum ::pasta::AttrKind attribute_kind;
+  bool has_attribute;
+  bool is_calling_conv;
+  bool is_ms_type_spec;
+  bool is_qualifier;
+  bool is_sugared;
+  bool is_web_assembly_funcref_spec;
+};
 static_assert(sizeof(Type) == sizeof(AttributedType));
 
 class BTFTagAttributedType : public Type {
@@ -741,14 +1120,20 @@ class BTFTagAttributedType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(BTFTagAttributedType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {8, 9};
   PASTA_DECLARE_BASE_OPERATORS(Type, BTFTagAttributedType)
   ::pasta::Type Desugar(void) const;
   ::pasta::BTFTypeTagAttr Attribute(void) const;
   ::pasta::Type WrappedType(void) const;
   bool IsSugared(void) const;
+  ::pasta::BTFTagAttributedTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(BTFTagAttributedType)
 };
+
+struct BTFTagAttributedTypeSnapshot : public TypeSnapshot {
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(BTFTagAttributedType));
 
 class BitIntType : public Type {
@@ -756,15 +1141,24 @@ class BitIntType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(BitIntType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {9, 10};
   PASTA_DECLARE_BASE_OPERATORS(Type, BitIntType)
   ::pasta::Type Desugar(void) const;
   uint32_t NumBits(void) const;
   bool IsSigned(void) const;
   bool IsSugared(void) const;
   bool IsUnsigned(void) const;
+  ::pasta::BitIntTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(BitIntType)
 };
+
+struct BitIntTypeSnapshot : public TypeSnapshot {
+  uint32_t num_bits;
+  bool is_signed;
+  bool is_sugared;
+  bool is_unsigned;
+};
 static_assert(sizeof(Type) == sizeof(BitIntType));
 
 class BlockPointerType : public Type {
@@ -772,13 +1166,19 @@ class BlockPointerType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(BlockPointerType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {10, 11};
   PASTA_DECLARE_BASE_OPERATORS(Type, BlockPointerType)
   ::pasta::Type Desugar(void) const;
   ::pasta::Type PointeeType(void) const;
   bool IsSugared(void) const;
+  ::pasta::BlockPointerTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(BlockPointerType)
 };
+
+struct BlockPointerTypeSnapshot : public TypeSnapshot {
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(BlockPointerType));
 
 class BuiltinType : public Type {
@@ -786,6 +1186,7 @@ class BuiltinType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(BuiltinType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {11, 12};
   PASTA_DECLARE_BASE_OPERATORS(Type, BuiltinType)
   ::pasta::Type Desugar(void) const;
   ::pasta::BuiltinTypeKind BuiltinKind(void) const;
@@ -800,9 +1201,21 @@ class BuiltinType : public Type {
   bool IsSignedInteger(void) const;
   bool IsSugared(void) const;
   bool IsUnsignedInteger(void) const;
+  ::pasta::BuiltinTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(BuiltinType)
 };
+
+struct BuiltinTypeSnapshot : public TypeSnapshot {
+  ::pasta::BuiltinTypeKind builtin_kind;
+  bool is_floating_point;
+  bool is_integer;
+  bool is_sve_bool;
+  bool is_sve_count;
+  bool is_signed_integer;
+  bool is_sugared;
+  bool is_unsigned_integer;
+};
 static_assert(sizeof(Type) == sizeof(BuiltinType));
 
 class ComplexType : public Type {
@@ -810,13 +1223,19 @@ class ComplexType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ComplexType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {12, 13};
   PASTA_DECLARE_BASE_OPERATORS(Type, ComplexType)
   ::pasta::Type Desugar(void) const;
   ::pasta::Type ElementType(void) const;
   bool IsSugared(void) const;
+  ::pasta::ComplexTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(ComplexType)
 };
+
+struct ComplexTypeSnapshot : public TypeSnapshot {
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(ComplexType));
 
 class ConstantArrayType : public ArrayType {
@@ -825,15 +1244,21 @@ class ConstantArrayType : public ArrayType {
   using ArrayType::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ConstantArrayType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {2, 3};
   PASTA_DECLARE_BASE_OPERATORS(ArrayType, ConstantArrayType)
   PASTA_DECLARE_BASE_OPERATORS(Type, ConstantArrayType)
   ::pasta::Type Desugar(void) const;
   llvm::APInt Size(void) const;
   std::optional<::pasta::Expr> SizeExpression(void) const;
   bool IsSugared(void) const;
+  ::pasta::ConstantArrayTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(ConstantArrayType)
 };
+
+struct ConstantArrayTypeSnapshot : public ArrayTypeSnapshot {
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(ConstantArrayType));
 
 class DecayedType : public AdjustedType {
@@ -842,13 +1267,18 @@ class DecayedType : public AdjustedType {
   using AdjustedType::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(DecayedType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {1, 2};
   PASTA_DECLARE_BASE_OPERATORS(AdjustedType, DecayedType)
   PASTA_DECLARE_BASE_OPERATORS(Type, DecayedType)
   ::pasta::Type ResolvedType(void) const;
   ::pasta::Type PointeeType(void) const;
+  ::pasta::DecayedTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(DecayedType)
 };
+
+struct DecayedTypeSnapshot : public AdjustedTypeSnapshot {
+};
 static_assert(sizeof(Type) == sizeof(DecayedType));
 
 class DecltypeType : public Type {
@@ -856,14 +1286,20 @@ class DecltypeType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(DecltypeType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {13, 14};
   PASTA_DECLARE_BASE_OPERATORS(Type, DecltypeType)
   ::pasta::Type Desugar(void) const;
   ::pasta::Expr UnderlyingExpression(void) const;
   ::pasta::Type UnderlyingType(void) const;
   bool IsSugared(void) const;
+  ::pasta::DecltypeTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(DecltypeType)
 };
+
+struct DecltypeTypeSnapshot : public TypeSnapshot {
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(DecltypeType));
 
 class DeducedType : public Type {
@@ -871,6 +1307,7 @@ class DeducedType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(DeducedType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {14, 16};
   PASTA_DECLARE_BASE_OPERATORS(Type, DeducedType)
   PASTA_DECLARE_DERIVED_OPERATORS(DeducedType, AutoType)
   PASTA_DECLARE_DERIVED_OPERATORS(DeducedType, DeducedTemplateSpecializationType)
@@ -878,9 +1315,15 @@ class DeducedType : public Type {
   std::optional<::pasta::Type> ResolvedType(void) const;
   bool IsDeduced(void) const;
   bool IsSugared(void) const;
+  ::pasta::DeducedTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(DeducedType)
 };
+
+struct DeducedTypeSnapshot : public TypeSnapshot {
+  bool is_deduced;
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(DeducedType));
 
 class DependentAddressSpaceType : public Type {
@@ -888,15 +1331,22 @@ class DependentAddressSpaceType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(DependentAddressSpaceType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {16, 17};
   PASTA_DECLARE_BASE_OPERATORS(Type, DependentAddressSpaceType)
   ::pasta::Type Desugar(void) const;
   ::pasta::Expr AddressSpaceExpression(void) const;
   ::pasta::Token AttributeToken(void) const;
   ::pasta::Type PointeeType(void) const;
   bool IsSugared(void) const;
+  ::pasta::DependentAddressSpaceTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(DependentAddressSpaceType)
 };
+
+struct DependentAddressSpaceTypeSnapshot : public TypeSnapshot {
+  uint32_t attribute_token;
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(DependentAddressSpaceType));
 
 class DependentBitIntType : public Type {
@@ -904,15 +1354,23 @@ class DependentBitIntType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(DependentBitIntType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {17, 18};
   PASTA_DECLARE_BASE_OPERATORS(Type, DependentBitIntType)
   ::pasta::Type Desugar(void) const;
   ::pasta::Expr NumBitsExpression(void) const;
   bool IsSigned(void) const;
   bool IsSugared(void) const;
   bool IsUnsigned(void) const;
+  ::pasta::DependentBitIntTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(DependentBitIntType)
 };
+
+struct DependentBitIntTypeSnapshot : public TypeSnapshot {
+  bool is_signed;
+  bool is_sugared;
+  bool is_unsigned;
+};
 static_assert(sizeof(Type) == sizeof(DependentBitIntType));
 
 class DependentNameType : public TypeWithKeyword {
@@ -921,15 +1379,21 @@ class DependentNameType : public TypeWithKeyword {
   using TypeWithKeyword::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(DependentNameType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {46, 47};
   PASTA_DECLARE_BASE_OPERATORS(Type, DependentNameType)
   PASTA_DECLARE_BASE_OPERATORS(TypeWithKeyword, DependentNameType)
   ::pasta::Type Desugar(void) const;
   // Identifier: (const clang::IdentifierInfo *)
   // Qualifier: (clang::NestedNameSpecifier *)
   bool IsSugared(void) const;
+  ::pasta::DependentNameTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(DependentNameType)
 };
+
+struct DependentNameTypeSnapshot : public TypeWithKeywordSnapshot {
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(DependentNameType));
 
 class DependentSizedArrayType : public ArrayType {
@@ -938,6 +1402,7 @@ class DependentSizedArrayType : public ArrayType {
   using ArrayType::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(DependentSizedArrayType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {3, 4};
   PASTA_DECLARE_BASE_OPERATORS(ArrayType, DependentSizedArrayType)
   PASTA_DECLARE_BASE_OPERATORS(Type, DependentSizedArrayType)
   ::pasta::Type Desugar(void) const;
@@ -946,9 +1411,16 @@ class DependentSizedArrayType : public ArrayType {
   ::pasta::Token RBracketToken(void) const;
   std::optional<::pasta::Expr> SizeExpression(void) const;
   bool IsSugared(void) const;
+  ::pasta::DependentSizedArrayTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(DependentSizedArrayType)
 };
+
+struct DependentSizedArrayTypeSnapshot : public ArrayTypeSnapshot {
+  uint32_t l_bracket_token;
+  uint32_t r_bracket_token;
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(DependentSizedArrayType));
 
 class DependentSizedExtVectorType : public Type {
@@ -956,15 +1428,22 @@ class DependentSizedExtVectorType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(DependentSizedExtVectorType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {18, 19};
   PASTA_DECLARE_BASE_OPERATORS(Type, DependentSizedExtVectorType)
   ::pasta::Type Desugar(void) const;
   ::pasta::Token AttributeToken(void) const;
   ::pasta::Type ElementType(void) const;
   ::pasta::Expr SizeExpression(void) const;
   bool IsSugared(void) const;
+  ::pasta::DependentSizedExtVectorTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(DependentSizedExtVectorType)
 };
+
+struct DependentSizedExtVectorTypeSnapshot : public TypeSnapshot {
+  uint32_t attribute_token;
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(DependentSizedExtVectorType));
 
 class DependentTemplateSpecializationType : public TypeWithKeyword {
@@ -973,6 +1452,7 @@ class DependentTemplateSpecializationType : public TypeWithKeyword {
   using TypeWithKeyword::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(DependentTemplateSpecializationType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {47, 48};
   PASTA_DECLARE_BASE_OPERATORS(Type, DependentTemplateSpecializationType)
   PASTA_DECLARE_BASE_OPERATORS(TypeWithKeyword, DependentTemplateSpecializationType)
   ::pasta::Type Desugar(void) const;
@@ -980,9 +1460,14 @@ class DependentTemplateSpecializationType : public TypeWithKeyword {
   // Qualifier: (clang::NestedNameSpecifier *)
   bool IsSugared(void) const;
   std::vector<::pasta::TemplateArgument> TemplateArguments(void) const;
+  ::pasta::DependentTemplateSpecializationTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(DependentTemplateSpecializationType)
 };
+
+struct DependentTemplateSpecializationTypeSnapshot : public TypeWithKeywordSnapshot {
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(DependentTemplateSpecializationType));
 
 class DependentVectorType : public Type {
@@ -990,6 +1475,7 @@ class DependentVectorType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(DependentVectorType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {19, 20};
   PASTA_DECLARE_BASE_OPERATORS(Type, DependentVectorType)
   ::pasta::Type Desugar(void) const;
   ::pasta::Token AttributeToken(void) const;
@@ -997,9 +1483,16 @@ class DependentVectorType : public Type {
   ::pasta::Expr SizeExpression(void) const;
   enum VectorTypeVectorKind VectorKind(void) const;
   bool IsSugared(void) const;
+  ::pasta::DependentVectorTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(DependentVectorType)
 };
+
+struct DependentVectorTypeSnapshot : public TypeSnapshot {
+  uint32_t attribute_token;
+  enum VectorTypeVectorKind vector_kind;
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(DependentVectorType));
 
 class ElaboratedType : public TypeWithKeyword {
@@ -1008,6 +1501,7 @@ class ElaboratedType : public TypeWithKeyword {
   using TypeWithKeyword::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ElaboratedType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {48, 49};
   PASTA_DECLARE_BASE_OPERATORS(Type, ElaboratedType)
   PASTA_DECLARE_BASE_OPERATORS(TypeWithKeyword, ElaboratedType)
   ::pasta::Type Desugar(void) const;
@@ -1015,9 +1509,14 @@ class ElaboratedType : public TypeWithKeyword {
   std::optional<::pasta::TagDecl> OwnedTagDeclaration(void) const;
   // Qualifier: (clang::NestedNameSpecifier *)
   bool IsSugared(void) const;
+  ::pasta::ElaboratedTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(ElaboratedType)
 };
+
+struct ElaboratedTypeSnapshot : public TypeWithKeywordSnapshot {
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(ElaboratedType));
 
 class ExtVectorType : public VectorType {
@@ -1026,14 +1525,19 @@ class ExtVectorType : public VectorType {
   using VectorType::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ExtVectorType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {54, 55};
   PASTA_DECLARE_BASE_OPERATORS(Type, ExtVectorType)
   PASTA_DECLARE_BASE_OPERATORS(VectorType, ExtVectorType)
   ::pasta::Type Desugar(void) const;
   // IsAccessorWithinNumElements: (bool)
   bool IsSugared(void) const;
+  ::pasta::ExtVectorTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(ExtVectorType)
 };
+
+struct ExtVectorTypeSnapshot : public VectorTypeSnapshot {
+};
 static_assert(sizeof(Type) == sizeof(ExtVectorType));
 
 class FunctionType : public Type {
@@ -1041,6 +1545,7 @@ class FunctionType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(FunctionType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {20, 22};
   PASTA_DECLARE_BASE_OPERATORS(Type, FunctionType)
   PASTA_DECLARE_DERIVED_OPERATORS(FunctionType, FunctionNoProtoType)
   PASTA_DECLARE_DERIVED_OPERATORS(FunctionType, FunctionProtoType)
@@ -1055,9 +1560,21 @@ class FunctionType : public Type {
   bool IsConst(void) const;
   bool IsRestrict(void) const;
   bool IsVolatile(void) const;
+  ::pasta::FunctionTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(FunctionType)
 };
+
+struct FunctionTypeSnapshot : public TypeSnapshot {
+  enum CallingConv call_conv;
+  bool cmse_ns_call_attribute;
+  bool has_reg_parm;
+  bool no_return_attribute;
+  uint32_t reg_parm_type;
+  bool is_const;
+  bool is_restrict;
+  bool is_volatile;
+};
 static_assert(sizeof(Type) == sizeof(FunctionType));
 
 class IncompleteArrayType : public ArrayType {
@@ -1066,13 +1583,19 @@ class IncompleteArrayType : public ArrayType {
   using ArrayType::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(IncompleteArrayType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {4, 5};
   PASTA_DECLARE_BASE_OPERATORS(ArrayType, IncompleteArrayType)
   PASTA_DECLARE_BASE_OPERATORS(Type, IncompleteArrayType)
   ::pasta::Type Desugar(void) const;
   bool IsSugared(void) const;
+  ::pasta::IncompleteArrayTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(IncompleteArrayType)
 };
+
+struct IncompleteArrayTypeSnapshot : public ArrayTypeSnapshot {
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(IncompleteArrayType));
 
 class InjectedClassNameType : public Type {
@@ -1080,6 +1603,7 @@ class InjectedClassNameType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(InjectedClassNameType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {22, 23};
   PASTA_DECLARE_BASE_OPERATORS(Type, InjectedClassNameType)
   ::pasta::Type Desugar(void) const;
   ::pasta::CXXRecordDecl Declaration(void) const;
@@ -1087,9 +1611,14 @@ class InjectedClassNameType : public Type {
   ::pasta::TemplateSpecializationType InjectedTST(void) const;
   // TemplateName: (clang::TemplateName)
   bool IsSugared(void) const;
+  ::pasta::InjectedClassNameTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(InjectedClassNameType)
 };
+
+struct InjectedClassNameTypeSnapshot : public TypeSnapshot {
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(InjectedClassNameType));
 
 class MacroQualifiedType : public Type {
@@ -1097,15 +1626,21 @@ class MacroQualifiedType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(MacroQualifiedType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {23, 24};
   PASTA_DECLARE_BASE_OPERATORS(Type, MacroQualifiedType)
   ::pasta::Type Desugar(void) const;
   // MacroIdentifier: (const clang::IdentifierInfo *)
   ::pasta::Type ModifiedType(void) const;
   ::pasta::Type UnderlyingType(void) const;
   bool IsSugared(void) const;
+  ::pasta::MacroQualifiedTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(MacroQualifiedType)
 };
+
+struct MacroQualifiedTypeSnapshot : public TypeSnapshot {
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(MacroQualifiedType));
 
 class MatrixType : public Type {
@@ -1113,15 +1648,21 @@ class MatrixType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(MatrixType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {24, 26};
   PASTA_DECLARE_BASE_OPERATORS(Type, MatrixType)
   PASTA_DECLARE_DERIVED_OPERATORS(MatrixType, ConstantMatrixType)
   PASTA_DECLARE_DERIVED_OPERATORS(MatrixType, DependentSizedMatrixType)
   ::pasta::Type Desugar(void) const;
   ::pasta::Type ElementType(void) const;
   bool IsSugared(void) const;
+  ::pasta::MatrixTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(MatrixType)
 };
+
+struct MatrixTypeSnapshot : public TypeSnapshot {
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(MatrixType));
 
 class MemberPointerType : public Type {
@@ -1129,6 +1670,7 @@ class MemberPointerType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(MemberPointerType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {26, 27};
   PASTA_DECLARE_BASE_OPERATORS(Type, MemberPointerType)
   ::pasta::Type Desugar(void) const;
   ::pasta::Type Class(void) const;
@@ -1137,9 +1679,16 @@ class MemberPointerType : public Type {
   bool IsMemberDataPointer(void) const;
   bool IsMemberFunctionPointer(void) const;
   bool IsSugared(void) const;
+  ::pasta::MemberPointerTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(MemberPointerType)
 };
+
+struct MemberPointerTypeSnapshot : public TypeSnapshot {
+  bool is_member_data_pointer;
+  bool is_member_function_pointer;
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(MemberPointerType));
 
 class ObjCObjectPointerType : public Type {
@@ -1147,6 +1696,7 @@ class ObjCObjectPointerType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCObjectPointerType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {27, 28};
   PASTA_DECLARE_BASE_OPERATORS(Type, ObjCObjectPointerType)
   ::pasta::Type Desugar(void) const;
   ::pasta::ObjCInterfaceDecl InterfaceDeclaration(void) const;
@@ -1169,12 +1719,24 @@ class ObjCObjectPointerType : public Type {
   bool IsSugared(void) const;
   bool IsUnspecialized(void) const;
   bool IsUnspecializedAsWritten(void) const;
-  std::vector<::pasta::ObjCProtocolDecl> Qualifiers(void) const;
+  ::pasta::LazyRange<::pasta::ObjCProtocolDecl> Qualifiers(void) const;
   ::pasta::ObjCObjectPointerType StripObjCKindOfTypeAndQualifiers(void) const;
   std::vector<::pasta::ObjCProtocolDecl> Protocols(void) const;
+  ::pasta::ObjCObjectPointerTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(ObjCObjectPointerType)
 };
+
+struct ObjCObjectPointerTypeSnapshot : public TypeSnapshot {
+  uint32_t num_protocols;
+  bool is_kind_of_type;
+  bool is_obj_c_id_or_class_type;
+  bool is_specialized;
+  bool is_specialized_as_written;
+  bool is_sugared;
+  bool is_unspecialized;
+  bool is_unspecialized_as_written;
+};
 static_assert(sizeof(Type) == sizeof(ObjCObjectPointerType));
 
 class ObjCObjectType : public Type {
@@ -1182,6 +1744,7 @@ class ObjCObjectType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCObjectType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {28, 30};
   PASTA_DECLARE_BASE_OPERATORS(Type, ObjCObjectType)
   PASTA_DECLARE_DERIVED_OPERATORS(ObjCObjectType, ObjCInterfaceType)
   ::pasta::Type Desugar(void) const;
@@ -1205,9 +1768,27 @@ class ObjCObjectType : public Type {
   bool IsUnspecialized(void) const;
   bool IsUnspecializedAsWritten(void) const;
   ::pasta::Type StripObjCKindOfTypeAndQualifiers(void) const;
+  ::pasta::ObjCObjectTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(ObjCObjectType)
 };
+
+struct ObjCObjectTypeSnapshot : public TypeSnapshot {
+  bool is_kind_of_type;
+  bool is_kind_of_type_as_written;
+  bool is_obj_c_class;
+  bool is_obj_c_id;
+  bool is_obj_c_qualified_class;
+  bool is_obj_c_qualified_id;
+  bool is_obj_c_unqualified_class;
+  bool is_obj_c_unqualified_id;
+  bool is_obj_c_unqualified_id_or_class;
+  bool is_specialized;
+  bool is_specialized_as_written;
+  bool is_sugared;
+  bool is_unspecialized;
+  bool is_unspecialized_as_written;
+};
 static_assert(sizeof(Type) == sizeof(ObjCObjectType));
 
 class ObjCTypeParamType : public Type {
@@ -1215,13 +1796,19 @@ class ObjCTypeParamType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCTypeParamType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {30, 31};
   PASTA_DECLARE_BASE_OPERATORS(Type, ObjCTypeParamType)
   ::pasta::Type Desugar(void) const;
   ::pasta::ObjCTypeParamDecl Declaration(void) const;
   bool IsSugared(void) const;
+  ::pasta::ObjCTypeParamTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(ObjCTypeParamType)
 };
+
+struct ObjCTypeParamTypeSnapshot : public TypeSnapshot {
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(ObjCTypeParamType));
 
 class PackExpansionType : public Type {
@@ -1229,14 +1816,20 @@ class PackExpansionType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(PackExpansionType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {31, 32};
   PASTA_DECLARE_BASE_OPERATORS(Type, PackExpansionType)
   ::pasta::Type Desugar(void) const;
   std::optional<unsigned> NumExpansions(void) const;
   ::pasta::Type Pattern(void) const;
   bool IsSugared(void) const;
+  ::pasta::PackExpansionTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(PackExpansionType)
 };
+
+struct PackExpansionTypeSnapshot : public TypeSnapshot {
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(PackExpansionType));
 
 class ParenType : public Type {
@@ -1244,13 +1837,19 @@ class ParenType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ParenType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {32, 33};
   PASTA_DECLARE_BASE_OPERATORS(Type, ParenType)
   ::pasta::Type Desugar(void) const;
   ::pasta::Type InnerType(void) const;
   bool IsSugared(void) const;
+  ::pasta::ParenTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(ParenType)
 };
+
+struct ParenTypeSnapshot : public TypeSnapshot {
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(ParenType));
 
 class PipeType : public Type {
@@ -1258,14 +1857,21 @@ class PipeType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(PipeType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {33, 34};
   PASTA_DECLARE_BASE_OPERATORS(Type, PipeType)
   ::pasta::Type Desugar(void) const;
   ::pasta::Type ElementType(void) const;
   bool IsReadOnly(void) const;
   bool IsSugared(void) const;
+  ::pasta::PipeTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(PipeType)
 };
+
+struct PipeTypeSnapshot : public TypeSnapshot {
+  bool is_read_only;
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(PipeType));
 
 class PointerType : public Type {
@@ -1273,13 +1879,19 @@ class PointerType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(PointerType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {34, 35};
   PASTA_DECLARE_BASE_OPERATORS(Type, PointerType)
   ::pasta::Type Desugar(void) const;
   ::pasta::Type PointeeType(void) const;
   bool IsSugared(void) const;
+  ::pasta::PointerTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(PointerType)
 };
+
+struct PointerTypeSnapshot : public TypeSnapshot {
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(PointerType));
 
 class QualifiedType : public Type {
@@ -1287,6 +1899,7 @@ class QualifiedType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(QualifiedType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {35, 36};
   PASTA_DECLARE_BASE_OPERATORS(Type, QualifiedType)
   ::pasta::Type IgnoreParentheses(void) const;
   enum LangAS AddressSpace(void) const;
@@ -1363,9 +1976,52 @@ class QualifiedType : public Type {
   ::pasta::Type WithRestrict(void) const;
   ::pasta::Type WithVolatile(void) const;
   ::pasta::Type WithoutLocalFastQualifiers(void) const;
+  ::pasta::QualifiedTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(QualifiedType)
 };
+
+struct QualifiedTypeSnapshot : public TypeSnapshot {
+  enum LangAS address_space;
+  uint32_t cvr_qualifiers;
+  uint32_t local_cvr_qualifiers;
+  uint32_t local_fast_qualifiers;
+  bool has_address_space;
+  bool has_local_non_fast_qualifiers;
+  bool has_local_qualifiers;
+  bool has_non_trivial_obj_c_lifetime;
+  bool has_non_trivial_to_primitive_copy_c_union;
+  bool has_non_trivial_to_primitive_default_initialize_c_union;
+  bool has_non_trivial_to_primitive_destruct_c_union;
+  bool has_qualifiers;
+  bool has_strong_or_weak_obj_c_lifetime;
+  bool is_c_forbidden_l_value_type;
+  bool is_cxx11_pod_type;
+  bool is_cxx98_pod_type;
+  bool is_canonical;
+  bool is_canonical_as_parameter;
+  bool is_const_qualified;
+  bool is_constant;
+  bool is_local_const_qualified;
+  bool is_local_restrict_qualified;
+  bool is_local_volatile_qualified;
+  bool is_non_weak_in_mrr_with_obj_c_weak;
+  bool is_null;
+  bool is_obj_cgc_strong;
+  bool is_obj_cgc_weak;
+  bool is_pod_type;
+  bool is_referenceable;
+  bool is_restrict_qualified;
+  bool is_trivial_type;
+  bool is_trivially_copyable_type;
+  bool is_trivially_equality_comparable_type;
+  bool is_trivially_relocatable_type;
+  bool is_volatile_qualified;
+  bool is_web_assembly_funcref_type;
+  bool is_web_assembly_reference_type;
+  bool may_be_dynamic_class;
+  bool may_be_not_dynamic_class;
+};
 static_assert(sizeof(Type) == sizeof(QualifiedType));
 
 class ReferenceType : public Type {
@@ -1373,6 +2029,7 @@ class ReferenceType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ReferenceType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {36, 38};
   PASTA_DECLARE_BASE_OPERATORS(Type, ReferenceType)
   PASTA_DECLARE_DERIVED_OPERATORS(ReferenceType, LValueReferenceType)
   PASTA_DECLARE_DERIVED_OPERATORS(ReferenceType, RValueReferenceType)
@@ -1380,9 +2037,15 @@ class ReferenceType : public Type {
   ::pasta::Type PointeeTypeAsWritten(void) const;
   bool IsInnerReference(void) const;
   bool IsSpelledAsLValue(void) const;
+  ::pasta::ReferenceTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(ReferenceType)
 };
+
+struct ReferenceTypeSnapshot : public TypeSnapshot {
+  bool is_inner_reference;
+  bool is_spelled_as_l_value;
+};
 static_assert(sizeof(Type) == sizeof(ReferenceType));
 
 class SubstTemplateTypeParmPackType : public Type {
@@ -1390,6 +2053,7 @@ class SubstTemplateTypeParmPackType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(SubstTemplateTypeParmPackType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {38, 39};
   PASTA_DECLARE_BASE_OPERATORS(Type, SubstTemplateTypeParmPackType)
   ::pasta::Type Desugar(void) const;
   // ArgumentPack: (clang::TemplateArgument)
@@ -1400,9 +2064,17 @@ class SubstTemplateTypeParmPackType : public Type {
   uint32_t NumArguments(void) const;
   ::pasta::TemplateTypeParmDecl ReplacedParameter(void) const;
   bool IsSugared(void) const;
+  ::pasta::SubstTemplateTypeParmPackTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(SubstTemplateTypeParmPackType)
 };
+
+struct SubstTemplateTypeParmPackTypeSnapshot : public TypeSnapshot {
+  bool final;
+  uint32_t index;
+  uint32_t num_arguments;
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(SubstTemplateTypeParmPackType));
 
 class SubstTemplateTypeParmType : public Type {
@@ -1410,6 +2082,7 @@ class SubstTemplateTypeParmType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(SubstTemplateTypeParmType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {39, 40};
   PASTA_DECLARE_BASE_OPERATORS(Type, SubstTemplateTypeParmType)
   ::pasta::Type Desugar(void) const;
   ::pasta::Decl AssociatedDeclaration(void) const;
@@ -1418,9 +2091,15 @@ class SubstTemplateTypeParmType : public Type {
   ::pasta::TemplateTypeParmDecl ReplacedParameter(void) const;
   ::pasta::Type ReplacementType(void) const;
   bool IsSugared(void) const;
+  ::pasta::SubstTemplateTypeParmTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(SubstTemplateTypeParmType)
 };
+
+struct SubstTemplateTypeParmTypeSnapshot : public TypeSnapshot {
+  uint32_t index;
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(SubstTemplateTypeParmType));
 
 class TagType : public Type {
@@ -1428,14 +2107,20 @@ class TagType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(TagType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {40, 42};
   PASTA_DECLARE_BASE_OPERATORS(Type, TagType)
   PASTA_DECLARE_DERIVED_OPERATORS(TagType, EnumType)
   PASTA_DECLARE_DERIVED_OPERATORS(TagType, RecordType)
   ::pasta::TagDecl Declaration(void) const;
   bool IsBeingDefined(void) const;
+  ::pasta::TagTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(TagType)
 };
+
+struct TagTypeSnapshot : public TypeSnapshot {
+  bool is_being_defined;
+};
 static_assert(sizeof(Type) == sizeof(TagType));
 
 class TemplateSpecializationType : public Type {
@@ -1443,6 +2128,7 @@ class TemplateSpecializationType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(TemplateSpecializationType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {42, 43};
   PASTA_DECLARE_BASE_OPERATORS(Type, TemplateSpecializationType)
   ::pasta::Type Desugar(void) const;
   std::optional<::pasta::Type> AliasedType(void) const;
@@ -1451,9 +2137,16 @@ class TemplateSpecializationType : public Type {
   bool IsSugared(void) const;
   bool IsTypeAlias(void) const;
   std::vector<::pasta::TemplateArgument> TemplateArguments(void) const;
+  ::pasta::TemplateSpecializationTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(TemplateSpecializationType)
 };
+
+struct TemplateSpecializationTypeSnapshot : public TypeSnapshot {
+  bool is_current_instantiation;
+  bool is_sugared;
+  bool is_type_alias;
+};
 static_assert(sizeof(Type) == sizeof(TemplateSpecializationType));
 
 class TemplateTypeParmType : public Type {
@@ -1461,6 +2154,7 @@ class TemplateTypeParmType : public Type {
   using Type::Type;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(TemplateTypeParmType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {43, 44};
   PASTA_DECLARE_BASE_OPERATORS(Type, TemplateTypeParmType)
   ::pasta::Type Desugar(void) const;
   std::optional<::pasta::TemplateTypeParmDecl> Declaration(void) const;
@@ -1469,9 +2163,17 @@ class TemplateTypeParmType : public Type {
   uint32_t Index(void) const;
   bool IsParameterPack(void) const;
   bool IsSugared(void) const;
+  ::pasta::TemplateTypeParmTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(TemplateTypeParmType)
 };
+
+struct TemplateTypeParmTypeSnapshot : public TypeSnapshot {
+  uint32_t depth;
+  uint32_t index;
+  bool is_parameter_pack;
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(TemplateTypeParmType));
 
 class VariableArrayType : public ArrayType {
@@ -1480,6 +2182,7 @@ class VariableArrayType : public ArrayType {
   using ArrayType::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(VariableArrayType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {5, 6};
   PASTA_DECLARE_BASE_OPERATORS(ArrayType, VariableArrayType)
   PASTA_DECLARE_BASE_OPERATORS(Type, VariableArrayType)
   ::pasta::Type Desugar(void) const;
@@ -1488,9 +2191,16 @@ class VariableArrayType : public ArrayType {
   ::pasta::Token RBracketToken(void) const;
   ::pasta::Expr SizeExpression(void) const;
   bool IsSugared(void) const;
+  ::pasta::VariableArrayTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(VariableArrayType)
 };
+
+struct VariableArrayTypeSnapshot : public ArrayTypeSnapshot {
+  uint32_t l_bracket_token;
+  uint32_t r_bracket_token;
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(VariableArrayType));
 
 class AutoType : public DeducedType {
@@ -1499,6 +2209,7 @@ class AutoType : public DeducedType {
   using DeducedType::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(AutoType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {14, 15};
   PASTA_DECLARE_BASE_OPERATORS(DeducedType, AutoType)
   PASTA_DECLARE_BASE_OPERATORS(Type, AutoType)
   enum AutoTypeKeyword Keyword(void) const;
@@ -1507,9 +2218,17 @@ class AutoType : public DeducedType {
   bool IsConstrained(void) const;
   bool IsDecltypeAuto(void) const;
   bool IsGNUAutoType(void) const;
+  ::pasta::AutoTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(AutoType)
 };
+
+struct AutoTypeSnapshot : public DeducedTypeSnapshot {
+  enum AutoTypeKeyword keyword;
+  bool is_constrained;
+  bool is_decltype_auto;
+  bool is_gnu_auto_type;
+};
 static_assert(sizeof(Type) == sizeof(AutoType));
 
 class ConstantMatrixType : public MatrixType {
@@ -1518,14 +2237,22 @@ class ConstantMatrixType : public MatrixType {
   using MatrixType::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ConstantMatrixType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {24, 25};
   PASTA_DECLARE_BASE_OPERATORS(MatrixType, ConstantMatrixType)
   PASTA_DECLARE_BASE_OPERATORS(Type, ConstantMatrixType)
   uint32_t NumColumns(void) const;
   uint32_t NumElementsFlattened(void) const;
   uint32_t NumRows(void) const;
+  ::pasta::ConstantMatrixTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(ConstantMatrixType)
 };
+
+struct ConstantMatrixTypeSnapshot : public MatrixTypeSnapshot {
+  uint32_t num_columns;
+  uint32_t num_elements_flattened;
+  uint32_t num_rows;
+};
 static_assert(sizeof(Type) == sizeof(ConstantMatrixType));
 
 class DeducedTemplateSpecializationType : public DeducedType {
@@ -1534,12 +2261,17 @@ class DeducedTemplateSpecializationType : public DeducedType {
   using DeducedType::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(DeducedTemplateSpecializationType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {15, 16};
   PASTA_DECLARE_BASE_OPERATORS(DeducedType, DeducedTemplateSpecializationType)
   PASTA_DECLARE_BASE_OPERATORS(Type, DeducedTemplateSpecializationType)
   // TemplateName: (clang::TemplateName)
+  ::pasta::DeducedTemplateSpecializationTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(DeducedTemplateSpecializationType)
 };
+
+struct DeducedTemplateSpecializationTypeSnapshot : public DeducedTypeSnapshot {
+};
 static_assert(sizeof(Type) == sizeof(DeducedTemplateSpecializationType));
 
 class DependentSizedMatrixType : public MatrixType {
@@ -1548,14 +2280,20 @@ class DependentSizedMatrixType : public MatrixType {
   using MatrixType::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(DependentSizedMatrixType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {25, 26};
   PASTA_DECLARE_BASE_OPERATORS(MatrixType, DependentSizedMatrixType)
   PASTA_DECLARE_BASE_OPERATORS(Type, DependentSizedMatrixType)
   ::pasta::Token AttributeToken(void) const;
   ::pasta::Expr ColumnExpression(void) const;
   ::pasta::Expr RowExpression(void) const;
+  ::pasta::DependentSizedMatrixTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(DependentSizedMatrixType)
 };
+
+struct DependentSizedMatrixTypeSnapshot : public MatrixTypeSnapshot {
+  uint32_t attribute_token;
+};
 static_assert(sizeof(Type) == sizeof(DependentSizedMatrixType));
 
 class EnumType : public TagType {
@@ -1564,14 +2302,20 @@ class EnumType : public TagType {
   using TagType::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(EnumType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {40, 41};
   PASTA_DECLARE_BASE_OPERATORS(TagType, EnumType)
   PASTA_DECLARE_BASE_OPERATORS(Type, EnumType)
   ::pasta::Type Desugar(void) const;
   ::pasta::EnumDecl Declaration(void) const;
   bool IsSugared(void) const;
+  ::pasta::EnumTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(EnumType)
 };
+
+struct EnumTypeSnapshot : public TagTypeSnapshot {
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(EnumType));
 
 class FunctionNoProtoType : public FunctionType {
@@ -1580,13 +2324,19 @@ class FunctionNoProtoType : public FunctionType {
   using FunctionType::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(FunctionNoProtoType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {20, 21};
   PASTA_DECLARE_BASE_OPERATORS(FunctionType, FunctionNoProtoType)
   PASTA_DECLARE_BASE_OPERATORS(Type, FunctionNoProtoType)
   ::pasta::Type Desugar(void) const;
   bool IsSugared(void) const;
+  ::pasta::FunctionNoProtoTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(FunctionNoProtoType)
 };
+
+struct FunctionNoProtoTypeSnapshot : public FunctionTypeSnapshot {
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(FunctionNoProtoType));
 
 class FunctionProtoType : public FunctionType {
@@ -1596,6 +2346,7 @@ class FunctionProtoType : public FunctionType {
   using FunctionType::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(FunctionProtoType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {21, 22};
   PASTA_DECLARE_BASE_OPERATORS(FunctionType, FunctionProtoType)
   PASTA_DECLARE_BASE_OPERATORS(Type, FunctionProtoType)
   std::optional<enum CanThrowResult> CanThrow(void) const;
@@ -1632,9 +2383,28 @@ class FunctionProtoType : public FunctionType {
   bool IsTemplateVariadic(void) const;
   bool IsVariadic(void) const;
   std::vector<::pasta::Type> ExceptionTypes(void) const;
+  ::pasta::FunctionProtoTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(FunctionProtoType)
 };
+
+struct FunctionProtoTypeSnapshot : public FunctionTypeSnapshot {
+  uint32_t ellipsis_token;
+  enum ExceptionSpecificationType exception_spec_type;
+  uint32_t num_exceptions;
+  uint32_t num_parameters;
+  enum RefQualifierKind reference_qualifier;
+  bool has_dependent_exception_spec;
+  bool has_dynamic_exception_spec;
+  bool has_exception_spec;
+  bool has_ext_parameter_infos;
+  bool has_instantiation_dependent_exception_spec;
+  bool has_noexcept_exception_spec;
+  bool has_trailing_return;
+  bool is_sugared;
+  bool is_template_variadic;
+  bool is_variadic;
+};
 static_assert(sizeof(Type) == sizeof(FunctionProtoType));
 
 class LValueReferenceType : public ReferenceType {
@@ -1643,13 +2413,19 @@ class LValueReferenceType : public ReferenceType {
   using ReferenceType::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(LValueReferenceType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {36, 37};
   PASTA_DECLARE_BASE_OPERATORS(ReferenceType, LValueReferenceType)
   PASTA_DECLARE_BASE_OPERATORS(Type, LValueReferenceType)
   ::pasta::Type Desugar(void) const;
   bool IsSugared(void) const;
+  ::pasta::LValueReferenceTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(LValueReferenceType)
 };
+
+struct LValueReferenceTypeSnapshot : public ReferenceTypeSnapshot {
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(LValueReferenceType));
 
 class ObjCInterfaceType : public ObjCObjectType {
@@ -1658,14 +2434,19 @@ class ObjCInterfaceType : public ObjCObjectType {
   using ObjCObjectType::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(ObjCInterfaceType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {29, 30};
   PASTA_DECLARE_BASE_OPERATORS(ObjCObjectType, ObjCInterfaceType)
   PASTA_DECLARE_BASE_OPERATORS(Type, ObjCInterfaceType)
   ::pasta::Type Desugar(void) const;
   ::pasta::ObjCInterfaceDecl Declaration(void) const;
   bool IsSugared(void) const;
+  ::pasta::ObjCInterfaceTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(ObjCInterfaceType)
 };
+
+struct ObjCInterfaceTypeSnapshot : public ObjCObjectTypeSnapshot {
+};
 static_assert(sizeof(Type) == sizeof(ObjCInterfaceType));
 
 class RValueReferenceType : public ReferenceType {
@@ -1674,13 +2455,19 @@ class RValueReferenceType : public ReferenceType {
   using ReferenceType::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(RValueReferenceType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {37, 38};
   PASTA_DECLARE_BASE_OPERATORS(ReferenceType, RValueReferenceType)
   PASTA_DECLARE_BASE_OPERATORS(Type, RValueReferenceType)
   ::pasta::Type Desugar(void) const;
   bool IsSugared(void) const;
+  ::pasta::RValueReferenceTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(RValueReferenceType)
 };
+
+struct RValueReferenceTypeSnapshot : public ReferenceTypeSnapshot {
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(RValueReferenceType));
 
 class RecordType : public TagType {
@@ -1689,15 +2476,22 @@ class RecordType : public TagType {
   using TagType::From;
  public:
   PASTA_DECLARE_DEFAULT_CONSTRUCTORS(RecordType)
+  static constexpr ::pasta::detail::KindRange kKindRange = {41, 42};
   PASTA_DECLARE_BASE_OPERATORS(TagType, RecordType)
   PASTA_DECLARE_BASE_OPERATORS(Type, RecordType)
   ::pasta::Type Desugar(void) const;
   ::pasta::RecordDecl Declaration(void) const;
   bool HasConstFields(void) const;
   bool IsSugared(void) const;
+  ::pasta::RecordTypeSnapshot Snapshot(void) const;
  protected:
   PASTA_DEFINE_DEFAULT_TYPE_CONSTRUCTOR(RecordType)
 };
+
+struct RecordTypeSnapshot : public TagTypeSnapshot {
+  bool has_const_fields;
+  bool is_sugared;
+};
 static_assert(sizeof(Type) == sizeof(RecordType));
 
 }  // namespace pasta
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#pragma once
+
+#include "Borrowed.h"
+
+namespace pasta {
+
+class AST;
+
+// Walks over the declarations and statements of an AST in depth-first order,
+// invoking `PreVisit` on each entity before its children are walked, and
+// `PostVisit` after. The walk iterates the underlying Clang nodes directly, and
+// hands out borrowed entities, and so it doesn't allocate or touch any
+// reference counts on a per-entity basis. The kind of each visited entity is
+// available via `Kind()` on the borrowed entity.
+//
+// The walked children of a declaration are the declarations in its declaration
+// context, the template parameters and templated declaration of a template,
+// and the parameters, initializers, bindings, and bodies of functions,
+// variables, fields, and enumerators. The walked children of a statement are
+// those of `Stmt::Children()`, except that the declarations of a `DeclStmt`
+// are walked instead of their initializers, and that the block declaration of
+// a `BlockExpr`, the captured declaration of a `CapturedStmt`, and the class
+// of a `LambdaExpr` are walked. Block, captured, and lambda class declarations
+// are only walked via their expressions and statements. Types aren't walked
+// as entities, but the expressions and declarations that are only reachable
+// through written types, e.g. the size of an array type, are walked as
+// children of the entity that wrote the type. Attributes aren't walked.
+class Walker {
+ public:
+  virtual ~Walker(void);
+
+  // Invoked before the children of `decl` are walked. Returning `false` skips
+  // the children of `decl`, as well as the `PostVisit` of `decl`.
+  virtual bool PreVisit(BorrowedDecl decl);
+
+  // Invoked after the children of `decl` are walked.
+  virtual void PostVisit(BorrowedDecl decl);
+
+  // Invoked before the children of `stmt` are walked. Returning `false` skips
+  // the children of `stmt`, as well as the `PostVisit` of `stmt`.
+  virtual bool PreVisit(BorrowedStmt stmt);
+
+  // Invoked after the children of `stmt` are walked.
+  virtual void PostVisit(BorrowedStmt stmt);
+
+  // Walk the whole AST, starting at its translation unit.
+  void Walk(const AST &ast);
+
+  // Walk everything reachable from `decl`, including `decl` itself.
+  void Walk(BorrowedDecl decl);
+
+  // Walk everything reachable from `stmt`, including `stmt` itself.
+  void Walk(BorrowedStmt stmt);
+
+  // Walk the whole AST, starting at its translation unit, and walking the
+  // top-level declarations concurrently across `num_threads` worker threads.
+  // If `num_threads` is zero, then one thread per hardware thread is used.
+  //
+  // NOTE(pag): The visitors of the translation unit are invoked on the calling
+  //            thread, but all other visitors may be invoked concurrently, and
+  //            so they must be safe to call from multiple threads. Visits
+  //            within one top-level declaration happen on a single thread, and
+  //            are ordered as in `Walk`.
+  void WalkInParallel(const AST &ast, unsigned num_threads = 0u);
+};
+
+}  // namespace pasta
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+#include <pasta/AST/TokenSnapshot.h>
+#include <pasta/Util/Result.h>
+#include <pasta/Util/StdFileSystem.h>
+
+#include "Job.h"
+
+namespace pasta {
+
+class AST;
+class Compiler;
+
+// An opt-in, persistent cache of the results of compile jobs, stored as token
+// snapshots in a directory. Entries are keyed by the job's arguments (minus
+// options that only name outputs), the description of the compiler, the
+// version of Clang, and the macro tracking mode. Each entry stores its full
+// key, the content hash of every file that was parsed, and every path that the
+// job looked up but that didn't exist, e.g. the paths of an included file in
+// the include directories that come before the one where it was found. A
+// lookup only hits if the keys match, if all of those files still hash to the
+// same values, and if none of those missing paths have since been created, as
+// a new header could shadow a cached one.
+//
+// A cache hit only provides the tokens, macros, and file tokens of the
+// translation unit. If the full AST is needed, then use `CompileJob::Run`.
+//
+// Only successful jobs are cached, and misses aren't recorded. Running a job
+// that fails always recompiles it, and a lookup that misses because one of
+// the parsed files changed re-reads and re-hashes the files that come before
+// it, until the entry is replaced by `Store` or `Run`.
+class CompileCache {
+ public:
+  explicit CompileCache(std::filesystem::path directory_);
+
+  // Return the directory in which cache entries are stored.
+  inline const std::filesystem::path &Directory(void) const noexcept {
+    return directory;
+  }
+
+  // Return the path of the cache entry for `job`. The entry may not exist.
+  std::filesystem::path EntryPath(
+      const Compiler &compiler, const CompileJob &job,
+      MacroTracking macro_tracking=MacroTracking::kEnabled) const;
+
+  // Return the cached token snapshot for `job`, if there is one, if none of
+  // the files that it parsed have since changed, and if none of the paths that
+  // it looked up and didn't find have since been created.
+  std::optional<TokenSnapshot> Lookup(
+      const Compiler &compiler, const CompileJob &job,
+      MacroTracking macro_tracking=MacroTracking::kEnabled) const;
+
+  // Store the token snapshot of `ast`, which was produced by running `job`
+  // with `macro_tracking`.
+  std::error_code Store(
+      const Compiler &compiler, const CompileJob &job, const AST &ast,
+      MacroTracking macro_tracking=MacroTracking::kEnabled) const;
+
+  // Return the cached token snapshot for `job`, or run `job` and then cache
+  // and return its token snapshot. Failing to store the entry is not an error.
+  Result<TokenSnapshot, std::string> Run(
+      const Compiler &compiler, const CompileJob &job,
+      MacroTracking macro_tracking=MacroTracking::kEnabled) const;
+
+ private:
+  CompileCache(void) = delete;
+
+  // Atomically write the token snapshot `data`, and the serialized missing
+  // paths `missing_paths` of the job, into the cache entry for the cache key
+  // `key`.
+  std::error_code Write(std::string_view key, std::string_view missing_paths,
+                        std::string_view data) const;
+
+  std::filesystem::path directory;
+};
+
+}  // namespace pasta
@@ -14,9 +14,26 @@
 namespace pasta {
 
 class AST;
+class ASTImpl;
 class ArgumentVector;
 class CompileCommand;
 class CompileJobImpl;
+class PreprocessedTranslationUnit;
+
+// Whether or not to track macro expansions, directives, and the derivations of
+// macro expansion tokens when running a compile job.
+enum class MacroTracking : unsigned {
+  // Build the macro trees, and derive each macro expansion token from the
+  // tokens of the macro uses, definitions, and arguments that produced it.
+  kEnabled,
+
+  // Don't build the macro trees, nor track token derivations. The parsed
+  // tokens and their file locations are still available, but `AST::Macros`
+  // is empty, macro expansion tokens have no macro locations or derivations,
+  // and their file locations are their spellings. Macros used within pragmas
+  // are not expanded.
+  kDisabled,
+};
 
 // A single backend compilation job. There is a one to many relationship
 // between `CompileCommand`s and `CompilerJob`s, as a single compile command
@@ -57,7 +74,13 @@ class CompileJob {
   std::string_view AuxiliaryTargetTriple(void) const;
 
   // Run a backend compilation job and returns the AST or the first error.
-  Result<AST, std::string> Run(void) const;
+  Result<AST, std::string> Run(
+      MacroTracking macro_tracking=MacroTracking::kEnabled) const;
+
+  // Run only the preprocessor of a backend compilation job, and return the
+  // tokens and macros, or the first error. This skips building the AST, and
+  // so is significantly cheaper than `Run` for macro-only analyses.
+  Result<PreprocessedTranslationUnit, std::string> Preprocess(void) const;
 
  private:
   friend class Compiler;
@@ -66,6 +89,9 @@ class CompileJob {
 
   CompileJob(std::shared_ptr<CompileJobImpl> impl_);
 
+  Result<std::shared_ptr<ASTImpl>, std::string>
+  RunImpl(bool preprocess_only, bool track_macros) const;
+
   std::shared_ptr<CompileJobImpl> impl;
 };
 
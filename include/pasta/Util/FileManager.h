@@ -38,7 +38,15 @@ class FileManager {
   // Return the file system associated with this file manager.
   std::shared_ptr<::pasta::FileSystem> FileSystem(void) const;
 
+  // Share canonical macro definitions (see `MacroDefinition`) across all ASTs
+  // made after this call whose files are managed by this file manager. This is
+  // disabled by default because each AST also keeps its own tokens for its
+  // definitions, so the shared definitions add to memory use rather than
+  // replacing anything.
+  void EnableMacroDefinitionSharing(void) const;
+
  private:
+  friend class ASTImpl;
   friend class Compiler;
   friend class File;
   friend class FileImpl;
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace pasta {
+
+class ASTImpl;
+class DefineMacroDirective;
+class FileManager;
+class FileManagerImpl;
+struct MacroDefinitionImpl;
+
+// A canonical, content-keyed macro definition. Macro definitions are
+// deduplicated across all ASTs whose files are managed by the same
+// `FileManager`, so two `#define`s, possibly from different translation units,
+// with the same name, parameters, and body spelling will share the same
+// `MacroDefinition`. Sharing is opt-in, via
+// `FileManager::EnableMacroDefinitionSharing`. A definition stays alive for as
+// long as some AST or `MacroDefinition` references it, and the file manager's
+// store doesn't keep it alive on its own.
+class MacroDefinition {
+ private:
+  friend class DefineMacroDirective;
+
+  MacroDefinition(void) = delete;
+
+  std::shared_ptr<const MacroDefinitionImpl> impl;
+
+  inline MacroDefinition(std::shared_ptr<const MacroDefinitionImpl> impl_)
+      : impl(std::move(impl_)) {}
+
+ public:
+  ~MacroDefinition(void);
+
+  MacroDefinition(const MacroDefinition &) = default;
+  MacroDefinition(MacroDefinition &&) noexcept = default;
+  MacroDefinition &operator=(const MacroDefinition &) = default;
+  MacroDefinition &operator=(MacroDefinition &&) noexcept = default;
+
+  inline const void *RawMacroDefinition(void) const noexcept {
+    return impl.get();
+  }
+
+  // Name of the defined macro.
+  std::string_view Name(void) const noexcept;
+
+  // Names of the parameters. The variadic parameter of a C99-style variadic
+  // macro is named `...`.
+  std::vector<std::string_view> ParameterNames(void) const;
+
+  // Spelling of the body of this macro, with tokens separated by single
+  // spaces wherever they had leading whitespace.
+  std::string_view Body(void) const noexcept;
+
+  // Spelling of the whole definition, as it would follow `#define `, e.g.
+  // `FOO(a, b) a + b`.
+  std::string_view Data(void) const noexcept;
+
+  // Number of explicit, i.e. not variadic, parameters.
+  unsigned NumExplicitParameters(void) const noexcept;
+
+  // Does this definition accept a variable number of arguments?
+  bool IsVariadic(void) const noexcept;
+
+  // Is this a function-like macro?
+  bool IsFunctionLike(void) const noexcept;
+
+  // Hash of `Data()`.
+  uint64_t Hash(void) const noexcept;
+
+  inline bool operator==(const MacroDefinition &that) const noexcept {
+    return impl == that.impl;
+  }
+
+  inline bool operator!=(const MacroDefinition &that) const noexcept {
+    return impl != that.impl;
+  }
+};
+
+}  // namespace pasta
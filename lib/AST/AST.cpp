@@ -6,11 +6,13 @@
 
 #include <pasta/AST/Decl.h>
 
+#include <algorithm>
 #include <cassert>
 #include <limits>
 #include <new>
 
 #include "Builder.h"
+#include "Printer/PrintCache.h"
 #include "Token.h"
 
 #pragma clang diagnostic push
@@ -162,23 +164,67 @@ TokenImpl *ASTImpl::RawTokenAt(clang::SourceLocation loc) {
     return nullptr;
   }
 
-  bool invalid = false;
-  auto &sm = ci->getSourceManager();
+  // NOTE(pag): The source manager lazily computes and caches line number
+  //            tables, and so `getSpellingLineNumber` isn't thread-safe. We
+  //            instead compute our own line table for `preprocessed_code`,
+  //            following the same line ending rules as Clang.
+  std::call_once(line_offsets_init, [this] (void) {
+    auto &sm = ci->getSourceManager();
+    main_file_start =
+        sm.getLocForStartOfFile(sm.getMainFileID()).getRawEncoding();
+
+    line_offsets.reserve(tokens.size() + 1u);
+    line_offsets.push_back(0u);
+    for (size_t i = 0u, max_i = preprocessed_code.size(); i < max_i; ++i) {
+      const char ch = preprocessed_code[i];
+      if (ch == '\r' && (i + 1u) < max_i && preprocessed_code[i + 1u] == '\n') {
+        continue;  // `\r\n` is a single line ending.
+      }
+      if (ch == '\n' || ch == '\r') {
+        line_offsets.push_back(static_cast<uint32_t>(i + 1u));
+      }
+    }
+  });
 
-#ifndef NDEBUG
-  const auto [file_id, file_offset] = sm.getDecomposedLoc(loc);
-  assert(file_id == sm.getMainFileID());
-  assert(file_offset < preprocessed_code.size());
-#endif
+  const auto raw_loc = loc.getRawEncoding();
+  if (raw_loc < main_file_start) {
+    return nullptr;
+  }
+
+  const auto file_offset = raw_loc - main_file_start;
+  if (file_offset >= preprocessed_code.size()) {
+    assert(false);
+    return nullptr;
+  }
 
-  const auto line = sm.getSpellingLineNumber(loc, &invalid);
-  if (!line || invalid || static_cast<size_t>(line) > tokens.size()) {
+  // Find the line containing `file_offset`. Line `N` (one-indexed) holds the
+  // data of token `N - 1`.
+  auto line_it = std::upper_bound(line_offsets.begin(), line_offsets.end(),
+                                  static_cast<uint32_t>(file_offset));
+  const auto line = static_cast<size_t>(line_it - line_offsets.begin());
+  if (!line || line > tokens.size()) {
     return nullptr;
   }
 
   return &(tokens[line - 1u]);
 }
 
+// Try to return the index of the token at the specified location.
+uint32_t ASTImpl::TokenIndexAt(clang::SourceLocation loc) {
+  if (auto tok = RawTokenAt(loc)) {
+    return static_cast<uint32_t>(tok - tokens.data());
+  }
+  return kInvalidTokenIndex;
+}
+
+// Return the index of `tok`, or `kInvalidTokenIndex`.
+uint32_t ASTImpl::TokenIndexAt(const TokenImpl *tok) {
+  if (tok) {
+    return static_cast<uint32_t>(tok - tokens.data());
+  }
+  return kInvalidTokenIndex;
+}
+
 // Try to return the token at the specified location.
 Token ASTImpl::TokenAt(clang::SourceLocation loc) {
   auto self = shared_from_this();
@@ -251,6 +297,78 @@ const std::vector<::pasta::File> &AST::ParsedFiles(void) const {
   return impl->parsed_files;
 }
 
+PreprocessedTranslationUnit::~PreprocessedTranslationUnit(void) {}
+
+PreprocessedTranslationUnit::PreprocessedTranslationUnit(
+    const PreprocessedTranslationUnit &that)
+    : impl(that.impl) {}
+
+PreprocessedTranslationUnit::PreprocessedTranslationUnit(
+    PreprocessedTranslationUnit &&that) noexcept
+    : impl(that.impl) {
+  that.impl = nullptr;
+}
+
+PreprocessedTranslationUnit &PreprocessedTranslationUnit::operator=(
+    const PreprocessedTranslationUnit &that) {
+  impl = that.impl;
+  return *this;
+}
+
+PreprocessedTranslationUnit &PreprocessedTranslationUnit::operator=(
+    PreprocessedTranslationUnit &&that) noexcept {
+  std::swap(impl, that.impl);
+  return *this;
+}
+
+PreprocessedTranslationUnit::PreprocessedTranslationUnit(
+    std::shared_ptr<ASTImpl> impl_)
+    : impl(std::move(impl_)) {}
+
+std::string_view PreprocessedTranslationUnit::PreprocessedCode(void) const {
+  return impl->preprocessed_code;
+}
+
+// Return all lexed tokens.
+TokenRange PreprocessedTranslationUnit::Tokens(void) const {
+  const auto first = impl->tokens.data();
+  return TokenRange(impl, first, &(first[impl->tokens.size()]));
+}
+
+// Return all top-level macro nodes (expansions, directives, substitutions,
+// etc.).
+MacroRange PreprocessedTranslationUnit::Macros(void) const {
+  const auto first = impl->root_macro_node.nodes.data();
+  return MacroRange(
+      impl, first, &(first[impl->root_macro_node.nodes.size()]));
+}
+
+clang::Preprocessor &PreprocessedTranslationUnit::UnderlyingPP(void) const {
+  return impl->ci->getPreprocessor();
+}
+
+// Return the main file which was preprocessed.
+File PreprocessedTranslationUnit::MainFile(void) const {
+  return impl->main_source_file;
+}
+
+// Return the list of all source files which were preprocessed.
+const std::vector<::pasta::File> &
+PreprocessedTranslationUnit::ParsedFiles(void) const {
+  return impl->parsed_files;
+}
+
+// Enable memoization of `PrintedTokenRange::Create`.
+void AST::EnablePrintCache(size_t max_bytes) const {
+  impl->print_cache = std::make_shared<PrintCache>(max_bytes);
+}
+
+// Disable memoization of `PrintedTokenRange::Create`, and free any cached
+// printed token ranges not otherwise referenced.
+void AST::DisablePrintCache(void) const {
+  impl->print_cache.reset();
+}
+
 #ifndef PASTA_IN_BOOTSTRAP
 Token AST::Adopt(const clang::SourceLocation &loc) const {
   return impl->TokenAt(loc);
@@ -16,11 +16,13 @@
 #include <clang/Basic/Builtins.h>
 #include <clang/Basic/FileManager.h>
 #include <clang/Lex/Token.h>
+#include <llvm/ADT/DenseMap.h>
 #pragma clang diagnostic pop
 
 #include <pasta/Util/FileManager.h>
 #include <pasta/Util/File.h>
 #include <pasta/Util/Result.h>
+#include <map>
 #include <string>
 #include <unordered_map>
 #include <variant>
@@ -47,6 +49,7 @@ class OverlayFileSystem;
 }  // namespace llvm
 namespace pasta {
 
+class PrintCache;
 class RootMacroNode;
 
 class ASTImpl : public std::enable_shared_from_this<ASTImpl> {
@@ -57,9 +60,18 @@ class ASTImpl : public std::enable_shared_from_this<ASTImpl> {
   // Try to return the file token at the specified location.
   std::optional<FileToken> FileTokenAt(clang::SourceLocation loc);
 
-  // Try to return the token at the specified location.
+  // Try to return the token at the specified location. This is safe to call
+  // concurrently from multiple threads.
   TokenImpl *RawTokenAt(clang::SourceLocation loc);
 
+  // Try to return the index of the token at the specified location, or
+  // `kInvalidTokenIndex`. This is safe to call concurrently from multiple
+  // threads.
+  uint32_t TokenIndexAt(clang::SourceLocation loc);
+
+  // Return the index of `tok`, or `kInvalidTokenIndex` if `tok` is `nullptr`.
+  uint32_t TokenIndexAt(const TokenImpl *tok);
+
   // Try to return the token at the specified location.
   Token TokenAt(clang::SourceLocation loc);
 
@@ -72,6 +84,11 @@ class ASTImpl : public std::enable_shared_from_this<ASTImpl> {
   // This is an `LLVMFileSystem`, from inside `lib/Compile/FileSystem.h`.
   llvm::IntrusiveRefCntPtr<llvm::vfs::FileSystem> real_fs;
 
+  // Paths that the compiler looked up while running the job, but that didn't
+  // exist, e.g. the paths of an included file in the include directories that
+  // come before the one where it was found. See `CompileCache::Lookup`.
+  std::vector<std::filesystem::path> missing_paths;
+
   // A plain old overlay file system.
   llvm::IntrusiveRefCntPtr<llvm::vfs::OverlayFileSystem> overlay_fs;
 
@@ -90,6 +107,11 @@ class ASTImpl : public std::enable_shared_from_this<ASTImpl> {
 
   std::mutex bounds_mutex;
 
+  // Source manager queries, e.g. `getFileID` or `getPresumedLoc`, mutate the
+  // source manager's lookup caches, and so they must be serialized when
+  // printing in parallel. See `PrintedTokenRangeImpl::LockSourceManager`.
+  std::mutex source_manager_mutex;
+
   using BoundingTokens = std::pair<TokenImpl *, TokenImpl *>;
 
   std::unordered_map<void *, std::pair<TokenImpl *, TokenImpl *>> bounds;
@@ -102,7 +124,8 @@ class ASTImpl : public std::enable_shared_from_this<ASTImpl> {
     std::vector<BoundingTokens *> params;
   };
 
-  // The location of a `...` for a given `FunctionDecl`.
+  // The location of a `...` for a given `FunctionDecl`. Guarded by
+  // `bounds_mutex`, as it's filled in by `DeclBounds`.
   std::unordered_map<clang::FunctionDecl *, FunctionProto> func_proto;
 
   // Remapped declarations (for the sake of bounds checks).
@@ -141,6 +164,22 @@ class ASTImpl : public std::enable_shared_from_this<ASTImpl> {
   // associated with the define macro directive.
   std::unordered_map<uint32_t, Node> tokens_to_macro_definitions;
 
+  // Per-token derivation tables, parallel to `tokens`. These are built by
+  // `BuildDerivationTables` once token provenance is final, so that mapping a
+  // token to its file location, or to the length of its derivation chain, does
+  // not need to chase `TokenImpl::derived_index` links.
+  //
+  // `derivation_roots[i]` is the index of the token at which `FileLocation`
+  // stops when following `derived_index` links from `tokens[i]`, i.e. the
+  // first token with a file (or invalid) location. `derivation_depths[i]` is
+  // the number of `derived_index` links that `DerivationChain` follows from
+  // `tokens[i]`.
+  //
+  // NOTE(pag): Tokens added after the tables are built aren't covered by them,
+  //            and so users must fall back on following the links.
+  std::vector<DerivedTokenIndex> derivation_roots;
+  std::vector<uint32_t> derivation_depths;
+
   // Number of lines in `preprocessed_code`, which should match up with
   // `tokens.size()`.
   //
@@ -157,6 +196,15 @@ class ASTImpl : public std::enable_shared_from_this<ASTImpl> {
   // TODO(pag): Better abstraction for these types of modifications.
   std::string preprocessed_code;
 
+  // Offsets of the beginnings of lines in `preprocessed_code`, and the raw
+  // encoding of the location of the beginning of the main file, i.e. of
+  // `preprocessed_code`. These let `RawTokenAt` map source locations to tokens
+  // without querying the source manager, which isn't safe to share across
+  // threads. Lazily initialized by `RawTokenAt`.
+  std::once_flag line_offsets_init;
+  std::vector<uint32_t> line_offsets;
+  clang::SourceLocation::UIntTy main_file_start{0u};
+
   // This is a backup store of data for token data, so that we don't need to
   // go back to the source manager to find the token data (as we need to find
   // it to fill up `preprocessed_code` anyway).
@@ -165,6 +213,55 @@ class ASTImpl : public std::enable_shared_from_this<ASTImpl> {
   // Useful for when we want to print tokens of decls and such.
   std::unique_ptr<clang::PrintingPolicy> printing_policy;
 
+  // Optional cache of printed token ranges. See `AST::EnablePrintCache`.
+  std::shared_ptr<PrintCache> print_cache;
+
+  // Index of declarations and statements by kind. See `AST::DeclsOfKind`.
+  // Lazily initialized by `BuildKindIndex`. `indexed_decls` holds the walked
+  // declarations grouped by kind, and in source order within each kind, such
+  // that the declarations of kind `k` are those in the range
+  // `[decl_kind_offsets[k], decl_kind_offsets[k + 1])`. The statements are
+  // similarly indexed.
+  std::once_flag kind_index_init;
+  std::vector<const clang::Decl *> indexed_decls;
+  std::vector<uint32_t> decl_kind_offsets;
+  std::vector<const clang::Stmt *> indexed_stmts;
+  std::vector<uint32_t> stmt_kind_offsets;
+
+  // Walk order of each entry of `indexed_decls` and `indexed_stmts`, so that
+  // the entities of many kinds can be merged back into source order.
+  std::vector<uint32_t> indexed_decl_ordinals;
+  std::vector<uint32_t> indexed_stmt_ordinals;
+
+  // Entities of all of the kinds in a `detail::KindRange`, i.e. of a class and
+  // of its derived classes, in source order, keyed by the range's bounds.
+  // These are merged on demand, and never changed once merged.
+  std::mutex merged_kinds_lock;
+  std::map<std::pair<uint16_t, uint16_t>, std::vector<const clang::Decl *>>
+      merged_decls;
+  std::map<std::pair<uint16_t, uint16_t>, std::vector<const clang::Stmt *>>
+      merged_stmts;
+
+  // Parent map of declarations and statements. See `Stmt::Parent`. Lazily
+  // initialized by `BuildParentMap`. Every walked declaration and statement
+  // is given a dense ordinal, in walk order, which indexes `entity_parents`.
+  // `entity_parents[i].parent` is the ordinal of the parent of the entity with
+  // ordinal `i`, and `entity_parents[i].parent_decl` is the ordinal of its
+  // nearest enclosing declaration, and so the parent is a declaration iff the
+  // two are equal. Both are `kInvalidEntityOrdinal` for the translation unit.
+  // `entity_ordinals` maps each entity to its ordinal. An entity that is
+  // reachable from more than one parent is only given an ordinal the first
+  // time that it's walked, and so its first parent in walk order wins.
+  static constexpr uint32_t kInvalidEntityOrdinal = ~0u;
+  struct EntityParents {
+    const void *entity;
+    uint32_t parent;
+    uint32_t parent_decl;
+  };
+  std::once_flag parent_map_init;
+  std::vector<EntityParents> entity_parents;
+  llvm::DenseMap<const void *, uint32_t> entity_ordinals;
+
   // Where we expect the next macro use end location to be.
   clang::SourceLocation macro_use_end_loc;
 
@@ -190,6 +287,10 @@ class ASTImpl : public std::enable_shared_from_this<ASTImpl> {
   // of macro expansions.
   std::pair<TokenImpl *, TokenImpl *> DeclBounds(clang::Decl *decl);
 
+  // Try to return the `...` token of the prototype of `func`, as discovered by
+  // `DeclBounds`, or `nullptr`. See `FunctionDecl::EllipsisToken`.
+  TokenImpl *FunctionEllipsisToken(const clang::FunctionDecl *func);
+
   std::pair<TokenImpl *, TokenImpl *> PartitionDeclContext(
       clang::DeclContext *dc);
 
@@ -204,6 +305,20 @@ class ASTImpl : public std::enable_shared_from_this<ASTImpl> {
   // Link in macro tokens to the token contexts of tokens with macro roles.
   void LinkMacroTokenContexts(void);
 
+  // Fill in `derivation_roots` and `derivation_depths`.
+  void BuildDerivationTables(void);
+
+  // Link the `#define`s to their canonical definitions, as interned by the
+  // file manager `fm`.
+  void InternMacroDefinitions(const FileManager &fm);
+
+  // Fill in `indexed_decls`, `indexed_stmts`, and their offsets. This is
+  // safe to call concurrently.
+  void BuildKindIndex(void);
+
+  // Fill in the parent tables. This is safe to call concurrently.
+  void BuildParentMap(void);
+
   // Figure out lexical parentage. This is an important pre-processing step
   // prior to bounds calculation.
   void PreprocessLexicalParentage(void);
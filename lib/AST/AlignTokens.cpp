@@ -16,14 +16,21 @@
 #include <clang/Lex/Token.h>
 #pragma clang diagnostic pop
 
+#include <algorithm>
+#include <atomic>
 #include <fstream>
 #include <initializer_list>
 #include <iomanip>
 #include <iostream>
+#include <memory>
 #include <optional>
 #include <span>
 #include <sstream>
-#include <set>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "Builder.h"
 #include "Printer/Printer.h"
@@ -55,6 +62,14 @@ static bool TokenLocationsMatch(const PrintedTokenImpl *parsed,
   return parsed->derived_index == printed->derived_index;
 }
 
+// Return the parsed token from which `tok` was derived, if any.
+static Token DerivedToken(ASTImpl &ast, const PrintedTokenImpl *tok) {
+  if (tok->derived_index < ast.tokens.size()) {
+    return ast.TokenAt(&(ast.tokens[tok->derived_index]));
+  }
+  return ast.TokenAt(static_cast<const TokenImpl *>(nullptr));
+}
+
 static const TokenContextImpl *ContextFromToken(
     const PrintedTokenRangeImpl &range, PrintedTokenImpl *tok) {
   if (!tok) {
@@ -166,6 +181,12 @@ struct Region {
   virtual ~Region(void) = default;
   virtual RegionKind Kind(void) const noexcept = 0;
 
+  // Reset this region so that it can be re-used by a later alignment.
+  inline void ResetRegion(void) noexcept {
+    common_context = nullptr;
+    has_been_matched = false;
+  }
+
 #if PASTA_DEBUG_ALIGN
   virtual void Print(std::ostream &os, std::string indent,
                      const PrintedTokenRangeImpl &data_range,
@@ -202,6 +223,12 @@ struct StatementRegion final : public Region {
   PrintedTokenImpl *begin{nullptr};
   PrintedTokenImpl *end{nullptr};  // Inclusive.
 
+  inline void Reset(void) noexcept {
+    ResetRegion();
+    begin = nullptr;
+    end = nullptr;
+  }
+
   RegionKind Kind(void) const noexcept final {
     return RegionKind::kStatement;
   }
@@ -289,6 +316,12 @@ struct SequenceRegion final : public Region {
   // NOTE(pag): These are in reverse order.
   std::vector<Region *> regions;
 
+  // NOTE(pag): This keeps the capacity of `regions`.
+  inline void Reset(void) noexcept {
+    ResetRegion();
+    regions.clear();
+  }
+
   RegionKind Kind(void) const noexcept final {
     return RegionKind::kSequence;
   }
@@ -373,6 +406,15 @@ struct BalancedRegion final : public Region {
   SequenceRegion *statements{nullptr};
   PrintedTokenImpl *end{nullptr};
 
+  inline void Reset(void) noexcept {
+    ResetRegion();
+    predecessor = nullptr;
+    leading_ident = nullptr;
+    begin = nullptr;
+    statements = nullptr;
+    end = nullptr;
+  }
+
   RegionKind Kind(void) const noexcept final {
     return RegionKind::kBalanced;
   }
@@ -513,8 +555,169 @@ struct Bounds {
   inline std::span<PrintedTokenImpl> Range(void) const noexcept {
     return std::span<PrintedTokenImpl>(begin, end);
   }
+
+  inline size_t Size(void) const noexcept {
+    return static_cast<size_t>(end - begin);
+  }
+};
+
+struct HashCount {
+  unsigned num_parsed{0u};
+  unsigned num_printed{0u};
+  PrintedTokenImpl *printed{nullptr};
+};
+
+using HashedToken = std::pair<uint64_t, PrintedTokenImpl *>;
+
+// The set of pairs of parsed and printed regions that have been recursively
+// matched. This is a sorted vector, rather than a node-based set, so that
+// clearing it between alignments keeps its storage.
+class MatchedRegions {
+ public:
+  using Key = std::pair<Region *, Region *>;
+
+  // Add `(parsed, printed)` to the set. Returns `false` if it was already
+  // in the set.
+  inline bool Insert(Region *parsed, Region *printed) {
+    const Key key(parsed, printed);
+    auto it = std::lower_bound(keys.begin(), keys.end(), key);
+    if (it != keys.end() && *it == key) {
+      return false;
+    }
+    keys.insert(it, key);
+    return true;
+  }
+
+  inline bool Contains(Region *parsed, Region *printed) const {
+    return std::binary_search(keys.begin(), keys.end(),
+                              Key(parsed, printed));
+  }
+
+  inline void Clear(void) noexcept {
+    keys.clear();
+  }
+
+ private:
+  std::vector<Key> keys;
+};
+
+}  // namespace
+
+// Scratch state that is re-used across alignments. Everything in here is
+// cleared, but not freed, between alignments, so the buffers grow to the
+// high-water mark of the largest alignment done so far, rather than being
+// re-allocated for every alignment.
+class AlignmentSessionImpl {
+ public:
+  // See `AlignmentSession::EnableAnchoredMatching`.
+  bool use_anchors{true};
+
+  // Pools of regions. The first `num_*` regions of each pool are in use by the
+  // current alignment; the rest are waiting to be recycled.
+  std::vector<std::unique_ptr<StatementRegion>> statement_pool;
+  std::vector<std::unique_ptr<SequenceRegion>> sequence_pool;
+  std::vector<std::unique_ptr<BalancedRegion>> balanced_pool;
+  size_t num_statements{0u};
+  size_t num_sequences{0u};
+  size_t num_balanced{0u};
+
+  // All regions of the parsed and printed trees.
+  std::vector<Region *> parsed_regions;
+  std::vector<Region *> printed_regions;
+
+  // See `Matcher`.
+  MatchedRegions matched_with;
+  std::unordered_map<DerivedTokenIndex, PrintedTokenImpl *> loc_to_toks;
+  std::unordered_map<PrintedTokenImpl *, PrintedTokenImpl *> skip_balanced;
+
+  // Used by `Matcher::BuildRegions`.
+  std::vector<SequenceRegion *> region_stack;
+  std::vector<std::pair<clang::tok::TokenKind, PrintedTokenImpl *>> match_stack;
+  std::vector<std::tuple<clang::tok::TokenKind, clang::tok::TokenKind,
+                         clang::tok::TokenKind>> stmt_stoppers;
+
+  // Used by `Matcher::MatchProduct`. Matching is recursive, so this is used
+  // as a stack, where each level of recursion pushes its filtered regions,
+  // and pops them off before returning.
+  std::vector<Region *> filtered_regions;
+
+  // Used by `Matcher::AnchoredMatch` and `Matcher::HashBasedMatch`.
+  std::vector<uint64_t> parsed_hashes;
+  std::vector<uint64_t> printed_hashes;
+  std::unordered_map<uint64_t, HashCount> hash_counts;
+  std::vector<PrintedTokenImpl *> candidate_parsed;
+  std::vector<const PrintedTokenImpl *> candidate_printed;
+  std::vector<std::pair<Bounds, Bounds>> work_list;
+  std::vector<size_t> lis_tails;
+  std::vector<size_t> lis_prev;
+  std::vector<size_t> lis;
+  std::vector<HashedToken> parsed_hashed_toks;
+  std::vector<HashedToken> printed_hashed_toks;
+  std::vector<std::pair<PrintedTokenImpl *, size_t>> hash_groups;
+
+  // Used by `PrintedTokenRangeImpl::AlignTokens`.
+  std::stringstream err;
+  std::vector<BalancedRegion *> parsed_balanced;
+  std::vector<StatementRegion *> parsed_statements;
+  std::vector<BalancedRegion *> printed_balanced;
+  std::vector<StatementRegion *> printed_statements;
+  std::unordered_multimap<DerivedTokenIndex, BalancedRegion *> loc_to_balanced;
+  std::unordered_multimap<DerivedTokenIndex, StatementRegion *>
+      loc_to_statement;
+
+  // Used by `AlignmentSession::Align`.
+  std::vector<TokenContextIndex> context_map;
+  std::unordered_multimap<const void *, TokenContextIndex> data_to_context;
+
+  inline StatementRegion *NewStatementRegion(void) {
+    return Recycle(statement_pool, num_statements);
+  }
+
+  inline SequenceRegion *NewSequenceRegion(void) {
+    return Recycle(sequence_pool, num_sequences);
+  }
+
+  inline BalancedRegion *NewBalancedRegion(void) {
+    return Recycle(balanced_pool, num_balanced);
+  }
+
+  // Clear out the state of a prior alignment.
+  void Reset(void);
+
+ private:
+  template <typename T>
+  static T *Recycle(std::vector<std::unique_ptr<T>> &pool, size_t &num_used) {
+    if (num_used == pool.size()) {
+      pool.emplace_back(new T);
+    } else {
+      pool[num_used]->Reset();
+    }
+    return pool[num_used++].get();
+  }
 };
 
+void AlignmentSessionImpl::Reset(void) {
+  num_statements = 0u;
+  num_sequences = 0u;
+  num_balanced = 0u;
+  parsed_regions.clear();
+  printed_regions.clear();
+  matched_with.Clear();
+  loc_to_toks.clear();
+  skip_balanced.clear();
+  filtered_regions.clear();
+  err.str(std::string());
+  err.clear();
+  parsed_balanced.clear();
+  parsed_statements.clear();
+  printed_balanced.clear();
+  printed_statements.clear();
+  loc_to_balanced.clear();
+  loc_to_statement.clear();
+}
+
+namespace {
+
 class Matcher {
  public:
   ASTImpl &ast;
@@ -524,34 +727,38 @@ class Matcher {
   const Bounds parsed_bounds;
   const Bounds printed_bounds;
 
-  // Tracks if we've done recursive matching on two regions.
-  using MatchKey = std::pair<Region *, Region *>;
-  std::set<MatchKey> matched_with;
+  // Where our scratch buffers come from.
+  AlignmentSessionImpl &session;
 
-  std::vector<std::unique_ptr<Region>> parsed_regions;
-  std::vector<std::unique_ptr<Region>> printed_regions;
+  // Tracks if we've done recursive matching on two regions.
+  MatchedRegions &matched_with;
 
   // Maps parsed locations to parsed tokens.
-  std::unordered_map<DerivedTokenIndex, PrintedTokenImpl *> loc_to_toks;
+  std::unordered_map<DerivedTokenIndex, PrintedTokenImpl *> &loc_to_toks;
 
   // Maps identifiers or keywords that precede a balanced region to the
   // token just after the balanced region. This is used to jump over
   // `__attribute__` tokens when doing forward matching.
-  std::unordered_map<PrintedTokenImpl *, PrintedTokenImpl *> skip_balanced;
+  std::unordered_map<PrintedTokenImpl *, PrintedTokenImpl *> &skip_balanced;
 
   inline explicit Matcher(ASTImpl &ast_,
                           PrintedTokenRangeImpl &parsed_range_,
-                          PrintedTokenRangeImpl &printed_range_)
+                          PrintedTokenRangeImpl &printed_range_,
+                          AlignmentSessionImpl &session_)
       : ast(ast_),
         parsed_range(parsed_range_),
         printed_range(printed_range_),
         parsed_bounds(parsed_range),
-        printed_bounds(printed_range) {}
+        printed_bounds(printed_range),
+        session(session_),
+        matched_with(session.matched_with),
+        loc_to_toks(session.loc_to_toks),
+        skip_balanced(session.skip_balanced) {}
 
   // Organize the tokens into a tree, grouped by brace/bracket/paren-enclosed
   // regions, and comma/semicolon-separated regions.
   SequenceRegion *BuildRegions(
-      std::vector<std::unique_ptr<Region>> &regions,
+      std::vector<Region *> &regions,
       std::stringstream &err, PrintedTokenImpl *first,
       PrintedTokenImpl *after_last, const char *list_kind);
 
@@ -560,9 +767,9 @@ class Matcher {
                               PrintedTokenImpl *printed);
   bool MatchBalanced(BalancedRegion *parsed, BalancedRegion *printed,
                      bool &changed);
-  bool MatchProduct(std::vector<Region *> parsed_regions,
-                    std::vector<Region *> printed_regions,
-                    bool &changed);
+  template <typename T>
+  bool MatchProduct(const SequenceRegion *parsed,
+                    const SequenceRegion *printed, bool &changed);
   bool MatchSequence(SequenceRegion *parsed, SequenceRegion *printed,
                      bool should_match, bool &changed);
   bool MatchStatement(StatementRegion *parsed, StatementRegion *printed,
@@ -570,6 +777,7 @@ class Matcher {
   bool MatchRegions(Region *parsed, Region *printed,
                     bool &changed);
 
+  bool AnchoredMatch(Bounds parsed, Bounds printed, bool &changed);
   bool HashBasedMatch(Bounds parsed, Bounds printed, bool &changed);
 
   bool MergeAround(PrintedTokenImpl *parsed, PrintedTokenImpl *printed,
@@ -584,7 +792,7 @@ class Matcher {
   void JoinOnLocations(void);
   void MergeSameSizedHoles(void);
 
-  void AssignPredecessors(const std::vector<std::unique_ptr<Region>> &regions);
+  void AssignPredecessors(const std::vector<Region *> &regions);
 
   void FixBalancedRegionContexts(
       BalancedRegion *bal, const TokenContextImpl *parent_context);
@@ -598,20 +806,22 @@ class Matcher {
 // Organize the tokens into a tree, grouped by brace/bracket/paren-enclosed
 // regions, and comma/semicolon-separated regions.
 SequenceRegion *Matcher::BuildRegions(
-    std::vector<std::unique_ptr<Region>> &regions, std::stringstream &err,
+    std::vector<Region *> &regions, std::stringstream &err,
     PrintedTokenImpl *first, PrintedTokenImpl *after_last,
     const char *list_kind) {
 
-  std::vector<SequenceRegion *> region_stack;
-  std::vector<std::pair<clang::tok::TokenKind, PrintedTokenImpl *>> match_stack;
-  std::vector<std::tuple<clang::tok::TokenKind, clang::tok::TokenKind,
-                         clang::tok::TokenKind>> stmt_stoppers;
+  auto &region_stack = session.region_stack;
+  auto &match_stack = session.match_stack;
+  auto &stmt_stoppers = session.stmt_stoppers;
+  region_stack.clear();
+  match_stack.clear();
+  stmt_stoppers.clear();
 
   PrintedTokenImpl *unused_end = nullptr;
 
   auto push_empty_sequence = [&] (void) {
-    const auto empty = new SequenceRegion;
-    regions.emplace_back(empty);
+    const auto empty = session.NewSequenceRegion();
+    regions.push_back(empty);
     region_stack.emplace_back(empty);
     return empty;
   };
@@ -620,8 +830,8 @@ SequenceRegion *Matcher::BuildRegions(
     if (unused_end) {
       auto seq = dynamic_cast<SequenceRegion *>(region_stack.back());
       assert(seq != nullptr);
-      auto stmt = new StatementRegion;
-      regions.emplace_back(stmt);
+      auto stmt = session.NewStatementRegion();
+      regions.push_back(stmt);
       stmt->begin = begin;
       stmt->end = unused_end;
       seq->regions.push_back(stmt);
@@ -710,7 +920,7 @@ SequenceRegion *Matcher::BuildRegions(
               << clang::tok::getTokenName(tok_kind)
               << "; match stack is empty for " << list_kind << " tokens";
 
-          if (Token hl_tok = ast.TokenAt(&tok)) {
+          if (Token hl_tok = DerivedToken(ast, &tok)) {
             err << " (index " << hl_tok.Index() << ')';
             if (auto ft = hl_tok.FileLocation()) {
               auto file = File::Containing(ft.value());
@@ -734,7 +944,7 @@ SequenceRegion *Matcher::BuildRegions(
                 << " (ending index " << (r_tok - first)
                 << ") in " << list_kind << " tokens";
 
-            if (Token hl_tok_begin = ast.TokenAt(&tok)) {
+            if (Token hl_tok_begin = DerivedToken(ast, &tok)) {
               if (auto ft = hl_tok_begin.FileLocation()) {
                 auto file = File::Containing(ft.value());
                 err << " starting at " << file.Path().generic_string()
@@ -742,7 +952,7 @@ SequenceRegion *Matcher::BuildRegions(
               }
             }
 
-            if (Token hl_tok_end = ast.TokenAt(r_tok)) {
+            if (Token hl_tok_end = DerivedToken(ast, r_tok)) {
               if (auto ft = hl_tok_end.FileLocation()) {
                 auto file = File::Containing(ft.value());
                 err << " ending at " << file.Path().generic_string()
@@ -753,8 +963,8 @@ SequenceRegion *Matcher::BuildRegions(
 
           } else {
             assert(!region_stack.empty());
-            auto br = new BalancedRegion;
-            regions.emplace_back(br);
+            auto br = session.NewBalancedRegion();
+            regions.push_back(br);
 
             br->begin = &tok;
             br->end = r_tok;
@@ -1084,7 +1294,7 @@ bool Matcher::MatchBalanced(BalancedRegion *parsed, BalancedRegion *printed,
   }
 
   // We've previously matched these before, don't do any recursive processing.
-  if (!matched_with.emplace(parsed, printed).second) {
+  if (!matched_with.Insert(parsed, printed)) {
     return true;
   }
 
@@ -1121,27 +1331,40 @@ bool Matcher::MatchBalanced(BalancedRegion *parsed, BalancedRegion *printed,
 }
 
 template <typename T>
-static std::vector<Region *> FilterRegionsInto(
-    const std::vector<Region *> &regions) {
-  std::vector<Region *> filtered;
+static void FilterRegionsInto(const std::vector<Region *> &regions,
+                              std::vector<Region *> &filtered) {
   for (auto it = regions.rbegin(), end = regions.rend(); it != end; ++it) {
     if (auto f = dynamic_cast<T *>(*it)) {
       filtered.push_back(f);
     }
   }
-  return filtered;
 }
 
-bool Matcher::MatchProduct(std::vector<Region *> parsed_regions,
-                           std::vector<Region *> printed_regions,
-                           bool &changed) {
+// Try to match every `T`-typed sub-region of `parsed` with every `T`-typed
+// sub-region of `printed`.
+//
+// NOTE(pag): `MatchRegions` can recursively call back into here, which pushes
+//            more regions onto `filtered`, and thus might re-allocate it. We
+//            only ever refer to our own filtered regions by their indices.
+template <typename T>
+bool Matcher::MatchProduct(const SequenceRegion *parsed,
+                           const SequenceRegion *printed, bool &changed) {
+  std::vector<Region *> &filtered = session.filtered_regions;
+  const size_t parsed_begin = filtered.size();
+  FilterRegionsInto<T>(parsed->regions, filtered);
+  const size_t printed_begin = filtered.size();
+  FilterRegionsInto<T>(printed->regions, filtered);
+  const size_t printed_end = filtered.size();
+
   bool matched = false;
-  for (Region *&parsed_sub : parsed_regions) {
+  for (size_t i = parsed_begin; i < printed_begin; ++i) {
+    Region * const parsed_sub = filtered[i];
     if (!parsed_sub) {
       continue;
     }
 
-    for (Region *&printed_sub : printed_regions) {
+    for (size_t j = printed_begin; j < printed_end; ++j) {
+      Region * const printed_sub = filtered[j];
       if (!printed_sub) {
         continue;
       }
@@ -1150,13 +1373,16 @@ bool Matcher::MatchProduct(std::vector<Region *> parsed_regions,
         assert(parsed_sub->common_context != nullptr);
         assert(parsed_sub->has_been_matched);
         assert(printed_sub->has_been_matched);
-        parsed_sub = nullptr;
-        printed_sub = nullptr;
+        filtered[i] = nullptr;
+        filtered[j] = nullptr;
         matched = true;
         break;
       }
     }
   }
+
+  assert(filtered.size() == printed_end);
+  filtered.resize(parsed_begin);
   return matched;
 }
 
@@ -1179,40 +1405,30 @@ bool Matcher::MatchSequence(SequenceRegion *parsed, SequenceRegion *printed,
   }
 
   if (should_match) {
-    if (!matched_with.emplace(parsed, printed).second) {
+    if (!matched_with.Insert(parsed, printed)) {
       return true;
     }
-  } else if (matched_with.count(MatchKey(parsed, printed))) {
+  } else if (matched_with.Contains(parsed, printed)) {
     return true;
   }
 
   // First, try to match nested balanced/statement regions. These are much
   // easier to match with one-another.
-  auto matched_balanced = MatchProduct(
-      FilterRegionsInto<BalancedRegion>(parsed->regions),
-      FilterRegionsInto<BalancedRegion>(printed->regions),
-      changed);
+  auto matched_balanced = MatchProduct<BalancedRegion>(
+      parsed, printed, changed);
 
-  auto matched_stmts = MatchProduct(
-      FilterRegionsInto<StatementRegion>(parsed->regions),
-      FilterRegionsInto<StatementRegion>(printed->regions),
-      changed);
+  auto matched_stmts = MatchProduct<StatementRegion>(
+      parsed, printed, changed);
 
   // If we matched balanced or statements, and regardless of if we are trying
   // to force things, then go try to match sequences.
   if (matched_balanced || matched_stmts) {
-    MatchProduct(
-        FilterRegionsInto<SequenceRegion>(parsed->regions),
-        FilterRegionsInto<SequenceRegion>(printed->regions),
-        changed);
+    MatchProduct<SequenceRegion>(parsed, printed, changed);
 
   // If we failed to match on balanced and statements, but the caller context
   // is telling us that we should match, then go and try to match those too.
   } else if (should_match) {
-    MatchProduct(
-        FilterRegionsInto<SequenceRegion>(parsed->regions),
-        FilterRegionsInto<SequenceRegion>(printed->regions),
-        changed);
+    MatchProduct<SequenceRegion>(parsed, printed, changed);
   
   // The caller didn't give us a strong hint, and we didn't match balanced or
   // statements, so don't go aggressive into sequences.
@@ -1220,48 +1436,264 @@ bool Matcher::MatchSequence(SequenceRegion *parsed, SequenceRegion *printed,
     return false;
   }
 
-  matched_with.emplace(parsed, printed);
+  (void) matched_with.Insert(parsed, printed);
   Region::MarkAsMatched(parsed, printed, changed);
 
   return true;
 }
 
+// Fill `lis` with the indices of a longest strictly increasing subsequence of
+// `keys`. This is patience sorting, and so runs in O(n log n) time. `tails` and
+// `prev` are scratch space.
+static void LongestIncreasingSubsequence(
+    const std::vector<const PrintedTokenImpl *> &keys,
+    std::vector<size_t> &tails, std::vector<size_t> &prev,
+    std::vector<size_t> &lis) {
+  tails.clear();  // Index of the smallest tail of each length.
+  prev.assign(keys.size(), ~0ull);
+
+  for (size_t i = 0u, max_i = keys.size(); i < max_i; ++i) {
+    auto it = std::lower_bound(
+        tails.begin(), tails.end(), keys[i],
+        [&keys] (size_t tail, const PrintedTokenImpl *key) {
+          return keys[tail] < key;
+        });
+    if (it != tails.begin()) {
+      prev[i] = it[-1];
+    }
+    if (it == tails.end()) {
+      tails.push_back(i);
+    } else {
+      *it = i;
+    }
+  }
+
+  lis.resize(tails.size());
+  size_t i = tails.empty() ? 0u : tails.back();
+  for (auto j = lis.size(); j--; i = prev[i]) {
+    lis[j] = i;
+  }
+}
+
+// Diff-style matching of the unmatched tokens of `parsed` and `printed`, in
+// the style of patience diff / Hunt-Szymanski. Tokens whose hash appears
+// exactly once among the unmatched tokens of each side are candidate anchors,
+// and a longest increasing subsequence of the candidates gives us the
+// anchors that preserve token order. The gaps between consecutive anchors are
+// then aligned in the same way, until no more anchors are found.
+//
+// NOTE(pag): This only ever matches pairs of tokens that `HashBasedMatch`
+//            would also pair up, i.e. where there is no ambiguity. It exists
+//            to shrink the groups of same-hashed tokens that `HashBasedMatch`
+//            has to consider, as those groups are what make it quadratic.
+//
+// NOTE(pag): Each gap is re-scanned when it is taken off of the work list, and
+//            a gap may only shrink by one anchor per round, which is quadratic
+//            in the worst case. The total number of tokens scanned is thus
+//            bounded by `kMaxAnchorWorkFactor` times the number of input
+//            tokens, and whatever is left over is handled by `HashBasedMatch`.
+//
+// NOTE(pag): The token hashes in `session.parsed_hashes` and
+//            `session.printed_hashes` must already be computed.
+bool Matcher::AnchoredMatch(Bounds parsed, Bounds printed, bool &changed) {
+  static constexpr size_t kMaxAnchorWorkFactor = 8u;
+
+  const std::vector<uint64_t> &parsed_hashes = session.parsed_hashes;
+  const std::vector<uint64_t> &printed_hashes = session.printed_hashes;
+  size_t work_budget = kMaxAnchorWorkFactor * (parsed.Size() + printed.Size());
+
+  std::unordered_map<uint64_t, HashCount> &counts = session.hash_counts;
+  std::vector<PrintedTokenImpl *> &candidate_parsed = session.candidate_parsed;
+  std::vector<const PrintedTokenImpl *> &candidate_printed =
+      session.candidate_printed;
+  std::vector<std::pair<Bounds, Bounds>> &wl = session.work_list;
+  wl.clear();
+  wl.emplace_back(parsed, printed);
+
+  auto matched = false;
+  while (!wl.empty()) {
+    const Bounds sub_parsed = wl.back().first;
+    const Bounds sub_printed = wl.back().second;
+    wl.pop_back();
+
+    const size_t work = sub_parsed.Size() + sub_printed.Size();
+    if (work > work_budget) {
+      break;
+    }
+    work_budget -= work;
+
+    counts.clear();
+    for (PrintedTokenImpl &it : sub_parsed.Range()) {
+      if (!it.matched_in_align) {
+        counts[parsed_hashes[static_cast<size_t>(&it - parsed.begin)]]
+            .num_parsed++;
+      }
+    }
+
+    for (PrintedTokenImpl &it : sub_printed.Range()) {
+      if (!it.matched_in_align) {
+        auto found = counts.find(
+            printed_hashes[static_cast<size_t>(&it - printed.begin)]);
+        if (found != counts.end()) {
+          found->second.num_printed++;
+          found->second.printed = &it;
+        }
+      }
+    }
+
+    // Find the unique-in-both tokens, in parsed order.
+    candidate_parsed.clear();
+    candidate_printed.clear();
+    for (PrintedTokenImpl &it : sub_parsed.Range()) {
+      if (it.matched_in_align) {
+        continue;
+      }
+      const HashCount &count =
+          counts[parsed_hashes[static_cast<size_t>(&it - parsed.begin)]];
+      if (count.num_parsed == 1u && count.num_printed == 1u) {
+        candidate_parsed.push_back(&it);
+        candidate_printed.push_back(count.printed);
+      }
+    }
+
+    // Match the anchors, and then queue up the gaps between them.
+    PrintedTokenImpl *parsed_gap_begin = sub_parsed.begin;
+    PrintedTokenImpl *printed_gap_begin = sub_printed.begin;
+    auto found_anchor = false;
+
+    LongestIncreasingSubsequence(candidate_printed, session.lis_tails,
+                                 session.lis_prev, session.lis);
+    for (size_t i : session.lis) {
+      PrintedTokenImpl *parsed_tok = candidate_parsed[i];
+      PrintedTokenImpl *printed_tok =
+          const_cast<PrintedTokenImpl *>(candidate_printed[i]);
+
+      // This might have been matched by `MergeAround` on a prior anchor.
+      if (parsed_tok->matched_in_align || printed_tok->matched_in_align ||
+          !MatchToken(parsed_tok, printed_tok)) {
+        continue;
+      }
+
+      MergeToken(parsed_tok, printed_tok, changed, true);
+      MergeAround(parsed_tok, printed_tok, changed);
+      matched = true;
+      found_anchor = true;
+
+      if (parsed_gap_begin < parsed_tok && printed_gap_begin < printed_tok) {
+        wl.emplace_back(Bounds(parsed_gap_begin, parsed_tok),
+                        Bounds(printed_gap_begin, printed_tok));
+      }
+
+      parsed_gap_begin = &(parsed_tok[1]);
+      printed_gap_begin = &(printed_tok[1]);
+    }
+
+    if (found_anchor && parsed_gap_begin < sub_parsed.end &&
+        printed_gap_begin < sub_printed.end) {
+      wl.emplace_back(Bounds(parsed_gap_begin, sub_parsed.end),
+                      Bounds(printed_gap_begin, sub_printed.end));
+    }
+  }
+
+  return matched;
+}
+
 bool Matcher::HashBasedMatch(Bounds parsed, Bounds printed, bool &changed) {
 
-  std::unordered_map<uint64_t, std::vector<PrintedTokenImpl *>> parsed_toks;
-  std::unordered_map<uint64_t, std::vector<PrintedTokenImpl *>> printed_toks;
+  // Hash everything once up-front. `AnchoredMatch` also uses these hashes.
+  std::vector<uint64_t> &parsed_hashes = session.parsed_hashes;
+  std::vector<uint64_t> &printed_hashes = session.printed_hashes;
+  parsed_hashes.clear();
+  printed_hashes.clear();
+
+  for (PrintedTokenImpl &it : parsed.Range()) {
+    parsed_hashes.push_back(Hash(it.Kind(), it.Data(parsed_range)));
+  }
+
+  for (PrintedTokenImpl &it : printed.Range()) {
+    printed_hashes.push_back(Hash(it.Kind(), it.Data(printed_range)));
+  }
+
+  // Start by anchoring on unambiguous tokens, which shrinks the same-hash
+  // groups below.
+  auto matched = session.use_anchors && AnchoredMatch(parsed, printed, changed);
+
+  std::vector<HashedToken> &parsed_toks = session.parsed_hashed_toks;
+  std::vector<HashedToken> &printed_toks = session.printed_hashed_toks;
+  parsed_toks.clear();
+  printed_toks.clear();
 
   // Do some join-based hashing, then try to match tokens with the same hash.
   // This can have really bad time complexity when the two statements contain
   // tons of literal/punctuation values, which happens with giant arrays.
+  //
+  // NOTE(pag): Sorting groups the tokens by their hashes, and within a group,
+  //            orders the tokens by their positions, because the tokens of
+  //            each side are in a single array.
 
   for (PrintedTokenImpl &it : parsed.Range()) {
     if (!it.matched_in_align) {
-      parsed_toks[Hash(it.Kind(), it.Data(parsed_range))].emplace_back(&it);
+      parsed_toks.emplace_back(
+          parsed_hashes[static_cast<size_t>(&it - parsed.begin)], &it);
     }
   }
 
   for (PrintedTokenImpl &it : printed.Range()) {
     if (!it.matched_in_align) {
-      printed_toks[Hash(it.Kind(), it.Data(printed_range))].emplace_back(&it);
+      printed_toks.emplace_back(
+          printed_hashes[static_cast<size_t>(&it - printed.begin)], &it);
     }
   }
 
-  auto matched = false;
-  for (auto &[hash, parsed_tok_group] : parsed_toks) {
-    auto printed_toks_it = printed_toks.find(hash);
-    if (printed_toks_it == printed_toks.end()) {
-      continue;
+  std::sort(parsed_toks.begin(), parsed_toks.end());
+  std::sort(printed_toks.begin(), printed_toks.end());
+
+  // Visit the groups in the order of their first parsed tokens. Matching a
+  // token also merges around it, so the order of the groups affects which
+  // tokens are left to be matched by later groups, and source order keeps
+  // this independent of the hash values.
+  std::vector<std::pair<PrintedTokenImpl *, size_t>> &groups =
+      session.hash_groups;
+  groups.clear();
+  for (size_t i = 0u, max_i = parsed_toks.size(); i < max_i; ++i) {
+    if (!i || parsed_toks[i - 1u].first != parsed_toks[i].first) {
+      groups.emplace_back(parsed_toks[i].second, i);
     }
+  }
+
+  std::sort(groups.begin(), groups.end());
+
+  const auto parsed_toks_end = parsed_toks.end();
+  const auto printed_toks_end = printed_toks.end();
+
+  for (const auto &group : groups) {
+    auto parsed_toks_it = parsed_toks.begin() +
+                          static_cast<std::ptrdiff_t>(group.second);
+
+    const uint64_t hash = parsed_toks_it->first;
+    auto different_hash = [hash] (const HashedToken &ht) {
+      return ht.first != hash;
+    };
+
+    const auto parsed_group_end = std::find_if(
+        parsed_toks_it, parsed_toks_end, different_hash);
+
+    const auto matching_printed = std::lower_bound(
+        printed_toks.begin(), printed_toks_end, hash,
+        [] (const HashedToken &ht, uint64_t h) {
+          return ht.first < h;
+        });
+
+    const auto printed_group_end = std::find_if(
+        matching_printed, printed_toks_end, different_hash);
 
-    std::vector<PrintedTokenImpl *> &matching_printed =
-        printed_toks_it->second;
     size_t start = 0u;
-    const size_t size = matching_printed.size();
+    const auto size = static_cast<size_t>(printed_group_end - matching_printed);
 
-    for (PrintedTokenImpl *&parsed_tok : parsed_tok_group) {
+    for (; parsed_toks_it != parsed_group_end; ++parsed_toks_it) {
+      PrintedTokenImpl * const parsed_tok = parsed_toks_it->second;
       for (auto i = start; i < size; ++i) {
-        PrintedTokenImpl *&printed_tok = matching_printed[i];
+        PrintedTokenImpl *&printed_tok = matching_printed[i].second;
 
         if (!printed_tok) {
           assert(false);
@@ -1277,8 +1709,8 @@ bool Matcher::HashBasedMatch(Bounds parsed, Bounds printed, bool &changed) {
 
           // Try to reduce scope of O(n^2) problems.
           if (i > start) {
-            assert(matching_printed[start] != nullptr);
-            std::swap(printed_tok, matching_printed[start]); 
+            assert(matching_printed[start].second != nullptr);
+            std::swap(printed_tok, matching_printed[start].second);
           }
           ++start;
 
@@ -1299,7 +1731,7 @@ bool Matcher::MatchStatement(StatementRegion *parsed, StatementRegion *printed,
   }
 
   bool force = TokenLocationsMatch(parsed->end, printed->end);
-  if (force && !matched_with.emplace(parsed, printed).second) {
+  if (force && !matched_with.Insert(parsed, printed)) {
     return true;  // Already matched.
   }
 
@@ -1331,7 +1763,7 @@ bool Matcher::MatchRegions(Region *parsed, Region *printed,
   }
 
   if (parsed->has_been_matched && printed->has_been_matched &&
-      matched_with.count(MatchKey(parsed, printed))) {
+      matched_with.Contains(parsed, printed)) {
     return true;
   }
 
@@ -1516,11 +1948,9 @@ void Matcher::JoinOnLocations(void) {
 
 // Assign the predecessor sequences of balanced regions. These can be helpful
 // for matching.
-void Matcher::AssignPredecessors(
-    const std::vector<std::unique_ptr<Region>> &regions) {
-
-  for (const std::unique_ptr<Region> &region : regions) {
-    auto seq = dynamic_cast<SequenceRegion *>(region.get());
+void Matcher::AssignPredecessors(const std::vector<Region *> &regions) {
+  for (Region *region : regions) {
+    auto seq = dynamic_cast<SequenceRegion *>(region);
     if (!seq) {
       continue;
     }
@@ -1541,7 +1971,7 @@ void Matcher::AssignPredecessors(
 
 std::optional<std::string> PrintedTokenRangeImpl::AlignTokens(
     PrintedTokenRangeImpl &printed_range,
-    TokenContextIndex root_context_id) {
+    TokenContextIndex root_context_id, AlignmentSessionImpl &session) {
 
   assert(root_context_id != kInvalidTokenContextIndex);
   assert(root_context_id < contexts.size());
@@ -1553,11 +1983,12 @@ std::optional<std::string> PrintedTokenRangeImpl::AlignTokens(
   assert(parsed_bounds.begin <= parsed_bounds.end);
   assert(printed_bounds.begin <= printed_bounds.end);
 
-  std::stringstream err;
-  std::vector<std::unique_ptr<Region>> parsed_regions;
-  std::vector<std::unique_ptr<Region>> printed_regions;
+  session.Reset();
+  std::stringstream &err = session.err;
+  std::vector<Region *> &parsed_regions = session.parsed_regions;
+  std::vector<Region *> &printed_regions = session.printed_regions;
 
-  Matcher matcher(*ast, *this, printed_range);
+  Matcher matcher(*ast, *this, printed_range, session);
   
   matcher.InitParsedLocationsMap();    
 
@@ -1590,22 +2021,22 @@ std::optional<std::string> PrintedTokenRangeImpl::AlignTokens(
   //            this function.
   (void) printed_tree->CommonContext(*this, root_context);
 
-  std::vector<BalancedRegion *> parsed_balanced;
-  std::vector<StatementRegion *> parsed_statements;
+  auto &parsed_balanced = session.parsed_balanced;
+  auto &parsed_statements = session.parsed_statements;
 
-  std::vector<BalancedRegion *> printed_balanced;
-  std::vector<StatementRegion *> printed_statements;
+  auto &printed_balanced = session.printed_balanced;
+  auto &printed_statements = session.printed_statements;
 
-  std::unordered_multimap<DerivedTokenIndex, BalancedRegion *> loc_to_balanced;
-  std::unordered_multimap<DerivedTokenIndex, StatementRegion *> loc_to_statement;
+  auto &loc_to_balanced = session.loc_to_balanced;
+  auto &loc_to_statement = session.loc_to_statement;
 
-  for (const auto &region : parsed_regions) {
-    if (auto bal = dynamic_cast<BalancedRegion *>(region.get())) {
+  for (Region *region : parsed_regions) {
+    if (auto bal = dynamic_cast<BalancedRegion *>(region)) {
       parsed_balanced.push_back(bal);
       loc_to_balanced.emplace(bal->begin->derived_index, bal);
       loc_to_balanced.emplace(bal->end->derived_index, bal);
 
-    } else if (auto stmt = dynamic_cast<StatementRegion *>(region.get())) {
+    } else if (auto stmt = dynamic_cast<StatementRegion *>(region)) {
       parsed_statements.push_back(stmt);
       loc_to_statement.emplace(stmt->end->derived_index, stmt);
     }
@@ -1614,10 +2045,10 @@ std::optional<std::string> PrintedTokenRangeImpl::AlignTokens(
   loc_to_balanced.erase(kInvalidDerivedTokenIndex);
   loc_to_statement.erase(kInvalidDerivedTokenIndex);
 
-  for (const auto &region : printed_regions) {
-    if (auto bal = dynamic_cast<BalancedRegion *>(region.get())) {
+  for (Region *region : printed_regions) {
+    if (auto bal = dynamic_cast<BalancedRegion *>(region)) {
       printed_balanced.push_back(bal);
-    } else if (auto stmt = dynamic_cast<StatementRegion *>(region.get())) {
+    } else if (auto stmt = dynamic_cast<StatementRegion *>(region)) {
       printed_statements.push_back(stmt);
     }
   }
@@ -1673,7 +2104,7 @@ std::optional<std::string> PrintedTokenRangeImpl::AlignTokens(
     return changed;
   };
 
-  matcher.matched_with.emplace(parsed_tree, printed_tree);
+  (void) matcher.matched_with.Insert(parsed_tree, printed_tree);
   bool changed = false;
   Region::MarkAsMatched(parsed_tree, printed_tree, changed);
 
@@ -1753,10 +2184,34 @@ static const std::string kMissingASTs = "No backing AST";
 static const std::string kMissingSourceLoc = "Missing source location in token";
 }  // namespace
 
+AlignmentSession::AlignmentSession(void)
+    : impl(std::make_unique<AlignmentSessionImpl>()) {}
+
+AlignmentSession::~AlignmentSession(void) {}
+
+AlignmentSession::AlignmentSession(AlignmentSession &&) noexcept = default;
+
+AlignmentSession &
+AlignmentSession::operator=(AlignmentSession &&) noexcept = default;
+
+// Enable or disable anchoring on tokens that are unique to both sides before
+// greedily matching the remaining tokens.
+void AlignmentSession::EnableAnchoredMatching(bool enable) {
+  impl->use_anchors = enable;
+}
+
 // Align the token locations from `a` with the token contexts from `b`. Returns
 // a string if an error occured.
 std::optional<std::string> PrintedTokenRange::Align(PrintedTokenRange &a,
                                                     PrintedTokenRange &b) {
+  AlignmentSession session;
+  return session.Align(a, b);
+}
+
+// Align the token locations from `a` with the token contexts from `b`, re-using
+// this session's scratch buffers. Returns a string if an error occured.
+std::optional<std::string> AlignmentSession::Align(PrintedTokenRange &a,
+                                                   PrintedTokenRange &b) {
 
   if (a.impl == b.impl) {
     return std::nullopt;
@@ -1778,6 +2233,11 @@ std::optional<std::string> PrintedTokenRange::Align(PrintedTokenRange &a,
     return kMissingASTs;
   }
 
+  // Both ranges are mutated in-place, so make sure neither is shared through
+  // the AST's print cache.
+  PrintedTokenRangeImpl::Unshare(a);
+  PrintedTokenRangeImpl::Unshare(b);
+
   // Top-level context should be the AST.
   a.impl->contexts = b.impl->contexts;
 
@@ -1802,7 +2262,7 @@ std::optional<std::string> PrintedTokenRange::Align(PrintedTokenRange &a,
 
   reset_matches(b.impl->tokens);
 
-  auto error = a.impl->AlignTokens(*(b.impl), kASTTokenContextIndex);
+  auto error = a.impl->AlignTokens(*(b.impl), kASTTokenContextIndex, *impl);
   if (error) {
     return error.value();
   }
@@ -1817,8 +2277,10 @@ std::optional<std::string> PrintedTokenRange::Align(PrintedTokenRange &a,
   // Migrate the token contexts into the AST. This will migrate only the
   // contexts that were actually propagated into the parsed tokens, as
   // opposed to all token contexts.
-  std::vector<TokenContextIndex> context_map;
-  std::unordered_multimap<const void *, TokenContextIndex> data_to_context;
+  std::vector<TokenContextIndex> &context_map = impl->context_map;
+  std::unordered_multimap<const void *, TokenContextIndex> &data_to_context =
+      impl->data_to_context;
+  data_to_context.clear();
   context_map.assign(b.impl->contexts.size(), kInvalidTokenContextIndex);
   data_to_context.emplace(a.impl->ast.get(), kASTTokenContextIndex);
 
@@ -1828,4 +2290,146 @@ std::optional<std::string> PrintedTokenRange::Align(PrintedTokenRange &a,
   return std::nullopt;
 }
 
+// Align every top-level declaration of `ast_`'s translation unit, using up to
+// `num_threads` threads, and concatenate the aligned ranges together in order.
+PrintedTokenRange PrintedTokenRange::AlignTopLevelDecls(
+    const AST &ast_, unsigned num_threads, const PrintingPolicy &pp,
+    std::vector<std::string> *errors) {
+  const Decl tu_decl = ast_.TranslationUnit();
+  const std::shared_ptr<ASTImpl> &ast = tu_decl.ast;
+  auto tu = const_cast<clang::TranslationUnitDecl *>(
+      tu_decl.u.TranslationUnitDecl);
+  auto &context = ast->tu->getASTContext();
+
+  // A group of top-level declarations whose parsed tokens overlap, and so
+  // which must be aligned together. A unit without any declarations covers the
+  // gap between two other units, and its tokens are adopted as-is.
+  struct AlignmentUnit {
+    std::vector<clang::Decl *> decls;
+    const TokenImpl *first;
+    const TokenImpl *after_last;
+  };
+
+  // Compute the bounds up-front, as computing bounds is serialized anyway.
+  std::vector<AlignmentUnit> decl_units;
+  bool align_whole_tu = false;
+  for (clang::Decl *decl : tu->decls()) {
+    if (decl->isImplicit()) {
+      continue;
+    }
+
+    TokenRange parsed = ast->DeclTokenRange(decl);
+    if (!parsed) {
+      align_whole_tu = true;
+      break;
+    }
+
+    decl_units.push_back({{decl}, parsed.first, parsed.after_last});
+  }
+
+  const TokenImpl * const first_tok = ast->tokens.data();
+  const TokenImpl * const after_last_tok = &(first_tok[ast->tokens.size()]);
+
+  // NOTE(pag): If we can't find the parsed tokens of some declaration, then
+  //            we can't know which unit should own them, so fall back on
+  //            aligning the whole translation unit at once.
+  std::vector<AlignmentUnit> units;
+  if (align_whole_tu) {
+    units.push_back({{tu}, first_tok, after_last_tok});
+
+  // Group the declarations into units. Every declaration belongs to exactly
+  // one unit, and the units, along with the gaps between them, cover every
+  // token of the translation unit, in order.
+  } else {
+    std::stable_sort(decl_units.begin(), decl_units.end(),
+                     [] (const AlignmentUnit &a, const AlignmentUnit &b) {
+                       return a.first < b.first;
+                     });
+
+    const TokenImpl *next_tok = first_tok;
+    for (AlignmentUnit &decl_unit : decl_units) {
+      if (!units.empty() && decl_unit.first < units.back().after_last) {
+        AlignmentUnit &unit = units.back();
+        unit.decls.push_back(decl_unit.decls.front());
+        unit.after_last = std::max(unit.after_last, decl_unit.after_last);
+        next_tok = unit.after_last;
+        continue;
+      }
+
+      if (next_tok < decl_unit.first) {
+        units.push_back({{}, next_tok, decl_unit.first});
+      }
+
+      next_tok = decl_unit.after_last;
+      units.push_back(std::move(decl_unit));
+    }
+
+    if (next_tok < after_last_tok) {
+      units.push_back({{}, next_tok, after_last_tok});
+    }
+  }
+
+  const size_t num_units = units.size();
+  std::vector<PrintedTokenRange> aligned_units(
+      num_units, PrintedTokenRange(nullptr, nullptr, nullptr));
+  std::vector<std::optional<std::string>> unit_errors(num_units);
+
+  auto align_unit = [&] (AlignmentSession &session, size_t i) {
+    const AlignmentUnit &unit = units[i];
+    TokenRange parsed(ast, unit.first, unit.after_last);
+    if (unit.decls.empty()) {
+      aligned_units[i] = PrintedTokenRange::Adopt(parsed);
+      return;
+    }
+
+    std::vector<PrintedTokenRange> printed_decls;
+    printed_decls.reserve(unit.decls.size());
+    for (clang::Decl *decl : unit.decls) {
+      printed_decls.emplace_back(PrintedTokenRange::Create(ast, decl, pp));
+    }
+
+    PrintedTokenRange printed = printed_decls.front();
+    if (1u < printed_decls.size()) {
+      printed = PrintedTokenRangeImpl::Concatenate(context, ast, printed_decls);
+    }
+
+    PrintedTokenRange adopted = PrintedTokenRange::Adopt(parsed);
+    if (auto err = session.Align(adopted, printed)) {
+      unit_errors[i] = std::move(err);
+      adopted = PrintedTokenRange::Adopt(parsed);  // Reset the contexts.
+    }
+
+    aligned_units[i] = std::move(adopted);
+  };
+
+  std::atomic<size_t> next_unit(0u);
+  auto worker = [&] (void) {
+    AlignmentSession session;
+    for (size_t i = next_unit++; i < num_units; i = next_unit++) {
+      align_unit(session, i);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  const auto num_workers = std::min<size_t>(std::max(1u, num_threads),
+                                            num_units);
+  for (size_t i = 1u; i < num_workers; ++i) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+
+  if (errors) {
+    for (std::optional<std::string> &err : unit_errors) {
+      if (err) {
+        errors->emplace_back(std::move(err.value()));
+      }
+    }
+  }
+
+  return PrintedTokenRangeImpl::Concatenate(context, ast, aligned_units);
+}
+
 }  // namespace pasta
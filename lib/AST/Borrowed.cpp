@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#include <pasta/AST/Borrowed.h>
+
+#include <cassert>
+#include <limits>
+
+#include "AST.h"
+#include "Token.h"
+
+namespace pasta {
+namespace detail {
+
+// Returns a `std::shared_ptr` that shares ownership of `ast`.
+std::shared_ptr<ASTImpl> OwnedAST(const ASTImpl *ast) {
+  return const_cast<ASTImpl *>(ast)->shared_from_this();
+}
+
+}  // namespace detail
+namespace {
+
+// Returns a `std::shared_ptr` that points to `ast` but doesn't own it. This
+// uses the aliasing constructor with an empty owner, and so copies of the
+// returned pointer never touch a reference count.
+//
+// NOTE(pag): This is only for the short-lived owning-typed handles used to
+//            implement the accessors of borrowed handles. Nothing keeps the
+//            AST alive through these handles, and so none of them, nor any
+//            handles returned by their accessors, may escape this file, other
+//            than by being converted into borrowed handles.
+static std::shared_ptr<ASTImpl> UnownedAST(const ASTImpl *ast) noexcept {
+  return std::shared_ptr<ASTImpl>(std::shared_ptr<ASTImpl>(),
+                                  const_cast<ASTImpl *>(ast));
+}
+
+}  // namespace
+
+BorrowedDecl::operator Decl(void) const {
+  return Decl(detail::OwnedAST(ast), decl);
+}
+
+DeclKind BorrowedDecl::Kind(void) const {
+  return Decl(UnownedAST(ast), decl).Kind();
+}
+
+std::string_view BorrowedDecl::KindName(void) const {
+  return Decl(UnownedAST(ast), decl).KindName();
+}
+
+BorrowedToken BorrowedDecl::Token(void) const {
+  return BorrowedToken(Decl(UnownedAST(ast), decl).Token());
+}
+
+BorrowedTokenRange BorrowedDecl::Tokens(void) const {
+  return BorrowedTokenRange(Decl(UnownedAST(ast), decl).Tokens());
+}
+
+BorrowedStmt::operator Stmt(void) const {
+  return Stmt(detail::OwnedAST(ast), stmt);
+}
+
+StmtKind BorrowedStmt::Kind(void) const {
+  return Stmt(UnownedAST(ast), stmt).Kind();
+}
+
+std::string_view BorrowedStmt::KindName(void) const {
+  return Stmt(UnownedAST(ast), stmt).KindName();
+}
+
+std::vector<BorrowedStmt> BorrowedStmt::Children(void) const {
+  std::vector<BorrowedStmt> children;
+  for (const Stmt &child : Stmt(UnownedAST(ast), stmt).Children()) {
+    children.emplace_back(child);
+  }
+  return children;
+}
+
+BorrowedToken BorrowedStmt::BeginToken(void) const {
+  return BorrowedToken(Stmt(UnownedAST(ast), stmt).BeginToken());
+}
+
+BorrowedToken BorrowedStmt::EndToken(void) const {
+  return BorrowedToken(Stmt(UnownedAST(ast), stmt).EndToken());
+}
+
+BorrowedTokenRange BorrowedStmt::Tokens(void) const {
+  return BorrowedTokenRange(Stmt(UnownedAST(ast), stmt).Tokens());
+}
+
+BorrowedType::operator Type(void) const {
+  return Type(detail::OwnedAST(ast), type, kind, qualifiers);
+}
+
+std::string_view BorrowedType::KindName(void) const {
+  return Type(UnownedAST(ast), type, kind, qualifiers).KindName();
+}
+
+BorrowedToken::operator Token(void) const {
+  return Token(detail::OwnedAST(ast), impl);
+}
+
+std::string_view BorrowedToken::Data(void) const {
+  return Token(UnownedAST(ast), impl).Data();
+}
+
+uint64_t BorrowedToken::Index(void) const {
+  return Token(UnownedAST(ast), impl).Index();
+}
+
+TokenKind BorrowedToken::Kind(void) const noexcept {
+  return Token(UnownedAST(ast), impl).Kind();
+}
+
+TokenRole BorrowedToken::Role(void) const noexcept {
+  return Token(UnownedAST(ast), impl).Role();
+}
+
+const char *BorrowedToken::KindName(void) const noexcept {
+  return Token(UnownedAST(ast), impl).KindName();
+}
+
+unsigned BorrowedToken::DerivationDepth(void) const noexcept {
+  return Token(UnownedAST(ast), impl).DerivationDepth();
+}
+
+BorrowedTokenRange::BorrowedTokenRange(const TokenRange &that) noexcept
+    : ast(that.ast.get()),
+      first(0u),
+      after_last(0u) {
+  if (ast && that.first < that.after_last) {
+    const TokenImpl *tokens = ast->tokens.data();
+    assert(tokens <= that.first);
+    assert(that.after_last <= &(tokens[ast->tokens.size()]));
+    assert(ast->tokens.size() <= std::numeric_limits<uint32_t>::max());
+    first = static_cast<uint32_t>(that.first - tokens);
+    after_last = static_cast<uint32_t>(that.after_last - tokens);
+  }
+}
+
+BorrowedTokenRange::operator TokenRange(void) const {
+  if (!ast) {
+    return TokenRange(std::shared_ptr<ASTImpl>());
+  }
+  const TokenImpl *tokens = ast->tokens.data();
+  return TokenRange(detail::OwnedAST(ast), &(tokens[first]),
+                    &(tokens[after_last]));
+}
+
+BorrowedToken BorrowedTokenRange::operator[](size_t index) const noexcept {
+  assert((first + index) < after_last);
+  return BorrowedToken(ast, &(ast->tokens.data()[first + index]));
+}
+
+BorrowedMacro::operator Macro(void) const {
+  return Macro(detail::OwnedAST(ast), impl);
+}
+
+MacroKind BorrowedMacro::Kind(void) const noexcept {
+  return Macro(UnownedAST(ast), impl).Kind();
+}
+
+std::string_view BorrowedMacro::KindName(void) const noexcept {
+  return Macro(UnownedAST(ast), impl).KindName();
+}
+
+}  // namespace pasta
@@ -4,8 +4,11 @@
 
 #pragma once
 
+#include <cstring>
 #include <type_traits>
 
+#include <pasta/AST/LazyRange.h>
+
 #include "AST.h"
 
 namespace pasta {
@@ -72,4 +75,70 @@ class TypeBuilder {
 #endif
 };
 
+// Adapts an underlying Clang range of entity pointers into a `LazyRange`.
+// Null pointers in the underlying range are skipped, and the rest are
+// converted into `T`s using `EntityBuilder` (e.g. `DeclBuilder`).
+class LazyRangeBuilder {
+ private:
+  template <typename T, typename EntityBuilder, typename It>
+  struct Adaptor {
+    static_assert(sizeof(It) <= sizeof(detail::LazyRangeCursor));
+    static_assert(alignof(It) <= alignof(detail::LazyRangeCursor));
+    static_assert(std::is_trivially_copyable_v<It>);
+
+    static It Load(const detail::LazyRangeCursor &cursor) {
+      It it;
+      memcpy(reinterpret_cast<void *>(&it), cursor.words, sizeof(It));
+      return it;
+    }
+
+    static detail::LazyRangeCursor Store(const It &it) {
+      detail::LazyRangeCursor cursor = {};
+      memcpy(cursor.words, reinterpret_cast<const void *>(&it), sizeof(It));
+      return cursor;
+    }
+
+    static void SkipNulls(It &it, const It &end) {
+      while (it != end && !*it) {
+        ++it;
+      }
+    }
+
+    static void Advance(detail::LazyRangeCursor &cursor,
+                        const detail::LazyRangeCursor &end_cursor) {
+      It it = Load(cursor);
+      It end = Load(end_cursor);
+      ++it;
+      SkipNulls(it, end);
+      cursor = Store(it);
+    }
+
+    static bool Equal(const detail::LazyRangeCursor &a,
+                      const detail::LazyRangeCursor &b) {
+      return Load(a) == Load(b);
+    }
+
+    static T Dereference(const std::shared_ptr<ASTImpl> &ast,
+                         const detail::LazyRangeCursor &cursor) {
+      return EntityBuilder::template Create<T>(ast, *Load(cursor));
+    }
+
+    static constexpr detail::LazyRangeOps<T> kOps = {
+        Advance, Equal, Dereference};
+  };
+
+ public:
+  template <typename T, typename EntityBuilder, typename Range>
+  inline static LazyRange<T> Create(std::shared_ptr<ASTImpl> ast_,
+                                    Range &&range) {
+    using It = std::decay_t<decltype(range.begin())>;
+    using A = Adaptor<T, EntityBuilder, It>;
+    It it = range.begin();
+    It end = range.end();
+    A::SkipNulls(it, end);
+    return LazyRange<T>(std::move(ast_), &(A::kOps), A::Store(it),
+                        A::Store(end));
+  }
+};
+
 }  // namespace pasta
@@ -35,7 +35,16 @@ using OMPDeclarativeDirectiveValueDecl = OMPDeclarativeDirective<ValueDecl>;
 
 #define PASTA_DEFINE_BASE_OPERATORS(base, derived) \
     std::optional<class derived> derived::From(const class base &that) { \
-      if (auto decl_ptr = clang::dyn_cast_or_null<clang::derived>(that.u.base)) { \
+      if (that.Is<class derived>()) { \
+        return DeclBuilder::Create<class derived>(that.ast, that.u.Decl); \
+      } else { \
+        return std::nullopt; \
+      } \
+    }
+
+#define PASTA_DEFINE_DECL_CONTEXT_BASE_OPERATORS(derived) \
+    std::optional<class derived> derived::From(const class DeclContext &that) { \
+      if (auto decl_ptr = clang::dyn_cast_or_null<clang::derived>(that.u.DeclContext)) { \
         return DeclBuilder::Create<class derived>(that.ast, decl_ptr); \
       } else { \
         return std::nullopt; \
@@ -602,16 +611,10 @@ std::string_view Decl::KindName(void) const noexcept {
 // 1: DeclContext::ContainsDeclaration
 // 1: DeclContext::ContainsDeclarationAndLoad
 // 0: DeclContext::Ddiags
-std::vector<::pasta::Decl> DeclContext::Declarations(void) const {
+::pasta::LazyRange<::pasta::Decl> DeclContext::Declarations(void) const {
   auto &self = *const_cast<clang::DeclContext *>(u.DeclContext);
   decltype(auto) val = self.decls();
-  std::vector<::pasta::Decl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::Decl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Decl, DeclBuilder>(ast, val);
 }
 
 // 0: DeclContext::
@@ -858,16 +861,10 @@ bool DeclContext::IsTransparentContext(void) const {
 // 0: DeclContext::Lookups
 // 0: DeclContext::
 // 0: DeclContext::
-std::vector<::pasta::Decl> DeclContext::AlreadyLoadedDeclarations(void) const {
+::pasta::LazyRange<::pasta::Decl> DeclContext::AlreadyLoadedDeclarations(void) const {
   auto &self = *const_cast<clang::DeclContext *>(u.DeclContext);
   decltype(auto) val = self.noload_decls();
-  std::vector<::pasta::Decl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::Decl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Decl, DeclBuilder>(ast, val);
 }
 
 // 0: DeclContext::
@@ -1488,16 +1485,10 @@ bool Decl::IsWeakImported(void) const {
   return val;
 }
 
-std::vector<::pasta::Decl> Decl::Redeclarations(void) const {
+::pasta::LazyRange<::pasta::Decl> Decl::Redeclarations(void) const {
   auto &self = *const_cast<clang::Decl *>(u.Decl);
   decltype(auto) val = self.redecls();
-  std::vector<::pasta::Decl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::Decl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Decl, DeclBuilder>(ast, val);
 }
 
 // 0: Decl::
@@ -1513,7 +1504,7 @@ ExportDecl::ExportDecl(
     const ::clang::Decl *decl_)
     : Decl(ast_, decl_) {}
 
-PASTA_DEFINE_BASE_OPERATORS(DeclContext, ExportDecl)
+PASTA_DEFINE_DECL_CONTEXT_BASE_OPERATORS(ExportDecl)
 PASTA_DEFINE_BASE_OPERATORS(Decl, ExportDecl)
 ::pasta::Token ExportDecl::EndToken(void) const {
   auto &self = *const_cast<clang::ExportDecl *>(u.ExportDecl);
@@ -1544,7 +1535,7 @@ ExternCContextDecl::ExternCContextDecl(
     const ::clang::Decl *decl_)
     : Decl(ast_, decl_) {}
 
-PASTA_DEFINE_BASE_OPERATORS(DeclContext, ExternCContextDecl)
+PASTA_DEFINE_DECL_CONTEXT_BASE_OPERATORS(ExternCContextDecl)
 PASTA_DEFINE_BASE_OPERATORS(Decl, ExternCContextDecl)
 FileScopeAsmDecl::FileScopeAsmDecl(
     std::shared_ptr<ASTImpl> ast_,
@@ -1721,16 +1712,10 @@ LifetimeExtendedTemporaryDecl::LifetimeExtendedTemporaryDecl(
     : Decl(std::move(ast_), decl_) {}
 
 PASTA_DEFINE_BASE_OPERATORS(Decl, LifetimeExtendedTemporaryDecl)
-std::vector<::pasta::Stmt> LifetimeExtendedTemporaryDecl::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> LifetimeExtendedTemporaryDecl::Children(void) const {
   auto &self = *const_cast<clang::LifetimeExtendedTemporaryDecl *>(u.LifetimeExtendedTemporaryDecl);
   decltype(auto) val = self.childrenExpr();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::ValueDecl LifetimeExtendedTemporaryDecl::ExtendingDeclaration(void) const {
@@ -1770,7 +1755,7 @@ LinkageSpecDecl::LinkageSpecDecl(
     const ::clang::Decl *decl_)
     : Decl(ast_, decl_) {}
 
-PASTA_DEFINE_BASE_OPERATORS(DeclContext, LinkageSpecDecl)
+PASTA_DEFINE_DECL_CONTEXT_BASE_OPERATORS(LinkageSpecDecl)
 PASTA_DEFINE_BASE_OPERATORS(Decl, LinkageSpecDecl)
 ::pasta::Token LinkageSpecDecl::EndToken(void) const {
   auto &self = *const_cast<clang::LinkageSpecDecl *>(u.LinkageSpecDecl);
@@ -2058,7 +2043,7 @@ NamespaceDecl::NamespaceDecl(
     const ::clang::Decl *decl_)
     : NamedDecl(ast_, decl_) {}
 
-PASTA_DEFINE_BASE_OPERATORS(DeclContext, NamespaceDecl)
+PASTA_DEFINE_DECL_CONTEXT_BASE_OPERATORS(NamespaceDecl)
 PASTA_DEFINE_BASE_OPERATORS(Decl, NamespaceDecl)
 PASTA_DEFINE_BASE_OPERATORS(NamedDecl, NamespaceDecl)
 std::optional<::pasta::NamespaceDecl> NamespaceDecl::AnonymousNamespace(void) const {
@@ -2148,7 +2133,7 @@ ObjCContainerDecl::ObjCContainerDecl(
     const ::clang::Decl *decl_)
     : NamedDecl(ast_, decl_) {}
 
-PASTA_DEFINE_BASE_OPERATORS(DeclContext, ObjCContainerDecl)
+PASTA_DEFINE_DECL_CONTEXT_BASE_OPERATORS(ObjCContainerDecl)
 PASTA_DEFINE_BASE_OPERATORS(Decl, ObjCContainerDecl)
 PASTA_DEFINE_BASE_OPERATORS(NamedDecl, ObjCContainerDecl)
 PASTA_DEFINE_DERIVED_OPERATORS(ObjCContainerDecl, ObjCCategoryDecl)
@@ -2159,28 +2144,16 @@ PASTA_DEFINE_DERIVED_OPERATORS(ObjCContainerDecl, ObjCInterfaceDecl)
 PASTA_DEFINE_DERIVED_OPERATORS(ObjCContainerDecl, ObjCProtocolDecl)
 // 2: FindPropertyDeclaration
 // 1: ObjCContainerDecl::HasUserDeclaredSetterMethod
-std::vector<::pasta::ObjCMethodDecl> ObjCContainerDecl::ClassMethods(void) const {
+::pasta::LazyRange<::pasta::ObjCMethodDecl> ObjCContainerDecl::ClassMethods(void) const {
   auto &self = *const_cast<clang::ObjCContainerDecl *>(u.ObjCContainerDecl);
   decltype(auto) val = self.class_methods();
-  std::vector<::pasta::ObjCMethodDecl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::ObjCMethodDecl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::ObjCMethodDecl, DeclBuilder>(ast, val);
 }
 
-std::vector<::pasta::ObjCPropertyDecl> ObjCContainerDecl::ClassProperties(void) const {
+::pasta::LazyRange<::pasta::ObjCPropertyDecl> ObjCContainerDecl::ClassProperties(void) const {
   auto &self = *const_cast<clang::ObjCContainerDecl *>(u.ObjCContainerDecl);
   decltype(auto) val = self.class_properties();
-  std::vector<::pasta::ObjCPropertyDecl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::ObjCPropertyDecl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::ObjCPropertyDecl, DeclBuilder>(ast, val);
 }
 
 // 0: ObjCContainerDecl::
@@ -2204,28 +2177,16 @@ std::vector<::pasta::ObjCPropertyDecl> ObjCContainerDecl::ClassProperties(void)
 // 1: ObjCContainerDecl::InstanceVariableDeclaration
 // 2: Method
 // 2: Property
-std::vector<::pasta::ObjCMethodDecl> ObjCContainerDecl::InstanceMethods(void) const {
+::pasta::LazyRange<::pasta::ObjCMethodDecl> ObjCContainerDecl::InstanceMethods(void) const {
   auto &self = *const_cast<clang::ObjCContainerDecl *>(u.ObjCContainerDecl);
   decltype(auto) val = self.instance_methods();
-  std::vector<::pasta::ObjCMethodDecl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::ObjCMethodDecl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::ObjCMethodDecl, DeclBuilder>(ast, val);
 }
 
-std::vector<::pasta::ObjCPropertyDecl> ObjCContainerDecl::InstanceProperties(void) const {
+::pasta::LazyRange<::pasta::ObjCPropertyDecl> ObjCContainerDecl::InstanceProperties(void) const {
   auto &self = *const_cast<clang::ObjCContainerDecl *>(u.ObjCContainerDecl);
   decltype(auto) val = self.instance_properties();
-  std::vector<::pasta::ObjCPropertyDecl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::ObjCPropertyDecl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::ObjCPropertyDecl, DeclBuilder>(ast, val);
 }
 
 // 0: ObjCContainerDecl::
@@ -2234,30 +2195,18 @@ std::vector<::pasta::ObjCPropertyDecl> ObjCContainerDecl::InstanceProperties(voi
 // 0: ObjCContainerDecl::
 // 0: ObjCContainerDecl::
 // 0: ObjCContainerDecl::
-std::vector<::pasta::ObjCMethodDecl> ObjCContainerDecl::Methods(void) const {
+::pasta::LazyRange<::pasta::ObjCMethodDecl> ObjCContainerDecl::Methods(void) const {
   auto &self = *const_cast<clang::ObjCContainerDecl *>(u.ObjCContainerDecl);
   decltype(auto) val = self.methods();
-  std::vector<::pasta::ObjCMethodDecl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::ObjCMethodDecl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::ObjCMethodDecl, DeclBuilder>(ast, val);
 }
 
 // 0: ObjCContainerDecl::
 // 0: ObjCContainerDecl::
-std::vector<::pasta::ObjCPropertyDecl> ObjCContainerDecl::Properties(void) const {
+::pasta::LazyRange<::pasta::ObjCPropertyDecl> ObjCContainerDecl::Properties(void) const {
   auto &self = *const_cast<clang::ObjCContainerDecl *>(u.ObjCContainerDecl);
   decltype(auto) val = self.properties();
-  std::vector<::pasta::ObjCPropertyDecl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::ObjCPropertyDecl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::ObjCPropertyDecl, DeclBuilder>(ast, val);
 }
 
 ObjCImplDecl::ObjCImplDecl(
@@ -2265,7 +2214,7 @@ ObjCImplDecl::ObjCImplDecl(
     const ::clang::Decl *decl_)
     : ObjCContainerDecl(std::move(ast_), decl_) {}
 
-PASTA_DEFINE_BASE_OPERATORS(DeclContext, ObjCImplDecl)
+PASTA_DEFINE_DECL_CONTEXT_BASE_OPERATORS(ObjCImplDecl)
 PASTA_DEFINE_BASE_OPERATORS(Decl, ObjCImplDecl)
 PASTA_DEFINE_BASE_OPERATORS(NamedDecl, ObjCImplDecl)
 PASTA_DEFINE_BASE_OPERATORS(ObjCContainerDecl, ObjCImplDecl)
@@ -2282,16 +2231,10 @@ PASTA_DEFINE_DERIVED_OPERATORS(ObjCImplDecl, ObjCImplementationDecl)
   throw std::runtime_error("ObjCImplDecl::ClassInterface can return nullptr!");
 }
 
-std::vector<::pasta::ObjCPropertyImplDecl> ObjCImplDecl::PropertyImplementations(void) const {
+::pasta::LazyRange<::pasta::ObjCPropertyImplDecl> ObjCImplDecl::PropertyImplementations(void) const {
   auto &self = *const_cast<clang::ObjCImplDecl *>(u.ObjCImplDecl);
   decltype(auto) val = self.property_impls();
-  std::vector<::pasta::ObjCPropertyImplDecl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::ObjCPropertyImplDecl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::ObjCPropertyImplDecl, DeclBuilder>(ast, val);
 }
 
 // 0: ObjCImplDecl::
@@ -2301,7 +2244,7 @@ ObjCImplementationDecl::ObjCImplementationDecl(
     const ::clang::Decl *decl_)
     : ObjCImplDecl(std::move(ast_), decl_) {}
 
-PASTA_DEFINE_BASE_OPERATORS(DeclContext, ObjCImplementationDecl)
+PASTA_DEFINE_DECL_CONTEXT_BASE_OPERATORS(ObjCImplementationDecl)
 PASTA_DEFINE_BASE_OPERATORS(Decl, ObjCImplementationDecl)
 PASTA_DEFINE_BASE_OPERATORS(NamedDecl, ObjCImplementationDecl)
 PASTA_DEFINE_BASE_OPERATORS(ObjCContainerDecl, ObjCImplementationDecl)
@@ -2375,16 +2318,10 @@ bool ObjCImplementationDecl::HasNonZeroConstructors(void) const {
 // 0: ObjCImplementationDecl::
 // 0: ObjCImplementationDecl::
 // 0: ObjCImplementationDecl::
-std::vector<::pasta::ObjCIvarDecl> ObjCImplementationDecl::InstanceVariables(void) const {
+::pasta::LazyRange<::pasta::ObjCIvarDecl> ObjCImplementationDecl::InstanceVariables(void) const {
   auto &self = *const_cast<clang::ObjCImplementationDecl *>(u.ObjCImplementationDecl);
   decltype(auto) val = self.ivars();
-  std::vector<::pasta::ObjCIvarDecl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::ObjCIvarDecl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::ObjCIvarDecl, DeclBuilder>(ast, val);
 }
 
 ObjCInterfaceDecl::ObjCInterfaceDecl(
@@ -2392,7 +2329,7 @@ ObjCInterfaceDecl::ObjCInterfaceDecl(
     const ::clang::Decl *decl_)
     : ObjCContainerDecl(std::move(ast_), decl_) {}
 
-PASTA_DEFINE_BASE_OPERATORS(DeclContext, ObjCInterfaceDecl)
+PASTA_DEFINE_DECL_CONTEXT_BASE_OPERATORS(ObjCInterfaceDecl)
 PASTA_DEFINE_BASE_OPERATORS(Decl, ObjCInterfaceDecl)
 PASTA_DEFINE_BASE_OPERATORS(NamedDecl, ObjCInterfaceDecl)
 PASTA_DEFINE_BASE_OPERATORS(ObjCContainerDecl, ObjCInterfaceDecl)
@@ -2401,16 +2338,10 @@ PASTA_DEFINE_BASE_OPERATORS(ObjCContainerDecl, ObjCInterfaceDecl)
 // 0: ObjCInterfaceDecl::
 // 0: ObjCInterfaceDecl::
 // 0: ObjCInterfaceDecl::
-std::vector<::pasta::ObjCProtocolDecl> ObjCInterfaceDecl::AllReferencedProtocols(void) const {
+::pasta::LazyRange<::pasta::ObjCProtocolDecl> ObjCInterfaceDecl::AllReferencedProtocols(void) const {
   auto &self = *const_cast<clang::ObjCInterfaceDecl *>(u.ObjCInterfaceDecl);
   decltype(auto) val = self.all_referenced_protocols();
-  std::vector<::pasta::ObjCProtocolDecl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::ObjCProtocolDecl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::ObjCProtocolDecl, DeclBuilder>(ast, val);
 }
 
 bool ObjCInterfaceDecl::DeclaresOrInheritsDesignatedInitializers(void) const {
@@ -2570,43 +2501,25 @@ bool ObjCInterfaceDecl::IsThisDeclarationADefinition(void) const {
 // 0: ObjCInterfaceDecl::
 // 0: ObjCInterfaceDecl::
 // 0: ObjCInterfaceDecl::
-std::vector<::pasta::ObjCIvarDecl> ObjCInterfaceDecl::InstanceVariables(void) const {
+::pasta::LazyRange<::pasta::ObjCIvarDecl> ObjCInterfaceDecl::InstanceVariables(void) const {
   auto &self = *const_cast<clang::ObjCInterfaceDecl *>(u.ObjCInterfaceDecl);
   decltype(auto) val = self.ivars();
-  std::vector<::pasta::ObjCIvarDecl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::ObjCIvarDecl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::ObjCIvarDecl, DeclBuilder>(ast, val);
 }
 
-std::vector<::pasta::ObjCCategoryDecl> ObjCInterfaceDecl::KnownCategories(void) const {
+::pasta::LazyRange<::pasta::ObjCCategoryDecl> ObjCInterfaceDecl::KnownCategories(void) const {
   auto &self = *const_cast<clang::ObjCInterfaceDecl *>(u.ObjCInterfaceDecl);
   decltype(auto) val = self.known_categories();
-  std::vector<::pasta::ObjCCategoryDecl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::ObjCCategoryDecl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::ObjCCategoryDecl, DeclBuilder>(ast, val);
 }
 
 // 0: ObjCInterfaceDecl::
 // 0: ObjCInterfaceDecl::
 // 0: ObjCInterfaceDecl::
-std::vector<::pasta::ObjCCategoryDecl> ObjCInterfaceDecl::KnownExtensions(void) const {
+::pasta::LazyRange<::pasta::ObjCCategoryDecl> ObjCInterfaceDecl::KnownExtensions(void) const {
   auto &self = *const_cast<clang::ObjCInterfaceDecl *>(u.ObjCInterfaceDecl);
   decltype(auto) val = self.known_extensions();
-  std::vector<::pasta::ObjCCategoryDecl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::ObjCCategoryDecl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::ObjCCategoryDecl, DeclBuilder>(ast, val);
 }
 
 // 0: ObjCInterfaceDecl::
@@ -2633,43 +2546,25 @@ std::vector<::pasta::Token> ObjCInterfaceDecl::ProtocolTokens(void) const {
   return ret;
 }
 
-std::vector<::pasta::ObjCProtocolDecl> ObjCInterfaceDecl::Protocols(void) const {
+::pasta::LazyRange<::pasta::ObjCProtocolDecl> ObjCInterfaceDecl::Protocols(void) const {
   auto &self = *const_cast<clang::ObjCInterfaceDecl *>(u.ObjCInterfaceDecl);
   decltype(auto) val = self.protocols();
-  std::vector<::pasta::ObjCProtocolDecl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::ObjCProtocolDecl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::ObjCProtocolDecl, DeclBuilder>(ast, val);
 }
 
-std::vector<::pasta::ObjCCategoryDecl> ObjCInterfaceDecl::VisibleCategories(void) const {
+::pasta::LazyRange<::pasta::ObjCCategoryDecl> ObjCInterfaceDecl::VisibleCategories(void) const {
   auto &self = *const_cast<clang::ObjCInterfaceDecl *>(u.ObjCInterfaceDecl);
   decltype(auto) val = self.visible_categories();
-  std::vector<::pasta::ObjCCategoryDecl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::ObjCCategoryDecl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::ObjCCategoryDecl, DeclBuilder>(ast, val);
 }
 
 // 0: ObjCInterfaceDecl::
 // 0: ObjCInterfaceDecl::
 // 0: ObjCInterfaceDecl::
-std::vector<::pasta::ObjCCategoryDecl> ObjCInterfaceDecl::VisibleExtensions(void) const {
+::pasta::LazyRange<::pasta::ObjCCategoryDecl> ObjCInterfaceDecl::VisibleExtensions(void) const {
   auto &self = *const_cast<clang::ObjCInterfaceDecl *>(u.ObjCInterfaceDecl);
   decltype(auto) val = self.visible_extensions();
-  std::vector<::pasta::ObjCCategoryDecl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::ObjCCategoryDecl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::ObjCCategoryDecl, DeclBuilder>(ast, val);
 }
 
 // 0: ObjCInterfaceDecl::
@@ -2680,7 +2575,7 @@ ObjCMethodDecl::ObjCMethodDecl(
     const ::clang::Decl *decl_)
     : NamedDecl(ast_, decl_) {}
 
-PASTA_DEFINE_BASE_OPERATORS(DeclContext, ObjCMethodDecl)
+PASTA_DEFINE_DECL_CONTEXT_BASE_OPERATORS(ObjCMethodDecl)
 PASTA_DEFINE_BASE_OPERATORS(Decl, ObjCMethodDecl)
 PASTA_DEFINE_BASE_OPERATORS(NamedDecl, ObjCMethodDecl)
 bool ObjCMethodDecl::DefinedInNSObject(void) const {
@@ -2916,16 +2811,10 @@ bool ObjCMethodDecl::IsVariadic(void) const {
 // 0: ObjCMethodDecl::
 // 0: ObjCMethodDecl::
 // 0: ObjCMethodDecl::
-std::vector<::pasta::ParmVarDecl> ObjCMethodDecl::Parameters(void) const {
+::pasta::LazyRange<::pasta::ParmVarDecl> ObjCMethodDecl::Parameters(void) const {
   auto &self = *const_cast<clang::ObjCMethodDecl *>(u.ObjCMethodDecl);
   decltype(auto) val = self.parameters();
-  std::vector<::pasta::ParmVarDecl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::ParmVarDecl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::ParmVarDecl, DeclBuilder>(ast, val);
 }
 
 // 0: ObjCMethodDecl::
@@ -3163,7 +3052,7 @@ ObjCProtocolDecl::ObjCProtocolDecl(
     const ::clang::Decl *decl_)
     : ObjCContainerDecl(std::move(ast_), decl_) {}
 
-PASTA_DEFINE_BASE_OPERATORS(DeclContext, ObjCProtocolDecl)
+PASTA_DEFINE_DECL_CONTEXT_BASE_OPERATORS(ObjCProtocolDecl)
 PASTA_DEFINE_BASE_OPERATORS(Decl, ObjCProtocolDecl)
 PASTA_DEFINE_BASE_OPERATORS(NamedDecl, ObjCProtocolDecl)
 PASTA_DEFINE_BASE_OPERATORS(ObjCContainerDecl, ObjCProtocolDecl)
@@ -3236,16 +3125,10 @@ std::vector<::pasta::Token> ObjCProtocolDecl::ProtocolTokens(void) const {
 }
 
 // 0: ObjCProtocolDecl::
-std::vector<::pasta::ObjCProtocolDecl> ObjCProtocolDecl::Protocols(void) const {
+::pasta::LazyRange<::pasta::ObjCProtocolDecl> ObjCProtocolDecl::Protocols(void) const {
   auto &self = *const_cast<clang::ObjCProtocolDecl *>(u.ObjCProtocolDecl);
   decltype(auto) val = self.protocols();
-  std::vector<::pasta::ObjCProtocolDecl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::ObjCProtocolDecl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::ObjCProtocolDecl, DeclBuilder>(ast, val);
 }
 
 PragmaCommentDecl::PragmaCommentDecl(
@@ -3301,7 +3184,7 @@ RequiresExprBodyDecl::RequiresExprBodyDecl(
     const ::clang::Decl *decl_)
     : Decl(ast_, decl_) {}
 
-PASTA_DEFINE_BASE_OPERATORS(DeclContext, RequiresExprBodyDecl)
+PASTA_DEFINE_DECL_CONTEXT_BASE_OPERATORS(RequiresExprBodyDecl)
 PASTA_DEFINE_BASE_OPERATORS(Decl, RequiresExprBodyDecl)
 StaticAssertDecl::StaticAssertDecl(
     std::shared_ptr<ASTImpl> ast_,
@@ -3465,7 +3348,7 @@ TranslationUnitDecl::TranslationUnitDecl(
     const ::clang::Decl *decl_)
     : Decl(ast_, decl_) {}
 
-PASTA_DEFINE_BASE_OPERATORS(DeclContext, TranslationUnitDecl)
+PASTA_DEFINE_DECL_CONTEXT_BASE_OPERATORS(TranslationUnitDecl)
 PASTA_DEFINE_BASE_OPERATORS(Decl, TranslationUnitDecl)
 // 0: TranslationUnitDecl::ASTContext
 std::optional<::pasta::NamespaceDecl> TranslationUnitDecl::AnonymousNamespace(void) const {
@@ -3678,16 +3561,10 @@ UsingPackDecl::UsingPackDecl(
 
 PASTA_DEFINE_BASE_OPERATORS(Decl, UsingPackDecl)
 PASTA_DEFINE_BASE_OPERATORS(NamedDecl, UsingPackDecl)
-std::vector<::pasta::NamedDecl> UsingPackDecl::Expansions(void) const {
+::pasta::LazyRange<::pasta::NamedDecl> UsingPackDecl::Expansions(void) const {
   auto &self = *const_cast<clang::UsingPackDecl *>(u.UsingPackDecl);
   decltype(auto) val = self.expansions();
-  std::vector<::pasta::NamedDecl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::NamedDecl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::NamedDecl, DeclBuilder>(ast, val);
 }
 
 ::pasta::UsingPackDecl UsingPackDecl::CanonicalDeclaration(void) const {
@@ -3912,16 +3789,10 @@ PASTA_DEFINE_DERIVED_OPERATORS(BaseUsingDecl, UsingEnumDecl)
 // 0: BaseUsingDecl::
 // 0: BaseUsingDecl::
 // 0: BaseUsingDecl::
-std::vector<::pasta::UsingShadowDecl> BaseUsingDecl::Shadows(void) const {
+::pasta::LazyRange<::pasta::UsingShadowDecl> BaseUsingDecl::Shadows(void) const {
   auto &self = *const_cast<clang::BaseUsingDecl *>(u.BaseUsingDecl);
   decltype(auto) val = self.shadows();
-  std::vector<::pasta::UsingShadowDecl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::UsingShadowDecl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::UsingShadowDecl, DeclBuilder>(ast, val);
 }
 
 BindingDecl::BindingDecl(
@@ -3964,7 +3835,7 @@ BlockDecl::BlockDecl(
     const ::clang::Decl *decl_)
     : Decl(ast_, decl_) {}
 
-PASTA_DEFINE_BASE_OPERATORS(DeclContext, BlockDecl)
+PASTA_DEFINE_DECL_CONTEXT_BASE_OPERATORS(BlockDecl)
 PASTA_DEFINE_BASE_OPERATORS(Decl, BlockDecl)
 bool BlockDecl::BlockMissingReturnType(void) const {
   auto &self = *const_cast<clang::BlockDecl *>(u.BlockDecl);
@@ -4068,16 +3939,10 @@ bool BlockDecl::IsVariadic(void) const {
 // 0: BlockDecl::
 // 0: BlockDecl::
 // 0: BlockDecl::
-std::vector<::pasta::ParmVarDecl> BlockDecl::Parameters(void) const {
+::pasta::LazyRange<::pasta::ParmVarDecl> BlockDecl::Parameters(void) const {
   auto &self = *const_cast<clang::BlockDecl *>(u.BlockDecl);
   decltype(auto) val = self.parameters();
-  std::vector<::pasta::ParmVarDecl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::ParmVarDecl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::ParmVarDecl, DeclBuilder>(ast, val);
 }
 
 std::vector<::pasta::ParmVarDecl> BlockDecl::ParameterDeclarations(void) const {
@@ -4110,7 +3975,7 @@ CapturedDecl::CapturedDecl(
     const ::clang::Decl *decl_)
     : Decl(ast_, decl_) {}
 
-PASTA_DEFINE_BASE_OPERATORS(DeclContext, CapturedDecl)
+PASTA_DEFINE_DECL_CONTEXT_BASE_OPERATORS(CapturedDecl)
 PASTA_DEFINE_BASE_OPERATORS(Decl, CapturedDecl)
 ::pasta::ImplicitParamDecl CapturedDecl::ContextParameter(void) const {
   auto &self = *const_cast<clang::CapturedDecl *>(u.CapturedDecl);
@@ -4142,16 +4007,10 @@ bool CapturedDecl::IsNothrow(void) const {
 
 // 0: CapturedDecl::
 // 0: CapturedDecl::
-std::vector<::pasta::ImplicitParamDecl> CapturedDecl::Parameters(void) const {
+::pasta::LazyRange<::pasta::ImplicitParamDecl> CapturedDecl::Parameters(void) const {
   auto &self = *const_cast<clang::CapturedDecl *>(u.CapturedDecl);
   decltype(auto) val = self.parameters();
-  std::vector<::pasta::ImplicitParamDecl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::ImplicitParamDecl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::ImplicitParamDecl, DeclBuilder>(ast, val);
 }
 
 ClassScopeFunctionSpecializationDecl::ClassScopeFunctionSpecializationDecl(
@@ -4565,7 +4424,7 @@ FunctionDecl::FunctionDecl(
     const ::clang::Decl *decl_)
     : DeclaratorDecl(ast_, decl_) {}
 
-PASTA_DEFINE_BASE_OPERATORS(DeclContext, FunctionDecl)
+PASTA_DEFINE_DECL_CONTEXT_BASE_OPERATORS(FunctionDecl)
 PASTA_DEFINE_BASE_OPERATORS(Decl, FunctionDecl)
 PASTA_DEFINE_BASE_OPERATORS(DeclaratorDecl, FunctionDecl)
 PASTA_DEFINE_BASE_OPERATORS(NamedDecl, FunctionDecl)
@@ -5176,16 +5035,10 @@ bool FunctionDecl::IsVirtualAsWritten(void) const {
 // 0: FunctionDecl::
 // 0: FunctionDecl::
 // 0: FunctionDecl::
-std::vector<::pasta::ParmVarDecl> FunctionDecl::Parameters(void) const {
+::pasta::LazyRange<::pasta::ParmVarDecl> FunctionDecl::Parameters(void) const {
   auto &self = *const_cast<clang::FunctionDecl *>(u.FunctionDecl);
   decltype(auto) val = self.parameters();
-  std::vector<::pasta::ParmVarDecl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::ParmVarDecl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::ParmVarDecl, DeclBuilder>(ast, val);
 }
 
 bool FunctionDecl::UsesSEHTry(void) const {
@@ -5248,7 +5101,7 @@ HLSLBufferDecl::HLSLBufferDecl(
     const ::clang::Decl *decl_)
     : NamedDecl(ast_, decl_) {}
 
-PASTA_DEFINE_BASE_OPERATORS(DeclContext, HLSLBufferDecl)
+PASTA_DEFINE_DECL_CONTEXT_BASE_OPERATORS(HLSLBufferDecl)
 PASTA_DEFINE_BASE_OPERATORS(Decl, HLSLBufferDecl)
 PASTA_DEFINE_BASE_OPERATORS(NamedDecl, HLSLBufferDecl)
 ::pasta::Token HLSLBufferDecl::LBraceToken(void) const {
@@ -5283,16 +5136,10 @@ IndirectFieldDecl::IndirectFieldDecl(
 PASTA_DEFINE_BASE_OPERATORS(Decl, IndirectFieldDecl)
 PASTA_DEFINE_BASE_OPERATORS(NamedDecl, IndirectFieldDecl)
 PASTA_DEFINE_BASE_OPERATORS(ValueDecl, IndirectFieldDecl)
-std::vector<::pasta::NamedDecl> IndirectFieldDecl::Chain(void) const {
+::pasta::LazyRange<::pasta::NamedDecl> IndirectFieldDecl::Chain(void) const {
   auto &self = *const_cast<clang::IndirectFieldDecl *>(u.IndirectFieldDecl);
   decltype(auto) val = self.chain();
-  std::vector<::pasta::NamedDecl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::NamedDecl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::NamedDecl, DeclBuilder>(ast, val);
 }
 
 // 0: IndirectFieldDecl::
@@ -5560,16 +5407,10 @@ PASTA_DEFINE_BASE_OPERATORS(OMPDeclarativeDirectiveDecl, OMPAllocateDecl)
 // 0: OMPAllocateDecl::
 // 0: OMPAllocateDecl::
 // 0: OMPAllocateDecl::
-std::vector<::pasta::Expr> OMPAllocateDecl::Varlists(void) const {
+::pasta::LazyRange<::pasta::Expr> OMPAllocateDecl::Varlists(void) const {
   auto &self = *const_cast<clang::OMPAllocateDecl *>(u.OMPAllocateDecl);
   decltype(auto) val = self.varlists();
-  std::vector<::pasta::Expr> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Expr>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Expr, StmtBuilder>(ast, val);
 }
 
 OMPDeclareMapperDecl::OMPDeclareMapperDecl(
@@ -5577,7 +5418,7 @@ OMPDeclareMapperDecl::OMPDeclareMapperDecl(
     const ::clang::Decl *decl_)
     : OMPDeclarativeDirectiveValueDecl(ast_, decl_) {}
 
-PASTA_DEFINE_BASE_OPERATORS(DeclContext, OMPDeclareMapperDecl)
+PASTA_DEFINE_DECL_CONTEXT_BASE_OPERATORS(OMPDeclareMapperDecl)
 PASTA_DEFINE_BASE_OPERATORS(Decl, OMPDeclareMapperDecl)
 PASTA_DEFINE_BASE_OPERATORS(NamedDecl, OMPDeclareMapperDecl)
 PASTA_DEFINE_BASE_OPERATORS(OMPDeclarativeDirectiveValueDecl, OMPDeclareMapperDecl)
@@ -5610,7 +5451,7 @@ OMPDeclareReductionDecl::OMPDeclareReductionDecl(
     const ::clang::Decl *decl_)
     : ValueDecl(ast_, decl_) {}
 
-PASTA_DEFINE_BASE_OPERATORS(DeclContext, OMPDeclareReductionDecl)
+PASTA_DEFINE_DECL_CONTEXT_BASE_OPERATORS(OMPDeclareReductionDecl)
 PASTA_DEFINE_BASE_OPERATORS(Decl, OMPDeclareReductionDecl)
 PASTA_DEFINE_BASE_OPERATORS(NamedDecl, OMPDeclareReductionDecl)
 PASTA_DEFINE_BASE_OPERATORS(ValueDecl, OMPDeclareReductionDecl)
@@ -5706,16 +5547,10 @@ PASTA_DEFINE_BASE_OPERATORS(OMPDeclarativeDirectiveDecl, OMPThreadPrivateDecl)
 // 0: OMPThreadPrivateDecl::
 // 0: OMPThreadPrivateDecl::
 // 0: OMPThreadPrivateDecl::
-std::vector<::pasta::Expr> OMPThreadPrivateDecl::Varlists(void) const {
+::pasta::LazyRange<::pasta::Expr> OMPThreadPrivateDecl::Varlists(void) const {
   auto &self = *const_cast<clang::OMPThreadPrivateDecl *>(u.OMPThreadPrivateDecl);
   decltype(auto) val = self.varlists();
-  std::vector<::pasta::Expr> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Expr>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Expr, StmtBuilder>(ast, val);
 }
 
 ObjCAtDefsFieldDecl::ObjCAtDefsFieldDecl(
@@ -5746,7 +5581,7 @@ ObjCCategoryDecl::ObjCCategoryDecl(
     const ::clang::Decl *decl_)
     : ObjCContainerDecl(std::move(ast_), decl_) {}
 
-PASTA_DEFINE_BASE_OPERATORS(DeclContext, ObjCCategoryDecl)
+PASTA_DEFINE_DECL_CONTEXT_BASE_OPERATORS(ObjCCategoryDecl)
 PASTA_DEFINE_BASE_OPERATORS(Decl, ObjCCategoryDecl)
 PASTA_DEFINE_BASE_OPERATORS(NamedDecl, ObjCCategoryDecl)
 PASTA_DEFINE_BASE_OPERATORS(ObjCContainerDecl, ObjCCategoryDecl)
@@ -5816,16 +5651,10 @@ bool ObjCCategoryDecl::IsClassExtension(void) const {
 // 0: ObjCCategoryDecl::
 // 0: ObjCCategoryDecl::
 // 0: ObjCCategoryDecl::
-std::vector<::pasta::ObjCIvarDecl> ObjCCategoryDecl::InstanceVariables(void) const {
+::pasta::LazyRange<::pasta::ObjCIvarDecl> ObjCCategoryDecl::InstanceVariables(void) const {
   auto &self = *const_cast<clang::ObjCCategoryDecl *>(u.ObjCCategoryDecl);
   decltype(auto) val = self.ivars();
-  std::vector<::pasta::ObjCIvarDecl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::ObjCIvarDecl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::ObjCIvarDecl, DeclBuilder>(ast, val);
 }
 
 // 0: ObjCCategoryDecl::
@@ -5845,16 +5674,10 @@ std::vector<::pasta::Token> ObjCCategoryDecl::ProtocolTokens(void) const {
 }
 
 // 0: ObjCCategoryDecl::
-std::vector<::pasta::ObjCProtocolDecl> ObjCCategoryDecl::Protocols(void) const {
+::pasta::LazyRange<::pasta::ObjCProtocolDecl> ObjCCategoryDecl::Protocols(void) const {
   auto &self = *const_cast<clang::ObjCCategoryDecl *>(u.ObjCCategoryDecl);
   decltype(auto) val = self.protocols();
-  std::vector<::pasta::ObjCProtocolDecl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::ObjCProtocolDecl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::ObjCProtocolDecl, DeclBuilder>(ast, val);
 }
 
 ObjCCategoryImplDecl::ObjCCategoryImplDecl(
@@ -5862,7 +5685,7 @@ ObjCCategoryImplDecl::ObjCCategoryImplDecl(
     const ::clang::Decl *decl_)
     : ObjCImplDecl(std::move(ast_), decl_) {}
 
-PASTA_DEFINE_BASE_OPERATORS(DeclContext, ObjCCategoryImplDecl)
+PASTA_DEFINE_DECL_CONTEXT_BASE_OPERATORS(ObjCCategoryImplDecl)
 PASTA_DEFINE_BASE_OPERATORS(Decl, ObjCCategoryImplDecl)
 PASTA_DEFINE_BASE_OPERATORS(NamedDecl, ObjCCategoryImplDecl)
 PASTA_DEFINE_BASE_OPERATORS(ObjCContainerDecl, ObjCCategoryImplDecl)
@@ -6033,7 +5856,7 @@ TagDecl::TagDecl(
     const ::clang::Decl *decl_)
     : TypeDecl(ast_, decl_) {}
 
-PASTA_DEFINE_BASE_OPERATORS(DeclContext, TagDecl)
+PASTA_DEFINE_DECL_CONTEXT_BASE_OPERATORS(TagDecl)
 PASTA_DEFINE_BASE_OPERATORS(Decl, TagDecl)
 PASTA_DEFINE_BASE_OPERATORS(NamedDecl, TagDecl)
 PASTA_DEFINE_BASE_OPERATORS(TypeDecl, TagDecl)
@@ -7010,16 +6833,10 @@ bool VarTemplateDecl::IsThisDeclarationADefinition(void) const {
 
 // 0: VarTemplateDecl::
 // 0: VarTemplateDecl::
-std::vector<::pasta::VarTemplateSpecializationDecl> VarTemplateDecl::Specializations(void) const {
+::pasta::LazyRange<::pasta::VarTemplateSpecializationDecl> VarTemplateDecl::Specializations(void) const {
   auto &self = *const_cast<clang::VarTemplateDecl *>(u.VarTemplateDecl);
   decltype(auto) val = self.specializations();
-  std::vector<::pasta::VarTemplateSpecializationDecl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::VarTemplateSpecializationDecl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::VarTemplateSpecializationDecl, DeclBuilder>(ast, val);
 }
 
 VarTemplateSpecializationDecl::VarTemplateSpecializationDecl(
@@ -7170,7 +6987,7 @@ CXXDeductionGuideDecl::CXXDeductionGuideDecl(
     const ::clang::Decl *decl_)
     : FunctionDecl(std::move(ast_), decl_) {}
 
-PASTA_DEFINE_BASE_OPERATORS(DeclContext, CXXDeductionGuideDecl)
+PASTA_DEFINE_DECL_CONTEXT_BASE_OPERATORS(CXXDeductionGuideDecl)
 PASTA_DEFINE_BASE_OPERATORS(Decl, CXXDeductionGuideDecl)
 PASTA_DEFINE_BASE_OPERATORS(DeclaratorDecl, CXXDeductionGuideDecl)
 PASTA_DEFINE_BASE_OPERATORS(FunctionDecl, CXXDeductionGuideDecl)
@@ -7243,7 +7060,7 @@ CXXMethodDecl::CXXMethodDecl(
     const ::clang::Decl *decl_)
     : FunctionDecl(std::move(ast_), decl_) {}
 
-PASTA_DEFINE_BASE_OPERATORS(DeclContext, CXXMethodDecl)
+PASTA_DEFINE_DECL_CONTEXT_BASE_OPERATORS(CXXMethodDecl)
 PASTA_DEFINE_BASE_OPERATORS(Decl, CXXMethodDecl)
 PASTA_DEFINE_BASE_OPERATORS(DeclaratorDecl, CXXMethodDecl)
 PASTA_DEFINE_BASE_OPERATORS(FunctionDecl, CXXMethodDecl)
@@ -7370,16 +7187,10 @@ bool CXXMethodDecl::IsVolatile(void) const {
   return val;
 }
 
-std::vector<::pasta::CXXMethodDecl> CXXMethodDecl::OverriddenMethods(void) const {
+::pasta::LazyRange<::pasta::CXXMethodDecl> CXXMethodDecl::OverriddenMethods(void) const {
   auto &self = *const_cast<clang::CXXMethodDecl *>(u.CXXMethodDecl);
   decltype(auto) val = self.overridden_methods();
-  std::vector<::pasta::CXXMethodDecl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::CXXMethodDecl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::CXXMethodDecl, DeclBuilder>(ast, val);
 }
 
 uint32_t CXXMethodDecl::SizeOverriddenMethods(void) const {
@@ -7483,16 +7294,10 @@ bool ClassTemplateDecl::IsThisDeclarationADefinition(void) const {
 
 // 0: ClassTemplateDecl::
 // 0: ClassTemplateDecl::
-std::vector<::pasta::ClassTemplateSpecializationDecl> ClassTemplateDecl::Specializations(void) const {
+::pasta::LazyRange<::pasta::ClassTemplateSpecializationDecl> ClassTemplateDecl::Specializations(void) const {
   auto &self = *const_cast<clang::ClassTemplateDecl *>(u.ClassTemplateDecl);
   decltype(auto) val = self.specializations();
-  std::vector<::pasta::ClassTemplateSpecializationDecl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::ClassTemplateSpecializationDecl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::ClassTemplateSpecializationDecl, DeclBuilder>(ast, val);
 }
 
 DecompositionDecl::DecompositionDecl(
@@ -7505,16 +7310,10 @@ PASTA_DEFINE_BASE_OPERATORS(DeclaratorDecl, DecompositionDecl)
 PASTA_DEFINE_BASE_OPERATORS(NamedDecl, DecompositionDecl)
 PASTA_DEFINE_BASE_OPERATORS(ValueDecl, DecompositionDecl)
 PASTA_DEFINE_BASE_OPERATORS(VarDecl, DecompositionDecl)
-std::vector<::pasta::BindingDecl> DecompositionDecl::Bindings(void) const {
+::pasta::LazyRange<::pasta::BindingDecl> DecompositionDecl::Bindings(void) const {
   auto &self = *const_cast<clang::DecompositionDecl *>(u.DecompositionDecl);
   decltype(auto) val = self.bindings();
-  std::vector<::pasta::BindingDecl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::BindingDecl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::BindingDecl, DeclBuilder>(ast, val);
 }
 
 std::vector<::pasta::TemplateParameterList> DecompositionDecl::TemplateParameterLists(void) const {
@@ -7535,7 +7334,7 @@ EnumDecl::EnumDecl(
     const ::clang::Decl *decl_)
     : TagDecl(std::move(ast_), decl_) {}
 
-PASTA_DEFINE_BASE_OPERATORS(DeclContext, EnumDecl)
+PASTA_DEFINE_DECL_CONTEXT_BASE_OPERATORS(EnumDecl)
 PASTA_DEFINE_BASE_OPERATORS(Decl, EnumDecl)
 PASTA_DEFINE_BASE_OPERATORS(NamedDecl, EnumDecl)
 PASTA_DEFINE_BASE_OPERATORS(TagDecl, EnumDecl)
@@ -7790,16 +7589,10 @@ bool FunctionTemplateDecl::IsThisDeclarationADefinition(void) const {
 
 // 0: FunctionTemplateDecl::
 // 0: FunctionTemplateDecl::
-std::vector<::pasta::FunctionDecl> FunctionTemplateDecl::Specializations(void) const {
+::pasta::LazyRange<::pasta::FunctionDecl> FunctionTemplateDecl::Specializations(void) const {
   auto &self = *const_cast<clang::FunctionTemplateDecl *>(u.FunctionTemplateDecl);
   decltype(auto) val = self.specializations();
-  std::vector<::pasta::FunctionDecl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::FunctionDecl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::FunctionDecl, DeclBuilder>(ast, val);
 }
 
 ImplicitParamDecl::ImplicitParamDecl(
@@ -7984,7 +7777,7 @@ RecordDecl::RecordDecl(
     const ::clang::Decl *decl_)
     : TagDecl(std::move(ast_), decl_) {}
 
-PASTA_DEFINE_BASE_OPERATORS(DeclContext, RecordDecl)
+PASTA_DEFINE_DECL_CONTEXT_BASE_OPERATORS(RecordDecl)
 PASTA_DEFINE_BASE_OPERATORS(Decl, RecordDecl)
 PASTA_DEFINE_BASE_OPERATORS(NamedDecl, RecordDecl)
 PASTA_DEFINE_BASE_OPERATORS(TagDecl, RecordDecl)
@@ -8001,16 +7794,10 @@ bool RecordDecl::CanPassInRegisters(void) const {
 // 0: RecordDecl::
 // 0: RecordDecl::
 // 0: RecordDecl::
-std::vector<::pasta::FieldDecl> RecordDecl::Fields(void) const {
+::pasta::LazyRange<::pasta::FieldDecl> RecordDecl::Fields(void) const {
   auto &self = *const_cast<clang::RecordDecl *>(u.RecordDecl);
   decltype(auto) val = self.fields();
-  std::vector<::pasta::FieldDecl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::FieldDecl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::FieldDecl, DeclBuilder>(ast, val);
 }
 
 std::optional<::pasta::FieldDecl> RecordDecl::FirstNamedDataMember(void) const {
@@ -8242,7 +8029,7 @@ CXXConstructorDecl::CXXConstructorDecl(
     const ::clang::Decl *decl_)
     : CXXMethodDecl(std::move(ast_), decl_) {}
 
-PASTA_DEFINE_BASE_OPERATORS(DeclContext, CXXConstructorDecl)
+PASTA_DEFINE_DECL_CONTEXT_BASE_OPERATORS(CXXConstructorDecl)
 PASTA_DEFINE_BASE_OPERATORS(CXXMethodDecl, CXXConstructorDecl)
 PASTA_DEFINE_BASE_OPERATORS(Decl, CXXConstructorDecl)
 PASTA_DEFINE_BASE_OPERATORS(DeclaratorDecl, CXXConstructorDecl)
@@ -8355,7 +8142,7 @@ CXXConversionDecl::CXXConversionDecl(
     const ::clang::Decl *decl_)
     : CXXMethodDecl(std::move(ast_), decl_) {}
 
-PASTA_DEFINE_BASE_OPERATORS(DeclContext, CXXConversionDecl)
+PASTA_DEFINE_DECL_CONTEXT_BASE_OPERATORS(CXXConversionDecl)
 PASTA_DEFINE_BASE_OPERATORS(CXXMethodDecl, CXXConversionDecl)
 PASTA_DEFINE_BASE_OPERATORS(Decl, CXXConversionDecl)
 PASTA_DEFINE_BASE_OPERATORS(DeclaratorDecl, CXXConversionDecl)
@@ -8425,7 +8212,7 @@ CXXDestructorDecl::CXXDestructorDecl(
     const ::clang::Decl *decl_)
     : CXXMethodDecl(std::move(ast_), decl_) {}
 
-PASTA_DEFINE_BASE_OPERATORS(DeclContext, CXXDestructorDecl)
+PASTA_DEFINE_DECL_CONTEXT_BASE_OPERATORS(CXXDestructorDecl)
 PASTA_DEFINE_BASE_OPERATORS(CXXMethodDecl, CXXDestructorDecl)
 PASTA_DEFINE_BASE_OPERATORS(Decl, CXXDestructorDecl)
 PASTA_DEFINE_BASE_OPERATORS(DeclaratorDecl, CXXDestructorDecl)
@@ -8497,7 +8284,7 @@ CXXRecordDecl::CXXRecordDecl(
     const ::clang::Decl *decl_)
     : RecordDecl(std::move(ast_), decl_) {}
 
-PASTA_DEFINE_BASE_OPERATORS(DeclContext, CXXRecordDecl)
+PASTA_DEFINE_DECL_CONTEXT_BASE_OPERATORS(CXXRecordDecl)
 PASTA_DEFINE_BASE_OPERATORS(Decl, CXXRecordDecl)
 PASTA_DEFINE_BASE_OPERATORS(NamedDecl, CXXRecordDecl)
 PASTA_DEFINE_BASE_OPERATORS(RecordDecl, CXXRecordDecl)
@@ -8546,16 +8333,10 @@ std::optional<enum MSInheritanceModel> CXXRecordDecl::CalculateInheritanceModel(
 // 0: CXXRecordDecl::
 // 0: CXXRecordDecl::
 // 0: CXXRecordDecl::
-std::vector<::pasta::CXXConstructorDecl> CXXRecordDecl::Constructors(void) const {
+::pasta::LazyRange<::pasta::CXXConstructorDecl> CXXRecordDecl::Constructors(void) const {
   auto &self = *const_cast<clang::CXXRecordDecl *>(u.CXXRecordDecl);
   decltype(auto) val = self.ctors();
-  std::vector<::pasta::CXXConstructorDecl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::CXXConstructorDecl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::CXXConstructorDecl, DeclBuilder>(ast, val);
 }
 
 std::optional<bool> CXXRecordDecl::DefaultedCopyConstructorIsDeleted(void) const {
@@ -9781,7 +9562,7 @@ ClassTemplateSpecializationDecl::ClassTemplateSpecializationDecl(
     const ::clang::Decl *decl_)
     : CXXRecordDecl(std::move(ast_), decl_) {}
 
-PASTA_DEFINE_BASE_OPERATORS(DeclContext, ClassTemplateSpecializationDecl)
+PASTA_DEFINE_DECL_CONTEXT_BASE_OPERATORS(ClassTemplateSpecializationDecl)
 PASTA_DEFINE_BASE_OPERATORS(CXXRecordDecl, ClassTemplateSpecializationDecl)
 PASTA_DEFINE_BASE_OPERATORS(Decl, ClassTemplateSpecializationDecl)
 PASTA_DEFINE_BASE_OPERATORS(NamedDecl, ClassTemplateSpecializationDecl)
@@ -9928,7 +9709,7 @@ ClassTemplatePartialSpecializationDecl::ClassTemplatePartialSpecializationDecl(
     const ::clang::Decl *decl_)
     : ClassTemplateSpecializationDecl(std::move(ast_), decl_) {}
 
-PASTA_DEFINE_BASE_OPERATORS(DeclContext, ClassTemplatePartialSpecializationDecl)
+PASTA_DEFINE_DECL_CONTEXT_BASE_OPERATORS(ClassTemplatePartialSpecializationDecl)
 PASTA_DEFINE_BASE_OPERATORS(CXXRecordDecl, ClassTemplatePartialSpecializationDecl)
 PASTA_DEFINE_BASE_OPERATORS(ClassTemplateSpecializationDecl, ClassTemplatePartialSpecializationDecl)
 PASTA_DEFINE_BASE_OPERATORS(Decl, ClassTemplatePartialSpecializationDecl)
@@ -9992,5 +9773,1098 @@ std::vector<::pasta::TemplateParameterList> ClassTemplatePartialSpecializationDe
   return ret;
 }
 
+::pasta::DeclSnapshot Decl::Snapshot(void) const {
+  ::pasta::DeclSnapshot snapshot;
+  snapshot.access = Decl::Access();
+  snapshot.availability = Decl::Availability();
+  snapshot.begin_token = ast->TokenIndexAt(const_cast<clang::Decl *>(u.Decl)->getBeginLoc());
+  snapshot.end_token = ast->TokenIndexAt(const_cast<clang::Decl *>(u.Decl)->getEndLoc());
+  snapshot.friend_object_kind = Decl::FriendObjectKind();
+  snapshot.global_id = Decl::GlobalID();
+  snapshot.id = Decl::ID();
+  snapshot.identifier_namespace = Decl::IdentifierNamespace();
+  snapshot.module_ownership_kind = Decl::ModuleOwnershipKind();
+  snapshot.owning_module_id = Decl::OwningModuleID();
+  snapshot.template_depth = Decl::TemplateDepth();
+  snapshot.has_attributes = Decl::HasAttributes();
+  snapshot.has_body = Decl::HasBody();
+  snapshot.has_defining_attribute = Decl::HasDefiningAttribute();
+  snapshot.has_owning_module = Decl::HasOwningModule();
+  snapshot.has_tag_identifier_namespace = Decl::HasTagIdentifierNamespace();
+  snapshot.is_canonical_declaration = Decl::IsCanonicalDeclaration();
+  snapshot.is_defined_outside_function_or_method = Decl::IsDefinedOutsideFunctionOrMethod();
+  snapshot.is_deprecated = Decl::IsDeprecated();
+  snapshot.is_discarded_in_global_module_fragment = Decl::IsDiscardedInGlobalModuleFragment();
+  snapshot.is_file_context_declaration = Decl::IsFileContextDeclaration();
+  snapshot.is_first_declaration = Decl::IsFirstDeclaration();
+  snapshot.is_from_ast_file = Decl::IsFromASTFile();
+  snapshot.is_function_or_function_template = Decl::IsFunctionOrFunctionTemplate();
+  snapshot.is_function_pointer_type = Decl::IsFunctionPointerType();
+  snapshot.is_implicit = Decl::IsImplicit();
+  snapshot.is_in_anonymous_namespace = Decl::IsInAnonymousNamespace();
+  snapshot.is_in_another_module_unit = Decl::IsInAnotherModuleUnit();
+  snapshot.is_in_export_declaration_context = Decl::IsInExportDeclarationContext();
+  snapshot.is_in_std_namespace = Decl::IsInStdNamespace();
+  snapshot.is_invalid_declaration = Decl::IsInvalidDeclaration();
+  snapshot.is_invisible_outside_the_owning_module = Decl::IsInvisibleOutsideTheOwningModule();
+  snapshot.is_local_extern_declaration = Decl::IsLocalExternDeclaration();
+  snapshot.is_module_private = Decl::IsModulePrivate();
+  snapshot.is_out_of_line = Decl::IsOutOfLine();
+  snapshot.is_parameter_pack = Decl::IsParameterPack();
+  snapshot.is_reachable = Decl::IsReachable();
+  snapshot.is_referenced = Decl::IsReferenced();
+  snapshot.is_template_declaration = Decl::IsTemplateDeclaration();
+  snapshot.is_template_parameter = Decl::IsTemplateParameter();
+  snapshot.is_template_parameter_pack = Decl::IsTemplateParameterPack();
+  snapshot.is_templated = Decl::IsTemplated();
+  snapshot.is_this_declaration_referenced = Decl::IsThisDeclarationReferenced();
+  snapshot.is_top_level_declaration_in_obj_c_container = Decl::IsTopLevelDeclarationInObjCContainer();
+  snapshot.is_unavailable = Decl::IsUnavailable();
+  snapshot.is_unconditionally_visible = Decl::IsUnconditionallyVisible();
+  snapshot.is_used = Decl::IsUsed();
+  snapshot.is_weak_imported = Decl::IsWeakImported();
+  return snapshot;
+}
+
+::pasta::EmptyDeclSnapshot EmptyDecl::Snapshot(void) const {
+  ::pasta::EmptyDeclSnapshot snapshot;
+  static_cast<::pasta::DeclSnapshot &>(snapshot) = Decl::Snapshot();
+  return snapshot;
+}
+
+::pasta::ExportDeclSnapshot ExportDecl::Snapshot(void) const {
+  ::pasta::ExportDeclSnapshot snapshot;
+  static_cast<::pasta::DeclSnapshot &>(snapshot) = Decl::Snapshot();
+  snapshot.export_token = ast->TokenIndexAt(const_cast<clang::ExportDecl *>(u.ExportDecl)->getExportLoc());
+  snapshot.r_brace_token = ast->TokenIndexAt(const_cast<clang::ExportDecl *>(u.ExportDecl)->getRBraceLoc());
+  snapshot.has_braces = ExportDecl::HasBraces();
+  return snapshot;
+}
+
+::pasta::ExternCContextDeclSnapshot ExternCContextDecl::Snapshot(void) const {
+  ::pasta::ExternCContextDeclSnapshot snapshot;
+  static_cast<::pasta::DeclSnapshot &>(snapshot) = Decl::Snapshot();
+  return snapshot;
+}
+
+::pasta::FileScopeAsmDeclSnapshot FileScopeAsmDecl::Snapshot(void) const {
+  ::pasta::FileScopeAsmDeclSnapshot snapshot;
+  static_cast<::pasta::DeclSnapshot &>(snapshot) = Decl::Snapshot();
+  snapshot.assembly_token = ast->TokenIndexAt(const_cast<clang::FileScopeAsmDecl *>(u.FileScopeAsmDecl)->getAsmLoc());
+  snapshot.r_paren_token = ast->TokenIndexAt(const_cast<clang::FileScopeAsmDecl *>(u.FileScopeAsmDecl)->getRParenLoc());
+  return snapshot;
+}
+
+::pasta::FriendDeclSnapshot FriendDecl::Snapshot(void) const {
+  ::pasta::FriendDeclSnapshot snapshot;
+  static_cast<::pasta::DeclSnapshot &>(snapshot) = Decl::Snapshot();
+  snapshot.friend_token = ast->TokenIndexAt(const_cast<clang::FriendDecl *>(u.FriendDecl)->getFriendLoc());
+  snapshot.friend_type_num_template_parameter_lists = FriendDecl::FriendTypeNumTemplateParameterLists();
+  snapshot.is_unsupported_friend = FriendDecl::IsUnsupportedFriend();
+  return snapshot;
+}
+
+::pasta::FriendTemplateDeclSnapshot FriendTemplateDecl::Snapshot(void) const {
+  ::pasta::FriendTemplateDeclSnapshot snapshot;
+  static_cast<::pasta::DeclSnapshot &>(snapshot) = Decl::Snapshot();
+  snapshot.friend_token = ast->TokenIndexAt(const_cast<clang::FriendTemplateDecl *>(u.FriendTemplateDecl)->getFriendLoc());
+  snapshot.num_template_parameters = FriendTemplateDecl::NumTemplateParameters();
+  return snapshot;
+}
+
+::pasta::ImplicitConceptSpecializationDeclSnapshot ImplicitConceptSpecializationDecl::Snapshot(void) const {
+  ::pasta::ImplicitConceptSpecializationDeclSnapshot snapshot;
+  static_cast<::pasta::DeclSnapshot &>(snapshot) = Decl::Snapshot();
+  return snapshot;
+}
+
+::pasta::ImportDeclSnapshot ImportDecl::Snapshot(void) const {
+  ::pasta::ImportDeclSnapshot snapshot;
+  static_cast<::pasta::DeclSnapshot &>(snapshot) = Decl::Snapshot();
+  return snapshot;
+}
+
+::pasta::LifetimeExtendedTemporaryDeclSnapshot LifetimeExtendedTemporaryDecl::Snapshot(void) const {
+  ::pasta::LifetimeExtendedTemporaryDeclSnapshot snapshot;
+  static_cast<::pasta::DeclSnapshot &>(snapshot) = Decl::Snapshot();
+  snapshot.mangling_number = LifetimeExtendedTemporaryDecl::ManglingNumber();
+  snapshot.storage_duration = LifetimeExtendedTemporaryDecl::StorageDuration();
+  return snapshot;
+}
+
+::pasta::LinkageSpecDeclSnapshot LinkageSpecDecl::Snapshot(void) const {
+  ::pasta::LinkageSpecDeclSnapshot snapshot;
+  static_cast<::pasta::DeclSnapshot &>(snapshot) = Decl::Snapshot();
+  snapshot.extern_token = ast->TokenIndexAt(const_cast<clang::LinkageSpecDecl *>(u.LinkageSpecDecl)->getExternLoc());
+  snapshot.language = LinkageSpecDecl::Language();
+  snapshot.r_brace_token = ast->TokenIndexAt(const_cast<clang::LinkageSpecDecl *>(u.LinkageSpecDecl)->getRBraceLoc());
+  snapshot.has_braces = LinkageSpecDecl::HasBraces();
+  return snapshot;
+}
+
+::pasta::NamedDeclSnapshot NamedDecl::Snapshot(void) const {
+  ::pasta::NamedDeclSnapshot snapshot;
+  static_cast<::pasta::DeclSnapshot &>(snapshot) = Decl::Snapshot();
+  snapshot.formal_linkage = NamedDecl::FormalLinkage();
+  snapshot.linkage_internal = NamedDecl::LinkageInternal();
+  snapshot.has_external_formal_linkage = NamedDecl::HasExternalFormalLinkage();
+  snapshot.has_linkage = NamedDecl::HasLinkage();
+  snapshot.has_linkage_been_computed = NamedDecl::HasLinkageBeenComputed();
+  snapshot.is_cxx_class_member = NamedDecl::IsCXXClassMember();
+  snapshot.is_cxx_instance_member = NamedDecl::IsCXXInstanceMember();
+  snapshot.is_externally_declarable = NamedDecl::IsExternallyDeclarable();
+  snapshot.is_externally_visible = NamedDecl::IsExternallyVisible();
+  snapshot.is_linkage_valid = NamedDecl::IsLinkageValid();
+  return snapshot;
+}
+
+::pasta::NamespaceAliasDeclSnapshot NamespaceAliasDecl::Snapshot(void) const {
+  ::pasta::NamespaceAliasDeclSnapshot snapshot;
+  static_cast<::pasta::NamedDeclSnapshot &>(snapshot) = NamedDecl::Snapshot();
+  snapshot.alias_token = ast->TokenIndexAt(const_cast<clang::NamespaceAliasDecl *>(u.NamespaceAliasDecl)->getAliasLoc());
+  snapshot.namespace_token = ast->TokenIndexAt(const_cast<clang::NamespaceAliasDecl *>(u.NamespaceAliasDecl)->getNamespaceLoc());
+  snapshot.target_name_token = ast->TokenIndexAt(const_cast<clang::NamespaceAliasDecl *>(u.NamespaceAliasDecl)->getTargetNameLoc());
+  return snapshot;
+}
+
+::pasta::NamespaceDeclSnapshot NamespaceDecl::Snapshot(void) const {
+  ::pasta::NamespaceDeclSnapshot snapshot;
+  static_cast<::pasta::NamedDeclSnapshot &>(snapshot) = NamedDecl::Snapshot();
+  snapshot.r_brace_token = ast->TokenIndexAt(const_cast<clang::NamespaceDecl *>(u.NamespaceDecl)->getRBraceLoc());
+  snapshot.is_anonymous_namespace = NamespaceDecl::IsAnonymousNamespace();
+  snapshot.is_inline = NamespaceDecl::IsInline();
+  snapshot.is_nested = NamespaceDecl::IsNested();
+  snapshot.is_original_namespace = NamespaceDecl::IsOriginalNamespace();
+  return snapshot;
+}
+
+::pasta::ObjCCompatibleAliasDeclSnapshot ObjCCompatibleAliasDecl::Snapshot(void) const {
+  ::pasta::ObjCCompatibleAliasDeclSnapshot snapshot;
+  static_cast<::pasta::NamedDeclSnapshot &>(snapshot) = NamedDecl::Snapshot();
+  return snapshot;
+}
+
+::pasta::ObjCContainerDeclSnapshot ObjCContainerDecl::Snapshot(void) const {
+  ::pasta::ObjCContainerDeclSnapshot snapshot;
+  static_cast<::pasta::NamedDeclSnapshot &>(snapshot) = NamedDecl::Snapshot();
+  snapshot.at_start_token = ast->TokenIndexAt(const_cast<clang::ObjCContainerDecl *>(u.ObjCContainerDecl)->getAtStartLoc());
+  return snapshot;
+}
+
+::pasta::ObjCImplDeclSnapshot ObjCImplDecl::Snapshot(void) const {
+  ::pasta::ObjCImplDeclSnapshot snapshot;
+  static_cast<::pasta::ObjCContainerDeclSnapshot &>(snapshot) = ObjCContainerDecl::Snapshot();
+  return snapshot;
+}
+
+::pasta::ObjCImplementationDeclSnapshot ObjCImplementationDecl::Snapshot(void) const {
+  ::pasta::ObjCImplementationDeclSnapshot snapshot;
+  static_cast<::pasta::ObjCImplDeclSnapshot &>(snapshot) = ObjCImplDecl::Snapshot();
+  snapshot.instance_variable_l_brace_token = ast->TokenIndexAt(const_cast<clang::ObjCImplementationDecl *>(u.ObjCImplementationDecl)->getIvarLBraceLoc());
+  snapshot.instance_variable_r_brace_token = ast->TokenIndexAt(const_cast<clang::ObjCImplementationDecl *>(u.ObjCImplementationDecl)->getIvarRBraceLoc());
+  snapshot.num_instance_variable_initializers = ObjCImplementationDecl::NumInstanceVariableInitializers();
+  snapshot.super_class_token = ast->TokenIndexAt(const_cast<clang::ObjCImplementationDecl *>(u.ObjCImplementationDecl)->getSuperClassLoc());
+  snapshot.has_destructors = ObjCImplementationDecl::HasDestructors();
+  snapshot.has_non_zero_constructors = ObjCImplementationDecl::HasNonZeroConstructors();
+  return snapshot;
+}
+
+::pasta::ObjCInterfaceDeclSnapshot ObjCInterfaceDecl::Snapshot(void) const {
+  ::pasta::ObjCInterfaceDeclSnapshot snapshot;
+  static_cast<::pasta::ObjCContainerDeclSnapshot &>(snapshot) = ObjCContainerDecl::Snapshot();
+  snapshot.declares_or_inherits_designated_initializers = ObjCInterfaceDecl::DeclaresOrInheritsDesignatedInitializers();
+  snapshot.end_of_definition_token = ast->TokenIndexAt(const_cast<clang::ObjCInterfaceDecl *>(u.ObjCInterfaceDecl)->getEndOfDefinitionLoc());
+  snapshot.super_class_token = ast->TokenIndexAt(const_cast<clang::ObjCInterfaceDecl *>(u.ObjCInterfaceDecl)->getSuperClassLoc());
+  snapshot.has_definition = ObjCInterfaceDecl::HasDefinition();
+  if (const auto &self = *(u.ObjCInterfaceDecl); self.hasDefinition()) {
+    snapshot.has_designated_initializers = ObjCInterfaceDecl::HasDesignatedInitializers();
+  }
+  snapshot.is_arc_weakref_unavailable = ObjCInterfaceDecl::IsArcWeakrefUnavailable();
+  snapshot.is_implicit_interface_declaration = ObjCInterfaceDecl::IsImplicitInterfaceDeclaration();
+  snapshot.is_this_declaration_a_definition = ObjCInterfaceDecl::IsThisDeclarationADefinition();
+  return snapshot;
+}
+
+::pasta::ObjCMethodDeclSnapshot ObjCMethodDecl::Snapshot(void) const {
+  ::pasta::ObjCMethodDeclSnapshot snapshot;
+  static_cast<::pasta::NamedDeclSnapshot &>(snapshot) = NamedDecl::Snapshot();
+  snapshot.defined_in_ns_object = ObjCMethodDecl::DefinedInNSObject();
+  snapshot.declarator_end_token = ast->TokenIndexAt(const_cast<clang::ObjCMethodDecl *>(u.ObjCMethodDecl)->getDeclaratorEndLoc());
+  snapshot.implementation_control = ObjCMethodDecl::ImplementationControl();
+  snapshot.method_family = ObjCMethodDecl::MethodFamily();
+  snapshot.num_selector_tokens = ObjCMethodDecl::NumSelectorTokens();
+  snapshot.obj_c_decl_qualifier = ObjCMethodDecl::ObjCDeclQualifier();
+  snapshot.selector_start_token = ast->TokenIndexAt(const_cast<clang::ObjCMethodDecl *>(u.ObjCMethodDecl)->getSelectorStartLoc());
+  snapshot.has_parameter_destroyed_in_callee = ObjCMethodDecl::HasParameterDestroyedInCallee();
+  snapshot.has_redeclaration = ObjCMethodDecl::HasRedeclaration();
+  snapshot.has_related_result_type = ObjCMethodDecl::HasRelatedResultType();
+  snapshot.has_skipped_body = ObjCMethodDecl::HasSkippedBody();
+  snapshot.is_class_method = ObjCMethodDecl::IsClassMethod();
+  snapshot.is_defined = ObjCMethodDecl::IsDefined();
+  snapshot.is_designated_initializer_for_the_interface = ObjCMethodDecl::IsDesignatedInitializerForTheInterface();
+  snapshot.is_direct_method = ObjCMethodDecl::IsDirectMethod();
+  snapshot.is_instance_method = ObjCMethodDecl::IsInstanceMethod();
+  snapshot.is_optional = ObjCMethodDecl::IsOptional();
+  snapshot.is_overriding = ObjCMethodDecl::IsOverriding();
+  snapshot.is_property_accessor = ObjCMethodDecl::IsPropertyAccessor();
+  snapshot.is_redeclaration = ObjCMethodDecl::IsRedeclaration();
+  snapshot.is_synthesized_accessor_stub = ObjCMethodDecl::IsSynthesizedAccessorStub();
+  snapshot.is_this_declaration_a_definition = ObjCMethodDecl::IsThisDeclarationADefinition();
+  snapshot.is_this_declaration_a_designated_initializer = ObjCMethodDecl::IsThisDeclarationADesignatedInitializer();
+  snapshot.is_variadic = ObjCMethodDecl::IsVariadic();
+  return snapshot;
+}
+
+::pasta::ObjCPropertyDeclSnapshot ObjCPropertyDecl::Snapshot(void) const {
+  ::pasta::ObjCPropertyDeclSnapshot snapshot;
+  static_cast<::pasta::NamedDeclSnapshot &>(snapshot) = NamedDecl::Snapshot();
+  snapshot.at_token = ast->TokenIndexAt(const_cast<clang::ObjCPropertyDecl *>(u.ObjCPropertyDecl)->getAtLoc());
+  snapshot.getter_name_token = ast->TokenIndexAt(const_cast<clang::ObjCPropertyDecl *>(u.ObjCPropertyDecl)->getGetterNameLoc());
+  snapshot.l_paren_token = ast->TokenIndexAt(const_cast<clang::ObjCPropertyDecl *>(u.ObjCPropertyDecl)->getLParenLoc());
+  snapshot.property_implementation = ObjCPropertyDecl::PropertyImplementation();
+  snapshot.query_kind = ObjCPropertyDecl::QueryKind();
+  snapshot.setter_kind = ObjCPropertyDecl::SetterKind();
+  snapshot.setter_name_token = ast->TokenIndexAt(const_cast<clang::ObjCPropertyDecl *>(u.ObjCPropertyDecl)->getSetterNameLoc());
+  snapshot.is_atomic = ObjCPropertyDecl::IsAtomic();
+  snapshot.is_class_property = ObjCPropertyDecl::IsClassProperty();
+  snapshot.is_direct_property = ObjCPropertyDecl::IsDirectProperty();
+  snapshot.is_instance_property = ObjCPropertyDecl::IsInstanceProperty();
+  snapshot.is_optional = ObjCPropertyDecl::IsOptional();
+  snapshot.is_read_only = ObjCPropertyDecl::IsReadOnly();
+  snapshot.is_retaining = ObjCPropertyDecl::IsRetaining();
+  return snapshot;
+}
+
+::pasta::ObjCPropertyImplDeclSnapshot ObjCPropertyImplDecl::Snapshot(void) const {
+  ::pasta::ObjCPropertyImplDeclSnapshot snapshot;
+  static_cast<::pasta::DeclSnapshot &>(snapshot) = Decl::Snapshot();
+  snapshot.property_implementation = ObjCPropertyImplDecl::PropertyImplementation();
+  snapshot.property_instance_variable_declaration_token = ast->TokenIndexAt(const_cast<clang::ObjCPropertyImplDecl *>(u.ObjCPropertyImplDecl)->getPropertyIvarDeclLoc());
+  snapshot.is_instance_variable_name_specified = ObjCPropertyImplDecl::IsInstanceVariableNameSpecified();
+  return snapshot;
+}
+
+::pasta::ObjCProtocolDeclSnapshot ObjCProtocolDecl::Snapshot(void) const {
+  ::pasta::ObjCProtocolDeclSnapshot snapshot;
+  static_cast<::pasta::ObjCContainerDeclSnapshot &>(snapshot) = ObjCContainerDecl::Snapshot();
+  snapshot.has_definition = ObjCProtocolDecl::HasDefinition();
+  snapshot.is_non_runtime_protocol = ObjCProtocolDecl::IsNonRuntimeProtocol();
+  snapshot.is_this_declaration_a_definition = ObjCProtocolDecl::IsThisDeclarationADefinition();
+  return snapshot;
+}
+
+::pasta::PragmaCommentDeclSnapshot PragmaCommentDecl::Snapshot(void) const {
+  ::pasta::PragmaCommentDeclSnapshot snapshot;
+  static_cast<::pasta::DeclSnapshot &>(snapshot) = Decl::Snapshot();
+  snapshot.comment_kind = PragmaCommentDecl::CommentKind();
+  return snapshot;
+}
+
+::pasta::PragmaDetectMismatchDeclSnapshot PragmaDetectMismatchDecl::Snapshot(void) const {
+  ::pasta::PragmaDetectMismatchDeclSnapshot snapshot;
+  static_cast<::pasta::DeclSnapshot &>(snapshot) = Decl::Snapshot();
+  return snapshot;
+}
+
+::pasta::RequiresExprBodyDeclSnapshot RequiresExprBodyDecl::Snapshot(void) const {
+  ::pasta::RequiresExprBodyDeclSnapshot snapshot;
+  static_cast<::pasta::DeclSnapshot &>(snapshot) = Decl::Snapshot();
+  return snapshot;
+}
+
+::pasta::StaticAssertDeclSnapshot StaticAssertDecl::Snapshot(void) const {
+  ::pasta::StaticAssertDeclSnapshot snapshot;
+  static_cast<::pasta::DeclSnapshot &>(snapshot) = Decl::Snapshot();
+  snapshot.r_paren_token = ast->TokenIndexAt(const_cast<clang::StaticAssertDecl *>(u.StaticAssertDecl)->getRParenLoc());
+  snapshot.is_failed = StaticAssertDecl::IsFailed();
+  return snapshot;
+}
+
+::pasta::TemplateDeclSnapshot TemplateDecl::Snapshot(void) const {
+  ::pasta::TemplateDeclSnapshot snapshot;
+  static_cast<::pasta::NamedDeclSnapshot &>(snapshot) = NamedDecl::Snapshot();
+  snapshot.has_associated_constraints = TemplateDecl::HasAssociatedConstraints();
+  snapshot.is_type_alias = TemplateDecl::IsTypeAlias();
+  return snapshot;
+}
+
+::pasta::TemplateTemplateParmDeclSnapshot TemplateTemplateParmDecl::Snapshot(void) const {
+  ::pasta::TemplateTemplateParmDeclSnapshot snapshot;
+  static_cast<::pasta::TemplateDeclSnapshot &>(snapshot) = TemplateDecl::Snapshot();
+  snapshot.default_argument_was_inherited = TemplateTemplateParmDecl::DefaultArgumentWasInherited();
+  snapshot.default_argument_token = ast->TokenIndexAt(const_cast<clang::TemplateTemplateParmDecl *>(u.TemplateTemplateParmDecl)->getDefaultArgumentLoc());
+  if (const auto &self = *(u.TemplateTemplateParmDecl); self.isExpandedParameterPack()) {
+    snapshot.num_expansion_template_parameters = TemplateTemplateParmDecl::NumExpansionTemplateParameters();
+  }
+  snapshot.has_default_argument = TemplateTemplateParmDecl::HasDefaultArgument();
+  snapshot.is_expanded_parameter_pack = TemplateTemplateParmDecl::IsExpandedParameterPack();
+  snapshot.is_pack_expansion = TemplateTemplateParmDecl::IsPackExpansion();
+  return snapshot;
+}
+
+::pasta::TopLevelStmtDeclSnapshot TopLevelStmtDecl::Snapshot(void) const {
+  ::pasta::TopLevelStmtDeclSnapshot snapshot;
+  static_cast<::pasta::DeclSnapshot &>(snapshot) = Decl::Snapshot();
+  snapshot.is_semi_missing = TopLevelStmtDecl::IsSemiMissing();
+  return snapshot;
+}
+
+::pasta::TranslationUnitDeclSnapshot TranslationUnitDecl::Snapshot(void) const {
+  ::pasta::TranslationUnitDeclSnapshot snapshot;
+  static_cast<::pasta::DeclSnapshot &>(snapshot) = Decl::Snapshot();
+  return snapshot;
+}
+
+::pasta::TypeDeclSnapshot TypeDecl::Snapshot(void) const {
+  ::pasta::TypeDeclSnapshot snapshot;
+  static_cast<::pasta::NamedDeclSnapshot &>(snapshot) = NamedDecl::Snapshot();
+  return snapshot;
+}
+
+::pasta::TypedefNameDeclSnapshot TypedefNameDecl::Snapshot(void) const {
+  ::pasta::TypedefNameDeclSnapshot snapshot;
+  static_cast<::pasta::TypeDeclSnapshot &>(snapshot) = TypeDecl::Snapshot();
+  snapshot.is_moded = TypedefNameDecl::IsModed();
+  snapshot.is_transparent_tag = TypedefNameDecl::IsTransparentTag();
+  return snapshot;
+}
+
+::pasta::UnresolvedUsingIfExistsDeclSnapshot UnresolvedUsingIfExistsDecl::Snapshot(void) const {
+  ::pasta::UnresolvedUsingIfExistsDeclSnapshot snapshot;
+  static_cast<::pasta::NamedDeclSnapshot &>(snapshot) = NamedDecl::Snapshot();
+  return snapshot;
+}
+
+::pasta::UnresolvedUsingTypenameDeclSnapshot UnresolvedUsingTypenameDecl::Snapshot(void) const {
+  ::pasta::UnresolvedUsingTypenameDeclSnapshot snapshot;
+  static_cast<::pasta::TypeDeclSnapshot &>(snapshot) = TypeDecl::Snapshot();
+  snapshot.ellipsis_token = ast->TokenIndexAt(const_cast<clang::UnresolvedUsingTypenameDecl *>(u.UnresolvedUsingTypenameDecl)->getEllipsisLoc());
+  snapshot.typename_token = ast->TokenIndexAt(const_cast<clang::UnresolvedUsingTypenameDecl *>(u.UnresolvedUsingTypenameDecl)->getTypenameLoc());
+  snapshot.using_token = ast->TokenIndexAt(const_cast<clang::UnresolvedUsingTypenameDecl *>(u.UnresolvedUsingTypenameDecl)->getUsingLoc());
+  snapshot.is_pack_expansion = UnresolvedUsingTypenameDecl::IsPackExpansion();
+  return snapshot;
+}
+
+::pasta::UsingDirectiveDeclSnapshot UsingDirectiveDecl::Snapshot(void) const {
+  ::pasta::UsingDirectiveDeclSnapshot snapshot;
+  static_cast<::pasta::NamedDeclSnapshot &>(snapshot) = NamedDecl::Snapshot();
+  snapshot.identifier_token = ast->TokenIndexAt(const_cast<clang::UsingDirectiveDecl *>(u.UsingDirectiveDecl)->getIdentLocation());
+  snapshot.namespace_key_token = ast->TokenIndexAt(const_cast<clang::UsingDirectiveDecl *>(u.UsingDirectiveDecl)->getNamespaceKeyLocation());
+  snapshot.using_token = ast->TokenIndexAt(const_cast<clang::UsingDirectiveDecl *>(u.UsingDirectiveDecl)->getUsingLoc());
+  return snapshot;
+}
+
+::pasta::UsingPackDeclSnapshot UsingPackDecl::Snapshot(void) const {
+  ::pasta::UsingPackDeclSnapshot snapshot;
+  static_cast<::pasta::NamedDeclSnapshot &>(snapshot) = NamedDecl::Snapshot();
+  return snapshot;
+}
+
+::pasta::UsingShadowDeclSnapshot UsingShadowDecl::Snapshot(void) const {
+  ::pasta::UsingShadowDeclSnapshot snapshot;
+  static_cast<::pasta::NamedDeclSnapshot &>(snapshot) = NamedDecl::Snapshot();
+  return snapshot;
+}
+
+::pasta::ValueDeclSnapshot ValueDecl::Snapshot(void) const {
+  ::pasta::ValueDeclSnapshot snapshot;
+  static_cast<::pasta::NamedDeclSnapshot &>(snapshot) = NamedDecl::Snapshot();
+  snapshot.is_initializer_capture = ValueDecl::IsInitializerCapture();
+  snapshot.is_weak = ValueDecl::IsWeak();
+  return snapshot;
+}
+
+::pasta::OMPDeclarativeDirectiveDeclSnapshot OMPDeclarativeDirectiveDecl::Snapshot(void) const {
+  ::pasta::OMPDeclarativeDirectiveDeclSnapshot snapshot;
+  static_cast<::pasta::DeclSnapshot &>(snapshot) = Decl::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPDeclarativeDirectiveValueDeclSnapshot OMPDeclarativeDirectiveValueDecl::Snapshot(void) const {
+  ::pasta::OMPDeclarativeDirectiveValueDeclSnapshot snapshot;
+  static_cast<::pasta::ValueDeclSnapshot &>(snapshot) = ValueDecl::Snapshot();
+  return snapshot;
+}
+
+::pasta::AccessSpecDeclSnapshot AccessSpecDecl::Snapshot(void) const {
+  ::pasta::AccessSpecDeclSnapshot snapshot;
+  static_cast<::pasta::DeclSnapshot &>(snapshot) = Decl::Snapshot();
+  snapshot.access_specifier_token = ast->TokenIndexAt(const_cast<clang::AccessSpecDecl *>(u.AccessSpecDecl)->getAccessSpecifierLoc());
+  snapshot.colon_token = ast->TokenIndexAt(const_cast<clang::AccessSpecDecl *>(u.AccessSpecDecl)->getColonLoc());
+  return snapshot;
+}
+
+::pasta::BaseUsingDeclSnapshot BaseUsingDecl::Snapshot(void) const {
+  ::pasta::BaseUsingDeclSnapshot snapshot;
+  static_cast<::pasta::NamedDeclSnapshot &>(snapshot) = NamedDecl::Snapshot();
+  return snapshot;
+}
+
+::pasta::BindingDeclSnapshot BindingDecl::Snapshot(void) const {
+  ::pasta::BindingDeclSnapshot snapshot;
+  static_cast<::pasta::ValueDeclSnapshot &>(snapshot) = ValueDecl::Snapshot();
+  return snapshot;
+}
+
+::pasta::BlockDeclSnapshot BlockDecl::Snapshot(void) const {
+  ::pasta::BlockDeclSnapshot snapshot;
+  static_cast<::pasta::DeclSnapshot &>(snapshot) = Decl::Snapshot();
+  snapshot.block_missing_return_type = BlockDecl::BlockMissingReturnType();
+  snapshot.can_avoid_copy_to_heap = BlockDecl::CanAvoidCopyToHeap();
+  snapshot.captures_cxx_this = BlockDecl::CapturesCXXThis();
+  snapshot.does_not_escape = BlockDecl::DoesNotEscape();
+  snapshot.block_mangling_number = BlockDecl::BlockManglingNumber();
+  snapshot.caret_token = ast->TokenIndexAt(const_cast<clang::BlockDecl *>(u.BlockDecl)->getCaretLocation());
+  snapshot.num_captures = BlockDecl::NumCaptures();
+  snapshot.num_parameters = BlockDecl::NumParameters();
+  snapshot.has_captures = BlockDecl::HasCaptures();
+  snapshot.is_conversion_from_lambda = BlockDecl::IsConversionFromLambda();
+  snapshot.is_variadic = BlockDecl::IsVariadic();
+  return snapshot;
+}
+
+::pasta::BuiltinTemplateDeclSnapshot BuiltinTemplateDecl::Snapshot(void) const {
+  ::pasta::BuiltinTemplateDeclSnapshot snapshot;
+  static_cast<::pasta::TemplateDeclSnapshot &>(snapshot) = TemplateDecl::Snapshot();
+  return snapshot;
+}
+
+::pasta::CapturedDeclSnapshot CapturedDecl::Snapshot(void) const {
+  ::pasta::CapturedDeclSnapshot snapshot;
+  static_cast<::pasta::DeclSnapshot &>(snapshot) = Decl::Snapshot();
+  snapshot.context_parameter_position = CapturedDecl::ContextParameterPosition();
+  snapshot.num_parameters = CapturedDecl::NumParameters();
+  snapshot.is_nothrow = CapturedDecl::IsNothrow();
+  return snapshot;
+}
+
+::pasta::ClassScopeFunctionSpecializationDeclSnapshot ClassScopeFunctionSpecializationDecl::Snapshot(void) const {
+  ::pasta::ClassScopeFunctionSpecializationDeclSnapshot snapshot;
+  static_cast<::pasta::DeclSnapshot &>(snapshot) = Decl::Snapshot();
+  snapshot.has_explicit_template_arguments = ClassScopeFunctionSpecializationDecl::HasExplicitTemplateArguments();
+  return snapshot;
+}
+
+::pasta::ConceptDeclSnapshot ConceptDecl::Snapshot(void) const {
+  ::pasta::ConceptDeclSnapshot snapshot;
+  static_cast<::pasta::TemplateDeclSnapshot &>(snapshot) = TemplateDecl::Snapshot();
+  snapshot.is_type_concept = ConceptDecl::IsTypeConcept();
+  return snapshot;
+}
+
+::pasta::ConstructorUsingShadowDeclSnapshot ConstructorUsingShadowDecl::Snapshot(void) const {
+  ::pasta::ConstructorUsingShadowDeclSnapshot snapshot;
+  static_cast<::pasta::UsingShadowDeclSnapshot &>(snapshot) = UsingShadowDecl::Snapshot();
+  snapshot.constructs_virtual_base = ConstructorUsingShadowDecl::ConstructsVirtualBase();
+  return snapshot;
+}
+
+::pasta::DeclaratorDeclSnapshot DeclaratorDecl::Snapshot(void) const {
+  ::pasta::DeclaratorDeclSnapshot snapshot;
+  static_cast<::pasta::ValueDeclSnapshot &>(snapshot) = ValueDecl::Snapshot();
+  snapshot.first_inner_token = ast->TokenIndexAt(const_cast<clang::DeclaratorDecl *>(u.DeclaratorDecl)->getInnerLocStart());
+  snapshot.num_template_parameter_lists = DeclaratorDecl::NumTemplateParameterLists();
+  snapshot.first_outer_token = ast->TokenIndexAt(const_cast<clang::DeclaratorDecl *>(u.DeclaratorDecl)->getOuterLocStart());
+  snapshot.type_spec_end_token = ast->TokenIndexAt(const_cast<clang::DeclaratorDecl *>(u.DeclaratorDecl)->getTypeSpecEndLoc());
+  snapshot.type_spec_start_token = ast->TokenIndexAt(const_cast<clang::DeclaratorDecl *>(u.DeclaratorDecl)->getTypeSpecStartLoc());
+  return snapshot;
+}
+
+::pasta::EnumConstantDeclSnapshot EnumConstantDecl::Snapshot(void) const {
+  ::pasta::EnumConstantDeclSnapshot snapshot;
+  static_cast<::pasta::ValueDeclSnapshot &>(snapshot) = ValueDecl::Snapshot();
+  return snapshot;
+}
+
+::pasta::FieldDeclSnapshot FieldDecl::Snapshot(void) const {
+  ::pasta::FieldDeclSnapshot snapshot;
+  static_cast<::pasta::DeclaratorDeclSnapshot &>(snapshot) = DeclaratorDecl::Snapshot();
+  if (const auto &self = *(u.FieldDecl); self.isBitField() && !self.getBitWidth()->isValueDependent()) {
+    snapshot.bit_width_value = FieldDecl::BitWidthValue();
+  }
+  snapshot.field_index = FieldDecl::FieldIndex();
+  snapshot.in_class_initializer_style = FieldDecl::InClassInitializerStyle();
+  snapshot.has_captured_vla_type = FieldDecl::HasCapturedVLAType();
+  snapshot.has_in_class_initializer = FieldDecl::HasInClassInitializer();
+  snapshot.has_non_null_in_class_initializer = FieldDecl::HasNonNullInClassInitializer();
+  snapshot.is_anonymous_struct_or_union = FieldDecl::IsAnonymousStructOrUnion();
+  snapshot.is_bit_field = FieldDecl::IsBitField();
+  snapshot.is_mutable = FieldDecl::IsMutable();
+  snapshot.is_potentially_overlapping = FieldDecl::IsPotentiallyOverlapping();
+  snapshot.is_unnamed_bitfield = FieldDecl::IsUnnamedBitfield();
+  if (const auto &self = *(u.FieldDecl); !self.isBitField() || !self.getBitWidth()->isValueDependent()) {
+    snapshot.is_zero_length_bit_field = FieldDecl::IsZeroLengthBitField();
+  }
+  if (const auto &self = *(u.FieldDecl); !self.isBitField() || !self.getBitWidth()->isValueDependent()) {
+    snapshot.is_zero_size = FieldDecl::IsZeroSize();
+  }
+  return snapshot;
+}
+
+::pasta::FunctionDeclSnapshot FunctionDecl::Snapshot(void) const {
+  ::pasta::FunctionDeclSnapshot snapshot;
+  static_cast<::pasta::DeclaratorDeclSnapshot &>(snapshot) = DeclaratorDecl::Snapshot();
+  snapshot.body_contains_immediate_escalating_expressions = FunctionDecl::BodyContainsImmediateEscalatingExpressions();
+  snapshot.friend_constraint_refers_to_enclosing_template = FunctionDecl::FriendConstraintRefersToEnclosingTemplate();
+  snapshot.uses_fp_intrin = FunctionDecl::UsesFPIntrin();
+  snapshot.does_this_declaration_have_a_body = FunctionDecl::DoesThisDeclarationHaveABody();
+  snapshot.builtin_id = FunctionDecl::BuiltinID();
+  snapshot.constexpr_kind = FunctionDecl::ConstexprKind();
+  snapshot.default_token = ast->TokenIndexAt(const_cast<clang::FunctionDecl *>(u.FunctionDecl)->getDefaultLoc());
+  snapshot.ellipsis_token = ast->TokenIndexAt(ast->FunctionEllipsisToken(u.FunctionDecl));
+  snapshot.exception_spec_type = FunctionDecl::ExceptionSpecType();
+  snapshot.language_linkage = FunctionDecl::LanguageLinkage();
+  snapshot.memory_function_kind = FunctionDecl::MemoryFunctionKind();
+  snapshot.min_required_arguments = FunctionDecl::MinRequiredArguments();
+  snapshot.multi_version_kind = FunctionDecl::MultiVersionKind();
+  snapshot.num_parameters = FunctionDecl::NumParameters();
+  snapshot.overloaded_operator = FunctionDecl::OverloadedOperator();
+  snapshot.point_of_instantiation = ast->TokenIndexAt(const_cast<clang::FunctionDecl *>(u.FunctionDecl)->getPointOfInstantiation());
+  snapshot.storage_class = FunctionDecl::StorageClass();
+  snapshot.template_specialization_kind = FunctionDecl::TemplateSpecializationKind();
+  snapshot.template_specialization_kind_for_instantiation = FunctionDecl::TemplateSpecializationKindForInstantiation();
+  snapshot.templated_kind = FunctionDecl::TemplatedKind();
+  snapshot.has_implicit_return_zero = FunctionDecl::HasImplicitReturnZero();
+  snapshot.has_inherited_prototype = FunctionDecl::HasInheritedPrototype();
+  snapshot.has_one_parameter_or_default_arguments = FunctionDecl::HasOneParameterOrDefaultArguments();
+  snapshot.has_prototype = FunctionDecl::HasPrototype();
+  snapshot.has_skipped_body = FunctionDecl::HasSkippedBody();
+  snapshot.has_trivial_body = FunctionDecl::HasTrivialBody();
+  snapshot.has_written_prototype = FunctionDecl::HasWrittenPrototype();
+  snapshot.instantiation_is_pending = FunctionDecl::InstantiationIsPending();
+  snapshot.is_cpu_dispatch_multi_version = FunctionDecl::IsCPUDispatchMultiVersion();
+  snapshot.is_cpu_specific_multi_version = FunctionDecl::IsCPUSpecificMultiVersion();
+  snapshot.is_consteval = FunctionDecl::IsConsteval();
+  snapshot.is_constexpr = FunctionDecl::IsConstexpr();
+  snapshot.is_constexpr_specified = FunctionDecl::IsConstexprSpecified();
+  snapshot.is_defaulted = FunctionDecl::IsDefaulted();
+  snapshot.is_deleted = FunctionDecl::IsDeleted();
+  snapshot.is_deleted_as_written = FunctionDecl::IsDeletedAsWritten();
+  snapshot.is_destroying_operator_delete = FunctionDecl::IsDestroyingOperatorDelete();
+  snapshot.is_explicitly_defaulted = FunctionDecl::IsExplicitlyDefaulted();
+  snapshot.is_extern_c = FunctionDecl::IsExternC();
+  snapshot.is_function_template_specialization = FunctionDecl::IsFunctionTemplateSpecialization();
+  snapshot.is_global = FunctionDecl::IsGlobal();
+  snapshot.is_immediate_escalating = FunctionDecl::IsImmediateEscalating();
+  snapshot.is_immediate_function = FunctionDecl::IsImmediateFunction();
+  snapshot.is_implicitly_instantiable = FunctionDecl::IsImplicitlyInstantiable();
+  snapshot.is_in_extern_c_context = FunctionDecl::IsInExternCContext();
+  snapshot.is_in_extern_cxx_context = FunctionDecl::IsInExternCXXContext();
+  snapshot.is_ineligible_or_not_selected = FunctionDecl::IsIneligibleOrNotSelected();
+  snapshot.is_inline_builtin_declaration = FunctionDecl::IsInlineBuiltinDeclaration();
+  snapshot.is_inline_specified = FunctionDecl::IsInlineSpecified();
+  snapshot.is_inlined = FunctionDecl::IsInlined();
+  snapshot.is_late_template_parsed = FunctionDecl::IsLateTemplateParsed();
+  snapshot.is_msvcrt_entry_point = FunctionDecl::IsMSVCRTEntryPoint();
+  snapshot.is_main = FunctionDecl::IsMain();
+  snapshot.is_member_like_constrained_friend = FunctionDecl::IsMemberLikeConstrainedFriend();
+  snapshot.is_multi_version = FunctionDecl::IsMultiVersion();
+  snapshot.is_no_return = FunctionDecl::IsNoReturn();
+  snapshot.is_overloaded_operator = FunctionDecl::IsOverloadedOperator();
+  snapshot.is_pure = FunctionDecl::IsPure();
+  snapshot.is_replaceable_global_allocation_function = FunctionDecl::IsReplaceableGlobalAllocationFunction();
+  snapshot.is_static = FunctionDecl::IsStatic();
+  snapshot.is_target_clones_multi_version = FunctionDecl::IsTargetClonesMultiVersion();
+  snapshot.is_target_multi_version = FunctionDecl::IsTargetMultiVersion();
+  snapshot.is_template_instantiation = FunctionDecl::IsTemplateInstantiation();
+  snapshot.is_this_declaration_a_definition = FunctionDecl::IsThisDeclarationADefinition();
+  snapshot.is_this_declaration_instantiated_from_a_friend_definition = FunctionDecl::IsThisDeclarationInstantiatedFromAFriendDefinition();
+  snapshot.is_trivial = FunctionDecl::IsTrivial();
+  snapshot.is_trivial_for_call = FunctionDecl::IsTrivialForCall();
+  snapshot.is_user_provided = FunctionDecl::IsUserProvided();
+  snapshot.is_variadic = FunctionDecl::IsVariadic();
+  snapshot.is_virtual_as_written = FunctionDecl::IsVirtualAsWritten();
+  snapshot.uses_seh_try = FunctionDecl::UsesSEHTry();
+  snapshot.will_have_body = FunctionDecl::WillHaveBody();
+  return snapshot;
+}
+
+::pasta::HLSLBufferDeclSnapshot HLSLBufferDecl::Snapshot(void) const {
+  ::pasta::HLSLBufferDeclSnapshot snapshot;
+  static_cast<::pasta::NamedDeclSnapshot &>(snapshot) = NamedDecl::Snapshot();
+  snapshot.l_brace_token = ast->TokenIndexAt(const_cast<clang::HLSLBufferDecl *>(u.HLSLBufferDecl)->getLBraceLoc());
+  snapshot.token_start = ast->TokenIndexAt(const_cast<clang::HLSLBufferDecl *>(u.HLSLBufferDecl)->getLocStart());
+  snapshot.r_brace_token = ast->TokenIndexAt(const_cast<clang::HLSLBufferDecl *>(u.HLSLBufferDecl)->getRBraceLoc());
+  snapshot.is_c_buffer = HLSLBufferDecl::IsCBuffer();
+  return snapshot;
+}
+
+::pasta::IndirectFieldDeclSnapshot IndirectFieldDecl::Snapshot(void) const {
+  ::pasta::IndirectFieldDeclSnapshot snapshot;
+  static_cast<::pasta::ValueDeclSnapshot &>(snapshot) = ValueDecl::Snapshot();
+  snapshot.chaining_size = IndirectFieldDecl::ChainingSize();
+  return snapshot;
+}
+
+::pasta::LabelDeclSnapshot LabelDecl::Snapshot(void) const {
+  ::pasta::LabelDeclSnapshot snapshot;
+  static_cast<::pasta::NamedDeclSnapshot &>(snapshot) = NamedDecl::Snapshot();
+  snapshot.is_gnu_local = LabelDecl::IsGnuLocal();
+  snapshot.is_ms_assembly_label = LabelDecl::IsMSAssemblyLabel();
+  snapshot.is_resolved_ms_assembly_label = LabelDecl::IsResolvedMSAssemblyLabel();
+  return snapshot;
+}
+
+::pasta::MSGuidDeclSnapshot MSGuidDecl::Snapshot(void) const {
+  ::pasta::MSGuidDeclSnapshot snapshot;
+  static_cast<::pasta::ValueDeclSnapshot &>(snapshot) = ValueDecl::Snapshot();
+  return snapshot;
+}
+
+::pasta::MSPropertyDeclSnapshot MSPropertyDecl::Snapshot(void) const {
+  ::pasta::MSPropertyDeclSnapshot snapshot;
+  static_cast<::pasta::DeclaratorDeclSnapshot &>(snapshot) = DeclaratorDecl::Snapshot();
+  snapshot.has_getter = MSPropertyDecl::HasGetter();
+  snapshot.has_setter = MSPropertyDecl::HasSetter();
+  return snapshot;
+}
+
+::pasta::NonTypeTemplateParmDeclSnapshot NonTypeTemplateParmDecl::Snapshot(void) const {
+  ::pasta::NonTypeTemplateParmDeclSnapshot snapshot;
+  static_cast<::pasta::DeclaratorDeclSnapshot &>(snapshot) = DeclaratorDecl::Snapshot();
+  snapshot.default_argument_was_inherited = NonTypeTemplateParmDecl::DefaultArgumentWasInherited();
+  snapshot.default_argument_token = ast->TokenIndexAt(const_cast<clang::NonTypeTemplateParmDecl *>(u.NonTypeTemplateParmDecl)->getDefaultArgumentLoc());
+  snapshot.has_default_argument = NonTypeTemplateParmDecl::HasDefaultArgument();
+  snapshot.has_placeholder_type_constraint = NonTypeTemplateParmDecl::HasPlaceholderTypeConstraint();
+  snapshot.is_expanded_parameter_pack = NonTypeTemplateParmDecl::IsExpandedParameterPack();
+  snapshot.is_pack_expansion = NonTypeTemplateParmDecl::IsPackExpansion();
+  return snapshot;
+}
+
+::pasta::OMPAllocateDeclSnapshot OMPAllocateDecl::Snapshot(void) const {
+  ::pasta::OMPAllocateDeclSnapshot snapshot;
+  static_cast<::pasta::OMPDeclarativeDirectiveDeclSnapshot &>(snapshot) = OMPDeclarativeDirectiveDecl::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPDeclareMapperDeclSnapshot OMPDeclareMapperDecl::Snapshot(void) const {
+  ::pasta::OMPDeclareMapperDeclSnapshot snapshot;
+  static_cast<::pasta::OMPDeclarativeDirectiveValueDeclSnapshot &>(snapshot) = OMPDeclarativeDirectiveValueDecl::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPDeclareReductionDeclSnapshot OMPDeclareReductionDecl::Snapshot(void) const {
+  ::pasta::OMPDeclareReductionDeclSnapshot snapshot;
+  static_cast<::pasta::ValueDeclSnapshot &>(snapshot) = ValueDecl::Snapshot();
+  snapshot.initializer_kind = OMPDeclareReductionDecl::InitializerKind();
+  return snapshot;
+}
+
+::pasta::OMPRequiresDeclSnapshot OMPRequiresDecl::Snapshot(void) const {
+  ::pasta::OMPRequiresDeclSnapshot snapshot;
+  static_cast<::pasta::OMPDeclarativeDirectiveDeclSnapshot &>(snapshot) = OMPDeclarativeDirectiveDecl::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPThreadPrivateDeclSnapshot OMPThreadPrivateDecl::Snapshot(void) const {
+  ::pasta::OMPThreadPrivateDeclSnapshot snapshot;
+  static_cast<::pasta::OMPDeclarativeDirectiveDeclSnapshot &>(snapshot) = OMPDeclarativeDirectiveDecl::Snapshot();
+  return snapshot;
+}
+
+::pasta::ObjCAtDefsFieldDeclSnapshot ObjCAtDefsFieldDecl::Snapshot(void) const {
+  ::pasta::ObjCAtDefsFieldDeclSnapshot snapshot;
+  static_cast<::pasta::FieldDeclSnapshot &>(snapshot) = FieldDecl::Snapshot();
+  return snapshot;
+}
+
+::pasta::ObjCCategoryDeclSnapshot ObjCCategoryDecl::Snapshot(void) const {
+  ::pasta::ObjCCategoryDeclSnapshot snapshot;
+  static_cast<::pasta::ObjCContainerDeclSnapshot &>(snapshot) = ObjCContainerDecl::Snapshot();
+  snapshot.is_class_extension = ObjCCategoryDecl::IsClassExtension();
+  snapshot.category_name_token = ast->TokenIndexAt(const_cast<clang::ObjCCategoryDecl *>(u.ObjCCategoryDecl)->getCategoryNameLoc());
+  snapshot.instance_variable_l_brace_token = ast->TokenIndexAt(const_cast<clang::ObjCCategoryDecl *>(u.ObjCCategoryDecl)->getIvarLBraceLoc());
+  snapshot.instance_variable_r_brace_token = ast->TokenIndexAt(const_cast<clang::ObjCCategoryDecl *>(u.ObjCCategoryDecl)->getIvarRBraceLoc());
+  return snapshot;
+}
+
+::pasta::ObjCCategoryImplDeclSnapshot ObjCCategoryImplDecl::Snapshot(void) const {
+  ::pasta::ObjCCategoryImplDeclSnapshot snapshot;
+  static_cast<::pasta::ObjCImplDeclSnapshot &>(snapshot) = ObjCImplDecl::Snapshot();
+  snapshot.category_name_token = ast->TokenIndexAt(const_cast<clang::ObjCCategoryImplDecl *>(u.ObjCCategoryImplDecl)->getCategoryNameLoc());
+  return snapshot;
+}
+
+::pasta::ObjCIvarDeclSnapshot ObjCIvarDecl::Snapshot(void) const {
+  ::pasta::ObjCIvarDeclSnapshot snapshot;
+  static_cast<::pasta::FieldDeclSnapshot &>(snapshot) = FieldDecl::Snapshot();
+  snapshot.access_control = ObjCIvarDecl::AccessControl();
+  snapshot.canonical_access_control = ObjCIvarDecl::CanonicalAccessControl();
+  snapshot.synthesize = ObjCIvarDecl::Synthesize();
+  return snapshot;
+}
+
+::pasta::ObjCTypeParamDeclSnapshot ObjCTypeParamDecl::Snapshot(void) const {
+  ::pasta::ObjCTypeParamDeclSnapshot snapshot;
+  static_cast<::pasta::TypedefNameDeclSnapshot &>(snapshot) = TypedefNameDecl::Snapshot();
+  snapshot.colon_token = ast->TokenIndexAt(const_cast<clang::ObjCTypeParamDecl *>(u.ObjCTypeParamDecl)->getColonLoc());
+  snapshot.index = ObjCTypeParamDecl::Index();
+  snapshot.variance = ObjCTypeParamDecl::Variance();
+  snapshot.variance_token = ast->TokenIndexAt(const_cast<clang::ObjCTypeParamDecl *>(u.ObjCTypeParamDecl)->getVarianceLoc());
+  snapshot.has_explicit_bound = ObjCTypeParamDecl::HasExplicitBound();
+  return snapshot;
+}
+
+::pasta::RedeclarableTemplateDeclSnapshot RedeclarableTemplateDecl::Snapshot(void) const {
+  ::pasta::RedeclarableTemplateDeclSnapshot snapshot;
+  static_cast<::pasta::TemplateDeclSnapshot &>(snapshot) = TemplateDecl::Snapshot();
+  snapshot.is_member_specialization = RedeclarableTemplateDecl::IsMemberSpecialization();
+  return snapshot;
+}
+
+::pasta::TagDeclSnapshot TagDecl::Snapshot(void) const {
+  ::pasta::TagDeclSnapshot snapshot;
+  static_cast<::pasta::TypeDeclSnapshot &>(snapshot) = TypeDecl::Snapshot();
+  snapshot.first_inner_token = ast->TokenIndexAt(const_cast<clang::TagDecl *>(u.TagDecl)->getInnerLocStart());
+  snapshot.num_template_parameter_lists = TagDecl::NumTemplateParameterLists();
+  snapshot.first_outer_token = ast->TokenIndexAt(const_cast<clang::TagDecl *>(u.TagDecl)->getOuterLocStart());
+  snapshot.tag_kind = TagDecl::TagKind();
+  snapshot.has_name_for_linkage = TagDecl::HasNameForLinkage();
+  snapshot.is_being_defined = TagDecl::IsBeingDefined();
+  snapshot.is_class = TagDecl::IsClass();
+  snapshot.is_complete_definition = TagDecl::IsCompleteDefinition();
+  snapshot.is_complete_definition_required = TagDecl::IsCompleteDefinitionRequired();
+  snapshot.is_dependent_type = TagDecl::IsDependentType();
+  snapshot.is_embedded_in_declarator = TagDecl::IsEmbeddedInDeclarator();
+  snapshot.is_enum = TagDecl::IsEnum();
+  snapshot.is_free_standing = TagDecl::IsFreeStanding();
+  snapshot.is_interface = TagDecl::IsInterface();
+  snapshot.is_struct = TagDecl::IsStruct();
+  snapshot.is_this_declaration_a_definition = TagDecl::IsThisDeclarationADefinition();
+  snapshot.is_this_declaration_a_demoted_definition = TagDecl::IsThisDeclarationADemotedDefinition();
+  snapshot.is_union = TagDecl::IsUnion();
+  snapshot.may_have_out_of_date_definition = TagDecl::MayHaveOutOfDateDefinition();
+  return snapshot;
+}
+
+::pasta::TemplateParamObjectDeclSnapshot TemplateParamObjectDecl::Snapshot(void) const {
+  ::pasta::TemplateParamObjectDeclSnapshot snapshot;
+  static_cast<::pasta::ValueDeclSnapshot &>(snapshot) = ValueDecl::Snapshot();
+  return snapshot;
+}
+
+::pasta::TemplateTypeParmDeclSnapshot TemplateTypeParmDecl::Snapshot(void) const {
+  ::pasta::TemplateTypeParmDeclSnapshot snapshot;
+  static_cast<::pasta::TypeDeclSnapshot &>(snapshot) = TypeDecl::Snapshot();
+  snapshot.default_argument_was_inherited = TemplateTypeParmDecl::DefaultArgumentWasInherited();
+  snapshot.default_argument_token = ast->TokenIndexAt(const_cast<clang::TemplateTypeParmDecl *>(u.TemplateTypeParmDecl)->getDefaultArgumentLoc());
+  snapshot.depth = TemplateTypeParmDecl::Depth();
+  snapshot.index = TemplateTypeParmDecl::Index();
+  if (const auto &self = *(u.TemplateTypeParmDecl); self.isExpandedParameterPack()) {
+    snapshot.num_expansion_parameters = TemplateTypeParmDecl::NumExpansionParameters();
+  }
+  snapshot.has_default_argument = TemplateTypeParmDecl::HasDefaultArgument();
+  snapshot.has_type_constraint = TemplateTypeParmDecl::HasTypeConstraint();
+  snapshot.is_expanded_parameter_pack = TemplateTypeParmDecl::IsExpandedParameterPack();
+  snapshot.is_pack_expansion = TemplateTypeParmDecl::IsPackExpansion();
+  snapshot.was_declared_with_typename = TemplateTypeParmDecl::WasDeclaredWithTypename();
+  return snapshot;
+}
+
+::pasta::TypeAliasDeclSnapshot TypeAliasDecl::Snapshot(void) const {
+  ::pasta::TypeAliasDeclSnapshot snapshot;
+  static_cast<::pasta::TypedefNameDeclSnapshot &>(snapshot) = TypedefNameDecl::Snapshot();
+  return snapshot;
+}
+
+::pasta::TypeAliasTemplateDeclSnapshot TypeAliasTemplateDecl::Snapshot(void) const {
+  ::pasta::TypeAliasTemplateDeclSnapshot snapshot;
+  static_cast<::pasta::RedeclarableTemplateDeclSnapshot &>(snapshot) = RedeclarableTemplateDecl::Snapshot();
+  return snapshot;
+}
+
+::pasta::TypedefDeclSnapshot TypedefDecl::Snapshot(void) const {
+  ::pasta::TypedefDeclSnapshot snapshot;
+  static_cast<::pasta::TypedefNameDeclSnapshot &>(snapshot) = TypedefNameDecl::Snapshot();
+  return snapshot;
+}
+
+::pasta::UnnamedGlobalConstantDeclSnapshot UnnamedGlobalConstantDecl::Snapshot(void) const {
+  ::pasta::UnnamedGlobalConstantDeclSnapshot snapshot;
+  static_cast<::pasta::ValueDeclSnapshot &>(snapshot) = ValueDecl::Snapshot();
+  return snapshot;
+}
+
+::pasta::UnresolvedUsingValueDeclSnapshot UnresolvedUsingValueDecl::Snapshot(void) const {
+  ::pasta::UnresolvedUsingValueDeclSnapshot snapshot;
+  static_cast<::pasta::ValueDeclSnapshot &>(snapshot) = ValueDecl::Snapshot();
+  snapshot.ellipsis_token = ast->TokenIndexAt(const_cast<clang::UnresolvedUsingValueDecl *>(u.UnresolvedUsingValueDecl)->getEllipsisLoc());
+  snapshot.using_token = ast->TokenIndexAt(const_cast<clang::UnresolvedUsingValueDecl *>(u.UnresolvedUsingValueDecl)->getUsingLoc());
+  snapshot.is_access_declaration = UnresolvedUsingValueDecl::IsAccessDeclaration();
+  snapshot.is_pack_expansion = UnresolvedUsingValueDecl::IsPackExpansion();
+  return snapshot;
+}
+
+::pasta::UsingDeclSnapshot UsingDecl::Snapshot(void) const {
+  ::pasta::UsingDeclSnapshot snapshot;
+  static_cast<::pasta::BaseUsingDeclSnapshot &>(snapshot) = BaseUsingDecl::Snapshot();
+  snapshot.using_token = ast->TokenIndexAt(const_cast<clang::UsingDecl *>(u.UsingDecl)->getUsingLoc());
+  snapshot.has_typename = UsingDecl::HasTypename();
+  snapshot.is_access_declaration = UsingDecl::IsAccessDeclaration();
+  return snapshot;
+}
+
+::pasta::UsingEnumDeclSnapshot UsingEnumDecl::Snapshot(void) const {
+  ::pasta::UsingEnumDeclSnapshot snapshot;
+  static_cast<::pasta::BaseUsingDeclSnapshot &>(snapshot) = BaseUsingDecl::Snapshot();
+  snapshot.enum_token = ast->TokenIndexAt(const_cast<clang::UsingEnumDecl *>(u.UsingEnumDecl)->getEnumLoc());
+  snapshot.using_token = ast->TokenIndexAt(const_cast<clang::UsingEnumDecl *>(u.UsingEnumDecl)->getUsingLoc());
+  return snapshot;
+}
+
+::pasta::VarDeclSnapshot VarDecl::Snapshot(void) const {
+  ::pasta::VarDeclSnapshot snapshot;
+  static_cast<::pasta::DeclaratorDeclSnapshot &>(snapshot) = DeclaratorDecl::Snapshot();
+  snapshot.initializer_style = VarDecl::InitializerStyle();
+  snapshot.language_linkage = VarDecl::LanguageLinkage();
+  snapshot.point_of_instantiation = ast->TokenIndexAt(const_cast<clang::VarDecl *>(u.VarDecl)->getPointOfInstantiation());
+  snapshot.storage_class = VarDecl::StorageClass();
+  snapshot.storage_duration = VarDecl::StorageDuration();
+  snapshot.tls_kind = VarDecl::TLSKind();
+  snapshot.tsc_spec = VarDecl::TSCSpec();
+  snapshot.template_specialization_kind = VarDecl::TemplateSpecializationKind();
+  snapshot.template_specialization_kind_for_instantiation = VarDecl::TemplateSpecializationKindForInstantiation();
+  snapshot.has_constant_initialization = VarDecl::HasConstantInitialization();
+  snapshot.has_dependent_alignment = VarDecl::HasDependentAlignment();
+  snapshot.has_external_storage = VarDecl::HasExternalStorage();
+  snapshot.has_global_storage = VarDecl::HasGlobalStorage();
+  snapshot.has_initializer = VarDecl::HasInitializer();
+  snapshot.has_local_storage = VarDecl::HasLocalStorage();
+  snapshot.is_arc_pseudo_strong = VarDecl::IsARCPseudoStrong();
+  snapshot.is_cxx_for_range_declaration = VarDecl::IsCXXForRangeDeclaration();
+  snapshot.is_constexpr = VarDecl::IsConstexpr();
+  snapshot.is_direct_initializer = VarDecl::IsDirectInitializer();
+  snapshot.is_escaping_byref = VarDecl::IsEscapingByref();
+  snapshot.is_exception_variable = VarDecl::IsExceptionVariable();
+  snapshot.is_extern_c = VarDecl::IsExternC();
+  snapshot.is_file_variable_declaration = VarDecl::IsFileVariableDeclaration();
+  snapshot.is_function_or_method_variable_declaration = VarDecl::IsFunctionOrMethodVariableDeclaration();
+  snapshot.is_in_extern_c_context = VarDecl::IsInExternCContext();
+  snapshot.is_in_extern_cxx_context = VarDecl::IsInExternCXXContext();
+  snapshot.is_inline = VarDecl::IsInline();
+  snapshot.is_inline_specified = VarDecl::IsInlineSpecified();
+  snapshot.is_known_to_be_defined = VarDecl::IsKnownToBeDefined();
+  snapshot.is_local_variable_declaration = VarDecl::IsLocalVariableDeclaration();
+  snapshot.is_local_variable_declaration_or_parm = VarDecl::IsLocalVariableDeclarationOrParm();
+  snapshot.is_nrvo_variable = VarDecl::IsNRVOVariable();
+  snapshot.is_no_destroy = VarDecl::IsNoDestroy();
+  snapshot.is_non_escaping_byref = VarDecl::IsNonEscapingByref();
+  snapshot.is_obj_c_for_declaration = VarDecl::IsObjCForDeclaration();
+  snapshot.is_previous_declaration_in_same_block_scope = VarDecl::IsPreviousDeclarationInSameBlockScope();
+  snapshot.is_static_data_member = VarDecl::IsStaticDataMember();
+  snapshot.is_static_local = VarDecl::IsStaticLocal();
+  snapshot.is_this_declaration_a_demoted_definition = VarDecl::IsThisDeclarationADemotedDefinition();
+  snapshot.is_usable_in_constant_expressions = VarDecl::IsUsableInConstantExpressions();
+  snapshot.might_be_usable_in_constant_expressions = VarDecl::MightBeUsableInConstantExpressions();
+  return snapshot;
+}
+
+::pasta::VarTemplateDeclSnapshot VarTemplateDecl::Snapshot(void) const {
+  ::pasta::VarTemplateDeclSnapshot snapshot;
+  static_cast<::pasta::RedeclarableTemplateDeclSnapshot &>(snapshot) = RedeclarableTemplateDecl::Snapshot();
+  snapshot.is_this_declaration_a_definition = VarTemplateDecl::IsThisDeclarationADefinition();
+  return snapshot;
+}
+
+::pasta::VarTemplateSpecializationDeclSnapshot VarTemplateSpecializationDecl::Snapshot(void) const {
+  ::pasta::VarTemplateSpecializationDeclSnapshot snapshot;
+  static_cast<::pasta::VarDeclSnapshot &>(snapshot) = VarDecl::Snapshot();
+  snapshot.extern_token = ast->TokenIndexAt(const_cast<clang::VarTemplateSpecializationDecl *>(u.VarTemplateSpecializationDecl)->getExternLoc());
+  snapshot.specialization_kind = VarTemplateSpecializationDecl::SpecializationKind();
+  snapshot.template_keyword_token = ast->TokenIndexAt(const_cast<clang::VarTemplateSpecializationDecl *>(u.VarTemplateSpecializationDecl)->getTemplateKeywordLoc());
+  snapshot.is_class_scope_explicit_specialization = VarTemplateSpecializationDecl::IsClassScopeExplicitSpecialization();
+  snapshot.is_explicit_instantiation_or_specialization = VarTemplateSpecializationDecl::IsExplicitInstantiationOrSpecialization();
+  snapshot.is_explicit_specialization = VarTemplateSpecializationDecl::IsExplicitSpecialization();
+  return snapshot;
+}
+
+::pasta::CXXDeductionGuideDeclSnapshot CXXDeductionGuideDecl::Snapshot(void) const {
+  ::pasta::CXXDeductionGuideDeclSnapshot snapshot;
+  static_cast<::pasta::FunctionDeclSnapshot &>(snapshot) = FunctionDecl::Snapshot();
+  snapshot.deduction_candidate_kind = CXXDeductionGuideDecl::DeductionCandidateKind();
+  snapshot.is_explicit = CXXDeductionGuideDecl::IsExplicit();
+  return snapshot;
+}
+
+::pasta::CXXMethodDeclSnapshot CXXMethodDecl::Snapshot(void) const {
+  ::pasta::CXXMethodDeclSnapshot snapshot;
+  static_cast<::pasta::FunctionDeclSnapshot &>(snapshot) = FunctionDecl::Snapshot();
+  snapshot.reference_qualifier = CXXMethodDecl::ReferenceQualifier();
+  snapshot.has_inline_body = CXXMethodDecl::HasInlineBody();
+  snapshot.is_const = CXXMethodDecl::IsConst();
+  snapshot.is_copy_assignment_operator = CXXMethodDecl::IsCopyAssignmentOperator();
+  snapshot.is_instance = CXXMethodDecl::IsInstance();
+  snapshot.is_lambda_static_invoker = CXXMethodDecl::IsLambdaStaticInvoker();
+  snapshot.is_move_assignment_operator = CXXMethodDecl::IsMoveAssignmentOperator();
+  snapshot.is_virtual = CXXMethodDecl::IsVirtual();
+  snapshot.is_volatile = CXXMethodDecl::IsVolatile();
+  snapshot.size_overridden_methods = CXXMethodDecl::SizeOverriddenMethods();
+  return snapshot;
+}
+
+::pasta::ClassTemplateDeclSnapshot ClassTemplateDecl::Snapshot(void) const {
+  ::pasta::ClassTemplateDeclSnapshot snapshot;
+  static_cast<::pasta::RedeclarableTemplateDeclSnapshot &>(snapshot) = RedeclarableTemplateDecl::Snapshot();
+  snapshot.is_this_declaration_a_definition = ClassTemplateDecl::IsThisDeclarationADefinition();
+  return snapshot;
+}
+
+::pasta::DecompositionDeclSnapshot DecompositionDecl::Snapshot(void) const {
+  ::pasta::DecompositionDeclSnapshot snapshot;
+  static_cast<::pasta::VarDeclSnapshot &>(snapshot) = VarDecl::Snapshot();
+  return snapshot;
+}
+
+::pasta::EnumDeclSnapshot EnumDecl::Snapshot(void) const {
+  ::pasta::EnumDeclSnapshot snapshot;
+  static_cast<::pasta::TagDeclSnapshot &>(snapshot) = TagDecl::Snapshot();
+  snapshot.num_negative_bits = EnumDecl::NumNegativeBits();
+  snapshot.num_positive_bits = EnumDecl::NumPositiveBits();
+  snapshot.template_specialization_kind = EnumDecl::TemplateSpecializationKind();
+  snapshot.is_closed = EnumDecl::IsClosed();
+  snapshot.is_closed_flag = EnumDecl::IsClosedFlag();
+  snapshot.is_closed_non_flag = EnumDecl::IsClosedNonFlag();
+  snapshot.is_complete = EnumDecl::IsComplete();
+  snapshot.is_fixed = EnumDecl::IsFixed();
+  snapshot.is_scoped = EnumDecl::IsScoped();
+  snapshot.is_scoped_using_class_tag = EnumDecl::IsScopedUsingClassTag();
+  return snapshot;
+}
+
+::pasta::FunctionTemplateDeclSnapshot FunctionTemplateDecl::Snapshot(void) const {
+  ::pasta::FunctionTemplateDeclSnapshot snapshot;
+  static_cast<::pasta::RedeclarableTemplateDeclSnapshot &>(snapshot) = RedeclarableTemplateDecl::Snapshot();
+  snapshot.is_abbreviated = FunctionTemplateDecl::IsAbbreviated();
+  snapshot.is_this_declaration_a_definition = FunctionTemplateDecl::IsThisDeclarationADefinition();
+  return snapshot;
+}
+
+::pasta::ImplicitParamDeclSnapshot ImplicitParamDecl::Snapshot(void) const {
+  ::pasta::ImplicitParamDeclSnapshot snapshot;
+  static_cast<::pasta::VarDeclSnapshot &>(snapshot) = VarDecl::Snapshot();
+  snapshot.parameter_kind = ImplicitParamDecl::ParameterKind();
+  return snapshot;
+}
+
+::pasta::OMPCapturedExprDeclSnapshot OMPCapturedExprDecl::Snapshot(void) const {
+  ::pasta::OMPCapturedExprDeclSnapshot snapshot;
+  static_cast<::pasta::VarDeclSnapshot &>(snapshot) = VarDecl::Snapshot();
+  return snapshot;
+}
+
+::pasta::ParmVarDeclSnapshot ParmVarDecl::Snapshot(void) const {
+  ::pasta::ParmVarDeclSnapshot snapshot;
+  static_cast<::pasta::VarDeclSnapshot &>(snapshot) = VarDecl::Snapshot();
+  snapshot.function_scope_depth = ParmVarDecl::FunctionScopeDepth();
+  snapshot.function_scope_index = ParmVarDecl::FunctionScopeIndex();
+  snapshot.obj_c_decl_qualifier = ParmVarDecl::ObjCDeclQualifier();
+  snapshot.has_default_argument = ParmVarDecl::HasDefaultArgument();
+  snapshot.has_inherited_default_argument = ParmVarDecl::HasInheritedDefaultArgument();
+  snapshot.has_uninstantiated_default_argument = ParmVarDecl::HasUninstantiatedDefaultArgument();
+  snapshot.has_unparsed_default_argument = ParmVarDecl::HasUnparsedDefaultArgument();
+  snapshot.is_destroyed_in_callee = ParmVarDecl::IsDestroyedInCallee();
+  snapshot.is_knr_promoted = ParmVarDecl::IsKNRPromoted();
+  snapshot.is_obj_c_method_parameter = ParmVarDecl::IsObjCMethodParameter();
+  return snapshot;
+}
+
+::pasta::RecordDeclSnapshot RecordDecl::Snapshot(void) const {
+  ::pasta::RecordDeclSnapshot snapshot;
+  static_cast<::pasta::TagDeclSnapshot &>(snapshot) = TagDecl::Snapshot();
+  snapshot.can_pass_in_registers = RecordDecl::CanPassInRegisters();
+  snapshot.argument_passing_restrictions = RecordDecl::ArgumentPassingRestrictions();
+  snapshot.has_flexible_array_member = RecordDecl::HasFlexibleArrayMember();
+  snapshot.has_loaded_fields_from_external_storage = RecordDecl::HasLoadedFieldsFromExternalStorage();
+  snapshot.has_non_trivial_to_primitive_copy_c_union = RecordDecl::HasNonTrivialToPrimitiveCopyCUnion();
+  snapshot.has_non_trivial_to_primitive_default_initialize_c_union = RecordDecl::HasNonTrivialToPrimitiveDefaultInitializeCUnion();
+  snapshot.has_non_trivial_to_primitive_destruct_c_union = RecordDecl::HasNonTrivialToPrimitiveDestructCUnion();
+  snapshot.has_object_member = RecordDecl::HasObjectMember();
+  snapshot.has_volatile_member = RecordDecl::HasVolatileMember();
+  snapshot.is_anonymous_struct_or_union = RecordDecl::IsAnonymousStructOrUnion();
+  snapshot.is_captured_record = RecordDecl::IsCapturedRecord();
+  snapshot.is_injected_class_name = RecordDecl::IsInjectedClassName();
+  snapshot.is_lambda = RecordDecl::IsLambda();
+  snapshot.is_ms_struct = RecordDecl::IsMsStruct();
+  snapshot.is_non_trivial_to_primitive_copy = RecordDecl::IsNonTrivialToPrimitiveCopy();
+  snapshot.is_non_trivial_to_primitive_default_initialize = RecordDecl::IsNonTrivialToPrimitiveDefaultInitialize();
+  snapshot.is_non_trivial_to_primitive_destroy = RecordDecl::IsNonTrivialToPrimitiveDestroy();
+  snapshot.is_or_contains_union = RecordDecl::IsOrContainsUnion();
+  snapshot.is_parameter_destroyed_in_callee = RecordDecl::IsParameterDestroyedInCallee();
+  snapshot.is_randomized = RecordDecl::IsRandomized();
+  snapshot.may_insert_extra_padding = RecordDecl::MayInsertExtraPadding();
+  return snapshot;
+}
+
+::pasta::VarTemplatePartialSpecializationDeclSnapshot VarTemplatePartialSpecializationDecl::Snapshot(void) const {
+  ::pasta::VarTemplatePartialSpecializationDeclSnapshot snapshot;
+  static_cast<::pasta::VarTemplateSpecializationDeclSnapshot &>(snapshot) = VarTemplateSpecializationDecl::Snapshot();
+  snapshot.has_associated_constraints = VarTemplatePartialSpecializationDecl::HasAssociatedConstraints();
+  return snapshot;
+}
+
+::pasta::CXXConstructorDeclSnapshot CXXConstructorDecl::Snapshot(void) const {
+  ::pasta::CXXConstructorDeclSnapshot snapshot;
+  static_cast<::pasta::CXXMethodDeclSnapshot &>(snapshot) = CXXMethodDecl::Snapshot();
+  snapshot.num_constructor_initializers = CXXConstructorDecl::NumConstructorInitializers();
+  snapshot.is_default_constructor = CXXConstructorDecl::IsDefaultConstructor();
+  snapshot.is_delegating_constructor = CXXConstructorDecl::IsDelegatingConstructor();
+  snapshot.is_explicit = CXXConstructorDecl::IsExplicit();
+  snapshot.is_inheriting_constructor = CXXConstructorDecl::IsInheritingConstructor();
+  snapshot.is_specialization_copying_object = CXXConstructorDecl::IsSpecializationCopyingObject();
+  return snapshot;
+}
+
+::pasta::CXXConversionDeclSnapshot CXXConversionDecl::Snapshot(void) const {
+  ::pasta::CXXConversionDeclSnapshot snapshot;
+  static_cast<::pasta::CXXMethodDeclSnapshot &>(snapshot) = CXXMethodDecl::Snapshot();
+  snapshot.is_explicit = CXXConversionDecl::IsExplicit();
+  snapshot.is_lambda_to_block_pointer_conversion = CXXConversionDecl::IsLambdaToBlockPointerConversion();
+  return snapshot;
+}
+
+::pasta::CXXDestructorDeclSnapshot CXXDestructorDecl::Snapshot(void) const {
+  ::pasta::CXXDestructorDeclSnapshot snapshot;
+  static_cast<::pasta::CXXMethodDeclSnapshot &>(snapshot) = CXXMethodDecl::Snapshot();
+  return snapshot;
+}
+
+::pasta::CXXRecordDeclSnapshot CXXRecordDecl::Snapshot(void) const {
+  ::pasta::CXXRecordDeclSnapshot snapshot;
+  static_cast<::pasta::RecordDeclSnapshot &>(snapshot) = RecordDecl::Snapshot();
+  if (const auto &self = *(u.CXXRecordDecl); self.isLambda()) {
+    snapshot.device_lambda_mangling_number = CXXRecordDecl::DeviceLambdaManglingNumber();
+  }
+  snapshot.lambda_dependency_kind = CXXRecordDecl::LambdaDependencyKind();
+  if (const auto &self = *(u.CXXRecordDecl); self.isLambda()) {
+    snapshot.lambda_index_in_context = CXXRecordDecl::LambdaIndexInContext();
+  }
+  snapshot.ms_vtor_disp_mode = CXXRecordDecl::MSVtorDispMode();
+  snapshot.template_specialization_kind = CXXRecordDecl::TemplateSpecializationKind();
+  snapshot.is_dependent_lambda = CXXRecordDecl::IsDependentLambda();
+  snapshot.is_generic_lambda = CXXRecordDecl::IsGenericLambda();
+  snapshot.is_never_dependent_lambda = CXXRecordDecl::IsNeverDependentLambda();
+  return snapshot;
+}
+
+::pasta::ClassTemplateSpecializationDeclSnapshot ClassTemplateSpecializationDecl::Snapshot(void) const {
+  ::pasta::ClassTemplateSpecializationDeclSnapshot snapshot;
+  static_cast<::pasta::CXXRecordDeclSnapshot &>(snapshot) = CXXRecordDecl::Snapshot();
+  snapshot.extern_token = ast->TokenIndexAt(const_cast<clang::ClassTemplateSpecializationDecl *>(u.ClassTemplateSpecializationDecl)->getExternLoc());
+  snapshot.point_of_instantiation = ast->TokenIndexAt(const_cast<clang::ClassTemplateSpecializationDecl *>(u.ClassTemplateSpecializationDecl)->getPointOfInstantiation());
+  snapshot.specialization_kind = ClassTemplateSpecializationDecl::SpecializationKind();
+  snapshot.template_keyword_token = ast->TokenIndexAt(const_cast<clang::ClassTemplateSpecializationDecl *>(u.ClassTemplateSpecializationDecl)->getTemplateKeywordLoc());
+  snapshot.is_class_scope_explicit_specialization = ClassTemplateSpecializationDecl::IsClassScopeExplicitSpecialization();
+  snapshot.is_explicit_instantiation_or_specialization = ClassTemplateSpecializationDecl::IsExplicitInstantiationOrSpecialization();
+  snapshot.is_explicit_specialization = ClassTemplateSpecializationDecl::IsExplicitSpecialization();
+  return snapshot;
+}
+
+::pasta::ClassTemplatePartialSpecializationDeclSnapshot ClassTemplatePartialSpecializationDecl::Snapshot(void) const {
+  ::pasta::ClassTemplatePartialSpecializationDeclSnapshot snapshot;
+  static_cast<::pasta::ClassTemplateSpecializationDeclSnapshot &>(snapshot) = ClassTemplateSpecializationDecl::Snapshot();
+  snapshot.has_associated_constraints = ClassTemplatePartialSpecializationDecl::HasAssociatedConstraints();
+  return snapshot;
+}
+
 }  // namespace pasta
 #endif  // PASTA_IN_BOOTSTRAP
@@ -558,25 +558,34 @@ std::optional<uint64_t> FieldDecl::OffsetInBits(void) const noexcept {
 // the `DeclBoundsFinder` on the function, and try to discover key locations
 // in the "prorotype" of the function, updating `ASTImpl::func_proto`. Then,
 // we can try to find the true ellipsis token.
+TokenImpl *ASTImpl::FunctionEllipsisToken(const clang::FunctionDecl *func_) {
+  auto func = const_cast<clang::FunctionDecl *>(func_);
+  if (!func->getEllipsisLoc().isValid()) {
+    return nullptr;
+  }
+
+  std::unique_lock<std::mutex> locker(bounds_mutex);
+  auto [begin_tok, end_tok] = DeclBounds(func);
+  if (auto it = func_proto.find(func); it != func_proto.end()) {
+    assert(!it->second.ellipsis || begin_tok < it->second.ellipsis);
+    assert(!it->second.ellipsis || it->second.ellipsis < end_tok);
+    (void) begin_tok;
+    (void) end_tok;
+    return it->second.ellipsis;
+  }
+  return nullptr;
+}
+
 ::pasta::Token FunctionDecl::EllipsisToken(void) const {
-  auto &self = *const_cast<clang::FunctionDecl *>(u.FunctionDecl);
-  if (self.getEllipsisLoc().isValid()) {
-    auto [begin_tok, end_tok] = ast->DeclBounds(&self);
-    if (auto it = ast->func_proto.find(&self); it != ast->func_proto.end()) {
-      if (it->second.ellipsis == nullptr) {
-        return ::pasta::Token(ast);
-      }
-      assert(begin_tok < it->second.ellipsis);
-      assert(it->second.ellipsis < end_tok);
-      (void) begin_tok;
-      return ::pasta::Token(ast, it->second.ellipsis);
-    }
+  if (auto tok = ast->FunctionEllipsisToken(u.FunctionDecl)) {
+    return ::pasta::Token(ast, tok);
   }
   return ::pasta::Token(ast);
 }
 
 ::pasta::TokenRange FunctionDecl::ParametersTokens(void) const {
   auto &self = *const_cast<clang::FunctionDecl *>(u.FunctionDecl);
+  std::unique_lock<std::mutex> locker(ast->bounds_mutex);
   (void) ast->DeclBounds(&self);
   if (auto it = ast->func_proto.find(&self); it != ast->func_proto.end()) {
     ASTImpl::FunctionProto &proto = it->second;
@@ -0,0 +1,516 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#include <pasta/AST/EntityExport.h>
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wimplicit-int-conversion"
+#pragma clang diagnostic ignored "-Wsign-conversion"
+#pragma clang diagnostic ignored "-Wshorten-64-to-32"
+#include <clang/AST/Decl.h>
+#include <clang/AST/Expr.h>
+#include <clang/AST/Stmt.h>
+#pragma clang diagnostic pop
+
+#include <pasta/AST/AST.h>
+#include <pasta/AST/Decl.h>
+#include <pasta/AST/Walker.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "AST.h"
+
+namespace pasta {
+namespace {
+
+// NOTE(pag): The format is a header, immediately followed by the entities,
+//            then the references, and then the string table. Everything is
+//            in the host's byte order. The magic is a byte string, and so it
+//            matches regardless of byte order, but the version doesn't, and so
+//            loading an export made on a host with a different byte order
+//            fails the version check.
+static constexpr char kMagic[8] = {'P', 'A', 'S', 'T', 'A', 'E', 'N', 'T'};
+
+struct ExportHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t num_entities;
+  uint32_t num_references;
+  uint32_t strings_size;
+};
+
+static_assert(std::is_trivially_copyable_v<ExportHeader>);
+static_assert(std::is_trivially_copyable_v<ExportedEntity>);
+static_assert(std::is_trivially_copyable_v<ExportedReference>);
+static_assert(sizeof(ExportedEntity) == 28u);
+static_assert(sizeof(ExportedReference) == 12u);
+static_assert(sizeof(ExportHeader) % alignof(ExportedEntity) == 0u);
+static_assert(sizeof(ExportedEntity) % alignof(ExportedReference) == 0u);
+
+static constexpr size_t kAlignment =
+    std::max({alignof(ExportHeader), alignof(ExportedEntity),
+              alignof(ExportedReference)});
+
+static uint32_t CheckedSize(size_t size) {
+  assert(size < std::numeric_limits<uint32_t>::max());
+  return static_cast<uint32_t>(size);
+}
+
+// A reference whose target hasn't yet been resolved to an entity index.
+struct PendingReference {
+  uint32_t from;
+  const clang::Decl *to;
+  ExportedReferenceKind kind;
+};
+
+// The entities exported from one top-level declaration. All indices and
+// offsets are local to the shard until `Finalize` is called.
+struct Shard {
+  std::vector<ExportedEntity> entities;
+  std::vector<PendingReference> pending_references;
+  std::vector<ExportedReference> references;
+  std::string strings;
+
+  // Exported declarations, and their local indices.
+  std::vector<std::pair<const clang::Decl *, uint32_t>> decls;
+
+  // Named declarations whose names aren't identifiers, and the local indices
+  // of their entities. See `AddPendingNames`.
+  std::vector<std::pair<const clang::NamedDecl *, uint32_t>> pending_names;
+
+  // Local indices of the entities currently being walked.
+  std::vector<uint32_t> parents;
+
+  // Index of the first entity of this shard, offset of the strings of this
+  // shard in the string table, and index of the first reference of this
+  // shard.
+  uint32_t first_entity{0u};
+  uint32_t first_string{0u};
+  uint32_t first_reference{0u};
+
+  // Name the entities in `pending_names`.
+  //
+  // NOTE(pag): Names that aren't identifiers, e.g. those of operators and
+  //            conversion functions, are printed by Clang, which isn't safe to
+  //            do concurrently, and so this happens after the parallel walk.
+  void AddPendingNames(void) {
+    for (auto [nd, index] : pending_names) {
+      ExportedEntity &entity = entities[index];
+      entity.name_offset = CheckedSize(strings.size());
+      strings.append(nd->getDeclName().getAsString());
+      entity.name_length = CheckedSize(strings.size()) - entity.name_offset;
+    }
+    pending_names.clear();
+  }
+
+  // Make the entities of this shard global, and resolve its references.
+  void Finalize(
+      const std::unordered_map<const clang::Decl *, uint32_t> &decl_indices) {
+    for (ExportedEntity &entity : entities) {
+      if (entity.parent == kInvalidExportIndex) {
+        entity.parent = 0u;  // The translation unit.
+      } else {
+        entity.parent += first_entity;
+      }
+      entity.name_offset += first_string;
+    }
+
+    references.reserve(pending_references.size());
+    for (const PendingReference &pending : pending_references) {
+      if (auto it = decl_indices.find(pending.to); it != decl_indices.end()) {
+        ExportedReference &ref = references.emplace_back();
+        ref.from = pending.from + first_entity;
+        ref.to = it->second;
+        ref.kind = pending.kind;
+      }
+    }
+    pending_references.clear();
+    pending_references.shrink_to_fit();
+  }
+};
+
+// The shard into which the calling thread is exporting, if any.
+static thread_local Shard *tShard = nullptr;
+
+// Exports everything reachable from each top-level declaration into the
+// shard of that declaration. `Walker::WalkInParallel` walks each top-level
+// declaration on a single thread, and so each thread exports into one shard at
+// a time, which is tracked by `tShard`.
+class ShardExporter final : public Walker {
+ public:
+  ASTImpl &ast;
+  std::vector<Shard> &shards;
+
+  // Maps top-level declarations to the indices of their shards.
+  const std::unordered_map<const clang::Decl *, size_t> &shard_indices;
+
+  explicit ShardExporter(
+      ASTImpl &ast_, std::vector<Shard> &shards_,
+      const std::unordered_map<const clang::Decl *, size_t> &shard_indices_)
+      : ast(ast_),
+        shards(shards_),
+        shard_indices(shard_indices_) {}
+
+  virtual ~ShardExporter(void) = default;
+
+  ExportedEntity &Enter(Shard &shard, clang::SourceRange range,
+                        clang::SourceLocation loc, uint16_t kind,
+                        ExportedEntityCategory category) {
+    const uint32_t index = CheckedSize(shard.entities.size());
+    ExportedEntity &entity = shard.entities.emplace_back();
+    entity.parent = shard.parents.empty() ? kInvalidExportIndex :
+                    shard.parents.back();
+    entity.first_token = ast.TokenIndexAt(range.getBegin());
+    entity.last_token = ast.TokenIndexAt(range.getEnd());
+    entity.token = ast.TokenIndexAt(loc);
+    entity.kind = kind;
+    entity.category = category;
+
+    // NOTE(pag): This mirrors `ASTImpl::TokenRangeFrom`.
+    if (entity.first_token == kInvalidTokenIndex) {
+      entity.first_token = entity.last_token;
+    } else if (entity.last_token == kInvalidTokenIndex) {
+      entity.last_token = entity.first_token;
+    } else if (entity.last_token < entity.first_token) {
+      std::swap(entity.first_token, entity.last_token);
+    }
+
+    shard.parents.push_back(index);
+    return entity;
+  }
+
+  static void AddReference(Shard &shard, const clang::Decl *to,
+                           ExportedReferenceKind kind) {
+    if (to) {
+      shard.pending_references.push_back(
+          PendingReference{shard.parents.back(), to, kind});
+    }
+  }
+
+  static void SetName(Shard &shard, ExportedEntity &entity,
+                      const clang::NamedDecl *nd) {
+    entity.name_offset = CheckedSize(shard.strings.size());
+    if (const clang::IdentifierInfo *ii = nd->getIdentifier()) {
+      shard.strings.append(ii->getName().data(), ii->getName().size());
+    } else if (!nd->getDeclName().isEmpty()) {
+      shard.pending_names.emplace_back(nd, shard.parents.back());
+    }
+    entity.name_length = CheckedSize(shard.strings.size()) -
+                         entity.name_offset;
+  }
+
+  bool PreVisit(BorrowedDecl decl) final {
+    const clang::Decl *raw_decl = decl.RawDecl();
+    if (!tShard) {
+      auto it = shard_indices.find(raw_decl);
+      if (it == shard_indices.end()) {
+        return true;  // The translation unit.
+      }
+      tShard = &(shards[it->second]);
+    }
+
+    Shard &shard = *tShard;
+    ExportedEntity &entity = Enter(
+        shard, raw_decl->getSourceRange(), raw_decl->getLocation(),
+        static_cast<uint16_t>(decl.Kind()),
+        ExportedEntityCategory::kDeclaration);
+
+    if (auto nd = clang::dyn_cast<clang::NamedDecl>(raw_decl)) {
+      SetName(shard, entity, nd);
+    }
+
+    shard.decls.emplace_back(raw_decl, shard.parents.back());
+    if (const clang::Decl *canon = raw_decl->getCanonicalDecl();
+        canon != raw_decl) {
+      AddReference(shard, canon, ExportedReferenceKind::kCanonicalDeclaration);
+    }
+    return true;
+  }
+
+  // NOTE(pag): `StmtKind`s are numbered the same as `clang::Stmt::StmtClass`es.
+  bool PreVisit(BorrowedStmt stmt) final {
+    Shard &shard = *tShard;
+    const clang::Stmt *raw_stmt = stmt.RawStmt();
+    Enter(shard, raw_stmt->getSourceRange(), raw_stmt->getBeginLoc(),
+          static_cast<uint16_t>(raw_stmt->getStmtClass()),
+          ExportedEntityCategory::kStatement);
+
+    if (auto ref = clang::dyn_cast<clang::DeclRefExpr>(raw_stmt)) {
+      AddReference(shard, ref->getDecl(),
+                   ExportedReferenceKind::kReferencedDeclaration);
+
+    } else if (auto member = clang::dyn_cast<clang::MemberExpr>(raw_stmt)) {
+      AddReference(shard, member->getMemberDecl(),
+                   ExportedReferenceKind::kReferencedDeclaration);
+
+    } else if (auto call = clang::dyn_cast<clang::CallExpr>(raw_stmt)) {
+      AddReference(shard, call->getCalleeDecl(),
+                   ExportedReferenceKind::kCalledDeclaration);
+    }
+    return true;
+  }
+
+  // The shard of a top-level declaration is done once the declaration is.
+  void PostVisit(BorrowedDecl) final {
+    if (tShard) {
+      tShard->parents.pop_back();
+      if (tShard->parents.empty()) {
+        tShard = nullptr;
+      }
+    }
+  }
+
+  void PostVisit(BorrowedStmt) final {
+    tShard->parents.pop_back();
+  }
+};
+
+// Collects the top-level declarations of an AST, in the order in which they
+// are walked.
+class TopLevelDeclCollector final : public Walker {
+ public:
+  const clang::Decl *tu{nullptr};
+  std::vector<BorrowedDecl> decls;
+
+  virtual ~TopLevelDeclCollector(void) = default;
+
+  bool PreVisit(BorrowedDecl decl) final {
+    if (!tu) {
+      tu = decl.RawDecl();
+      return true;
+    }
+    decls.push_back(decl);
+    return false;
+  }
+
+  bool PreVisit(BorrowedStmt) final {
+    return false;
+  }
+};
+
+template <typename T>
+static void AppendRecords(char *out, const std::vector<T> &records) {
+  if (!records.empty()) {
+    memcpy(out, records.data(), records.size() * sizeof(T));
+  }
+}
+
+}  // namespace
+
+class EntityExportImpl {
+ public:
+  // Backing storage of the export, and an aligned copy of it, if needed.
+  std::string owned_data;
+  std::unique_ptr<uint64_t[]> aligned_data;
+
+  const ExportHeader *header{nullptr};
+  const ExportedEntity *entities{nullptr};
+  const ExportedReference *references{nullptr};
+  const char *strings{nullptr};
+
+  // Validate and adopt the export in `[begin, begin + size)`. All indices and
+  // offsets are checked here, so that the accessors don't need to.
+  std::error_code Init(const char *begin, size_t size);
+};
+
+std::error_code EntityExportImpl::Init(const char *begin, size_t size) {
+  const auto bad_format = std::make_error_code(std::errc::invalid_argument);
+
+  // Make sure the records can be accessed in-place.
+  if (reinterpret_cast<uintptr_t>(begin) % kAlignment) {
+    aligned_data.reset(
+        new uint64_t[(size + sizeof(uint64_t) - 1u) / sizeof(uint64_t)]);
+    memcpy(aligned_data.get(), begin, size);
+    begin = reinterpret_cast<const char *>(aligned_data.get());
+  }
+
+  if (size < sizeof(ExportHeader)) {
+    return bad_format;
+  }
+
+  header = reinterpret_cast<const ExportHeader *>(begin);
+  if (memcmp(header->magic, kMagic, sizeof(kMagic))) {
+    return bad_format;
+  }
+
+  if (header->version != EntityExport::kVersion) {
+    return std::make_error_code(std::errc::not_supported);
+  }
+
+  const uint64_t num_entities = header->num_entities;
+  const uint64_t num_references = header->num_references;
+  const uint64_t expected_size =
+      sizeof(ExportHeader) + num_entities * sizeof(ExportedEntity) +
+      num_references * sizeof(ExportedReference) + header->strings_size;
+  if (size != expected_size) {
+    return bad_format;
+  }
+
+  entities = reinterpret_cast<const ExportedEntity *>(
+      &(begin[sizeof(ExportHeader)]));
+  references = reinterpret_cast<const ExportedReference *>(
+      &(entities[header->num_entities]));
+  strings = reinterpret_cast<const char *>(
+      &(references[header->num_references]));
+
+  const uint64_t strings_size = header->strings_size;
+  for (uint32_t i = 0u; i < header->num_entities; ++i) {
+    const ExportedEntity &entity = entities[i];
+    if ((entity.parent != kInvalidExportIndex && entity.parent >= i) ||
+        (entity.parent == kInvalidExportIndex && i) ||
+        entity.name_offset > strings_size ||
+        entity.name_length > (strings_size - entity.name_offset) ||
+        entity.category > ExportedEntityCategory::kStatement) {
+      return bad_format;
+    }
+  }
+
+  for (uint32_t i = 0u; i < header->num_references; ++i) {
+    const ExportedReference &ref = references[i];
+    if (ref.from >= header->num_entities || ref.to >= header->num_entities ||
+        ref.kind > ExportedReferenceKind::kCanonicalDeclaration) {
+      return bad_format;
+    }
+  }
+
+  return {};
+}
+
+// Export the declarations and statements of `ast` using `num_threads` worker
+// threads.
+//
+// NOTE(pag): Exporting happens in phases. First, `Walker::WalkInParallel`
+//            exports each top-level declaration into its own shard, using
+//            local indices. Then, once the sizes of all shards are known, the
+//            shards are made global, their references are resolved, and they
+//            are copied into the output. Only the first phase is parallel.
+std::string EntityExport::Serialize(const AST &ast_, unsigned num_threads) {
+  ASTImpl &ast = *(ast_.impl);
+
+  TopLevelDeclCollector collector;
+  collector.Walk(ast_);
+
+  std::unordered_map<const clang::Decl *, size_t> shard_indices;
+  shard_indices.reserve(collector.decls.size());
+  for (size_t i = 0u, max_i = collector.decls.size(); i < max_i; ++i) {
+    shard_indices.emplace(collector.decls[i].RawDecl(), i);
+  }
+
+  std::vector<Shard> shards(collector.decls.size());
+  ShardExporter exporter(ast, shards, shard_indices);
+  exporter.WalkInParallel(ast_, num_threads);
+
+  std::vector<ExportedEntity> tu_entities;
+  if (collector.tu) {
+    ExportedEntity &tu = tu_entities.emplace_back();
+    tu.parent = kInvalidExportIndex;
+    tu.first_token = kInvalidTokenIndex;
+    tu.last_token = kInvalidTokenIndex;
+    tu.token = kInvalidTokenIndex;
+    tu.kind = static_cast<uint16_t>(DeclKind::kTranslationUnit);
+    tu.category = ExportedEntityCategory::kDeclaration;
+  }
+
+  size_t num_entities = tu_entities.size();
+  size_t num_decls = 0u;
+  size_t strings_size = 0u;
+  for (Shard &shard : shards) {
+    shard.AddPendingNames();
+    shard.first_entity = CheckedSize(num_entities);
+    shard.first_string = CheckedSize(strings_size);
+    num_entities += shard.entities.size();
+    num_decls += shard.decls.size();
+    strings_size += shard.strings.size();
+  }
+
+  // NOTE(pag): If a declaration is walked more than once, then references to
+  //            it resolve to the first walk, as in `Decl::ParentDeclaration`.
+  std::unordered_map<const clang::Decl *, uint32_t> decl_indices;
+  decl_indices.reserve(num_decls + 1u);
+  if (collector.tu) {
+    decl_indices.emplace(collector.tu, 0u);
+  }
+  for (const Shard &shard : shards) {
+    for (auto [decl, index] : shard.decls) {
+      decl_indices.emplace(decl, index + shard.first_entity);
+    }
+  }
+
+  size_t num_references = 0u;
+  for (Shard &shard : shards) {
+    shard.Finalize(decl_indices);
+    shard.first_reference = CheckedSize(num_references);
+    num_references += shard.references.size();
+  }
+
+  ExportHeader header = {};
+  memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.version = kVersion;
+  header.num_entities = CheckedSize(num_entities);
+  header.num_references = CheckedSize(num_references);
+  header.strings_size = CheckedSize(strings_size);
+
+  const size_t entities_offset = sizeof(ExportHeader);
+  const size_t references_offset =
+      entities_offset + num_entities * sizeof(ExportedEntity);
+  const size_t strings_offset =
+      references_offset + num_references * sizeof(ExportedReference);
+
+  std::string out;
+  out.resize(strings_offset + strings_size);
+  memcpy(out.data(), &header, sizeof(header));
+  AppendRecords(&(out[entities_offset]), tu_entities);
+
+  for (const Shard &shard : shards) {
+    AppendRecords(&(out[entities_offset + shard.first_entity *
+                                          sizeof(ExportedEntity)]),
+                  shard.entities);
+    AppendRecords(&(out[references_offset + shard.first_reference *
+                                            sizeof(ExportedReference)]),
+                  shard.references);
+    if (!shard.strings.empty()) {
+      memcpy(&(out[strings_offset + shard.first_string]),
+             shard.strings.data(), shard.strings.size());
+    }
+  }
+
+  return out;
+}
+
+// Validate the serialized entity export in `data`, taking ownership of it.
+Result<EntityExport, std::error_code> EntityExport::Load(std::string data) {
+  auto impl = std::make_shared<EntityExportImpl>();
+  impl->owned_data.swap(data);
+  if (auto ec = impl->Init(impl->owned_data.data(),
+                           impl->owned_data.size())) {
+    return ec;
+  }
+  return EntityExport(std::move(impl));
+}
+
+std::span<const ExportedEntity> EntityExport::Entities(void) const noexcept {
+  return std::span<const ExportedEntity>(impl->entities,
+                                         impl->header->num_entities);
+}
+
+std::span<const ExportedReference>
+EntityExport::References(void) const noexcept {
+  return std::span<const ExportedReference>(impl->references,
+                                            impl->header->num_references);
+}
+
+std::string_view EntityExport::Name(
+    const ExportedEntity &entity) const noexcept {
+  return std::string_view(&(impl->strings[entity.name_offset]),
+                          entity.name_length);
+}
+
+}  // namespace pasta
@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wimplicit-int-conversion"
+#pragma clang diagnostic ignored "-Wsign-conversion"
+#pragma clang diagnostic ignored "-Wshorten-64-to-32"
+#include <clang/AST/Decl.h>
+#include <clang/AST/Stmt.h>
+#include <llvm/ADT/ArrayRef.h>
+#pragma clang diagnostic pop
+
+#include <pasta/AST/Decl.h>
+#include <pasta/AST/Stmt.h>
+#include <pasta/AST/Walker.h>
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "AST.h"
+#include "Builder.h"
+
+namespace pasta {
+namespace {
+
+static constexpr unsigned kNumDeclKinds = 0u
+#define PASTA_COUNT_DECL_KIND(name) + 1u
+    PASTA_FOR_EACH_DECL_IMPL(PASTA_COUNT_DECL_KIND, PASTA_IGNORE_ABSTRACT)
+#undef PASTA_COUNT_DECL_KIND
+    ;
+
+// NOTE(pag): `StmtKind`s are numbered the same as `clang::Stmt::StmtClass`es.
+static constexpr unsigned kNumStmtKinds =
+    static_cast<unsigned>(clang::Stmt::lastStmtConstant) + 1u;
+
+// Collects every walked declaration and statement, along with its kind.
+class KindIndexer final : public Walker {
+ public:
+  std::vector<std::pair<unsigned, const clang::Decl *>> decls;
+  std::vector<std::pair<unsigned, const clang::Stmt *>> stmts;
+
+  virtual ~KindIndexer(void) = default;
+
+  bool PreVisit(BorrowedDecl decl) final {
+    decls.emplace_back(static_cast<unsigned>(decl.Kind()), decl.RawDecl());
+    return true;
+  }
+
+  bool PreVisit(BorrowedStmt stmt) final {
+    const clang::Stmt *raw_stmt = stmt.RawStmt();
+    stmts.emplace_back(static_cast<unsigned>(raw_stmt->getStmtClass()),
+                       raw_stmt);
+    return true;
+  }
+};
+
+// Stably group `entities` by kind into `indexed`, recording the beginning of
+// each kind's group in `offsets`, and the position of each entity in
+// `entities` in `ordinals`.
+template <typename E>
+static void GroupByKind(std::vector<std::pair<unsigned, const E *>> &entities,
+                        unsigned num_kinds, std::vector<const E *> &indexed,
+                        std::vector<uint32_t> &offsets,
+                        std::vector<uint32_t> &ordinals) {
+  assert(entities.size() < std::numeric_limits<uint32_t>::max());
+
+  offsets.clear();
+  offsets.resize(num_kinds + 1u, 0u);
+  for (const auto &[kind, entity] : entities) {
+    assert(kind < num_kinds);
+    offsets[kind + 1u] += 1u;
+  }
+
+  for (auto i = 1u; i <= num_kinds; ++i) {
+    offsets[i] += offsets[i - 1u];
+  }
+
+  // `next[k]` is where the next entity of kind `k` goes.
+  std::vector<uint32_t> next(offsets.begin(), offsets.end() - 1);
+  indexed.resize(entities.size());
+  ordinals.resize(entities.size());
+  for (uint32_t i = 0u, max_i = static_cast<uint32_t>(entities.size());
+       i < max_i; ++i) {
+    const auto &[kind, entity] = entities[i];
+    const uint32_t j = next[kind]++;
+    indexed[j] = entity;
+    ordinals[j] = i;
+  }
+
+  entities.clear();
+  entities.shrink_to_fit();
+}
+
+// Return the indexed entities of all of the kinds whose orders are in `range`,
+// in source order. If only one kind is in `range`, then this is a slice of
+// `indexed`. Otherwise, the entities of all of the kinds are merged by their
+// `ordinals` into `merged`, once per range.
+template <typename E, typename Kind>
+static llvm::ArrayRef<const E *> IndexedRange(
+    const std::vector<const E *> &indexed,
+    const std::vector<uint32_t> &ordinals,
+    const std::vector<uint32_t> &offsets, unsigned num_kinds,
+    uint16_t (*kind_order)(Kind) noexcept, detail::KindRange range,
+    std::mutex &lock,
+    std::map<std::pair<uint16_t, uint16_t>, std::vector<const E *>> &merged) {
+
+  std::vector<unsigned> kinds;
+  for (auto k = 0u; k < num_kinds; ++k) {
+    if (detail::IsInKindRange(kind_order(static_cast<Kind>(k)), range)) {
+      kinds.push_back(k);
+    }
+  }
+
+  llvm::ArrayRef<const E *> entities(indexed);
+  if (kinds.empty()) {
+    return {};
+
+  } else if (kinds.size() == 1u) {
+    const uint32_t begin = offsets[kinds.front()];
+    const uint32_t end = offsets[kinds.front() + 1u];
+    return entities.slice(begin, end - begin);
+  }
+
+  std::unique_lock<std::mutex> locker(lock);
+  auto [it, added] = merged.emplace(
+      std::make_pair(range.begin, range.end), std::vector<const E *>());
+  if (!added) {
+    return it->second;
+  }
+
+  std::vector<std::pair<uint32_t, const E *>> ordered;
+  for (unsigned k : kinds) {
+    for (uint32_t i = offsets[k], max_i = offsets[k + 1u]; i < max_i; ++i) {
+      ordered.emplace_back(ordinals[i], indexed[i]);
+    }
+  }
+
+  std::sort(ordered.begin(), ordered.end(),
+            [] (const auto &a, const auto &b) {
+              return a.first < b.first;
+            });
+
+  std::vector<const E *> &merged_entities = it->second;
+  merged_entities.reserve(ordered.size());
+  for (const auto &[ordinal, entity] : ordered) {
+    merged_entities.push_back(entity);
+  }
+  return merged_entities;
+}
+
+// Return the indexed declarations of kind `kind`.
+template <typename T>
+static LazyRange<T> IndexedDecls(const std::shared_ptr<ASTImpl> &ast,
+                                 DeclKind kind) {
+  ast->BuildKindIndex();
+  const auto k = static_cast<unsigned>(kind);
+  if (k >= kNumDeclKinds) {
+    return {};
+  }
+  const uint32_t begin = ast->decl_kind_offsets[k];
+  const uint32_t end = ast->decl_kind_offsets[k + 1u];
+  llvm::ArrayRef<const clang::Decl *> decls(ast->indexed_decls);
+  return LazyRangeBuilder::Create<T, DeclBuilder>(
+      ast, decls.slice(begin, end - begin));
+}
+
+// Return the indexed statements of kind `kind`.
+template <typename T>
+static LazyRange<T> IndexedStmts(const std::shared_ptr<ASTImpl> &ast,
+                                 StmtKind kind) {
+  ast->BuildKindIndex();
+  const auto k = static_cast<unsigned>(kind);
+  if (k >= kNumStmtKinds) {
+    return {};
+  }
+  const uint32_t begin = ast->stmt_kind_offsets[k];
+  const uint32_t end = ast->stmt_kind_offsets[k + 1u];
+  llvm::ArrayRef<const clang::Stmt *> stmts(ast->indexed_stmts);
+  return LazyRangeBuilder::Create<T, StmtBuilder>(
+      ast, stmts.slice(begin, end - begin));
+}
+
+// Return the indexed declarations of all of the kinds in `range`.
+template <typename T>
+static LazyRange<T> IndexedDecls(const std::shared_ptr<ASTImpl> &ast,
+                                 detail::KindRange range) {
+  ast->BuildKindIndex();
+  return LazyRangeBuilder::Create<T, DeclBuilder>(
+      ast, IndexedRange(ast->indexed_decls, ast->indexed_decl_ordinals,
+                        ast->decl_kind_offsets, kNumDeclKinds,
+                        detail::DeclKindOrder, range, ast->merged_kinds_lock,
+                        ast->merged_decls));
+}
+
+// Return the indexed statements of all of the kinds in `range`.
+template <typename T>
+static LazyRange<T> IndexedStmts(const std::shared_ptr<ASTImpl> &ast,
+                                 detail::KindRange range) {
+  ast->BuildKindIndex();
+  return LazyRangeBuilder::Create<T, StmtBuilder>(
+      ast, IndexedRange(ast->indexed_stmts, ast->indexed_stmt_ordinals,
+                        ast->stmt_kind_offsets, kNumStmtKinds,
+                        detail::StmtKindOrder, range, ast->merged_kinds_lock,
+                        ast->merged_stmts));
+}
+
+}  // namespace
+
+void ASTImpl::BuildKindIndex(void) {
+  std::call_once(kind_index_init, [this] (void) {
+    KindIndexer indexer;
+    if (tu) {
+      indexer.Walk(AST(shared_from_this()));
+    }
+    GroupByKind(indexer.decls, kNumDeclKinds, indexed_decls,
+                decl_kind_offsets, indexed_decl_ordinals);
+    GroupByKind(indexer.stmts, kNumStmtKinds, indexed_stmts,
+                stmt_kind_offsets, indexed_stmt_ordinals);
+  });
+}
+
+LazyRange<Decl> AST::DeclsOfKind(DeclKind kind) const {
+  return IndexedDecls<Decl>(impl, kind);
+}
+
+LazyRange<Stmt> AST::StmtsOfKind(StmtKind kind) const {
+  return IndexedStmts<Stmt>(impl, kind);
+}
+
+template <typename T>
+LazyRange<T> AST::DeclsOfKind(void) const {
+  return IndexedDecls<T>(impl, T::kKindRange);
+}
+
+template <typename T>
+LazyRange<T> AST::StmtsOfKind(void) const {
+  return IndexedStmts<T>(impl, T::kKindRange);
+}
+
+#define PASTA_INSTANTIATE_DECLS_OF_KIND(name) \
+    template LazyRange<name ## Decl> AST::DeclsOfKind<name ## Decl>(void) const;
+
+#define PASTA_INSTANTIATE_DECLS_OF_ABSTRACT_KIND(name) \
+    template LazyRange<name> AST::DeclsOfKind<name>(void) const;
+
+#define PASTA_INSTANTIATE_STMTS_OF_KIND(name) \
+    template LazyRange<name> AST::StmtsOfKind<name>(void) const;
+
+PASTA_FOR_EACH_DECL_IMPL(PASTA_INSTANTIATE_DECLS_OF_KIND,
+                         PASTA_INSTANTIATE_DECLS_OF_ABSTRACT_KIND)
+PASTA_FOR_EACH_STMT_IMPL(PASTA_INSTANTIATE_STMTS_OF_KIND,
+                         PASTA_INSTANTIATE_STMTS_OF_KIND,
+                         PASTA_INSTANTIATE_STMTS_OF_KIND,
+                         PASTA_INSTANTIATE_STMTS_OF_KIND,
+                         PASTA_INSTANTIATE_STMTS_OF_KIND,
+                         PASTA_INSTANTIATE_STMTS_OF_KIND)
+#undef PASTA_INSTANTIATE_DECLS_OF_KIND
+#undef PASTA_INSTANTIATE_DECLS_OF_ABSTRACT_KIND
+#undef PASTA_INSTANTIATE_STMTS_OF_KIND
+
+}  // namespace pasta
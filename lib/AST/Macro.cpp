@@ -4,6 +4,7 @@
 
 #include "Macro.h"
 
+#include <algorithm>
 #include <cassert>
 #include <functional>
 #include <map>
@@ -162,6 +163,7 @@ MacroNodeImpl *MacroDirectiveImpl::Clone(
   MacroDirectiveImpl *clone = &(ast.root_macro_node.directives.emplace_back());
   clone->cloned_from = this;
   clone->defined_macro = defined_macro;
+  clone->canonical_definition = canonical_definition;
   clone->included_file = included_file;
   clone->kind = kind;
   clone->is_skipped = is_skipped;
@@ -813,6 +815,19 @@ MacroRange DefineMacroDirective::Body(void) const noexcept {
   return MacroRange(ast);
 }
 
+// The canonical definition of this macro, shared with equivalent definitions
+// in other ASTs.
+std::optional<MacroDefinition>
+DefineMacroDirective::CanonicalDefinition(void) const noexcept {
+  Node node = *reinterpret_cast<const Node *>(impl);
+  MacroNodeImpl *node_impl = std::get<MacroNodeImpl *>(node);
+  MacroDirectiveImpl *dir_impl = dynamic_cast<MacroDirectiveImpl *>(node_impl);
+  if (dir_impl->canonical_definition) {
+    return MacroDefinition(dir_impl->canonical_definition);
+  }
+  return std::nullopt;
+}
+
 // Parameters of this macro definition.
 MacroRange DefineMacroDirective::Parameters(void) const noexcept {
   Node node = *reinterpret_cast<const Node *>(impl);
@@ -964,10 +979,10 @@ std::optional<MacroToken> MacroSubstitution::NameOrOperator(void) const noexcept
 }
 
 // Walks the given Stmt's subtree and returns the first of its subtrees that
-// aligns with the given macro, if any.
-std::optional<pasta::Stmt>
-AlignedStmtInSubtree(Macro &macro, const pasta::Stmt &stmt) noexcept {
-  std::vector<pasta::Stmt> aligned_stmts;
+// aligns with the given macro, if any, according to `aligns_with`.
+template <typename AlignsWith>
+static std::optional<pasta::Stmt>
+AlignedStmtInSubtree(const pasta::Stmt &stmt, AlignsWith aligns_with) noexcept {
   // Use a BFS to walk the given Stmt's AST.
   std::queue<pasta::Stmt> q;
   q.push(stmt);
@@ -978,7 +993,7 @@ AlignedStmtInSubtree(Macro &macro, const pasta::Stmt &stmt) noexcept {
     // Don't match implicit expressions
     if (cur.Kind() != StmtKind::kImplicitCastExpr &&
         cur.Kind() != StmtKind::kImplicitValueInitExpr &&
-        cur.AlignsWith(macro)) {
+        aligns_with(cur)) {
       return cur;
     }
 
@@ -989,11 +1004,15 @@ AlignedStmtInSubtree(Macro &macro, const pasta::Stmt &stmt) noexcept {
   return std::nullopt;
 }
 
-std::map<MacroParameter, std::vector<pasta::Stmt>>
-MacroExpansion::AlignedParameterSubstitutions(
-  const pasta::Stmt &stmt) const noexcept {
+// Maps each of the parameters of `exp` to the Stmts in the subtree of `stmt`
+// that the parameter substitutions align with, according to `aligns_with`.
+template <typename AlignsWith>
+static std::map<MacroParameter, std::vector<pasta::Stmt>>
+AlignedParameterSubstitutionsImpl(const MacroExpansion &exp,
+                                  const pasta::Stmt &stmt,
+                                  AlignsWith aligns_with) noexcept {
   std::map<MacroParameter, std::vector<pasta::Stmt>> param_to_uses;
-  auto def = Definition();
+  auto def = exp.Definition();
 
   if (!def) {
     return param_to_uses;
@@ -1006,9 +1025,13 @@ MacroExpansion::AlignedParameterSubstitutions(
   }
 
   // Map each argument to the Stmts it substitutions align with
-  for (auto &child : IntermediateChildren()) {
+  for (auto &child : exp.IntermediateChildren()) {
     if (auto sub = MacroParameterSubstitution::From(child)) {
-      if (auto aligned_stmt = AlignedStmtInSubtree(*sub, stmt)) {
+      auto aligned_stmt = AlignedStmtInSubtree(
+          stmt, [&] (const pasta::Stmt &cur) {
+            return aligns_with(cur, *sub);
+          });
+      if (aligned_stmt) {
         param_to_uses[sub->Parameter()].push_back(*aligned_stmt);
       }
     }
@@ -1017,6 +1040,33 @@ MacroExpansion::AlignedParameterSubstitutions(
   return param_to_uses;
 }
 
+std::map<MacroParameter, std::vector<pasta::Stmt>>
+MacroExpansion::AlignedParameterSubstitutions(
+  const pasta::Stmt &stmt) const noexcept {
+  return AlignedParameterSubstitutionsImpl(
+      *this, stmt, [] (const pasta::Stmt &cur, Macro &sub) {
+        return cur.AlignsWith(sub);
+      });
+}
+
+std::map<MacroParameter, std::vector<pasta::Stmt>>
+MacroExpansion::AlignedParameterSubstitutions(
+    const pasta::Stmt &stmt,
+    const std::unordered_map<const void *, std::vector<MacroSubstitution>>
+        &stmt_subs) const noexcept {
+  return AlignedParameterSubstitutionsImpl(
+      *this, stmt, [&] (const pasta::Stmt &cur, Macro &sub) {
+        auto it = stmt_subs.find(cur.RawStmt());
+        if (it == stmt_subs.end()) {
+          return false;
+        }
+        return std::any_of(it->second.begin(), it->second.end(),
+                           [&] (const MacroSubstitution &aligned) {
+                             return sub == aligned;
+                           });
+      });
+}
+
 std::map<MacroParameter, unsigned>
 MacroExpansion::ParameterUseCounts(void) const noexcept {
   std::map<MacroParameter, unsigned> m;
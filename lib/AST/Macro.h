@@ -11,6 +11,7 @@
 #include <variant>
 
 #include <pasta/Util/File.h>
+#include <pasta/Util/MacroDefinition.h>
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wbitfield-enum-conversion"
@@ -100,6 +101,10 @@ class MacroDirectiveImpl final : public MacroNodeImpl {
   // The info for the macro that was defined by this directive.
   const clang::MacroInfo *defined_macro{nullptr};
 
+  // The canonical definition, shared across ASTs, assuming this directive is
+  // a `#define` that isn't in a skipped region.
+  std::shared_ptr<const MacroDefinitionImpl> canonical_definition;
+
   // Token for the name of the defined macro, assuming this directive is a
   // `#define`.
   Node macro_name;
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wimplicit-int-conversion"
+#pragma clang diagnostic ignored "-Wsign-conversion"
+#pragma clang diagnostic ignored "-Wshorten-64-to-32"
+#include <clang/AST/Decl.h>
+#include <clang/AST/Stmt.h>
+#pragma clang diagnostic pop
+
+#include <pasta/AST/Decl.h>
+#include <pasta/AST/Stmt.h>
+#include <pasta/AST/Walker.h>
+
+#include <cassert>
+#include <vector>
+
+#include "AST.h"
+#include "Builder.h"
+
+namespace pasta {
+namespace {
+
+// Assigns ordinals to every walked declaration and statement, and records the
+// ordinals of their parents and of their nearest enclosing declarations.
+class ParentMapBuilder final : public Walker {
+ public:
+  ASTImpl &ast;
+
+  // Ordinals of the entities currently being walked, and of the declarations
+  // currently being walked.
+  std::vector<uint32_t> parents;
+  std::vector<uint32_t> parent_decls;
+
+  explicit ParentMapBuilder(ASTImpl &ast_)
+      : ast(ast_) {}
+
+  virtual ~ParentMapBuilder(void) = default;
+
+  void Enter(const void *entity, bool is_decl) {
+    assert(ast.entity_parents.size() < ASTImpl::kInvalidEntityOrdinal);
+    auto [it, added] = ast.entity_ordinals.try_emplace(
+        entity, static_cast<uint32_t>(ast.entity_parents.size()));
+    const uint32_t ordinal = it->second;
+
+    // NOTE(pag): An entity that is reachable from more than one parent is
+    //            walked once per parent, but keeps the ordinal, and thus the
+    //            parents, of its first walk.
+    if (added) {
+      ast.entity_parents.push_back(ASTImpl::EntityParents{
+          entity,
+          parents.empty() ? ASTImpl::kInvalidEntityOrdinal : parents.back(),
+          parent_decls.empty() ? ASTImpl::kInvalidEntityOrdinal :
+                                 parent_decls.back()});
+    }
+
+    parents.push_back(ordinal);
+    if (is_decl) {
+      parent_decls.push_back(ordinal);
+    }
+  }
+
+  bool PreVisit(BorrowedDecl decl) final {
+    Enter(decl.RawDecl(), true);
+    return true;
+  }
+
+  bool PreVisit(BorrowedStmt stmt) final {
+    Enter(stmt.RawStmt(), false);
+    return true;
+  }
+
+  void PostVisit(BorrowedDecl) final {
+    parents.pop_back();
+    parent_decls.pop_back();
+  }
+
+  void PostVisit(BorrowedStmt) final {
+    parents.pop_back();
+  }
+};
+
+// Returns the ordinal of `entity`, or `kInvalidEntityOrdinal`.
+static uint32_t OrdinalOf(ASTImpl &ast, const void *entity) {
+  ast.BuildParentMap();
+  auto it = ast.entity_ordinals.find(entity);
+  if (it != ast.entity_ordinals.end()) {
+    return it->second;
+  }
+  return ASTImpl::kInvalidEntityOrdinal;
+}
+
+// Returns the nearest enclosing declaration of `entity`.
+static std::optional<Decl> ParentDeclOf(const std::shared_ptr<ASTImpl> &ast,
+                                        const void *entity) {
+  const uint32_t ordinal = OrdinalOf(*ast, entity);
+  if (ordinal == ASTImpl::kInvalidEntityOrdinal) {
+    return std::nullopt;
+  }
+
+  const uint32_t parent = ast->entity_parents[ordinal].parent_decl;
+  if (parent == ASTImpl::kInvalidEntityOrdinal) {
+    return std::nullopt;
+  }
+
+  return DeclBuilder::Create<Decl>(
+      ast, reinterpret_cast<const clang::Decl *>(
+               ast->entity_parents[parent].entity));
+}
+
+}  // namespace
+
+void ASTImpl::BuildParentMap(void) {
+  std::call_once(parent_map_init, [this] (void) {
+    if (tu) {
+      ParentMapBuilder builder(*this);
+      builder.Walk(AST(shared_from_this()));
+    }
+  });
+}
+
+// Return the nearest enclosing declaration of this declaration, as walked by
+// `Walker`. This is computed for every declaration of the AST on first use.
+std::optional<Decl> Decl::ParentDeclaration(void) const {
+  return ParentDeclOf(ast, u.opaque);
+}
+
+// Return the parent statement of this statement, as walked by `Walker`. This
+// is computed for every statement of the AST on first use. If the parent of
+// this statement is a declaration, e.g. because this statement is the body of
+// a function, or the initializer of a variable, then this returns
+// `std::nullopt`, and `ParentDeclaration` returns the parent.
+std::optional<Stmt> Stmt::Parent(void) const {
+  const uint32_t ordinal = OrdinalOf(*ast, u.opaque);
+  if (ordinal == ASTImpl::kInvalidEntityOrdinal) {
+    return std::nullopt;
+  }
+
+  const ASTImpl::EntityParents &record = ast->entity_parents[ordinal];
+  if (record.parent == ASTImpl::kInvalidEntityOrdinal ||
+      record.parent == record.parent_decl) {
+    return std::nullopt;
+  }
+
+  return StmtBuilder::Create<Stmt>(
+      ast, reinterpret_cast<const clang::Stmt *>(
+               ast->entity_parents[record.parent].entity));
+}
+
+// Return the nearest enclosing declaration of this statement.
+std::optional<Decl> Stmt::ParentDeclaration(void) const {
+  return ParentDeclOf(ast, u.opaque);
+}
+
+}  // namespace pasta
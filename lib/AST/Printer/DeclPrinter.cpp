@@ -13,6 +13,11 @@
 
 #include "DeclStmtPrinter.h"
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
 namespace pasta {
 
 class PrintedTokenRangeImpl;
@@ -545,15 +550,29 @@ void DeclPrinter::PrintConstructorInitializers(
 //----------------------------------------------------------------------------
 
 void DeclPrinter::VisitDeclContext(clang::DeclContext *DC, bool Indent) {
+  VisitDecls(DC, DC->decls_begin(), DC->decls_end(), Indent);
+}
+
+void DeclPrinter::VisitDecls(clang::DeclContext *DC,
+                             clang::DeclContext::decl_iterator DBegin,
+                             clang::DeclContext::decl_iterator DEnd,
+                             bool Indent) {
   if (Policy.TerseOutput)
     return;
 
   if (Indent)
     Indentation += Policy.Indentation;
 
+  const bool Streaming = TopLevelDeclsDone &&
+                         clang::isa<clang::TranslationUnitDecl>(DC);
+
   clang::SmallVector<clang::Decl*, 2> Decls;
-  for (clang::DeclContext::decl_iterator D = DC->decls_begin(), DEnd = DC->decls_end();
-       D != DEnd; ++D) {
+  for (clang::DeclContext::decl_iterator D = DBegin; D != DEnd; ++D) {
+
+    // Everything printed so far is complete; let the streamer flush it.
+    if (Streaming) {
+      TopLevelDeclsDone();
+    }
 
     // Don't print ObjCIvarDecls, as they are printed when visiting the
     // containing ObjCInterfaceDecl.
@@ -612,8 +631,12 @@ void DeclPrinter::VisitDeclContext(clang::DeclContext *DC, bool Indent) {
     }
 
     // If we have a merged group waiting to be handled, handle it now.
-    if (!Decls.empty())
+    if (!Decls.empty()) {
       ProcessDeclGroup(Decls);
+      if (Streaming) {
+        TopLevelDeclsDone();
+      }
+    }
 
     // If the current declaration is not a free standing declaration, save it
     // so we can merge it with the subsequent declaration(s) using it.
@@ -2531,7 +2554,9 @@ PrintedTokenRange PrintedTokenRange::Create(const std::shared_ptr<ASTImpl> &ast,
     out << OptionalTrailingSemiColon(tokens, decl);
 
     // Mark the location of the trailing semicolon, if any.
+    std::unique_lock<std::mutex> locker(ast->bounds_mutex);
     auto [begin_tok, end_tok] = ast->DeclBounds(decl);
+    locker.unlock();
     if (end_tok && end_tok->Kind() == clang::tok::semi) {
       ctx.MarkLocation(*end_tok);
     }
@@ -2542,4 +2567,155 @@ PrintedTokenRange PrintedTokenRange::Create(const std::shared_ptr<ASTImpl> &ast,
   return PrintedTokenRangeImpl::ToPrintedTokenRange(std::move(tokens));
 }
 
+// Print `decl_`, passing the printed tokens to `sink` in chunks.
+void PrintedTokenRange::Stream(const Decl &decl_, PrintedTokenSink &sink,
+                               const PrintingPolicy &high_pp) {
+  auto decl = const_cast<clang::Decl *>(decl_.u.Decl);
+  auto tu = clang::dyn_cast<clang::TranslationUnitDecl>(decl);
+  if (!tu) {
+    sink.Accept(PrintedTokenRange::Create(decl_.ast, decl, high_pp));
+    return;
+  }
+
+  const std::shared_ptr<ASTImpl> &ast = decl_.ast;
+  std::string data;
+  raw_string_ostream out(data, 0);
+  auto &context = ast->tu->getASTContext();
+  auto tokens = std::make_shared<PrintedTokenRangeImpl>(context);
+
+  // Top-level context should be the AST.
+  tokens->ast = ast;
+  tokens->contexts.emplace_back(*ast);
+
+  PrintingPolicyAdaptor ppa(ast, high_pp, decl);
+  PrintingPolicyAdaptorRAII ppa_set_reset(tokens, ppa);
+
+  clang::PrintingPolicy pp = *(ast->printing_policy);
+  pp.IncludeTagDefinition = high_pp.ShouldPrintTagBodies();
+
+  DeclPrinter printer(out, pp, context, *tokens);
+  TokenPrinterContext ctx(out, tu, *tokens);
+
+  // The AST and translation unit contexts are the parents of every top-level
+  // declaration, and so they are kept around across flushes.
+  const auto num_base_contexts = tokens->contexts.size();
+  printer.TopLevelDeclsDone = [&] (void) {
+    ctx.Tokenize();
+    tokens->Flush(sink, num_base_contexts);
+  };
+
+  printer.VisitDeclContext(tu, false);
+  printer.TopLevelDeclsDone();
+}
+
+// Returns `true` if we can independently print the top-level declarations
+// before and after `prev_decl` (the last non-implicit declaration) on their
+// own, i.e. the next declaration won't be grouped with `prev_decl` by
+// `DeclPrinter::VisitDecls`, as in `struct {int x;} a, b;`.
+static bool IsIndependentTopLevelDecl(clang::Decl *prev_decl) {
+  if (!prev_decl) {
+    return true;
+  }
+  auto tag = clang::dyn_cast<clang::TagDecl>(prev_decl);
+  return !tag || tag->isFreeStanding();
+}
+
+// Print the top-level declarations of `ast_`'s translation unit using up to
+// `num_threads` threads.
+PrintedTokenRange PrintedTokenRange::PrintTopLevelDecls(
+    const AST &ast_, unsigned num_threads, const PrintingPolicy &high_pp) {
+  const Decl tu_decl = ast_.TranslationUnit();
+  const std::shared_ptr<ASTImpl> &ast = tu_decl.ast;
+  auto tu = const_cast<clang::TranslationUnitDecl *>(
+      tu_decl.u.TranslationUnitDecl);
+  auto &context = ast->tu->getASTContext();
+
+  // Split the top-level declarations into slices, where each slice can be
+  // printed independently. We make more slices than threads so that a few
+  // huge declarations don't leave most threads idle.
+  num_threads = std::max(1u, num_threads);
+  std::vector<clang::DeclContext::decl_iterator> slices;
+  size_t num_decls = 0u;
+  for (auto it = tu->decls_begin(), end = tu->decls_end(); it != end; ++it) {
+    ++num_decls;
+  }
+
+  const size_t max_slice_size = std::max<size_t>(
+      1u, num_decls / (num_threads * 4u));
+  size_t slice_size = 0u;
+  clang::Decl *prev_decl = nullptr;
+  for (auto it = tu->decls_begin(), end = tu->decls_end(); it != end; ++it) {
+    if (slices.empty() ||
+        (slice_size >= max_slice_size &&
+         IsIndependentTopLevelDecl(prev_decl))) {
+      slices.push_back(it);
+      slice_size = 0u;
+    }
+    ++slice_size;
+
+    // Implicit declarations are skipped by `VisitDecls`, and so can't group
+    // with anything.
+    if (!it->isImplicit()) {
+      prev_decl = *it;
+    }
+  }
+  slices.push_back(tu->decls_end());
+
+  const size_t num_slices = slices.size() - 1u;
+  std::vector<std::shared_ptr<PrintedTokenRangeImpl>> printed_slices(
+      num_slices);
+
+  clang::PrintingPolicy pp = *(ast->printing_policy);
+  pp.IncludeTagDefinition = high_pp.ShouldPrintTagBodies();
+
+  auto print_slice = [&] (size_t i) {
+    std::string data;
+    raw_string_ostream out(data, 0);
+    auto tokens = std::make_shared<PrintedTokenRangeImpl>(context);
+
+    // Top-level context should be the AST.
+    tokens->ast = ast;
+    tokens->contexts.emplace_back(*ast);
+
+    PrintingPolicyAdaptor ppa(ast, high_pp, tu);
+    PrintingPolicyAdaptorRAII ppa_set_reset(tokens, ppa);
+
+    DeclPrinter printer(out, pp, context, *tokens);
+    {
+      TokenPrinterContext ctx(out, tu, *tokens);
+      printer.VisitDecls(tu, slices[i], slices[i + 1u], false);
+    }
+
+    tokens->FixupInvalidTokenContexts(kASTTokenContextIndex);
+    tokens->AddTrailingEOF();
+    printed_slices[i] = std::move(tokens);
+  };
+
+  std::atomic<size_t> next_slice(0u);
+  auto worker = [&] (void) {
+    for (size_t i = next_slice++; i < num_slices; i = next_slice++) {
+      print_slice(i);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  const auto num_workers = std::min<size_t>(num_threads, num_slices);
+  for (size_t i = 1u; i < num_workers; ++i) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+
+  std::vector<PrintedTokenRange> ranges;
+  ranges.reserve(num_slices);
+  for (std::shared_ptr<PrintedTokenRangeImpl> &printed_slice : printed_slices) {
+    ranges.emplace_back(PrintedTokenRangeImpl::ToPrintedTokenRange(
+        std::move(printed_slice)));
+  }
+
+  return PrintedTokenRangeImpl::Concatenate(context, ast, ranges);
+}
+
 }  // namespace pasta
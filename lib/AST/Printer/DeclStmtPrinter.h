@@ -71,6 +71,7 @@
 #pragma GCC diagnostic pop
 
 #include <cassert>
+#include <functional>
 #include <string>
 
 #include "raw_ostream.h"
@@ -174,7 +175,17 @@ class DeclPrinter final : public clang::DeclVisitor<DeclPrinter>,
         Context(Context),
         Indentation(Indentation) {}
 
+  // If set, then this is invoked by `VisitDeclContext` on a translation unit
+  // each time that all top-level declarations visited so far have been
+  // completely printed. Used by `PrintedTokenRange::Stream`.
+  std::function<void(void)> TopLevelDeclsDone;
+
   void VisitDeclContext(clang::DeclContext *DC, bool Indent = true);
+
+  // Print the declarations in the range `[DBegin, DEnd)` of `DC`.
+  void VisitDecls(clang::DeclContext *DC,
+                  clang::DeclContext::decl_iterator DBegin,
+                  clang::DeclContext::decl_iterator DEnd, bool Indent = true);
   void VisitTranslationUnitDecl(clang::TranslationUnitDecl *D);
   void VisitTypedefDecl(clang::TypedefDecl *D);
   void VisitTypeAliasDecl(clang::TypeAliasDecl *D);
@@ -439,6 +450,8 @@ public:
 //             std::function<void(void)> *placeHolderFn = nullptr);
 
   void print(clang::QualType T, clang::StringRef PlaceHolder, std::function<void(void)> *placeHolderFn = nullptr);
+  void printCached(clang::QualType T);
+  uint64_t policyKey(void) const;
 
   static bool canPrefixQualifiers(const clang::Type *T, bool &NeedARCStrongQualifier);
   void spaceBeforePlaceHolder(raw_string_ostream &OS);
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2021 Trail of Bits, Inc.
+ */
+
+#include "PrintCache.h"
+
+#include "Printer.h"
+
+namespace pasta {
+
+PrintCache::PrintCache(size_t max_bytes_)
+    : max_bytes(max_bytes_) {}
+
+// Approximate the number of bytes retained by a printed token range.
+size_t PrintCache::SizeInBytes(const PrintedTokenRangeImpl &impl) {
+  return sizeof(impl) +
+         impl.tokens.capacity() * sizeof(PrintedTokenImpl) +
+         impl.contexts.capacity() * sizeof(TokenContextImpl) +
+         impl.data.capacity();
+}
+
+// Return a copy of the cached `range` that owns `ast`. The control block of the
+// returned range's `impl` owns both the AST and the cached range.
+PrintedTokenRange PrintCache::Bind(const std::shared_ptr<ASTImpl> &ast,
+                                   const PrintedTokenRange &range) {
+  struct OwnedRange {
+    std::shared_ptr<ASTImpl> ast;
+    std::shared_ptr<PrintedTokenRangeImpl> impl;
+  };
+
+  auto owner = std::make_shared<OwnedRange>(OwnedRange{ast, range.impl});
+  return PrintedTokenRange(
+      std::shared_ptr<PrintedTokenRangeImpl>(owner, range.impl.get()),
+      range.first, range.after_last);
+}
+
+// Find a cached printed range.
+std::optional<PrintedTokenRange> PrintCache::Find(
+    const std::shared_ptr<ASTImpl> &ast, const void *entity, uint32_t extra,
+    uint64_t policy_key) {
+  std::lock_guard<std::mutex> locker(mutex);
+  auto it = key_to_entry.find(Key{entity, policy_key, extra});
+  if (it == key_to_entry.end()) {
+    return std::nullopt;
+  }
+
+  // Move to the front, as it's now the most recently used.
+  entries.splice(entries.begin(), entries, it->second);
+  return Bind(ast, it->second->second);
+}
+
+// Add `range` to the cache, evicting the least recently used ranges if the
+// cache is now too big.
+void PrintCache::Insert(const std::shared_ptr<ASTImpl> &ast,
+                        const void *entity, uint32_t extra,
+                        uint64_t policy_key, PrintedTokenRange &range) {
+  const size_t range_bytes = SizeInBytes(*(range.impl));
+  if (range_bytes > max_bytes) {
+    return;  // Never going to fit.
+  }
+
+  std::lock_guard<std::mutex> locker(mutex);
+  Key key{entity, policy_key, extra};
+
+  // Another thread may have concurrently printed and cached this entity.
+  if (key_to_entry.count(key)) {
+    return;
+  }
+
+  // Only borrow the AST, so that the cache doesn't keep its own AST alive.
+  range.impl->is_cached = true;
+  range.impl->ast = std::shared_ptr<ASTImpl>(std::shared_ptr<ASTImpl>(),
+                                             ast.get());
+  entries.emplace_front(key, range);
+  key_to_entry.emplace(key, entries.begin());
+  num_bytes += range_bytes;
+
+  while (num_bytes > max_bytes && !entries.empty()) {
+    const Entry &lru = entries.back();
+    num_bytes -= SizeInBytes(*(lru.second.impl));
+    key_to_entry.erase(lru.first);
+    entries.pop_back();
+  }
+
+  range = Bind(ast, range);
+}
+
+}  // namespace pasta
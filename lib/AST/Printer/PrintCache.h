@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2021 Trail of Bits, Inc.
+ */
+
+#pragma once
+
+#include <pasta/AST/Printer.h>
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+namespace pasta {
+
+class ASTImpl;
+class PrintedTokenRangeImpl;
+
+// A bounded, least-recently-used cache of printed token ranges, keyed by the
+// printed entity (e.g. a `clang::Decl *`) and the printing policy's cache key.
+// Enabled via `AST::EnablePrintCache`.
+//
+// NOTE(pag): Cached ranges are shared, and so must be treated as immutable.
+//            Anything that mutates a printed range in-place (e.g.
+//            `PrintedTokenRange::Align`) must first check
+//            `PrintedTokenRangeImpl::is_cached`, and make a private copy.
+//
+// NOTE(pag): The `ASTImpl` owns its print cache, and so cached ranges only
+//            borrow their AST, otherwise the AST would never be freed. Ranges
+//            handed out by the cache are re-bound to an owning pointer to the
+//            AST. See `PrintedTokenRangeImpl::OwnedAST`.
+class PrintCache {
+ public:
+  explicit PrintCache(size_t max_bytes_);
+
+  // Find a cached printed range of `entity` (with additional discriminating
+  // bits `extra`, e.g. type qualifiers) and printing policy key `policy_key`.
+  // The returned range owns `ast`.
+  std::optional<PrintedTokenRange> Find(
+      const std::shared_ptr<ASTImpl> &ast, const void *entity, uint32_t extra,
+      uint64_t policy_key);
+
+  // Add `range`, printed from `ast`, to the cache, evicting the least recently
+  // used ranges if the cache is now too big. If `range` is cached, then it is
+  // re-bound so that it still owns `ast`.
+  void Insert(const std::shared_ptr<ASTImpl> &ast, const void *entity,
+              uint32_t extra, uint64_t policy_key, PrintedTokenRange &range);
+
+ private:
+  struct Key {
+    const void *entity;
+    uint64_t policy_key;
+    uint32_t extra;
+
+    inline bool operator==(const Key &that) const noexcept {
+      return entity == that.entity && policy_key == that.policy_key &&
+             extra == that.extra;
+    }
+  };
+
+  struct KeyHash {
+    inline size_t operator()(const Key &key) const noexcept {
+      auto hash = std::hash<const void *>{}(key.entity);
+      hash ^= std::hash<uint64_t>{}(key.policy_key) + 0x9e3779b9u +
+              (hash << 6u) + (hash >> 2u);
+      hash ^= std::hash<uint32_t>{}(key.extra) + 0x9e3779b9u +
+              (hash << 6u) + (hash >> 2u);
+      return hash;
+    }
+  };
+
+  using Entry = std::pair<Key, PrintedTokenRange>;
+
+  static size_t SizeInBytes(const PrintedTokenRangeImpl &impl);
+
+  // Return a copy of the cached `range` that owns `ast`.
+  static PrintedTokenRange Bind(const std::shared_ptr<ASTImpl> &ast,
+                                const PrintedTokenRange &range);
+
+  std::mutex mutex;
+
+  // Maximum and current approximate number of bytes used by cached ranges.
+  const size_t max_bytes;
+  size_t num_bytes{0u};
+
+  // Most recently used entries are at the front.
+  std::list<Entry> entries;
+  std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> key_to_entry;
+};
+
+}  // namespace pasta
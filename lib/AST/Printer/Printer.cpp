@@ -5,6 +5,8 @@
 #include "Printer.h"
 
 #include <cassert>
+#include <limits>
+#include <typeinfo>
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wbitfield-enum-conversion"
@@ -21,6 +23,7 @@
 #include <clang/Lex/Preprocessor.h>
 #pragma GCC diagnostic pop
 
+#include "PrintCache.h"
 #include "raw_ostream.h"
 
 #include "../AST.h"  // For `ASTImpl`.
@@ -117,7 +120,7 @@ static void TryLocateAttribute(const clang::Attr *A,
     // We've found all the openers that we expected to find. Now go and see if
     // we can match the actual attribute (e.g. `nonnull` above).
     if (num_found_openers >= expected_num_openers) {
-      if (tok.derived_index == kInvalidDerivedTokenIndex &&
+      if (!tok.HasLocation() &&
           (kind == clang::tok::identifier ||
            kind == clang::tok::raw_identifier)) {
         llvm::StringRef data(tok.Data(tokens));
@@ -283,7 +286,28 @@ std::optional<Token> PrintedToken::DerivedLocation(void) const {
       impl->derived_index >= range->ast->tokens.size()) {
     return std::nullopt;
   }
-  return Token(range->ast, &(range->ast->tokens[impl->derived_index]));
+  return Token(PrintedTokenRangeImpl::OwnedAST(range),
+               &(range->ast->tokens[impl->derived_index]));
+}
+
+// Return the data associated with this printed token. Printed token data is
+// stored in token order, and is always NUL-terminated, so this token's data
+// ends just before the NUL that precedes the next token's data.
+std::string_view PrintedTokenImpl::Data(
+    const PrintedTokenRangeImpl &range) const noexcept {
+  const PrintedTokenImpl *tokens_end = &(range.tokens.data()[
+      range.tokens.size()]);
+  assert(range.tokens.data() <= this && this < tokens_end);
+
+  const size_t data_end = (this + 1) < tokens_end ?
+                          this[1].data_offset : range.data.size();
+  if (data_offset >= data_end) {
+    return {};
+  }
+
+  assert(!range.data[data_end - 1u]);
+  return std::string_view(&(range.data[data_offset]),
+                          data_end - data_offset - 1u);
 }
 
 // Return the data associated with this token.
@@ -404,6 +428,33 @@ ptrdiff_t PrintedTokenIterator::operator-(
 
 PrintedTokenRangeImpl::~PrintedTokenRangeImpl(void) {}
 
+// Return an owning pointer to the AST of `self`.
+//
+// NOTE(pag): Ranges in a `PrintCache` only borrow their AST, i.e. `ast` has no
+//            control block. The `PrintedTokenRange`s referencing such ranges
+//            instead own the AST via the control block of `self`.
+std::shared_ptr<ASTImpl> PrintedTokenRangeImpl::OwnedAST(
+    const std::shared_ptr<PrintedTokenRangeImpl> &self) {
+  if (!self->ast || self->ast.use_count()) {
+    return self->ast;
+  }
+  return std::shared_ptr<ASTImpl>(self, self->ast.get());
+}
+
+// Lock the source manager of `ast`, if any, so that it can be queried while
+// other threads are printing from the same AST.
+//
+// NOTE(pag): Without an AST, this range wasn't printed by
+//            `PrintedTokenRange::PrintTopLevelDecls`, and so there's nothing
+//            else printing concurrently that we know of.
+std::unique_lock<std::mutex> PrintedTokenRangeImpl::LockSourceManager(
+    void) const {
+  if (ast) {
+    return std::unique_lock<std::mutex>(ast->source_manager_mutex);
+  }
+  return std::unique_lock<std::mutex>();
+}
+
 // If any token context index is invalid, then set it to `index`.
 void PrintedTokenRangeImpl::FixupInvalidTokenContexts(TokenContextIndex index) {
 
@@ -425,10 +476,14 @@ void PrintedTokenRangeImpl::FixupInvalidTokenContexts(TokenContextIndex index) {
 }
 
 void PrintedTokenRangeImpl::AddTrailingEOF(void) {
+  // We're done printing, so there's no more use for printed type fragments.
+  type_fragments.clear();
+
+  // NOTE(pag): The end-of-file token has empty data, which starts at the end
+  //            of `data`. See `PrintedTokenImpl::Data`.
   if (tokens.empty() || tokens.back().Kind() != clang::tok::eof) {
     tokens.emplace_back(
-        0u  /* data_offset */,
-        0u  /* data_len */,
+        static_cast<TokenDataIndex>(data.size()),
         kInvalidTokenContextIndex,
         0u  /* num_leading_new_lines */,
         0u  /* num_leading_spaces */,
@@ -436,6 +491,54 @@ void PrintedTokenRangeImpl::AddTrailingEOF(void) {
   }
 }
 
+// Move all tokens printed so far into their own printed token range, and pass
+// that range to `sink`.
+void PrintedTokenRangeImpl::Flush(PrintedTokenSink &sink,
+                                  size_t num_base_contexts) {
+  if (tokens.empty()) {
+    return;
+  }
+
+  auto chunk = std::make_shared<PrintedTokenRangeImpl>(ast_context);
+  chunk->ast = ast;
+
+  // NOTE(pag): Token data offsets are relative to the start of `data`, and
+  //            token context indices are absolute, so we can move both over
+  //            wholesale, so long as we keep the base contexts in the chunk.
+  chunk->tokens = std::move(tokens);
+  chunk->data = std::move(data);
+  chunk->contexts = contexts;
+  tokens.clear();
+  data.clear();
+
+  // Forget about any contexts that were created for the flushed tokens. The
+  // contexts of still-open printer contexts are all below `num_base_contexts`.
+  contexts.resize(num_base_contexts);
+  for (auto it = data_to_index.begin(); it != data_to_index.end(); ) {
+    if (it->second >= num_base_contexts) {
+      it = data_to_index.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  if (chunk->ast) {
+    chunk->FixupInvalidTokenContexts(kASTTokenContextIndex);
+  }
+  chunk->AddTrailingEOF();
+  sink.Accept(PrintedTokenRangeImpl::ToPrintedTokenRange(std::move(chunk)));
+}
+
+// Key used in `data_to_index` to combine identical aliases.
+static const void *AliasData(TokenContextIndex aliasee,
+                             TokenContextIndex parent_index) {
+  static_assert(sizeof(void *) == sizeof(uint64_t));
+  auto alias_addr = static_cast<uint64_t>(~aliasee);
+  alias_addr <<= 32u;
+  alias_addr |= parent_index;
+  return reinterpret_cast<const void *>(alias_addr);
+}
+
 const TokenContextIndex PrintedTokenRangeImpl::CreateAlias(
     TokenPrinterContext *tokenizer, TokenContextIndex aliasee) {
 
@@ -447,6 +550,7 @@ const TokenContextIndex PrintedTokenRangeImpl::CreateAlias(
   // it.
   if (tokenizer->prev_printer_context &&
       tokenizer->prev_printer_context->context_index == aliasee) {
+    ++num_context_reuses;
     return aliasee;
   }
 
@@ -456,13 +560,10 @@ const TokenContextIndex PrintedTokenRangeImpl::CreateAlias(
   }
 
   // Try to combine identical aliases.
-  static_assert(sizeof(void *) == sizeof(uint64_t));
-  auto alias_addr = static_cast<uint64_t>(~aliasee);
-  alias_addr <<= 32u;
-  alias_addr |= parent_index;
-  const auto alias_data = reinterpret_cast<const void *>(alias_addr);
+  const auto alias_data = AliasData(aliasee, parent_index);
   if (auto alias_it = data_to_index.find(alias_data);
       alias_it != data_to_index.end()) {
+    ++num_context_reuses;
     return alias_it->second;  // Found an identical usage.
   }
 
@@ -598,34 +699,39 @@ void TokenPrinterContext::Tokenize(void) {
     }
 
     // Try to identify keywords where possible.
+    //
+    // NOTE(pag): We don't use `Preprocessor::LookUpIdentifierInfo`, as it adds
+    //            never-before-seen identifiers into the identifier table, and
+    //            so we couldn't print in parallel. All keywords and macro names
+    //            will already be in the table.
     if (tokens.ast && tok.is(clang::tok::raw_identifier)) {
-      tokens.ast->orig_source_pp->LookUpIdentifierInfo(tok);
-      if (tok.is(clang::tok::identifier)) {
-        if (auto ii = tok.getIdentifierInfo()) {
-          if (ii->hasMacroDefinition()) {
-            tok.setKind(RewriteTokenKind(ii->getName()));
-          }
+      const clang::IdentifierTable &table =
+          tokens.ast->orig_source_pp->getIdentifierTable();
+      auto ii_it = table.find(tok.getRawIdentifier());
+      if (ii_it != table.end() && ii_it->second) {
+        clang::IdentifierInfo *ii = ii_it->second;
+        tok.setIdentifierInfo(ii);
+        tok.setKind(ii->getTokenID());
+        if (tok.is(clang::tok::identifier) && ii->hasMacroDefinition()) {
+          tok.setKind(RewriteTokenKind(ii->getName()));
         }
+      } else {
+        tok.setKind(clang::tok::identifier);
       }
     }
 
     const auto data_offset = static_cast<TokenDataIndex>(tokens.data.size());
-    assert(0ll <= static_cast<TokenDataOffset>(data_offset));
-    uint32_t data_len = 0u;
     tokens.data.reserve(data_offset + tok.getLength());
     for (last_i = i, i += tok.getLength(); last_i < i && token_data[last_i];
         ++last_i) {
       tokens.data.push_back(token_data[last_i]);
-      ++data_len;
-      assert(static_cast<uint32_t>(data_len & TokenImpl::kTokenSizeMask) != 0u);
     }
     tokens.data.push_back('\0');  // Make sure all tokens end up NUL-terminated.
+    assert(tokens.data.size() < std::numeric_limits<TokenDataIndex>::max());
 
     // Add the token in.
     tokens.tokens.emplace_back(
-        static_cast<TokenDataOffset>(data_offset),
-        static_cast<uint32_t>(data_len),
-        context_index, num_nl, num_sp, tok.getKind());
+        data_offset, context_index, num_nl, num_sp, tok.getKind());
 
     // Reset so that if there is no whitespace afte the last token, then we
     // don't randomly add in trailing whitespace.
@@ -681,7 +787,8 @@ void PrintedTokenRangeImpl::MarkLocation(size_t tok_index,
   // We don't have an `ASTImpl`, so we'll assume that `loc` is a "real" source
   // location and not our weird indirect kind.
   } else {
-    tokens[tok_index].opaque_source_loc = loc.getRawEncoding();
+    tokens[tok_index].SetLocation(
+        PrintedTokenImpl::Location{loc.getRawEncoding(), true});
   }
 }
 
@@ -708,31 +815,334 @@ TokenPrinterContext::~TokenPrinterContext(void) {
   }
 }
 
+// Add the pending whitespace `ws`, which preceded a type fragment, to the
+// leading whitespace of `tok`, the fragment's first token. This mirrors what
+// `TokenPrinterContext::Tokenize` would have done had the two been lexed
+// together.
+static void AddLeadingWhitespace(PrintedTokenImpl &tok, const std::string &ws) {
+  if (ws.empty() || tok.Kind() == clang::tok::semi ||
+      tok.Kind() == clang::tok::comma) {
+    return;
+  }
+
+  auto [num_nl, num_sp, i] = SkipWhitespace(ws, 0u);
+  (void) i;
+  if (tok.num_leading_new_lines) {
+    num_nl += tok.num_leading_new_lines;
+    num_sp = tok.num_leading_spaces;
+  } else {
+    num_sp += tok.num_leading_spaces;
+  }
+
+  assert(num_nl <= PrintedTokenImpl::kMaxNumLeadingNewLines);
+  assert(num_sp <= PrintedTokenImpl::kMaxNumLeadingSpaces);
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+  tok.num_leading_new_lines =
+      std::min(num_nl, PrintedTokenImpl::kMaxNumLeadingNewLines);
+  tok.num_leading_spaces =
+      std::min(num_sp, PrintedTokenImpl::kMaxNumLeadingSpaces);
+#pragma GCC diagnostic pop
+}
+
+static const void *AliaseeData(TokenContextIndex aliasee) {
+  return reinterpret_cast<const void *>(static_cast<uintptr_t>(aliasee));
+}
+
+static TokenContextIndex AliaseeIndex(const TokenContextImpl &context) {
+  return static_cast<TokenContextIndex>(
+      reinterpret_cast<uintptr_t>(context.data));
+}
+
+// Would a new context whose parent is `index` be deduplicated? This mirrors
+// the logic in `CreateContext`.
+static bool ChildContextsDedup(const PrintedTokenRangeImpl &range,
+                               TokenContextIndex index) {
+  const TokenContextImpl &context = range.contexts[index];
+  switch (context.kind) {
+    case TokenContextKind::kString:
+    case TokenContextKind::kType:
+      return false;
+    default:
+      return range.data_to_index.count(context.data) != 0u;
+  }
+}
+
+// Start recording the tokens and contexts printed by a type, on top of
+// `outer`.
+TypeFragmentRecording PrintedTokenRangeImpl::BeginTypeFragment(
+    TokenPrinterContext *outer) {
+  assert(curr_printer_context == outer);
+
+  TypeFragmentRecording recording;
+  recording.outer = outer;
+
+  // Tokenize anything pending, and hold on to any trailing whitespace, so that
+  // the fragment's first token only has its own leading whitespace.
+  outer->Tokenize();
+  recording.leading_whitespace.swap(outer->out.str());
+
+  recording.num_tokens = tokens.size();
+  recording.num_contexts = contexts.size();
+  recording.num_data_bytes = data.size();
+  recording.num_context_reuses = num_context_reuses;
+  recording.num_data_to_index = data_to_index.size();
+  recording.num_printed_defs = outer->out.printed_defs.size();
+  recording.outer_dedups = ChildContextsDedup(*this, outer->context_index);
+
+  // `MarkLocation` applies to the last printed token, which, until the type
+  // prints something, is outside of the fragment. Clear it so that we can
+  // tell if that happens.
+  if (!tokens.empty()) {
+    recording.prev_location = tokens.back().GetLocation();
+    tokens.back().SetLocation({});
+  }
+
+  return recording;
+}
+
+// Finish recording the tokens and contexts printed by a type. Returns
+// `std::nullopt` if what was printed depends on more than the type and the
+// printing policy, e.g. if it reused contexts from outside the fragment.
+std::optional<TypeFragment> PrintedTokenRangeImpl::EndTypeFragment(
+    const TypeFragmentRecording &recording) {
+  TokenPrinterContext * const outer = recording.outer;
+  assert(curr_printer_context == outer);
+  outer->Tokenize();
+
+  const TokenContextIndex outer_index = outer->context_index;
+  const size_t num_fragment_tokens = tokens.size() - recording.num_tokens;
+
+  auto cacheable = num_context_reuses == recording.num_context_reuses &&
+                   outer->out.printed_defs.size() ==
+                       recording.num_printed_defs &&
+                   num_fragment_tokens <= TypeFragment::kMaxNumTokens;
+
+  if (recording.num_tokens) {
+    PrintedTokenImpl &prev_tok = tokens[recording.num_tokens - 1u];
+    if (!prev_tok.HasLocation()) {
+      prev_tok.SetLocation(recording.prev_location);
+    } else {
+      cacheable = false;  // Keep the new location, but don't cache.
+    }
+  }
+
+  // Convert an absolute context index into one relative to the fragment.
+  auto relative = [&] (TokenContextIndex &index) {
+    if (index == outer_index) {
+      index = TypeFragment::kOuterContext;
+      return true;
+    } else if (index != kInvalidTokenContextIndex &&
+               index >= recording.num_contexts && index < contexts.size()) {
+      index -= static_cast<TokenContextIndex>(recording.num_contexts);
+      return true;
+    } else {
+      return false;
+    }
+  };
+
+  TypeFragment fragment;
+  fragment.outer_dedups = recording.outer_dedups;
+  fragment.trailing_whitespace = outer->out.str();
+
+  size_t num_aliases = 0u;
+  for (auto i = recording.num_contexts; cacheable && i < contexts.size(); ++i) {
+    TokenContextImpl &context = fragment.contexts.emplace_back(contexts[i]);
+    cacheable = relative(context.parent_index);
+
+    if (context.kind == TokenContextKind::kAlias) {
+      auto aliasee = AliaseeIndex(context);
+      cacheable = cacheable && relative(aliasee);
+      context.data = AliaseeData(aliasee);
+      ++num_aliases;
+
+    // Anonymous tags have their definitions printed inline, but only the first
+    // time that they're seen by the output stream.
+    } else if (context.kind == TokenContextKind::kDecl) {
+      auto tag = clang::dyn_cast<clang::TagDecl>(
+          reinterpret_cast<const clang::Decl *>(context.data));
+      if (tag && !tag->getIdentifier()) {
+        cacheable = false;
+      }
+    }
+  }
+
+  // Aliases are the only contexts that permanently add to `data_to_index`.
+  cacheable = cacheable &&
+              data_to_index.size() == recording.num_data_to_index + num_aliases;
+
+  const auto data_base = static_cast<TokenDataIndex>(recording.num_data_bytes);
+  for (auto i = recording.num_tokens; cacheable && i < tokens.size(); ++i) {
+    PrintedTokenImpl &tok = fragment.tokens.emplace_back(tokens[i]);
+    tok.data_offset -= data_base;
+    cacheable = relative(tok.context_index);
+  }
+
+  if (cacheable) {
+    fragment.data = data.substr(recording.num_data_bytes);
+  }
+
+  // Put back the whitespace that preceded the fragment.
+  if (num_fragment_tokens) {
+    AddLeadingWhitespace(tokens[recording.num_tokens],
+                         recording.leading_whitespace);
+  } else {
+    outer->out.str().insert(0u, recording.leading_whitespace);
+  }
+
+  if (!cacheable) {
+    return std::nullopt;
+  }
+
+  return fragment;
+}
+
+// Try to splice in a previously recorded `fragment` on top of `outer`,
+// exactly as if the type was re-printed. Returns `false`, having changed
+// nothing, if re-printing the type here would produce something different.
+bool PrintedTokenRangeImpl::SpliceTypeFragment(
+    TokenPrinterContext *outer, const TypeFragment &fragment) {
+  assert(curr_printer_context == outer);
+
+  const TokenContextIndex outer_index = outer->context_index;
+  const auto context_base = static_cast<TokenContextIndex>(contexts.size());
+  const void * const outer_data = contexts[outer_index].data;
+
+  auto absolute = [=] (TokenContextIndex index) {
+    if (index == TypeFragment::kOuterContext) {
+      return outer_index;
+    } else {
+      return context_base + index;
+    }
+  };
+
+  if (fragment.outer_dedups != ChildContextsDedup(*this, outer_index)) {
+    return false;
+  }
+
+  // Make sure that `CreateContext` and `CreateAlias` would have created all
+  // of the fragment's contexts, rather than reuse existing ones.
+  for (const TokenContextImpl &context : fragment.contexts) {
+    const auto parent_index = absolute(context.parent_index);
+    switch (context.kind) {
+      case TokenContextKind::kAlias:
+        if (data_to_index.count(
+                AliasData(absolute(AliaseeIndex(context)), parent_index))) {
+          return false;
+        }
+        break;
+      case TokenContextKind::kString:
+      case TokenContextKind::kType:
+        if (parent_index == outer_index && context.data == outer_data) {
+          return false;
+        }
+        break;
+      default:
+        if (data_to_index.count(context.data) ||
+            (parent_index == outer_index && context.data == outer_data)) {
+          return false;
+        }
+        break;
+    }
+  }
+
+  outer->Tokenize();
+  std::string leading_whitespace;
+  leading_whitespace.swap(outer->out.str());
+
+  contexts.reserve(contexts.size() + fragment.contexts.size());
+  for (const TokenContextImpl &context : fragment.contexts) {
+    const auto index = static_cast<TokenContextIndex>(contexts.size());
+    const auto parent_index = absolute(context.parent_index);
+    const unsigned depth = contexts[parent_index].depth + 1u;
+    if (context.kind == TokenContextKind::kAlias) {
+      const auto aliasee = absolute(AliaseeIndex(context));
+      contexts.emplace_back(AliaseeData(aliasee), parent_index, depth,
+                            TokenContextKind::kAlias);
+      data_to_index.emplace(AliasData(aliasee, parent_index), index);
+    } else {
+      contexts.emplace_back(context.data, parent_index, depth, context.kind);
+    }
+  }
+
+  const auto first_tok_index = tokens.size();
+  const auto data_base = static_cast<TokenDataIndex>(data.size());
+  data.append(fragment.data);
+
+  tokens.reserve(tokens.size() + fragment.tokens.size());
+  for (const PrintedTokenImpl &frag_tok : fragment.tokens) {
+    PrintedTokenImpl &tok = tokens.emplace_back(frag_tok);
+    tok.data_offset += data_base;
+    tok.context_index = absolute(frag_tok.context_index);
+  }
+
+  if (first_tok_index < tokens.size()) {
+    AddLeadingWhitespace(tokens[first_tok_index], leading_whitespace);
+    outer->out.str() = fragment.trailing_whitespace;
+  } else {
+    outer->out.str() = leading_whitespace + fragment.trailing_whitespace;
+  }
+
+  return true;
+}
+
+// Print something using `create`, or return a previously printed range of
+// `entity` from the AST's print cache, if any.
+template <typename CreateFunc>
+static PrintedTokenRange CreateCached(
+    const std::shared_ptr<ASTImpl> &ast, const void *entity, uint32_t extra,
+    const PrintingPolicy &pp, CreateFunc create) {
+  std::shared_ptr<PrintCache> cache = ast->print_cache;
+  if (!cache) {
+    return create();
+  }
+
+  std::optional<uint64_t> policy_key = pp.CacheKey();
+  if (!policy_key) {
+    return create();
+  }
+
+  if (auto cached = cache->Find(ast, entity, extra, policy_key.value())) {
+    return std::move(cached.value());
+  }
+
+  PrintedTokenRange range = create();
+  cache->Insert(ast, entity, extra, policy_key.value(), range);
+  return range;
+}
+
 // More typical APIs when we've got PASTA ASTs.
 PrintedTokenRange PrintedTokenRange::Create(
     const Decl &decl, const PrintingPolicy &pp) {
-  return PrintedTokenRange::Create(
-      decl.ast, const_cast<clang::Decl *>(decl.u.Decl), pp);
+  return CreateCached(decl.ast, decl.u.Decl, 0u, pp, [&] (void) {
+    return PrintedTokenRange::Create(
+        decl.ast, const_cast<clang::Decl *>(decl.u.Decl), pp);
+  });
 }
 
 // More typical APIs when we've got PASTA ASTs.
 PrintedTokenRange PrintedTokenRange::Create(
     const Stmt &stmt, const PrintingPolicy &pp) {
-  return PrintedTokenRange::Create(
-      stmt.ast, const_cast<clang::Stmt *>(stmt.u.Stmt), pp);
+  return CreateCached(stmt.ast, stmt.u.Stmt, 0u, pp, [&] (void) {
+    return PrintedTokenRange::Create(
+        stmt.ast, const_cast<clang::Stmt *>(stmt.u.Stmt), pp);
+  });
 }
 
 // More typical APIs when we've got PASTA ASTs.
 PrintedTokenRange PrintedTokenRange::Create(
     const Type &type, const PrintingPolicy &pp) {
-  auto &ast = type.ast;
-  auto &ast_ctx = ast->ci->getASTContext();
-  clang::QualType fast_qtype(type.u.Type,
-                             type.qualifiers & clang::Qualifiers::FastMask);
-  auto self = ast_ctx.getQualifiedType(
-      fast_qtype, clang::Qualifiers::fromOpaqueValue(type.qualifiers));
+  return CreateCached(type.ast, type.u.Type, type.qualifiers, pp, [&] (void) {
+    auto &ast = type.ast;
+    auto &ast_ctx = ast->ci->getASTContext();
+    clang::QualType fast_qtype(type.u.Type,
+                               type.qualifiers & clang::Qualifiers::FastMask);
+    auto self = ast_ctx.getQualifiedType(
+        fast_qtype, clang::Qualifiers::fromOpaqueValue(type.qualifiers));
 
-  return PrintedTokenRange::Create(type.ast, self, pp);
+    return PrintedTokenRange::Create(type.ast, self, pp);
+  });
 }
 
 // Number of tokens in this range.
@@ -778,49 +1188,67 @@ std::optional<PrintedTokenRange> PrintedTokenRange::Concatenate(
     return std::nullopt;
   }
 
-  auto new_impl = std::make_shared<PrintedTokenRangeImpl>(a.impl->ast_context);
-  new_impl->ast = a.impl->ast;
-  new_impl->tokens.reserve(a.impl->tokens.size() + b.impl->tokens.size() + 1u);
-  new_impl->contexts.reserve(
-      ((a.impl->contexts.size() + b.impl->contexts.size()) * 3u) / 2u);
-  new_impl->data = a.impl->data + b.impl->data;
+  return PrintedTokenRangeImpl::Concatenate(
+      a.impl->ast_context, PrintedTokenRangeImpl::OwnedAST(a.impl), {a, b});
+}
+
+// Concatenate `ranges` together, in order, into a new printed token range.
+PrintedTokenRange PrintedTokenRangeImpl::Concatenate(
+    clang::ASTContext &ast_context, const std::shared_ptr<ASTImpl> &ast,
+    const std::vector<PrintedTokenRange> &ranges) {
 
-  for (PrintedTokenImpl &new_tok : new_impl->tokens) {
-    new_tok.matched_in_align = false;
+  auto new_impl = std::make_shared<PrintedTokenRangeImpl>(ast_context);
+  new_impl->ast = ast;
+
+  size_t num_tokens = 1u;
+  size_t num_contexts = 0u;
+  size_t num_bytes = 0u;
+  for (const PrintedTokenRange &range : ranges) {
+    num_tokens += range.Size();
+    num_contexts += range.impl->contexts.size();
+    num_bytes += range.impl->data.size();
   }
 
+  new_impl->tokens.reserve(num_tokens);
+  new_impl->contexts.reserve((num_contexts * 3u) / 2u);
+  new_impl->data.reserve(num_bytes);
+
   std::unordered_multimap<const void *, TokenContextIndex> data_to_context;
 
   // Top-level context should be the AST.
-  if (a.impl->ast) {
-    new_impl->contexts.emplace_back(*(new_impl->ast));
-    data_to_context.emplace(new_impl->ast.get(), kASTTokenContextIndex);
+  if (ast) {
+    new_impl->contexts.emplace_back(*ast);
+    data_to_context.emplace(ast.get(), kASTTokenContextIndex);
   }
 
   std::vector<TokenContextIndex> context_map;
-  context_map.assign(a.impl->contexts.size(), kInvalidTokenContextIndex);
-
-  for (auto a_tok = a.first; a_tok < a.after_last; ++a_tok) {
-    if (a_tok->Kind() != clang::tok::eof) {
-      PrintedTokenImpl &new_tok = new_impl->tokens.emplace_back(*a_tok);
-      new_tok.matched_in_align = false;
-      new_tok.context_index = MigrateContexts(
-          new_tok.context_index, a.impl->contexts, new_impl->contexts,
-          data_to_context, context_map);
-    }
-  }
 
-  context_map.assign(b.impl->contexts.size(), kInvalidTokenContextIndex);
+  for (const PrintedTokenRange &range : ranges) {
+    if (!range) {
+      continue;
+    }
 
-  auto a_data_size = static_cast<TokenDataOffset>(a.impl->data.size());
-  for (auto b_tok = b.first; b_tok < b.after_last; ++b_tok) {
-    if (b_tok->Kind() != clang::tok::eof) {
-      PrintedTokenImpl &new_tok = new_impl->tokens.emplace_back(*b_tok);
-      new_tok.matched_in_align = false;
-      new_tok.data_offset += a_data_size;
-      new_tok.context_index = MigrateContexts(
-          new_tok.context_index, b.impl->contexts, new_impl->contexts,
-          data_to_context, context_map);
+    assert(&(range.impl->ast_context) == &ast_context);
+    assert(range.impl->ast.get() == ast.get());
+
+    context_map.assign(range.impl->contexts.size(), kInvalidTokenContextIndex);
+
+    // NOTE(pag): `range` may be a slice of its tokens, and so only the data of
+    //            the tokens in the slice is copied, keeping `new_impl->data`
+    //            in token order. See `PrintedTokenImpl::Data`.
+    for (auto tok = range.first; tok < range.after_last; ++tok) {
+      if (tok->Kind() != clang::tok::eof) {
+        const std::string_view tok_data = tok->Data(*(range.impl));
+        PrintedTokenImpl &new_tok = new_impl->tokens.emplace_back(*tok);
+        new_tok.matched_in_align = false;
+        new_tok.data_offset = static_cast<TokenDataIndex>(
+            new_impl->data.size());
+        new_impl->data.append(tok_data);
+        new_impl->data.push_back('\0');
+        new_tok.context_index = MigrateContexts(
+            new_tok.context_index, range.impl->contexts, new_impl->contexts,
+            data_to_context, context_map);
+      }
     }
   }
 
@@ -828,6 +1256,140 @@ std::optional<PrintedTokenRange> PrintedTokenRange::Concatenate(
   return PrintedTokenRangeImpl::ToPrintedTokenRange(std::move(new_impl));
 }
 
+PrintedTokenRope::PrintedTokenRope(const PrintedTokenRange &range) {
+  auto leaf = std::make_shared<PrintedTokenRopeImpl>();
+  if (range.impl) {
+    leaf->ast_context = &(range.impl->ast_context);
+    leaf->ast = PrintedTokenRangeImpl::OwnedAST(range.impl);
+  }
+  leaf->leaf.emplace(range);
+  leaf->num_tokens = range.Size();
+  leaf->num_segments = leaf->num_tokens ? 1u : 0u;
+  impl = std::move(leaf);
+}
+
+// Create a new rope that references the segments of `a` followed by the
+// segments of `b`.
+std::optional<PrintedTokenRope> PrintedTokenRope::Concatenate(
+    const PrintedTokenRope &a, const PrintedTokenRope &b) {
+  if (!b.impl->num_segments) {
+    return a;
+  }
+
+  if (!a.impl->num_segments) {
+    return b;
+  }
+
+  if (a.impl->ast.get() != b.impl->ast.get()) {
+    return std::nullopt;
+  }
+
+  if (a.impl->ast_context != b.impl->ast_context) {
+    return std::nullopt;
+  }
+
+  auto node = std::make_shared<PrintedTokenRopeImpl>();
+  node->ast_context = a.impl->ast_context;
+  node->ast = a.impl->ast;
+  node->left = a.impl;
+  node->right = b.impl;
+  node->num_tokens = a.impl->num_tokens + b.impl->num_tokens;
+  node->num_segments = a.impl->num_segments + b.impl->num_segments;
+  return PrintedTokenRope(std::move(node));
+}
+
+// Number of tokens in this rope.
+size_t PrintedTokenRope::Size(void) const noexcept {
+  return impl->num_tokens;
+}
+
+// Number of non-empty printed token ranges referenced by this rope.
+size_t PrintedTokenRope::NumSegments(void) const noexcept {
+  return impl->num_segments;
+}
+
+// Return the non-empty printed token ranges referenced by this rope, in order.
+std::vector<PrintedTokenRange> PrintedTokenRope::Segments(void) const {
+  std::vector<PrintedTokenRange> segments;
+  segments.reserve(impl->num_segments);
+  impl->ForEachSegment([&] (const PrintedTokenRange &segment) {
+    segments.push_back(segment);
+  });
+  return segments;
+}
+
+// Return a single contiguous printed token range containing all tokens in this
+// rope.
+PrintedTokenRange PrintedTokenRope::Flatten(void) const {
+  if (impl->leaf) {
+    return impl->leaf.value();
+  }
+
+  std::lock_guard<std::mutex> locker(impl->flatten_mutex);
+  if (impl->flattened) {
+    return impl->flattened.value();
+  }
+
+  std::vector<PrintedTokenRange> segments = Segments();
+  if (segments.size() == 1u) {
+    impl->flattened.emplace(std::move(segments.front()));
+  } else {
+    impl->flattened.emplace(PrintedTokenRangeImpl::Concatenate(
+        *(impl->ast_context), impl->ast, segments));
+  }
+
+  impl->ReleaseFlattenedDescendants();
+  return impl->flattened.value();
+}
+
+// Release the flattened ranges of all inner nodes below this one.
+//
+// NOTE(pag): Locks are only ever acquired from a node down to its descendants,
+//            and so this can't deadlock with a concurrent `Flatten` of an
+//            overlapping rope.
+void PrintedTokenRopeImpl::ReleaseFlattenedDescendants(void) const {
+  std::vector<const PrintedTokenRopeImpl *> wl;
+  wl.push_back(left.get());
+  wl.push_back(right.get());
+  while (!wl.empty()) {
+    const PrintedTokenRopeImpl *node = wl.back();
+    wl.pop_back();
+    if (!node || node->leaf) {
+      continue;
+    }
+
+    {
+      std::lock_guard<std::mutex> locker(node->flatten_mutex);
+      node->flattened.reset();
+    }
+
+    wl.push_back(node->right.get());
+    wl.push_back(node->left.get());
+  }
+}
+
+// Tear down the rope iteratively. If we hold the last reference to a child,
+// then we take ownership of its children before it is destroyed, so that each
+// node is destroyed without any children of its own.
+PrintedTokenRopeImpl::~PrintedTokenRopeImpl(void) {
+  std::vector<std::shared_ptr<const PrintedTokenRopeImpl>> wl;
+  wl.push_back(std::move(left));
+  wl.push_back(std::move(right));
+  while (!wl.empty()) {
+    std::shared_ptr<const PrintedTokenRopeImpl> node = std::move(wl.back());
+    wl.pop_back();
+    if (!node || node.use_count() != 1) {
+      continue;
+    }
+
+    // NOTE(pag): Rope nodes are only ever created non-`const`, via
+    //            `std::make_shared`.
+    auto &mutable_node = const_cast<PrintedTokenRopeImpl &>(*node);
+    wl.push_back(std::move(mutable_node.left));
+    wl.push_back(std::move(mutable_node.right));
+  }
+}
+
 // Tell us if this was a token that was actually parsed.
 static bool IsParsedToken(const pasta::Token &tok) {
   switch (tok.Role()) {
@@ -859,8 +1421,7 @@ PrintedTokenRange PrintedTokenRange::Adopt(const TokenRange &a) {
 
     std::string_view data = tok.Data();
     PrintedTokenImpl &new_tok = new_impl->tokens.emplace_back(
-        static_cast<TokenDataOffset>(new_impl->data.size()),
-        static_cast<uint32_t>(data.size()),
+        static_cast<TokenDataIndex>(new_impl->data.size()),
         kASTTokenContextIndex,
         0u  /* Leading new lines */,
         num_leading_spaces,
@@ -868,7 +1429,6 @@ PrintedTokenRange PrintedTokenRange::Adopt(const TokenRange &a) {
 
     num_leading_spaces = 1u;
 
-    new_tok.role = static_cast<TokenKindBase>(TokenRole::kFileToken);
     new_tok.derived_index = static_cast<DerivedTokenIndex>(tok.Index());
     new_impl->data.insert(new_impl->data.end(), data.begin(), data.end());
     new_impl->data.push_back('\0');
@@ -880,18 +1440,54 @@ PrintedTokenRange PrintedTokenRange::Adopt(const TokenRange &a) {
 
 // Create a copy of `a`.
 PrintedTokenRange PrintedTokenRange::Copy(const PrintedTokenRange &a) {
-  return PrintedTokenRangeImpl::ToPrintedTokenRange(
-      std::make_shared<PrintedTokenRangeImpl>(*a.impl));
+  auto new_impl = std::make_shared<PrintedTokenRangeImpl>(*a.impl);
+  new_impl->ast = PrintedTokenRangeImpl::OwnedAST(a.impl);
+  return PrintedTokenRangeImpl::ToPrintedTokenRange(std::move(new_impl));
+}
+
+// If `range` is shared via a `PrintCache`, then replace it with a private copy
+// of itself.
+void PrintedTokenRangeImpl::Unshare(PrintedTokenRange &range) {
+  if (!range.impl || !range.impl->is_cached) {
+    return;
+  }
+
+  const PrintedTokenImpl *old_first_tok = range.impl->tokens.data();
+  const auto first_index = range.first - old_first_tok;
+  const auto after_last_index = range.after_last - old_first_tok;
+
+  auto new_impl = std::make_shared<PrintedTokenRangeImpl>(*(range.impl));
+  new_impl->ast = OwnedAST(range.impl);
+  range.impl = std::move(new_impl);
+  range.first = &(range.impl->tokens.data()[first_index]);
+  range.after_last = &(range.impl->tokens.data()[after_last_index]);
 }
 
 // Dump token provenance information.
 void PrintedTokenRange::DumpProvenanceInformation(void) {
+  PrintedTokenRangeImpl::Unshare(*this);
   for (auto tok = first; tok < after_last; ++tok) {
-    tok->opaque_source_loc = TokenImpl::kInvalidSourceLocation;
-    tok->derived_index = kInvalidDerivedTokenIndex;
+    tok->SetLocation({});
+  }
+}
+
+PrintedTokenSink::~PrintedTokenSink(void) {}
+
+// Render `tokens` to text, and pass it along to `AcceptText`.
+void PrintedTokenSink::Accept(const PrintedTokenRange &tokens) {
+  text_buffer.clear();
+  for (auto tok = tokens.first; tok < tokens.after_last; ++tok) {
+    text_buffer.append(tok->num_leading_new_lines, '\n');
+    text_buffer.append(tok->num_leading_spaces, ' ');
+    text_buffer.append(tok->Data(*(tokens.impl)));
+  }
+  if (!text_buffer.empty()) {
+    AcceptText(text_buffer);
   }
 }
 
+void PrintedTokenSink::AcceptText(std::string_view) {}
+
 PrintingPolicy::~PrintingPolicy(void) {}
 
 bool PrintingPolicy::ShouldPrintTagBodies(void) const {
@@ -905,6 +1501,7 @@ static constexpr bool kShouldPrintImplicitAttributes = false;
 static constexpr bool kShouldPrintConstantExpressionsInTypes = true;
 static constexpr bool kShouldPrintOriginalTypeOfAdjustedType = true;
 static constexpr bool kShouldPrintOriginalTypeOfDecayedType = true;
+static constexpr bool kShouldCachePrintedTypes = true;
 static constexpr bool kShouldPrintTemplate = true;
 static constexpr bool kShouldPrintSpecialization = false;
 
@@ -928,6 +1525,10 @@ bool PrintingPolicy::ShouldPrintOriginalTypeOfDecayedType(void) const {
   return kShouldPrintOriginalTypeOfDecayedType;
 }
 
+bool PrintingPolicy::ShouldCachePrintedTypes(void) const {
+  return kShouldCachePrintedTypes;
+}
+
 bool PrintingPolicy::ShouldPrintTemplate(const TemplateDecl &) const {
   return kShouldPrintTemplate;
 }
@@ -957,6 +1558,15 @@ bool PrintingPolicy::ShouldPrintSpecialization(
   return kShouldPrintSpecialization;
 }
 
+// Only an unspecialized `PrintingPolicy` is known to make context-independent
+// decisions. Subclasses must opt into caching.
+std::optional<uint64_t> PrintingPolicy::CacheKey(void) const {
+  if (typeid(*this) == typeid(PrintingPolicy)) {
+    return 0u;
+  }
+  return std::nullopt;
+}
+
 ProxyPrintingPolicy::~ProxyPrintingPolicy(void) {}
 
 bool ProxyPrintingPolicy::ShouldPrintTagBodies(void) const {
@@ -983,6 +1593,10 @@ bool ProxyPrintingPolicy::ShouldPrintOriginalTypeOfDecayedType(void) const {
   return next.ShouldPrintOriginalTypeOfDecayedType();
 }
 
+bool ProxyPrintingPolicy::ShouldCachePrintedTypes(void) const {
+  return next.ShouldCachePrintedTypes();
+}
+
 bool ProxyPrintingPolicy::ShouldPrintTemplate(const TemplateDecl &tpl) const {
   return next.ShouldPrintTemplate(tpl);
 }
@@ -1013,6 +1627,14 @@ bool ProxyPrintingPolicy::ShouldPrintSpecialization(
   return next.ShouldPrintSpecialization(tpl, spec);
 }
 
+// A proxy makes the same decisions as `next` unless a subclass overrides them.
+std::optional<uint64_t> ProxyPrintingPolicy::CacheKey(void) const {
+  if (typeid(*this) == typeid(ProxyPrintingPolicy)) {
+    return next.CacheKey();
+  }
+  return std::nullopt;
+}
+
 bool PrintingPolicyAdaptor::ShouldPrintInheritedAttributes(void) const {
   return pp ? pp->ShouldPrintInheritedAttributes() : kShouldPrintInheritedAttributes;
 }
@@ -1033,6 +1655,10 @@ bool PrintingPolicyAdaptor::ShouldPrintOriginalTypeOfDecayedType(void) const {
   return pp ? pp->ShouldPrintOriginalTypeOfDecayedType() : kShouldPrintOriginalTypeOfDecayedType;
 }
 
+bool PrintingPolicyAdaptor::ShouldCachePrintedTypes(void) const {
+  return pp ? pp->ShouldCachePrintedTypes() : kShouldCachePrintedTypes;
+}
+
 bool PrintingPolicyAdaptor::ShouldPrintTemplate(
     clang::TemplateDecl *tpl) const {
 
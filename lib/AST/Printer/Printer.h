@@ -14,11 +14,17 @@
 #include <llvm/Support/raw_ostream.h>
 #pragma GCC diagnostic pop
 
+#include <algorithm>
 #include <cassert>
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
 
 #include "../Token.h"
 
@@ -44,13 +50,54 @@ enum TokenKind : unsigned short;
 }  // namespace clang
 namespace pasta {
 
+class AlignmentSessionImpl;
 class ASTImpl;
 class raw_string_ostream;
 class PrintingPolicyAdaptor;
 
-// TODO(pag): Make `PrintedTokenImpl` independent of `TokenImpl`.
-class PrintedTokenImpl : public TokenImpl {
+// Backing implementation of a printed token. This is deliberately separate
+// from, and much more compact than, `TokenImpl`, as printed token ranges are
+// created in bulk, and printed tokens don't have roles, macro information, or
+// source locations of their own.
+//
+// NOTE(pag): Printed tokens don't store the lengths of their data. The data of
+//            the tokens of a `PrintedTokenRangeImpl` is stored in token order,
+//            with each token's data followed by a NUL, and so a token's data
+//            ends just before the next token's data begins. See `Data`.
+class PrintedTokenImpl {
  public:
+  static constexpr unsigned kMaxNumLeadingNewLines = (1u << 8u) - 1u;
+  static constexpr unsigned kMaxNumLeadingSpaces = (1u << 12u) - 1u;
+
+  // Where a printed token came from. See `GetLocation`.
+  struct Location {
+    uint32_t value{kInvalidDerivedTokenIndex};
+    bool is_raw{false};
+  };
+
+  // Offset of this token's data in `PrintedTokenRangeImpl::data`.
+  TokenDataIndex data_offset;
+
+  // Index of this token's context in `PrintedTokenRangeImpl::contexts`.
+  TokenContextIndex context_index;
+
+  // Where this token came from. `has_raw_location` tells us which of these is
+  // in use.
+  union {
+
+    // Index of the parsed token, in `ASTImpl::tokens`, from which this token
+    // was derived.
+    DerivedTokenIndex derived_index{kInvalidDerivedTokenIndex};
+
+    // If the range has no AST (i.e. it was printed from a "raw" Clang AST),
+    // then this is the raw encoding of the source location of the token.
+    uint32_t raw_location;
+  };
+
+  uint32_t num_leading_new_lines:8;
+
+  // The token kind.
+  uint32_t kind:10;
 
   // NOTE(pag): Printed tokens are not just superficially used. They are
   //            critical to how PASTA maps tokens back into the AST's nodes.
@@ -59,25 +106,137 @@ class PrintedTokenImpl : public TokenImpl {
   //            it relies on O(n^2) algorithms, and so to minimize `n`, we want
   //            to be able to say "we've matched this thing to something" so
   //            that we don't need to repeatedly check it.
-  bool matched_in_align{false};
+  uint32_t matched_in_align:1;
+
+  // Is `raw_location`, rather than `derived_index`, in use?
+  uint32_t has_raw_location:1;
 
-  uint8_t num_leading_new_lines{0};
-  uint16_t num_leading_spaces{0};
+  uint32_t num_leading_spaces:12;
 
-  inline PrintedTokenImpl(TokenDataOffset data_offset_, uint32_t data_len_,
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+  inline PrintedTokenImpl(TokenDataIndex data_offset_,
                           TokenContextIndex token_context_index_,
                           unsigned num_leading_new_lines_,
                           unsigned num_leading_spaces_,
                           clang::tok::TokenKind kind_)
-      : TokenImpl(TokenImpl::kInvalidSourceLocation, data_offset_,
-                  data_len_, kind_, TokenRole::kInvalid,
-                  token_context_index_),
-        matched_in_align(false),
-        num_leading_new_lines(static_cast<uint8_t>(num_leading_new_lines_)),
-        num_leading_spaces(static_cast<uint16_t>(num_leading_spaces_)) {
+      : data_offset(data_offset_),
+        context_index(token_context_index_),
+        num_leading_new_lines(
+            std::min(num_leading_new_lines_, kMaxNumLeadingNewLines)),
+        kind(static_cast<uint32_t>(kind_) & 0x3FFu),
+        matched_in_align(0u),
+        has_raw_location(0u),
+        num_leading_spaces(
+            std::min(num_leading_spaces_, kMaxNumLeadingSpaces)) {
+    assert(kind == static_cast<uint32_t>(kind_));
     assert(num_leading_new_lines == num_leading_new_lines_);
     assert(num_leading_spaces == num_leading_spaces_);
   }
+#pragma GCC diagnostic pop
+
+  inline clang::tok::TokenKind Kind(void) const noexcept {
+    return static_cast<clang::tok::TokenKind>(kind);
+  }
+
+  // Does this token know where it came from?
+  inline bool HasLocation(void) const noexcept {
+    return has_raw_location || derived_index != kInvalidDerivedTokenIndex;
+  }
+
+  inline Location GetLocation(void) const noexcept {
+    if (has_raw_location) {
+      return Location{raw_location, true};
+    } else {
+      return Location{derived_index, false};
+    }
+  }
+
+  inline void SetLocation(Location loc) noexcept {
+    if (loc.is_raw) {
+      raw_location = loc.value;
+      has_raw_location = 1u;
+    } else {
+      derived_index = loc.value;
+      has_raw_location = 0u;
+    }
+  }
+
+  // Return the data of this token, which must be one of the tokens of
+  // `range`.
+  std::string_view Data(const PrintedTokenRangeImpl &range) const noexcept;
+};
+
+static_assert(clang::tok::NUM_TOKENS <= (1u << 10u));
+static_assert(sizeof(PrintedTokenImpl) == 16u);
+
+// Identifies a printed type fragment within a print session: the type as
+// written (not its canonical form, as sugar such as typedef names is printed),
+// and the bits of the printing policy, and of the `TypePrinter` state, that
+// can change while printing.
+struct TypeFragmentKey {
+  const void *type{nullptr};
+  const void *callbacks{nullptr};
+  uint64_t policy{0u};
+
+  inline bool operator==(const TypeFragmentKey &that) const noexcept {
+    return type == that.type && callbacks == that.callbacks &&
+           policy == that.policy;
+  }
+};
+
+struct TypeFragmentKeyHash {
+  inline size_t operator()(const TypeFragmentKey &key) const noexcept {
+    auto hash = std::hash<const void *>{}(key.type);
+    hash ^= std::hash<uint64_t>{}(key.policy) + 0x9e3779b97f4a7c15ull +
+            (hash << 6u) + (hash >> 2u);
+    hash ^= std::hash<const void *>{}(key.callbacks) + 0x9e3779b97f4a7c15ull +
+            (hash << 6u) + (hash >> 2u);
+    return hash;
+  }
+};
+
+// The tokens and token contexts produced by printing a type, recorded so that
+// later prints of the same type in the same print session can be spliced in
+// rather than re-printed. Context indices (token context indices, parent
+// indices, and aliasees) are relative to the first context of the fragment,
+// with `kOuterContext` standing for the context that was on top of the token
+// printer context stack when the type was printed. Data offsets are relative
+// to the beginning of `data`.
+class TypeFragment {
+ public:
+  static constexpr TokenContextIndex kOuterContext = kInvalidTokenContextIndex;
+
+  // Fragments bigger than this aren't worth holding on to, as they are likely
+  // to be one-off things, e.g. types containing expressions.
+  static constexpr size_t kMaxNumTokens = 256u;
+
+  std::vector<PrintedTokenImpl> tokens;
+  std::vector<TokenContextImpl> contexts;
+  std::string data;
+
+  // Were contexts created directly on top of the outer context subject to
+  // deduplication? See `CreateContext`.
+  bool outer_dedups{false};
+
+  // Whitespace that followed the last token of the fragment. This is left in
+  // the output stream for the next call to `TokenPrinterContext::Tokenize`.
+  std::string trailing_whitespace;
+};
+
+// State saved at the beginning of recording a `TypeFragment`. See
+// `PrintedTokenRangeImpl::BeginTypeFragment`.
+struct TypeFragmentRecording {
+  TokenPrinterContext *outer{nullptr};
+  std::string leading_whitespace;
+  size_t num_tokens{0u};
+  size_t num_contexts{0u};
+  size_t num_data_bytes{0u};
+  size_t num_context_reuses{0u};
+  size_t num_data_to_index{0u};
+  size_t num_printed_defs{0u};
+  bool outer_dedups{false};
+  PrintedTokenImpl::Location prev_location;
 };
 
 // The range of data contained in a token.
@@ -95,12 +254,12 @@ class PrintedTokenRangeImpl {
 
   std::vector<PrintedTokenImpl> tokens;
 
-  // The `data_offset` of the `TokenImpl` base of `PrintedTokenImpl` in `tokens`
-  // points into this string.
+  // The `data_offset` of a `PrintedTokenImpl` in `tokens` points into this
+  // string. The data of each token is NUL-terminated.
   std::string data;
 
-  // All allocated token contexts live here. The `TokenImpl::context_index` of
-  // a `PrintedTokenImpl` points into `contexts`.
+  // All allocated token contexts live here. The `context_index` of a
+  // `PrintedTokenImpl` points into `contexts`.
   //
   // NOTE(pag): The first context in this list holds a raw data pointer to the
   //            `ASTImpl` containing `contexts` (if this is derived from an AST).
@@ -130,18 +289,41 @@ class PrintedTokenRangeImpl {
   // specializations/instantiations.
   PrintingPolicyAdaptor *ppa{nullptr};
 
+  // Is this range shared via a `PrintCache`? If so, then it must not be
+  // mutated in-place. See `Unshare`.
+  bool is_cached{false};
+
+  // Number of times that `CreateContext` or `CreateAlias` returned an already
+  // existing context rather than creating a new one. Printing a type fragment
+  // that reuses an outside context depends on where it's printed, and so
+  // can't be cached.
+  size_t num_context_reuses{0u};
+
+  // Per-print-session cache of printed types. A `std::nullopt` value means
+  // that the type is being recorded, or that it was found to be uncacheable.
+  std::unordered_map<TypeFragmentKey, std::optional<TypeFragment>,
+                     TypeFragmentKeyHash> type_fragments;
+
   inline PrintedTokenRangeImpl(clang::ASTContext &ast_context_)
       : ast_context(ast_context_) {}
 
+  // NOTE(pag): A copy is private, and so is never cached. If `that` is cached,
+  //            then the copy only borrows the AST; see `OwnedAST`.
   inline PrintedTokenRangeImpl(const PrintedTokenRangeImpl &that)
       : ast_context(that.ast_context),
         ast(that.ast),
         tokens(that.tokens),
         data(that.data),
-        contexts(that.contexts) {}
+        contexts(that.contexts),
+        is_cached(false) {}
 
   ~PrintedTokenRangeImpl(void);
 
+  // Return an owning pointer to the AST of `self`, which may be cached in a
+  // `PrintCache`, and thus only borrow its AST.
+  static std::shared_ptr<ASTImpl> OwnedAST(
+      const std::shared_ptr<PrintedTokenRangeImpl> &self);
+
   template <typename T>
   const TokenContextIndex CreateContext(
       TokenPrinterContext *tokenizer, const T *data);
@@ -153,16 +335,54 @@ class PrintedTokenRangeImpl {
   void MarkLocation(size_t tok_index, const TokenImpl &tok);
   void MarkLocation(size_t tok_index, const clang::SourceLocation &loc);
 
-  // Try to align parsed tokens with printed tokens. See `AlignTokens.cpp`.
+  // Try to align parsed tokens with printed tokens, using the scratch buffers
+  // of `session`. See `AlignTokens.cpp`.
   std::optional<std::string> AlignTokens(
       PrintedTokenRangeImpl &printed_range,
-      TokenContextIndex decl_context_id);
+      TokenContextIndex decl_context_id,
+      AlignmentSessionImpl &session);
+
+  // Lock the source manager of `ast`, if any, so that it can be queried while
+  // other threads are printing from the same AST.
+  std::unique_lock<std::mutex> LockSourceManager(void) const;
 
   // If any token context index is invalid, then set it to `index`.
   void FixupInvalidTokenContexts(TokenContextIndex index);
 
   void AddTrailingEOF(void);
 
+  // Start recording the tokens and contexts printed by a type, on top of
+  // `outer`.
+  TypeFragmentRecording BeginTypeFragment(TokenPrinterContext *outer);
+
+  // Finish recording the tokens and contexts printed by a type. Returns
+  // `std::nullopt` if what was printed depends on more than the type and the
+  // printing policy, e.g. if it reused contexts from outside the fragment.
+  std::optional<TypeFragment> EndTypeFragment(
+      const TypeFragmentRecording &recording);
+
+  // Try to splice in a previously recorded `fragment` on top of `outer`,
+  // exactly as if the type was re-printed. Returns `false`, having changed
+  // nothing, if re-printing the type here would produce something different.
+  bool SpliceTypeFragment(TokenPrinterContext *outer,
+                          const TypeFragment &fragment);
+
+  // Move all tokens printed so far into their own printed token range, and
+  // pass that range to `sink`. The first `num_base_contexts` contexts (e.g.
+  // the AST and translation unit contexts) are shared by every flushed range,
+  // and so are retained; all later contexts move with the flushed tokens.
+  void Flush(PrintedTokenSink &sink, size_t num_base_contexts);
+
+  // Concatenate `ranges` together, in order, into a new printed token range.
+  // All of `ranges` must have been printed from `ast`.
+  static PrintedTokenRange Concatenate(
+      clang::ASTContext &ast_context, const std::shared_ptr<ASTImpl> &ast,
+      const std::vector<PrintedTokenRange> &ranges);
+
+  // If `range` is shared via a `PrintCache`, then replace it with a private
+  // copy of itself, so that it can be mutated in-place.
+  static void Unshare(PrintedTokenRange &range);
+
   inline static PrintedTokenRange ToPrintedTokenRange(
       std::shared_ptr<PrintedTokenRangeImpl> self) {
     PrintedTokenImpl *first_tok = self->tokens.data();
@@ -171,6 +391,57 @@ class PrintedTokenRangeImpl {
   }
 };
 
+// A node in a rope of printed token ranges. Leaves reference a printed token
+// range; inner nodes reference two non-empty sub-ropes. Nodes are immutable
+// once created, and so are freely shared among ropes.
+class PrintedTokenRopeImpl {
+ public:
+  clang::ASTContext *ast_context{nullptr};
+  std::shared_ptr<ASTImpl> ast;
+
+  // Set on leaves.
+  std::optional<PrintedTokenRange> leaf;
+
+  // Set on inner nodes.
+  std::shared_ptr<const PrintedTokenRopeImpl> left;
+  std::shared_ptr<const PrintedTokenRopeImpl> right;
+
+  // Total number of tokens and non-empty leaves in this rope.
+  size_t num_tokens{0u};
+  size_t num_segments{0u};
+
+  // Lazily computed by `PrintedTokenRope::Flatten`. Released once an ancestor
+  // has been flattened, as the ancestor's flattened range covers it.
+  mutable std::mutex flatten_mutex;
+  mutable std::optional<PrintedTokenRange> flattened;
+
+  // Tears down the rope iteratively, so that destroying a long chain of
+  // concatenations doesn't overflow the stack.
+  ~PrintedTokenRopeImpl(void);
+
+  // Call `cb` on each non-empty leaf range, in order.
+  template <typename CB>
+  void ForEachSegment(CB cb) const {
+    std::vector<const PrintedTokenRopeImpl *> wl;
+    wl.push_back(this);
+    while (!wl.empty()) {
+      const PrintedTokenRopeImpl *node = wl.back();
+      wl.pop_back();
+      if (!node->num_segments) {
+        continue;
+      } else if (node->leaf) {
+        cb(node->leaf.value());
+      } else {
+        wl.push_back(node->right.get());
+        wl.push_back(node->left.get());
+      }
+    }
+  }
+
+  // Release the flattened ranges of all inner nodes below this one.
+  void ReleaseFlattenedDescendants(void) const;
+};
+
 class PrintingPolicyAdaptor final {
  private:
   std::shared_ptr<ASTImpl> ast;
@@ -194,6 +465,7 @@ class PrintingPolicyAdaptor final {
   bool ShouldPrintConstantExpressionsInTypes(void) const;
   bool ShouldPrintOriginalTypeOfAdjustedType(void) const;
   bool ShouldPrintOriginalTypeOfDecayedType(void) const;
+  bool ShouldCachePrintedTypes(void) const;
 
   bool ShouldPrintTemplate(clang::TemplateDecl *) const;
 
@@ -286,6 +558,7 @@ const TokenContextIndex PrintedTokenRangeImpl::CreateContext(
   if (dedup) {
     data = Canonicalize(data);
     if (auto it = data_to_index.find(data); it != data_to_index.end()) {
+      ++num_context_reuses;
       return it->second;
     }
   }
@@ -295,6 +568,7 @@ const TokenContextIndex PrintedTokenRangeImpl::CreateContext(
     TokenContextIndex prev_index = prev_printer->context_index;
     TokenContextImpl &prev_context = contexts[prev_index];
     if (prev_context.data == data) {
+      ++num_context_reuses;
       return prev_index;
     }
   }
@@ -1349,14 +1349,23 @@ void StmtPrinter::VisitCharacterLiteral(clang::CharacterLiteral *Node) {
 
 /// Prints the given expression using the original source text. Returns true on
 /// success, false otherwise.
+///
+/// NOTE(pag): `getSourceText` mutates the source manager's lookup caches, so
+///            we hold the source manager lock, as top-level declarations may
+///            be printed in parallel.
 static bool printExprAsWritten(pasta::raw_string_ostream &OS, clang::Expr *E,
-                               const clang::ASTContext *Context) {
+                               const clang::ASTContext *Context,
+                               const PrintedTokenRangeImpl &tokens) {
   if (!Context)
     return false;
   bool Invalid = false;
-  clang::StringRef Source = clang::Lexer::getSourceText(
-      clang::CharSourceRange::getTokenRange(E->getSourceRange()),
-      Context->getSourceManager(), Context->getLangOpts(), &Invalid);
+  clang::StringRef Source;
+  {
+    auto locker = tokens.LockSourceManager();
+    Source = clang::Lexer::getSourceText(
+        clang::CharSourceRange::getTokenRange(E->getSourceRange()),
+        Context->getSourceManager(), Context->getLangOpts(), &Invalid);
+  }
   if (!Invalid) {
     OS << Source;
     return true;
@@ -1366,7 +1375,8 @@ static bool printExprAsWritten(pasta::raw_string_ostream &OS, clang::Expr *E,
 
 void StmtPrinter::VisitIntegerLiteral(clang::IntegerLiteral *Node) {
   TokenPrinterContext ctx(OS, Node, tokens);
-  if (Policy.ConstantsAsWritten && printExprAsWritten(OS, Node, Context)) {
+  if (Policy.ConstantsAsWritten &&
+      printExprAsWritten(OS, Node, Context, tokens)) {
     ctx.MarkLocation(Node->getLocation());
     return;
   }
@@ -1406,7 +1416,8 @@ void StmtPrinter::VisitIntegerLiteral(clang::IntegerLiteral *Node) {
 
 void StmtPrinter::VisitFixedPointLiteral(clang::FixedPointLiteral *Node) {
   TokenPrinterContext ctx(OS, Node, tokens);
-  if (Policy.ConstantsAsWritten && printExprAsWritten(OS, Node, Context)) {
+  if (Policy.ConstantsAsWritten &&
+      printExprAsWritten(OS, Node, Context, tokens)) {
     ctx.MarkLocation(Node->getLocation());
     return;
   }
@@ -1457,7 +1468,8 @@ static void PrintFloatingLiteral(pasta::raw_string_ostream &OS,
 
 void StmtPrinter::VisitFloatingLiteral(clang::FloatingLiteral *Node) {
   TokenPrinterContext ctx(OS, Node, tokens);
-  if (Policy.ConstantsAsWritten && printExprAsWritten(OS, Node, Context)) {
+  if (Policy.ConstantsAsWritten &&
+      printExprAsWritten(OS, Node, Context, tokens)) {
     ctx.MarkLocation(Node->getLocation());
     return;
   }
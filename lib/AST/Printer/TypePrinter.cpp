@@ -484,8 +484,78 @@ void TypePrinter::print(clang::QualType t,
     printBeforeAfter(t, OS, std::move(IdentFn));
 
   } else {
+    printCached(t);
+  }
+}
+
+// Pack together the bits of the printing policy, and of our own state, that
+// affect how a type is printed.
+uint64_t TypePrinter::policyKey(void) const {
+  uint64_t key = 0u;
+  auto add_bit = [&key] (bool bit) {
+    key = (key << 1u) | (bit ? 1u : 0u);
+  };
+
+  add_bit(Policy.AnonymousTagLocations);
+  add_bit(Policy.CleanUglifiedParameters);
+  add_bit(Policy.FullyQualifiedName);
+  add_bit(Policy.IncludeTagDefinition);
+  add_bit(Policy.MSVCFormatting);
+  add_bit(Policy.PrintCanonicalTypes);
+  add_bit(Policy.PrintInjectedClassNameWithArguments);
+  add_bit(Policy.Restrict);
+  add_bit(Policy.SplitTemplateClosers);
+  add_bit(Policy.SuppressDefaultTemplateArgs);
+  add_bit(Policy.SuppressInitializers);
+  add_bit(Policy.SuppressInlineNamespace);
+  add_bit(Policy.SuppressLifetimeQualifiers);
+  add_bit(Policy.SuppressScope);
+  add_bit(Policy.SuppressSpecifiers);
+  add_bit(Policy.SuppressStrongLifetime);
+  add_bit(Policy.SuppressTagKeyword);
+  add_bit(Policy.SuppressUnwrittenScope);
+  add_bit(Policy.UseEnumerators);
+  add_bit(Policy.UseVoidForZeroParams);
+  add_bit(HasEmptyPlaceHolder);
+  add_bit(InsideCCAttribute);
+
+  key = (key << 8u) | (Policy.Indentation & 0xFFu);
+  key = (key << 16u) | (Indentation & 0xFFFFu);
+  return key;
+}
+
+// Print `t` without a placeholder. Printing the same type under the same
+// policy always produces the same tokens and contexts, so we record what gets
+// printed the first time, and splice it back in on later prints within the
+// same print session.
+void TypePrinter::printCached(clang::QualType t) {
+  TokenPrinterContext *outer = tokens.curr_printer_context;
+  if (t.isNull() || !outer || &(outer->out) != &OS ||
+      outer->context_index == kInvalidTokenContextIndex ||
+      Policy.IncludeTagDefinition ||
+      (tokens.ppa && !tokens.ppa->ShouldCachePrintedTypes())) {
     printBeforeAfter(t, OS, [] () {});
+    return;
   }
+
+  TypeFragmentKey key;
+  key.type = t.getAsOpaquePtr();
+  key.callbacks = Policy.Callbacks;
+  key.policy = policyKey();
+
+  auto [it, added] = tokens.type_fragments.try_emplace(key);
+  if (!added) {
+    if (!it->second || !tokens.SpliceTypeFragment(outer, it->second.value())) {
+      printBeforeAfter(t, OS, [] () {});
+    }
+    return;
+  }
+
+  TypeFragmentRecording recording = tokens.BeginTypeFragment(outer);
+  printBeforeAfter(t, OS, [] () {});
+
+  // NOTE(pag): `it` may have been invalidated by nested prints.
+  tokens.type_fragments[key] = tokens.EndTypeFragment(recording);
 }
 
 bool TypePrinter::canPrefixQualifiers(const clang::Type *T,
@@ -1879,8 +1949,12 @@ void TypePrinter::printTag(clang::TagDecl *D, raw_string_ostream &OS) {
       if (!HasKindDecoration)
         OS << " " << D->getKindName();
 
-      clang::PresumedLoc PLoc = D->getASTContext().getSourceManager().getPresumedLoc(
-          D->getLocation());
+      clang::PresumedLoc PLoc;
+      {
+        auto locker = tokens.LockSourceManager();
+        PLoc = D->getASTContext().getSourceManager().getPresumedLoc(
+            D->getLocation());
+      }
       if (PLoc.isValid()) {
         OS << " at ";
         clang::StringRef File = PLoc.getFilename();
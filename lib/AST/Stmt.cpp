@@ -31,8 +31,8 @@
 
 #define PASTA_DEFINE_BASE_OPERATORS(base, derived) \
     std::optional<class derived> derived::From(const class base &that) { \
-      if (auto stmt_ptr = clang::dyn_cast_or_null<clang::derived>(that.u.Stmt)) { \
-        return StmtBuilder::Create<class derived>(that.ast, stmt_ptr); \
+      if (that.Is<class derived>()) { \
+        return StmtBuilder::Create<class derived>(that.ast, that.u.Stmt); \
       } else { \
         return std::nullopt; \
       } \
@@ -1335,16 +1335,10 @@ PASTA_DEFINE_DERIVED_OPERATORS(Stmt, WhileStmt)
 
 // 0: Stmt::
 // 0: Stmt::
-std::vector<::pasta::Stmt> Stmt::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> Stmt::Children(void) const {
   auto &self = *const_cast<clang::Stmt *>(u.Stmt);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token Stmt::BeginToken(void) const {
@@ -1371,12 +1365,6 @@ int64_t Stmt::ID(void) const {
   return ast->TokenRangeFrom(val);
 }
 
-::pasta::StmtKind Stmt::Kind(void) const {
-  auto &self = *const_cast<clang::Stmt *>(u.Stmt);
-  decltype(auto) val = self.getStmtClass();
-  return static_cast<enum ::pasta::StmtKind>(val);
-}
-
 std::string_view Stmt::KindName(void) const {
   auto &self = *const_cast<clang::Stmt *>(u.Stmt);
   decltype(auto) val = self.getStmtClassName();
@@ -1455,16 +1443,10 @@ SwitchStmt::SwitchStmt(
     : Stmt(std::move(ast_), stmt_) {}
 
 PASTA_DEFINE_BASE_OPERATORS(Stmt, SwitchStmt)
-std::vector<::pasta::Stmt> SwitchStmt::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> SwitchStmt::Children(void) const {
   auto &self = *const_cast<clang::SwitchStmt *>(u.SwitchStmt);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token SwitchStmt::BeginToken(void) const {
@@ -1734,16 +1716,10 @@ WhileStmt::WhileStmt(
     : Stmt(std::move(ast_), stmt_) {}
 
 PASTA_DEFINE_BASE_OPERATORS(Stmt, WhileStmt)
-std::vector<::pasta::Stmt> WhileStmt::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> WhileStmt::Children(void) const {
   auto &self = *const_cast<clang::WhileStmt *>(u.WhileStmt);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token WhileStmt::BeginToken(void) const {
@@ -1832,16 +1808,10 @@ PASTA_DEFINE_DERIVED_OPERATORS(AsmStmt, GCCAsmStmt)
 PASTA_DEFINE_DERIVED_OPERATORS(AsmStmt, MSAsmStmt)
 // 0: AsmStmt::
 // 0: AsmStmt::
-std::vector<::pasta::Stmt> AsmStmt::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> AsmStmt::Children(void) const {
   auto &self = *const_cast<clang::AsmStmt *>(u.AsmStmt);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 // 0: AsmStmt::
@@ -1899,16 +1869,10 @@ uint32_t AsmStmt::NumPlusOperands(void) const {
 
 // 1: AsmStmt::OutputConstraint
 // 1: AsmStmt::OutputExpression
-std::vector<::pasta::Expr> AsmStmt::Inputs(void) const {
+::pasta::LazyRange<::pasta::Expr> AsmStmt::Inputs(void) const {
   auto &self = *const_cast<clang::AsmStmt *>(u.AsmStmt);
   decltype(auto) val = self.inputs();
-  std::vector<::pasta::Expr> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Expr>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Expr, StmtBuilder>(ast, val);
 }
 
 // 1: AsmStmt::IsOutputPlusConstraint
@@ -1924,16 +1888,10 @@ bool AsmStmt::IsVolatile(void) const {
   return val;
 }
 
-std::vector<::pasta::Expr> AsmStmt::Outputs(void) const {
+::pasta::LazyRange<::pasta::Expr> AsmStmt::Outputs(void) const {
   auto &self = *const_cast<clang::AsmStmt *>(u.AsmStmt);
   decltype(auto) val = self.outputs();
-  std::vector<::pasta::Expr> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Expr>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Expr, StmtBuilder>(ast, val);
 }
 
 std::vector<std::string_view> AsmStmt::OutputConstraints(void) const {
@@ -2029,16 +1987,10 @@ AttributedStmt::AttributedStmt(
 
 PASTA_DEFINE_BASE_OPERATORS(Stmt, AttributedStmt)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, AttributedStmt)
-std::vector<::pasta::Stmt> AttributedStmt::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> AttributedStmt::Children(void) const {
   auto &self = *const_cast<clang::AttributedStmt *>(u.AttributedStmt);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token AttributedStmt::AttributeToken(void) const {
@@ -2086,16 +2038,10 @@ BreakStmt::BreakStmt(
     : Stmt(std::move(ast_), stmt_) {}
 
 PASTA_DEFINE_BASE_OPERATORS(Stmt, BreakStmt)
-std::vector<::pasta::Stmt> BreakStmt::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> BreakStmt::Children(void) const {
   auto &self = *const_cast<clang::BreakStmt *>(u.BreakStmt);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token BreakStmt::BeginToken(void) const {
@@ -2122,16 +2068,10 @@ CXXCatchStmt::CXXCatchStmt(
     : Stmt(std::move(ast_), stmt_) {}
 
 PASTA_DEFINE_BASE_OPERATORS(Stmt, CXXCatchStmt)
-std::vector<::pasta::Stmt> CXXCatchStmt::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> CXXCatchStmt::Children(void) const {
   auto &self = *const_cast<clang::CXXCatchStmt *>(u.CXXCatchStmt);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token CXXCatchStmt::BeginToken(void) const {
@@ -2187,16 +2127,10 @@ CXXForRangeStmt::CXXForRangeStmt(
     : Stmt(std::move(ast_), stmt_) {}
 
 PASTA_DEFINE_BASE_OPERATORS(Stmt, CXXForRangeStmt)
-std::vector<::pasta::Stmt> CXXForRangeStmt::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> CXXForRangeStmt::Children(void) const {
   auto &self = *const_cast<clang::CXXForRangeStmt *>(u.CXXForRangeStmt);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token CXXForRangeStmt::BeginToken(void) const {
@@ -2339,16 +2273,10 @@ CXXTryStmt::CXXTryStmt(
     : Stmt(std::move(ast_), stmt_) {}
 
 PASTA_DEFINE_BASE_OPERATORS(Stmt, CXXTryStmt)
-std::vector<::pasta::Stmt> CXXTryStmt::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> CXXTryStmt::Children(void) const {
   auto &self = *const_cast<clang::CXXTryStmt *>(u.CXXTryStmt);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token CXXTryStmt::BeginToken(void) const {
@@ -2415,16 +2343,10 @@ PASTA_DEFINE_BASE_OPERATORS(Stmt, CapturedStmt)
 // 0: CapturedStmt::
 // 0: CapturedStmt::Captures
 // 1: CapturedStmt::CapturesVariable
-std::vector<::pasta::Stmt> CapturedStmt::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> CapturedStmt::Children(void) const {
   auto &self = *const_cast<clang::CapturedStmt *>(u.CapturedStmt);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token CapturedStmt::BeginToken(void) const {
@@ -2491,16 +2413,10 @@ bool CaseStmt::CaseStatementIsGNURange(void) const {
   return val;
 }
 
-std::vector<::pasta::Stmt> CaseStmt::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> CaseStmt::Children(void) const {
   auto &self = *const_cast<clang::CaseStmt *>(u.CaseStmt);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token CaseStmt::BeginToken(void) const {
@@ -2570,16 +2486,10 @@ PASTA_DEFINE_BASE_OPERATORS(Stmt, CompoundStmt)
 // 0: CompoundStmt::
 // 0: CompoundStmt::
 // 0: CompoundStmt::
-std::vector<::pasta::Stmt> CompoundStmt::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> CompoundStmt::Children(void) const {
   auto &self = *const_cast<clang::CompoundStmt *>(u.CompoundStmt);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token CompoundStmt::BeginToken(void) const {
@@ -2636,16 +2546,10 @@ ContinueStmt::ContinueStmt(
     : Stmt(std::move(ast_), stmt_) {}
 
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ContinueStmt)
-std::vector<::pasta::Stmt> ContinueStmt::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ContinueStmt::Children(void) const {
   auto &self = *const_cast<clang::ContinueStmt *>(u.ContinueStmt);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token ContinueStmt::BeginToken(void) const {
@@ -2672,16 +2576,10 @@ CoreturnStmt::CoreturnStmt(
     : Stmt(std::move(ast_), stmt_) {}
 
 PASTA_DEFINE_BASE_OPERATORS(Stmt, CoreturnStmt)
-std::vector<::pasta::Stmt> CoreturnStmt::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> CoreturnStmt::Children(void) const {
   auto &self = *const_cast<clang::CoreturnStmt *>(u.CoreturnStmt);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token CoreturnStmt::BeginToken(void) const {
@@ -2732,28 +2630,16 @@ CoroutineBodyStmt::CoroutineBodyStmt(
     : Stmt(std::move(ast_), stmt_) {}
 
 PASTA_DEFINE_BASE_OPERATORS(Stmt, CoroutineBodyStmt)
-std::vector<::pasta::Stmt> CoroutineBodyStmt::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> CoroutineBodyStmt::Children(void) const {
   auto &self = *const_cast<clang::CoroutineBodyStmt *>(u.CoroutineBodyStmt);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
-std::vector<::pasta::Stmt> CoroutineBodyStmt::ChildrenExclBody(void) const {
+::pasta::LazyRange<::pasta::Stmt> CoroutineBodyStmt::ChildrenExclBody(void) const {
   auto &self = *const_cast<clang::CoroutineBodyStmt *>(u.CoroutineBodyStmt);
   decltype(auto) val = self.childrenExclBody();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Expr CoroutineBodyStmt::Allocate(void) const {
@@ -2831,16 +2717,10 @@ std::vector<::pasta::Stmt> CoroutineBodyStmt::ChildrenExclBody(void) const {
   throw std::runtime_error("CoroutineBodyStmt::InitializerSuspendStatement can return nullptr!");
 }
 
-std::vector<::pasta::Stmt> CoroutineBodyStmt::ParameterMoves(void) const {
+::pasta::LazyRange<::pasta::Stmt> CoroutineBodyStmt::ParameterMoves(void) const {
   auto &self = *const_cast<clang::CoroutineBodyStmt *>(u.CoroutineBodyStmt);
   decltype(auto) val = self.getParamMoves();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::VarDecl CoroutineBodyStmt::PromiseDeclaration(void) const {
@@ -2920,30 +2800,18 @@ DeclStmt::DeclStmt(
     : Stmt(std::move(ast_), stmt_) {}
 
 PASTA_DEFINE_BASE_OPERATORS(Stmt, DeclStmt)
-std::vector<::pasta::Stmt> DeclStmt::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> DeclStmt::Children(void) const {
   auto &self = *const_cast<clang::DeclStmt *>(u.DeclStmt);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 // 0: DeclStmt::
 // 0: DeclStmt::
-std::vector<::pasta::Decl> DeclStmt::Declarations(void) const {
+::pasta::LazyRange<::pasta::Decl> DeclStmt::Declarations(void) const {
   auto &self = *const_cast<clang::DeclStmt *>(u.DeclStmt);
   decltype(auto) val = self.decls();
-  std::vector<::pasta::Decl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::Decl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Decl, DeclBuilder>(ast, val);
 }
 
 ::pasta::Token DeclStmt::BeginToken(void) const {
@@ -2986,16 +2854,10 @@ DefaultStmt::DefaultStmt(
 
 PASTA_DEFINE_BASE_OPERATORS(Stmt, DefaultStmt)
 PASTA_DEFINE_BASE_OPERATORS(SwitchCase, DefaultStmt)
-std::vector<::pasta::Stmt> DefaultStmt::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> DefaultStmt::Children(void) const {
   auto &self = *const_cast<clang::DefaultStmt *>(u.DefaultStmt);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token DefaultStmt::BeginToken(void) const {
@@ -3031,16 +2893,10 @@ DoStmt::DoStmt(
     : Stmt(std::move(ast_), stmt_) {}
 
 PASTA_DEFINE_BASE_OPERATORS(Stmt, DoStmt)
-std::vector<::pasta::Stmt> DoStmt::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> DoStmt::Children(void) const {
   auto &self = *const_cast<clang::DoStmt *>(u.DoStmt);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token DoStmt::BeginToken(void) const {
@@ -3704,16 +3560,10 @@ ExpressionTraitExpr::ExpressionTraitExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, ExpressionTraitExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ExpressionTraitExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, ExpressionTraitExpr)
-std::vector<::pasta::Stmt> ExpressionTraitExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ExpressionTraitExpr::Children(void) const {
   auto &self = *const_cast<clang::ExpressionTraitExpr *>(u.ExpressionTraitExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token ExpressionTraitExpr::BeginToken(void) const {
@@ -3757,16 +3607,10 @@ ExtVectorElementExpr::ExtVectorElementExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, ExtVectorElementExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ExtVectorElementExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, ExtVectorElementExpr)
-std::vector<::pasta::Stmt> ExtVectorElementExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ExtVectorElementExpr::Children(void) const {
   auto &self = *const_cast<clang::ExtVectorElementExpr *>(u.ExtVectorElementExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 bool ExtVectorElementExpr::ContainsDuplicateElements(void) const {
@@ -3823,16 +3667,10 @@ FixedPointLiteral::FixedPointLiteral(
 PASTA_DEFINE_BASE_OPERATORS(Expr, FixedPointLiteral)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, FixedPointLiteral)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, FixedPointLiteral)
-std::vector<::pasta::Stmt> FixedPointLiteral::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> FixedPointLiteral::Children(void) const {
   auto &self = *const_cast<clang::FixedPointLiteral *>(u.FixedPointLiteral);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token FixedPointLiteral::BeginToken(void) const {
@@ -3868,16 +3706,10 @@ FloatingLiteral::FloatingLiteral(
 PASTA_DEFINE_BASE_OPERATORS(Expr, FloatingLiteral)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, FloatingLiteral)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, FloatingLiteral)
-std::vector<::pasta::Stmt> FloatingLiteral::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> FloatingLiteral::Children(void) const {
   auto &self = *const_cast<clang::FloatingLiteral *>(u.FloatingLiteral);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token FloatingLiteral::BeginToken(void) const {
@@ -3919,16 +3751,10 @@ ForStmt::ForStmt(
     : Stmt(std::move(ast_), stmt_) {}
 
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ForStmt)
-std::vector<::pasta::Stmt> ForStmt::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ForStmt::Children(void) const {
   auto &self = *const_cast<clang::ForStmt *>(u.ForStmt);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token ForStmt::BeginToken(void) const {
@@ -4053,16 +3879,10 @@ PASTA_DEFINE_BASE_OPERATORS(Expr, FunctionParmPackExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, FunctionParmPackExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, FunctionParmPackExpr)
 // 0: FunctionParmPackExpr::
-std::vector<::pasta::Stmt> FunctionParmPackExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> FunctionParmPackExpr::Children(void) const {
   auto &self = *const_cast<clang::FunctionParmPackExpr *>(u.FunctionParmPackExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 // 0: FunctionParmPackExpr::
@@ -4187,16 +4007,10 @@ bool GCCAsmStmt::IsAssemblyGoto(void) const {
   return val;
 }
 
-std::vector<::pasta::AddrLabelExpr> GCCAsmStmt::Labels(void) const {
+::pasta::LazyRange<::pasta::AddrLabelExpr> GCCAsmStmt::Labels(void) const {
   auto &self = *const_cast<clang::GCCAsmStmt *>(u.GCCAsmStmt);
   decltype(auto) val = self.labels();
-  std::vector<::pasta::AddrLabelExpr> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::AddrLabelExpr>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::AddrLabelExpr, StmtBuilder>(ast, val);
 }
 
 std::vector<std::string_view> GCCAsmStmt::OutputConstraints(void) const {
@@ -4411,16 +4225,10 @@ GNUNullExpr::GNUNullExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, GNUNullExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, GNUNullExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, GNUNullExpr)
-std::vector<::pasta::Stmt> GNUNullExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> GNUNullExpr::Children(void) const {
   auto &self = *const_cast<clang::GNUNullExpr *>(u.GNUNullExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token GNUNullExpr::BeginToken(void) const {
@@ -4450,28 +4258,16 @@ PASTA_DEFINE_BASE_OPERATORS(Expr, GenericSelectionExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, GenericSelectionExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, GenericSelectionExpr)
 // 0: GenericSelectionExpr::Associations
-std::vector<::pasta::Stmt> GenericSelectionExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> GenericSelectionExpr::Children(void) const {
   auto &self = *const_cast<clang::GenericSelectionExpr *>(u.GenericSelectionExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
-std::vector<::pasta::Expr> GenericSelectionExpr::AssociationExpressions(void) const {
+::pasta::LazyRange<::pasta::Expr> GenericSelectionExpr::AssociationExpressions(void) const {
   auto &self = *const_cast<clang::GenericSelectionExpr *>(u.GenericSelectionExpr);
   decltype(auto) val = self.getAssocExprs();
-  std::vector<::pasta::Expr> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Expr>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Expr, StmtBuilder>(ast, val);
 }
 
 // 0: GenericSelectionExpr::
@@ -4582,16 +4378,10 @@ GotoStmt::GotoStmt(
     : Stmt(std::move(ast_), stmt_) {}
 
 PASTA_DEFINE_BASE_OPERATORS(Stmt, GotoStmt)
-std::vector<::pasta::Stmt> GotoStmt::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> GotoStmt::Children(void) const {
   auto &self = *const_cast<clang::GotoStmt *>(u.GotoStmt);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token GotoStmt::BeginToken(void) const {
@@ -4633,16 +4423,10 @@ IfStmt::IfStmt(
     : Stmt(std::move(ast_), stmt_) {}
 
 PASTA_DEFINE_BASE_OPERATORS(Stmt, IfStmt)
-std::vector<::pasta::Stmt> IfStmt::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> IfStmt::Children(void) const {
   auto &self = *const_cast<clang::IfStmt *>(u.IfStmt);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token IfStmt::BeginToken(void) const {
@@ -4815,16 +4599,10 @@ ImaginaryLiteral::ImaginaryLiteral(
 PASTA_DEFINE_BASE_OPERATORS(Expr, ImaginaryLiteral)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ImaginaryLiteral)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, ImaginaryLiteral)
-std::vector<::pasta::Stmt> ImaginaryLiteral::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ImaginaryLiteral::Children(void) const {
   auto &self = *const_cast<clang::ImaginaryLiteral *>(u.ImaginaryLiteral);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token ImaginaryLiteral::BeginToken(void) const {
@@ -4856,16 +4634,10 @@ ImplicitValueInitExpr::ImplicitValueInitExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, ImplicitValueInitExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ImplicitValueInitExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, ImplicitValueInitExpr)
-std::vector<::pasta::Stmt> ImplicitValueInitExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ImplicitValueInitExpr::Children(void) const {
   auto &self = *const_cast<clang::ImplicitValueInitExpr *>(u.ImplicitValueInitExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token ImplicitValueInitExpr::BeginToken(void) const {
@@ -4886,16 +4658,10 @@ IndirectGotoStmt::IndirectGotoStmt(
     : Stmt(std::move(ast_), stmt_) {}
 
 PASTA_DEFINE_BASE_OPERATORS(Stmt, IndirectGotoStmt)
-std::vector<::pasta::Stmt> IndirectGotoStmt::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> IndirectGotoStmt::Children(void) const {
   auto &self = *const_cast<clang::IndirectGotoStmt *>(u.IndirectGotoStmt);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token IndirectGotoStmt::BeginToken(void) const {
@@ -4951,16 +4717,10 @@ PASTA_DEFINE_BASE_OPERATORS(Expr, InitListExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, InitListExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, InitListExpr)
 // 0: InitListExpr::
-std::vector<::pasta::Stmt> InitListExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> InitListExpr::Children(void) const {
   auto &self = *const_cast<clang::InitListExpr *>(u.InitListExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 // 0: InitListExpr::
@@ -5058,16 +4818,10 @@ bool InitListExpr::HasDesignatedInitializer(void) const {
   return val;
 }
 
-std::vector<::pasta::Expr> InitListExpr::Initializers(void) const {
+::pasta::LazyRange<::pasta::Expr> InitListExpr::Initializers(void) const {
   auto &self = *const_cast<clang::InitListExpr *>(u.InitListExpr);
   decltype(auto) val = self.inits();
-  std::vector<::pasta::Expr> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Expr>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Expr, StmtBuilder>(ast, val);
 }
 
 bool InitListExpr::IsExplicit(void) const {
@@ -5118,16 +4872,10 @@ IntegerLiteral::IntegerLiteral(
 PASTA_DEFINE_BASE_OPERATORS(Expr, IntegerLiteral)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, IntegerLiteral)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, IntegerLiteral)
-std::vector<::pasta::Stmt> IntegerLiteral::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> IntegerLiteral::Children(void) const {
   auto &self = *const_cast<clang::IntegerLiteral *>(u.IntegerLiteral);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token IntegerLiteral::BeginToken(void) const {
@@ -5155,16 +4903,10 @@ LabelStmt::LabelStmt(
 
 PASTA_DEFINE_BASE_OPERATORS(Stmt, LabelStmt)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, LabelStmt)
-std::vector<::pasta::Stmt> LabelStmt::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> LabelStmt::Children(void) const {
   auto &self = *const_cast<clang::LabelStmt *>(u.LabelStmt);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token LabelStmt::BeginToken(void) const {
@@ -5235,16 +4977,10 @@ PASTA_DEFINE_BASE_OPERATORS(ValueStmt, LambdaExpr)
 // 0: LambdaExpr::CaptureInitializers
 // 0: LambdaExpr::
 // 0: LambdaExpr::Captures
-std::vector<::pasta::Stmt> LambdaExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> LambdaExpr::Children(void) const {
   auto &self = *const_cast<clang::LambdaExpr *>(u.LambdaExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 // 0: LambdaExpr::
@@ -5312,16 +5048,10 @@ std::optional<::pasta::FunctionTemplateDecl> LambdaExpr::DependentCallOperator(v
   return ast->TokenAt(val);
 }
 
-std::vector<::pasta::NamedDecl> LambdaExpr::ExplicitTemplateParameters(void) const {
+::pasta::LazyRange<::pasta::NamedDecl> LambdaExpr::ExplicitTemplateParameters(void) const {
   auto &self = *const_cast<clang::LambdaExpr *>(u.LambdaExpr);
   decltype(auto) val = self.getExplicitTemplateParameters();
-  std::vector<::pasta::NamedDecl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::NamedDecl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::NamedDecl, DeclBuilder>(ast, val);
 }
 
 ::pasta::TokenRange LambdaExpr::IntroducerRange(void) const {
@@ -5394,16 +5124,10 @@ MSAsmStmt::MSAsmStmt(
 
 PASTA_DEFINE_BASE_OPERATORS(AsmStmt, MSAsmStmt)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, MSAsmStmt)
-std::vector<::pasta::Stmt> MSAsmStmt::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> MSAsmStmt::Children(void) const {
   auto &self = *const_cast<clang::MSAsmStmt *>(u.MSAsmStmt);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 std::string MSAsmStmt::GenerateAssemblyString(void) const {
@@ -5423,16 +5147,10 @@ std::vector<std::string_view> MSAsmStmt::AllConstraints(void) const {
   return ret;
 }
 
-std::vector<::pasta::Expr> MSAsmStmt::AllExpressions(void) const {
+::pasta::LazyRange<::pasta::Expr> MSAsmStmt::AllExpressions(void) const {
   auto &self = *const_cast<clang::MSAsmStmt *>(u.MSAsmStmt);
   decltype(auto) val = self.getAllExprs();
-  std::vector<::pasta::Expr> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Expr>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Expr, StmtBuilder>(ast, val);
 }
 
 std::string_view MSAsmStmt::AssemblyString(void) const {
@@ -5559,16 +5277,10 @@ MSDependentExistsStmt::MSDependentExistsStmt(
     : Stmt(std::move(ast_), stmt_) {}
 
 PASTA_DEFINE_BASE_OPERATORS(Stmt, MSDependentExistsStmt)
-std::vector<::pasta::Stmt> MSDependentExistsStmt::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> MSDependentExistsStmt::Children(void) const {
   auto &self = *const_cast<clang::MSDependentExistsStmt *>(u.MSDependentExistsStmt);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token MSDependentExistsStmt::BeginToken(void) const {
@@ -5620,16 +5332,10 @@ MSPropertyRefExpr::MSPropertyRefExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, MSPropertyRefExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, MSPropertyRefExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, MSPropertyRefExpr)
-std::vector<::pasta::Stmt> MSPropertyRefExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> MSPropertyRefExpr::Children(void) const {
   auto &self = *const_cast<clang::MSPropertyRefExpr *>(u.MSPropertyRefExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Expr MSPropertyRefExpr::BaseExpression(void) const {
@@ -5695,16 +5401,10 @@ MSPropertySubscriptExpr::MSPropertySubscriptExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, MSPropertySubscriptExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, MSPropertySubscriptExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, MSPropertySubscriptExpr)
-std::vector<::pasta::Stmt> MSPropertySubscriptExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> MSPropertySubscriptExpr::Children(void) const {
   auto &self = *const_cast<clang::MSPropertySubscriptExpr *>(u.MSPropertySubscriptExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Expr MSPropertySubscriptExpr::Base(void) const {
@@ -5757,16 +5457,10 @@ MaterializeTemporaryExpr::MaterializeTemporaryExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, MaterializeTemporaryExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, MaterializeTemporaryExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, MaterializeTemporaryExpr)
-std::vector<::pasta::Stmt> MaterializeTemporaryExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> MaterializeTemporaryExpr::Children(void) const {
   auto &self = *const_cast<clang::MaterializeTemporaryExpr *>(u.MaterializeTemporaryExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token MaterializeTemporaryExpr::BeginToken(void) const {
@@ -5845,16 +5539,10 @@ MatrixSubscriptExpr::MatrixSubscriptExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, MatrixSubscriptExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, MatrixSubscriptExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, MatrixSubscriptExpr)
-std::vector<::pasta::Stmt> MatrixSubscriptExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> MatrixSubscriptExpr::Children(void) const {
   auto &self = *const_cast<clang::MatrixSubscriptExpr *>(u.MatrixSubscriptExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Expr MatrixSubscriptExpr::Base(void) const {
@@ -5922,16 +5610,10 @@ MemberExpr::MemberExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, MemberExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, MemberExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, MemberExpr)
-std::vector<::pasta::Stmt> MemberExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> MemberExpr::Children(void) const {
   auto &self = *const_cast<clang::MemberExpr *>(u.MemberExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Expr MemberExpr::Base(void) const {
@@ -6063,16 +5745,10 @@ NoInitExpr::NoInitExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, NoInitExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, NoInitExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, NoInitExpr)
-std::vector<::pasta::Stmt> NoInitExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> NoInitExpr::Children(void) const {
   auto &self = *const_cast<clang::NoInitExpr *>(u.NoInitExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token NoInitExpr::BeginToken(void) const {
@@ -6093,16 +5769,10 @@ NullStmt::NullStmt(
     : Stmt(std::move(ast_), stmt_) {}
 
 PASTA_DEFINE_BASE_OPERATORS(Stmt, NullStmt)
-std::vector<::pasta::Stmt> NullStmt::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> NullStmt::Children(void) const {
   auto &self = *const_cast<clang::NullStmt *>(u.NullStmt);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token NullStmt::BeginToken(void) const {
@@ -6137,16 +5807,10 @@ OMPArraySectionExpr::OMPArraySectionExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, OMPArraySectionExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, OMPArraySectionExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, OMPArraySectionExpr)
-std::vector<::pasta::Stmt> OMPArraySectionExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> OMPArraySectionExpr::Children(void) const {
   auto &self = *const_cast<clang::OMPArraySectionExpr *>(u.OMPArraySectionExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Expr OMPArraySectionExpr::Base(void) const {
@@ -6229,16 +5893,10 @@ OMPArrayShapingExpr::OMPArrayShapingExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, OMPArrayShapingExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, OMPArrayShapingExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, OMPArrayShapingExpr)
-std::vector<::pasta::Stmt> OMPArrayShapingExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> OMPArrayShapingExpr::Children(void) const {
   auto &self = *const_cast<clang::OMPArrayShapingExpr *>(u.OMPArrayShapingExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Expr OMPArrayShapingExpr::Base(void) const {
@@ -6266,16 +5924,10 @@ std::vector<::pasta::TokenRange> OMPArrayShapingExpr::BracketsRanges(void) const
   return ret;
 }
 
-std::vector<::pasta::Expr> OMPArrayShapingExpr::Dimensions(void) const {
+::pasta::LazyRange<::pasta::Expr> OMPArrayShapingExpr::Dimensions(void) const {
   auto &self = *const_cast<clang::OMPArrayShapingExpr *>(u.OMPArrayShapingExpr);
   decltype(auto) val = self.getDimensions();
-  std::vector<::pasta::Expr> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Expr>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Expr, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token OMPArrayShapingExpr::EndToken(void) const {
@@ -6302,16 +5954,10 @@ OMPCanonicalLoop::OMPCanonicalLoop(
     : Stmt(std::move(ast_), stmt_) {}
 
 PASTA_DEFINE_BASE_OPERATORS(Stmt, OMPCanonicalLoop)
-std::vector<::pasta::Stmt> OMPCanonicalLoop::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> OMPCanonicalLoop::Children(void) const {
   auto &self = *const_cast<clang::OMPCanonicalLoop *>(u.OMPCanonicalLoop);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token OMPCanonicalLoop::BeginToken(void) const {
@@ -6442,16 +6088,10 @@ PASTA_DEFINE_DERIVED_OPERATORS(OMPExecutableDirective, OMPTeamsDistributeSimdDir
 PASTA_DEFINE_DERIVED_OPERATORS(OMPExecutableDirective, OMPTeamsGenericLoopDirective)
 PASTA_DEFINE_DERIVED_OPERATORS(OMPExecutableDirective, OMPTileDirective)
 PASTA_DEFINE_DERIVED_OPERATORS(OMPExecutableDirective, OMPUnrollDirective)
-std::vector<::pasta::Stmt> OMPExecutableDirective::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> OMPExecutableDirective::Children(void) const {
   auto &self = *const_cast<clang::OMPExecutableDirective *>(u.OMPExecutableDirective);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 // 0: OMPExecutableDirective::Clauses
@@ -6546,16 +6186,10 @@ OMPIteratorExpr::OMPIteratorExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, OMPIteratorExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, OMPIteratorExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, OMPIteratorExpr)
-std::vector<::pasta::Stmt> OMPIteratorExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> OMPIteratorExpr::Children(void) const {
   auto &self = *const_cast<clang::OMPIteratorExpr *>(u.OMPIteratorExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 // 1: OMPIteratorExpr::AssignToken
@@ -6695,64 +6329,34 @@ PASTA_DEFINE_DERIVED_OPERATORS(OMPLoopDirective, OMPTeamsDistributeParallelForDi
 PASTA_DEFINE_DERIVED_OPERATORS(OMPLoopDirective, OMPTeamsDistributeParallelForSimdDirective)
 PASTA_DEFINE_DERIVED_OPERATORS(OMPLoopDirective, OMPTeamsDistributeSimdDirective)
 PASTA_DEFINE_DERIVED_OPERATORS(OMPLoopDirective, OMPTeamsGenericLoopDirective)
-std::vector<::pasta::Expr> OMPLoopDirective::Counters(void) const {
+::pasta::LazyRange<::pasta::Expr> OMPLoopDirective::Counters(void) const {
   auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
   decltype(auto) val = self.counters();
-  std::vector<::pasta::Expr> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Expr>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Expr, StmtBuilder>(ast, val);
 }
 
-std::vector<::pasta::Expr> OMPLoopDirective::DependentCounters(void) const {
+::pasta::LazyRange<::pasta::Expr> OMPLoopDirective::DependentCounters(void) const {
   auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
   decltype(auto) val = self.dependent_counters();
-  std::vector<::pasta::Expr> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Expr>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Expr, StmtBuilder>(ast, val);
 }
 
-std::vector<::pasta::Expr> OMPLoopDirective::DependentInitializers(void) const {
+::pasta::LazyRange<::pasta::Expr> OMPLoopDirective::DependentInitializers(void) const {
   auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
   decltype(auto) val = self.dependent_inits();
-  std::vector<::pasta::Expr> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Expr>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Expr, StmtBuilder>(ast, val);
 }
 
-std::vector<::pasta::Expr> OMPLoopDirective::Finals(void) const {
+::pasta::LazyRange<::pasta::Expr> OMPLoopDirective::Finals(void) const {
   auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
   decltype(auto) val = self.finals();
-  std::vector<::pasta::Expr> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Expr>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Expr, StmtBuilder>(ast, val);
 }
 
-std::vector<::pasta::Expr> OMPLoopDirective::FinalsConditions(void) const {
+::pasta::LazyRange<::pasta::Expr> OMPLoopDirective::FinalsConditions(void) const {
   auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
   decltype(auto) val = self.finals_conditions();
-  std::vector<::pasta::Expr> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Expr>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Expr, StmtBuilder>(ast, val);
 }
 
 ::pasta::Stmt OMPLoopDirective::Body(void) const {
@@ -7025,40 +6629,22 @@ std::vector<::pasta::Expr> OMPLoopDirective::FinalsConditions(void) const {
   throw std::runtime_error("OMPLoopDirective::UpperBoundVariable can return nullptr!");
 }
 
-std::vector<::pasta::Expr> OMPLoopDirective::Initializers(void) const {
+::pasta::LazyRange<::pasta::Expr> OMPLoopDirective::Initializers(void) const {
   auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
   decltype(auto) val = self.inits();
-  std::vector<::pasta::Expr> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Expr>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Expr, StmtBuilder>(ast, val);
 }
 
-std::vector<::pasta::Expr> OMPLoopDirective::PrivateCounters(void) const {
+::pasta::LazyRange<::pasta::Expr> OMPLoopDirective::PrivateCounters(void) const {
   auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
   decltype(auto) val = self.private_counters();
-  std::vector<::pasta::Expr> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Expr>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Expr, StmtBuilder>(ast, val);
 }
 
-std::vector<::pasta::Expr> OMPLoopDirective::Updates(void) const {
+::pasta::LazyRange<::pasta::Expr> OMPLoopDirective::Updates(void) const {
   auto &self = *const_cast<clang::OMPLoopDirective *>(u.OMPLoopDirective);
   decltype(auto) val = self.updates();
-  std::vector<::pasta::Expr> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Expr>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Expr, StmtBuilder>(ast, val);
 }
 
 OMPLoopTransformationDirective::OMPLoopTransformationDirective(
@@ -7775,16 +7361,10 @@ ObjCArrayLiteral::ObjCArrayLiteral(
 PASTA_DEFINE_BASE_OPERATORS(Expr, ObjCArrayLiteral)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ObjCArrayLiteral)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, ObjCArrayLiteral)
-std::vector<::pasta::Stmt> ObjCArrayLiteral::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ObjCArrayLiteral::Children(void) const {
   auto &self = *const_cast<clang::ObjCArrayLiteral *>(u.ObjCArrayLiteral);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::ObjCMethodDecl ObjCArrayLiteral::ArrayWithObjectsMethod(void) const {
@@ -7844,16 +7424,10 @@ ObjCAtCatchStmt::ObjCAtCatchStmt(
     : Stmt(std::move(ast_), stmt_) {}
 
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ObjCAtCatchStmt)
-std::vector<::pasta::Stmt> ObjCAtCatchStmt::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ObjCAtCatchStmt::Children(void) const {
   auto &self = *const_cast<clang::ObjCAtCatchStmt *>(u.ObjCAtCatchStmt);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token ObjCAtCatchStmt::AtCatchToken(void) const {
@@ -7910,16 +7484,10 @@ ObjCAtFinallyStmt::ObjCAtFinallyStmt(
     : Stmt(std::move(ast_), stmt_) {}
 
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ObjCAtFinallyStmt)
-std::vector<::pasta::Stmt> ObjCAtFinallyStmt::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ObjCAtFinallyStmt::Children(void) const {
   auto &self = *const_cast<clang::ObjCAtFinallyStmt *>(u.ObjCAtFinallyStmt);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token ObjCAtFinallyStmt::AtFinallyToken(void) const {
@@ -7955,16 +7523,10 @@ ObjCAtSynchronizedStmt::ObjCAtSynchronizedStmt(
     : Stmt(std::move(ast_), stmt_) {}
 
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ObjCAtSynchronizedStmt)
-std::vector<::pasta::Stmt> ObjCAtSynchronizedStmt::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ObjCAtSynchronizedStmt::Children(void) const {
   auto &self = *const_cast<clang::ObjCAtSynchronizedStmt *>(u.ObjCAtSynchronizedStmt);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token ObjCAtSynchronizedStmt::AtSynchronizedToken(void) const {
@@ -8009,16 +7571,10 @@ ObjCAtThrowStmt::ObjCAtThrowStmt(
     : Stmt(std::move(ast_), stmt_) {}
 
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ObjCAtThrowStmt)
-std::vector<::pasta::Stmt> ObjCAtThrowStmt::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ObjCAtThrowStmt::Children(void) const {
   auto &self = *const_cast<clang::ObjCAtThrowStmt *>(u.ObjCAtThrowStmt);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token ObjCAtThrowStmt::BeginToken(void) const {
@@ -8057,16 +7613,10 @@ PASTA_DEFINE_BASE_OPERATORS(Stmt, ObjCAtTryStmt)
 // 0: ObjCAtTryStmt::CatchStatements
 // 0: ObjCAtTryStmt::
 // 0: ObjCAtTryStmt::
-std::vector<::pasta::Stmt> ObjCAtTryStmt::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ObjCAtTryStmt::Children(void) const {
   auto &self = *const_cast<clang::ObjCAtTryStmt *>(u.ObjCAtTryStmt);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token ObjCAtTryStmt::AtTryToken(void) const {
@@ -8134,16 +7684,10 @@ ObjCAutoreleasePoolStmt::ObjCAutoreleasePoolStmt(
     : Stmt(std::move(ast_), stmt_) {}
 
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ObjCAutoreleasePoolStmt)
-std::vector<::pasta::Stmt> ObjCAutoreleasePoolStmt::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ObjCAutoreleasePoolStmt::Children(void) const {
   auto &self = *const_cast<clang::ObjCAutoreleasePoolStmt *>(u.ObjCAutoreleasePoolStmt);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token ObjCAutoreleasePoolStmt::AtToken(void) const {
@@ -8181,16 +7725,10 @@ ObjCAvailabilityCheckExpr::ObjCAvailabilityCheckExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, ObjCAvailabilityCheckExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ObjCAvailabilityCheckExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, ObjCAvailabilityCheckExpr)
-std::vector<::pasta::Stmt> ObjCAvailabilityCheckExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ObjCAvailabilityCheckExpr::Children(void) const {
   auto &self = *const_cast<clang::ObjCAvailabilityCheckExpr *>(u.ObjCAvailabilityCheckExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token ObjCAvailabilityCheckExpr::BeginToken(void) const {
@@ -8226,16 +7764,10 @@ ObjCBoolLiteralExpr::ObjCBoolLiteralExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, ObjCBoolLiteralExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ObjCBoolLiteralExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, ObjCBoolLiteralExpr)
-std::vector<::pasta::Stmt> ObjCBoolLiteralExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ObjCBoolLiteralExpr::Children(void) const {
   auto &self = *const_cast<clang::ObjCBoolLiteralExpr *>(u.ObjCBoolLiteralExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token ObjCBoolLiteralExpr::BeginToken(void) const {
@@ -8272,16 +7804,10 @@ PASTA_DEFINE_BASE_OPERATORS(Stmt, ObjCBoxedExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, ObjCBoxedExpr)
 // 0: ObjCBoxedExpr::
 // 0: ObjCBoxedExpr::
-std::vector<::pasta::Stmt> ObjCBoxedExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ObjCBoxedExpr::Children(void) const {
   auto &self = *const_cast<clang::ObjCBoxedExpr *>(u.ObjCBoxedExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token ObjCBoxedExpr::AtToken(void) const {
@@ -8340,16 +7866,10 @@ ObjCDictionaryLiteral::ObjCDictionaryLiteral(
 PASTA_DEFINE_BASE_OPERATORS(Expr, ObjCDictionaryLiteral)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ObjCDictionaryLiteral)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, ObjCDictionaryLiteral)
-std::vector<::pasta::Stmt> ObjCDictionaryLiteral::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ObjCDictionaryLiteral::Children(void) const {
   auto &self = *const_cast<clang::ObjCDictionaryLiteral *>(u.ObjCDictionaryLiteral);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token ObjCDictionaryLiteral::BeginToken(void) const {
@@ -8394,16 +7914,10 @@ ObjCEncodeExpr::ObjCEncodeExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, ObjCEncodeExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ObjCEncodeExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, ObjCEncodeExpr)
-std::vector<::pasta::Stmt> ObjCEncodeExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ObjCEncodeExpr::Children(void) const {
   auto &self = *const_cast<clang::ObjCEncodeExpr *>(u.ObjCEncodeExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token ObjCEncodeExpr::AtToken(void) const {
@@ -8444,16 +7958,10 @@ ObjCForCollectionStmt::ObjCForCollectionStmt(
     : Stmt(std::move(ast_), stmt_) {}
 
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ObjCForCollectionStmt)
-std::vector<::pasta::Stmt> ObjCForCollectionStmt::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ObjCForCollectionStmt::Children(void) const {
   auto &self = *const_cast<clang::ObjCForCollectionStmt *>(u.ObjCForCollectionStmt);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token ObjCForCollectionStmt::BeginToken(void) const {
@@ -8515,16 +8023,10 @@ ObjCIndirectCopyRestoreExpr::ObjCIndirectCopyRestoreExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, ObjCIndirectCopyRestoreExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ObjCIndirectCopyRestoreExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, ObjCIndirectCopyRestoreExpr)
-std::vector<::pasta::Stmt> ObjCIndirectCopyRestoreExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ObjCIndirectCopyRestoreExpr::Children(void) const {
   auto &self = *const_cast<clang::ObjCIndirectCopyRestoreExpr *>(u.ObjCIndirectCopyRestoreExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token ObjCIndirectCopyRestoreExpr::BeginToken(void) const {
@@ -8568,16 +8070,10 @@ ObjCIsaExpr::ObjCIsaExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, ObjCIsaExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ObjCIsaExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, ObjCIsaExpr)
-std::vector<::pasta::Stmt> ObjCIsaExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ObjCIsaExpr::Children(void) const {
   auto &self = *const_cast<clang::ObjCIsaExpr *>(u.ObjCIsaExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Expr ObjCIsaExpr::Base(void) const {
@@ -8639,16 +8135,10 @@ ObjCIvarRefExpr::ObjCIvarRefExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, ObjCIvarRefExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ObjCIvarRefExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, ObjCIvarRefExpr)
-std::vector<::pasta::Stmt> ObjCIvarRefExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ObjCIvarRefExpr::Children(void) const {
   auto &self = *const_cast<clang::ObjCIvarRefExpr *>(u.ObjCIvarRefExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Expr ObjCIvarRefExpr::Base(void) const {
@@ -8715,28 +8205,16 @@ PASTA_DEFINE_BASE_OPERATORS(Stmt, ObjCMessageExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, ObjCMessageExpr)
 // 0: ObjCMessageExpr::
 // 0: ObjCMessageExpr::
-std::vector<::pasta::Expr> ObjCMessageExpr::Arguments(void) const {
+::pasta::LazyRange<::pasta::Expr> ObjCMessageExpr::Arguments(void) const {
   auto &self = *const_cast<clang::ObjCMessageExpr *>(u.ObjCMessageExpr);
   decltype(auto) val = self.arguments();
-  std::vector<::pasta::Expr> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Expr>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Expr, StmtBuilder>(ast, val);
 }
 
-std::vector<::pasta::Stmt> ObjCMessageExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ObjCMessageExpr::Children(void) const {
   auto &self = *const_cast<clang::ObjCMessageExpr *>(u.ObjCMessageExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 // 1: ObjCMessageExpr::Argument
@@ -8910,16 +8388,10 @@ ObjCPropertyRefExpr::ObjCPropertyRefExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, ObjCPropertyRefExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ObjCPropertyRefExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, ObjCPropertyRefExpr)
-std::vector<::pasta::Stmt> ObjCPropertyRefExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ObjCPropertyRefExpr::Children(void) const {
   auto &self = *const_cast<clang::ObjCPropertyRefExpr *>(u.ObjCPropertyRefExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Expr ObjCPropertyRefExpr::Base(void) const {
@@ -9057,16 +8529,10 @@ ObjCProtocolExpr::ObjCProtocolExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, ObjCProtocolExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ObjCProtocolExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, ObjCProtocolExpr)
-std::vector<::pasta::Stmt> ObjCProtocolExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ObjCProtocolExpr::Children(void) const {
   auto &self = *const_cast<clang::ObjCProtocolExpr *>(u.ObjCProtocolExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token ObjCProtocolExpr::AtToken(void) const {
@@ -9116,16 +8582,10 @@ ObjCSelectorExpr::ObjCSelectorExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, ObjCSelectorExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ObjCSelectorExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, ObjCSelectorExpr)
-std::vector<::pasta::Stmt> ObjCSelectorExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ObjCSelectorExpr::Children(void) const {
   auto &self = *const_cast<clang::ObjCSelectorExpr *>(u.ObjCSelectorExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token ObjCSelectorExpr::AtToken(void) const {
@@ -9167,16 +8627,10 @@ ObjCStringLiteral::ObjCStringLiteral(
 PASTA_DEFINE_BASE_OPERATORS(Expr, ObjCStringLiteral)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ObjCStringLiteral)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, ObjCStringLiteral)
-std::vector<::pasta::Stmt> ObjCStringLiteral::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ObjCStringLiteral::Children(void) const {
   auto &self = *const_cast<clang::ObjCStringLiteral *>(u.ObjCStringLiteral);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token ObjCStringLiteral::AtToken(void) const {
@@ -9214,16 +8668,10 @@ ObjCSubscriptRefExpr::ObjCSubscriptRefExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, ObjCSubscriptRefExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ObjCSubscriptRefExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, ObjCSubscriptRefExpr)
-std::vector<::pasta::Stmt> ObjCSubscriptRefExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ObjCSubscriptRefExpr::Children(void) const {
   auto &self = *const_cast<clang::ObjCSubscriptRefExpr *>(u.ObjCSubscriptRefExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::ObjCMethodDecl ObjCSubscriptRefExpr::AtIndexMethodDeclaration(void) const {
@@ -9285,16 +8733,10 @@ OffsetOfExpr::OffsetOfExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, OffsetOfExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, OffsetOfExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, OffsetOfExpr)
-std::vector<::pasta::Stmt> OffsetOfExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> OffsetOfExpr::Children(void) const {
   auto &self = *const_cast<clang::OffsetOfExpr *>(u.OffsetOfExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token OffsetOfExpr::BeginToken(void) const {
@@ -9344,16 +8786,10 @@ OpaqueValueExpr::OpaqueValueExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, OpaqueValueExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, OpaqueValueExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, OpaqueValueExpr)
-std::vector<::pasta::Stmt> OpaqueValueExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> OpaqueValueExpr::Children(void) const {
   auto &self = *const_cast<clang::OpaqueValueExpr *>(u.OpaqueValueExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token OpaqueValueExpr::BeginToken(void) const {
@@ -9483,16 +8919,10 @@ PackExpansionExpr::PackExpansionExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, PackExpansionExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, PackExpansionExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, PackExpansionExpr)
-std::vector<::pasta::Stmt> PackExpansionExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> PackExpansionExpr::Children(void) const {
   auto &self = *const_cast<clang::PackExpansionExpr *>(u.PackExpansionExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token PackExpansionExpr::BeginToken(void) const {
@@ -9540,16 +8970,10 @@ ParenExpr::ParenExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, ParenExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ParenExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, ParenExpr)
-std::vector<::pasta::Stmt> ParenExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ParenExpr::Children(void) const {
   auto &self = *const_cast<clang::ParenExpr *>(u.ParenExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token ParenExpr::BeginToken(void) const {
@@ -9593,16 +9017,10 @@ ParenListExpr::ParenListExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, ParenListExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ParenListExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, ParenListExpr)
-std::vector<::pasta::Stmt> ParenListExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ParenListExpr::Children(void) const {
   auto &self = *const_cast<clang::ParenListExpr *>(u.ParenListExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token ParenListExpr::BeginToken(void) const {
@@ -9660,16 +9078,10 @@ PredefinedExpr::PredefinedExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, PredefinedExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, PredefinedExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, PredefinedExpr)
-std::vector<::pasta::Stmt> PredefinedExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> PredefinedExpr::Children(void) const {
   auto &self = *const_cast<clang::PredefinedExpr *>(u.PredefinedExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token PredefinedExpr::BeginToken(void) const {
@@ -9731,16 +9143,10 @@ PseudoObjectExpr::PseudoObjectExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, PseudoObjectExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, PseudoObjectExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, PseudoObjectExpr)
-std::vector<::pasta::Stmt> PseudoObjectExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> PseudoObjectExpr::Children(void) const {
   auto &self = *const_cast<clang::PseudoObjectExpr *>(u.PseudoObjectExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token PseudoObjectExpr::BeginToken(void) const {
@@ -9792,16 +9198,10 @@ uint32_t PseudoObjectExpr::ResultExpressionIndex(void) const {
   throw std::runtime_error("PseudoObjectExpr::SyntacticForm can return nullptr!");
 }
 
-std::vector<::pasta::Expr> PseudoObjectExpr::Semantics(void) const {
+::pasta::LazyRange<::pasta::Expr> PseudoObjectExpr::Semantics(void) const {
   auto &self = *const_cast<clang::PseudoObjectExpr *>(u.PseudoObjectExpr);
   decltype(auto) val = self.semantics();
-  std::vector<::pasta::Expr> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Expr>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Expr, StmtBuilder>(ast, val);
 }
 
 // 0: PseudoObjectExpr::
@@ -9842,16 +9242,10 @@ PASTA_DEFINE_BASE_OPERATORS(ValueStmt, RecoveryExpr)
   return ast->TokenAt(val);
 }
 
-std::vector<::pasta::Expr> RecoveryExpr::SubExpressions(void) const {
+::pasta::LazyRange<::pasta::Expr> RecoveryExpr::SubExpressions(void) const {
   auto &self = *const_cast<clang::RecoveryExpr *>(u.RecoveryExpr);
   decltype(auto) val = self.subExpressions();
-  std::vector<::pasta::Expr> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Expr>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Expr, StmtBuilder>(ast, val);
 }
 
 RequiresExpr::RequiresExpr(
@@ -9862,16 +9256,10 @@ RequiresExpr::RequiresExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, RequiresExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, RequiresExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, RequiresExpr)
-std::vector<::pasta::Stmt> RequiresExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> RequiresExpr::Children(void) const {
   auto &self = *const_cast<clang::RequiresExpr *>(u.RequiresExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token RequiresExpr::BeginToken(void) const {
@@ -9895,16 +9283,10 @@ std::vector<::pasta::Stmt> RequiresExpr::Children(void) const {
   return ast->TokenAt(val);
 }
 
-std::vector<::pasta::ParmVarDecl> RequiresExpr::LocalParameters(void) const {
+::pasta::LazyRange<::pasta::ParmVarDecl> RequiresExpr::LocalParameters(void) const {
   auto &self = *const_cast<clang::RequiresExpr *>(u.RequiresExpr);
   decltype(auto) val = self.getLocalParameters();
-  std::vector<::pasta::ParmVarDecl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::ParmVarDecl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::ParmVarDecl, DeclBuilder>(ast, val);
 }
 
 ::pasta::Token RequiresExpr::RBraceToken(void) const {
@@ -9932,16 +9314,10 @@ ReturnStmt::ReturnStmt(
     : Stmt(std::move(ast_), stmt_) {}
 
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ReturnStmt)
-std::vector<::pasta::Stmt> ReturnStmt::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ReturnStmt::Children(void) const {
   auto &self = *const_cast<clang::ReturnStmt *>(u.ReturnStmt);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token ReturnStmt::BeginToken(void) const {
@@ -9990,16 +9366,10 @@ SEHExceptStmt::SEHExceptStmt(
     : Stmt(std::move(ast_), stmt_) {}
 
 PASTA_DEFINE_BASE_OPERATORS(Stmt, SEHExceptStmt)
-std::vector<::pasta::Stmt> SEHExceptStmt::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> SEHExceptStmt::Children(void) const {
   auto &self = *const_cast<clang::SEHExceptStmt *>(u.SEHExceptStmt);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token SEHExceptStmt::BeginToken(void) const {
@@ -10044,16 +9414,10 @@ SEHFinallyStmt::SEHFinallyStmt(
     : Stmt(std::move(ast_), stmt_) {}
 
 PASTA_DEFINE_BASE_OPERATORS(Stmt, SEHFinallyStmt)
-std::vector<::pasta::Stmt> SEHFinallyStmt::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> SEHFinallyStmt::Children(void) const {
   auto &self = *const_cast<clang::SEHFinallyStmt *>(u.SEHFinallyStmt);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token SEHFinallyStmt::BeginToken(void) const {
@@ -10089,16 +9453,10 @@ SEHLeaveStmt::SEHLeaveStmt(
     : Stmt(std::move(ast_), stmt_) {}
 
 PASTA_DEFINE_BASE_OPERATORS(Stmt, SEHLeaveStmt)
-std::vector<::pasta::Stmt> SEHLeaveStmt::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> SEHLeaveStmt::Children(void) const {
   auto &self = *const_cast<clang::SEHLeaveStmt *>(u.SEHLeaveStmt);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token SEHLeaveStmt::BeginToken(void) const {
@@ -10125,16 +9483,10 @@ SEHTryStmt::SEHTryStmt(
     : Stmt(std::move(ast_), stmt_) {}
 
 PASTA_DEFINE_BASE_OPERATORS(Stmt, SEHTryStmt)
-std::vector<::pasta::Stmt> SEHTryStmt::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> SEHTryStmt::Children(void) const {
   auto &self = *const_cast<clang::SEHTryStmt *>(u.SEHTryStmt);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token SEHTryStmt::BeginToken(void) const {
@@ -10211,16 +9563,10 @@ std::string SYCLUniqueStableNameExpr::ComputeName(void) const {
   return val;
 }
 
-std::vector<::pasta::Stmt> SYCLUniqueStableNameExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> SYCLUniqueStableNameExpr::Children(void) const {
   auto &self = *const_cast<clang::SYCLUniqueStableNameExpr *>(u.SYCLUniqueStableNameExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token SYCLUniqueStableNameExpr::BeginToken(void) const {
@@ -10262,16 +9608,10 @@ ShuffleVectorExpr::ShuffleVectorExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, ShuffleVectorExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ShuffleVectorExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, ShuffleVectorExpr)
-std::vector<::pasta::Stmt> ShuffleVectorExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ShuffleVectorExpr::Children(void) const {
   auto &self = *const_cast<clang::ShuffleVectorExpr *>(u.ShuffleVectorExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token ShuffleVectorExpr::BeginToken(void) const {
@@ -10314,16 +9654,10 @@ SizeOfPackExpr::SizeOfPackExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, SizeOfPackExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, SizeOfPackExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, SizeOfPackExpr)
-std::vector<::pasta::Stmt> SizeOfPackExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> SizeOfPackExpr::Children(void) const {
   auto &self = *const_cast<clang::SizeOfPackExpr *>(u.SizeOfPackExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token SizeOfPackExpr::BeginToken(void) const {
@@ -10402,16 +9736,10 @@ PASTA_DEFINE_BASE_OPERATORS(Expr, SourceLocExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, SourceLocExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, SourceLocExpr)
 // 2: EvaluateInContext
-std::vector<::pasta::Stmt> SourceLocExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> SourceLocExpr::Children(void) const {
   auto &self = *const_cast<clang::SourceLocExpr *>(u.SourceLocExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token SourceLocExpr::BeginToken(void) const {
@@ -10471,16 +9799,10 @@ StmtExpr::StmtExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, StmtExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, StmtExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, StmtExpr)
-std::vector<::pasta::Stmt> StmtExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> StmtExpr::Children(void) const {
   auto &self = *const_cast<clang::StmtExpr *>(u.StmtExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token StmtExpr::BeginToken(void) const {
@@ -10530,16 +9852,10 @@ StringLiteral::StringLiteral(
 PASTA_DEFINE_BASE_OPERATORS(Expr, StringLiteral)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, StringLiteral)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, StringLiteral)
-std::vector<::pasta::Stmt> StringLiteral::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> StringLiteral::Children(void) const {
   auto &self = *const_cast<clang::StringLiteral *>(u.StringLiteral);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 std::optional<bool> StringLiteral::ContainsNonAscii(void) const {
@@ -10680,16 +9996,10 @@ SubstNonTypeTemplateParmExpr::SubstNonTypeTemplateParmExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, SubstNonTypeTemplateParmExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, SubstNonTypeTemplateParmExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, SubstNonTypeTemplateParmExpr)
-std::vector<::pasta::Stmt> SubstNonTypeTemplateParmExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> SubstNonTypeTemplateParmExpr::Children(void) const {
   auto &self = *const_cast<clang::SubstNonTypeTemplateParmExpr *>(u.SubstNonTypeTemplateParmExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Decl SubstNonTypeTemplateParmExpr::AssociatedDeclaration(void) const {
@@ -10774,16 +10084,10 @@ SubstNonTypeTemplateParmPackExpr::SubstNonTypeTemplateParmPackExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, SubstNonTypeTemplateParmPackExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, SubstNonTypeTemplateParmPackExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, SubstNonTypeTemplateParmPackExpr)
-std::vector<::pasta::Stmt> SubstNonTypeTemplateParmPackExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> SubstNonTypeTemplateParmPackExpr::Children(void) const {
   auto &self = *const_cast<clang::SubstNonTypeTemplateParmPackExpr *>(u.SubstNonTypeTemplateParmPackExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 // 0: SubstNonTypeTemplateParmPackExpr::ArgumentPack
@@ -10837,16 +10141,10 @@ TypeTraitExpr::TypeTraitExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, TypeTraitExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, TypeTraitExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, TypeTraitExpr)
-std::vector<::pasta::Stmt> TypeTraitExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> TypeTraitExpr::Children(void) const {
   auto &self = *const_cast<clang::TypeTraitExpr *>(u.TypeTraitExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 // 1: TypeTraitExpr::Argument
@@ -10905,16 +10203,10 @@ TypoExpr::TypoExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, TypoExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, TypoExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, TypoExpr)
-std::vector<::pasta::Stmt> TypoExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> TypoExpr::Children(void) const {
   auto &self = *const_cast<clang::TypoExpr *>(u.TypoExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token TypoExpr::BeginToken(void) const {
@@ -10937,16 +10229,10 @@ UnaryExprOrTypeTraitExpr::UnaryExprOrTypeTraitExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, UnaryExprOrTypeTraitExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, UnaryExprOrTypeTraitExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, UnaryExprOrTypeTraitExpr)
-std::vector<::pasta::Stmt> UnaryExprOrTypeTraitExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> UnaryExprOrTypeTraitExpr::Children(void) const {
   auto &self = *const_cast<clang::UnaryExprOrTypeTraitExpr *>(u.UnaryExprOrTypeTraitExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 std::optional<::pasta::Expr> UnaryExprOrTypeTraitExpr::ArgumentExpression(void) const {
@@ -11033,16 +10319,10 @@ bool UnaryOperator::CanOverflow(void) const {
   return val;
 }
 
-std::vector<::pasta::Stmt> UnaryOperator::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> UnaryOperator::Children(void) const {
   auto &self = *const_cast<clang::UnaryOperator *>(u.UnaryOperator);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token UnaryOperator::BeginToken(void) const {
@@ -11140,16 +10420,10 @@ PASTA_DEFINE_BASE_OPERATORS(Expr, UnresolvedLookupExpr)
 PASTA_DEFINE_BASE_OPERATORS(OverloadExpr, UnresolvedLookupExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, UnresolvedLookupExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, UnresolvedLookupExpr)
-std::vector<::pasta::Stmt> UnresolvedLookupExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> UnresolvedLookupExpr::Children(void) const {
   auto &self = *const_cast<clang::UnresolvedLookupExpr *>(u.UnresolvedLookupExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token UnresolvedLookupExpr::BeginToken(void) const {
@@ -11196,16 +10470,10 @@ PASTA_DEFINE_BASE_OPERATORS(Expr, UnresolvedMemberExpr)
 PASTA_DEFINE_BASE_OPERATORS(OverloadExpr, UnresolvedMemberExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, UnresolvedMemberExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, UnresolvedMemberExpr)
-std::vector<::pasta::Stmt> UnresolvedMemberExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> UnresolvedMemberExpr::Children(void) const {
   auto &self = *const_cast<clang::UnresolvedMemberExpr *>(u.UnresolvedMemberExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Expr UnresolvedMemberExpr::Base(void) const {
@@ -11291,16 +10559,10 @@ VAArgExpr::VAArgExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, VAArgExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, VAArgExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, VAArgExpr)
-std::vector<::pasta::Stmt> VAArgExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> VAArgExpr::Children(void) const {
   auto &self = *const_cast<clang::VAArgExpr *>(u.VAArgExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token VAArgExpr::BeginToken(void) const {
@@ -11400,16 +10662,10 @@ AddrLabelExpr::AddrLabelExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, AddrLabelExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, AddrLabelExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, AddrLabelExpr)
-std::vector<::pasta::Stmt> AddrLabelExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> AddrLabelExpr::Children(void) const {
   auto &self = *const_cast<clang::AddrLabelExpr *>(u.AddrLabelExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token AddrLabelExpr::AmpAmpToken(void) const {
@@ -11453,16 +10709,10 @@ ArrayInitIndexExpr::ArrayInitIndexExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, ArrayInitIndexExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ArrayInitIndexExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, ArrayInitIndexExpr)
-std::vector<::pasta::Stmt> ArrayInitIndexExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ArrayInitIndexExpr::Children(void) const {
   auto &self = *const_cast<clang::ArrayInitIndexExpr *>(u.ArrayInitIndexExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token ArrayInitIndexExpr::BeginToken(void) const {
@@ -11485,16 +10735,10 @@ ArrayInitLoopExpr::ArrayInitLoopExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, ArrayInitLoopExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ArrayInitLoopExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, ArrayInitLoopExpr)
-std::vector<::pasta::Stmt> ArrayInitLoopExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ArrayInitLoopExpr::Children(void) const {
   auto &self = *const_cast<clang::ArrayInitLoopExpr *>(u.ArrayInitLoopExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 llvm::APInt ArrayInitLoopExpr::ArraySize(void) const {
@@ -11541,16 +10785,10 @@ ArraySubscriptExpr::ArraySubscriptExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, ArraySubscriptExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ArraySubscriptExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, ArraySubscriptExpr)
-std::vector<::pasta::Stmt> ArraySubscriptExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ArraySubscriptExpr::Children(void) const {
   auto &self = *const_cast<clang::ArraySubscriptExpr *>(u.ArraySubscriptExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Expr ArraySubscriptExpr::Base(void) const {
@@ -11621,16 +10859,10 @@ ArrayTypeTraitExpr::ArrayTypeTraitExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, ArrayTypeTraitExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ArrayTypeTraitExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, ArrayTypeTraitExpr)
-std::vector<::pasta::Stmt> ArrayTypeTraitExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ArrayTypeTraitExpr::Children(void) const {
   auto &self = *const_cast<clang::ArrayTypeTraitExpr *>(u.ArrayTypeTraitExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token ArrayTypeTraitExpr::BeginToken(void) const {
@@ -11682,16 +10914,10 @@ AsTypeExpr::AsTypeExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, AsTypeExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, AsTypeExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, AsTypeExpr)
-std::vector<::pasta::Stmt> AsTypeExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> AsTypeExpr::Children(void) const {
   auto &self = *const_cast<clang::AsTypeExpr *>(u.AsTypeExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token AsTypeExpr::BeginToken(void) const {
@@ -11735,16 +10961,10 @@ AtomicExpr::AtomicExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, AtomicExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, AtomicExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, AtomicExpr)
-std::vector<::pasta::Stmt> AtomicExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> AtomicExpr::Children(void) const {
   auto &self = *const_cast<clang::AtomicExpr *>(u.AtomicExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token AtomicExpr::BeginToken(void) const {
@@ -11927,16 +11147,10 @@ PASTA_DEFINE_BASE_OPERATORS(AbstractConditionalOperator, BinaryConditionalOperat
 PASTA_DEFINE_BASE_OPERATORS(Expr, BinaryConditionalOperator)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, BinaryConditionalOperator)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, BinaryConditionalOperator)
-std::vector<::pasta::Stmt> BinaryConditionalOperator::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> BinaryConditionalOperator::Children(void) const {
   auto &self = *const_cast<clang::BinaryConditionalOperator *>(u.BinaryConditionalOperator);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token BinaryConditionalOperator::BeginToken(void) const {
@@ -12005,16 +11219,10 @@ PASTA_DEFINE_BASE_OPERATORS(Expr, BinaryOperator)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, BinaryOperator)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, BinaryOperator)
 PASTA_DEFINE_DERIVED_OPERATORS(BinaryOperator, CompoundAssignOperator)
-std::vector<::pasta::Stmt> BinaryOperator::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> BinaryOperator::Children(void) const {
   auto &self = *const_cast<clang::BinaryOperator *>(u.BinaryOperator);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token BinaryOperator::BeginToken(void) const {
@@ -12172,16 +11380,10 @@ BlockExpr::BlockExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, BlockExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, BlockExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, BlockExpr)
-std::vector<::pasta::Stmt> BlockExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> BlockExpr::Children(void) const {
   auto &self = *const_cast<clang::BlockExpr *>(u.BlockExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token BlockExpr::BeginToken(void) const {
@@ -12237,16 +11439,10 @@ CXXBindTemporaryExpr::CXXBindTemporaryExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, CXXBindTemporaryExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, CXXBindTemporaryExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CXXBindTemporaryExpr)
-std::vector<::pasta::Stmt> CXXBindTemporaryExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> CXXBindTemporaryExpr::Children(void) const {
   auto &self = *const_cast<clang::CXXBindTemporaryExpr *>(u.CXXBindTemporaryExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token CXXBindTemporaryExpr::BeginToken(void) const {
@@ -12279,16 +11475,10 @@ CXXBoolLiteralExpr::CXXBoolLiteralExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, CXXBoolLiteralExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, CXXBoolLiteralExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CXXBoolLiteralExpr)
-std::vector<::pasta::Stmt> CXXBoolLiteralExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> CXXBoolLiteralExpr::Children(void) const {
   auto &self = *const_cast<clang::CXXBoolLiteralExpr *>(u.CXXBoolLiteralExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token CXXBoolLiteralExpr::BeginToken(void) const {
@@ -12326,28 +11516,16 @@ PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CXXConstructExpr)
 PASTA_DEFINE_DERIVED_OPERATORS(CXXConstructExpr, CXXTemporaryObjectExpr)
 // 0: CXXConstructExpr::
 // 0: CXXConstructExpr::
-std::vector<::pasta::Expr> CXXConstructExpr::Arguments(void) const {
+::pasta::LazyRange<::pasta::Expr> CXXConstructExpr::Arguments(void) const {
   auto &self = *const_cast<clang::CXXConstructExpr *>(u.CXXConstructExpr);
   decltype(auto) val = self.arguments();
-  std::vector<::pasta::Expr> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Expr>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Expr, StmtBuilder>(ast, val);
 }
 
-std::vector<::pasta::Stmt> CXXConstructExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> CXXConstructExpr::Children(void) const {
   auto &self = *const_cast<clang::CXXConstructExpr *>(u.CXXConstructExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 // 1: CXXConstructExpr::Argument
@@ -12441,16 +11619,10 @@ CXXDefaultArgExpr::CXXDefaultArgExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, CXXDefaultArgExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, CXXDefaultArgExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CXXDefaultArgExpr)
-std::vector<::pasta::Stmt> CXXDefaultArgExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> CXXDefaultArgExpr::Children(void) const {
   auto &self = *const_cast<clang::CXXDefaultArgExpr *>(u.CXXDefaultArgExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Expr CXXDefaultArgExpr::AdjustedRewrittenExpression(void) const {
@@ -12538,16 +11710,10 @@ CXXDefaultInitExpr::CXXDefaultInitExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, CXXDefaultInitExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, CXXDefaultInitExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CXXDefaultInitExpr)
-std::vector<::pasta::Stmt> CXXDefaultInitExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> CXXDefaultInitExpr::Children(void) const {
   auto &self = *const_cast<clang::CXXDefaultInitExpr *>(u.CXXDefaultInitExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token CXXDefaultInitExpr::BeginToken(void) const {
@@ -12623,16 +11789,10 @@ CXXDeleteExpr::CXXDeleteExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, CXXDeleteExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, CXXDeleteExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CXXDeleteExpr)
-std::vector<::pasta::Stmt> CXXDeleteExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> CXXDeleteExpr::Children(void) const {
   auto &self = *const_cast<clang::CXXDeleteExpr *>(u.CXXDeleteExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 bool CXXDeleteExpr::DoesUsualArrayDeleteWantSize(void) const {
@@ -12708,16 +11868,10 @@ CXXDependentScopeMemberExpr::CXXDependentScopeMemberExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, CXXDependentScopeMemberExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, CXXDependentScopeMemberExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CXXDependentScopeMemberExpr)
-std::vector<::pasta::Stmt> CXXDependentScopeMemberExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> CXXDependentScopeMemberExpr::Children(void) const {
   auto &self = *const_cast<clang::CXXDependentScopeMemberExpr *>(u.CXXDependentScopeMemberExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 std::optional<::pasta::Expr> CXXDependentScopeMemberExpr::Base(void) const {
@@ -12838,16 +11992,10 @@ CXXFoldExpr::CXXFoldExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, CXXFoldExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, CXXFoldExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CXXFoldExpr)
-std::vector<::pasta::Stmt> CXXFoldExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> CXXFoldExpr::Children(void) const {
   auto &self = *const_cast<clang::CXXFoldExpr *>(u.CXXFoldExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token CXXFoldExpr::BeginToken(void) const {
@@ -12969,16 +12117,10 @@ CXXInheritedCtorInitExpr::CXXInheritedCtorInitExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, CXXInheritedCtorInitExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, CXXInheritedCtorInitExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CXXInheritedCtorInitExpr)
-std::vector<::pasta::Stmt> CXXInheritedCtorInitExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> CXXInheritedCtorInitExpr::Children(void) const {
   auto &self = *const_cast<clang::CXXInheritedCtorInitExpr *>(u.CXXInheritedCtorInitExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 bool CXXInheritedCtorInitExpr::ConstructsVirtualBase(void) const {
@@ -13034,16 +12176,10 @@ CXXNewExpr::CXXNewExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, CXXNewExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, CXXNewExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CXXNewExpr)
-std::vector<::pasta::Stmt> CXXNewExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> CXXNewExpr::Children(void) const {
   auto &self = *const_cast<clang::CXXNewExpr *>(u.CXXNewExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 bool CXXNewExpr::DoesUsualArrayDeleteWantSize(void) const {
@@ -13189,16 +12325,10 @@ bool CXXNewExpr::PassAlignment(void) const {
 
 // 0: CXXNewExpr::
 // 0: CXXNewExpr::
-std::vector<::pasta::Expr> CXXNewExpr::PlacementArguments(void) const {
+::pasta::LazyRange<::pasta::Expr> CXXNewExpr::PlacementArguments(void) const {
   auto &self = *const_cast<clang::CXXNewExpr *>(u.CXXNewExpr);
   decltype(auto) val = self.placement_arguments();
-  std::vector<::pasta::Expr> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Expr>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Expr, StmtBuilder>(ast, val);
 }
 
 // 0: CXXNewExpr::
@@ -13217,16 +12347,10 @@ CXXNoexceptExpr::CXXNoexceptExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, CXXNoexceptExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, CXXNoexceptExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CXXNoexceptExpr)
-std::vector<::pasta::Stmt> CXXNoexceptExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> CXXNoexceptExpr::Children(void) const {
   auto &self = *const_cast<clang::CXXNoexceptExpr *>(u.CXXNoexceptExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token CXXNoexceptExpr::BeginToken(void) const {
@@ -13270,16 +12394,10 @@ CXXNullPtrLiteralExpr::CXXNullPtrLiteralExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, CXXNullPtrLiteralExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, CXXNullPtrLiteralExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CXXNullPtrLiteralExpr)
-std::vector<::pasta::Stmt> CXXNullPtrLiteralExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> CXXNullPtrLiteralExpr::Children(void) const {
   auto &self = *const_cast<clang::CXXNullPtrLiteralExpr *>(u.CXXNullPtrLiteralExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token CXXNullPtrLiteralExpr::BeginToken(void) const {
@@ -13308,16 +12426,10 @@ CXXParenListInitExpr::CXXParenListInitExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, CXXParenListInitExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, CXXParenListInitExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CXXParenListInitExpr)
-std::vector<::pasta::Stmt> CXXParenListInitExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> CXXParenListInitExpr::Children(void) const {
   auto &self = *const_cast<clang::CXXParenListInitExpr *>(u.CXXParenListInitExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Expr CXXParenListInitExpr::ArrayFiller(void) const {
@@ -13372,16 +12484,10 @@ CXXPseudoDestructorExpr::CXXPseudoDestructorExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, CXXPseudoDestructorExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, CXXPseudoDestructorExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CXXPseudoDestructorExpr)
-std::vector<::pasta::Stmt> CXXPseudoDestructorExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> CXXPseudoDestructorExpr::Children(void) const {
   auto &self = *const_cast<clang::CXXPseudoDestructorExpr *>(u.CXXPseudoDestructorExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Expr CXXPseudoDestructorExpr::Base(void) const {
@@ -13567,16 +12673,10 @@ CXXScalarValueInitExpr::CXXScalarValueInitExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, CXXScalarValueInitExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, CXXScalarValueInitExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CXXScalarValueInitExpr)
-std::vector<::pasta::Stmt> CXXScalarValueInitExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> CXXScalarValueInitExpr::Children(void) const {
   auto &self = *const_cast<clang::CXXScalarValueInitExpr *>(u.CXXScalarValueInitExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token CXXScalarValueInitExpr::BeginToken(void) const {
@@ -13606,16 +12706,10 @@ CXXStdInitializerListExpr::CXXStdInitializerListExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, CXXStdInitializerListExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, CXXStdInitializerListExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CXXStdInitializerListExpr)
-std::vector<::pasta::Stmt> CXXStdInitializerListExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> CXXStdInitializerListExpr::Children(void) const {
   auto &self = *const_cast<clang::CXXStdInitializerListExpr *>(u.CXXStdInitializerListExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token CXXStdInitializerListExpr::BeginToken(void) const {
@@ -13691,16 +12785,10 @@ CXXThisExpr::CXXThisExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, CXXThisExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, CXXThisExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CXXThisExpr)
-std::vector<::pasta::Stmt> CXXThisExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> CXXThisExpr::Children(void) const {
   auto &self = *const_cast<clang::CXXThisExpr *>(u.CXXThisExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token CXXThisExpr::BeginToken(void) const {
@@ -13735,16 +12823,10 @@ CXXThrowExpr::CXXThrowExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, CXXThrowExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, CXXThrowExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CXXThrowExpr)
-std::vector<::pasta::Stmt> CXXThrowExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> CXXThrowExpr::Children(void) const {
   auto &self = *const_cast<clang::CXXThrowExpr *>(u.CXXThrowExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token CXXThrowExpr::BeginToken(void) const {
@@ -13790,16 +12872,10 @@ CXXTypeidExpr::CXXTypeidExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, CXXTypeidExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, CXXTypeidExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CXXTypeidExpr)
-std::vector<::pasta::Stmt> CXXTypeidExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> CXXTypeidExpr::Children(void) const {
   auto &self = *const_cast<clang::CXXTypeidExpr *>(u.CXXTypeidExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token CXXTypeidExpr::BeginToken(void) const {
@@ -13879,28 +12955,16 @@ PASTA_DEFINE_BASE_OPERATORS(Stmt, CXXUnresolvedConstructExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CXXUnresolvedConstructExpr)
 // 0: CXXUnresolvedConstructExpr::
 // 0: CXXUnresolvedConstructExpr::
-std::vector<::pasta::Expr> CXXUnresolvedConstructExpr::Arguments(void) const {
+::pasta::LazyRange<::pasta::Expr> CXXUnresolvedConstructExpr::Arguments(void) const {
   auto &self = *const_cast<clang::CXXUnresolvedConstructExpr *>(u.CXXUnresolvedConstructExpr);
   decltype(auto) val = self.arguments();
-  std::vector<::pasta::Expr> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Expr>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Expr, StmtBuilder>(ast, val);
 }
 
-std::vector<::pasta::Stmt> CXXUnresolvedConstructExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> CXXUnresolvedConstructExpr::Children(void) const {
   auto &self = *const_cast<clang::CXXUnresolvedConstructExpr *>(u.CXXUnresolvedConstructExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 // 1: CXXUnresolvedConstructExpr::Argument
@@ -13956,16 +13020,10 @@ CXXUuidofExpr::CXXUuidofExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, CXXUuidofExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, CXXUuidofExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CXXUuidofExpr)
-std::vector<::pasta::Stmt> CXXUuidofExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> CXXUuidofExpr::Children(void) const {
   auto &self = *const_cast<clang::CXXUuidofExpr *>(u.CXXUuidofExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token CXXUuidofExpr::BeginToken(void) const {
@@ -14043,28 +13101,16 @@ PASTA_DEFINE_DERIVED_OPERATORS(CallExpr, CXXOperatorCallExpr)
 PASTA_DEFINE_DERIVED_OPERATORS(CallExpr, UserDefinedLiteral)
 // 0: CallExpr::
 // 0: CallExpr::
-std::vector<::pasta::Expr> CallExpr::Arguments(void) const {
+::pasta::LazyRange<::pasta::Expr> CallExpr::Arguments(void) const {
   auto &self = *const_cast<clang::CallExpr *>(u.CallExpr);
   decltype(auto) val = self.arguments();
-  std::vector<::pasta::Expr> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Expr>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Expr, StmtBuilder>(ast, val);
 }
 
-std::vector<::pasta::Stmt> CallExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> CallExpr::Children(void) const {
   auto &self = *const_cast<clang::CallExpr *>(u.CallExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 enum CallExprADLCallKind CallExpr::ADLCallKind(void) const {
@@ -14213,16 +13259,10 @@ PASTA_DEFINE_DERIVED_OPERATORS(CastExpr, CXXStaticCastExpr)
 PASTA_DEFINE_DERIVED_OPERATORS(CastExpr, ExplicitCastExpr)
 PASTA_DEFINE_DERIVED_OPERATORS(CastExpr, ImplicitCastExpr)
 PASTA_DEFINE_DERIVED_OPERATORS(CastExpr, ObjCBridgedCastExpr)
-std::vector<::pasta::Stmt> CastExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> CastExpr::Children(void) const {
   auto &self = *const_cast<clang::CastExpr *>(u.CastExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 enum CastKind CastExpr::CastKind(void) const {
@@ -14307,16 +13347,10 @@ CharacterLiteral::CharacterLiteral(
 PASTA_DEFINE_BASE_OPERATORS(Expr, CharacterLiteral)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, CharacterLiteral)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CharacterLiteral)
-std::vector<::pasta::Stmt> CharacterLiteral::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> CharacterLiteral::Children(void) const {
   auto &self = *const_cast<clang::CharacterLiteral *>(u.CharacterLiteral);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token CharacterLiteral::BeginToken(void) const {
@@ -14357,16 +13391,10 @@ ChooseExpr::ChooseExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, ChooseExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ChooseExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, ChooseExpr)
-std::vector<::pasta::Stmt> ChooseExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ChooseExpr::Children(void) const {
   auto &self = *const_cast<clang::ChooseExpr *>(u.ChooseExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token ChooseExpr::BeginToken(void) const {
@@ -14472,16 +13500,10 @@ CompoundLiteralExpr::CompoundLiteralExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, CompoundLiteralExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, CompoundLiteralExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CompoundLiteralExpr)
-std::vector<::pasta::Stmt> CompoundLiteralExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> CompoundLiteralExpr::Children(void) const {
   auto &self = *const_cast<clang::CompoundLiteralExpr *>(u.CompoundLiteralExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token CompoundLiteralExpr::BeginToken(void) const {
@@ -14526,16 +13548,10 @@ ConceptSpecializationExpr::ConceptSpecializationExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, ConceptSpecializationExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ConceptSpecializationExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, ConceptSpecializationExpr)
-std::vector<::pasta::Stmt> ConceptSpecializationExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ConceptSpecializationExpr::Children(void) const {
   auto &self = *const_cast<clang::ConceptSpecializationExpr *>(u.ConceptSpecializationExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token ConceptSpecializationExpr::BeginToken(void) const {
@@ -14585,16 +13601,10 @@ PASTA_DEFINE_BASE_OPERATORS(AbstractConditionalOperator, ConditionalOperator)
 PASTA_DEFINE_BASE_OPERATORS(Expr, ConditionalOperator)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ConditionalOperator)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, ConditionalOperator)
-std::vector<::pasta::Stmt> ConditionalOperator::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ConditionalOperator::Children(void) const {
   auto &self = *const_cast<clang::ConditionalOperator *>(u.ConditionalOperator);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token ConditionalOperator::BeginToken(void) const {
@@ -14663,16 +13673,10 @@ PASTA_DEFINE_BASE_OPERATORS(Expr, ConstantExpr)
 PASTA_DEFINE_BASE_OPERATORS(FullExpr, ConstantExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ConstantExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, ConstantExpr)
-std::vector<::pasta::Stmt> ConstantExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ConstantExpr::Children(void) const {
   auto &self = *const_cast<clang::ConstantExpr *>(u.ConstantExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 // 0: ConstantExpr::APValueResult
@@ -14722,16 +13726,10 @@ ConvertVectorExpr::ConvertVectorExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, ConvertVectorExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ConvertVectorExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, ConvertVectorExpr)
-std::vector<::pasta::Stmt> ConvertVectorExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ConvertVectorExpr::Children(void) const {
   auto &self = *const_cast<clang::ConvertVectorExpr *>(u.ConvertVectorExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token ConvertVectorExpr::BeginToken(void) const {
@@ -14778,16 +13776,10 @@ PASTA_DEFINE_BASE_OPERATORS(Stmt, CoroutineSuspendExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, CoroutineSuspendExpr)
 PASTA_DEFINE_DERIVED_OPERATORS(CoroutineSuspendExpr, CoawaitExpr)
 PASTA_DEFINE_DERIVED_OPERATORS(CoroutineSuspendExpr, CoyieldExpr)
-std::vector<::pasta::Stmt> CoroutineSuspendExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> CoroutineSuspendExpr::Children(void) const {
   auto &self = *const_cast<clang::CoroutineSuspendExpr *>(u.CoroutineSuspendExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token CoroutineSuspendExpr::BeginToken(void) const {
@@ -14879,16 +13871,10 @@ DeclRefExpr::DeclRefExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, DeclRefExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, DeclRefExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, DeclRefExpr)
-std::vector<::pasta::Stmt> DeclRefExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> DeclRefExpr::Children(void) const {
   auto &self = *const_cast<clang::DeclRefExpr *>(u.DeclRefExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token DeclRefExpr::BeginToken(void) const {
@@ -15006,16 +13992,10 @@ DependentCoawaitExpr::DependentCoawaitExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, DependentCoawaitExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, DependentCoawaitExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, DependentCoawaitExpr)
-std::vector<::pasta::Stmt> DependentCoawaitExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> DependentCoawaitExpr::Children(void) const {
   auto &self = *const_cast<clang::DependentCoawaitExpr *>(u.DependentCoawaitExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token DependentCoawaitExpr::BeginToken(void) const {
@@ -15062,16 +14042,10 @@ DependentScopeDeclRefExpr::DependentScopeDeclRefExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, DependentScopeDeclRefExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, DependentScopeDeclRefExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, DependentScopeDeclRefExpr)
-std::vector<::pasta::Stmt> DependentScopeDeclRefExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> DependentScopeDeclRefExpr::Children(void) const {
   auto &self = *const_cast<clang::DependentScopeDeclRefExpr *>(u.DependentScopeDeclRefExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Token DependentScopeDeclRefExpr::BeginToken(void) const {
@@ -15136,16 +14110,10 @@ DesignatedInitExpr::DesignatedInitExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, DesignatedInitExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, DesignatedInitExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, DesignatedInitExpr)
-std::vector<::pasta::Stmt> DesignatedInitExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> DesignatedInitExpr::Children(void) const {
   auto &self = *const_cast<clang::DesignatedInitExpr *>(u.DesignatedInitExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 std::vector<::pasta::Designator> DesignatedInitExpr::Designators(void) const {
@@ -15258,16 +14226,10 @@ DesignatedInitUpdateExpr::DesignatedInitUpdateExpr(
 PASTA_DEFINE_BASE_OPERATORS(Expr, DesignatedInitUpdateExpr)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, DesignatedInitUpdateExpr)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, DesignatedInitUpdateExpr)
-std::vector<::pasta::Stmt> DesignatedInitUpdateExpr::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> DesignatedInitUpdateExpr::Children(void) const {
   auto &self = *const_cast<clang::DesignatedInitUpdateExpr *>(u.DesignatedInitUpdateExpr);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 ::pasta::Expr DesignatedInitUpdateExpr::Base(void) const {
@@ -15342,16 +14304,10 @@ PASTA_DEFINE_BASE_OPERATORS(Expr, ExprWithCleanups)
 PASTA_DEFINE_BASE_OPERATORS(FullExpr, ExprWithCleanups)
 PASTA_DEFINE_BASE_OPERATORS(Stmt, ExprWithCleanups)
 PASTA_DEFINE_BASE_OPERATORS(ValueStmt, ExprWithCleanups)
-std::vector<::pasta::Stmt> ExprWithCleanups::Children(void) const {
+::pasta::LazyRange<::pasta::Stmt> ExprWithCleanups::Children(void) const {
   auto &self = *const_cast<clang::ExprWithCleanups *>(u.ExprWithCleanups);
   decltype(auto) val = self.children();
-  std::vector<::pasta::Stmt> ret;
-  for (auto stmt_ptr : val) {
-    if (stmt_ptr) {
-      ret.emplace_back(StmtBuilder::Create<::pasta::Stmt>(ast, stmt_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::Stmt, StmtBuilder>(ast, val);
 }
 
 bool ExprWithCleanups::CleanupsHaveSideEffects(void) const {
@@ -16188,5 +15144,2046 @@ bool CXXDynamicCastExpr::IsAlwaysNull(void) const {
   return val;
 }
 
+::pasta::StmtSnapshot Stmt::Snapshot(void) const {
+  ::pasta::StmtSnapshot snapshot;
+  snapshot.begin_token = ast->TokenIndexAt(const_cast<clang::Stmt *>(u.Stmt)->getBeginLoc());
+  snapshot.end_token = ast->TokenIndexAt(const_cast<clang::Stmt *>(u.Stmt)->getEndLoc());
+  snapshot.id = Stmt::ID();
+  return snapshot;
+}
+
+::pasta::SwitchCaseSnapshot SwitchCase::Snapshot(void) const {
+  ::pasta::SwitchCaseSnapshot snapshot;
+  static_cast<::pasta::StmtSnapshot &>(snapshot) = Stmt::Snapshot();
+  snapshot.colon_token = ast->TokenIndexAt(const_cast<clang::SwitchCase *>(u.SwitchCase)->getColonLoc());
+  snapshot.keyword_token = ast->TokenIndexAt(const_cast<clang::SwitchCase *>(u.SwitchCase)->getKeywordLoc());
+  return snapshot;
+}
+
+::pasta::SwitchStmtSnapshot SwitchStmt::Snapshot(void) const {
+  ::pasta::SwitchStmtSnapshot snapshot;
+  static_cast<::pasta::StmtSnapshot &>(snapshot) = Stmt::Snapshot();
+  snapshot.l_paren_token = ast->TokenIndexAt(const_cast<clang::SwitchStmt *>(u.SwitchStmt)->getLParenLoc());
+  snapshot.r_paren_token = ast->TokenIndexAt(const_cast<clang::SwitchStmt *>(u.SwitchStmt)->getRParenLoc());
+  snapshot.switch_token = ast->TokenIndexAt(const_cast<clang::SwitchStmt *>(u.SwitchStmt)->getSwitchLoc());
+  snapshot.has_initializer_storage = SwitchStmt::HasInitializerStorage();
+  snapshot.has_variable_storage = SwitchStmt::HasVariableStorage();
+  snapshot.is_all_enum_cases_covered = SwitchStmt::IsAllEnumCasesCovered();
+  return snapshot;
+}
+
+::pasta::ValueStmtSnapshot ValueStmt::Snapshot(void) const {
+  ::pasta::ValueStmtSnapshot snapshot;
+  static_cast<::pasta::StmtSnapshot &>(snapshot) = Stmt::Snapshot();
+  return snapshot;
+}
+
+::pasta::WhileStmtSnapshot WhileStmt::Snapshot(void) const {
+  ::pasta::WhileStmtSnapshot snapshot;
+  static_cast<::pasta::StmtSnapshot &>(snapshot) = Stmt::Snapshot();
+  snapshot.l_paren_token = ast->TokenIndexAt(const_cast<clang::WhileStmt *>(u.WhileStmt)->getLParenLoc());
+  snapshot.r_paren_token = ast->TokenIndexAt(const_cast<clang::WhileStmt *>(u.WhileStmt)->getRParenLoc());
+  snapshot.while_token = ast->TokenIndexAt(const_cast<clang::WhileStmt *>(u.WhileStmt)->getWhileLoc());
+  snapshot.has_variable_storage = WhileStmt::HasVariableStorage();
+  return snapshot;
+}
+
+::pasta::AsmStmtSnapshot AsmStmt::Snapshot(void) const {
+  ::pasta::AsmStmtSnapshot snapshot;
+  static_cast<::pasta::StmtSnapshot &>(snapshot) = Stmt::Snapshot();
+  snapshot.assembly_token = ast->TokenIndexAt(const_cast<clang::AsmStmt *>(u.AsmStmt)->getAsmLoc());
+  snapshot.num_clobbers = AsmStmt::NumClobbers();
+  snapshot.num_inputs = AsmStmt::NumInputs();
+  snapshot.num_outputs = AsmStmt::NumOutputs();
+  snapshot.num_plus_operands = AsmStmt::NumPlusOperands();
+  snapshot.is_simple = AsmStmt::IsSimple();
+  snapshot.is_volatile = AsmStmt::IsVolatile();
+  return snapshot;
+}
+
+::pasta::AttributedStmtSnapshot AttributedStmt::Snapshot(void) const {
+  ::pasta::AttributedStmtSnapshot snapshot;
+  static_cast<::pasta::ValueStmtSnapshot &>(snapshot) = ValueStmt::Snapshot();
+  snapshot.attribute_token = ast->TokenIndexAt(const_cast<clang::AttributedStmt *>(u.AttributedStmt)->getAttrLoc());
+  return snapshot;
+}
+
+::pasta::BreakStmtSnapshot BreakStmt::Snapshot(void) const {
+  ::pasta::BreakStmtSnapshot snapshot;
+  static_cast<::pasta::StmtSnapshot &>(snapshot) = Stmt::Snapshot();
+  snapshot.break_token = ast->TokenIndexAt(const_cast<clang::BreakStmt *>(u.BreakStmt)->getBreakLoc());
+  return snapshot;
+}
+
+::pasta::CXXCatchStmtSnapshot CXXCatchStmt::Snapshot(void) const {
+  ::pasta::CXXCatchStmtSnapshot snapshot;
+  static_cast<::pasta::StmtSnapshot &>(snapshot) = Stmt::Snapshot();
+  snapshot.catch_token = ast->TokenIndexAt(const_cast<clang::CXXCatchStmt *>(u.CXXCatchStmt)->getCatchLoc());
+  return snapshot;
+}
+
+::pasta::CXXForRangeStmtSnapshot CXXForRangeStmt::Snapshot(void) const {
+  ::pasta::CXXForRangeStmtSnapshot snapshot;
+  static_cast<::pasta::StmtSnapshot &>(snapshot) = Stmt::Snapshot();
+  snapshot.coawait_token = ast->TokenIndexAt(const_cast<clang::CXXForRangeStmt *>(u.CXXForRangeStmt)->getCoawaitLoc());
+  snapshot.colon_token = ast->TokenIndexAt(const_cast<clang::CXXForRangeStmt *>(u.CXXForRangeStmt)->getColonLoc());
+  snapshot.for_token = ast->TokenIndexAt(const_cast<clang::CXXForRangeStmt *>(u.CXXForRangeStmt)->getForLoc());
+  snapshot.r_paren_token = ast->TokenIndexAt(const_cast<clang::CXXForRangeStmt *>(u.CXXForRangeStmt)->getRParenLoc());
+  return snapshot;
+}
+
+::pasta::CXXTryStmtSnapshot CXXTryStmt::Snapshot(void) const {
+  ::pasta::CXXTryStmtSnapshot snapshot;
+  static_cast<::pasta::StmtSnapshot &>(snapshot) = Stmt::Snapshot();
+  snapshot.num_handlers = CXXTryStmt::NumHandlers();
+  snapshot.try_token = ast->TokenIndexAt(const_cast<clang::CXXTryStmt *>(u.CXXTryStmt)->getTryLoc());
+  return snapshot;
+}
+
+::pasta::CapturedStmtSnapshot CapturedStmt::Snapshot(void) const {
+  ::pasta::CapturedStmtSnapshot snapshot;
+  static_cast<::pasta::StmtSnapshot &>(snapshot) = Stmt::Snapshot();
+  snapshot.captured_region_kind = CapturedStmt::CapturedRegionKind();
+  return snapshot;
+}
+
+::pasta::CaseStmtSnapshot CaseStmt::Snapshot(void) const {
+  ::pasta::CaseStmtSnapshot snapshot;
+  static_cast<::pasta::SwitchCaseSnapshot &>(snapshot) = SwitchCase::Snapshot();
+  snapshot.case_statement_is_gnu_range = CaseStmt::CaseStatementIsGNURange();
+  snapshot.case_token = ast->TokenIndexAt(const_cast<clang::CaseStmt *>(u.CaseStmt)->getCaseLoc());
+  snapshot.ellipsis_token = ast->TokenIndexAt(const_cast<clang::CaseStmt *>(u.CaseStmt)->getEllipsisLoc());
+  return snapshot;
+}
+
+::pasta::CompoundStmtSnapshot CompoundStmt::Snapshot(void) const {
+  ::pasta::CompoundStmtSnapshot snapshot;
+  static_cast<::pasta::StmtSnapshot &>(snapshot) = Stmt::Snapshot();
+  snapshot.left_brace_token = ast->TokenIndexAt(const_cast<clang::CompoundStmt *>(u.CompoundStmt)->getLBracLoc());
+  snapshot.right_brace_token = ast->TokenIndexAt(const_cast<clang::CompoundStmt *>(u.CompoundStmt)->getRBracLoc());
+  snapshot.has_stored_fp_features = CompoundStmt::HasStoredFPFeatures();
+  snapshot.size = CompoundStmt::Size();
+  return snapshot;
+}
+
+::pasta::ContinueStmtSnapshot ContinueStmt::Snapshot(void) const {
+  ::pasta::ContinueStmtSnapshot snapshot;
+  static_cast<::pasta::StmtSnapshot &>(snapshot) = Stmt::Snapshot();
+  snapshot.continue_token = ast->TokenIndexAt(const_cast<clang::ContinueStmt *>(u.ContinueStmt)->getContinueLoc());
+  return snapshot;
+}
+
+::pasta::CoreturnStmtSnapshot CoreturnStmt::Snapshot(void) const {
+  ::pasta::CoreturnStmtSnapshot snapshot;
+  static_cast<::pasta::StmtSnapshot &>(snapshot) = Stmt::Snapshot();
+  snapshot.keyword_token = ast->TokenIndexAt(const_cast<clang::CoreturnStmt *>(u.CoreturnStmt)->getKeywordLoc());
+  snapshot.is_implicit = CoreturnStmt::IsImplicit();
+  return snapshot;
+}
+
+::pasta::CoroutineBodyStmtSnapshot CoroutineBodyStmt::Snapshot(void) const {
+  ::pasta::CoroutineBodyStmtSnapshot snapshot;
+  static_cast<::pasta::StmtSnapshot &>(snapshot) = Stmt::Snapshot();
+  snapshot.has_dependent_promise_type = CoroutineBodyStmt::HasDependentPromiseType();
+  return snapshot;
+}
+
+::pasta::DeclStmtSnapshot DeclStmt::Snapshot(void) const {
+  ::pasta::DeclStmtSnapshot snapshot;
+  static_cast<::pasta::StmtSnapshot &>(snapshot) = Stmt::Snapshot();
+  snapshot.is_single_declaration = DeclStmt::IsSingleDeclaration();
+  return snapshot;
+}
+
+::pasta::DefaultStmtSnapshot DefaultStmt::Snapshot(void) const {
+  ::pasta::DefaultStmtSnapshot snapshot;
+  static_cast<::pasta::SwitchCaseSnapshot &>(snapshot) = SwitchCase::Snapshot();
+  snapshot.default_token = ast->TokenIndexAt(const_cast<clang::DefaultStmt *>(u.DefaultStmt)->getDefaultLoc());
+  return snapshot;
+}
+
+::pasta::DoStmtSnapshot DoStmt::Snapshot(void) const {
+  ::pasta::DoStmtSnapshot snapshot;
+  static_cast<::pasta::StmtSnapshot &>(snapshot) = Stmt::Snapshot();
+  snapshot.do_token = ast->TokenIndexAt(const_cast<clang::DoStmt *>(u.DoStmt)->getDoLoc());
+  snapshot.r_paren_token = ast->TokenIndexAt(const_cast<clang::DoStmt *>(u.DoStmt)->getRParenLoc());
+  snapshot.while_token = ast->TokenIndexAt(const_cast<clang::DoStmt *>(u.DoStmt)->getWhileLoc());
+  return snapshot;
+}
+
+::pasta::ExprSnapshot Expr::Snapshot(void) const {
+  ::pasta::ExprSnapshot snapshot;
+  static_cast<::pasta::ValueStmtSnapshot &>(snapshot) = ValueStmt::Snapshot();
+  snapshot.classify_l_value = Expr::ClassifyLValue();
+  snapshot.has_side_effects = Expr::HasSideEffects();
+  snapshot.contains_errors = Expr::ContainsErrors();
+  snapshot.contains_unexpanded_parameter_pack = Expr::ContainsUnexpandedParameterPack();
+  snapshot.dependence = Expr::Dependence();
+  snapshot.expression_token = ast->TokenIndexAt(const_cast<clang::Expr *>(u.Expr)->getExprLoc());
+  snapshot.object_kind = Expr::ObjectKind();
+  snapshot.value_kind = Expr::ValueKind();
+  snapshot.has_non_trivial_call = Expr::HasNonTrivialCall();
+  snapshot.is_bound_member_function = Expr::IsBoundMemberFunction();
+  snapshot.is_default_argument = Expr::IsDefaultArgument();
+  snapshot.is_gl_value = Expr::IsGLValue();
+  snapshot.is_implicit_cxx_this = Expr::IsImplicitCXXThis();
+  snapshot.is_instantiation_dependent = Expr::IsInstantiationDependent();
+  snapshot.is_l_value = Expr::IsLValue();
+  snapshot.is_modifiable_lvalue = Expr::IsModifiableLvalue();
+  snapshot.is_objcgc_candidate = Expr::IsOBJCGCCandidate();
+  snapshot.is_obj_c_self_expression = Expr::IsObjCSelfExpression();
+  snapshot.is_ordinary_or_bit_field_object = Expr::IsOrdinaryOrBitFieldObject();
+  snapshot.is_pr_value = Expr::IsPRValue();
+  snapshot.is_type_dependent = Expr::IsTypeDependent();
+  snapshot.is_value_dependent = Expr::IsValueDependent();
+  snapshot.is_x_value = Expr::IsXValue();
+  snapshot.refers_to_bit_field = Expr::RefersToBitField();
+  snapshot.refers_to_global_register_variable = Expr::RefersToGlobalRegisterVariable();
+  snapshot.refers_to_matrix_element = Expr::RefersToMatrixElement();
+  snapshot.refers_to_vector_element = Expr::RefersToVectorElement();
+  return snapshot;
+}
+
+::pasta::ExpressionTraitExprSnapshot ExpressionTraitExpr::Snapshot(void) const {
+  ::pasta::ExpressionTraitExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.trait = ExpressionTraitExpr::Trait();
+  snapshot.value = ExpressionTraitExpr::Value();
+  return snapshot;
+}
+
+::pasta::ExtVectorElementExprSnapshot ExtVectorElementExpr::Snapshot(void) const {
+  ::pasta::ExtVectorElementExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.contains_duplicate_elements = ExtVectorElementExpr::ContainsDuplicateElements();
+  snapshot.accessor_token = ast->TokenIndexAt(const_cast<clang::ExtVectorElementExpr *>(u.ExtVectorElementExpr)->getAccessorLoc());
+  snapshot.num_elements = ExtVectorElementExpr::NumElements();
+  snapshot.is_arrow = ExtVectorElementExpr::IsArrow();
+  return snapshot;
+}
+
+::pasta::FixedPointLiteralSnapshot FixedPointLiteral::Snapshot(void) const {
+  ::pasta::FixedPointLiteralSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.token = ast->TokenIndexAt(const_cast<clang::FixedPointLiteral *>(u.FixedPointLiteral)->getLocation());
+  snapshot.scale = FixedPointLiteral::Scale();
+  return snapshot;
+}
+
+::pasta::FloatingLiteralSnapshot FloatingLiteral::Snapshot(void) const {
+  ::pasta::FloatingLiteralSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.token = ast->TokenIndexAt(const_cast<clang::FloatingLiteral *>(u.FloatingLiteral)->getLocation());
+  snapshot.value_as_approximate_double = FloatingLiteral::ValueAsApproximateDouble();
+  snapshot.is_exact = FloatingLiteral::IsExact();
+  return snapshot;
+}
+
+::pasta::ForStmtSnapshot ForStmt::Snapshot(void) const {
+  ::pasta::ForStmtSnapshot snapshot;
+  static_cast<::pasta::StmtSnapshot &>(snapshot) = Stmt::Snapshot();
+  snapshot.for_token = ast->TokenIndexAt(const_cast<clang::ForStmt *>(u.ForStmt)->getForLoc());
+  snapshot.l_paren_token = ast->TokenIndexAt(const_cast<clang::ForStmt *>(u.ForStmt)->getLParenLoc());
+  snapshot.r_paren_token = ast->TokenIndexAt(const_cast<clang::ForStmt *>(u.ForStmt)->getRParenLoc());
+  return snapshot;
+}
+
+::pasta::FullExprSnapshot FullExpr::Snapshot(void) const {
+  ::pasta::FullExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  return snapshot;
+}
+
+::pasta::FunctionParmPackExprSnapshot FunctionParmPackExpr::Snapshot(void) const {
+  ::pasta::FunctionParmPackExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.num_expansions = FunctionParmPackExpr::NumExpansions();
+  snapshot.parameter_pack_token = ast->TokenIndexAt(const_cast<clang::FunctionParmPackExpr *>(u.FunctionParmPackExpr)->getParameterPackLocation());
+  return snapshot;
+}
+
+::pasta::GCCAsmStmtSnapshot GCCAsmStmt::Snapshot(void) const {
+  ::pasta::GCCAsmStmtSnapshot snapshot;
+  static_cast<::pasta::AsmStmtSnapshot &>(snapshot) = AsmStmt::Snapshot();
+  snapshot.num_labels = GCCAsmStmt::NumLabels();
+  snapshot.r_paren_token = ast->TokenIndexAt(const_cast<clang::GCCAsmStmt *>(u.GCCAsmStmt)->getRParenLoc());
+  snapshot.is_assembly_goto = GCCAsmStmt::IsAssemblyGoto();
+  return snapshot;
+}
+
+::pasta::GNUNullExprSnapshot GNUNullExpr::Snapshot(void) const {
+  ::pasta::GNUNullExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.token_token = ast->TokenIndexAt(const_cast<clang::GNUNullExpr *>(u.GNUNullExpr)->getTokenLocation());
+  return snapshot;
+}
+
+::pasta::GenericSelectionExprSnapshot GenericSelectionExpr::Snapshot(void) const {
+  ::pasta::GenericSelectionExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.default_token = ast->TokenIndexAt(const_cast<clang::GenericSelectionExpr *>(u.GenericSelectionExpr)->getDefaultLoc());
+  snapshot.generic_token = ast->TokenIndexAt(const_cast<clang::GenericSelectionExpr *>(u.GenericSelectionExpr)->getGenericLoc());
+  snapshot.num_associations = GenericSelectionExpr::NumAssociations();
+  snapshot.r_paren_token = ast->TokenIndexAt(const_cast<clang::GenericSelectionExpr *>(u.GenericSelectionExpr)->getRParenLoc());
+  if (const auto &self = *(u.GenericSelectionExpr); !self.isResultDependent()) {
+    snapshot.result_index = GenericSelectionExpr::ResultIndex();
+  }
+  snapshot.is_expression_predicate = GenericSelectionExpr::IsExpressionPredicate();
+  snapshot.is_result_dependent = GenericSelectionExpr::IsResultDependent();
+  snapshot.is_type_predicate = GenericSelectionExpr::IsTypePredicate();
+  return snapshot;
+}
+
+::pasta::GotoStmtSnapshot GotoStmt::Snapshot(void) const {
+  ::pasta::GotoStmtSnapshot snapshot;
+  static_cast<::pasta::StmtSnapshot &>(snapshot) = Stmt::Snapshot();
+  snapshot.goto_token = ast->TokenIndexAt(const_cast<clang::GotoStmt *>(u.GotoStmt)->getGotoLoc());
+  snapshot.label_token = ast->TokenIndexAt(const_cast<clang::GotoStmt *>(u.GotoStmt)->getLabelLoc());
+  return snapshot;
+}
+
+::pasta::IfStmtSnapshot IfStmt::Snapshot(void) const {
+  ::pasta::IfStmtSnapshot snapshot;
+  static_cast<::pasta::StmtSnapshot &>(snapshot) = Stmt::Snapshot();
+  snapshot.else_token = ast->TokenIndexAt(const_cast<clang::IfStmt *>(u.IfStmt)->getElseLoc());
+  snapshot.if_token = ast->TokenIndexAt(const_cast<clang::IfStmt *>(u.IfStmt)->getIfLoc());
+  snapshot.l_paren_token = ast->TokenIndexAt(const_cast<clang::IfStmt *>(u.IfStmt)->getLParenLoc());
+  snapshot.r_paren_token = ast->TokenIndexAt(const_cast<clang::IfStmt *>(u.IfStmt)->getRParenLoc());
+  snapshot.statement_kind = IfStmt::StatementKind();
+  snapshot.has_else_storage = IfStmt::HasElseStorage();
+  snapshot.has_initializer_storage = IfStmt::HasInitializerStorage();
+  snapshot.has_variable_storage = IfStmt::HasVariableStorage();
+  snapshot.is_consteval = IfStmt::IsConsteval();
+  snapshot.is_constexpr = IfStmt::IsConstexpr();
+  snapshot.is_negated_consteval = IfStmt::IsNegatedConsteval();
+  snapshot.is_non_negated_consteval = IfStmt::IsNonNegatedConsteval();
+  snapshot.is_obj_c_availability_check = IfStmt::IsObjCAvailabilityCheck();
+  return snapshot;
+}
+
+::pasta::ImaginaryLiteralSnapshot ImaginaryLiteral::Snapshot(void) const {
+  ::pasta::ImaginaryLiteralSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  return snapshot;
+}
+
+::pasta::ImplicitValueInitExprSnapshot ImplicitValueInitExpr::Snapshot(void) const {
+  ::pasta::ImplicitValueInitExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  return snapshot;
+}
+
+::pasta::IndirectGotoStmtSnapshot IndirectGotoStmt::Snapshot(void) const {
+  ::pasta::IndirectGotoStmtSnapshot snapshot;
+  static_cast<::pasta::StmtSnapshot &>(snapshot) = Stmt::Snapshot();
+  snapshot.goto_token = ast->TokenIndexAt(const_cast<clang::IndirectGotoStmt *>(u.IndirectGotoStmt)->getGotoLoc());
+  snapshot.star_token = ast->TokenIndexAt(const_cast<clang::IndirectGotoStmt *>(u.IndirectGotoStmt)->getStarLoc());
+  return snapshot;
+}
+
+::pasta::InitListExprSnapshot InitListExpr::Snapshot(void) const {
+  ::pasta::InitListExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.l_brace_token = ast->TokenIndexAt(const_cast<clang::InitListExpr *>(u.InitListExpr)->getLBraceLoc());
+  snapshot.num_initializers = InitListExpr::NumInitializers();
+  snapshot.r_brace_token = ast->TokenIndexAt(const_cast<clang::InitListExpr *>(u.InitListExpr)->getRBraceLoc());
+  snapshot.had_array_range_designator = InitListExpr::HadArrayRangeDesignator();
+  snapshot.has_array_filler = InitListExpr::HasArrayFiller();
+  snapshot.has_designated_initializer = InitListExpr::HasDesignatedInitializer();
+  snapshot.is_explicit = InitListExpr::IsExplicit();
+  snapshot.is_semantic_form = InitListExpr::IsSemanticForm();
+  snapshot.is_string_literal_initializer = InitListExpr::IsStringLiteralInitializer();
+  snapshot.is_syntactic_form = InitListExpr::IsSyntacticForm();
+  return snapshot;
+}
+
+::pasta::IntegerLiteralSnapshot IntegerLiteral::Snapshot(void) const {
+  ::pasta::IntegerLiteralSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.token = ast->TokenIndexAt(const_cast<clang::IntegerLiteral *>(u.IntegerLiteral)->getLocation());
+  return snapshot;
+}
+
+::pasta::LabelStmtSnapshot LabelStmt::Snapshot(void) const {
+  ::pasta::LabelStmtSnapshot snapshot;
+  static_cast<::pasta::ValueStmtSnapshot &>(snapshot) = ValueStmt::Snapshot();
+  snapshot.identifier_token = ast->TokenIndexAt(const_cast<clang::LabelStmt *>(u.LabelStmt)->getIdentLoc());
+  snapshot.is_side_entry = LabelStmt::IsSideEntry();
+  return snapshot;
+}
+
+::pasta::LambdaExprSnapshot LambdaExpr::Snapshot(void) const {
+  ::pasta::LambdaExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.capture_default = LambdaExpr::CaptureDefault();
+  snapshot.capture_default_token = ast->TokenIndexAt(const_cast<clang::LambdaExpr *>(u.LambdaExpr)->getCaptureDefaultLoc());
+  snapshot.has_explicit_parameters = LambdaExpr::HasExplicitParameters();
+  snapshot.has_explicit_result_type = LambdaExpr::HasExplicitResultType();
+  snapshot.is_generic_lambda = LambdaExpr::IsGenericLambda();
+  snapshot.is_mutable = LambdaExpr::IsMutable();
+  return snapshot;
+}
+
+::pasta::MSAsmStmtSnapshot MSAsmStmt::Snapshot(void) const {
+  ::pasta::MSAsmStmtSnapshot snapshot;
+  static_cast<::pasta::AsmStmtSnapshot &>(snapshot) = AsmStmt::Snapshot();
+  snapshot.l_brace_token = ast->TokenIndexAt(const_cast<clang::MSAsmStmt *>(u.MSAsmStmt)->getLBraceLoc());
+  snapshot.has_braces = MSAsmStmt::HasBraces();
+  return snapshot;
+}
+
+::pasta::MSDependentExistsStmtSnapshot MSDependentExistsStmt::Snapshot(void) const {
+  ::pasta::MSDependentExistsStmtSnapshot snapshot;
+  static_cast<::pasta::StmtSnapshot &>(snapshot) = Stmt::Snapshot();
+  snapshot.keyword_token = ast->TokenIndexAt(const_cast<clang::MSDependentExistsStmt *>(u.MSDependentExistsStmt)->getKeywordLoc());
+  snapshot.is_if_exists = MSDependentExistsStmt::IsIfExists();
+  snapshot.is_if_not_exists = MSDependentExistsStmt::IsIfNotExists();
+  return snapshot;
+}
+
+::pasta::MSPropertyRefExprSnapshot MSPropertyRefExpr::Snapshot(void) const {
+  ::pasta::MSPropertyRefExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.member_token = ast->TokenIndexAt(const_cast<clang::MSPropertyRefExpr *>(u.MSPropertyRefExpr)->getMemberLoc());
+  snapshot.is_arrow = MSPropertyRefExpr::IsArrow();
+  snapshot.is_implicit_access = MSPropertyRefExpr::IsImplicitAccess();
+  return snapshot;
+}
+
+::pasta::MSPropertySubscriptExprSnapshot MSPropertySubscriptExpr::Snapshot(void) const {
+  ::pasta::MSPropertySubscriptExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.r_bracket_token = ast->TokenIndexAt(const_cast<clang::MSPropertySubscriptExpr *>(u.MSPropertySubscriptExpr)->getRBracketLoc());
+  return snapshot;
+}
+
+::pasta::MaterializeTemporaryExprSnapshot MaterializeTemporaryExpr::Snapshot(void) const {
+  ::pasta::MaterializeTemporaryExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.mangling_number = MaterializeTemporaryExpr::ManglingNumber();
+  snapshot.storage_duration = MaterializeTemporaryExpr::StorageDuration();
+  snapshot.is_bound_to_lvalue_reference = MaterializeTemporaryExpr::IsBoundToLvalueReference();
+  snapshot.is_usable_in_constant_expressions = MaterializeTemporaryExpr::IsUsableInConstantExpressions();
+  return snapshot;
+}
+
+::pasta::MatrixSubscriptExprSnapshot MatrixSubscriptExpr::Snapshot(void) const {
+  ::pasta::MatrixSubscriptExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.r_bracket_token = ast->TokenIndexAt(const_cast<clang::MatrixSubscriptExpr *>(u.MatrixSubscriptExpr)->getRBracketLoc());
+  snapshot.is_incomplete = MatrixSubscriptExpr::IsIncomplete();
+  return snapshot;
+}
+
+::pasta::MemberExprSnapshot MemberExpr::Snapshot(void) const {
+  ::pasta::MemberExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.l_angle_token = ast->TokenIndexAt(const_cast<clang::MemberExpr *>(u.MemberExpr)->getLAngleLoc());
+  snapshot.member_token = ast->TokenIndexAt(const_cast<clang::MemberExpr *>(u.MemberExpr)->getMemberLoc());
+  snapshot.num_template_arguments = MemberExpr::NumTemplateArguments();
+  snapshot.operator_token = ast->TokenIndexAt(const_cast<clang::MemberExpr *>(u.MemberExpr)->getOperatorLoc());
+  snapshot.r_angle_token = ast->TokenIndexAt(const_cast<clang::MemberExpr *>(u.MemberExpr)->getRAngleLoc());
+  snapshot.template_keyword_token = ast->TokenIndexAt(const_cast<clang::MemberExpr *>(u.MemberExpr)->getTemplateKeywordLoc());
+  snapshot.had_multiple_candidates = MemberExpr::HadMultipleCandidates();
+  snapshot.has_explicit_template_arguments = MemberExpr::HasExplicitTemplateArguments();
+  snapshot.has_qualifier = MemberExpr::HasQualifier();
+  snapshot.has_template_keyword = MemberExpr::HasTemplateKeyword();
+  snapshot.is_arrow = MemberExpr::IsArrow();
+  snapshot.is_implicit_access = MemberExpr::IsImplicitAccess();
+  snapshot.is_non_odr_use = MemberExpr::IsNonOdrUse();
+  return snapshot;
+}
+
+::pasta::NoInitExprSnapshot NoInitExpr::Snapshot(void) const {
+  ::pasta::NoInitExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  return snapshot;
+}
+
+::pasta::NullStmtSnapshot NullStmt::Snapshot(void) const {
+  ::pasta::NullStmtSnapshot snapshot;
+  static_cast<::pasta::StmtSnapshot &>(snapshot) = Stmt::Snapshot();
+  snapshot.semi_token = ast->TokenIndexAt(const_cast<clang::NullStmt *>(u.NullStmt)->getSemiLoc());
+  snapshot.has_leading_empty_macro = NullStmt::HasLeadingEmptyMacro();
+  return snapshot;
+}
+
+::pasta::OMPArraySectionExprSnapshot OMPArraySectionExpr::Snapshot(void) const {
+  ::pasta::OMPArraySectionExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.first_colon_token = ast->TokenIndexAt(const_cast<clang::OMPArraySectionExpr *>(u.OMPArraySectionExpr)->getColonLocFirst());
+  snapshot.second_colon_token = ast->TokenIndexAt(const_cast<clang::OMPArraySectionExpr *>(u.OMPArraySectionExpr)->getColonLocSecond());
+  snapshot.r_bracket_token = ast->TokenIndexAt(const_cast<clang::OMPArraySectionExpr *>(u.OMPArraySectionExpr)->getRBracketLoc());
+  return snapshot;
+}
+
+::pasta::OMPArrayShapingExprSnapshot OMPArrayShapingExpr::Snapshot(void) const {
+  ::pasta::OMPArrayShapingExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.l_paren_token = ast->TokenIndexAt(const_cast<clang::OMPArrayShapingExpr *>(u.OMPArrayShapingExpr)->getLParenLoc());
+  snapshot.r_paren_token = ast->TokenIndexAt(const_cast<clang::OMPArrayShapingExpr *>(u.OMPArrayShapingExpr)->getRParenLoc());
+  return snapshot;
+}
+
+::pasta::OMPCanonicalLoopSnapshot OMPCanonicalLoop::Snapshot(void) const {
+  ::pasta::OMPCanonicalLoopSnapshot snapshot;
+  static_cast<::pasta::StmtSnapshot &>(snapshot) = Stmt::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPExecutableDirectiveSnapshot OMPExecutableDirective::Snapshot(void) const {
+  ::pasta::OMPExecutableDirectiveSnapshot snapshot;
+  static_cast<::pasta::StmtSnapshot &>(snapshot) = Stmt::Snapshot();
+  snapshot.num_clauses = OMPExecutableDirective::NumClauses();
+  snapshot.has_associated_statement = OMPExecutableDirective::HasAssociatedStatement();
+  snapshot.is_standalone_directive = OMPExecutableDirective::IsStandaloneDirective();
+  return snapshot;
+}
+
+::pasta::OMPFlushDirectiveSnapshot OMPFlushDirective::Snapshot(void) const {
+  ::pasta::OMPFlushDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPExecutableDirectiveSnapshot &>(snapshot) = OMPExecutableDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPInteropDirectiveSnapshot OMPInteropDirective::Snapshot(void) const {
+  ::pasta::OMPInteropDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPExecutableDirectiveSnapshot &>(snapshot) = OMPExecutableDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPIteratorExprSnapshot OMPIteratorExpr::Snapshot(void) const {
+  ::pasta::OMPIteratorExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.iterator_kw_token = ast->TokenIndexAt(const_cast<clang::OMPIteratorExpr *>(u.OMPIteratorExpr)->getIteratorKwLoc());
+  snapshot.l_paren_token = ast->TokenIndexAt(const_cast<clang::OMPIteratorExpr *>(u.OMPIteratorExpr)->getLParenLoc());
+  snapshot.r_paren_token = ast->TokenIndexAt(const_cast<clang::OMPIteratorExpr *>(u.OMPIteratorExpr)->getRParenLoc());
+  snapshot.num_of_iterators = OMPIteratorExpr::NumOfIterators();
+  return snapshot;
+}
+
+::pasta::OMPLoopBasedDirectiveSnapshot OMPLoopBasedDirective::Snapshot(void) const {
+  ::pasta::OMPLoopBasedDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPExecutableDirectiveSnapshot &>(snapshot) = OMPExecutableDirective::Snapshot();
+  snapshot.loops_number = OMPLoopBasedDirective::LoopsNumber();
+  return snapshot;
+}
+
+::pasta::OMPLoopDirectiveSnapshot OMPLoopDirective::Snapshot(void) const {
+  ::pasta::OMPLoopDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopBasedDirectiveSnapshot &>(snapshot) = OMPLoopBasedDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPLoopTransformationDirectiveSnapshot OMPLoopTransformationDirective::Snapshot(void) const {
+  ::pasta::OMPLoopTransformationDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopBasedDirectiveSnapshot &>(snapshot) = OMPLoopBasedDirective::Snapshot();
+  snapshot.num_associated_loops = OMPLoopTransformationDirective::NumAssociatedLoops();
+  return snapshot;
+}
+
+::pasta::OMPMaskedDirectiveSnapshot OMPMaskedDirective::Snapshot(void) const {
+  ::pasta::OMPMaskedDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPExecutableDirectiveSnapshot &>(snapshot) = OMPExecutableDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPMaskedTaskLoopDirectiveSnapshot OMPMaskedTaskLoopDirective::Snapshot(void) const {
+  ::pasta::OMPMaskedTaskLoopDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopDirectiveSnapshot &>(snapshot) = OMPLoopDirective::Snapshot();
+  snapshot.has_cancel = OMPMaskedTaskLoopDirective::HasCancel();
+  return snapshot;
+}
+
+::pasta::OMPMaskedTaskLoopSimdDirectiveSnapshot OMPMaskedTaskLoopSimdDirective::Snapshot(void) const {
+  ::pasta::OMPMaskedTaskLoopSimdDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopDirectiveSnapshot &>(snapshot) = OMPLoopDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPMasterDirectiveSnapshot OMPMasterDirective::Snapshot(void) const {
+  ::pasta::OMPMasterDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPExecutableDirectiveSnapshot &>(snapshot) = OMPExecutableDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPMasterTaskLoopDirectiveSnapshot OMPMasterTaskLoopDirective::Snapshot(void) const {
+  ::pasta::OMPMasterTaskLoopDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopDirectiveSnapshot &>(snapshot) = OMPLoopDirective::Snapshot();
+  snapshot.has_cancel = OMPMasterTaskLoopDirective::HasCancel();
+  return snapshot;
+}
+
+::pasta::OMPMasterTaskLoopSimdDirectiveSnapshot OMPMasterTaskLoopSimdDirective::Snapshot(void) const {
+  ::pasta::OMPMasterTaskLoopSimdDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopDirectiveSnapshot &>(snapshot) = OMPLoopDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPMetaDirectiveSnapshot OMPMetaDirective::Snapshot(void) const {
+  ::pasta::OMPMetaDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPExecutableDirectiveSnapshot &>(snapshot) = OMPExecutableDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPOrderedDirectiveSnapshot OMPOrderedDirective::Snapshot(void) const {
+  ::pasta::OMPOrderedDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPExecutableDirectiveSnapshot &>(snapshot) = OMPExecutableDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPParallelDirectiveSnapshot OMPParallelDirective::Snapshot(void) const {
+  ::pasta::OMPParallelDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPExecutableDirectiveSnapshot &>(snapshot) = OMPExecutableDirective::Snapshot();
+  snapshot.has_cancel = OMPParallelDirective::HasCancel();
+  return snapshot;
+}
+
+::pasta::OMPParallelForDirectiveSnapshot OMPParallelForDirective::Snapshot(void) const {
+  ::pasta::OMPParallelForDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopDirectiveSnapshot &>(snapshot) = OMPLoopDirective::Snapshot();
+  snapshot.has_cancel = OMPParallelForDirective::HasCancel();
+  return snapshot;
+}
+
+::pasta::OMPParallelForSimdDirectiveSnapshot OMPParallelForSimdDirective::Snapshot(void) const {
+  ::pasta::OMPParallelForSimdDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopDirectiveSnapshot &>(snapshot) = OMPLoopDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPParallelGenericLoopDirectiveSnapshot OMPParallelGenericLoopDirective::Snapshot(void) const {
+  ::pasta::OMPParallelGenericLoopDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopDirectiveSnapshot &>(snapshot) = OMPLoopDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPParallelMaskedDirectiveSnapshot OMPParallelMaskedDirective::Snapshot(void) const {
+  ::pasta::OMPParallelMaskedDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPExecutableDirectiveSnapshot &>(snapshot) = OMPExecutableDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPParallelMaskedTaskLoopDirectiveSnapshot OMPParallelMaskedTaskLoopDirective::Snapshot(void) const {
+  ::pasta::OMPParallelMaskedTaskLoopDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopDirectiveSnapshot &>(snapshot) = OMPLoopDirective::Snapshot();
+  snapshot.has_cancel = OMPParallelMaskedTaskLoopDirective::HasCancel();
+  return snapshot;
+}
+
+::pasta::OMPParallelMaskedTaskLoopSimdDirectiveSnapshot OMPParallelMaskedTaskLoopSimdDirective::Snapshot(void) const {
+  ::pasta::OMPParallelMaskedTaskLoopSimdDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopDirectiveSnapshot &>(snapshot) = OMPLoopDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPParallelMasterDirectiveSnapshot OMPParallelMasterDirective::Snapshot(void) const {
+  ::pasta::OMPParallelMasterDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPExecutableDirectiveSnapshot &>(snapshot) = OMPExecutableDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPParallelMasterTaskLoopDirectiveSnapshot OMPParallelMasterTaskLoopDirective::Snapshot(void) const {
+  ::pasta::OMPParallelMasterTaskLoopDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopDirectiveSnapshot &>(snapshot) = OMPLoopDirective::Snapshot();
+  snapshot.has_cancel = OMPParallelMasterTaskLoopDirective::HasCancel();
+  return snapshot;
+}
+
+::pasta::OMPParallelMasterTaskLoopSimdDirectiveSnapshot OMPParallelMasterTaskLoopSimdDirective::Snapshot(void) const {
+  ::pasta::OMPParallelMasterTaskLoopSimdDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopDirectiveSnapshot &>(snapshot) = OMPLoopDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPParallelSectionsDirectiveSnapshot OMPParallelSectionsDirective::Snapshot(void) const {
+  ::pasta::OMPParallelSectionsDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPExecutableDirectiveSnapshot &>(snapshot) = OMPExecutableDirective::Snapshot();
+  snapshot.has_cancel = OMPParallelSectionsDirective::HasCancel();
+  return snapshot;
+}
+
+::pasta::OMPScanDirectiveSnapshot OMPScanDirective::Snapshot(void) const {
+  ::pasta::OMPScanDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPExecutableDirectiveSnapshot &>(snapshot) = OMPExecutableDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPSectionDirectiveSnapshot OMPSectionDirective::Snapshot(void) const {
+  ::pasta::OMPSectionDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPExecutableDirectiveSnapshot &>(snapshot) = OMPExecutableDirective::Snapshot();
+  snapshot.has_cancel = OMPSectionDirective::HasCancel();
+  return snapshot;
+}
+
+::pasta::OMPSectionsDirectiveSnapshot OMPSectionsDirective::Snapshot(void) const {
+  ::pasta::OMPSectionsDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPExecutableDirectiveSnapshot &>(snapshot) = OMPExecutableDirective::Snapshot();
+  snapshot.has_cancel = OMPSectionsDirective::HasCancel();
+  return snapshot;
+}
+
+::pasta::OMPSimdDirectiveSnapshot OMPSimdDirective::Snapshot(void) const {
+  ::pasta::OMPSimdDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopDirectiveSnapshot &>(snapshot) = OMPLoopDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPSingleDirectiveSnapshot OMPSingleDirective::Snapshot(void) const {
+  ::pasta::OMPSingleDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPExecutableDirectiveSnapshot &>(snapshot) = OMPExecutableDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPTargetDataDirectiveSnapshot OMPTargetDataDirective::Snapshot(void) const {
+  ::pasta::OMPTargetDataDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPExecutableDirectiveSnapshot &>(snapshot) = OMPExecutableDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPTargetDirectiveSnapshot OMPTargetDirective::Snapshot(void) const {
+  ::pasta::OMPTargetDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPExecutableDirectiveSnapshot &>(snapshot) = OMPExecutableDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPTargetEnterDataDirectiveSnapshot OMPTargetEnterDataDirective::Snapshot(void) const {
+  ::pasta::OMPTargetEnterDataDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPExecutableDirectiveSnapshot &>(snapshot) = OMPExecutableDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPTargetExitDataDirectiveSnapshot OMPTargetExitDataDirective::Snapshot(void) const {
+  ::pasta::OMPTargetExitDataDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPExecutableDirectiveSnapshot &>(snapshot) = OMPExecutableDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPTargetParallelDirectiveSnapshot OMPTargetParallelDirective::Snapshot(void) const {
+  ::pasta::OMPTargetParallelDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPExecutableDirectiveSnapshot &>(snapshot) = OMPExecutableDirective::Snapshot();
+  snapshot.has_cancel = OMPTargetParallelDirective::HasCancel();
+  return snapshot;
+}
+
+::pasta::OMPTargetParallelForDirectiveSnapshot OMPTargetParallelForDirective::Snapshot(void) const {
+  ::pasta::OMPTargetParallelForDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopDirectiveSnapshot &>(snapshot) = OMPLoopDirective::Snapshot();
+  snapshot.has_cancel = OMPTargetParallelForDirective::HasCancel();
+  return snapshot;
+}
+
+::pasta::OMPTargetParallelForSimdDirectiveSnapshot OMPTargetParallelForSimdDirective::Snapshot(void) const {
+  ::pasta::OMPTargetParallelForSimdDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopDirectiveSnapshot &>(snapshot) = OMPLoopDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPTargetParallelGenericLoopDirectiveSnapshot OMPTargetParallelGenericLoopDirective::Snapshot(void) const {
+  ::pasta::OMPTargetParallelGenericLoopDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopDirectiveSnapshot &>(snapshot) = OMPLoopDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPTargetSimdDirectiveSnapshot OMPTargetSimdDirective::Snapshot(void) const {
+  ::pasta::OMPTargetSimdDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopDirectiveSnapshot &>(snapshot) = OMPLoopDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPTargetTeamsDirectiveSnapshot OMPTargetTeamsDirective::Snapshot(void) const {
+  ::pasta::OMPTargetTeamsDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPExecutableDirectiveSnapshot &>(snapshot) = OMPExecutableDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPTargetTeamsDistributeDirectiveSnapshot OMPTargetTeamsDistributeDirective::Snapshot(void) const {
+  ::pasta::OMPTargetTeamsDistributeDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopDirectiveSnapshot &>(snapshot) = OMPLoopDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPTargetTeamsDistributeParallelForDirectiveSnapshot OMPTargetTeamsDistributeParallelForDirective::Snapshot(void) const {
+  ::pasta::OMPTargetTeamsDistributeParallelForDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopDirectiveSnapshot &>(snapshot) = OMPLoopDirective::Snapshot();
+  snapshot.has_cancel = OMPTargetTeamsDistributeParallelForDirective::HasCancel();
+  return snapshot;
+}
+
+::pasta::OMPTargetTeamsDistributeParallelForSimdDirectiveSnapshot OMPTargetTeamsDistributeParallelForSimdDirective::Snapshot(void) const {
+  ::pasta::OMPTargetTeamsDistributeParallelForSimdDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopDirectiveSnapshot &>(snapshot) = OMPLoopDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPTargetTeamsDistributeSimdDirectiveSnapshot OMPTargetTeamsDistributeSimdDirective::Snapshot(void) const {
+  ::pasta::OMPTargetTeamsDistributeSimdDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopDirectiveSnapshot &>(snapshot) = OMPLoopDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPTargetTeamsGenericLoopDirectiveSnapshot OMPTargetTeamsGenericLoopDirective::Snapshot(void) const {
+  ::pasta::OMPTargetTeamsGenericLoopDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopDirectiveSnapshot &>(snapshot) = OMPLoopDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPTargetUpdateDirectiveSnapshot OMPTargetUpdateDirective::Snapshot(void) const {
+  ::pasta::OMPTargetUpdateDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPExecutableDirectiveSnapshot &>(snapshot) = OMPExecutableDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPTaskDirectiveSnapshot OMPTaskDirective::Snapshot(void) const {
+  ::pasta::OMPTaskDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPExecutableDirectiveSnapshot &>(snapshot) = OMPExecutableDirective::Snapshot();
+  snapshot.has_cancel = OMPTaskDirective::HasCancel();
+  return snapshot;
+}
+
+::pasta::OMPTaskLoopDirectiveSnapshot OMPTaskLoopDirective::Snapshot(void) const {
+  ::pasta::OMPTaskLoopDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopDirectiveSnapshot &>(snapshot) = OMPLoopDirective::Snapshot();
+  snapshot.has_cancel = OMPTaskLoopDirective::HasCancel();
+  return snapshot;
+}
+
+::pasta::OMPTaskLoopSimdDirectiveSnapshot OMPTaskLoopSimdDirective::Snapshot(void) const {
+  ::pasta::OMPTaskLoopSimdDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopDirectiveSnapshot &>(snapshot) = OMPLoopDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPTaskgroupDirectiveSnapshot OMPTaskgroupDirective::Snapshot(void) const {
+  ::pasta::OMPTaskgroupDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPExecutableDirectiveSnapshot &>(snapshot) = OMPExecutableDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPTaskwaitDirectiveSnapshot OMPTaskwaitDirective::Snapshot(void) const {
+  ::pasta::OMPTaskwaitDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPExecutableDirectiveSnapshot &>(snapshot) = OMPExecutableDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPTaskyieldDirectiveSnapshot OMPTaskyieldDirective::Snapshot(void) const {
+  ::pasta::OMPTaskyieldDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPExecutableDirectiveSnapshot &>(snapshot) = OMPExecutableDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPTeamsDirectiveSnapshot OMPTeamsDirective::Snapshot(void) const {
+  ::pasta::OMPTeamsDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPExecutableDirectiveSnapshot &>(snapshot) = OMPExecutableDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPTeamsDistributeDirectiveSnapshot OMPTeamsDistributeDirective::Snapshot(void) const {
+  ::pasta::OMPTeamsDistributeDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopDirectiveSnapshot &>(snapshot) = OMPLoopDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPTeamsDistributeParallelForDirectiveSnapshot OMPTeamsDistributeParallelForDirective::Snapshot(void) const {
+  ::pasta::OMPTeamsDistributeParallelForDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopDirectiveSnapshot &>(snapshot) = OMPLoopDirective::Snapshot();
+  snapshot.has_cancel = OMPTeamsDistributeParallelForDirective::HasCancel();
+  return snapshot;
+}
+
+::pasta::OMPTeamsDistributeParallelForSimdDirectiveSnapshot OMPTeamsDistributeParallelForSimdDirective::Snapshot(void) const {
+  ::pasta::OMPTeamsDistributeParallelForSimdDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopDirectiveSnapshot &>(snapshot) = OMPLoopDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPTeamsDistributeSimdDirectiveSnapshot OMPTeamsDistributeSimdDirective::Snapshot(void) const {
+  ::pasta::OMPTeamsDistributeSimdDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopDirectiveSnapshot &>(snapshot) = OMPLoopDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPTeamsGenericLoopDirectiveSnapshot OMPTeamsGenericLoopDirective::Snapshot(void) const {
+  ::pasta::OMPTeamsGenericLoopDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopDirectiveSnapshot &>(snapshot) = OMPLoopDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPTileDirectiveSnapshot OMPTileDirective::Snapshot(void) const {
+  ::pasta::OMPTileDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopTransformationDirectiveSnapshot &>(snapshot) = OMPLoopTransformationDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPUnrollDirectiveSnapshot OMPUnrollDirective::Snapshot(void) const {
+  ::pasta::OMPUnrollDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopTransformationDirectiveSnapshot &>(snapshot) = OMPLoopTransformationDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::ObjCArrayLiteralSnapshot ObjCArrayLiteral::Snapshot(void) const {
+  ::pasta::ObjCArrayLiteralSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.num_elements = ObjCArrayLiteral::NumElements();
+  return snapshot;
+}
+
+::pasta::ObjCAtCatchStmtSnapshot ObjCAtCatchStmt::Snapshot(void) const {
+  ::pasta::ObjCAtCatchStmtSnapshot snapshot;
+  static_cast<::pasta::StmtSnapshot &>(snapshot) = Stmt::Snapshot();
+  snapshot.at_catch_token = ast->TokenIndexAt(const_cast<clang::ObjCAtCatchStmt *>(u.ObjCAtCatchStmt)->getAtCatchLoc());
+  snapshot.r_paren_token = ast->TokenIndexAt(const_cast<clang::ObjCAtCatchStmt *>(u.ObjCAtCatchStmt)->getRParenLoc());
+  snapshot.has_ellipsis = ObjCAtCatchStmt::HasEllipsis();
+  return snapshot;
+}
+
+::pasta::ObjCAtFinallyStmtSnapshot ObjCAtFinallyStmt::Snapshot(void) const {
+  ::pasta::ObjCAtFinallyStmtSnapshot snapshot;
+  static_cast<::pasta::StmtSnapshot &>(snapshot) = Stmt::Snapshot();
+  snapshot.at_finally_token = ast->TokenIndexAt(const_cast<clang::ObjCAtFinallyStmt *>(u.ObjCAtFinallyStmt)->getAtFinallyLoc());
+  return snapshot;
+}
+
+::pasta::ObjCAtSynchronizedStmtSnapshot ObjCAtSynchronizedStmt::Snapshot(void) const {
+  ::pasta::ObjCAtSynchronizedStmtSnapshot snapshot;
+  static_cast<::pasta::StmtSnapshot &>(snapshot) = Stmt::Snapshot();
+  snapshot.at_synchronized_token = ast->TokenIndexAt(const_cast<clang::ObjCAtSynchronizedStmt *>(u.ObjCAtSynchronizedStmt)->getAtSynchronizedLoc());
+  return snapshot;
+}
+
+::pasta::ObjCAtThrowStmtSnapshot ObjCAtThrowStmt::Snapshot(void) const {
+  ::pasta::ObjCAtThrowStmtSnapshot snapshot;
+  static_cast<::pasta::StmtSnapshot &>(snapshot) = Stmt::Snapshot();
+  snapshot.throw_token = ast->TokenIndexAt(const_cast<clang::ObjCAtThrowStmt *>(u.ObjCAtThrowStmt)->getThrowLoc());
+  return snapshot;
+}
+
+::pasta::ObjCAtTryStmtSnapshot ObjCAtTryStmt::Snapshot(void) const {
+  ::pasta::ObjCAtTryStmtSnapshot snapshot;
+  static_cast<::pasta::StmtSnapshot &>(snapshot) = Stmt::Snapshot();
+  snapshot.at_try_token = ast->TokenIndexAt(const_cast<clang::ObjCAtTryStmt *>(u.ObjCAtTryStmt)->getAtTryLoc());
+  snapshot.num_catch_statements = ObjCAtTryStmt::NumCatchStatements();
+  return snapshot;
+}
+
+::pasta::ObjCAutoreleasePoolStmtSnapshot ObjCAutoreleasePoolStmt::Snapshot(void) const {
+  ::pasta::ObjCAutoreleasePoolStmtSnapshot snapshot;
+  static_cast<::pasta::StmtSnapshot &>(snapshot) = Stmt::Snapshot();
+  snapshot.at_token = ast->TokenIndexAt(const_cast<clang::ObjCAutoreleasePoolStmt *>(u.ObjCAutoreleasePoolStmt)->getAtLoc());
+  return snapshot;
+}
+
+::pasta::ObjCAvailabilityCheckExprSnapshot ObjCAvailabilityCheckExpr::Snapshot(void) const {
+  ::pasta::ObjCAvailabilityCheckExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.has_version = ObjCAvailabilityCheckExpr::HasVersion();
+  return snapshot;
+}
+
+::pasta::ObjCBoolLiteralExprSnapshot ObjCBoolLiteralExpr::Snapshot(void) const {
+  ::pasta::ObjCBoolLiteralExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.token = ast->TokenIndexAt(const_cast<clang::ObjCBoolLiteralExpr *>(u.ObjCBoolLiteralExpr)->getLocation());
+  snapshot.value = ObjCBoolLiteralExpr::Value();
+  return snapshot;
+}
+
+::pasta::ObjCBoxedExprSnapshot ObjCBoxedExpr::Snapshot(void) const {
+  ::pasta::ObjCBoxedExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.at_token = ast->TokenIndexAt(const_cast<clang::ObjCBoxedExpr *>(u.ObjCBoxedExpr)->getAtLoc());
+  snapshot.is_expressible_as_constant_initializer = ObjCBoxedExpr::IsExpressibleAsConstantInitializer();
+  return snapshot;
+}
+
+::pasta::ObjCDictionaryLiteralSnapshot ObjCDictionaryLiteral::Snapshot(void) const {
+  ::pasta::ObjCDictionaryLiteralSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.num_elements = ObjCDictionaryLiteral::NumElements();
+  return snapshot;
+}
+
+::pasta::ObjCEncodeExprSnapshot ObjCEncodeExpr::Snapshot(void) const {
+  ::pasta::ObjCEncodeExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.at_token = ast->TokenIndexAt(const_cast<clang::ObjCEncodeExpr *>(u.ObjCEncodeExpr)->getAtLoc());
+  snapshot.r_paren_token = ast->TokenIndexAt(const_cast<clang::ObjCEncodeExpr *>(u.ObjCEncodeExpr)->getRParenLoc());
+  return snapshot;
+}
+
+::pasta::ObjCForCollectionStmtSnapshot ObjCForCollectionStmt::Snapshot(void) const {
+  ::pasta::ObjCForCollectionStmtSnapshot snapshot;
+  static_cast<::pasta::StmtSnapshot &>(snapshot) = Stmt::Snapshot();
+  snapshot.for_token = ast->TokenIndexAt(const_cast<clang::ObjCForCollectionStmt *>(u.ObjCForCollectionStmt)->getForLoc());
+  snapshot.r_paren_token = ast->TokenIndexAt(const_cast<clang::ObjCForCollectionStmt *>(u.ObjCForCollectionStmt)->getRParenLoc());
+  return snapshot;
+}
+
+::pasta::ObjCIndirectCopyRestoreExprSnapshot ObjCIndirectCopyRestoreExpr::Snapshot(void) const {
+  ::pasta::ObjCIndirectCopyRestoreExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.should_copy = ObjCIndirectCopyRestoreExpr::ShouldCopy();
+  return snapshot;
+}
+
+::pasta::ObjCIsaExprSnapshot ObjCIsaExpr::Snapshot(void) const {
+  ::pasta::ObjCIsaExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.base_token_end = ast->TokenIndexAt(const_cast<clang::ObjCIsaExpr *>(u.ObjCIsaExpr)->getBaseLocEnd());
+  snapshot.isa_member_token = ast->TokenIndexAt(const_cast<clang::ObjCIsaExpr *>(u.ObjCIsaExpr)->getIsaMemberLoc());
+  snapshot.operation_token = ast->TokenIndexAt(const_cast<clang::ObjCIsaExpr *>(u.ObjCIsaExpr)->getOpLoc());
+  snapshot.is_arrow = ObjCIsaExpr::IsArrow();
+  return snapshot;
+}
+
+::pasta::ObjCIvarRefExprSnapshot ObjCIvarRefExpr::Snapshot(void) const {
+  ::pasta::ObjCIvarRefExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.token = ast->TokenIndexAt(const_cast<clang::ObjCIvarRefExpr *>(u.ObjCIvarRefExpr)->getLocation());
+  snapshot.operation_token = ast->TokenIndexAt(const_cast<clang::ObjCIvarRefExpr *>(u.ObjCIvarRefExpr)->getOpLoc());
+  snapshot.is_arrow = ObjCIvarRefExpr::IsArrow();
+  snapshot.is_free_instance_variable = ObjCIvarRefExpr::IsFreeInstanceVariable();
+  return snapshot;
+}
+
+::pasta::ObjCMessageExprSnapshot ObjCMessageExpr::Snapshot(void) const {
+  ::pasta::ObjCMessageExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.left_token = ast->TokenIndexAt(const_cast<clang::ObjCMessageExpr *>(u.ObjCMessageExpr)->getLeftLoc());
+  snapshot.method_family = ObjCMessageExpr::MethodFamily();
+  snapshot.num_arguments = ObjCMessageExpr::NumArguments();
+  snapshot.num_selector_tokens = ObjCMessageExpr::NumSelectorTokens();
+  snapshot.receiver_kind = ObjCMessageExpr::ReceiverKind();
+  snapshot.right_token = ast->TokenIndexAt(const_cast<clang::ObjCMessageExpr *>(u.ObjCMessageExpr)->getRightLoc());
+  snapshot.selector_start_token = ast->TokenIndexAt(const_cast<clang::ObjCMessageExpr *>(u.ObjCMessageExpr)->getSelectorStartLoc());
+  snapshot.super_token = ast->TokenIndexAt(const_cast<clang::ObjCMessageExpr *>(u.ObjCMessageExpr)->getSuperLoc());
+  snapshot.is_class_message = ObjCMessageExpr::IsClassMessage();
+  snapshot.is_delegate_initializer_call = ObjCMessageExpr::IsDelegateInitializerCall();
+  snapshot.is_implicit = ObjCMessageExpr::IsImplicit();
+  snapshot.is_instance_message = ObjCMessageExpr::IsInstanceMessage();
+  return snapshot;
+}
+
+::pasta::ObjCPropertyRefExprSnapshot ObjCPropertyRefExpr::Snapshot(void) const {
+  ::pasta::ObjCPropertyRefExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.token = ast->TokenIndexAt(const_cast<clang::ObjCPropertyRefExpr *>(u.ObjCPropertyRefExpr)->getLocation());
+  snapshot.receiver_token = ast->TokenIndexAt(const_cast<clang::ObjCPropertyRefExpr *>(u.ObjCPropertyRefExpr)->getReceiverLocation());
+  snapshot.is_class_receiver = ObjCPropertyRefExpr::IsClassReceiver();
+  snapshot.is_explicit_property = ObjCPropertyRefExpr::IsExplicitProperty();
+  snapshot.is_implicit_property = ObjCPropertyRefExpr::IsImplicitProperty();
+  snapshot.is_messaging_getter = ObjCPropertyRefExpr::IsMessagingGetter();
+  snapshot.is_messaging_setter = ObjCPropertyRefExpr::IsMessagingSetter();
+  snapshot.is_object_receiver = ObjCPropertyRefExpr::IsObjectReceiver();
+  snapshot.is_super_receiver = ObjCPropertyRefExpr::IsSuperReceiver();
+  return snapshot;
+}
+
+::pasta::ObjCProtocolExprSnapshot ObjCProtocolExpr::Snapshot(void) const {
+  ::pasta::ObjCProtocolExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.at_token = ast->TokenIndexAt(const_cast<clang::ObjCProtocolExpr *>(u.ObjCProtocolExpr)->getAtLoc());
+  snapshot.protocol_id_token = ast->TokenIndexAt(const_cast<clang::ObjCProtocolExpr *>(u.ObjCProtocolExpr)->getProtocolIdLoc());
+  snapshot.r_paren_token = ast->TokenIndexAt(const_cast<clang::ObjCProtocolExpr *>(u.ObjCProtocolExpr)->getRParenLoc());
+  return snapshot;
+}
+
+::pasta::ObjCSelectorExprSnapshot ObjCSelectorExpr::Snapshot(void) const {
+  ::pasta::ObjCSelectorExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.at_token = ast->TokenIndexAt(const_cast<clang::ObjCSelectorExpr *>(u.ObjCSelectorExpr)->getAtLoc());
+  snapshot.num_arguments = ObjCSelectorExpr::NumArguments();
+  snapshot.r_paren_token = ast->TokenIndexAt(const_cast<clang::ObjCSelectorExpr *>(u.ObjCSelectorExpr)->getRParenLoc());
+  return snapshot;
+}
+
+::pasta::ObjCStringLiteralSnapshot ObjCStringLiteral::Snapshot(void) const {
+  ::pasta::ObjCStringLiteralSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.at_token = ast->TokenIndexAt(const_cast<clang::ObjCStringLiteral *>(u.ObjCStringLiteral)->getAtLoc());
+  return snapshot;
+}
+
+::pasta::ObjCSubscriptRefExprSnapshot ObjCSubscriptRefExpr::Snapshot(void) const {
+  ::pasta::ObjCSubscriptRefExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.r_bracket_token = ast->TokenIndexAt(const_cast<clang::ObjCSubscriptRefExpr *>(u.ObjCSubscriptRefExpr)->getRBracket());
+  snapshot.is_array_subscript_reference_expression = ObjCSubscriptRefExpr::IsArraySubscriptReferenceExpression();
+  return snapshot;
+}
+
+::pasta::OffsetOfExprSnapshot OffsetOfExpr::Snapshot(void) const {
+  ::pasta::OffsetOfExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.num_components = OffsetOfExpr::NumComponents();
+  snapshot.num_expressions = OffsetOfExpr::NumExpressions();
+  snapshot.operator_token = ast->TokenIndexAt(const_cast<clang::OffsetOfExpr *>(u.OffsetOfExpr)->getOperatorLoc());
+  snapshot.r_paren_token = ast->TokenIndexAt(const_cast<clang::OffsetOfExpr *>(u.OffsetOfExpr)->getRParenLoc());
+  return snapshot;
+}
+
+::pasta::OpaqueValueExprSnapshot OpaqueValueExpr::Snapshot(void) const {
+  ::pasta::OpaqueValueExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.token = ast->TokenIndexAt(const_cast<clang::OpaqueValueExpr *>(u.OpaqueValueExpr)->getLocation());
+  snapshot.is_unique = OpaqueValueExpr::IsUnique();
+  return snapshot;
+}
+
+::pasta::OverloadExprSnapshot OverloadExpr::Snapshot(void) const {
+  ::pasta::OverloadExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.l_angle_token = ast->TokenIndexAt(const_cast<clang::OverloadExpr *>(u.OverloadExpr)->getLAngleLoc());
+  snapshot.name_token = ast->TokenIndexAt(const_cast<clang::OverloadExpr *>(u.OverloadExpr)->getNameLoc());
+  snapshot.num_declarations = OverloadExpr::NumDeclarations();
+  snapshot.num_template_arguments = OverloadExpr::NumTemplateArguments();
+  snapshot.r_angle_token = ast->TokenIndexAt(const_cast<clang::OverloadExpr *>(u.OverloadExpr)->getRAngleLoc());
+  snapshot.template_keyword_token = ast->TokenIndexAt(const_cast<clang::OverloadExpr *>(u.OverloadExpr)->getTemplateKeywordLoc());
+  snapshot.has_explicit_template_arguments = OverloadExpr::HasExplicitTemplateArguments();
+  snapshot.has_template_keyword = OverloadExpr::HasTemplateKeyword();
+  return snapshot;
+}
+
+::pasta::PackExpansionExprSnapshot PackExpansionExpr::Snapshot(void) const {
+  ::pasta::PackExpansionExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.ellipsis_token = ast->TokenIndexAt(const_cast<clang::PackExpansionExpr *>(u.PackExpansionExpr)->getEllipsisLoc());
+  return snapshot;
+}
+
+::pasta::ParenExprSnapshot ParenExpr::Snapshot(void) const {
+  ::pasta::ParenExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.l_paren_token = ast->TokenIndexAt(const_cast<clang::ParenExpr *>(u.ParenExpr)->getLParen());
+  snapshot.r_paren_token = ast->TokenIndexAt(const_cast<clang::ParenExpr *>(u.ParenExpr)->getRParen());
+  return snapshot;
+}
+
+::pasta::ParenListExprSnapshot ParenListExpr::Snapshot(void) const {
+  ::pasta::ParenListExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.l_paren_token = ast->TokenIndexAt(const_cast<clang::ParenListExpr *>(u.ParenListExpr)->getLParenLoc());
+  snapshot.num_expressions = ParenListExpr::NumExpressions();
+  snapshot.r_paren_token = ast->TokenIndexAt(const_cast<clang::ParenListExpr *>(u.ParenListExpr)->getRParenLoc());
+  return snapshot;
+}
+
+::pasta::PredefinedExprSnapshot PredefinedExpr::Snapshot(void) const {
+  ::pasta::PredefinedExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.identifier_kind = PredefinedExpr::IdentifierKind();
+  snapshot.token = ast->TokenIndexAt(const_cast<clang::PredefinedExpr *>(u.PredefinedExpr)->getLocation());
+  snapshot.is_transparent = PredefinedExpr::IsTransparent();
+  return snapshot;
+}
+
+::pasta::PseudoObjectExprSnapshot PseudoObjectExpr::Snapshot(void) const {
+  ::pasta::PseudoObjectExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.num_semantic_expressions = PseudoObjectExpr::NumSemanticExpressions();
+  snapshot.result_expression_index = PseudoObjectExpr::ResultExpressionIndex();
+  return snapshot;
+}
+
+::pasta::RecoveryExprSnapshot RecoveryExpr::Snapshot(void) const {
+  ::pasta::RecoveryExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  return snapshot;
+}
+
+::pasta::RequiresExprSnapshot RequiresExpr::Snapshot(void) const {
+  ::pasta::RequiresExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.r_brace_token = ast->TokenIndexAt(const_cast<clang::RequiresExpr *>(u.RequiresExpr)->getRBraceLoc());
+  snapshot.requires_keyword_token = ast->TokenIndexAt(const_cast<clang::RequiresExpr *>(u.RequiresExpr)->getRequiresKWLoc());
+  if (const auto &self = *(u.RequiresExpr); !self.isValueDependent()) {
+    snapshot.is_satisfied = RequiresExpr::IsSatisfied();
+  }
+  return snapshot;
+}
+
+::pasta::ReturnStmtSnapshot ReturnStmt::Snapshot(void) const {
+  ::pasta::ReturnStmtSnapshot snapshot;
+  static_cast<::pasta::StmtSnapshot &>(snapshot) = Stmt::Snapshot();
+  snapshot.return_token = ast->TokenIndexAt(const_cast<clang::ReturnStmt *>(u.ReturnStmt)->getReturnLoc());
+  return snapshot;
+}
+
+::pasta::SEHExceptStmtSnapshot SEHExceptStmt::Snapshot(void) const {
+  ::pasta::SEHExceptStmtSnapshot snapshot;
+  static_cast<::pasta::StmtSnapshot &>(snapshot) = Stmt::Snapshot();
+  snapshot.except_token = ast->TokenIndexAt(const_cast<clang::SEHExceptStmt *>(u.SEHExceptStmt)->getExceptLoc());
+  return snapshot;
+}
+
+::pasta::SEHFinallyStmtSnapshot SEHFinallyStmt::Snapshot(void) const {
+  ::pasta::SEHFinallyStmtSnapshot snapshot;
+  static_cast<::pasta::StmtSnapshot &>(snapshot) = Stmt::Snapshot();
+  snapshot.finally_token = ast->TokenIndexAt(const_cast<clang::SEHFinallyStmt *>(u.SEHFinallyStmt)->getFinallyLoc());
+  return snapshot;
+}
+
+::pasta::SEHLeaveStmtSnapshot SEHLeaveStmt::Snapshot(void) const {
+  ::pasta::SEHLeaveStmtSnapshot snapshot;
+  static_cast<::pasta::StmtSnapshot &>(snapshot) = Stmt::Snapshot();
+  snapshot.leave_token = ast->TokenIndexAt(const_cast<clang::SEHLeaveStmt *>(u.SEHLeaveStmt)->getLeaveLoc());
+  return snapshot;
+}
+
+::pasta::SEHTryStmtSnapshot SEHTryStmt::Snapshot(void) const {
+  ::pasta::SEHTryStmtSnapshot snapshot;
+  static_cast<::pasta::StmtSnapshot &>(snapshot) = Stmt::Snapshot();
+  snapshot.is_cxx_try = SEHTryStmt::IsCXXTry();
+  snapshot.try_token = ast->TokenIndexAt(const_cast<clang::SEHTryStmt *>(u.SEHTryStmt)->getTryLoc());
+  return snapshot;
+}
+
+::pasta::SYCLUniqueStableNameExprSnapshot SYCLUniqueStableNameExpr::Snapshot(void) const {
+  ::pasta::SYCLUniqueStableNameExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.l_paren_token = ast->TokenIndexAt(const_cast<clang::SYCLUniqueStableNameExpr *>(u.SYCLUniqueStableNameExpr)->getLParenLocation());
+  snapshot.token = ast->TokenIndexAt(const_cast<clang::SYCLUniqueStableNameExpr *>(u.SYCLUniqueStableNameExpr)->getLocation());
+  snapshot.r_paren_token = ast->TokenIndexAt(const_cast<clang::SYCLUniqueStableNameExpr *>(u.SYCLUniqueStableNameExpr)->getRParenLocation());
+  return snapshot;
+}
+
+::pasta::ShuffleVectorExprSnapshot ShuffleVectorExpr::Snapshot(void) const {
+  ::pasta::ShuffleVectorExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.builtin_token = ast->TokenIndexAt(const_cast<clang::ShuffleVectorExpr *>(u.ShuffleVectorExpr)->getBuiltinLoc());
+  snapshot.num_sub_expressions = ShuffleVectorExpr::NumSubExpressions();
+  snapshot.r_paren_token = ast->TokenIndexAt(const_cast<clang::ShuffleVectorExpr *>(u.ShuffleVectorExpr)->getRParenLoc());
+  return snapshot;
+}
+
+::pasta::SizeOfPackExprSnapshot SizeOfPackExpr::Snapshot(void) const {
+  ::pasta::SizeOfPackExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.operator_token = ast->TokenIndexAt(const_cast<clang::SizeOfPackExpr *>(u.SizeOfPackExpr)->getOperatorLoc());
+  snapshot.pack_token = ast->TokenIndexAt(const_cast<clang::SizeOfPackExpr *>(u.SizeOfPackExpr)->getPackLoc());
+  snapshot.r_paren_token = ast->TokenIndexAt(const_cast<clang::SizeOfPackExpr *>(u.SizeOfPackExpr)->getRParenLoc());
+  snapshot.is_partially_substituted = SizeOfPackExpr::IsPartiallySubstituted();
+  return snapshot;
+}
+
+::pasta::SourceLocExprSnapshot SourceLocExpr::Snapshot(void) const {
+  ::pasta::SourceLocExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.identifier_kind = SourceLocExpr::IdentifierKind();
+  snapshot.token = ast->TokenIndexAt(const_cast<clang::SourceLocExpr *>(u.SourceLocExpr)->getLocation());
+  snapshot.is_int_type = SourceLocExpr::IsIntType();
+  return snapshot;
+}
+
+::pasta::StmtExprSnapshot StmtExpr::Snapshot(void) const {
+  ::pasta::StmtExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.l_paren_token = ast->TokenIndexAt(const_cast<clang::StmtExpr *>(u.StmtExpr)->getLParenLoc());
+  snapshot.r_paren_token = ast->TokenIndexAt(const_cast<clang::StmtExpr *>(u.StmtExpr)->getRParenLoc());
+  snapshot.template_depth = StmtExpr::TemplateDepth();
+  return snapshot;
+}
+
+::pasta::StringLiteralSnapshot StringLiteral::Snapshot(void) const {
+  ::pasta::StringLiteralSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.byte_length = StringLiteral::ByteLength();
+  snapshot.character_byte_width = StringLiteral::CharacterByteWidth();
+  snapshot.literal_kind = StringLiteral::LiteralKind();
+  snapshot.length = StringLiteral::Length();
+  snapshot.num_concatenated = StringLiteral::NumConcatenated();
+  snapshot.is_ordinary = StringLiteral::IsOrdinary();
+  snapshot.is_pascal = StringLiteral::IsPascal();
+  snapshot.is_utf16 = StringLiteral::IsUTF16();
+  snapshot.is_utf32 = StringLiteral::IsUTF32();
+  snapshot.is_utf8 = StringLiteral::IsUTF8();
+  snapshot.is_unevaluated = StringLiteral::IsUnevaluated();
+  snapshot.is_wide = StringLiteral::IsWide();
+  return snapshot;
+}
+
+::pasta::SubstNonTypeTemplateParmExprSnapshot SubstNonTypeTemplateParmExpr::Snapshot(void) const {
+  ::pasta::SubstNonTypeTemplateParmExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.index = SubstNonTypeTemplateParmExpr::Index();
+  snapshot.name_token = ast->TokenIndexAt(const_cast<clang::SubstNonTypeTemplateParmExpr *>(u.SubstNonTypeTemplateParmExpr)->getNameLoc());
+  snapshot.is_reference_parameter = SubstNonTypeTemplateParmExpr::IsReferenceParameter();
+  return snapshot;
+}
+
+::pasta::SubstNonTypeTemplateParmPackExprSnapshot SubstNonTypeTemplateParmPackExpr::Snapshot(void) const {
+  ::pasta::SubstNonTypeTemplateParmPackExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.index = SubstNonTypeTemplateParmPackExpr::Index();
+  snapshot.parameter_pack_token = ast->TokenIndexAt(const_cast<clang::SubstNonTypeTemplateParmPackExpr *>(u.SubstNonTypeTemplateParmPackExpr)->getParameterPackLocation());
+  return snapshot;
+}
+
+::pasta::TypeTraitExprSnapshot TypeTraitExpr::Snapshot(void) const {
+  ::pasta::TypeTraitExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.num_arguments = TypeTraitExpr::NumArguments();
+  snapshot.trait = TypeTraitExpr::Trait();
+  return snapshot;
+}
+
+::pasta::TypoExprSnapshot TypoExpr::Snapshot(void) const {
+  ::pasta::TypoExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  return snapshot;
+}
+
+::pasta::UnaryExprOrTypeTraitExprSnapshot UnaryExprOrTypeTraitExpr::Snapshot(void) const {
+  ::pasta::UnaryExprOrTypeTraitExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.keyword_kind = UnaryExprOrTypeTraitExpr::KeywordKind();
+  snapshot.operator_token = ast->TokenIndexAt(const_cast<clang::UnaryExprOrTypeTraitExpr *>(u.UnaryExprOrTypeTraitExpr)->getOperatorLoc());
+  snapshot.r_paren_token = ast->TokenIndexAt(const_cast<clang::UnaryExprOrTypeTraitExpr *>(u.UnaryExprOrTypeTraitExpr)->getRParenLoc());
+  snapshot.is_argument_type = UnaryExprOrTypeTraitExpr::IsArgumentType();
+  return snapshot;
+}
+
+::pasta::UnaryOperatorSnapshot UnaryOperator::Snapshot(void) const {
+  ::pasta::UnaryOperatorSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.can_overflow = UnaryOperator::CanOverflow();
+  snapshot.opcode = UnaryOperator::Opcode();
+  snapshot.operator_token = ast->TokenIndexAt(const_cast<clang::UnaryOperator *>(u.UnaryOperator)->getOperatorLoc());
+  snapshot.has_stored_fp_features = UnaryOperator::HasStoredFPFeatures();
+  snapshot.is_arithmetic_operation = UnaryOperator::IsArithmeticOperation();
+  snapshot.is_decrement_operation = UnaryOperator::IsDecrementOperation();
+  snapshot.is_increment_decrement_operation = UnaryOperator::IsIncrementDecrementOperation();
+  snapshot.is_increment_operation = UnaryOperator::IsIncrementOperation();
+  snapshot.is_postfix = UnaryOperator::IsPostfix();
+  snapshot.is_prefix = UnaryOperator::IsPrefix();
+  return snapshot;
+}
+
+::pasta::UnresolvedLookupExprSnapshot UnresolvedLookupExpr::Snapshot(void) const {
+  ::pasta::UnresolvedLookupExprSnapshot snapshot;
+  static_cast<::pasta::OverloadExprSnapshot &>(snapshot) = OverloadExpr::Snapshot();
+  snapshot.is_overloaded = UnresolvedLookupExpr::IsOverloaded();
+  snapshot.requires_adl = UnresolvedLookupExpr::RequiresADL();
+  return snapshot;
+}
+
+::pasta::UnresolvedMemberExprSnapshot UnresolvedMemberExpr::Snapshot(void) const {
+  ::pasta::UnresolvedMemberExprSnapshot snapshot;
+  static_cast<::pasta::OverloadExprSnapshot &>(snapshot) = OverloadExpr::Snapshot();
+  snapshot.member_token = ast->TokenIndexAt(const_cast<clang::UnresolvedMemberExpr *>(u.UnresolvedMemberExpr)->getMemberLoc());
+  snapshot.operator_token = ast->TokenIndexAt(const_cast<clang::UnresolvedMemberExpr *>(u.UnresolvedMemberExpr)->getOperatorLoc());
+  snapshot.has_unresolved_using = UnresolvedMemberExpr::HasUnresolvedUsing();
+  snapshot.is_arrow = UnresolvedMemberExpr::IsArrow();
+  snapshot.is_implicit_access = UnresolvedMemberExpr::IsImplicitAccess();
+  return snapshot;
+}
+
+::pasta::VAArgExprSnapshot VAArgExpr::Snapshot(void) const {
+  ::pasta::VAArgExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.builtin_token = ast->TokenIndexAt(const_cast<clang::VAArgExpr *>(u.VAArgExpr)->getBuiltinLoc());
+  snapshot.r_paren_token = ast->TokenIndexAt(const_cast<clang::VAArgExpr *>(u.VAArgExpr)->getRParenLoc());
+  snapshot.is_microsoft_abi = VAArgExpr::IsMicrosoftABI();
+  return snapshot;
+}
+
+::pasta::AbstractConditionalOperatorSnapshot AbstractConditionalOperator::Snapshot(void) const {
+  ::pasta::AbstractConditionalOperatorSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.colon_token = ast->TokenIndexAt(const_cast<clang::AbstractConditionalOperator *>(u.AbstractConditionalOperator)->getColonLoc());
+  snapshot.question_token = ast->TokenIndexAt(const_cast<clang::AbstractConditionalOperator *>(u.AbstractConditionalOperator)->getQuestionLoc());
+  return snapshot;
+}
+
+::pasta::AddrLabelExprSnapshot AddrLabelExpr::Snapshot(void) const {
+  ::pasta::AddrLabelExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.amp_amp_token = ast->TokenIndexAt(const_cast<clang::AddrLabelExpr *>(u.AddrLabelExpr)->getAmpAmpLoc());
+  snapshot.label_token = ast->TokenIndexAt(const_cast<clang::AddrLabelExpr *>(u.AddrLabelExpr)->getLabelLoc());
+  return snapshot;
+}
+
+::pasta::ArrayInitIndexExprSnapshot ArrayInitIndexExpr::Snapshot(void) const {
+  ::pasta::ArrayInitIndexExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  return snapshot;
+}
+
+::pasta::ArrayInitLoopExprSnapshot ArrayInitLoopExpr::Snapshot(void) const {
+  ::pasta::ArrayInitLoopExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  return snapshot;
+}
+
+::pasta::ArraySubscriptExprSnapshot ArraySubscriptExpr::Snapshot(void) const {
+  ::pasta::ArraySubscriptExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.r_bracket_token = ast->TokenIndexAt(const_cast<clang::ArraySubscriptExpr *>(u.ArraySubscriptExpr)->getRBracketLoc());
+  return snapshot;
+}
+
+::pasta::ArrayTypeTraitExprSnapshot ArrayTypeTraitExpr::Snapshot(void) const {
+  ::pasta::ArrayTypeTraitExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.trait = ArrayTypeTraitExpr::Trait();
+  snapshot.value = ArrayTypeTraitExpr::Value();
+  return snapshot;
+}
+
+::pasta::AsTypeExprSnapshot AsTypeExpr::Snapshot(void) const {
+  ::pasta::AsTypeExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.builtin_token = ast->TokenIndexAt(const_cast<clang::AsTypeExpr *>(u.AsTypeExpr)->getBuiltinLoc());
+  snapshot.r_paren_token = ast->TokenIndexAt(const_cast<clang::AsTypeExpr *>(u.AsTypeExpr)->getRParenLoc());
+  return snapshot;
+}
+
+::pasta::AtomicExprSnapshot AtomicExpr::Snapshot(void) const {
+  ::pasta::AtomicExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.builtin_token = ast->TokenIndexAt(const_cast<clang::AtomicExpr *>(u.AtomicExpr)->getBuiltinLoc());
+  snapshot.num_sub_expressions = AtomicExpr::NumSubExpressions();
+  snapshot.operation = AtomicExpr::Operation();
+  snapshot.r_paren_token = ast->TokenIndexAt(const_cast<clang::AtomicExpr *>(u.AtomicExpr)->getRParenLoc());
+  snapshot.is_cmp_x_chg = AtomicExpr::IsCmpXChg();
+  snapshot.is_open_cl = AtomicExpr::IsOpenCL();
+  snapshot.is_volatile = AtomicExpr::IsVolatile();
+  return snapshot;
+}
+
+::pasta::BinaryConditionalOperatorSnapshot BinaryConditionalOperator::Snapshot(void) const {
+  ::pasta::BinaryConditionalOperatorSnapshot snapshot;
+  static_cast<::pasta::AbstractConditionalOperatorSnapshot &>(snapshot) = AbstractConditionalOperator::Snapshot();
+  return snapshot;
+}
+
+::pasta::BinaryOperatorSnapshot BinaryOperator::Snapshot(void) const {
+  ::pasta::BinaryOperatorSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.opcode = BinaryOperator::Opcode();
+  snapshot.operator_token = ast->TokenIndexAt(const_cast<clang::BinaryOperator *>(u.BinaryOperator)->getOperatorLoc());
+  snapshot.has_stored_fp_features = BinaryOperator::HasStoredFPFeatures();
+  snapshot.is_additive_operation = BinaryOperator::IsAdditiveOperation();
+  snapshot.is_assignment_operation = BinaryOperator::IsAssignmentOperation();
+  snapshot.is_bitwise_operation = BinaryOperator::IsBitwiseOperation();
+  snapshot.is_comma_operation = BinaryOperator::IsCommaOperation();
+  snapshot.is_comparison_operation = BinaryOperator::IsComparisonOperation();
+  snapshot.is_compound_assignment_operation = BinaryOperator::IsCompoundAssignmentOperation();
+  snapshot.is_equality_operation = BinaryOperator::IsEqualityOperation();
+  snapshot.is_logical_operation = BinaryOperator::IsLogicalOperation();
+  snapshot.is_multiplicative_operation = BinaryOperator::IsMultiplicativeOperation();
+  snapshot.is_pointer_memory_operation = BinaryOperator::IsPointerMemoryOperation();
+  snapshot.is_relational_operation = BinaryOperator::IsRelationalOperation();
+  snapshot.is_shift_assign_operation = BinaryOperator::IsShiftAssignOperation();
+  snapshot.is_shift_operation = BinaryOperator::IsShiftOperation();
+  return snapshot;
+}
+
+::pasta::BlockExprSnapshot BlockExpr::Snapshot(void) const {
+  ::pasta::BlockExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.caret_token = ast->TokenIndexAt(const_cast<clang::BlockExpr *>(u.BlockExpr)->getCaretLocation());
+  return snapshot;
+}
+
+::pasta::CXXBindTemporaryExprSnapshot CXXBindTemporaryExpr::Snapshot(void) const {
+  ::pasta::CXXBindTemporaryExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  return snapshot;
+}
+
+::pasta::CXXBoolLiteralExprSnapshot CXXBoolLiteralExpr::Snapshot(void) const {
+  ::pasta::CXXBoolLiteralExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.token = ast->TokenIndexAt(const_cast<clang::CXXBoolLiteralExpr *>(u.CXXBoolLiteralExpr)->getLocation());
+  snapshot.value = CXXBoolLiteralExpr::Value();
+  return snapshot;
+}
+
+::pasta::CXXConstructExprSnapshot CXXConstructExpr::Snapshot(void) const {
+  ::pasta::CXXConstructExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.construction_kind = CXXConstructExpr::ConstructionKind();
+  snapshot.token = ast->TokenIndexAt(const_cast<clang::CXXConstructExpr *>(u.CXXConstructExpr)->getLocation());
+  snapshot.num_arguments = CXXConstructExpr::NumArguments();
+  snapshot.had_multiple_candidates = CXXConstructExpr::HadMultipleCandidates();
+  snapshot.is_elidable = CXXConstructExpr::IsElidable();
+  snapshot.is_immediate_escalating = CXXConstructExpr::IsImmediateEscalating();
+  snapshot.is_list_initialization = CXXConstructExpr::IsListInitialization();
+  snapshot.is_std_initializer_list_initialization = CXXConstructExpr::IsStdInitializerListInitialization();
+  snapshot.requires_zero_initialization = CXXConstructExpr::RequiresZeroInitialization();
+  return snapshot;
+}
+
+::pasta::CXXDefaultArgExprSnapshot CXXDefaultArgExpr::Snapshot(void) const {
+  ::pasta::CXXDefaultArgExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.used_token = ast->TokenIndexAt(const_cast<clang::CXXDefaultArgExpr *>(u.CXXDefaultArgExpr)->getUsedLocation());
+  snapshot.has_rewritten_initializer = CXXDefaultArgExpr::HasRewrittenInitializer();
+  return snapshot;
+}
+
+::pasta::CXXDefaultInitExprSnapshot CXXDefaultInitExpr::Snapshot(void) const {
+  ::pasta::CXXDefaultInitExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.used_token = ast->TokenIndexAt(const_cast<clang::CXXDefaultInitExpr *>(u.CXXDefaultInitExpr)->getUsedLocation());
+  snapshot.has_rewritten_initializer = CXXDefaultInitExpr::HasRewrittenInitializer();
+  return snapshot;
+}
+
+::pasta::CXXDeleteExprSnapshot CXXDeleteExpr::Snapshot(void) const {
+  ::pasta::CXXDeleteExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.does_usual_array_delete_want_size = CXXDeleteExpr::DoesUsualArrayDeleteWantSize();
+  snapshot.is_array_form = CXXDeleteExpr::IsArrayForm();
+  snapshot.is_array_form_as_written = CXXDeleteExpr::IsArrayFormAsWritten();
+  snapshot.is_global_delete = CXXDeleteExpr::IsGlobalDelete();
+  return snapshot;
+}
+
+::pasta::CXXDependentScopeMemberExprSnapshot CXXDependentScopeMemberExpr::Snapshot(void) const {
+  ::pasta::CXXDependentScopeMemberExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.l_angle_token = ast->TokenIndexAt(const_cast<clang::CXXDependentScopeMemberExpr *>(u.CXXDependentScopeMemberExpr)->getLAngleLoc());
+  snapshot.member_token = ast->TokenIndexAt(const_cast<clang::CXXDependentScopeMemberExpr *>(u.CXXDependentScopeMemberExpr)->getMemberLoc());
+  snapshot.num_template_arguments = CXXDependentScopeMemberExpr::NumTemplateArguments();
+  snapshot.operator_token = ast->TokenIndexAt(const_cast<clang::CXXDependentScopeMemberExpr *>(u.CXXDependentScopeMemberExpr)->getOperatorLoc());
+  snapshot.r_angle_token = ast->TokenIndexAt(const_cast<clang::CXXDependentScopeMemberExpr *>(u.CXXDependentScopeMemberExpr)->getRAngleLoc());
+  snapshot.template_keyword_token = ast->TokenIndexAt(const_cast<clang::CXXDependentScopeMemberExpr *>(u.CXXDependentScopeMemberExpr)->getTemplateKeywordLoc());
+  snapshot.has_explicit_template_arguments = CXXDependentScopeMemberExpr::HasExplicitTemplateArguments();
+  snapshot.has_template_keyword = CXXDependentScopeMemberExpr::HasTemplateKeyword();
+  snapshot.is_arrow = CXXDependentScopeMemberExpr::IsArrow();
+  snapshot.is_implicit_access = CXXDependentScopeMemberExpr::IsImplicitAccess();
+  return snapshot;
+}
+
+::pasta::CXXFoldExprSnapshot CXXFoldExpr::Snapshot(void) const {
+  ::pasta::CXXFoldExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.ellipsis_token = ast->TokenIndexAt(const_cast<clang::CXXFoldExpr *>(u.CXXFoldExpr)->getEllipsisLoc());
+  snapshot.l_paren_token = ast->TokenIndexAt(const_cast<clang::CXXFoldExpr *>(u.CXXFoldExpr)->getLParenLoc());
+  snapshot.operator_ = CXXFoldExpr::Operator();
+  snapshot.r_paren_token = ast->TokenIndexAt(const_cast<clang::CXXFoldExpr *>(u.CXXFoldExpr)->getRParenLoc());
+  snapshot.is_left_fold = CXXFoldExpr::IsLeftFold();
+  snapshot.is_right_fold = CXXFoldExpr::IsRightFold();
+  return snapshot;
+}
+
+::pasta::CXXInheritedCtorInitExprSnapshot CXXInheritedCtorInitExpr::Snapshot(void) const {
+  ::pasta::CXXInheritedCtorInitExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.constructs_virtual_base = CXXInheritedCtorInitExpr::ConstructsVirtualBase();
+  snapshot.construction_kind = CXXInheritedCtorInitExpr::ConstructionKind();
+  snapshot.token = ast->TokenIndexAt(const_cast<clang::CXXInheritedCtorInitExpr *>(u.CXXInheritedCtorInitExpr)->getLocation());
+  snapshot.inherited_from_virtual_base = CXXInheritedCtorInitExpr::InheritedFromVirtualBase();
+  return snapshot;
+}
+
+::pasta::CXXNewExprSnapshot CXXNewExpr::Snapshot(void) const {
+  ::pasta::CXXNewExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.does_usual_array_delete_want_size = CXXNewExpr::DoesUsualArrayDeleteWantSize();
+  snapshot.initialization_style = CXXNewExpr::InitializationStyle();
+  snapshot.num_placement_arguments = CXXNewExpr::NumPlacementArguments();
+  snapshot.has_initializer = CXXNewExpr::HasInitializer();
+  snapshot.is_array = CXXNewExpr::IsArray();
+  snapshot.is_global_new = CXXNewExpr::IsGlobalNew();
+  snapshot.is_parenthesis_type_id = CXXNewExpr::IsParenthesisTypeId();
+  snapshot.pass_alignment = CXXNewExpr::PassAlignment();
+  snapshot.should_null_check_allocation = CXXNewExpr::ShouldNullCheckAllocation();
+  return snapshot;
+}
+
+::pasta::CXXNoexceptExprSnapshot CXXNoexceptExpr::Snapshot(void) const {
+  ::pasta::CXXNoexceptExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.value = CXXNoexceptExpr::Value();
+  return snapshot;
+}
+
+::pasta::CXXNullPtrLiteralExprSnapshot CXXNullPtrLiteralExpr::Snapshot(void) const {
+  ::pasta::CXXNullPtrLiteralExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.token = ast->TokenIndexAt(const_cast<clang::CXXNullPtrLiteralExpr *>(u.CXXNullPtrLiteralExpr)->getLocation());
+  return snapshot;
+}
+
+::pasta::CXXParenListInitExprSnapshot CXXParenListInitExpr::Snapshot(void) const {
+  ::pasta::CXXParenListInitExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.initializer_token = ast->TokenIndexAt(const_cast<clang::CXXParenListInitExpr *>(u.CXXParenListInitExpr)->getInitLoc());
+  return snapshot;
+}
+
+::pasta::CXXPseudoDestructorExprSnapshot CXXPseudoDestructorExpr::Snapshot(void) const {
+  ::pasta::CXXPseudoDestructorExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.colon_colon_token = ast->TokenIndexAt(const_cast<clang::CXXPseudoDestructorExpr *>(u.CXXPseudoDestructorExpr)->getColonColonLoc());
+  snapshot.destroyed_type_token = ast->TokenIndexAt(const_cast<clang::CXXPseudoDestructorExpr *>(u.CXXPseudoDestructorExpr)->getDestroyedTypeLoc());
+  snapshot.operator_token = ast->TokenIndexAt(const_cast<clang::CXXPseudoDestructorExpr *>(u.CXXPseudoDestructorExpr)->getOperatorLoc());
+  snapshot.tilde_token = ast->TokenIndexAt(const_cast<clang::CXXPseudoDestructorExpr *>(u.CXXPseudoDestructorExpr)->getTildeLoc());
+  snapshot.has_qualifier = CXXPseudoDestructorExpr::HasQualifier();
+  snapshot.is_arrow = CXXPseudoDestructorExpr::IsArrow();
+  return snapshot;
+}
+
+::pasta::CXXRewrittenBinaryOperatorSnapshot CXXRewrittenBinaryOperator::Snapshot(void) const {
+  ::pasta::CXXRewrittenBinaryOperatorSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.opcode = CXXRewrittenBinaryOperator::Opcode();
+  snapshot.operator_ = CXXRewrittenBinaryOperator::Operator();
+  snapshot.operator_token = ast->TokenIndexAt(const_cast<clang::CXXRewrittenBinaryOperator *>(u.CXXRewrittenBinaryOperator)->getOperatorLoc());
+  snapshot.is_assignment_operation = CXXRewrittenBinaryOperator::IsAssignmentOperation();
+  snapshot.is_comparison_operation = CXXRewrittenBinaryOperator::IsComparisonOperation();
+  snapshot.is_reversed = CXXRewrittenBinaryOperator::IsReversed();
+  return snapshot;
+}
+
+::pasta::CXXScalarValueInitExprSnapshot CXXScalarValueInitExpr::Snapshot(void) const {
+  ::pasta::CXXScalarValueInitExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.r_paren_token = ast->TokenIndexAt(const_cast<clang::CXXScalarValueInitExpr *>(u.CXXScalarValueInitExpr)->getRParenLoc());
+  return snapshot;
+}
+
+::pasta::CXXStdInitializerListExprSnapshot CXXStdInitializerListExpr::Snapshot(void) const {
+  ::pasta::CXXStdInitializerListExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  return snapshot;
+}
+
+::pasta::CXXTemporaryObjectExprSnapshot CXXTemporaryObjectExpr::Snapshot(void) const {
+  ::pasta::CXXTemporaryObjectExprSnapshot snapshot;
+  static_cast<::pasta::CXXConstructExprSnapshot &>(snapshot) = CXXConstructExpr::Snapshot();
+  return snapshot;
+}
+
+::pasta::CXXThisExprSnapshot CXXThisExpr::Snapshot(void) const {
+  ::pasta::CXXThisExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.token = ast->TokenIndexAt(const_cast<clang::CXXThisExpr *>(u.CXXThisExpr)->getLocation());
+  snapshot.is_implicit = CXXThisExpr::IsImplicit();
+  return snapshot;
+}
+
+::pasta::CXXThrowExprSnapshot CXXThrowExpr::Snapshot(void) const {
+  ::pasta::CXXThrowExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.throw_token = ast->TokenIndexAt(const_cast<clang::CXXThrowExpr *>(u.CXXThrowExpr)->getThrowLoc());
+  snapshot.is_thrown_variable_in_scope = CXXThrowExpr::IsThrownVariableInScope();
+  return snapshot;
+}
+
+::pasta::CXXTypeidExprSnapshot CXXTypeidExpr::Snapshot(void) const {
+  ::pasta::CXXTypeidExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.is_potentially_evaluated = CXXTypeidExpr::IsPotentiallyEvaluated();
+  snapshot.is_type_operand = CXXTypeidExpr::IsTypeOperand();
+  return snapshot;
+}
+
+::pasta::CXXUnresolvedConstructExprSnapshot CXXUnresolvedConstructExpr::Snapshot(void) const {
+  ::pasta::CXXUnresolvedConstructExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.l_paren_token = ast->TokenIndexAt(const_cast<clang::CXXUnresolvedConstructExpr *>(u.CXXUnresolvedConstructExpr)->getLParenLoc());
+  snapshot.num_arguments = CXXUnresolvedConstructExpr::NumArguments();
+  snapshot.r_paren_token = ast->TokenIndexAt(const_cast<clang::CXXUnresolvedConstructExpr *>(u.CXXUnresolvedConstructExpr)->getRParenLoc());
+  snapshot.is_list_initialization = CXXUnresolvedConstructExpr::IsListInitialization();
+  return snapshot;
+}
+
+::pasta::CXXUuidofExprSnapshot CXXUuidofExpr::Snapshot(void) const {
+  ::pasta::CXXUuidofExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.is_type_operand = CXXUuidofExpr::IsTypeOperand();
+  return snapshot;
+}
+
+::pasta::CallExprSnapshot CallExpr::Snapshot(void) const {
+  ::pasta::CallExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.adl_call_kind = CallExpr::ADLCallKind();
+  snapshot.builtin_callee = CallExpr::BuiltinCallee();
+  snapshot.num_arguments = CallExpr::NumArguments();
+  snapshot.r_paren_token = ast->TokenIndexAt(const_cast<clang::CallExpr *>(u.CallExpr)->getRParenLoc());
+  snapshot.has_stored_fp_features = CallExpr::HasStoredFPFeatures();
+  if (const auto &self = *(u.CallExpr); !self.isTypeDependent()) {
+    snapshot.has_unused_result_attribute = CallExpr::HasUnusedResultAttribute();
+  }
+  snapshot.is_builtin_assume_false = CallExpr::IsBuiltinAssumeFalse();
+  snapshot.is_call_to_std_move = CallExpr::IsCallToStdMove();
+  snapshot.is_unevaluated_builtin_call = CallExpr::IsUnevaluatedBuiltinCall();
+  snapshot.uses_adl = CallExpr::UsesADL();
+  return snapshot;
+}
+
+::pasta::CastExprSnapshot CastExpr::Snapshot(void) const {
+  ::pasta::CastExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.cast_kind = CastExpr::CastKind();
+  snapshot.has_stored_fp_features = CastExpr::HasStoredFPFeatures();
+  return snapshot;
+}
+
+::pasta::CharacterLiteralSnapshot CharacterLiteral::Snapshot(void) const {
+  ::pasta::CharacterLiteralSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.literal_kind = CharacterLiteral::LiteralKind();
+  snapshot.token = ast->TokenIndexAt(const_cast<clang::CharacterLiteral *>(u.CharacterLiteral)->getLocation());
+  snapshot.value = CharacterLiteral::Value();
+  return snapshot;
+}
+
+::pasta::ChooseExprSnapshot ChooseExpr::Snapshot(void) const {
+  ::pasta::ChooseExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.builtin_token = ast->TokenIndexAt(const_cast<clang::ChooseExpr *>(u.ChooseExpr)->getBuiltinLoc());
+  snapshot.r_paren_token = ast->TokenIndexAt(const_cast<clang::ChooseExpr *>(u.ChooseExpr)->getRParenLoc());
+  snapshot.is_condition_dependent = ChooseExpr::IsConditionDependent();
+  if (const auto &self = *(u.ChooseExpr); !self.isConditionDependent()) {
+    snapshot.is_condition_true = ChooseExpr::IsConditionTrue();
+  }
+  return snapshot;
+}
+
+::pasta::CompoundAssignOperatorSnapshot CompoundAssignOperator::Snapshot(void) const {
+  ::pasta::CompoundAssignOperatorSnapshot snapshot;
+  static_cast<::pasta::BinaryOperatorSnapshot &>(snapshot) = BinaryOperator::Snapshot();
+  return snapshot;
+}
+
+::pasta::CompoundLiteralExprSnapshot CompoundLiteralExpr::Snapshot(void) const {
+  ::pasta::CompoundLiteralExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.l_paren_token = ast->TokenIndexAt(const_cast<clang::CompoundLiteralExpr *>(u.CompoundLiteralExpr)->getLParenLoc());
+  snapshot.is_file_scope = CompoundLiteralExpr::IsFileScope();
+  return snapshot;
+}
+
+::pasta::ConceptSpecializationExprSnapshot ConceptSpecializationExpr::Snapshot(void) const {
+  ::pasta::ConceptSpecializationExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  if (const auto &self = *(u.ConceptSpecializationExpr); !self.isValueDependent()) {
+    snapshot.is_satisfied = ConceptSpecializationExpr::IsSatisfied();
+  }
+  return snapshot;
+}
+
+::pasta::ConditionalOperatorSnapshot ConditionalOperator::Snapshot(void) const {
+  ::pasta::ConditionalOperatorSnapshot snapshot;
+  static_cast<::pasta::AbstractConditionalOperatorSnapshot &>(snapshot) = AbstractConditionalOperator::Snapshot();
+  return snapshot;
+}
+
+::pasta::ConstantExprSnapshot ConstantExpr::Snapshot(void) const {
+  ::pasta::ConstantExprSnapshot snapshot;
+  static_cast<::pasta::FullExprSnapshot &>(snapshot) = FullExpr::Snapshot();
+  snapshot.result_storage_kind = ConstantExpr::ResultStorageKind();
+  snapshot.has_ap_value_result = ConstantExpr::HasAPValueResult();
+  snapshot.is_immediate_invocation = ConstantExpr::IsImmediateInvocation();
+  return snapshot;
+}
+
+::pasta::ConvertVectorExprSnapshot ConvertVectorExpr::Snapshot(void) const {
+  ::pasta::ConvertVectorExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.builtin_token = ast->TokenIndexAt(const_cast<clang::ConvertVectorExpr *>(u.ConvertVectorExpr)->getBuiltinLoc());
+  snapshot.r_paren_token = ast->TokenIndexAt(const_cast<clang::ConvertVectorExpr *>(u.ConvertVectorExpr)->getRParenLoc());
+  return snapshot;
+}
+
+::pasta::CoroutineSuspendExprSnapshot CoroutineSuspendExpr::Snapshot(void) const {
+  ::pasta::CoroutineSuspendExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.keyword_token = ast->TokenIndexAt(const_cast<clang::CoroutineSuspendExpr *>(u.CoroutineSuspendExpr)->getKeywordLoc());
+  return snapshot;
+}
+
+::pasta::CoyieldExprSnapshot CoyieldExpr::Snapshot(void) const {
+  ::pasta::CoyieldExprSnapshot snapshot;
+  static_cast<::pasta::CoroutineSuspendExprSnapshot &>(snapshot) = CoroutineSuspendExpr::Snapshot();
+  return snapshot;
+}
+
+::pasta::DeclRefExprSnapshot DeclRefExpr::Snapshot(void) const {
+  ::pasta::DeclRefExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.l_angle_token = ast->TokenIndexAt(const_cast<clang::DeclRefExpr *>(u.DeclRefExpr)->getLAngleLoc());
+  snapshot.num_template_arguments = DeclRefExpr::NumTemplateArguments();
+  snapshot.r_angle_token = ast->TokenIndexAt(const_cast<clang::DeclRefExpr *>(u.DeclRefExpr)->getRAngleLoc());
+  snapshot.template_keyword_token = ast->TokenIndexAt(const_cast<clang::DeclRefExpr *>(u.DeclRefExpr)->getTemplateKeywordLoc());
+  snapshot.had_multiple_candidates = DeclRefExpr::HadMultipleCandidates();
+  snapshot.has_explicit_template_arguments = DeclRefExpr::HasExplicitTemplateArguments();
+  snapshot.has_qualifier = DeclRefExpr::HasQualifier();
+  snapshot.has_template_keyword_and_arguments_info = DeclRefExpr::HasTemplateKeywordAndArgumentsInfo();
+  snapshot.has_template_keyword = DeclRefExpr::HasTemplateKeyword();
+  snapshot.is_immediate_escalating = DeclRefExpr::IsImmediateEscalating();
+  snapshot.is_non_odr_use = DeclRefExpr::IsNonOdrUse();
+  snapshot.refers_to_enclosing_variable_or_capture = DeclRefExpr::RefersToEnclosingVariableOrCapture();
+  return snapshot;
+}
+
+::pasta::DependentCoawaitExprSnapshot DependentCoawaitExpr::Snapshot(void) const {
+  ::pasta::DependentCoawaitExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.keyword_token = ast->TokenIndexAt(const_cast<clang::DependentCoawaitExpr *>(u.DependentCoawaitExpr)->getKeywordLoc());
+  return snapshot;
+}
+
+::pasta::DependentScopeDeclRefExprSnapshot DependentScopeDeclRefExpr::Snapshot(void) const {
+  ::pasta::DependentScopeDeclRefExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.l_angle_token = ast->TokenIndexAt(const_cast<clang::DependentScopeDeclRefExpr *>(u.DependentScopeDeclRefExpr)->getLAngleLoc());
+  snapshot.num_template_arguments = DependentScopeDeclRefExpr::NumTemplateArguments();
+  snapshot.r_angle_token = ast->TokenIndexAt(const_cast<clang::DependentScopeDeclRefExpr *>(u.DependentScopeDeclRefExpr)->getRAngleLoc());
+  snapshot.template_keyword_token = ast->TokenIndexAt(const_cast<clang::DependentScopeDeclRefExpr *>(u.DependentScopeDeclRefExpr)->getTemplateKeywordLoc());
+  snapshot.has_explicit_template_arguments = DependentScopeDeclRefExpr::HasExplicitTemplateArguments();
+  snapshot.has_template_keyword = DependentScopeDeclRefExpr::HasTemplateKeyword();
+  return snapshot;
+}
+
+::pasta::DesignatedInitExprSnapshot DesignatedInitExpr::Snapshot(void) const {
+  ::pasta::DesignatedInitExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  snapshot.equal_or_colon_token = ast->TokenIndexAt(const_cast<clang::DesignatedInitExpr *>(u.DesignatedInitExpr)->getEqualOrColonLoc());
+  snapshot.num_sub_expressions = DesignatedInitExpr::NumSubExpressions();
+  snapshot.is_direct_initializer = DesignatedInitExpr::IsDirectInitializer();
+  snapshot.size = DesignatedInitExpr::Size();
+  snapshot.uses_gnu_syntax = DesignatedInitExpr::UsesGNUSyntax();
+  return snapshot;
+}
+
+::pasta::DesignatedInitUpdateExprSnapshot DesignatedInitUpdateExpr::Snapshot(void) const {
+  ::pasta::DesignatedInitUpdateExprSnapshot snapshot;
+  static_cast<::pasta::ExprSnapshot &>(snapshot) = Expr::Snapshot();
+  return snapshot;
+}
+
+::pasta::ExplicitCastExprSnapshot ExplicitCastExpr::Snapshot(void) const {
+  ::pasta::ExplicitCastExprSnapshot snapshot;
+  static_cast<::pasta::CastExprSnapshot &>(snapshot) = CastExpr::Snapshot();
+  return snapshot;
+}
+
+::pasta::ExprWithCleanupsSnapshot ExprWithCleanups::Snapshot(void) const {
+  ::pasta::ExprWithCleanupsSnapshot snapshot;
+  static_cast<::pasta::FullExprSnapshot &>(snapshot) = FullExpr::Snapshot();
+  snapshot.cleanups_have_side_effects = ExprWithCleanups::CleanupsHaveSideEffects();
+  snapshot.num_objects = ExprWithCleanups::NumObjects();
+  return snapshot;
+}
+
+::pasta::ImplicitCastExprSnapshot ImplicitCastExpr::Snapshot(void) const {
+  ::pasta::ImplicitCastExprSnapshot snapshot;
+  static_cast<::pasta::CastExprSnapshot &>(snapshot) = CastExpr::Snapshot();
+  snapshot.is_part_of_explicit_cast = ImplicitCastExpr::IsPartOfExplicitCast();
+  return snapshot;
+}
+
+::pasta::OMPAtomicDirectiveSnapshot OMPAtomicDirective::Snapshot(void) const {
+  ::pasta::OMPAtomicDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPExecutableDirectiveSnapshot &>(snapshot) = OMPExecutableDirective::Snapshot();
+  snapshot.is_fail_only = OMPAtomicDirective::IsFailOnly();
+  snapshot.is_postfix_update = OMPAtomicDirective::IsPostfixUpdate();
+  snapshot.is_xlhs_in_rhs_part = OMPAtomicDirective::IsXLHSInRHSPart();
+  return snapshot;
+}
+
+::pasta::OMPBarrierDirectiveSnapshot OMPBarrierDirective::Snapshot(void) const {
+  ::pasta::OMPBarrierDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPExecutableDirectiveSnapshot &>(snapshot) = OMPExecutableDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPCancelDirectiveSnapshot OMPCancelDirective::Snapshot(void) const {
+  ::pasta::OMPCancelDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPExecutableDirectiveSnapshot &>(snapshot) = OMPExecutableDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPCancellationPointDirectiveSnapshot OMPCancellationPointDirective::Snapshot(void) const {
+  ::pasta::OMPCancellationPointDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPExecutableDirectiveSnapshot &>(snapshot) = OMPExecutableDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPCriticalDirectiveSnapshot OMPCriticalDirective::Snapshot(void) const {
+  ::pasta::OMPCriticalDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPExecutableDirectiveSnapshot &>(snapshot) = OMPExecutableDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPDepobjDirectiveSnapshot OMPDepobjDirective::Snapshot(void) const {
+  ::pasta::OMPDepobjDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPExecutableDirectiveSnapshot &>(snapshot) = OMPExecutableDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPDispatchDirectiveSnapshot OMPDispatchDirective::Snapshot(void) const {
+  ::pasta::OMPDispatchDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPExecutableDirectiveSnapshot &>(snapshot) = OMPExecutableDirective::Snapshot();
+  snapshot.target_call_token = ast->TokenIndexAt(const_cast<clang::OMPDispatchDirective *>(u.OMPDispatchDirective)->getTargetCallLoc());
+  return snapshot;
+}
+
+::pasta::OMPDistributeDirectiveSnapshot OMPDistributeDirective::Snapshot(void) const {
+  ::pasta::OMPDistributeDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopDirectiveSnapshot &>(snapshot) = OMPLoopDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPDistributeParallelForDirectiveSnapshot OMPDistributeParallelForDirective::Snapshot(void) const {
+  ::pasta::OMPDistributeParallelForDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopDirectiveSnapshot &>(snapshot) = OMPLoopDirective::Snapshot();
+  snapshot.has_cancel = OMPDistributeParallelForDirective::HasCancel();
+  return snapshot;
+}
+
+::pasta::OMPDistributeParallelForSimdDirectiveSnapshot OMPDistributeParallelForSimdDirective::Snapshot(void) const {
+  ::pasta::OMPDistributeParallelForSimdDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopDirectiveSnapshot &>(snapshot) = OMPLoopDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPDistributeSimdDirectiveSnapshot OMPDistributeSimdDirective::Snapshot(void) const {
+  ::pasta::OMPDistributeSimdDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopDirectiveSnapshot &>(snapshot) = OMPLoopDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPErrorDirectiveSnapshot OMPErrorDirective::Snapshot(void) const {
+  ::pasta::OMPErrorDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPExecutableDirectiveSnapshot &>(snapshot) = OMPExecutableDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPForDirectiveSnapshot OMPForDirective::Snapshot(void) const {
+  ::pasta::OMPForDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopDirectiveSnapshot &>(snapshot) = OMPLoopDirective::Snapshot();
+  snapshot.has_cancel = OMPForDirective::HasCancel();
+  return snapshot;
+}
+
+::pasta::OMPForSimdDirectiveSnapshot OMPForSimdDirective::Snapshot(void) const {
+  ::pasta::OMPForSimdDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopDirectiveSnapshot &>(snapshot) = OMPLoopDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::OMPGenericLoopDirectiveSnapshot OMPGenericLoopDirective::Snapshot(void) const {
+  ::pasta::OMPGenericLoopDirectiveSnapshot snapshot;
+  static_cast<::pasta::OMPLoopDirectiveSnapshot &>(snapshot) = OMPLoopDirective::Snapshot();
+  return snapshot;
+}
+
+::pasta::ObjCBridgedCastExprSnapshot ObjCBridgedCastExpr::Snapshot(void) const {
+  ::pasta::ObjCBridgedCastExprSnapshot snapshot;
+  static_cast<::pasta::ExplicitCastExprSnapshot &>(snapshot) = ExplicitCastExpr::Snapshot();
+  snapshot.bridge_keyword_token = ast->TokenIndexAt(const_cast<clang::ObjCBridgedCastExpr *>(u.ObjCBridgedCastExpr)->getBridgeKeywordLoc());
+  snapshot.bridge_kind = ObjCBridgedCastExpr::BridgeKind();
+  snapshot.l_paren_token = ast->TokenIndexAt(const_cast<clang::ObjCBridgedCastExpr *>(u.ObjCBridgedCastExpr)->getLParenLoc());
+  return snapshot;
+}
+
+::pasta::UserDefinedLiteralSnapshot UserDefinedLiteral::Snapshot(void) const {
+  ::pasta::UserDefinedLiteralSnapshot snapshot;
+  static_cast<::pasta::CallExprSnapshot &>(snapshot) = CallExpr::Snapshot();
+  snapshot.literal_operator_kind = UserDefinedLiteral::LiteralOperatorKind();
+  snapshot.ud_suffix_token = ast->TokenIndexAt(const_cast<clang::UserDefinedLiteral *>(u.UserDefinedLiteral)->getUDSuffixLoc());
+  return snapshot;
+}
+
+::pasta::BuiltinBitCastExprSnapshot BuiltinBitCastExpr::Snapshot(void) const {
+  ::pasta::BuiltinBitCastExprSnapshot snapshot;
+  static_cast<::pasta::ExplicitCastExprSnapshot &>(snapshot) = ExplicitCastExpr::Snapshot();
+  return snapshot;
+}
+
+::pasta::CStyleCastExprSnapshot CStyleCastExpr::Snapshot(void) const {
+  ::pasta::CStyleCastExprSnapshot snapshot;
+  static_cast<::pasta::ExplicitCastExprSnapshot &>(snapshot) = ExplicitCastExpr::Snapshot();
+  snapshot.l_paren_token = ast->TokenIndexAt(const_cast<clang::CStyleCastExpr *>(u.CStyleCastExpr)->getLParenLoc());
+  snapshot.r_paren_token = ast->TokenIndexAt(const_cast<clang::CStyleCastExpr *>(u.CStyleCastExpr)->getRParenLoc());
+  return snapshot;
+}
+
+::pasta::CUDAKernelCallExprSnapshot CUDAKernelCallExpr::Snapshot(void) const {
+  ::pasta::CUDAKernelCallExprSnapshot snapshot;
+  static_cast<::pasta::CallExprSnapshot &>(snapshot) = CallExpr::Snapshot();
+  return snapshot;
+}
+
+::pasta::CXXFunctionalCastExprSnapshot CXXFunctionalCastExpr::Snapshot(void) const {
+  ::pasta::CXXFunctionalCastExprSnapshot snapshot;
+  static_cast<::pasta::ExplicitCastExprSnapshot &>(snapshot) = ExplicitCastExpr::Snapshot();
+  snapshot.l_paren_token = ast->TokenIndexAt(const_cast<clang::CXXFunctionalCastExpr *>(u.CXXFunctionalCastExpr)->getLParenLoc());
+  snapshot.r_paren_token = ast->TokenIndexAt(const_cast<clang::CXXFunctionalCastExpr *>(u.CXXFunctionalCastExpr)->getRParenLoc());
+  snapshot.is_list_initialization = CXXFunctionalCastExpr::IsListInitialization();
+  return snapshot;
+}
+
+::pasta::CXXMemberCallExprSnapshot CXXMemberCallExpr::Snapshot(void) const {
+  ::pasta::CXXMemberCallExprSnapshot snapshot;
+  static_cast<::pasta::CallExprSnapshot &>(snapshot) = CallExpr::Snapshot();
+  return snapshot;
+}
+
+::pasta::CXXNamedCastExprSnapshot CXXNamedCastExpr::Snapshot(void) const {
+  ::pasta::CXXNamedCastExprSnapshot snapshot;
+  static_cast<::pasta::ExplicitCastExprSnapshot &>(snapshot) = ExplicitCastExpr::Snapshot();
+  snapshot.operator_token = ast->TokenIndexAt(const_cast<clang::CXXNamedCastExpr *>(u.CXXNamedCastExpr)->getOperatorLoc());
+  snapshot.r_paren_token = ast->TokenIndexAt(const_cast<clang::CXXNamedCastExpr *>(u.CXXNamedCastExpr)->getRParenLoc());
+  return snapshot;
+}
+
+::pasta::CXXOperatorCallExprSnapshot CXXOperatorCallExpr::Snapshot(void) const {
+  ::pasta::CXXOperatorCallExprSnapshot snapshot;
+  static_cast<::pasta::CallExprSnapshot &>(snapshot) = CallExpr::Snapshot();
+  snapshot.operator_ = CXXOperatorCallExpr::Operator();
+  snapshot.operator_token = ast->TokenIndexAt(const_cast<clang::CXXOperatorCallExpr *>(u.CXXOperatorCallExpr)->getOperatorLoc());
+  snapshot.is_assignment_operation = CXXOperatorCallExpr::IsAssignmentOperation();
+  snapshot.is_comparison_operation = CXXOperatorCallExpr::IsComparisonOperation();
+  snapshot.is_infix_binary_operation = CXXOperatorCallExpr::IsInfixBinaryOperation();
+  return snapshot;
+}
+
+::pasta::CXXReinterpretCastExprSnapshot CXXReinterpretCastExpr::Snapshot(void) const {
+  ::pasta::CXXReinterpretCastExprSnapshot snapshot;
+  static_cast<::pasta::CXXNamedCastExprSnapshot &>(snapshot) = CXXNamedCastExpr::Snapshot();
+  return snapshot;
+}
+
+::pasta::CXXStaticCastExprSnapshot CXXStaticCastExpr::Snapshot(void) const {
+  ::pasta::CXXStaticCastExprSnapshot snapshot;
+  static_cast<::pasta::CXXNamedCastExprSnapshot &>(snapshot) = CXXNamedCastExpr::Snapshot();
+  return snapshot;
+}
+
+::pasta::CoawaitExprSnapshot CoawaitExpr::Snapshot(void) const {
+  ::pasta::CoawaitExprSnapshot snapshot;
+  static_cast<::pasta::CoroutineSuspendExprSnapshot &>(snapshot) = CoroutineSuspendExpr::Snapshot();
+  snapshot.is_implicit = CoawaitExpr::IsImplicit();
+  return snapshot;
+}
+
+::pasta::CXXAddrspaceCastExprSnapshot CXXAddrspaceCastExpr::Snapshot(void) const {
+  ::pasta::CXXAddrspaceCastExprSnapshot snapshot;
+  static_cast<::pasta::CXXNamedCastExprSnapshot &>(snapshot) = CXXNamedCastExpr::Snapshot();
+  return snapshot;
+}
+
+::pasta::CXXConstCastExprSnapshot CXXConstCastExpr::Snapshot(void) const {
+  ::pasta::CXXConstCastExprSnapshot snapshot;
+  static_cast<::pasta::CXXNamedCastExprSnapshot &>(snapshot) = CXXNamedCastExpr::Snapshot();
+  return snapshot;
+}
+
+::pasta::CXXDynamicCastExprSnapshot CXXDynamicCastExpr::Snapshot(void) const {
+  ::pasta::CXXDynamicCastExprSnapshot snapshot;
+  static_cast<::pasta::CXXNamedCastExprSnapshot &>(snapshot) = CXXNamedCastExpr::Snapshot();
+  snapshot.is_always_null = CXXDynamicCastExpr::IsAlwaysNull();
+  return snapshot;
+}
+
 }  // namespace pasta
 #endif  // PASTA_IN_BOOTSTRAP
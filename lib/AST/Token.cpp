@@ -5,8 +5,11 @@
 #include "Macro.h"
 #include "Token.h"
 
+#include <algorithm>
 #include <cassert>
 #include <limits>
+#include <map>
+#include <tuple>
 #include <vector>
 
 #pragma GCC diagnostic push
@@ -424,6 +427,7 @@ std::optional<Token> Token::DerivedLocation(void) const {
 std::vector<Token> Token::DerivationChain(void) const {
   std::optional<Token> cur = std::optional(*this);
   std::vector<Token> derivation_chain;
+  derivation_chain.reserve(DerivationDepth() + 1u);
   do {
     derivation_chain.push_back(*cur);
     cur = cur->DerivedLocation();
@@ -431,6 +435,27 @@ std::vector<Token> Token::DerivationChain(void) const {
   return derivation_chain;
 }
 
+// The number of tokens from which this token is derived.
+unsigned Token::DerivationDepth(void) const noexcept {
+  if (!ast || !impl) {
+    return 0u;
+  }
+
+  size_t tok_index = Index();
+  if (tok_index < ast->derivation_depths.size()) {
+    return ast->derivation_depths[tok_index];
+  }
+
+  // Not covered by the table; follow the links like `DerivedLocation`.
+  unsigned depth = 0u;
+  for (size_t derived_index = impl->derived_index; derived_index < tok_index;
+       derived_index = ast->tokens[tok_index].derived_index) {
+    tok_index = derived_index;
+    ++depth;
+  }
+  return depth;
+}
+
 // Location of the token in a file.
 std::optional<FileToken> Token::FileLocation(void) const {
   if (!impl) {
@@ -438,27 +463,56 @@ std::optional<FileToken> Token::FileLocation(void) const {
   }
 
   size_t tok_index = Index();
-  size_t max_index = ast->tokens.size();
-
-  clang::SourceLocation loc;
-  while (tok_index < max_index) {
-    const TokenImpl &tok = ast->tokens[tok_index];
-    loc = tok.Location();
-    if (loc.isInvalid()) {
-      return std::nullopt;
-    }
+  if (tok_index < ast->derivation_roots.size()) {
+    tok_index = ast->derivation_roots[tok_index];
 
-    if (loc.isFileID()) {
-      break;
+  // Not covered by the table; follow the links like `BuildDerivationTables`.
+  } else {
+    for (;;) {
+      const TokenImpl &tok = ast->tokens[tok_index];
+      const clang::SourceLocation loc = tok.Location();
+      if (loc.isInvalid() || loc.isFileID() || tok.derived_index >= tok_index) {
+        break;
+      }
+      tok_index = tok.derived_index;
     }
+  }
 
-    max_index = tok_index;
-    tok_index = tok.derived_index;
+  clang::SourceLocation loc = ast->tokens[tok_index].Location();
+  if (loc.isInvalid()) {
+    return std::nullopt;
   }
 
   return ast->FileTokenAt(loc);
 }
 
+// Fill in the per-token derivation tables. Tokens are only ever derived from
+// prior tokens, so one forward pass over the tokens, where each token extends
+// the entries of the token from which it is derived, fills in both tables.
+void ASTImpl::BuildDerivationTables(void) {
+  const size_t num_tokens = tokens.size();
+  derivation_roots.resize(num_tokens);
+  derivation_depths.resize(num_tokens);
+
+  for (size_t i = 0u; i < num_tokens; ++i) {
+    const TokenImpl &tok = tokens[i];
+    const size_t derived_index = tok.derived_index;
+    const bool has_prior_derivation = derived_index < i;
+
+    derivation_depths[i] =
+        has_prior_derivation ? derivation_depths[derived_index] + 1u : 0u;
+
+    // `FileLocation` stops on file or invalid locations, even if the token
+    // is itself derived from another.
+    const clang::SourceLocation loc = tok.Location();
+    if (!has_prior_derivation || loc.isInvalid() || loc.isFileID()) {
+      derivation_roots[i] = static_cast<DerivedTokenIndex>(i);
+    } else {
+      derivation_roots[i] = derivation_roots[derived_index];
+    }
+  }
+}
+
 // Location of the token in a macro expansion.
 std::optional<MacroToken> Token::MacroLocation(void) const {
   switch (Role()) {
@@ -586,15 +640,6 @@ std::string_view TokenImpl::Data(const ASTImpl &ast) const noexcept {
   return {};
 }
 
-std::string_view TokenImpl::Data(
-    const PrintedTokenRangeImpl &range) const noexcept {
-  if (data_len) {
-    return std::string_view(range.data).substr(
-        static_cast<uint32_t>(data_offset), data_len);
-  }
-  return {};
-}
-
 // Return the data associated with this token.
 std::string_view Token::Data(void) const {
   if (ast && impl) {
@@ -737,6 +782,174 @@ bool TokenRange::Contains(const Token &tok) const noexcept {
   return ast == tok.ast && first <= tok.impl && tok.impl < after_last;
 }
 
+namespace {
+
+// A substitution whose replacement children begin with (a macro containing)
+// a token in the derivation chain of the first token of a range.
+struct FrontAlignment {
+  // Index of the derived token in `FrontAlignments::chain`.
+  size_t chain_index;
+  Macro parent;
+  MacroSubstitution sub;
+};
+
+// The results of steps 1 and 2 of `TokenRange::AlignedSubstitutions`, which
+// depend only on the first token of a range.
+struct FrontAlignments {
+  std::vector<Token> chain;
+  std::vector<FrontAlignment> aligned;
+};
+
+// The results of steps 3 and 4 of `TokenRange::AlignedSubstitutions`, which
+// depend only on the last token of a range.
+struct BackAlignments {
+  std::vector<Token> chain;
+
+  // `parents[offsets[i]]` up to `parents[offsets[i + 1u]]` are the parent
+  // macros whose replacement children end with (a macro containing) the token
+  // `chain[i]`.
+  std::vector<Macro> parents;
+  std::vector<size_t> offsets;
+};
+
+// Steps 1 and 2 of `TokenRange::AlignedSubstitutions`.
+static FrontAlignments FindFrontAlignments(const Token &b_tok) {
+  FrontAlignments front;
+  front.chain = b_tok.DerivationChain();
+
+  for (size_t i = 0u, max_i = front.chain.size(); i < max_i; ++i) {
+    std::optional<Macro> b_macro = front.chain[i].MacroLocation();
+    if (!b_macro) {
+      continue;
+    }
+
+    for (auto b_parent = b_macro->Parent(); b_parent;
+         b_macro = *b_parent, b_parent = b_parent->Parent()) {
+      auto b_parent_sub = MacroSubstitution::From(*b_parent);
+      if (!b_parent_sub) {
+        break;
+      }
+
+      // Here is the first edge-case. We only allow a macro token to be the
+      // first child in its parent's intermediate replacement list if the macro
+      // token is a parameter substitution. Nothing after this can align.
+      if (auto b_parent_exp = MacroExpansion::From(*b_parent_sub)) {
+        MacroRange body = b_parent_exp->IntermediateChildren();
+        bool is_psub = b_macro->Kind() == MacroKind::kParameterSubstitution;
+        if (b_macro == body.Front() && !is_psub) {
+          return front;
+        }
+      }
+
+      auto b_parent_replacement = b_parent_sub->ReplacementChildren();
+      bool front_aligned = (b_macro == b_parent_replacement.Front());
+      if (!front_aligned) {
+        break;
+      }
+
+      front.aligned.push_back({i, *b_parent, *b_parent_sub});
+    }
+  }
+
+  return front;
+}
+
+// Steps 3 and 4 of `TokenRange::AlignedSubstitutions`.
+static BackAlignments FindBackAlignments(const Token &e_tok, bool heuristic) {
+  BackAlignments back;
+  back.chain = e_tok.DerivationChain();
+  back.offsets.reserve(back.chain.size() + 1u);
+
+  // If the heuristic is enabled, keep track of the token that immediately
+  // follows this statement to check if it's a semicolon.
+  auto tok_after_e_tok = (heuristic
+                          ? e_tok.NextFinalExpansionOrFileToken()
+                          : std::nullopt);
+  bool semi = tok_after_e_tok && tok_after_e_tok->Kind() == TokenKind::kSemi;
+
+  for (const Token &e_deriv : back.chain) {
+    back.offsets.push_back(back.parents.size());
+
+    std::optional<Macro> e_macro = e_deriv.MacroLocation();
+    if (!e_macro) {
+      continue;
+    }
+
+    for (auto e_parent = e_macro->Parent(); e_parent;
+         e_macro = *e_parent, e_parent = e_parent->Parent()) {
+      auto e_parent_sub = MacroSubstitution::From(*e_parent);
+      if (!e_parent_sub) {
+        break;
+      }
+
+      if (auto e_parent_exp = MacroExpansion::From(*e_parent_sub)) {
+        MacroRange body = e_parent_exp->IntermediateChildren();
+        bool is_psub = e_macro->Kind() == MacroKind::kParameterSubstitution;
+        if (e_macro == body.Back() && !is_psub) {
+          break;
+        }
+      }
+
+      auto psub_last_tok = e_parent_sub->LastFullySubstitutedToken();
+      auto e_parent_replacement = e_parent_sub->ReplacementChildren();
+      bool back_aligned = ((e_macro == e_parent_replacement.Back()) ||
+                           (semi && tok_after_e_tok == psub_last_tok));
+
+      if (!back_aligned) {
+        break;
+      }
+
+      back.parents.push_back(*e_parent);
+    }
+  }
+
+  back.offsets.push_back(back.parents.size());
+  return back;
+}
+
+// Step 5 of `TokenRange::AlignedSubstitutions`, where the front- and back-
+// aligned parent macros are joined.
+static void JoinAlignments(const FrontAlignments &front,
+                           const BackAlignments &back, bool same_tok,
+                           std::vector<MacroSubstitution> &result) {
+  for (const FrontAlignment &aligned : front.aligned) {
+    const Token &b_deriv = front.chain[aligned.chain_index];
+
+    for (size_t j = 0u, max_j = back.chain.size(); j < max_j; ++j) {
+
+      // Here's the rub: If the begin and end tokens ever converge to the same
+      // derived token, then their derivation trees have started mixing. This
+      // can happen if two separate arguments of the macro are invocations of
+      // the same macro definition. To see an example, print the macro graph
+      // of the following invocation code snippet:
+      //
+      // #define ONE 1
+      // #define ADD(x, y) x + y
+      // ADD(ONE, ONE)
+      //
+      // This isn't a problem if the begin and end tokens were the same tokens
+      // to begin with (then of course their derivation trees would be the
+      // same). Otherwise we should exit early, since this mixing might cause
+      // us to return a false positive.
+
+      // NOTE(bpappas): I am fairly certain that returning here will prevent
+      // false positives, but I am not sure if it will create false negatives.
+      if (b_deriv == back.chain[j] && !same_tok) {
+        break;
+      }
+
+      for (size_t k = back.offsets[j], max_k = back.offsets[j + 1u];
+           k < max_k; ++k) {
+        if (aligned.parent == back.parents[k]) {
+          result.push_back(aligned.sub);
+        }
+      }
+    }
+  }
+}
+
+}  // namespace
+
 std::vector<MacroSubstitution>
 TokenRange::AlignedSubstitutions(bool heuristic) noexcept {
   // The big idea is that we want to find the all macros that aligns in the
@@ -781,107 +994,86 @@ TokenRange::AlignedSubstitutions(bool heuristic) noexcept {
     return result;
   }
 
-  auto b_tok_deriv_chain = b_tok->DerivationChain();
+  FrontAlignments front = FindFrontAlignments(*b_tok);
+  if (front.aligned.empty()) {
+    return result;
+  }
 
-  auto e_tok_deriv_chain = e_tok->DerivationChain();
+  JoinAlignments(front, FindBackAlignments(*e_tok, heuristic),
+                 *b_tok == *e_tok, result);
+  return result;
+}
 
-  // If the heuristic is enabled, keep track of the token that immediately
-  // follows this statement to check if it's a semicolon.
-  auto tok_after_e_tok = (heuristic
-                          ? e_tok->NextFinalExpansionOrFileToken()
-                          : std::nullopt);
-  bool semi = tok_after_e_tok && tok_after_e_tok->Kind() == TokenKind::kSemi;
+std::vector<std::vector<MacroSubstitution>> TokenRange::AlignedSubstitutions(
+    const std::vector<TokenRange> &ranges, bool heuristic) noexcept {
+
+  // A range to visit during the sweep, identified by its position in `ranges`.
+  struct SweepRange {
+    const ASTImpl *ast;
+    uint64_t b_index;
+    uint64_t e_index;
+    size_t range_index;
+    Token b_tok;
+    Token e_tok;
+  };
 
-  for (auto b_deriv : b_tok_deriv_chain) {
-    std::optional<Macro> b_macro = b_deriv.MacroLocation();
-    if (!b_macro) {
-      continue;
-    }
+  std::vector<std::vector<MacroSubstitution>> results(ranges.size());
+  std::vector<SweepRange> sweep;
+  sweep.reserve(ranges.size());
 
-    for (auto b_parent = b_macro->Parent(); b_parent;
-         b_macro = *b_parent, b_parent = b_parent->Parent()) {
-      auto b_parent_sub = MacroSubstitution::From(*b_parent);
-      if (!b_parent_sub) {
-        break;
-      }
+  for (size_t i = 0u, max_i = ranges.size(); i < max_i; ++i) {
+    TokenRange range = ranges[i];
+    auto b_tok = range.Front(), e_tok = range.Back();
+    if (b_tok && *b_tok && e_tok && *e_tok) {
+      sweep.push_back({range.ast.get(), b_tok->Index(), e_tok->Index(), i,
+                       std::move(*b_tok), std::move(*e_tok)});
+    }
+  }
 
-      // Here is the first edge-case. We only allow a macro token to be the
-      // first child in its parent's intermediate replacement list if the macro
-      // token is a parameter substitution.
-      if (auto b_parent_exp = MacroExpansion::From(*b_parent_sub)) {
-        MacroRange body = b_parent_exp->IntermediateChildren();
-        bool is_psub = b_macro->Kind() == MacroKind::kParameterSubstitution;
-        if (b_macro == body.Front() && !is_psub) {
-          return result;
-        }
-      }
+  std::sort(sweep.begin(), sweep.end(),
+            [] (const SweepRange &a, const SweepRange &b) {
+              return std::tie(a.ast, a.b_index, a.e_index) <
+                     std::tie(b.ast, b.b_index, b.e_index);
+            });
+
+  // The front walk of the current first token, and the back walks of the last
+  // tokens at or after the current first token, keyed by last token index.
+  const ASTImpl *ast = nullptr;
+  uint64_t b_index = 0u;
+  std::optional<FrontAlignments> front;
+  std::map<uint64_t, BackAlignments> backs;
+
+  for (const SweepRange &range : sweep) {
+    if (range.ast != ast) {
+      ast = range.ast;
+      front.reset();
+      backs.clear();
+    }
 
-      auto b_parent_replacement = b_parent_sub->ReplacementChildren();
-      bool front_aligned = (b_macro == b_parent_replacement.Front());
-      if (!front_aligned) {
-        break;
-      }
+    if (!front || range.b_index != b_index) {
+      b_index = range.b_index;
+      front.emplace(FindFrontAlignments(range.b_tok));
 
-      for (auto e_deriv : e_tok_deriv_chain) {
-        // Here's the rub: If the begin and end tokens ever converge to the same
-        // derived token, then their derivation trees have started mixing. This
-        // can happen if two separate arguments of the macro are invocations of
-        // the same macro definition. To see an example, print the macro graph
-        // of the following invocation code snippet:
-        //
-        // #define ONE 1
-        // #define ADD(x, y) x + y
-        // ADD(ONE, ONE)
-        //
-        // This isn't a problem if the begin and end tokens were the same tokens
-        // to begin with (then of course their derivation trees would be the
-        // same). Otherwise we should exit early, since this mixing might cause
-        // us to return a false positive.
-
-        // NOTE(bpappas): I am fairly certain that returning here will prevent
-        // false positives, but I am not sure if it will create false negatives.
-        if (b_deriv == e_deriv && b_tok != e_tok) {
-          break;
-        }
+      // No later range can end before it begins, so drop the back walks of
+      // the last tokens before this first token.
+      backs.erase(backs.begin(), backs.lower_bound(b_index));
+    }
 
-        std::optional<Macro> e_macro = e_deriv.MacroLocation();
-        if (!e_macro) {
-          continue;
-        }
+    if (front->aligned.empty()) {
+      continue;
+    }
 
-        for (auto e_parent = e_macro->Parent(); e_parent;
-             e_macro = *e_parent, e_parent = e_parent->Parent()) {
-          auto e_parent_sub = MacroSubstitution::From(*e_parent);
-          if (!e_parent_sub) {
-            break;
-          }
-
-          if (auto e_parent_exp = MacroExpansion::From(*e_parent_sub)) {
-            MacroRange body = e_parent_exp->IntermediateChildren();
-            bool is_psub = e_macro->Kind() == MacroKind::kParameterSubstitution;
-            if (e_macro == body.Back() && !is_psub) {
-              break;
-            }
-          }
-
-          auto psub_last_tok = e_parent_sub->LastFullySubstitutedToken();
-          auto e_parent_replacement = e_parent_sub->ReplacementChildren();
-          bool back_aligned = ((e_macro == e_parent_replacement.Back()) ||
-                               (semi && tok_after_e_tok == psub_last_tok));
-
-          if (!back_aligned) {
-            break;
-          }
-
-          if (b_parent == e_parent) {
-            result.push_back(*b_parent_sub);
-          }
-        }
-      }
+    auto back_it = backs.find(range.e_index);
+    if (back_it == backs.end()) {
+      back_it = backs.emplace(
+          range.e_index, FindBackAlignments(range.e_tok, heuristic)).first;
     }
+
+    JoinAlignments(*front, back_it->second, range.b_index == range.e_index,
+                   results[range.range_index]);
   }
 
-  return result;
+  return results;
 }
 
 // Strip off trailing whitespace from a token that has been read.
@@ -162,7 +162,6 @@ class TokenImpl {
   }
 
   std::string_view Data(const ASTImpl &ast) const noexcept;
-  std::string_view Data(const PrintedTokenRangeImpl &range) const noexcept;
 
   inline TokenRole Role(void) const noexcept {
     return static_cast<TokenRole>(role);
@@ -241,14 +240,7 @@ class TokenImpl {
 
   DerivedTokenIndex derived_index{kInvalidDerivedTokenIndex};
 
-  // If this is a `PrintedTokenImpl` in a `PrintedTokenRangeImpl`, then this
-  // represents the index of the token context in
-  // `PrintedTokenRangeImpl::contexts`.
-  //
-  // If this is a `TokenImpl` in a `ASTImpl`, then this represents the index of
-  // a `MacroTokenImpl` in `ASTImpl::root_macro_node.token_nodes`.
-  //
-  // TODO(pag): Split `PrintedTokenImpl` off into its own thing.
+  // The index of a `MacroTokenImpl` in `ASTImpl::root_macro_node.token_nodes`.
   TokenContextIndex context_index{kInvalidTokenContextIndex};
 
   // Offset and length of this token's data. If `data_offset` is positive, then
@@ -0,0 +1,831 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#include <pasta/AST/TokenSnapshot.h>
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wimplicit-int-conversion"
+#pragma clang diagnostic ignored "-Wsign-conversion"
+#pragma clang diagnostic ignored "-Wshorten-64-to-32"
+#include <llvm/Support/MemoryBuffer.h>
+#pragma clang diagnostic pop
+
+#include <pasta/AST/AST.h>
+#include <pasta/AST/Macro.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "AST.h"
+#include "Macro.h"
+#include "Token.h"
+
+namespace pasta {
+namespace {
+
+// NOTE(pag): The format is a header, followed by the sections of fixed-width
+//            records described by the header, followed by one blob of string
+//            data. All offsets in the records are relative to the beginning
+//            of the string data, and all indices are into the other sections.
+//            Everything is in the host's byte order. The magic is a byte
+//            string, and so it matches regardless of byte order, but the
+//            version doesn't, and so loading a snapshot made on a host with a
+//            different byte order fails the version check.
+static constexpr char kMagic[8] = {'P', 'A', 'S', 'T', 'A', 'T', 'O', 'K'};
+static constexpr uint32_t kInvalidIndex = ~0u;
+
+// Entries in `macro_children` with this bit set are token indices, otherwise
+// they are macro node indices.
+static constexpr uint32_t kTokenChildBit = 1u << 31u;
+
+// Sections are aligned to this many bytes, relative to the beginning of the
+// snapshot.
+static constexpr uint64_t kSectionAlignment = 8u;
+
+struct SnapshotHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t main_file;
+  uint32_t num_tokens;
+  uint32_t num_files;
+  uint32_t num_file_tokens;
+  uint32_t num_macros;
+  uint32_t num_macro_children;
+  uint32_t preprocessed_code_len;
+  uint64_t tokens_offset;
+  uint64_t files_offset;
+  uint64_t file_tokens_offset;
+  uint64_t macros_offset;
+  uint64_t macro_children_offset;
+  uint64_t data_offset;
+  uint64_t data_size;
+};
+
+// A parsed token. This mirrors `TokenImpl`.
+struct TokenRecord {
+  uint32_t data_offset;
+  uint32_t data_len;
+  uint32_t derived_index;
+  uint32_t file_token;
+  uint32_t macro;
+  uint16_t kind;
+  uint8_t role;
+  uint8_t is_macro_name;
+};
+
+struct FileRecord {
+  uint64_t data_hash;
+  uint32_t path_offset;
+  uint32_t path_len;
+  uint32_t data_offset;
+  uint32_t data_len;
+  uint32_t first_token;
+  uint32_t num_tokens;
+};
+
+// A file token. This mirrors `FileTokenImpl`, except that `data_offset` is
+// relative to the data of the file.
+struct FileTokenRecord {
+  uint32_t data_offset;
+  uint32_t data_len;
+  uint32_t line;
+  uint32_t file;
+  uint16_t column;
+  uint16_t kind;
+};
+
+// A macro node. Its children are `macro_children[first_child]` through
+// `macro_children[first_child + num_children - 1]`, and they are immediately
+// followed by its replacement children. Macro node `0` is the root, and its
+// children are the top-level macro nodes.
+struct MacroRecord {
+  uint32_t parent;
+  uint32_t first_child;
+  uint32_t num_children;
+  uint32_t num_replacement_children;
+  uint32_t kind;
+};
+
+static_assert(std::is_trivially_copyable_v<SnapshotHeader>);
+static_assert(std::is_trivially_copyable_v<TokenRecord>);
+static_assert(std::is_trivially_copyable_v<FileRecord>);
+static_assert(std::is_trivially_copyable_v<FileTokenRecord>);
+static_assert(std::is_trivially_copyable_v<MacroRecord>);
+
+static void AlignSection(std::string &out) {
+  while (out.size() % kSectionAlignment) {
+    out.push_back('\0');
+  }
+}
+
+// Append a section of records to `out`, returning the section's offset.
+template <typename T>
+static uint64_t AppendSection(std::string &out, const std::vector<T> &records) {
+  AlignSection(out);
+  const uint64_t offset = out.size();
+  out.append(reinterpret_cast<const char *>(records.data()),
+             records.size() * sizeof(T));
+  return offset;
+}
+
+// Serializes the tokens, macros, and files of an AST.
+class SnapshotWriter {
+ public:
+  ASTImpl &ast;
+
+  std::vector<TokenRecord> tokens;
+  std::vector<FileRecord> files;
+  std::vector<FileTokenRecord> file_tokens;
+  std::vector<MacroRecord> macros;
+  std::vector<uint32_t> macro_children;
+  std::string data;
+
+  // Maps `FileImpl`s to indices in `files`.
+  std::unordered_map<const void *, uint32_t> file_indices;
+
+  // Maps macro nodes to indices in `macros`.
+  std::unordered_map<const MacroNodeImpl *, uint32_t> macro_indices;
+
+  // Macro nodes whose children need to be added.
+  std::vector<std::pair<const MacroNodeImpl *, uint32_t>> pending_macros;
+
+  // Offset of `ASTImpl::backup_token_data` in `data`.
+  size_t backup_data_offset{0u};
+
+  // Set if any count or offset doesn't fit into 32 bits, i.e. if the
+  // translation unit is too big to be snapshotted.
+  bool too_big{false};
+
+  explicit SnapshotWriter(ASTImpl &ast_)
+      : ast(ast_) {}
+
+  uint32_t CheckedSize(size_t size) {
+    if (size >= std::numeric_limits<uint32_t>::max()) {
+      too_big = true;
+      return 0u;
+    }
+    return static_cast<uint32_t>(size);
+  }
+
+  uint32_t AppendData(std::string_view str) {
+    const uint32_t offset = CheckedSize(data.size());
+    data.append(str);
+    return offset;
+  }
+
+  uint32_t AddFile(const File &file) {
+    if (auto it = file_indices.find(file.RawFile()); it != file_indices.end()) {
+      return it->second;
+    }
+
+    const auto file_index = CheckedSize(files.size());
+    file_indices.emplace(file.RawFile(), file_index);
+
+    FileRecord record = {};
+    record.data_hash = file.DataHash().value_or(0u);
+
+    const std::string path = file.Path().generic_string();
+    record.path_offset = AppendData(path);
+    record.path_len = CheckedSize(path.size());
+
+    std::string_view file_data;
+    if (auto maybe_data = file.Data(); maybe_data.Succeeded()) {
+      file_data = maybe_data.Value();
+    }
+    record.data_offset = AppendData(file_data);
+    record.data_len = CheckedSize(file_data.size());
+
+    record.first_token = CheckedSize(file_tokens.size());
+    for (const FileToken &tok : file.Tokens()) {
+
+      // NOTE(pag): End-of-file tokens point just past the end of the data.
+      FileTokenRecord tok_record = {};
+      tok_record.data_offset = std::min(tok.Offset(), record.data_len);
+      tok_record.data_len = std::min<uint32_t>(
+          CheckedSize(tok.Data().size()),
+          record.data_len - tok_record.data_offset);
+      tok_record.line = tok.Line();
+      tok_record.file = file_index;
+      tok_record.column = static_cast<uint16_t>(tok.Column());
+      tok_record.kind = static_cast<uint16_t>(tok.Kind());
+      file_tokens.push_back(tok_record);
+    }
+    record.num_tokens = CheckedSize(file_tokens.size()) - record.first_token;
+    files.push_back(record);
+    return file_index;
+  }
+
+  // Append `node` to the children of a macro, returning the number of
+  // appended children.
+  uint32_t AddChild(const Node &node, uint32_t parent_index) {
+    if (std::holds_alternative<MacroTokenImpl *>(node)) {
+      const MacroTokenImpl *tok = std::get<MacroTokenImpl *>(node);
+      macro_children.push_back(kTokenChildBit | tok->token_offset);
+      return 1u;
+
+    } else if (std::holds_alternative<MacroNodeImpl *>(node)) {
+      const MacroNodeImpl *sub_node = std::get<MacroNodeImpl *>(node);
+      const auto macro_index = CheckedSize(macros.size());
+      MacroRecord record = {};
+      record.parent = parent_index;
+      record.kind = static_cast<uint32_t>(sub_node->kind);
+      macros.push_back(record);
+      macro_indices.emplace(sub_node, macro_index);
+      pending_macros.emplace_back(sub_node, macro_index);
+      macro_children.push_back(macro_index);
+      return 1u;
+
+    } else {
+      return 0u;
+    }
+  }
+
+  uint32_t AddChildren(const NodeList &nodes, uint32_t parent_index) {
+    uint32_t num_children = 0u;
+    for (const Node &node : nodes) {
+      num_children += AddChild(node, parent_index);
+    }
+    return num_children;
+  }
+
+  // Add the macro node tree. The children of each node are contiguous, and so
+  // we add the children of one node at a time.
+  void AddMacros(void) {
+    MacroRecord root = {};
+    root.parent = kInvalidIndex;
+    root.kind = static_cast<uint32_t>(MacroKind::kOtherDirective);
+    macros.push_back(root);
+    pending_macros.emplace_back(&(ast.root_macro_node), 0u);
+
+    while (!pending_macros.empty()) {
+      const auto [node, macro_index] = pending_macros.back();
+      pending_macros.pop_back();
+
+      const NodeList *children = &(node->nodes);
+      const NodeList *replacement_children = nullptr;
+
+      // NOTE(pag): This mirrors `Macro::Children` and
+      //            `MacroSubstitution::ReplacementChildren`.
+      if (auto sub = dynamic_cast<const MacroSubstitutionImpl *>(node)) {
+        children = &(sub->use_nodes);
+        replacement_children = &(sub->nodes);
+      }
+
+      const auto first_child = CheckedSize(macro_children.size());
+      const auto num_children = AddChildren(*children, macro_index);
+      const auto num_replacement_children =
+          replacement_children ?
+          AddChildren(*replacement_children, macro_index) : 0u;
+
+      MacroRecord &record = macros[macro_index];
+      record.first_child = first_child;
+      record.num_children = num_children;
+      record.num_replacement_children = num_replacement_children;
+    }
+  }
+
+  // Return the index of the macro node containing the macro token of `tok`.
+  // This mirrors `Token::MacroLocation`.
+  uint32_t MacroOf(const TokenImpl &tok) {
+    switch (tok.Role()) {
+      case TokenRole::kEndOfInternalMacroEventMarker:
+      case TokenRole::kInitialMacroUseToken:
+      case TokenRole::kIntermediateMacroExpansionToken:
+      case TokenRole::kFinalMacroExpansionToken:
+        break;
+      default:
+        return kInvalidIndex;
+    }
+
+    const NodeList &token_nodes = ast.root_macro_node.token_nodes;
+    if (tok.context_index >= token_nodes.size()) {
+      return kInvalidIndex;
+    }
+
+    const Node &node = token_nodes[tok.context_index];
+    if (!std::holds_alternative<MacroTokenImpl *>(node)) {
+      return kInvalidIndex;
+    }
+
+    const Node &parent = std::get<MacroTokenImpl *>(node)->parent;
+    if (!std::holds_alternative<MacroNodeImpl *>(parent)) {
+      return kInvalidIndex;
+    }
+
+    auto it = macro_indices.find(std::get<MacroNodeImpl *>(parent));
+    return it != macro_indices.end() ? it->second : kInvalidIndex;
+  }
+
+  // Return the index of the file token of `tok`.
+  uint32_t FileTokenOf(const TokenImpl &tok) {
+    const std::optional<FileToken> file_tok = ast.TokenAt(&tok).FileLocation();
+    if (!file_tok) {
+      return kInvalidIndex;
+    }
+
+    auto it = file_indices.find(file_tok->RawFile());
+    if (it == file_indices.end()) {
+      return kInvalidIndex;
+    }
+
+    const FileRecord &file = files[it->second];
+    if (file_tok->Index() >= file.num_tokens) {
+      return kInvalidIndex;
+    }
+    return file.first_token + static_cast<uint32_t>(file_tok->Index());
+  }
+
+  void AddTokens(void) {
+    tokens.reserve(ast.tokens.size());
+    for (size_t i = 0u, max_i = ast.tokens.size(); i < max_i; ++i) {
+      const TokenImpl &tok = ast.tokens[i];
+
+      TokenRecord record = {};
+      if (tok.data_len && 0 <= tok.data_offset) {
+        record.data_offset = static_cast<uint32_t>(tok.data_offset);
+      } else if (tok.data_len) {
+        record.data_offset = CheckedSize(
+            backup_data_offset + static_cast<uint32_t>(-tok.data_offset));
+      }
+      record.data_len = tok.data_len;
+      record.derived_index =
+          tok.derived_index < i ? tok.derived_index : kInvalidIndex;
+      record.file_token = FileTokenOf(tok);
+      record.macro = MacroOf(tok);
+      record.kind = static_cast<uint16_t>(tok.kind);
+      record.role = static_cast<uint8_t>(tok.role);
+      record.is_macro_name = static_cast<uint8_t>(tok.is_macro_name);
+      tokens.push_back(record);
+    }
+  }
+
+  Result<std::string, std::error_code> Serialize(void) {
+
+    // NOTE(pag): The pre-processed code must come first, as its offset is
+    //            implicitly zero. The data of tokens is either in the
+    //            pre-processed code, or in the backup token data.
+    AppendData(ast.preprocessed_code);
+    backup_data_offset = AppendData(ast.backup_token_data);
+
+    for (const File &file : ast.parsed_files) {
+      AddFile(file);
+    }
+    const uint32_t main_file = AddFile(ast.main_source_file);
+
+    AddMacros();
+    AddTokens();
+
+    SnapshotHeader header = {};
+    memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = TokenSnapshot::kVersion;
+    header.main_file = main_file;
+    header.num_tokens = CheckedSize(tokens.size());
+    header.num_files = CheckedSize(files.size());
+    header.num_file_tokens = CheckedSize(file_tokens.size());
+    header.num_macros = CheckedSize(macros.size());
+    header.num_macro_children = CheckedSize(macro_children.size());
+    header.preprocessed_code_len = CheckedSize(ast.preprocessed_code.size());
+
+    if (too_big) {
+      return std::make_error_code(std::errc::value_too_large);
+    }
+
+    std::string out(sizeof(header), '\0');
+    header.tokens_offset = AppendSection(out, tokens);
+    header.files_offset = AppendSection(out, files);
+    header.file_tokens_offset = AppendSection(out, file_tokens);
+    header.macros_offset = AppendSection(out, macros);
+    header.macro_children_offset = AppendSection(out, macro_children);
+    AlignSection(out);
+    header.data_offset = out.size();
+    header.data_size = data.size();
+    out.append(data);
+
+    memcpy(out.data(), &header, sizeof(header));
+    return out;
+  }
+};
+
+}  // namespace
+
+// Backing implementation of a loaded token snapshot.
+class TokenSnapshotImpl {
+ public:
+  // Backing storage of the snapshot. This is either a memory-mapped file, a
+  // string, or an aligned copy of one of the former.
+  std::unique_ptr<llvm::MemoryBuffer> mapped_data;
+  std::string owned_data;
+  std::unique_ptr<uint64_t[]> aligned_data;
+
+  const SnapshotHeader *header{nullptr};
+  const TokenRecord *tokens{nullptr};
+  const FileRecord *files{nullptr};
+  const FileTokenRecord *file_tokens{nullptr};
+  const MacroRecord *macros{nullptr};
+  const uint32_t *macro_children{nullptr};
+  const char *data{nullptr};
+
+  inline std::string_view Data(uint32_t offset, uint32_t len) const noexcept {
+    return std::string_view(&(data[offset]), len);
+  }
+
+  // Validate and adopt the snapshot in `[begin, begin + size)`. All indices
+  // and offsets are checked here, so that the accessors don't need to.
+  std::error_code Init(const char *begin, size_t size);
+};
+
+namespace {
+
+template <typename T>
+static bool InitSection(const char *begin, size_t size, uint64_t offset,
+                        uint32_t count, const T **out) {
+  if (offset % kSectionAlignment || offset > size ||
+      ((size - offset) / sizeof(T)) < count) {
+    return false;
+  }
+  *out = reinterpret_cast<const T *>(&(begin[offset]));
+  return true;
+}
+
+static bool IsInRange(uint64_t offset, uint64_t len, uint64_t size) {
+  return offset <= size && len <= (size - offset);
+}
+
+}  // namespace
+
+std::error_code TokenSnapshotImpl::Init(const char *begin, size_t size) {
+  const auto bad_format = std::make_error_code(std::errc::invalid_argument);
+
+  // Make sure the sections can be accessed in-place.
+  if (reinterpret_cast<uintptr_t>(begin) % kSectionAlignment) {
+    aligned_data.reset(
+        new uint64_t[(size + sizeof(uint64_t) - 1u) / sizeof(uint64_t)]);
+    memcpy(aligned_data.get(), begin, size);
+    begin = reinterpret_cast<const char *>(aligned_data.get());
+  }
+
+  if (size < sizeof(SnapshotHeader)) {
+    return bad_format;
+  }
+
+  header = reinterpret_cast<const SnapshotHeader *>(begin);
+  if (memcmp(header->magic, kMagic, sizeof(kMagic))) {
+    return bad_format;
+  }
+
+  if (header->version != TokenSnapshot::kVersion) {
+    return std::make_error_code(std::errc::not_supported);
+  }
+
+  if (!InitSection(begin, size, header->tokens_offset, header->num_tokens,
+                   &tokens) ||
+      !InitSection(begin, size, header->files_offset, header->num_files,
+                   &files) ||
+      !InitSection(begin, size, header->file_tokens_offset,
+                   header->num_file_tokens, &file_tokens) ||
+      !InitSection(begin, size, header->macros_offset, header->num_macros,
+                   &macros) ||
+      !InitSection(begin, size, header->macro_children_offset,
+                   header->num_macro_children, &macro_children) ||
+      !IsInRange(header->data_offset, header->data_size, size) ||
+      header->preprocessed_code_len > header->data_size ||
+      header->main_file >= header->num_files ||
+      !header->num_macros) {
+    return bad_format;
+  }
+
+  data = &(begin[header->data_offset]);
+  const uint64_t data_size = header->data_size;
+
+  for (uint32_t i = 0u; i < header->num_files; ++i) {
+    const FileRecord &file = files[i];
+    if (!IsInRange(file.path_offset, file.path_len, data_size) ||
+        !IsInRange(file.data_offset, file.data_len, data_size) ||
+        !IsInRange(file.first_token, file.num_tokens,
+                   header->num_file_tokens)) {
+      return bad_format;
+    }
+  }
+
+  for (uint32_t i = 0u; i < header->num_file_tokens; ++i) {
+    const FileTokenRecord &tok = file_tokens[i];
+    if (tok.file >= header->num_files) {
+      return bad_format;
+    }
+    const FileRecord &file = files[tok.file];
+    if (i < file.first_token || (i - file.first_token) >= file.num_tokens ||
+        !IsInRange(tok.data_offset, tok.data_len, file.data_len)) {
+      return bad_format;
+    }
+  }
+
+  for (uint32_t i = 0u; i < header->num_tokens; ++i) {
+    const TokenRecord &tok = tokens[i];
+    if (!IsInRange(tok.data_offset, tok.data_len, data_size) ||
+        (tok.derived_index != kInvalidIndex && tok.derived_index >= i) ||
+        (tok.file_token != kInvalidIndex &&
+         tok.file_token >= header->num_file_tokens) ||
+        (tok.macro != kInvalidIndex &&
+         (!tok.macro || tok.macro >= header->num_macros)) ||
+        tok.role > static_cast<uint8_t>(
+            TokenRole::kEndOfInternalMacroEventMarker)) {
+      return bad_format;
+    }
+  }
+
+  for (uint32_t i = 0u; i < header->num_macros; ++i) {
+    const MacroRecord &macro = macros[i];
+    if ((i && macro.parent >= header->num_macros) ||
+        (!i && macro.parent != kInvalidIndex) ||
+        macro.kind > std::numeric_limits<
+            std::underlying_type_t<MacroKind>>::max() ||
+        !IsInRange(macro.first_child,
+                   uint64_t(macro.num_children) +
+                       macro.num_replacement_children,
+                   header->num_macro_children)) {
+      return bad_format;
+    }
+  }
+
+  for (uint32_t i = 0u; i < header->num_macro_children; ++i) {
+    const uint32_t child = macro_children[i];
+    if (child & kTokenChildBit) {
+      if ((child & ~kTokenChildBit) >= header->num_tokens) {
+        return bad_format;
+      }
+    } else if (!child || child >= header->num_macros) {
+      return bad_format;
+    }
+  }
+
+  return {};
+}
+
+Result<std::string, std::error_code> TokenSnapshot::Serialize(
+    const AST &ast) {
+  return SnapshotWriter(*(ast.impl)).Serialize();
+}
+
+Result<std::string, std::error_code> TokenSnapshot::Serialize(
+    const PreprocessedTranslationUnit &tu) {
+  return SnapshotWriter(*(tu.impl)).Serialize();
+}
+
+// Memory-map and validate the serialized token snapshot in the file at `path`,
+// starting `offset` bytes into the file.
+//
+// NOTE(pag): `llvm::MemoryBuffer` only memory-maps files that are at least a
+//            page in size, and reads smaller ones into memory. Slices are
+//            mapped from the page containing `offset`, so an `offset` that is
+//            a multiple of eight keeps the sections aligned.
+Result<TokenSnapshot, std::error_code> TokenSnapshot::Load(
+    const std::filesystem::path &path, uint64_t offset) {
+  llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> maybe_buffer;
+  if (!offset) {
+    maybe_buffer = llvm::MemoryBuffer::getFile(
+        path.string(), false  /* IsText */,
+        false  /* RequiresNullTerminator */);
+
+  } else {
+    std::error_code ec;
+    const uint64_t size = std::filesystem::file_size(path, ec);
+    if (ec) {
+      return ec;
+    } else if (offset > size) {
+      return std::make_error_code(std::errc::invalid_argument);
+    }
+    maybe_buffer = llvm::MemoryBuffer::getFileSlice(
+        path.string(), size - offset, offset);
+  }
+
+  if (!maybe_buffer) {
+    return maybe_buffer.getError();
+  }
+
+  auto impl = std::make_shared<TokenSnapshotImpl>();
+  impl->mapped_data = std::move(maybe_buffer.get());
+  if (auto ec = impl->Init(impl->mapped_data->getBufferStart(),
+                           impl->mapped_data->getBufferSize())) {
+    return ec;
+  }
+  return TokenSnapshot(std::move(impl));
+}
+
+// Validate the serialized token snapshot in `data`, taking ownership of it.
+Result<TokenSnapshot, std::error_code> TokenSnapshot::Load(std::string data) {
+  auto impl = std::make_shared<TokenSnapshotImpl>();
+  impl->owned_data.swap(data);
+  if (auto ec = impl->Init(impl->owned_data.data(),
+                           impl->owned_data.size())) {
+    return ec;
+  }
+  return TokenSnapshot(std::move(impl));
+}
+
+TokenSnapshotFile TokenSnapshot::MainFile(void) const noexcept {
+  return TokenSnapshotFile(impl, impl->header->main_file);
+}
+
+uint32_t TokenSnapshot::NumFiles(void) const noexcept {
+  return impl->header->num_files;
+}
+
+std::optional<TokenSnapshotFile> TokenSnapshot::File(
+    uint32_t index) const noexcept {
+  if (index < impl->header->num_files) {
+    return TokenSnapshotFile(impl, index);
+  }
+  return std::nullopt;
+}
+
+uint32_t TokenSnapshot::NumTokens(void) const noexcept {
+  return impl->header->num_tokens;
+}
+
+std::optional<TokenSnapshotToken> TokenSnapshot::Token(
+    uint32_t index) const noexcept {
+  if (index < impl->header->num_tokens) {
+    return TokenSnapshotToken(impl, index);
+  }
+  return std::nullopt;
+}
+
+uint32_t TokenSnapshot::NumMacros(void) const noexcept {
+  return impl->macros[0].num_children;
+}
+
+std::optional<TokenSnapshotMacroChild> TokenSnapshot::Macro(
+    uint32_t index) const noexcept {
+  const MacroRecord &root = impl->macros[0];
+  if (index < root.num_children) {
+    return TokenSnapshotMacro::DecodeChild(
+        impl, impl->macro_children[root.first_child + index]);
+  }
+  return std::nullopt;
+}
+
+std::string_view TokenSnapshot::PreprocessedCode(void) const noexcept {
+  return impl->Data(0u, impl->header->preprocessed_code_len);
+}
+
+TokenKind TokenSnapshotFileToken::Kind(void) const noexcept {
+  return static_cast<TokenKind>(impl->file_tokens[index].kind);
+}
+
+std::string_view TokenSnapshotFileToken::Data(void) const noexcept {
+  const FileTokenRecord &tok = impl->file_tokens[index];
+  const FileRecord &file = impl->files[tok.file];
+  return impl->Data(file.data_offset + tok.data_offset, tok.data_len);
+}
+
+unsigned TokenSnapshotFileToken::Line(void) const noexcept {
+  return impl->file_tokens[index].line;
+}
+
+unsigned TokenSnapshotFileToken::Column(void) const noexcept {
+  return impl->file_tokens[index].column;
+}
+
+unsigned TokenSnapshotFileToken::Offset(void) const noexcept {
+  return impl->file_tokens[index].data_offset;
+}
+
+uint32_t TokenSnapshotFileToken::Index(void) const noexcept {
+  const FileTokenRecord &tok = impl->file_tokens[index];
+  return index - impl->files[tok.file].first_token;
+}
+
+TokenSnapshotFile TokenSnapshotFileToken::File(void) const noexcept {
+  return TokenSnapshotFile(impl, impl->file_tokens[index].file);
+}
+
+std::filesystem::path TokenSnapshotFile::Path(void) const noexcept {
+  const FileRecord &file = impl->files[index];
+  return std::filesystem::path(impl->Data(file.path_offset, file.path_len));
+}
+
+std::string_view TokenSnapshotFile::Data(void) const noexcept {
+  const FileRecord &file = impl->files[index];
+  return impl->Data(file.data_offset, file.data_len);
+}
+
+uint64_t TokenSnapshotFile::DataHash(void) const noexcept {
+  return impl->files[index].data_hash;
+}
+
+uint32_t TokenSnapshotFile::NumTokens(void) const noexcept {
+  return impl->files[index].num_tokens;
+}
+
+std::optional<TokenSnapshotFileToken> TokenSnapshotFile::Token(
+    uint32_t token_index) const noexcept {
+  const FileRecord &file = impl->files[index];
+  if (token_index < file.num_tokens) {
+    return TokenSnapshotFileToken(impl, file.first_token + token_index);
+  }
+  return std::nullopt;
+}
+
+TokenKind TokenSnapshotToken::Kind(void) const noexcept {
+  return static_cast<TokenKind>(impl->tokens[index].kind);
+}
+
+TokenRole TokenSnapshotToken::Role(void) const noexcept {
+  return static_cast<TokenRole>(impl->tokens[index].role);
+}
+
+std::string_view TokenSnapshotToken::Data(void) const noexcept {
+  const TokenRecord &tok = impl->tokens[index];
+  return impl->Data(tok.data_offset, tok.data_len);
+}
+
+bool TokenSnapshotToken::IsMacroName(void) const noexcept {
+  return impl->tokens[index].is_macro_name;
+}
+
+std::optional<TokenSnapshotFileToken>
+TokenSnapshotToken::FileLocation(void) const noexcept {
+  const TokenRecord &tok = impl->tokens[index];
+  if (tok.file_token != kInvalidIndex) {
+    return TokenSnapshotFileToken(impl, tok.file_token);
+  }
+  return std::nullopt;
+}
+
+std::optional<TokenSnapshotToken>
+TokenSnapshotToken::DerivedLocation(void) const noexcept {
+  const TokenRecord &tok = impl->tokens[index];
+  if (tok.derived_index != kInvalidIndex) {
+    return TokenSnapshotToken(impl, tok.derived_index);
+  }
+  return std::nullopt;
+}
+
+std::optional<TokenSnapshotMacro>
+TokenSnapshotToken::Macro(void) const noexcept {
+  const TokenRecord &tok = impl->tokens[index];
+  if (tok.macro != kInvalidIndex) {
+    return TokenSnapshotMacro(impl, tok.macro);
+  }
+  return std::nullopt;
+}
+
+TokenSnapshotMacroChild TokenSnapshotMacro::DecodeChild(
+    const std::shared_ptr<const TokenSnapshotImpl> &impl, uint32_t child) {
+  if (child & kTokenChildBit) {
+    return TokenSnapshotToken(impl, child & ~kTokenChildBit);
+  }
+  return TokenSnapshotMacro(impl, child);
+}
+
+MacroKind TokenSnapshotMacro::Kind(void) const noexcept {
+  return static_cast<MacroKind>(impl->macros[index].kind);
+}
+
+// NOTE(pag): The root macro node isn't exposed, and so the top-level macro
+//            nodes don't have parents.
+std::optional<TokenSnapshotMacro>
+TokenSnapshotMacro::Parent(void) const noexcept {
+  const MacroRecord &macro = impl->macros[index];
+  if (macro.parent && macro.parent != kInvalidIndex) {
+    return TokenSnapshotMacro(impl, macro.parent);
+  }
+  return std::nullopt;
+}
+
+uint32_t TokenSnapshotMacro::NumChildren(void) const noexcept {
+  return impl->macros[index].num_children;
+}
+
+std::optional<TokenSnapshotMacroChild> TokenSnapshotMacro::Child(
+    uint32_t child_index) const noexcept {
+  const MacroRecord &macro = impl->macros[index];
+  if (child_index < macro.num_children) {
+    return DecodeChild(impl, impl->macro_children[macro.first_child +
+                                                  child_index]);
+  }
+  return std::nullopt;
+}
+
+uint32_t TokenSnapshotMacro::NumReplacementChildren(void) const noexcept {
+  return impl->macros[index].num_replacement_children;
+}
+
+std::optional<TokenSnapshotMacroChild> TokenSnapshotMacro::ReplacementChild(
+    uint32_t child_index) const noexcept {
+  const MacroRecord &macro = impl->macros[index];
+  if (child_index < macro.num_replacement_children) {
+    return DecodeChild(impl, impl->macro_children[macro.first_child +
+                                                  macro.num_children +
+                                                  child_index]);
+  }
+  return std::nullopt;
+}
+
+}  // namespace pasta
@@ -28,8 +28,8 @@
 #define PASTA_DEFINE_BASE_OPERATORS(base, derived) \
     std::optional<class derived> derived::From(const class base &that) { \
       assert(that.ast.get() != nullptr); \
-      if (auto type_ptr = clang::dyn_cast_or_null<clang::derived>(that.u.Type)) { \
-        return TypeBuilder::Create<class derived>(that.ast, type_ptr, that.qualifiers); \
+      if (that.Is<class derived>()) { \
+        return TypeBuilder::Create<class derived>(that.ast, that.u.Type, that.qualifiers); \
       } else { \
         return std::nullopt; \
       } \
@@ -3309,16 +3309,10 @@ bool ObjCObjectPointerType::IsUnspecializedAsWritten(void) const {
 // 0: ObjCObjectPointerType::
 // 0: ObjCObjectPointerType::
 // 0: ObjCObjectPointerType::
-std::vector<::pasta::ObjCProtocolDecl> ObjCObjectPointerType::Qualifiers(void) const {
+::pasta::LazyRange<::pasta::ObjCProtocolDecl> ObjCObjectPointerType::Qualifiers(void) const {
   auto &self = *const_cast<clang::ObjCObjectPointerType *>(u.ObjCObjectPointerType);
   decltype(auto) val = self.quals();
-  std::vector<::pasta::ObjCProtocolDecl> ret;
-  for (auto decl_ptr : val) {
-    if (decl_ptr) {
-      ret.emplace_back(DeclBuilder::Create<::pasta::ObjCProtocolDecl>(ast, decl_ptr));
-    }
-  }
-  return ret;
+  return LazyRangeBuilder::Create<::pasta::ObjCProtocolDecl, DeclBuilder>(ast, val);
 }
 
 ::pasta::ObjCObjectPointerType ObjCObjectPointerType::StripObjCKindOfTypeAndQualifiers(void) const {
@@ -4691,5 +4685,779 @@ bool RecordType::IsSugared(void) const {
   return val;
 }
 
+::pasta::TypeSnapshot Type::Snapshot(void) const {
+  ::pasta::TypeSnapshot snapshot;
+  snapshot.accepts_obj_c_type_parameters = Type::AcceptsObjCTypeParameters();
+  snapshot.can_decay_to_pointer_type = Type::CanDecayToPointerType();
+  snapshot.can_have_nullability = Type::CanHaveNullability();
+  snapshot.contains_errors = Type::ContainsErrors();
+  snapshot.contains_unexpanded_parameter_pack = Type::ContainsUnexpandedParameterPack();
+  snapshot.linkage = Type::Linkage();
+  snapshot.visibility = Type::Visibility();
+  snapshot.has_auto_for_trailing_return_type = Type::HasAutoForTrailingReturnType();
+  snapshot.has_floating_representation = Type::HasFloatingRepresentation();
+  snapshot.has_integer_representation = Type::HasIntegerRepresentation();
+  snapshot.has_obj_c_pointer_representation = Type::HasObjCPointerRepresentation();
+  snapshot.has_pointer_representation = Type::HasPointerRepresentation();
+  snapshot.has_signed_integer_representation = Type::HasSignedIntegerRepresentation();
+  snapshot.has_sized_vla_type = Type::HasSizedVLAType();
+  snapshot.has_unnamed_or_local_type = Type::HasUnnamedOrLocalType();
+  snapshot.has_unsigned_integer_representation = Type::HasUnsignedIntegerRepresentation();
+  snapshot.is_align_value_t = Type::IsAlignValueT();
+  snapshot.is_any_character_type = Type::IsAnyCharacterType();
+  snapshot.is_any_complex_type = Type::IsAnyComplexType();
+  snapshot.is_any_pointer_type = Type::IsAnyPointerType();
+  snapshot.is_arithmetic_type = Type::IsArithmeticType();
+  snapshot.is_array_type = Type::IsArrayType();
+  snapshot.is_atomic_type = Type::IsAtomicType();
+  snapshot.is_b_float16_type = Type::IsBFloat16Type();
+  snapshot.is_bit_int_type = Type::IsBitIntType();
+  snapshot.is_block_compatible_obj_c_pointer_type = Type::IsBlockCompatibleObjCPointerType();
+  snapshot.is_block_pointer_type = Type::IsBlockPointerType();
+  snapshot.is_boolean_type = Type::IsBooleanType();
+  snapshot.is_builtin_type = Type::IsBuiltinType();
+  snapshot.is_carc_bridgable_type = Type::IsCARCBridgableType();
+  snapshot.is_cuda_device_builtin_surface_type = Type::IsCUDADeviceBuiltinSurfaceType();
+  snapshot.is_cuda_device_builtin_texture_type = Type::IsCUDADeviceBuiltinTextureType();
+  snapshot.is_canonical_unqualified = Type::IsCanonicalUnqualified();
+  snapshot.is_char16_type = Type::IsChar16Type();
+  snapshot.is_char32_type = Type::IsChar32Type();
+  snapshot.is_char8_type = Type::IsChar8Type();
+  snapshot.is_character_type = Type::IsCharacterType();
+  snapshot.is_class_type = Type::IsClassType();
+  snapshot.is_clk_event_t = Type::IsClkEventT();
+  snapshot.is_complex_integer_type = Type::IsComplexIntegerType();
+  snapshot.is_complex_type = Type::IsComplexType();
+  snapshot.is_compound_type = Type::IsCompoundType();
+  snapshot.is_constant_array_type = Type::IsConstantArrayType();
+  snapshot.is_constant_matrix_type = Type::IsConstantMatrixType();
+  snapshot.is_decltype_type = Type::IsDecltypeType();
+  snapshot.is_dependent_address_space_type = Type::IsDependentAddressSpaceType();
+  snapshot.is_dependent_sized_array_type = Type::IsDependentSizedArrayType();
+  snapshot.is_dependent_type = Type::IsDependentType();
+  snapshot.is_elaborated_type_specifier = Type::IsElaboratedTypeSpecifier();
+  snapshot.is_enumeral_type = Type::IsEnumeralType();
+  snapshot.is_event_t = Type::IsEventT();
+  snapshot.is_ext_vector_boolean_type = Type::IsExtVectorBooleanType();
+  snapshot.is_ext_vector_type = Type::IsExtVectorType();
+  snapshot.is_fixed_point_or_integer_type = Type::IsFixedPointOrIntegerType();
+  snapshot.is_fixed_point_type = Type::IsFixedPointType();
+  snapshot.is_float128_type = Type::IsFloat128Type();
+  snapshot.is_float16_type = Type::IsFloat16Type();
+  snapshot.is_floating_type = Type::IsFloatingType();
+  snapshot.is_from_ast = Type::IsFromAST();
+  snapshot.is_function_no_proto_type = Type::IsFunctionNoProtoType();
+  snapshot.is_function_pointer_type = Type::IsFunctionPointerType();
+  snapshot.is_function_proto_type = Type::IsFunctionProtoType();
+  snapshot.is_function_reference_type = Type::IsFunctionReferenceType();
+  snapshot.is_function_type = Type::IsFunctionType();
+  snapshot.is_fundamental_type = Type::IsFundamentalType();
+  snapshot.is_half_type = Type::IsHalfType();
+  snapshot.is_ibm128_type = Type::IsIbm128Type();
+  snapshot.is_image_type = Type::IsImageType();
+  snapshot.is_incomplete_array_type = Type::IsIncompleteArrayType();
+  snapshot.is_incomplete_or_object_type = Type::IsIncompleteOrObjectType();
+  snapshot.is_incomplete_type = Type::IsIncompleteType();
+  snapshot.is_instantiation_dependent_type = Type::IsInstantiationDependentType();
+  snapshot.is_integer_type = Type::IsIntegerType();
+  snapshot.is_integral_or_enumeration_type = Type::IsIntegralOrEnumerationType();
+  snapshot.is_integral_or_unscoped_enumeration_type = Type::IsIntegralOrUnscopedEnumerationType();
+  snapshot.is_integral_type = Type::IsIntegralType();
+  snapshot.is_interface_type = Type::IsInterfaceType();
+  snapshot.is_l_value_reference_type = Type::IsLValueReferenceType();
+  snapshot.is_linkage_valid = Type::IsLinkageValid();
+  snapshot.is_matrix_type = Type::IsMatrixType();
+  snapshot.is_member_data_pointer_type = Type::IsMemberDataPointerType();
+  snapshot.is_member_function_pointer_type = Type::IsMemberFunctionPointerType();
+  snapshot.is_member_pointer_type = Type::IsMemberPointerType();
+  snapshot.is_non_overload_placeholder_type = Type::IsNonOverloadPlaceholderType();
+  snapshot.is_nothrow_t = Type::IsNothrowT();
+  snapshot.is_null_pointer_type = Type::IsNullPointerType();
+  snapshot.is_ocl_ext_opaque_type = Type::IsOCLExtOpaqueType();
+  snapshot.is_ocl_image_1d_array_ro_type = Type::IsOCLImage1dArrayROType();
+  snapshot.is_ocl_image_1d_array_rw_type = Type::IsOCLImage1dArrayRWType();
+  snapshot.is_ocl_image_1d_array_wo_type = Type::IsOCLImage1dArrayWOType();
+  snapshot.is_ocl_image_1d_buffer_ro_type = Type::IsOCLImage1dBufferROType();
+  snapshot.is_ocl_image_1d_buffer_rw_type = Type::IsOCLImage1dBufferRWType();
+  snapshot.is_ocl_image_1d_buffer_wo_type = Type::IsOCLImage1dBufferWOType();
+  snapshot.is_ocl_image_1d_ro_type = Type::IsOCLImage1dROType();
+  snapshot.is_ocl_image_1d_rw_type = Type::IsOCLImage1dRWType();
+  snapshot.is_ocl_image_1d_wo_type = Type::IsOCLImage1dWOType();
+  snapshot.is_ocl_image_2d_array_depth_ro_type = Type::IsOCLImage2dArrayDepthROType();
+  snapshot.is_ocl_image_2d_array_depth_rw_type = Type::IsOCLImage2dArrayDepthRWType();
+  snapshot.is_ocl_image_2d_array_depth_wo_type = Type::IsOCLImage2dArrayDepthWOType();
+  snapshot.is_ocl_image_2d_array_msaa_depth_ro_type = Type::IsOCLImage2dArrayMSAADepthROType();
+  snapshot.is_ocl_image_2d_array_msaa_depth_rw_type = Type::IsOCLImage2dArrayMSAADepthRWType();
+  snapshot.is_ocl_image_2d_array_msaa_depth_wo_type = Type::IsOCLImage2dArrayMSAADepthWOType();
+  snapshot.is_ocl_image_2d_array_msaaro_type = Type::IsOCLImage2dArrayMSAAROType();
+  snapshot.is_ocl_image_2d_array_msaarw_type = Type::IsOCLImage2dArrayMSAARWType();
+  snapshot.is_ocl_image_2d_array_msaawo_type = Type::IsOCLImage2dArrayMSAAWOType();
+  snapshot.is_ocl_image_2d_array_ro_type = Type::IsOCLImage2dArrayROType();
+  snapshot.is_ocl_image_2d_array_rw_type = Type::IsOCLImage2dArrayRWType();
+  snapshot.is_ocl_image_2d_array_wo_type = Type::IsOCLImage2dArrayWOType();
+  snapshot.is_ocl_image_2d_depth_ro_type = Type::IsOCLImage2dDepthROType();
+  snapshot.is_ocl_image_2d_depth_rw_type = Type::IsOCLImage2dDepthRWType();
+  snapshot.is_ocl_image_2d_depth_wo_type = Type::IsOCLImage2dDepthWOType();
+  snapshot.is_ocl_image_2d_msaa_depth_ro_type = Type::IsOCLImage2dMSAADepthROType();
+  snapshot.is_ocl_image_2d_msaa_depth_rw_type = Type::IsOCLImage2dMSAADepthRWType();
+  snapshot.is_ocl_image_2d_msaa_depth_wo_type = Type::IsOCLImage2dMSAADepthWOType();
+  snapshot.is_ocl_image_2d_msaaro_type = Type::IsOCLImage2dMSAAROType();
+  snapshot.is_ocl_image_2d_msaarw_type = Type::IsOCLImage2dMSAARWType();
+  snapshot.is_ocl_image_2d_msaawo_type = Type::IsOCLImage2dMSAAWOType();
+  snapshot.is_ocl_image_2d_ro_type = Type::IsOCLImage2dROType();
+  snapshot.is_ocl_image_2d_rw_type = Type::IsOCLImage2dRWType();
+  snapshot.is_ocl_image_2d_wo_type = Type::IsOCLImage2dWOType();
+  snapshot.is_ocl_image_3d_ro_type = Type::IsOCLImage3dROType();
+  snapshot.is_ocl_image_3d_rw_type = Type::IsOCLImage3dRWType();
+  snapshot.is_ocl_image_3d_wo_type = Type::IsOCLImage3dWOType();
+  snapshot.is_ocl_intel_subgroup_avc_ime_dual_reference_streamin_type = Type::IsOCLIntelSubgroupAVCImeDualReferenceStreaminType();
+  snapshot.is_ocl_intel_subgroup_avc_ime_payload_type = Type::IsOCLIntelSubgroupAVCImePayloadType();
+  snapshot.is_ocl_intel_subgroup_avc_ime_result_dual_reference_streamout_type = Type::IsOCLIntelSubgroupAVCImeResultDualReferenceStreamoutType();
+  snapshot.is_ocl_intel_subgroup_avc_ime_result_single_reference_streamout_type = Type::IsOCLIntelSubgroupAVCImeResultSingleReferenceStreamoutType();
+  snapshot.is_ocl_intel_subgroup_avc_ime_result_type = Type::IsOCLIntelSubgroupAVCImeResultType();
+  snapshot.is_ocl_intel_subgroup_avc_ime_single_reference_streamin_type = Type::IsOCLIntelSubgroupAVCImeSingleReferenceStreaminType();
+  snapshot.is_ocl_intel_subgroup_avc_mce_payload_type = Type::IsOCLIntelSubgroupAVCMcePayloadType();
+  snapshot.is_ocl_intel_subgroup_avc_mce_result_type = Type::IsOCLIntelSubgroupAVCMceResultType();
+  snapshot.is_ocl_intel_subgroup_avc_ref_payload_type = Type::IsOCLIntelSubgroupAVCRefPayloadType();
+  snapshot.is_ocl_intel_subgroup_avc_ref_result_type = Type::IsOCLIntelSubgroupAVCRefResultType();
+  snapshot.is_ocl_intel_subgroup_avc_sic_payload_type = Type::IsOCLIntelSubgroupAVCSicPayloadType();
+  snapshot.is_ocl_intel_subgroup_avc_sic_result_type = Type::IsOCLIntelSubgroupAVCSicResultType();
+  snapshot.is_ocl_intel_subgroup_avc_type = Type::IsOCLIntelSubgroupAVCType();
+  snapshot.is_obj_carc_bridgable_type = Type::IsObjCARCBridgableType();
+  snapshot.is_obj_c_boxable_record_type = Type::IsObjCBoxableRecordType();
+  snapshot.is_obj_c_builtin_type = Type::IsObjCBuiltinType();
+  snapshot.is_obj_c_class_or_class_kind_of_type = Type::IsObjCClassOrClassKindOfType();
+  snapshot.is_obj_c_class_type = Type::IsObjCClassType();
+  snapshot.is_obj_c_id_type = Type::IsObjCIdType();
+  snapshot.is_obj_c_independent_class_type = Type::IsObjCIndependentClassType();
+  snapshot.is_obj_c_indirect_lifetime_type = Type::IsObjCIndirectLifetimeType();
+  snapshot.is_obj_c_inert_unsafe_unretained_type = Type::IsObjCInertUnsafeUnretainedType();
+  snapshot.is_obj_c_lifetime_type = Type::IsObjCLifetimeType();
+  snapshot.is_obj_cns_object_type = Type::IsObjCNSObjectType();
+  snapshot.is_obj_c_object_or_interface_type = Type::IsObjCObjectOrInterfaceType();
+  snapshot.is_obj_c_object_pointer_type = Type::IsObjCObjectPointerType();
+  snapshot.is_obj_c_object_type = Type::IsObjCObjectType();
+  snapshot.is_obj_c_qualified_class_type = Type::IsObjCQualifiedClassType();
+  snapshot.is_obj_c_qualified_id_type = Type::IsObjCQualifiedIdType();
+  snapshot.is_obj_c_qualified_interface_type = Type::IsObjCQualifiedInterfaceType();
+  snapshot.is_obj_c_retainable_type = Type::IsObjCRetainableType();
+  snapshot.is_obj_c_sel_type = Type::IsObjCSelType();
+  snapshot.is_object_pointer_type = Type::IsObjectPointerType();
+  snapshot.is_object_type = Type::IsObjectType();
+  snapshot.is_open_cl_specific_type = Type::IsOpenCLSpecificType();
+  snapshot.is_overloadable_type = Type::IsOverloadableType();
+  snapshot.is_pipe_type = Type::IsPipeType();
+  snapshot.is_placeholder_type = Type::IsPlaceholderType();
+  snapshot.is_pointer_type = Type::IsPointerType();
+  snapshot.is_queue_t = Type::IsQueueT();
+  snapshot.is_rvv_sizeless_builtin_type = Type::IsRVVSizelessBuiltinType();
+  snapshot.is_rvvvls_builtin_type = Type::IsRVVVLSBuiltinType();
+  snapshot.is_r_value_reference_type = Type::IsRValueReferenceType();
+  snapshot.is_real_floating_type = Type::IsRealFloatingType();
+  snapshot.is_real_type = Type::IsRealType();
+  snapshot.is_record_type = Type::IsRecordType();
+  snapshot.is_reference_type = Type::IsReferenceType();
+  snapshot.is_reserve_idt = Type::IsReserveIDT();
+  snapshot.is_sve_sizeless_builtin_type = Type::IsSVESizelessBuiltinType();
+  snapshot.is_sampler_t = Type::IsSamplerT();
+  snapshot.is_saturated_fixed_point_type = Type::IsSaturatedFixedPointType();
+  snapshot.is_scalar_type = Type::IsScalarType();
+  snapshot.is_scoped_enumeral_type = Type::IsScopedEnumeralType();
+  snapshot.is_signed_fixed_point_type = Type::IsSignedFixedPointType();
+  snapshot.is_signed_integer_or_enumeration_type = Type::IsSignedIntegerOrEnumerationType();
+  snapshot.is_signed_integer_type = Type::IsSignedIntegerType();
+  snapshot.is_sizeless_builtin_type = Type::IsSizelessBuiltinType();
+  snapshot.is_sizeless_type = Type::IsSizelessType();
+  snapshot.is_specifier_type = Type::IsSpecifierType();
+  snapshot.is_std_byte_type = Type::IsStdByteType();
+  snapshot.is_structure_or_class_type = Type::IsStructureOrClassType();
+  snapshot.is_structure_type = Type::IsStructureType();
+  snapshot.is_template_type_parm_type = Type::IsTemplateTypeParmType();
+  snapshot.is_typedef_name_type = Type::IsTypedefNameType();
+  snapshot.is_undeduced_auto_type = Type::IsUndeducedAutoType();
+  snapshot.is_undeduced_type = Type::IsUndeducedType();
+  snapshot.is_union_type = Type::IsUnionType();
+  snapshot.is_unresolved_type = Type::IsUnresolvedType();
+  snapshot.is_unsaturated_fixed_point_type = Type::IsUnsaturatedFixedPointType();
+  snapshot.is_unscoped_enumeration_type = Type::IsUnscopedEnumerationType();
+  snapshot.is_unsigned_fixed_point_type = Type::IsUnsignedFixedPointType();
+  snapshot.is_unsigned_integer_or_enumeration_type = Type::IsUnsignedIntegerOrEnumerationType();
+  snapshot.is_unsigned_integer_type = Type::IsUnsignedIntegerType();
+  snapshot.is_vlst_builtin_type = Type::IsVLSTBuiltinType();
+  snapshot.is_variable_array_type = Type::IsVariableArrayType();
+  snapshot.is_variably_modified_type = Type::IsVariablyModifiedType();
+  snapshot.is_vector_type = Type::IsVectorType();
+  snapshot.is_visibility_explicit = Type::IsVisibilityExplicit();
+  snapshot.is_void_pointer_type = Type::IsVoidPointerType();
+  snapshot.is_void_type = Type::IsVoidType();
+  snapshot.is_web_assembly_externref_type = Type::IsWebAssemblyExternrefType();
+  snapshot.is_web_assembly_table_type = Type::IsWebAssemblyTableType();
+  snapshot.is_wide_character_type = Type::IsWideCharacterType();
+  return snapshot;
+}
+
+::pasta::TypeOfExprTypeSnapshot TypeOfExprType::Snapshot(void) const {
+  ::pasta::TypeOfExprTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.type_kind = TypeOfExprType::TypeKind();
+  snapshot.is_sugared = TypeOfExprType::IsSugared();
+  return snapshot;
+}
+
+::pasta::TypeOfTypeSnapshot TypeOfType::Snapshot(void) const {
+  ::pasta::TypeOfTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.type_kind = TypeOfType::TypeKind();
+  snapshot.is_sugared = TypeOfType::IsSugared();
+  return snapshot;
+}
+
+::pasta::TypedefTypeSnapshot TypedefType::Snapshot(void) const {
+  ::pasta::TypedefTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.is_sugared = TypedefType::IsSugared();
+  snapshot.type_matches_declaration = TypedefType::TypeMatchesDeclaration();
+  return snapshot;
+}
+
+::pasta::UnaryTransformTypeSnapshot UnaryTransformType::Snapshot(void) const {
+  ::pasta::UnaryTransformTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.utt_kind = UnaryTransformType::UTTKind();
+  snapshot.is_sugared = UnaryTransformType::IsSugared();
+  return snapshot;
+}
+
+::pasta::UnresolvedUsingTypeSnapshot UnresolvedUsingType::Snapshot(void) const {
+  ::pasta::UnresolvedUsingTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.is_sugared = UnresolvedUsingType::IsSugared();
+  return snapshot;
+}
+
+::pasta::UsingTypeSnapshot UsingType::Snapshot(void) const {
+  ::pasta::UsingTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.is_sugared = UsingType::IsSugared();
+  snapshot.type_matches_declaration = UsingType::TypeMatchesDeclaration();
+  return snapshot;
+}
+
+::pasta::VectorTypeSnapshot VectorType::Snapshot(void) const {
+  ::pasta::VectorTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.num_elements = VectorType::NumElements();
+  snapshot.vector_kind = VectorType::VectorKind();
+  snapshot.is_sugared = VectorType::IsSugared();
+  return snapshot;
+}
+
+::pasta::TypeWithKeywordSnapshot TypeWithKeyword::Snapshot(void) const {
+  ::pasta::TypeWithKeywordSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.keyword = TypeWithKeyword::Keyword();
+  return snapshot;
+}
+
+::pasta::AdjustedTypeSnapshot AdjustedType::Snapshot(void) const {
+  ::pasta::AdjustedTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.is_sugared = AdjustedType::IsSugared();
+  return snapshot;
+}
+
+::pasta::ArrayTypeSnapshot ArrayType::Snapshot(void) const {
+  ::pasta::ArrayTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.index_type_cvr_qualifiers = ArrayType::IndexTypeCVRQualifiers();
+  snapshot.size_modifier = ArrayType::SizeModifier();
+  return snapshot;
+}
+
+::pasta::AtomicTypeSnapshot AtomicType::Snapshot(void) const {
+  ::pasta::AtomicTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.is_sugared = AtomicType::IsSugared();
+  return snapshot;
+}
+
+::pasta::AttributedTypeSnapshot AttributedType::Snapshot(void) const {
+  ::pasta::AttributedTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.attribute_kind = AttributedType::AttributeKind();
+  snapshot.has_attribute = AttributedType::HasAttribute();
+  snapshot.is_calling_conv = AttributedType::IsCallingConv();
+  snapshot.is_ms_type_spec = AttributedType::IsMSTypeSpec();
+  snapshot.is_qualifier = AttributedType::IsQualifier();
+  snapshot.is_sugared = AttributedType::IsSugared();
+  snapshot.is_web_assembly_funcref_spec = AttributedType::IsWebAssemblyFuncrefSpec();
+  return snapshot;
+}
+
+::pasta::BTFTagAttributedTypeSnapshot BTFTagAttributedType::Snapshot(void) const {
+  ::pasta::BTFTagAttributedTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.is_sugared = BTFTagAttributedType::IsSugared();
+  return snapshot;
+}
+
+::pasta::BitIntTypeSnapshot BitIntType::Snapshot(void) const {
+  ::pasta::BitIntTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.num_bits = BitIntType::NumBits();
+  snapshot.is_signed = BitIntType::IsSigned();
+  snapshot.is_sugared = BitIntType::IsSugared();
+  snapshot.is_unsigned = BitIntType::IsUnsigned();
+  return snapshot;
+}
+
+::pasta::BlockPointerTypeSnapshot BlockPointerType::Snapshot(void) const {
+  ::pasta::BlockPointerTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.is_sugared = BlockPointerType::IsSugared();
+  return snapshot;
+}
+
+::pasta::BuiltinTypeSnapshot BuiltinType::Snapshot(void) const {
+  ::pasta::BuiltinTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.builtin_kind = BuiltinType::BuiltinKind();
+  snapshot.is_floating_point = BuiltinType::IsFloatingPoint();
+  snapshot.is_integer = BuiltinType::IsInteger();
+  snapshot.is_sve_bool = BuiltinType::IsSVEBool();
+  snapshot.is_sve_count = BuiltinType::IsSVECount();
+  snapshot.is_signed_integer = BuiltinType::IsSignedInteger();
+  snapshot.is_sugared = BuiltinType::IsSugared();
+  snapshot.is_unsigned_integer = BuiltinType::IsUnsignedInteger();
+  return snapshot;
+}
+
+::pasta::ComplexTypeSnapshot ComplexType::Snapshot(void) const {
+  ::pasta::ComplexTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.is_sugared = ComplexType::IsSugared();
+  return snapshot;
+}
+
+::pasta::ConstantArrayTypeSnapshot ConstantArrayType::Snapshot(void) const {
+  ::pasta::ConstantArrayTypeSnapshot snapshot;
+  static_cast<::pasta::ArrayTypeSnapshot &>(snapshot) = ArrayType::Snapshot();
+  snapshot.is_sugared = ConstantArrayType::IsSugared();
+  return snapshot;
+}
+
+::pasta::DecayedTypeSnapshot DecayedType::Snapshot(void) const {
+  ::pasta::DecayedTypeSnapshot snapshot;
+  static_cast<::pasta::AdjustedTypeSnapshot &>(snapshot) = AdjustedType::Snapshot();
+  return snapshot;
+}
+
+::pasta::DecltypeTypeSnapshot DecltypeType::Snapshot(void) const {
+  ::pasta::DecltypeTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.is_sugared = DecltypeType::IsSugared();
+  return snapshot;
+}
+
+::pasta::DeducedTypeSnapshot DeducedType::Snapshot(void) const {
+  ::pasta::DeducedTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.is_deduced = DeducedType::IsDeduced();
+  snapshot.is_sugared = DeducedType::IsSugared();
+  return snapshot;
+}
+
+::pasta::DependentAddressSpaceTypeSnapshot DependentAddressSpaceType::Snapshot(void) const {
+  ::pasta::DependentAddressSpaceTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.attribute_token = ast->TokenIndexAt(const_cast<clang::DependentAddressSpaceType *>(u.DependentAddressSpaceType)->getAttributeLoc());
+  snapshot.is_sugared = DependentAddressSpaceType::IsSugared();
+  return snapshot;
+}
+
+::pasta::DependentBitIntTypeSnapshot DependentBitIntType::Snapshot(void) const {
+  ::pasta::DependentBitIntTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.is_signed = DependentBitIntType::IsSigned();
+  snapshot.is_sugared = DependentBitIntType::IsSugared();
+  snapshot.is_unsigned = DependentBitIntType::IsUnsigned();
+  return snapshot;
+}
+
+::pasta::DependentNameTypeSnapshot DependentNameType::Snapshot(void) const {
+  ::pasta::DependentNameTypeSnapshot snapshot;
+  static_cast<::pasta::TypeWithKeywordSnapshot &>(snapshot) = TypeWithKeyword::Snapshot();
+  snapshot.is_sugared = DependentNameType::IsSugared();
+  return snapshot;
+}
+
+::pasta::DependentSizedArrayTypeSnapshot DependentSizedArrayType::Snapshot(void) const {
+  ::pasta::DependentSizedArrayTypeSnapshot snapshot;
+  static_cast<::pasta::ArrayTypeSnapshot &>(snapshot) = ArrayType::Snapshot();
+  snapshot.l_bracket_token = ast->TokenIndexAt(const_cast<clang::DependentSizedArrayType *>(u.DependentSizedArrayType)->getLBracketLoc());
+  snapshot.r_bracket_token = ast->TokenIndexAt(const_cast<clang::DependentSizedArrayType *>(u.DependentSizedArrayType)->getRBracketLoc());
+  snapshot.is_sugared = DependentSizedArrayType::IsSugared();
+  return snapshot;
+}
+
+::pasta::DependentSizedExtVectorTypeSnapshot DependentSizedExtVectorType::Snapshot(void) const {
+  ::pasta::DependentSizedExtVectorTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.attribute_token = ast->TokenIndexAt(const_cast<clang::DependentSizedExtVectorType *>(u.DependentSizedExtVectorType)->getAttributeLoc());
+  snapshot.is_sugared = DependentSizedExtVectorType::IsSugared();
+  return snapshot;
+}
+
+::pasta::DependentTemplateSpecializationTypeSnapshot DependentTemplateSpecializationType::Snapshot(void) const {
+  ::pasta::DependentTemplateSpecializationTypeSnapshot snapshot;
+  static_cast<::pasta::TypeWithKeywordSnapshot &>(snapshot) = TypeWithKeyword::Snapshot();
+  snapshot.is_sugared = DependentTemplateSpecializationType::IsSugared();
+  return snapshot;
+}
+
+::pasta::DependentVectorTypeSnapshot DependentVectorType::Snapshot(void) const {
+  ::pasta::DependentVectorTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.attribute_token = ast->TokenIndexAt(const_cast<clang::DependentVectorType *>(u.DependentVectorType)->getAttributeLoc());
+  snapshot.vector_kind = DependentVectorType::VectorKind();
+  snapshot.is_sugared = DependentVectorType::IsSugared();
+  return snapshot;
+}
+
+::pasta::ElaboratedTypeSnapshot ElaboratedType::Snapshot(void) const {
+  ::pasta::ElaboratedTypeSnapshot snapshot;
+  static_cast<::pasta::TypeWithKeywordSnapshot &>(snapshot) = TypeWithKeyword::Snapshot();
+  snapshot.is_sugared = ElaboratedType::IsSugared();
+  return snapshot;
+}
+
+::pasta::ExtVectorTypeSnapshot ExtVectorType::Snapshot(void) const {
+  ::pasta::ExtVectorTypeSnapshot snapshot;
+  static_cast<::pasta::VectorTypeSnapshot &>(snapshot) = VectorType::Snapshot();
+  return snapshot;
+}
+
+::pasta::FunctionTypeSnapshot FunctionType::Snapshot(void) const {
+  ::pasta::FunctionTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.call_conv = FunctionType::CallConv();
+  snapshot.cmse_ns_call_attribute = FunctionType::CmseNSCallAttribute();
+  snapshot.has_reg_parm = FunctionType::HasRegParm();
+  snapshot.no_return_attribute = FunctionType::NoReturnAttribute();
+  snapshot.reg_parm_type = FunctionType::RegParmType();
+  snapshot.is_const = FunctionType::IsConst();
+  snapshot.is_restrict = FunctionType::IsRestrict();
+  snapshot.is_volatile = FunctionType::IsVolatile();
+  return snapshot;
+}
+
+::pasta::IncompleteArrayTypeSnapshot IncompleteArrayType::Snapshot(void) const {
+  ::pasta::IncompleteArrayTypeSnapshot snapshot;
+  static_cast<::pasta::ArrayTypeSnapshot &>(snapshot) = ArrayType::Snapshot();
+  snapshot.is_sugared = IncompleteArrayType::IsSugared();
+  return snapshot;
+}
+
+::pasta::InjectedClassNameTypeSnapshot InjectedClassNameType::Snapshot(void) const {
+  ::pasta::InjectedClassNameTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.is_sugared = InjectedClassNameType::IsSugared();
+  return snapshot;
+}
+
+::pasta::MacroQualifiedTypeSnapshot MacroQualifiedType::Snapshot(void) const {
+  ::pasta::MacroQualifiedTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.is_sugared = MacroQualifiedType::IsSugared();
+  return snapshot;
+}
+
+::pasta::MatrixTypeSnapshot MatrixType::Snapshot(void) const {
+  ::pasta::MatrixTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.is_sugared = MatrixType::IsSugared();
+  return snapshot;
+}
+
+::pasta::MemberPointerTypeSnapshot MemberPointerType::Snapshot(void) const {
+  ::pasta::MemberPointerTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.is_member_data_pointer = MemberPointerType::IsMemberDataPointer();
+  snapshot.is_member_function_pointer = MemberPointerType::IsMemberFunctionPointer();
+  snapshot.is_sugared = MemberPointerType::IsSugared();
+  return snapshot;
+}
+
+::pasta::ObjCObjectPointerTypeSnapshot ObjCObjectPointerType::Snapshot(void) const {
+  ::pasta::ObjCObjectPointerTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.num_protocols = ObjCObjectPointerType::NumProtocols();
+  snapshot.is_kind_of_type = ObjCObjectPointerType::IsKindOfType();
+  snapshot.is_obj_c_id_or_class_type = ObjCObjectPointerType::IsObjCIdOrClassType();
+  snapshot.is_specialized = ObjCObjectPointerType::IsSpecialized();
+  snapshot.is_specialized_as_written = ObjCObjectPointerType::IsSpecializedAsWritten();
+  snapshot.is_sugared = ObjCObjectPointerType::IsSugared();
+  snapshot.is_unspecialized = ObjCObjectPointerType::IsUnspecialized();
+  snapshot.is_unspecialized_as_written = ObjCObjectPointerType::IsUnspecializedAsWritten();
+  return snapshot;
+}
+
+::pasta::ObjCObjectTypeSnapshot ObjCObjectType::Snapshot(void) const {
+  ::pasta::ObjCObjectTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.is_kind_of_type = ObjCObjectType::IsKindOfType();
+  snapshot.is_kind_of_type_as_written = ObjCObjectType::IsKindOfTypeAsWritten();
+  snapshot.is_obj_c_class = ObjCObjectType::IsObjCClass();
+  snapshot.is_obj_c_id = ObjCObjectType::IsObjCId();
+  snapshot.is_obj_c_qualified_class = ObjCObjectType::IsObjCQualifiedClass();
+  snapshot.is_obj_c_qualified_id = ObjCObjectType::IsObjCQualifiedId();
+  snapshot.is_obj_c_unqualified_class = ObjCObjectType::IsObjCUnqualifiedClass();
+  snapshot.is_obj_c_unqualified_id = ObjCObjectType::IsObjCUnqualifiedId();
+  snapshot.is_obj_c_unqualified_id_or_class = ObjCObjectType::IsObjCUnqualifiedIdOrClass();
+  snapshot.is_specialized = ObjCObjectType::IsSpecialized();
+  snapshot.is_specialized_as_written = ObjCObjectType::IsSpecializedAsWritten();
+  snapshot.is_sugared = ObjCObjectType::IsSugared();
+  snapshot.is_unspecialized = ObjCObjectType::IsUnspecialized();
+  snapshot.is_unspecialized_as_written = ObjCObjectType::IsUnspecializedAsWritten();
+  return snapshot;
+}
+
+::pasta::ObjCTypeParamTypeSnapshot ObjCTypeParamType::Snapshot(void) const {
+  ::pasta::ObjCTypeParamTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.is_sugared = ObjCTypeParamType::IsSugared();
+  return snapshot;
+}
+
+::pasta::PackExpansionTypeSnapshot PackExpansionType::Snapshot(void) const {
+  ::pasta::PackExpansionTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.is_sugared = PackExpansionType::IsSugared();
+  return snapshot;
+}
+
+::pasta::ParenTypeSnapshot ParenType::Snapshot(void) const {
+  ::pasta::ParenTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.is_sugared = ParenType::IsSugared();
+  return snapshot;
+}
+
+::pasta::PipeTypeSnapshot PipeType::Snapshot(void) const {
+  ::pasta::PipeTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.is_read_only = PipeType::IsReadOnly();
+  snapshot.is_sugared = PipeType::IsSugared();
+  return snapshot;
+}
+
+::pasta::PointerTypeSnapshot PointerType::Snapshot(void) const {
+  ::pasta::PointerTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.is_sugared = PointerType::IsSugared();
+  return snapshot;
+}
+
+::pasta::QualifiedTypeSnapshot QualifiedType::Snapshot(void) const {
+  ::pasta::QualifiedTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.address_space = QualifiedType::AddressSpace();
+  snapshot.cvr_qualifiers = QualifiedType::CVRQualifiers();
+  snapshot.local_cvr_qualifiers = QualifiedType::LocalCVRQualifiers();
+  snapshot.local_fast_qualifiers = QualifiedType::LocalFastQualifiers();
+  snapshot.has_address_space = QualifiedType::HasAddressSpace();
+  snapshot.has_local_non_fast_qualifiers = QualifiedType::HasLocalNonFastQualifiers();
+  snapshot.has_local_qualifiers = QualifiedType::HasLocalQualifiers();
+  snapshot.has_non_trivial_obj_c_lifetime = QualifiedType::HasNonTrivialObjCLifetime();
+  snapshot.has_non_trivial_to_primitive_copy_c_union = QualifiedType::HasNonTrivialToPrimitiveCopyCUnion();
+  snapshot.has_non_trivial_to_primitive_default_initialize_c_union = QualifiedType::HasNonTrivialToPrimitiveDefaultInitializeCUnion();
+  snapshot.has_non_trivial_to_primitive_destruct_c_union = QualifiedType::HasNonTrivialToPrimitiveDestructCUnion();
+  snapshot.has_qualifiers = QualifiedType::HasQualifiers();
+  snapshot.has_strong_or_weak_obj_c_lifetime = QualifiedType::HasStrongOrWeakObjCLifetime();
+  snapshot.is_c_forbidden_l_value_type = QualifiedType::IsCForbiddenLValueType();
+  snapshot.is_cxx11_pod_type = QualifiedType::IsCXX11PODType();
+  snapshot.is_cxx98_pod_type = QualifiedType::IsCXX98PODType();
+  snapshot.is_canonical = QualifiedType::IsCanonical();
+  snapshot.is_canonical_as_parameter = QualifiedType::IsCanonicalAsParameter();
+  snapshot.is_const_qualified = QualifiedType::IsConstQualified();
+  snapshot.is_constant = QualifiedType::IsConstant();
+  snapshot.is_local_const_qualified = QualifiedType::IsLocalConstQualified();
+  snapshot.is_local_restrict_qualified = QualifiedType::IsLocalRestrictQualified();
+  snapshot.is_local_volatile_qualified = QualifiedType::IsLocalVolatileQualified();
+  snapshot.is_non_weak_in_mrr_with_obj_c_weak = QualifiedType::IsNonWeakInMRRWithObjCWeak();
+  snapshot.is_null = QualifiedType::IsNull();
+  snapshot.is_obj_cgc_strong = QualifiedType::IsObjCGCStrong();
+  snapshot.is_obj_cgc_weak = QualifiedType::IsObjCGCWeak();
+  snapshot.is_pod_type = QualifiedType::IsPODType();
+  snapshot.is_referenceable = QualifiedType::IsReferenceable();
+  snapshot.is_restrict_qualified = QualifiedType::IsRestrictQualified();
+  snapshot.is_trivial_type = QualifiedType::IsTrivialType();
+  snapshot.is_trivially_copyable_type = QualifiedType::IsTriviallyCopyableType();
+  snapshot.is_trivially_equality_comparable_type = QualifiedType::IsTriviallyEqualityComparableType();
+  snapshot.is_trivially_relocatable_type = QualifiedType::IsTriviallyRelocatableType();
+  snapshot.is_volatile_qualified = QualifiedType::IsVolatileQualified();
+  snapshot.is_web_assembly_funcref_type = QualifiedType::IsWebAssemblyFuncrefType();
+  snapshot.is_web_assembly_reference_type = QualifiedType::IsWebAssemblyReferenceType();
+  snapshot.may_be_dynamic_class = QualifiedType::MayBeDynamicClass();
+  snapshot.may_be_not_dynamic_class = QualifiedType::MayBeNotDynamicClass();
+  return snapshot;
+}
+
+::pasta::ReferenceTypeSnapshot ReferenceType::Snapshot(void) const {
+  ::pasta::ReferenceTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.is_inner_reference = ReferenceType::IsInnerReference();
+  snapshot.is_spelled_as_l_value = ReferenceType::IsSpelledAsLValue();
+  return snapshot;
+}
+
+::pasta::SubstTemplateTypeParmPackTypeSnapshot SubstTemplateTypeParmPackType::Snapshot(void) const {
+  ::pasta::SubstTemplateTypeParmPackTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.final = SubstTemplateTypeParmPackType::Final();
+  snapshot.index = SubstTemplateTypeParmPackType::Index();
+  snapshot.num_arguments = SubstTemplateTypeParmPackType::NumArguments();
+  snapshot.is_sugared = SubstTemplateTypeParmPackType::IsSugared();
+  return snapshot;
+}
+
+::pasta::SubstTemplateTypeParmTypeSnapshot SubstTemplateTypeParmType::Snapshot(void) const {
+  ::pasta::SubstTemplateTypeParmTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.index = SubstTemplateTypeParmType::Index();
+  snapshot.is_sugared = SubstTemplateTypeParmType::IsSugared();
+  return snapshot;
+}
+
+::pasta::TagTypeSnapshot TagType::Snapshot(void) const {
+  ::pasta::TagTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.is_being_defined = TagType::IsBeingDefined();
+  return snapshot;
+}
+
+::pasta::TemplateSpecializationTypeSnapshot TemplateSpecializationType::Snapshot(void) const {
+  ::pasta::TemplateSpecializationTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.is_current_instantiation = TemplateSpecializationType::IsCurrentInstantiation();
+  snapshot.is_sugared = TemplateSpecializationType::IsSugared();
+  snapshot.is_type_alias = TemplateSpecializationType::IsTypeAlias();
+  return snapshot;
+}
+
+::pasta::TemplateTypeParmTypeSnapshot TemplateTypeParmType::Snapshot(void) const {
+  ::pasta::TemplateTypeParmTypeSnapshot snapshot;
+  static_cast<::pasta::TypeSnapshot &>(snapshot) = Type::Snapshot();
+  snapshot.depth = TemplateTypeParmType::Depth();
+  snapshot.index = TemplateTypeParmType::Index();
+  snapshot.is_parameter_pack = TemplateTypeParmType::IsParameterPack();
+  snapshot.is_sugared = TemplateTypeParmType::IsSugared();
+  return snapshot;
+}
+
+::pasta::VariableArrayTypeSnapshot VariableArrayType::Snapshot(void) const {
+  ::pasta::VariableArrayTypeSnapshot snapshot;
+  static_cast<::pasta::ArrayTypeSnapshot &>(snapshot) = ArrayType::Snapshot();
+  snapshot.l_bracket_token = ast->TokenIndexAt(const_cast<clang::VariableArrayType *>(u.VariableArrayType)->getLBracketLoc());
+  snapshot.r_bracket_token = ast->TokenIndexAt(const_cast<clang::VariableArrayType *>(u.VariableArrayType)->getRBracketLoc());
+  snapshot.is_sugared = VariableArrayType::IsSugared();
+  return snapshot;
+}
+
+::pasta::AutoTypeSnapshot AutoType::Snapshot(void) const {
+  ::pasta::AutoTypeSnapshot snapshot;
+  static_cast<::pasta::DeducedTypeSnapshot &>(snapshot) = DeducedType::Snapshot();
+  snapshot.keyword = AutoType::Keyword();
+  snapshot.is_constrained = AutoType::IsConstrained();
+  snapshot.is_decltype_auto = AutoType::IsDecltypeAuto();
+  snapshot.is_gnu_auto_type = AutoType::IsGNUAutoType();
+  return snapshot;
+}
+
+::pasta::ConstantMatrixTypeSnapshot ConstantMatrixType::Snapshot(void) const {
+  ::pasta::ConstantMatrixTypeSnapshot snapshot;
+  static_cast<::pasta::MatrixTypeSnapshot &>(snapshot) = MatrixType::Snapshot();
+  snapshot.num_columns = ConstantMatrixType::NumColumns();
+  snapshot.num_elements_flattened = ConstantMatrixType::NumElementsFlattened();
+  snapshot.num_rows = ConstantMatrixType::NumRows();
+  return snapshot;
+}
+
+::pasta::DeducedTemplateSpecializationTypeSnapshot DeducedTemplateSpecializationType::Snapshot(void) const {
+  ::pasta::DeducedTemplateSpecializationTypeSnapshot snapshot;
+  static_cast<::pasta::DeducedTypeSnapshot &>(snapshot) = DeducedType::Snapshot();
+  return snapshot;
+}
+
+::pasta::DependentSizedMatrixTypeSnapshot DependentSizedMatrixType::Snapshot(void) const {
+  ::pasta::DependentSizedMatrixTypeSnapshot snapshot;
+  static_cast<::pasta::MatrixTypeSnapshot &>(snapshot) = MatrixType::Snapshot();
+  snapshot.attribute_token = ast->TokenIndexAt(const_cast<clang::DependentSizedMatrixType *>(u.DependentSizedMatrixType)->getAttributeLoc());
+  return snapshot;
+}
+
+::pasta::EnumTypeSnapshot EnumType::Snapshot(void) const {
+  ::pasta::EnumTypeSnapshot snapshot;
+  static_cast<::pasta::TagTypeSnapshot &>(snapshot) = TagType::Snapshot();
+  snapshot.is_sugared = EnumType::IsSugared();
+  return snapshot;
+}
+
+::pasta::FunctionNoProtoTypeSnapshot FunctionNoProtoType::Snapshot(void) const {
+  ::pasta::FunctionNoProtoTypeSnapshot snapshot;
+  static_cast<::pasta::FunctionTypeSnapshot &>(snapshot) = FunctionType::Snapshot();
+  snapshot.is_sugared = FunctionNoProtoType::IsSugared();
+  return snapshot;
+}
+
+::pasta::FunctionProtoTypeSnapshot FunctionProtoType::Snapshot(void) const {
+  ::pasta::FunctionProtoTypeSnapshot snapshot;
+  static_cast<::pasta::FunctionTypeSnapshot &>(snapshot) = FunctionType::Snapshot();
+  snapshot.ellipsis_token = ast->TokenIndexAt(const_cast<clang::FunctionProtoType *>(u.FunctionProtoType)->getEllipsisLoc());
+  snapshot.exception_spec_type = FunctionProtoType::ExceptionSpecType();
+  snapshot.num_exceptions = FunctionProtoType::NumExceptions();
+  snapshot.num_parameters = FunctionProtoType::NumParameters();
+  snapshot.reference_qualifier = FunctionProtoType::ReferenceQualifier();
+  snapshot.has_dependent_exception_spec = FunctionProtoType::HasDependentExceptionSpec();
+  snapshot.has_dynamic_exception_spec = FunctionProtoType::HasDynamicExceptionSpec();
+  snapshot.has_exception_spec = FunctionProtoType::HasExceptionSpec();
+  snapshot.has_ext_parameter_infos = FunctionProtoType::HasExtParameterInfos();
+  snapshot.has_instantiation_dependent_exception_spec = FunctionProtoType::HasInstantiationDependentExceptionSpec();
+  snapshot.has_noexcept_exception_spec = FunctionProtoType::HasNoexceptExceptionSpec();
+  snapshot.has_trailing_return = FunctionProtoType::HasTrailingReturn();
+  snapshot.is_sugared = FunctionProtoType::IsSugared();
+  snapshot.is_template_variadic = FunctionProtoType::IsTemplateVariadic();
+  snapshot.is_variadic = FunctionProtoType::IsVariadic();
+  return snapshot;
+}
+
+::pasta::LValueReferenceTypeSnapshot LValueReferenceType::Snapshot(void) const {
+  ::pasta::LValueReferenceTypeSnapshot snapshot;
+  static_cast<::pasta::ReferenceTypeSnapshot &>(snapshot) = ReferenceType::Snapshot();
+  snapshot.is_sugared = LValueReferenceType::IsSugared();
+  return snapshot;
+}
+
+::pasta::ObjCInterfaceTypeSnapshot ObjCInterfaceType::Snapshot(void) const {
+  ::pasta::ObjCInterfaceTypeSnapshot snapshot;
+  static_cast<::pasta::ObjCObjectTypeSnapshot &>(snapshot) = ObjCObjectType::Snapshot();
+  return snapshot;
+}
+
+::pasta::RValueReferenceTypeSnapshot RValueReferenceType::Snapshot(void) const {
+  ::pasta::RValueReferenceTypeSnapshot snapshot;
+  static_cast<::pasta::ReferenceTypeSnapshot &>(snapshot) = ReferenceType::Snapshot();
+  snapshot.is_sugared = RValueReferenceType::IsSugared();
+  return snapshot;
+}
+
+::pasta::RecordTypeSnapshot RecordType::Snapshot(void) const {
+  ::pasta::RecordTypeSnapshot snapshot;
+  static_cast<::pasta::TagTypeSnapshot &>(snapshot) = TagType::Snapshot();
+  snapshot.has_const_fields = RecordType::HasConstFields();
+  snapshot.is_sugared = RecordType::IsSugared();
+  return snapshot;
+}
+
 }  // namespace pasta
 #endif  // PASTA_IN_BOOTSTRAP
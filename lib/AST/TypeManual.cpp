@@ -60,18 +60,6 @@ static bool IsSizedType(clang::QualType self) {
 
 }  // namespace
 
-::pasta::TypeKind Type::Kind(void) const {
-  if (qualifiers) {
-    return TypeKind::kQualified;
-  }
-#ifndef NDEBUG
-  auto &self = *const_cast<clang::Type *>(u.Type);
-  decltype(auto) val = self.getTypeClass();
-  assert(kind == static_cast<enum ::pasta::TypeKind>(val));
-#endif
-  return kind;
-}
-
 std::string_view Type::KindName(void) const {
   if (qualifiers) {
     return "QualifiedType";
@@ -0,0 +1,569 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#include <pasta/AST/Walker.h>
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wimplicit-int-conversion"
+#pragma clang diagnostic ignored "-Wsign-conversion"
+#pragma clang diagnostic ignored "-Wshorten-64-to-32"
+#include <clang/AST/Decl.h>
+#include <clang/AST/DeclCXX.h>
+#include <clang/AST/DeclTemplate.h>
+#include <clang/AST/Expr.h>
+#include <clang/AST/ExprCXX.h>
+#include <clang/AST/RecursiveASTVisitor.h>
+#include <clang/AST/Stmt.h>
+#include <clang/AST/StmtCXX.h>
+#include <clang/AST/StmtOpenMP.h>
+#pragma clang diagnostic pop
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "AST.h"
+
+namespace pasta {
+
+class WalkerImpl {
+ public:
+
+  // An entry on the walk stack. `is_post` tells us if we should invoke the
+  // post-visitor on the entity, or the pre-visitor.
+  struct Item {
+    const void *entity;
+    bool is_decl;
+    bool is_post;
+  };
+
+  using Stack = std::vector<Item>;
+
+  static const ASTImpl *ImplOf(const AST &ast) {
+    return ast.impl.get();
+  }
+
+  static BorrowedDecl Borrow(const ASTImpl *ast, const clang::Decl *decl) {
+    return BorrowedDecl(ast, decl);
+  }
+
+  static BorrowedStmt Borrow(const ASTImpl *ast, const clang::Stmt *stmt) {
+    return BorrowedStmt(ast, stmt);
+  }
+
+  static void PushDecl(Stack &stack, const clang::Decl *decl) {
+    if (decl) {
+      stack.push_back(Item{decl, true, false});
+    }
+  }
+
+  static void PushStmt(Stack &stack, const clang::Stmt *stmt) {
+    if (stmt) {
+      stack.push_back(Item{stmt, false, false});
+    }
+  }
+
+  // Pushes the statements and declarations that are reachable from a type
+  // location, e.g. the size of an array type, the operand of a `decltype`, or
+  // the parameters of a function pointer type, without descending into them.
+  class TypeChildren final
+      : public clang::RecursiveASTVisitor<TypeChildren> {
+   public:
+    Stack &stack;
+
+    // Parameters of this function aren't pushed, as the function walks its
+    // parameters itself.
+    const clang::FunctionDecl * const func;
+
+    // Tags whose semantic context is this function are pushed. In C, the tags
+    // declared in a function's parameter list belong to the function.
+    const clang::DeclContext * const prototype;
+
+    inline TypeChildren(Stack &stack_, const clang::FunctionDecl *func_,
+                        const clang::DeclContext *prototype_)
+        : stack(stack_),
+          func(func_),
+          prototype(prototype_) {}
+
+    bool shouldVisitImplicitCode(void) const {
+      return true;
+    }
+
+    bool TraverseStmt(clang::Stmt *stmt, DataRecursionQueue * = nullptr) {
+      PushStmt(stack, stmt);
+      return true;
+    }
+
+    bool TraverseDecl(clang::Decl *decl) {
+      if (!func || !clang::isa_and_nonnull<clang::ParmVarDecl>(decl) ||
+          decl->getDeclContext() != func) {
+        PushDecl(stack, decl);
+      }
+      return true;
+    }
+
+    bool TraverseElaboratedTypeLoc(clang::ElaboratedTypeLoc tl) {
+      const clang::TagDecl *tag = tl.getTypePtr()->getOwnedTagDecl();
+      if (prototype && tag && tag->getDeclContext() == prototype) {
+        PushDecl(stack, tag);
+      }
+      return RecursiveASTVisitor::TraverseElaboratedTypeLoc(tl);
+    }
+  };
+
+  // Push what is reachable from the type location in `tsi`. If `func` is
+  // non-null, then `tsi` is its type, and its parameters are skipped.
+  static void PushChildren(Stack &stack, const clang::TypeSourceInfo *tsi,
+                           const clang::FunctionDecl *func=nullptr,
+                           const clang::DeclContext *prototype=nullptr) {
+    if (tsi) {
+      TypeChildren(stack, func, prototype).TraverseTypeLoc(tsi->getTypeLoc());
+    }
+  }
+
+  // Push what is reachable from the written template arguments `args`.
+  static void PushChildren(
+      Stack &stack, llvm::ArrayRef<clang::TemplateArgumentLoc> args) {
+    TypeChildren children(stack, nullptr, nullptr);
+    for (const clang::TemplateArgumentLoc &arg : args) {
+      children.TraverseTemplateArgumentLoc(arg);
+    }
+  }
+
+  // Push the parameters of a template parameter list, then its requires
+  // clause.
+  static void PushChildren(Stack &stack,
+                           const clang::TemplateParameterList *params) {
+    if (params) {
+      for (const clang::NamedDecl *param : *params) {
+        PushDecl(stack, param);
+      }
+      PushStmt(stack, params->getRequiresClause());
+    }
+  }
+
+  // Block and captured declarations are reached via their expressions and
+  // statements, and lambda classes via their lambda expressions.
+  static bool IsWalkedViaStmt(const clang::Decl *decl) {
+    if (clang::isa<clang::BlockDecl>(decl) ||
+        clang::isa<clang::CapturedDecl>(decl)) {
+      return true;
+    }
+    auto record = clang::dyn_cast<clang::CXXRecordDecl>(decl);
+    return record && record->isLambda();
+  }
+
+  // Push the children of `decl` onto `stack`, in order.
+  static void PushChildren(Stack &stack, const clang::Decl *decl) {
+
+    // The template parameter lists of out-of-line members of templates, e.g.
+    // `template <typename T> void C<T>::f(void) {}`.
+    if (auto declarator = clang::dyn_cast<clang::DeclaratorDecl>(decl)) {
+      for (auto i = 0u; i < declarator->getNumTemplateParameterLists(); ++i) {
+        PushChildren(stack, declarator->getTemplateParameterList(i));
+      }
+    } else if (auto tag = clang::dyn_cast<clang::TagDecl>(decl)) {
+      for (auto i = 0u; i < tag->getNumTemplateParameterLists(); ++i) {
+        PushChildren(stack, tag->getTemplateParameterList(i));
+      }
+    }
+
+    if (auto func = clang::dyn_cast<clang::FunctionDecl>(decl)) {
+      PushChildren(stack, func->getTypeSourceInfo(), func);
+      for (const clang::ParmVarDecl *param : func->parameters()) {
+        PushDecl(stack, param);
+      }
+      PushStmt(stack, func->getTrailingRequiresClause());
+      if (auto ctor = clang::dyn_cast<clang::CXXConstructorDecl>(func)) {
+        for (const clang::CXXCtorInitializer *init : ctor->inits()) {
+          PushChildren(stack, init->getTypeSourceInfo());
+          PushStmt(stack, init->getInit());
+        }
+      }
+      if (func->doesThisDeclarationHaveABody()) {
+        PushStmt(stack, func->getBody());
+      }
+
+      // NOTE(pag): The other declarations in the context of a function are
+      //            either parameters, reached via the body, or tags declared
+      //            in the parameter list, which we reach via the types of the
+      //            parameters.
+      return;
+
+    } else if (auto block = clang::dyn_cast<clang::BlockDecl>(decl)) {
+      for (const clang::ParmVarDecl *param : block->parameters()) {
+        PushDecl(stack, param);
+      }
+      PushStmt(stack, block->getBody());
+      return;
+
+    } else if (auto captured = clang::dyn_cast<clang::CapturedDecl>(decl)) {
+      PushStmt(stack, captured->getBody());
+      return;
+
+    } else if (auto param = clang::dyn_cast<clang::ParmVarDecl>(decl)) {
+      const clang::DeclContext *prototype = param->getDeclContext();
+      PushChildren(stack, param->getTypeSourceInfo(), nullptr,
+                   clang::isa<clang::FunctionDecl>(prototype) ?
+                   prototype : nullptr);
+      if (param->hasDefaultArg() && !param->hasUnparsedDefaultArg() &&
+          !param->hasUninstantiatedDefaultArg()) {
+        PushStmt(stack, param->getDefaultArg());
+      }
+      return;
+
+    } else if (auto var = clang::dyn_cast<clang::VarDecl>(decl)) {
+      if (auto partial = clang::dyn_cast<
+              clang::VarTemplatePartialSpecializationDecl>(var)) {
+        PushChildren(stack, partial->getTemplateParameters());
+      }
+      PushChildren(stack, var->getTypeSourceInfo());
+      if (auto decomp = clang::dyn_cast<clang::DecompositionDecl>(var)) {
+        for (const clang::BindingDecl *binding : decomp->bindings()) {
+          PushDecl(stack, binding);
+        }
+      }
+      PushStmt(stack, var->getInit());
+      return;
+
+    } else if (auto field = clang::dyn_cast<clang::FieldDecl>(decl)) {
+      PushChildren(stack, field->getTypeSourceInfo());
+      PushStmt(stack, field->getBitWidth());
+      PushStmt(stack, field->getInClassInitializer());
+      return;
+
+    } else if (auto nttp = clang::dyn_cast<clang::NonTypeTemplateParmDecl>(decl)) {
+      PushChildren(stack, nttp->getTypeSourceInfo());
+      if (nttp->hasDefaultArgument() && !nttp->defaultArgumentWasInherited()) {
+        PushStmt(stack, nttp->getDefaultArgument());
+      }
+      return;
+
+    } else if (auto declarator = clang::dyn_cast<clang::DeclaratorDecl>(decl)) {
+      PushChildren(stack, declarator->getTypeSourceInfo());
+      return;
+
+    } else if (auto ttp = clang::dyn_cast<clang::TemplateTypeParmDecl>(decl)) {
+      if (ttp->hasDefaultArgument() && !ttp->defaultArgumentWasInherited()) {
+        PushChildren(stack, ttp->getDefaultArgumentInfo());
+      }
+      return;
+
+    } else if (auto binding = clang::dyn_cast<clang::BindingDecl>(decl)) {
+      PushStmt(stack, binding->getBinding());
+      return;
+
+    } else if (auto enumerator = clang::dyn_cast<clang::EnumConstantDecl>(decl)) {
+      PushStmt(stack, enumerator->getInitExpr());
+      return;
+
+    } else if (auto typedef_ = clang::dyn_cast<clang::TypedefNameDecl>(decl)) {
+      PushChildren(stack, typedef_->getTypeSourceInfo());
+      return;
+
+    } else if (auto tpl = clang::dyn_cast<clang::TemplateDecl>(decl)) {
+      PushChildren(stack, tpl->getTemplateParameters());
+      if (auto concept_ = clang::dyn_cast<clang::ConceptDecl>(tpl)) {
+        PushStmt(stack, concept_->getConstraintExpr());
+      } else {
+        PushDecl(stack, tpl->getTemplatedDecl());
+      }
+      return;
+
+    } else if (auto assert_ = clang::dyn_cast<clang::StaticAssertDecl>(decl)) {
+      PushStmt(stack, assert_->getAssertExpr());
+      PushStmt(stack, assert_->getMessage());
+      return;
+
+    } else if (auto asm_ = clang::dyn_cast<clang::FileScopeAsmDecl>(decl)) {
+      PushStmt(stack, asm_->getAsmString());
+      return;
+
+    } else if (auto friend_ = clang::dyn_cast<clang::FriendDecl>(decl)) {
+      PushChildren(stack, friend_->getFriendType());
+      PushDecl(stack, friend_->getFriendDecl());
+      return;
+
+    } else if (auto partial = clang::dyn_cast<
+                   clang::ClassTemplatePartialSpecializationDecl>(decl)) {
+      PushChildren(stack, partial->getTemplateParameters());
+    }
+
+    if (auto record = clang::dyn_cast<clang::CXXRecordDecl>(decl);
+        record && record->isThisDeclarationADefinition()) {
+      for (const clang::CXXBaseSpecifier &base : record->bases()) {
+        PushChildren(stack, base.getTypeSourceInfo());
+      }
+    }
+
+    // NOTE(pag): We use `noload_decls` so that walking never triggers any
+    //            deserialization, which wouldn't be safe in `WalkInParallel`.
+    if (auto dc = clang::dyn_cast<clang::DeclContext>(decl)) {
+      for (const clang::Decl *child : dc->noload_decls()) {
+        if (!IsWalkedViaStmt(child)) {
+          PushDecl(stack, child);
+        }
+      }
+    }
+  }
+
+  // Push what is reachable from the types written in `stmt`, e.g. the type of
+  // a cast, and from its written template arguments.
+  static void PushWrittenTypeChildren(Stack &stack, const clang::Stmt *stmt) {
+    if (auto cast = clang::dyn_cast<clang::ExplicitCastExpr>(stmt)) {
+      PushChildren(stack, cast->getTypeInfoAsWritten());
+
+    // NOTE(pag): The children of `sizeof` of a variable length array type
+    //            already include the size of the array.
+    } else if (auto unary =
+                   clang::dyn_cast<clang::UnaryExprOrTypeTraitExpr>(stmt)) {
+      if (unary->isArgumentType() &&
+          !clang::isa<clang::VariableArrayType>(
+              unary->getArgumentType().getTypePtr())) {
+        PushChildren(stack, unary->getArgumentTypeInfo());
+      }
+
+    } else if (auto literal = clang::dyn_cast<clang::CompoundLiteralExpr>(stmt)) {
+      PushChildren(stack, literal->getTypeSourceInfo());
+
+    } else if (auto va_arg = clang::dyn_cast<clang::VAArgExpr>(stmt)) {
+      PushChildren(stack, va_arg->getWrittenTypeInfo());
+
+    } else if (auto offset_of = clang::dyn_cast<clang::OffsetOfExpr>(stmt)) {
+      PushChildren(stack, offset_of->getTypeSourceInfo());
+
+    } else if (auto temp = clang::dyn_cast<clang::CXXTemporaryObjectExpr>(stmt)) {
+      PushChildren(stack, temp->getTypeSourceInfo());
+
+    } else if (auto value_init =
+                   clang::dyn_cast<clang::CXXScalarValueInitExpr>(stmt)) {
+      PushChildren(stack, value_init->getTypeSourceInfo());
+
+    } else if (auto construct =
+                   clang::dyn_cast<clang::CXXUnresolvedConstructExpr>(stmt)) {
+      PushChildren(stack, construct->getTypeSourceInfo());
+
+    } else if (auto trait = clang::dyn_cast<clang::TypeTraitExpr>(stmt)) {
+      for (const clang::TypeSourceInfo *arg : trait->getArgs()) {
+        PushChildren(stack, arg);
+      }
+
+    } else if (auto ref = clang::dyn_cast<clang::DeclRefExpr>(stmt)) {
+      PushChildren(stack, ref->template_arguments());
+
+    } else if (auto member = clang::dyn_cast<clang::MemberExpr>(stmt)) {
+      PushChildren(stack, member->template_arguments());
+
+    } else if (auto overload = clang::dyn_cast<clang::OverloadExpr>(stmt)) {
+      PushChildren(stack, overload->template_arguments());
+
+    } else if (auto dep_ref =
+                   clang::dyn_cast<clang::DependentScopeDeclRefExpr>(stmt)) {
+      PushChildren(stack, dep_ref->template_arguments());
+
+    } else if (auto dep_member =
+                   clang::dyn_cast<clang::CXXDependentScopeMemberExpr>(stmt)) {
+      PushChildren(stack, dep_member->template_arguments());
+    }
+  }
+
+  // Push the children of `stmt` onto `stack`, in order.
+  static void PushChildren(Stack &stack, const clang::Stmt *stmt) {
+
+    // NOTE(pag): The children of a `DeclStmt` are the initializers of its
+    //            variables, so we walk the variables themselves instead.
+    if (auto decl_stmt = clang::dyn_cast<clang::DeclStmt>(stmt)) {
+      for (const clang::Decl *decl : decl_stmt->decls()) {
+        PushDecl(stack, decl);
+      }
+      return;
+    }
+
+    if (auto block = clang::dyn_cast<clang::BlockExpr>(stmt)) {
+      PushDecl(stack, block->getBlockDecl());
+      return;
+    }
+
+    // NOTE(pag): The body of a lambda is the body of the call operator of its
+    //            class, so we walk the class instead of the body. Init
+    //            captures are variables, and so we walk them instead of their
+    //            initializers.
+    if (auto lambda = clang::dyn_cast<clang::LambdaExpr>(stmt)) {
+      auto init = lambda->capture_init_begin();
+      for (const clang::LambdaCapture &capture : lambda->captures()) {
+        if (lambda->isInitCapture(&capture)) {
+          PushDecl(stack, capture.getCapturedVar());
+        } else {
+          PushStmt(stack, *init);
+        }
+        ++init;
+      }
+      PushDecl(stack, lambda->getLambdaClass());
+      return;
+    }
+
+    // NOTE(pag): The children of a `CapturedStmt` are only the initializers
+    //            of its captures. The captured statement is the body of its
+    //            captured declaration.
+    if (auto captured = clang::dyn_cast<clang::CapturedStmt>(stmt)) {
+      PushDecl(stack, captured->getCapturedDecl());
+
+    } else if (auto label = clang::dyn_cast<clang::LabelStmt>(stmt)) {
+      PushDecl(stack, label->getDecl());
+
+    } else if (auto handler = clang::dyn_cast<clang::CXXCatchStmt>(stmt)) {
+      PushDecl(stack, handler->getExceptionDecl());
+
+    } else if (auto directive =
+                   clang::dyn_cast<clang::OMPExecutableDirective>(stmt)) {
+      for (const clang::OMPClause *clause : directive->clauses()) {
+        for (const clang::Stmt *child : clause->children()) {
+          PushStmt(stack, child);
+        }
+      }
+
+    } else {
+      PushWrittenTypeChildren(stack, stmt);
+    }
+
+    for (const clang::Stmt *child : stmt->children()) {
+      PushStmt(stack, child);
+    }
+  }
+
+  // Walk everything reachable from `root`, using `stack` as the work list.
+  // `stack` is reused across walks so that its storage is only allocated once
+  // per thread, rather than once per entity.
+  static void Run(Walker &walker, const ASTImpl *ast, Stack &stack,
+                  Item root) {
+    stack.clear();
+    stack.push_back(root);
+
+    while (!stack.empty()) {
+      Item item = stack.back();
+      stack.pop_back();
+
+      if (item.is_decl) {
+        auto decl = reinterpret_cast<const clang::Decl *>(item.entity);
+        if (item.is_post) {
+          walker.PostVisit(Borrow(ast, decl));
+          continue;
+        }
+
+        if (!walker.PreVisit(Borrow(ast, decl))) {
+          continue;
+        }
+
+        stack.push_back(Item{decl, true, true});
+        auto first_child = stack.size();
+        PushChildren(stack, decl);
+
+        // The stack is LIFO, so reverse the children to walk them in order.
+        std::reverse(stack.begin() + static_cast<ptrdiff_t>(first_child),
+                     stack.end());
+
+      } else {
+        auto stmt = reinterpret_cast<const clang::Stmt *>(item.entity);
+        if (item.is_post) {
+          walker.PostVisit(Borrow(ast, stmt));
+          continue;
+        }
+
+        if (!walker.PreVisit(Borrow(ast, stmt))) {
+          continue;
+        }
+
+        stack.push_back(Item{stmt, false, true});
+        auto first_child = stack.size();
+        PushChildren(stack, stmt);
+        std::reverse(stack.begin() + static_cast<ptrdiff_t>(first_child),
+                     stack.end());
+      }
+    }
+  }
+
+  static void Walk(Walker &walker, BorrowedDecl decl) {
+    Stack stack;
+    Run(walker, decl.ast, stack, Item{decl.decl, true, false});
+  }
+
+  static void Walk(Walker &walker, BorrowedStmt stmt) {
+    Stack stack;
+    Run(walker, stmt.ast, stack, Item{stmt.stmt, false, false});
+  }
+
+  static void WalkInParallel(Walker &walker, const AST &ast_,
+                             unsigned num_threads) {
+    const ASTImpl *ast = ImplOf(ast_);
+    const clang::TranslationUnitDecl *tu = ast->tu;
+    if (!tu || !walker.PreVisit(Borrow(ast, tu))) {
+      return;
+    }
+
+    Stack top_level_decls;
+    PushChildren(top_level_decls, tu);
+
+    const size_t num_decls = top_level_decls.size();
+    if (!num_threads) {
+      num_threads = std::thread::hardware_concurrency();
+    }
+
+    std::atomic<size_t> next_decl(0u);
+    auto worker = [&] (void) {
+      Stack stack;
+      for (size_t i = next_decl++; i < num_decls; i = next_decl++) {
+        Run(walker, ast, stack, top_level_decls[i]);
+      }
+    };
+
+    std::vector<std::thread> threads;
+    const auto num_workers = std::min<size_t>(std::max(1u, num_threads),
+                                              num_decls);
+    for (size_t i = 1u; i < num_workers; ++i) {
+      threads.emplace_back(worker);
+    }
+    worker();
+    for (std::thread &thread : threads) {
+      thread.join();
+    }
+
+    walker.PostVisit(Borrow(ast, tu));
+  }
+};
+
+Walker::~Walker(void) {}
+
+bool Walker::PreVisit(BorrowedDecl) {
+  return true;
+}
+
+void Walker::PostVisit(BorrowedDecl) {}
+
+bool Walker::PreVisit(BorrowedStmt) {
+  return true;
+}
+
+void Walker::PostVisit(BorrowedStmt) {}
+
+void Walker::Walk(const AST &ast) {
+  const ASTImpl *impl = WalkerImpl::ImplOf(ast);
+  if (impl->tu) {
+    Walk(WalkerImpl::Borrow(impl, impl->tu));
+  }
+}
+
+void Walker::Walk(BorrowedDecl decl) {
+  WalkerImpl::Walk(*this, decl);
+}
+
+void Walker::Walk(BorrowedStmt stmt) {
+  WalkerImpl::Walk(*this, stmt);
+}
+
+void Walker::WalkInParallel(const AST &ast, unsigned num_threads) {
+  WalkerImpl::WalkInParallel(*this, ast, num_threads);
+}
+
+}  // namespace pasta
@@ -0,0 +1,392 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#include <pasta/Compile/Cache.h>
+
+#include <pasta/AST/AST.h>
+#include <pasta/Compile/Compiler.h>
+#include <pasta/Util/ArgumentVector.h>
+#include <pasta/Util/FileManager.h>
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wimplicit-int-conversion"
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+#pragma GCC diagnostic ignored "-Wshorten-64-to-32"
+#include <clang/Basic/Version.h>
+#include <llvm/Support/xxhash.h>
+#pragma GCC diagnostic pop
+
+#include "../AST/AST.h"
+#include "../Util/FileManager.h"
+
+namespace pasta {
+namespace {
+
+// NOTE(pag): A cache entry is an `EntryHeader`, followed by the full cache
+//            key, followed by the NUL-terminated paths that the job looked up
+//            but that didn't exist, padded to a multiple of eight bytes,
+//            followed by the token snapshot. Entries are named by the hash of
+//            their keys, and so lookups compare the full keys, so that a hash
+//            collision misses instead of returning the snapshot of another
+//            job.
+static constexpr char kEntryMagic[8] = {'P', 'A', 'S', 'T', 'A', 'C', 'C', '2'};
+
+struct EntryHeader {
+  char magic[8];
+  uint64_t key_size;
+  uint64_t missing_paths_size;
+};
+
+// Offset of the token snapshot in an entry whose key and missing paths are
+// `key_size` and `missing_paths_size` bytes.
+static uint64_t SnapshotOffset(uint64_t key_size,
+                               uint64_t missing_paths_size) {
+  return (sizeof(EntryHeader) + key_size + missing_paths_size + 7u) &
+         ~uint64_t(7u);
+}
+
+// Serialize the missing paths of a job into the form stored in an entry.
+static std::string SerializeMissingPaths(
+    const std::vector<std::filesystem::path> &paths) {
+  std::string data;
+  for (const std::filesystem::path &path : paths) {
+    data.append(path.generic_string());
+    data.push_back('\0');
+  }
+  return data;
+}
+
+// Options whose values only name outputs of the job, and so which don't
+// affect the tokens or macros. The option and its value are separate
+// arguments.
+static const std::string_view kSeparateOutputOptions[] = {
+  "-o",
+  "-MF",
+  "-MT",
+  "-MQ",
+  "-dependency-file",
+  "-coverage-notes-file",
+  "-coverage-data-file",
+  "-main-file-name",
+};
+
+// Like `kSeparateOutputOptions`, but the option and its value are joined into
+// one argument.
+static const std::string_view kJoinedOutputOptions[] = {
+  "-fdebug-compilation-dir=",
+  "-fcoverage-compilation-dir=",
+  "-object-file-name=",
+};
+
+// Append a field of the cache key. Fields are NUL-separated so that adjacent
+// fields can't be confused with each other.
+static void AddKeyField(std::string &key, std::string_view field) {
+  key.append(field);
+  key.push_back('\0');
+}
+
+static void AddKeyPath(std::string &key, const std::filesystem::path &path) {
+  AddKeyField(key, path.generic_string());
+}
+
+static void AddKeyField(std::string &key, uint64_t val) {
+  AddKeyField(key, std::to_string(val));
+}
+
+static void AddKeyField(std::string &key,
+                        const std::vector<IncludePath> &paths) {
+  AddKeyField(key, paths.size());
+  for (const IncludePath &path : paths) {
+    AddKeyPath(key, path.Path());
+    AddKeyField(key, static_cast<uint64_t>(path.Location()));
+  }
+}
+
+// Add the job's arguments to the cache key, omitting the output options.
+static void AddKeyArguments(std::string &key, const ArgumentVector &args) {
+  const size_t num_args = args.Size();
+  for (size_t i = 0u; i < num_args; ++i) {
+    std::string_view arg(args[i]);
+
+    auto is_separate = [=] (std::string_view opt) {
+      return arg == opt;
+    };
+    if (std::any_of(std::begin(kSeparateOutputOptions),
+                    std::end(kSeparateOutputOptions), is_separate)) {
+      ++i;  // Skip the value.
+      continue;
+    }
+
+    auto is_joined = [=] (std::string_view opt) {
+      return arg.starts_with(opt);
+    };
+    if (std::any_of(std::begin(kJoinedOutputOptions),
+                    std::end(kJoinedOutputOptions), is_joined)) {
+      continue;
+    }
+
+    AddKeyField(key, arg);
+  }
+}
+
+// Build the cache key of a compile job.
+static std::string CacheKey(const Compiler &compiler, const CompileJob &job,
+                            MacroTracking macro_tracking) {
+  std::string key;
+  AddKeyField(key, "pasta-compile-cache");
+  AddKeyField(key, TokenSnapshot::kVersion);
+  AddKeyField(key, static_cast<uint64_t>(macro_tracking));
+
+  // The version of Clang that parses the job, as different versions can
+  // produce different tokens and macros for the same files.
+  AddKeyField(key, clang::getClangFullVersion());
+
+  // The compiler description.
+  AddKeyField(key, static_cast<uint64_t>(compiler.Name()));
+  AddKeyField(key, static_cast<uint64_t>(compiler.TargetLanguage()));
+  AddKeyField(key, compiler.TargetTriple());
+  AddKeyPath(key, compiler.ExecutablePath());
+  AddKeyPath(key, compiler.ResourceDirectory());
+  AddKeyPath(key, compiler.SystemRootDirectory());
+  AddKeyPath(key, compiler.SystemRootIncludeDirectory());
+  AddKeyPath(key, compiler.InstallationDirectory());
+  AddKeyField(key, compiler.SystemIncludeDirectories());
+  AddKeyField(key, compiler.UserIncludeDirectories());
+  AddKeyField(key, compiler.FrameworkDirectories());
+
+  // The job itself.
+  AddKeyPath(key, job.WorkingDirectory());
+  AddKeyPath(key, job.ResourceDirectory());
+  AddKeyPath(key, job.SystemRootDirectory());
+  AddKeyPath(key, job.SystemRootIncludeDirectory());
+  AddKeyField(key, job.TargetTriple());
+  AddKeyField(key, job.AuxiliaryTargetTriple());
+  AddKeyPath(key, job.SourceFile().Path());
+  AddKeyArguments(key, job.Arguments());
+  return key;
+}
+
+// Return the name of the cache entry whose cache key is `key`.
+static std::string EntryName(std::string_view key) {
+  char name[32] = {};
+  std::snprintf(name, sizeof(name), "%016llx.pasta",
+                static_cast<unsigned long long>(llvm::xxHash64(key)));
+  return name;
+}
+
+// Return `true` if the entry at `entry_path` exists and was stored under the
+// cache key `key`. If so, then fill in the serialized missing paths of the
+// entry's job, and the offset of the entry's token snapshot.
+static bool ReadEntryHeader(const std::filesystem::path &entry_path,
+                            std::string_view key, std::string &missing_paths,
+                            uint64_t &snapshot_offset) {
+  std::ifstream is(entry_path, std::ios::binary);
+  EntryHeader header = {};
+  if (!is.read(reinterpret_cast<char *>(&header), sizeof(header)) ||
+      memcmp(header.magic, kEntryMagic, sizeof(kEntryMagic)) ||
+      header.key_size != key.size()) {
+    return false;
+  }
+
+  std::string entry_key(key.size(), '\0');
+  if (!is.read(entry_key.data(), static_cast<std::streamsize>(key.size())) ||
+      entry_key != key) {
+    return false;
+  }
+
+  missing_paths.resize(header.missing_paths_size);
+  if (!is.read(missing_paths.data(),
+               static_cast<std::streamsize>(header.missing_paths_size)) ||
+      (!missing_paths.empty() && missing_paths.back() != '\0')) {
+    return false;
+  }
+
+  snapshot_offset = SnapshotOffset(header.key_size, header.missing_paths_size);
+  return true;
+}
+
+}  // namespace
+
+CompileCache::CompileCache(std::filesystem::path directory_)
+    : directory(std::move(directory_)) {}
+
+// Return the path of the cache entry for `job`. The entry may not exist.
+std::filesystem::path CompileCache::EntryPath(
+    const Compiler &compiler, const CompileJob &job,
+    MacroTracking macro_tracking) const {
+  return directory / EntryName(CacheKey(compiler, job, macro_tracking));
+}
+
+// Return the cached token snapshot for `job`, if there is one, if none of the
+// files that it parsed have since changed, and if none of the paths that it
+// looked up and didn't find have since been created.
+std::optional<TokenSnapshot> CompileCache::Lookup(
+    const Compiler &compiler, const CompileJob &job,
+    MacroTracking macro_tracking) const {
+
+  const std::string key = CacheKey(compiler, job, macro_tracking);
+  const std::filesystem::path entry_path = directory / EntryName(key);
+  std::string missing_paths;
+  uint64_t snapshot_offset = 0u;
+  if (!ReadEntryHeader(entry_path, key, missing_paths, snapshot_offset)) {
+    return std::nullopt;
+  }
+
+  // NOTE(pag): Read the files through the job's file system, rather than
+  //            through its file manager, as the latter caches file contents.
+  std::shared_ptr<FileSystem> fs =
+      FileManager::Containing(job.SourceFile()).FileSystem();
+  const std::filesystem::path cwd = job.WorkingDirectory();
+
+  // If any path that the job looked up and didn't find now exists, then
+  // re-running the job could find a different file, e.g. a new header in an
+  // include directory that comes before the one where a header was found.
+  for (size_t begin = 0u; begin < missing_paths.size(); ) {
+    const size_t end = missing_paths.find('\0', begin);
+    if (fs->FileExists(missing_paths.substr(begin, end - begin), cwd)) {
+      return std::nullopt;
+    }
+    begin = end + 1u;
+  }
+
+  auto maybe_snapshot = TokenSnapshot::Load(entry_path, snapshot_offset);
+  if (!maybe_snapshot.Succeeded()) {
+    return std::nullopt;
+  }
+
+  TokenSnapshot snapshot = maybe_snapshot.TakeValue();
+
+  for (uint32_t i = 0u, max_i = snapshot.NumFiles(); i < max_i; ++i) {
+    std::optional<TokenSnapshotFile> file = snapshot.File(i);
+    if (!file) {
+      return std::nullopt;
+    }
+
+    auto maybe_data = fs->ReadFile(file->Path(), cwd);
+    if (!maybe_data.Succeeded()) {
+      return std::nullopt;
+    }
+
+    std::string data = maybe_data.TakeValue();
+    if (NormalizeFileData(data) != file->DataHash()) {
+      return std::nullopt;
+    }
+  }
+
+  return snapshot;
+}
+
+// Store the token snapshot of `ast`, which was produced by running `job`
+// with `macro_tracking`.
+std::error_code CompileCache::Store(
+    const Compiler &compiler, const CompileJob &job, const AST &ast,
+    MacroTracking macro_tracking) const {
+  auto maybe_data = TokenSnapshot::Serialize(ast);
+  if (!maybe_data.Succeeded()) {
+    return maybe_data.TakeError();
+  }
+  return Write(CacheKey(compiler, job, macro_tracking),
+               SerializeMissingPaths(ast.impl->missing_paths),
+               maybe_data.TakeValue());
+}
+
+// Return the cached token snapshot for `job`, or run `job` and then cache
+// and return its token snapshot. Failing to store the entry is not an error.
+Result<TokenSnapshot, std::string> CompileCache::Run(
+    const Compiler &compiler, const CompileJob &job,
+    MacroTracking macro_tracking) const {
+
+  if (std::optional<TokenSnapshot> snapshot =
+          Lookup(compiler, job, macro_tracking)) {
+    return std::move(snapshot.value());
+  }
+
+  auto maybe_ast = job.Run(macro_tracking);
+  if (!maybe_ast.Succeeded()) {
+    return maybe_ast.TakeError();
+  }
+
+  const AST ast = maybe_ast.TakeValue();
+  auto maybe_data = TokenSnapshot::Serialize(ast);
+  if (!maybe_data.Succeeded()) {
+    return maybe_data.TakeError().message();
+  }
+
+  std::string data = maybe_data.TakeValue();
+  (void) Write(CacheKey(compiler, job, macro_tracking),
+               SerializeMissingPaths(ast.impl->missing_paths), data);
+
+  auto maybe_snapshot = TokenSnapshot::Load(std::move(data));
+  if (!maybe_snapshot.Succeeded()) {
+    return maybe_snapshot.TakeError().message();
+  }
+
+  return maybe_snapshot.TakeValue();
+}
+
+// Atomically write the token snapshot `data`, and the serialized missing paths
+// `missing_paths` of the job, into the cache entry for `key`.
+//
+// NOTE(pag): Concurrent writers of the same entry each write to their own
+//            temporary file, and the last rename wins. Both temporary files
+//            have the same contents, so readers always see a full entry.
+std::error_code CompileCache::Write(std::string_view key,
+                                    std::string_view missing_paths,
+                                    std::string_view data) const {
+  static std::atomic<unsigned> gNextTempId{0u};
+
+  std::error_code ec;
+  std::filesystem::create_directories(directory, ec);
+  if (ec) {
+    return ec;
+  }
+
+  const std::filesystem::path path = directory / EntryName(key);
+  std::filesystem::path temp_path = path;
+  temp_path += "." + std::to_string(::getpid()) + "." +
+               std::to_string(gNextTempId.fetch_add(1u)) + ".tmp";
+
+  {
+    EntryHeader header = {};
+    memcpy(header.magic, kEntryMagic, sizeof(kEntryMagic));
+    header.key_size = key.size();
+    header.missing_paths_size = missing_paths.size();
+
+    const std::string padding(
+        SnapshotOffset(key.size(), missing_paths.size()) - sizeof(header) -
+            key.size() - missing_paths.size(),
+        '\0');
+
+    std::ofstream os(temp_path, std::ios::binary | std::ios::trunc);
+    os.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    os.write(key.data(), static_cast<std::streamsize>(key.size()));
+    os.write(missing_paths.data(),
+             static_cast<std::streamsize>(missing_paths.size()));
+    os.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+    os.write(data.data(), static_cast<std::streamsize>(data.size()));
+    os.flush();
+    if (!os) {
+      os.close();
+      std::filesystem::remove(temp_path, ec);
+      return std::make_error_code(std::errc::io_error);
+    }
+  }
+
+  std::filesystem::rename(temp_path, path, ec);
+  if (ec) {
+    std::error_code remove_ec;
+    std::filesystem::remove(temp_path, remove_ec);
+  }
+  return ec;
+}
+
+}  // namespace pasta
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#include "FileAndPragmaTracker.h"
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wbitfield-enum-conversion"
+#pragma GCC diagnostic ignored "-Wimplicit-int-conversion"
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+#pragma GCC diagnostic ignored "-Wshorten-64-to-32"
+#include <clang/Basic/TokenKinds.h>
+#include <clang/Lex/Preprocessor.h>
+#pragma GCC diagnostic pop
+
+#include <cassert>
+
+#include "../AST/AST.h"
+#include "../AST/Token.h"
+
+namespace pasta {
+namespace {
+
+// Raw lex the next token, returning `false` at the end of the file.
+static bool LexRawToken(clang::Lexer &lexer, clang::Token &tok) {
+  lexer.LexFromRawLexer(tok);
+  return !tok.is(clang::tok::eof);
+}
+
+}  // namespace
+
+// Re-emit the pragma `pragma_data` as its own line of
+// `ASTImpl::preprocessed_code`, represented by a zero-sized marker token at
+// `loc` in the parsed tokens. Returns the index of the marker token.
+uint32_t AppendPragmaLine(ASTImpl &ast, clang::SourceLocation loc,
+                          std::string pragma_data) {
+
+  // Maintain the invariant that each parsed token is on its own line.
+  for (char &ch : pragma_data) {
+    if (ch == '\n' || ch == '\r') {
+      ch = ' ';
+    }
+  }
+
+  const auto tok_index = static_cast<uint32_t>(ast.tokens.size());
+  assert(tok_index == ast.tokens.size());
+
+  ast.preprocessed_code.append(pragma_data);
+  ast.preprocessed_code.push_back('\n');
+  ast.num_lines += 1;
+  (void) ast.tokens.emplace_back(
+      loc.getRawEncoding(), 0u, 0u,
+      clang::tok::eod, TokenRole::kEndOfInternalMacroEventMarker);
+  return tok_index;
+}
+
+FileAndPragmaTracker::FileAndPragmaTracker(
+    clang::SourceManager &sm_, const clang::LangOptions &lang_opts_,
+    ASTImpl *ast_)
+    : sm(sm_),
+      lang_opts(lang_opts_),
+      ast(ast_) {}
+
+FileAndPragmaTracker::~FileAndPragmaTracker(void) {}
+
+void FileAndPragmaTracker::Clear(void) {
+  entering_include = false;
+  include_depth = 0u;
+}
+
+// Create a raw lexer that starts lexing at `loc`.
+std::unique_ptr<clang::Lexer>
+FileAndPragmaTracker::CreateRawLexer(clang::SourceLocation loc) const {
+  auto [file_id, offset] = sm.getDecomposedLoc(loc);
+  bool invalid = false;
+  llvm::StringRef buff = sm.getBufferData(file_id, &invalid);
+  if (invalid || offset >= buff.size()) {
+    return {};
+  }
+  return std::make_unique<clang::Lexer>(
+      sm.getLocForStartOfFile(file_id), lang_opts, buff.begin(),
+      &(buff.data()[offset]), buff.end());
+}
+
+// Collect the spelling of the rest of a `#pragma` line, i.e. the tokens
+// following the `pragma` keyword.
+void FileAndPragmaTracker::CollectPragmaLine(clang::Lexer &lexer,
+                                             std::string &out) const {
+  clang::Token tok;
+  while (LexRawToken(lexer, tok) && !tok.isAtStartOfLine()) {
+    out.push_back(' ');
+    out.append(clang::Lexer::getSpelling(tok, sm, lang_opts));
+  }
+}
+
+// Collect the destringized argument of a `_Pragma("...")` operator, i.e.
+// the tokens following the `_Pragma` keyword.
+bool FileAndPragmaTracker::CollectPragmaOperator(clang::Lexer &lexer,
+                                                 std::string &out) const {
+  clang::Token tok;
+  if (!LexRawToken(lexer, tok) || !tok.is(clang::tok::l_paren) ||
+      !LexRawToken(lexer, tok) ||
+      !clang::tok::isStringLiteral(tok.getKind())) {
+    return false;
+  }
+
+  std::string str = clang::Lexer::getSpelling(tok, sm, lang_opts);
+  auto begin = str.find('"');
+  auto end = str.rfind('"');
+  if (begin == std::string::npos || begin == end) {
+    return false;
+  }
+
+  // Destringize, as in C99 6.10.9.
+  out.push_back(' ');
+  for (auto i = begin + 1u; i < end; ++i) {
+    if (str[i] == '\\' && (i + 1u) < end &&
+        (str[i + 1u] == '\\' || str[i + 1u] == '"')) {
+      ++i;
+    }
+    out.push_back(str[i]);
+  }
+  return true;
+}
+
+// Collect the balanced, parenthesized argument of a `__pragma(...)`, i.e.
+// the tokens following the `__pragma` keyword.
+bool FileAndPragmaTracker::CollectMicrosoftPragma(clang::Lexer &lexer,
+                                                  std::string &out) const {
+  clang::Token tok;
+  if (!LexRawToken(lexer, tok) || !tok.is(clang::tok::l_paren)) {
+    return false;
+  }
+
+  for (auto depth = 1u; LexRawToken(lexer, tok); ) {
+    if (tok.is(clang::tok::l_paren)) {
+      ++depth;
+    } else if (tok.is(clang::tok::r_paren) && !--depth) {
+      return true;
+    }
+    out.push_back(' ');
+    out.append(clang::Lexer::getSpelling(tok, sm, lang_opts));
+  }
+  return false;
+}
+
+void FileAndPragmaTracker::InclusionDirective(
+    clang::SourceLocation, const clang::Token &, llvm::StringRef, bool,
+    clang::CharSourceRange, clang::OptionalFileEntryRef, llvm::StringRef,
+    llvm::StringRef, const clang::Module *,
+    clang::SrcMgr::CharacteristicKind) {
+  entering_include = true;
+}
+
+// Mirror `PatchedMacroTracker::FileChanged`, which only emits file markers
+// for files entered via `#include`-like directives.
+void FileAndPragmaTracker::FileChanged(
+    clang::SourceLocation loc, clang::PPCallbacks::FileChangeReason reason,
+    clang::SrcMgr::CharacteristicKind, clang::FileID file_id) {
+
+  if (clang::PPCallbacks::EnterFile == reason) {
+    if (entering_include && loc.isValid()) {
+      entering_include = false;
+      ++include_depth;
+      ast->AppendMarker(loc, TokenRole::kBeginOfFileMarker);
+    }
+
+  } else if (clang::PPCallbacks::ExitFile == reason &&
+             file_id.isValid() && include_depth) {
+    --include_depth;
+    ast->AppendMarker(sm.getLocForEndOfFile(file_id),
+                      TokenRole::kEndOfFileMarker);
+  }
+}
+
+// Re-emit the pragma as its own line of `ASTImpl::preprocessed_code`.
+void FileAndPragmaTracker::PragmaDirective(
+    clang::SourceLocation loc, clang::PragmaIntroducerKind introducer) {
+  std::unique_ptr<clang::Lexer> lexer = CreateRawLexer(sm.getSpellingLoc(loc));
+  if (!lexer) {
+    return;
+  }
+
+  std::string pragma_data = "#pragma";
+  clang::Token tok;
+
+  switch (introducer) {
+    case clang::PragmaIntroducerKind::PIK_HashPragma:
+
+      // `loc` is the `#`, so skip to the `pragma` keyword.
+      if (!LexRawToken(*lexer, tok) || !LexRawToken(*lexer, tok)) {
+        return;
+      }
+      CollectPragmaLine(*lexer, pragma_data);
+      break;
+    case clang::PragmaIntroducerKind::PIK__Pragma:
+      if (!LexRawToken(*lexer, tok) ||
+          !CollectPragmaOperator(*lexer, pragma_data)) {
+        return;
+      }
+      break;
+    case clang::PragmaIntroducerKind::PIK___pragma:
+      if (!LexRawToken(*lexer, tok) ||
+          !CollectMicrosoftPragma(*lexer, pragma_data)) {
+        return;
+      }
+      break;
+  }
+
+  (void) AppendPragmaLine(*ast, sm.getExpansionLoc(loc),
+                          std::move(pragma_data));
+}
+
+}  // namespace pasta
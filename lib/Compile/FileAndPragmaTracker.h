@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wbitfield-enum-conversion"
+#pragma GCC diagnostic ignored "-Wimplicit-int-conversion"
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+#pragma GCC diagnostic ignored "-Wshorten-64-to-32"
+#include <clang/Basic/SourceManager.h>
+#include <clang/Lex/Lexer.h>
+#include <clang/Lex/PPCallbacks.h>
+#pragma GCC diagnostic pop
+
+namespace pasta {
+
+class ASTImpl;
+
+// Re-emit the pragma `pragma_data` as its own line of
+// `ASTImpl::preprocessed_code`, represented by a zero-sized marker token at
+// `loc` in the parsed tokens. Pragmas are important for things like adjusting
+// structure packing, so they must be visible to the parse of `<pasta-input>`.
+// Returns the index of the marker token.
+//
+// NOTE(pag): This is shared by the `PatchedMacroTracker` and the
+//            `FileAndPragmaTracker`.
+uint32_t AppendPragmaLine(ASTImpl &ast, clang::SourceLocation loc,
+                          std::string pragma_data);
+
+// Stands in for the `PatchedMacroTracker` when macro tracking is disabled.
+// This doesn't build any macro nodes, nor track token derivations. It only
+// does the bookkeeping that the parse of `<pasta-input>` relies upon, i.e.
+// re-emitting pragmas into `ASTImpl::preprocessed_code` (so that things like
+// structure packing are respected), and it keeps the begin/end of file markers
+// so that the parsed tokens retain their file structure.
+//
+// NOTE(pag): Unlike the `PatchedMacroTracker`, macros used inside of pragmas
+//            are not expanded when the pragmas are re-emitted.
+class FileAndPragmaTracker : public clang::PPCallbacks {
+ private:
+  clang::SourceManager &sm;
+  const clang::LangOptions &lang_opts;
+
+  ASTImpl * const ast;
+
+  // Is the next entered file the target of an `#include`-like directive?
+  bool entering_include{false};
+
+  // Number of currently open files which were entered via `#include`-like
+  // directives.
+  unsigned include_depth{0u};
+
+  // Create a raw lexer that starts lexing at `loc`.
+  std::unique_ptr<clang::Lexer> CreateRawLexer(clang::SourceLocation loc) const;
+
+  // Collect the spelling of the rest of a `#pragma` line, i.e. the tokens
+  // following the `pragma` keyword.
+  void CollectPragmaLine(clang::Lexer &lexer, std::string &out) const;
+
+  // Collect the destringized argument of a `_Pragma("...")` operator, i.e.
+  // the tokens following the `_Pragma` keyword.
+  bool CollectPragmaOperator(clang::Lexer &lexer, std::string &out) const;
+
+  // Collect the balanced, parenthesized argument of a `__pragma(...)`, i.e.
+  // the tokens following the `__pragma` keyword.
+  bool CollectMicrosoftPragma(clang::Lexer &lexer, std::string &out) const;
+
+ public:
+  explicit FileAndPragmaTracker(clang::SourceManager &sm_,
+                                const clang::LangOptions &lang_opts_,
+                                ASTImpl *ast_);
+
+  virtual ~FileAndPragmaTracker(void);
+
+  void Clear(void);
+
+  void InclusionDirective(clang::SourceLocation, const clang::Token &,
+                          llvm::StringRef, bool, clang::CharSourceRange,
+                          clang::OptionalFileEntryRef, llvm::StringRef,
+                          llvm::StringRef, const clang::Module *,
+                          clang::SrcMgr::CharacteristicKind) final;
+
+  // Mirror `PatchedMacroTracker::FileChanged`, which only emits file markers
+  // for files entered via `#include`-like directives.
+  void FileChanged(clang::SourceLocation loc,
+                   clang::PPCallbacks::FileChangeReason reason,
+                   clang::SrcMgr::CharacteristicKind,
+                   clang::FileID file_id) final;
+
+  // Re-emit the pragma as its own line of `ASTImpl::preprocessed_code`.
+  void PragmaDirective(clang::SourceLocation loc,
+                       clang::PragmaIntroducerKind introducer) final;
+};
+
+}  // namespace pasta
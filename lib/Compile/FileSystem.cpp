@@ -4,6 +4,8 @@
 
 #include "FileSystem.h"
 
+#include <algorithm>
+
 namespace pasta {
 namespace {
 
@@ -125,22 +127,48 @@ std::error_code LLVMDirectoryIterator::increment(void) {
 
 LLVMFileSystem::~LLVMFileSystem(void) {}
 
+// Record `path` as missing if `ec` says that it doesn't exist.
+void LLVMFileSystem::RecordMissingPath(const std::filesystem::path &path,
+                                       std::error_code ec) {
+  if (ec != std::errc::no_such_file_or_directory) {
+    return;
+  }
+  std::unique_lock<std::mutex> locker(missing_paths_lock);
+  if (record_missing_paths) {
+    missing_paths.push_back(path);
+  }
+}
+
+// Stop recording missing paths, and return the sorted and unique paths that
+// were recorded.
+std::vector<std::filesystem::path> LLVMFileSystem::TakeMissingPaths(void) {
+  std::unique_lock<std::mutex> locker(missing_paths_lock);
+  record_missing_paths = false;
+  std::vector<std::filesystem::path> paths = std::move(missing_paths);
+  missing_paths.clear();
+  std::sort(paths.begin(), paths.end());
+  paths.erase(std::unique(paths.begin(), paths.end()), paths.end());
+  return paths;
+}
+
 // Get the status of the entry at `path`, if one exists.
 llvm::ErrorOr<llvm::vfs::Status>
 LLVMFileSystem::status(const llvm::Twine &path) {
   auto fs_path = file_system.ParsePath(path.str());
-  auto stat = file_system.Stat(std::move(fs_path));
+  auto stat = file_system.Stat(fs_path);
   if (stat.Succeeded()) {
     return ToLLVM(stat.TakeValue());
   }
-  return stat.TakeError();
+  std::error_code ec = stat.TakeError();
+  RecordMissingPath(fs_path, ec);
+  return ec;
 }
 
 // Get an `LLVMFile` object for the file at `path`, if one exists.
 llvm::ErrorOr<std::unique_ptr<llvm::vfs::File>>
 LLVMFileSystem::openFileForRead(const llvm::Twine &path) {
   auto fs_path = file_system.ParsePath(path.str());
-  auto maybe_stat = file_system.Stat(std::move(fs_path));
+  auto maybe_stat = file_system.Stat(fs_path);
   if (maybe_stat.Succeeded()) {
     auto stat = maybe_stat.TakeValue();
     if (stat.IsDirectory()) {
@@ -152,7 +180,9 @@ LLVMFileSystem::openFileForRead(const llvm::Twine &path) {
     }
     return file.TakeError();
   }
-  return maybe_stat.TakeError();
+  std::error_code ec = maybe_stat.TakeError();
+  RecordMissingPath(fs_path, ec);
+  return ec;
 }
 
 // Get a `directory_iterator` for `path`.
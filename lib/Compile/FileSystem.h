@@ -14,6 +14,8 @@
 #include <llvm/Support/VirtualFileSystem.h>
 #pragma clang diagnostic pop
 
+#include <filesystem>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -70,6 +72,17 @@ class LLVMFileSystem final : public llvm::vfs::FileSystem {
   ::pasta::FileManager file_manager;
   ::pasta::FileSystemView file_system;
 
+  // Paths that were looked up but that didn't exist, e.g. the paths of an
+  // included file in the include directories that come before the one where
+  // it was found. These are recorded until `TakeMissingPaths` is called.
+  std::mutex missing_paths_lock;
+  std::vector<std::filesystem::path> missing_paths;
+  bool record_missing_paths{true};
+
+  // Record `path` as missing if `ec` says that it doesn't exist.
+  void RecordMissingPath(const std::filesystem::path &path,
+                         std::error_code ec);
+
  public:
   virtual ~LLVMFileSystem(void);
 
@@ -104,6 +117,10 @@ class LLVMFileSystem final : public llvm::vfs::FileSystem {
 
   // Make `path` an absolute path.
   std::error_code makeAbsolute(llvm::SmallVectorImpl<char> &path) const final;
+
+  // Stop recording missing paths, and return the sorted and unique paths that
+  // were recorded.
+  std::vector<std::filesystem::path> TakeMissingPaths(void);
 };
 
 }  // namespace pasta
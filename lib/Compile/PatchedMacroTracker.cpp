@@ -11,8 +11,12 @@
 #pragma GCC diagnostic ignored "-Wshorten-64-to-32"
 #include <clang/Basic/LangOptions.h>
 #include <clang/Frontend/CompilerInstance.h>
+#include <clang/Lex/MacroInfo.h>
+#include <llvm/ADT/SmallString.h>
 #pragma GCC diagnostic pop
 
+#include "FileAndPragmaTracker.h"
+
 // #define D(...) __VA_ARGS__
 #ifndef D
 # define D(...)
@@ -1048,6 +1052,95 @@ void ASTImpl::LinkMacroTokenContexts(void) {
   }
 }
 
+// Build up the canonical spelling of each `#define`, then intern them all at
+// once, so that the file manager's lock is only acquired once per AST. This
+// does nothing unless macro definition sharing is enabled on the file manager.
+//
+// NOTE(pag): The spellings are built up in one shared buffer, and only the
+//            definitions that aren't already interned are copied out of it, so
+//            the AST ends up only referencing the shared definitions.
+void ASTImpl::InternMacroDefinitions(const FileManager &file_manager) {
+  if (!file_manager.impl->share_macro_definitions.load(
+          std::memory_order_relaxed)) {
+    return;
+  }
+
+  std::vector<MacroDirectiveImpl *> defines;
+  MacroDefinitionBatch batch;
+  std::string &data = batch.data;
+  llvm::SmallString<64> spelling_buff;
+  clang::Preprocessor &pp = *orig_source_pp;
+
+  for (MacroDirectiveImpl &dir : root_macro_node.directives) {
+    const clang::MacroInfo *mi = dir.defined_macro;
+    if (dir.kind != MacroKind::kDefineDirective || !mi ||
+        !std::holds_alternative<MacroTokenImpl *>(dir.macro_name)) {
+      continue;
+    }
+
+    MacroDefinitionCandidate &cand = batch.candidates.emplace_back();
+    MacroTokenImpl *name = std::get<MacroTokenImpl *>(dir.macro_name);
+    const auto data_offset = static_cast<uint32_t>(data.size());
+    auto relative_offset = [&] (void) {
+      return static_cast<uint32_t>(data.size()) - data_offset;
+    };
+
+    data += tokens[name->token_offset].Data(*this);
+    cand.data_offset = data_offset;
+    cand.name_len = relative_offset();
+    cand.parameters_begin = static_cast<uint32_t>(batch.parameters.size());
+    cand.is_function_like = mi->isFunctionLike();
+    cand.is_variadic = mi->isVariadic();
+    cand.num_explicit_parameters = mi->getNumParams() - (mi->isVariadic() ?
+                                                         1u : 0u);
+
+    if (cand.is_function_like) {
+      const char *sep = "(";
+      for (const clang::IdentifierInfo *param : mi->params()) {
+        data += sep;
+        sep = ", ";
+
+        const auto offset = relative_offset();
+        if (mi->isC99Varargs() && param == mi->params().back()) {
+          data += "...";
+        } else {
+          data += param->getName();
+        }
+
+        batch.parameters.emplace_back(offset, relative_offset() - offset);
+        ++cand.num_parameters;
+      }
+      if (mi->isGNUVarargs()) {
+        data += "...";
+      }
+      data += cand.num_parameters ? ")" : "()";
+    }
+
+    data += ' ';
+    cand.body_offset = relative_offset();
+    for (const clang::Token &tok : mi->tokens()) {
+      if (cand.body_offset < relative_offset() && tok.hasLeadingSpace()) {
+        data += ' ';
+      }
+      bool invalid = false;
+      data += pp.getSpelling(tok, spelling_buff, &invalid);
+    }
+
+    cand.data_len = relative_offset();
+    defines.push_back(&dir);
+  }
+
+  if (defines.empty()) {
+    return;
+  }
+
+  auto canon_defs = file_manager.impl->InternMacroDefinitions(batch);
+  assert(canon_defs.size() == defines.size());
+  for (size_t i = 0u, max_i = defines.size(); i < max_i; ++i) {
+    defines[i]->canonical_definition = std::move(canon_defs[i]);
+  }
+}
+
 #define FOR_EACH_PP_KEYWORD(m) \
     m(if, MacroKind::kIfDirective) \
     m(ifdef, MacroKind::kIfDefinedDirective) \
@@ -1451,13 +1544,8 @@ void PatchedMacroTracker::DoEndDirective(
 
     assert(unexpanded_macros.empty());
 
-    auto tok_index = static_cast<unsigned>(ast->tokens.size());
-    ast->preprocessed_code.append(pragma_data);
-    ast->preprocessed_code.push_back('\n');
-    ast->num_lines += 1;
-    (void) ast->tokens.emplace_back(
-        last_loc.getRawEncoding(), 0u, 0u,
-        clang::tok::eod, TokenRole::kEndOfInternalMacroEventMarker);
+    const uint32_t tok_index =
+        AppendPragmaLine(*ast, last_loc, std::move(pragma_data));
 
     MacroTokenImpl *macro_tok = &(ast->root_macro_node.tokens.emplace_back());
     macro_tok->token_offset = static_cast<uint32_t>(tok_index);
@@ -103,8 +103,12 @@ static void FixupTokData(std::string_view tok_data,
 //        Thus, we will have Clang re-preprocess this new buffer, and then we'll
 //        be able to associated back to original tokens by using the line number
 //        of the updated token.
+//
+// If `track_macros` is `false`, then there is no `PatchedMacroTracker`, and so
+// macro expansion tokens are first seen here, rather than being added by the
+// tracker as intermediate macro expansion tokens.
 void PreprocessCode(ASTImpl &impl, clang::CompilerInstance &ci,
-                    clang::Preprocessor &pp) {
+                    clang::Preprocessor &pp, bool track_macros) {
   clang::SourceManager &source_manager = ci.getSourceManager();
   clang::LangOptions &lang_opts = ci.getLangOpts();
 
@@ -142,7 +146,8 @@ void PreprocessCode(ASTImpl &impl, clang::CompilerInstance &ci,
     // The end of an expansion is tracked by the patched macro tracker, but the
     // last outputted token really comes before the end marker, so we always
     // want to remove it.
-    if (tokens.back().Role() == TokenRole::kEndOfMacroExpansionMarker) {
+    if (!tokens.empty() &&
+        tokens.back().Role() == TokenRole::kEndOfMacroExpansionMarker) {
       end_of_macro_tok = std::move(tokens.back());
       assert(impl.preprocessed_code.back() == '\n');
       tokens.pop_back();
@@ -164,7 +169,7 @@ void PreprocessCode(ASTImpl &impl, clang::CompilerInstance &ci,
     // It's a macro expansion token. We will already have a copy of this token
     // as the most recently added token, so we need to transfer its data to
     // the code to be parsed, rather than the backup data area.
-    if (tok_loc.isMacroID()) {
+    if (tok_loc.isMacroID() && track_macros) {
       TokenImpl &prev_tok = tokens.back();
 
       assert(prev_tok.Role() == TokenRole::kIntermediateMacroExpansionToken);
@@ -237,8 +242,17 @@ void PreprocessCode(ASTImpl &impl, clang::CompilerInstance &ci,
       end_of_macro_tok.reset();
     }
 
-    // It's a file token, we need to parse it.
-    assert(tok_loc.isFileID());
+    // It's a file token, we need to parse it. Without macro tracking, it might
+    // instead be a macro expansion token, which we locate at its spelling, so
+    // that it still has a file location, albeit without any derivation.
+    TokenRole role = TokenRole::kFileToken;
+    if (tok_loc.isMacroID()) {
+      assert(!track_macros);
+      role = TokenRole::kFinalMacroExpansionToken;
+      tok.setLocation(source_manager.getSpellingLoc(tok_loc));
+    }
+
+    assert(tok.getLocation().isFileID());
 
     if (tok.isOneOf(clang::tok::eod, clang::tok::unknown, clang::tok::comment,
                     clang::tok::code_completion)) {
@@ -247,7 +261,7 @@ void PreprocessCode(ASTImpl &impl, clang::CompilerInstance &ci,
         // Only retain these if they're contributing something in terms of
         // source locations.
         if (auto loc = tok.getLocation(); loc.isValid() && loc.isFileID()) {
-          impl.AppendMarker(loc, TokenRole::kFileToken);
+          impl.AppendMarker(loc, role);
         }
 
       // Comments and whitespace are stored "out-of-line" in the
@@ -260,7 +274,7 @@ void PreprocessCode(ASTImpl &impl, clang::CompilerInstance &ci,
       } else {
         backup_os.flush();
         impl.AppendBackupToken(tok, impl.backup_token_data.size(),
-                               tok_data.size(), TokenRole::kFileToken);
+                               tok_data.size(), role);
         backup_os << tok_data;
         os << '\n';
         os.flush();
@@ -282,7 +296,7 @@ void PreprocessCode(ASTImpl &impl, clang::CompilerInstance &ci,
     if (!has_new_line) {
       os.flush();
       impl.AppendToken(tok, impl.preprocessed_code.size(), tok_data.size(),
-                       TokenRole::kFileToken);
+                       role);
       os << tok_data << '\n';
       os.flush();
       ++num_lines;
@@ -293,7 +307,7 @@ void PreprocessCode(ASTImpl &impl, clang::CompilerInstance &ci,
     // The token needs to be modified somehow, so add it to our backups.
     backup_os.flush();
     impl.AppendBackupToken(tok, impl.backup_token_data.size(), tok_data.size(),
-                           TokenRole::kFileToken);
+                           role);
     backup_os << tok_data;
     FixupTokData(tok_data, fixed_tok_data);
     os << fixed_tok_data << '\n';
@@ -307,10 +321,11 @@ void PreprocessCode(ASTImpl &impl, clang::CompilerInstance &ci,
 
   // For some reason Clang doesn't invoke the `ExitFile` thing for the main
   // file.
-  if (tokens.back().Kind() != clang::tok::eof) {
+  if (tokens.empty() || tokens.back().Kind() != clang::tok::eof) {
 
     // We didn't get an `ExitFile`.
-    if (tokens.back().Role() != TokenRole::kEndOfFileMarker) {
+    if (tokens.empty() ||
+        tokens.back().Role() != TokenRole::kEndOfFileMarker) {
       auto loc = source_manager.getLocForEndOfFile(
           source_manager.getMainFileID());
       impl.AppendMarker(loc,
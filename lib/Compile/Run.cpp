@@ -42,6 +42,7 @@
 #include <pasta/Util/ArgumentVector.h>
 #include <pasta/Util/Compiler.h>
 
+#include "FileAndPragmaTracker.h"
 #include "ParsedFileTracker.h"
 #include "FileSystem.h"
 
@@ -75,13 +76,36 @@ PASTA_BYPASS_MEMBER_OBJECT_ACCESS(clang, FileEntry, File,
 }  // namespace detail
 
 extern void PreprocessCode(ASTImpl &impl, clang::CompilerInstance &ci,
-                           clang::Preprocessor &pp);
+                           clang::Preprocessor &pp, bool track_macros);
 
 extern void AddCustomBuiltinsToPreprocessor(ASTImpl &ast,
                                             clang::Preprocessor &pp);
 
-// Run a command ans return the AST or the first error.
-Result<AST, std::string> CompileJob::Run(void) const {
+// Run a command and return the AST or the first error.
+Result<AST, std::string> CompileJob::Run(MacroTracking macro_tracking) const {
+  auto ast = RunImpl(false  /* preprocess_only */,
+                     macro_tracking == MacroTracking::kEnabled);
+  if (!ast.Succeeded()) {
+    return ast.TakeError();
+  }
+  return AST(ast.TakeValue());
+}
+
+// Run only the preprocessor of a command, and return the tokens and macros,
+// or the first error.
+Result<PreprocessedTranslationUnit, std::string>
+CompileJob::Preprocess(void) const {
+  auto ast = RunImpl(true  /* preprocess_only */, true  /* track_macros */);
+  if (!ast.Succeeded()) {
+    return ast.TakeError();
+  }
+  return PreprocessedTranslationUnit(ast.TakeValue());
+}
+
+// Run a command up to and including pre-processing, and then optionally
+// parse the pre-processed code into an AST.
+Result<std::shared_ptr<ASTImpl>, std::string>
+CompileJob::RunImpl(bool preprocess_only, bool track_macros) const {
   std::stringstream err;
 
   std::shared_ptr<ASTImpl> ast = std::make_shared<ASTImpl>(SourceFile());
@@ -338,10 +362,19 @@ Result<AST, std::string> CompileJob::Run(void) const {
   // NOTE(pag): Add the macro tracker first so that it can observe changes to
   //            `ASTImpl::id_to_file` enacted by
   //            `ParsedFileTracker::FileChanged`.
-  MacroTracker *macro_tracker_ptr = new MacroTracker(pp, sm, ast.get());
-  {
+  MacroTracker *macro_tracker_ptr = nullptr;
+  FileAndPragmaTracker *pragma_tracker_ptr = nullptr;
+  if (track_macros) {
+    macro_tracker_ptr = new MacroTracker(pp, sm, ast.get());
     std::unique_ptr<clang::PPCallbacks> macro_tracker(macro_tracker_ptr);
     pp.addPPCallbacks(std::move(macro_tracker));
+
+  // Without macro tracking, we still need to re-emit pragmas into the
+  // pre-processed code.
+  } else {
+    pragma_tracker_ptr = new FileAndPragmaTracker(sm, lang_opts, ast.get());
+    std::unique_ptr<clang::PPCallbacks> pragma_tracker(pragma_tracker_ptr);
+    pp.addPPCallbacks(std::move(pragma_tracker));
   }
 
   ParsedFileTracker *file_tracker_ptr = new ParsedFileTracker(
@@ -359,13 +392,51 @@ Result<AST, std::string> CompileJob::Run(void) const {
 
   // Picks up on the pre-processor and stuff.
   ci.InitializeSourceManager(input_files[0]);
-  PreprocessCode(*ast, ci, pp);
+  PreprocessCode(*ast, ci, pp, track_macros);
 
   // If we didn't end up tracking any files then something is seriously wrong.
   assert(!ast->id_to_file.empty());
 
   file_tracker_ptr->Clear();
-  macro_tracker_ptr->Clear();
+  if (macro_tracker_ptr) {
+    macro_tracker_ptr->Clear();
+  } else {
+    pragma_tracker_ptr->Clear();
+  }
+
+  // NOTE(pag): In preprocess-only mode, we never build the `<pasta-input>`
+  //            overlay file, nor do we create the `Sema` or parse anything.
+  //            The tokens and macros are fully formed at this point, and so
+  //            we just need to finalize them.
+  if (preprocess_only) {
+    if (diagnostics_engine->hasUncompilableErrorOccurred() ||
+        diagnostics_engine->hasFatalErrorOccurred() ||
+        !diag->error.empty()) {
+      if (diag->error.empty()) {
+        err << "A clang diagnostic or uncompilable error was produced when "
+            << "trying to preprocess: " << argv.Join();
+        return err.str();
+      }
+      err << "A clang diagnostic or uncompilable error was produced when "
+          << "trying to preprocess due to error: " << diag->error;
+      return err.str();
+    }
+
+    ast->missing_paths =
+        static_cast<LLVMFileSystem *>(real_vfs.get())->TakeMissingPaths();
+    ast->real_fs = std::move(real_vfs);
+    ast->overlay_fs = std::move(overlay_vfs);
+    ast->mem_fs = std::move(mem_vfs);
+    ast->fm = std::move(fm);
+
+    // NOTE(pag): Only intern the macro definitions of successful jobs, so that
+    //            failed jobs don't add definitions to the file manager.
+    ast->InternMacroDefinitions(impl->file_manager);
+    ast->MarkMacroTokens();
+    ast->LinkMacroTokenContexts();
+    ast->BuildDerivationTables();
+    return std::move(ast);
+  }
 
   // auto fd = open("/tmp/source.cpp", O_TRUNC | O_CREAT | O_WRONLY, 0666);
   // write(fd, ast->preprocessed_code.data(), ast->preprocessed_code.size());
@@ -474,6 +545,8 @@ Result<AST, std::string> CompileJob::Run(void) const {
     return err.str();
   }
 
+  ast->missing_paths =
+      static_cast<LLVMFileSystem *>(real_vfs.get())->TakeMissingPaths();
   ast->real_fs = std::move(real_vfs);
   ast->overlay_fs = std::move(overlay_vfs);
   ast->mem_fs = std::move(mem_vfs);
@@ -493,10 +566,12 @@ Result<AST, std::string> CompileJob::Run(void) const {
     policy->IncludeTagDefinition = true;
   }
 
+  ast->InternMacroDefinitions(impl->file_manager);
   ast->MarkMacroTokens();
   ast->PreprocessLexicalParentage();
   ast->LinkMacroTokenContexts();
-  return AST(std::move(ast));
+  ast->BuildDerivationTables();
+  return std::move(ast);
 }
 
 }  // namespace pasta
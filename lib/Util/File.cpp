@@ -35,6 +35,24 @@ static const std::string_view kObjCKeywordSpelling[] = {
 
 }  // namespace
 
+// Normalize freshly read file data in the same way as `File::Data`, i.e. into
+// UTF-8 with a trailing NUL, and return the hash of the normalized data.
+uint64_t NormalizeFileData(std::string &data) {
+
+  // A lot of code in PASTA relies on the file being formatted as UTF-8.
+  if (!llvm::json::isUTF8(data)) {
+    data = llvm::json::fixUTF8(data);
+  }
+
+  // NOTE(pag): We use this extra trailing NUL to help us with location
+  //            offsets for EOF tokens.
+  data.push_back('\0');
+
+  // NOTE(pag): We use the data hash to help us maintain semi-determinstic
+  //            `__COUNTER__` values across files.
+  return llvm::xxHash64(data);
+}
+
 FileImpl::FileImpl(const std::shared_ptr<FileManagerImpl> &owner_, Stat stat_)
     : owner(owner_),
       stat(std::move(stat_)) {}
@@ -81,19 +99,7 @@ Result<std::string_view, std::error_code> File::Data(void) const noexcept {
   auto maybe_file = fm->file_system->ReadFile(impl->stat);
   if (maybe_file.Succeeded()) {
     maybe_file.TakeValue().swap(impl->data);
-
-    // A lot of code in PASTA relies on the file being formatted as UTF-8.
-    if (!llvm::json::isUTF8(impl->data)) {
-      impl->data = llvm::json::fixUTF8(impl->data);
-    }
-
-    // NOTE(pag): We use this extra trailing NUL to help us with location
-    //            offsets for EOF tokens.
-    impl->data.push_back('\0');
-
-    // NOTE(pag): We use the data hash to help us maintain semi-determinstic
-    //            `__COUNTER__` values across files.
-    impl->data_hash = llvm::xxHash64(impl->data);
+    impl->data_hash = NormalizeFileData(impl->data);
 
     return std::string_view(impl->data.data(), impl->data.size() - 1u);
 
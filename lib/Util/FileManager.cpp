@@ -4,6 +4,10 @@
 
 #include "FileManager.h"
 
+#include <algorithm>
+
+#include <llvm/Support/xxhash.h>
+
 namespace pasta {
 
 FileManager::~FileManager(void) {}
@@ -16,6 +20,12 @@ std::shared_ptr<::pasta::FileSystem> FileManager::FileSystem(void) const {
   return impl->file_system;
 }
 
+// Share canonical macro definitions across all ASTs made after this call whose
+// files are managed by this file manager.
+void FileManager::EnableMacroDefinitionSharing(void) const {
+  impl->share_macro_definitions.store(true, std::memory_order_relaxed);
+}
+
 // Return the file manager containing a file.
 FileManager FileManager::Containing(const File &file) {
   return FileManager(file.impl->owner.lock());
@@ -57,4 +67,90 @@ Result<File, std::error_code> FileManager::OpenFile(Stat stat) const {
   return File(std::move(file_impl));
 }
 
+// Does the interned definition `def` have the same spelling and kind as the
+// candidate `cand`?
+static bool IsSameDefinition(const MacroDefinitionImpl &def,
+                             const MacroDefinitionCandidate &cand,
+                             std::string_view cand_data) {
+  return def.hash == cand.hash &&
+         def.is_function_like == cand.is_function_like &&
+         def.is_variadic == cand.is_variadic &&
+         def.data == cand_data;
+}
+
+// Copy the candidate `cand` out of `batch` into a new definition.
+static std::shared_ptr<const MacroDefinitionImpl> MakeDefinition(
+    const MacroDefinitionBatch &batch, const MacroDefinitionCandidate &cand,
+    std::string_view cand_data) {
+  auto def = std::make_shared<MacroDefinitionImpl>();
+  def->data = cand_data;
+  def->name_len = cand.name_len;
+  def->body_offset = cand.body_offset;
+  const auto params_begin = batch.parameters.begin() + cand.parameters_begin;
+  def->parameters.assign(params_begin, params_begin + cand.num_parameters);
+  def->hash = cand.hash;
+  def->num_explicit_parameters = cand.num_explicit_parameters;
+  def->is_function_like = cand.is_function_like;
+  def->is_variadic = cand.is_variadic;
+  return def;
+}
+
+std::vector<std::shared_ptr<const MacroDefinitionImpl>>
+FileManagerImpl::InternMacroDefinitions(MacroDefinitionBatch &batch) {
+  std::vector<std::shared_ptr<const MacroDefinitionImpl>> canon_defs;
+  canon_defs.reserve(batch.candidates.size());
+
+  // Hash outside of the lock.
+  const std::string_view batch_data(batch.data);
+  for (MacroDefinitionCandidate &cand : batch.candidates) {
+    cand.hash = llvm::xxHash64(
+        batch_data.substr(cand.data_offset, cand.data_len));
+  }
+
+  std::unique_lock<std::mutex> locker(macro_definitions_lock);
+
+  for (const MacroDefinitionCandidate &cand : batch.candidates) {
+    const std::string_view cand_data =
+        batch_data.substr(cand.data_offset, cand.data_len);
+
+    std::shared_ptr<const MacroDefinitionImpl> canon_def;
+    auto [it, end] = macro_definitions.equal_range(cand.hash);
+    while (it != end) {
+      std::shared_ptr<const MacroDefinitionImpl> def = it->second.lock();
+      if (!def) {
+        it = macro_definitions.erase(it);
+      } else if (IsSameDefinition(*def, cand, cand_data)) {
+        canon_def = std::move(def);
+        break;
+      } else {
+        ++it;
+      }
+    }
+
+    if (!canon_def) {
+      canon_def = MakeDefinition(batch, cand, cand_data);
+      macro_definitions.emplace(cand.hash, canon_def);
+    }
+
+    canon_defs.emplace_back(std::move(canon_def));
+  }
+
+  // Sweep out the definitions that are no longer used by any AST, so that the
+  // map only grows with the number of live definitions.
+  if (macro_definitions.size() >= next_macro_definitions_sweep) {
+    for (auto it = macro_definitions.begin();
+         it != macro_definitions.end(); ) {
+      if (it->second.expired()) {
+        it = macro_definitions.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    next_macro_definitions_sweep = std::max<size_t>(
+        next_macro_definitions_sweep, macro_definitions.size() * 2u);
+  }
+
+  return canon_defs;
+}
+
 }  // namespace pasta
@@ -6,11 +6,16 @@
 
 #include <pasta/Util/FileManager.h>
 
+#include <atomic>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <pasta/Util/File.h>
+#include <pasta/Util/MacroDefinition.h>
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wimplicit-int-conversion"
@@ -57,6 +62,11 @@ struct FileTokenImpl {
   } __attribute__((packed)) kind;
 };
 
+// Normalize freshly read file data in the same way as `File::Data`, i.e. into
+// UTF-8 with a trailing NUL, and return the hash of the normalized data. This
+// is the value returned by `File::DataHash`.
+uint64_t NormalizeFileData(std::string &data);
+
 // Implementation of a backing file.
 class FileImpl final {
  public:
@@ -90,6 +100,62 @@ class FileImpl final {
   std::vector<FileTokenImpl> tokens;
 };
 
+// Backing implementation of a canonical macro definition.
+struct MacroDefinitionImpl final {
+
+  // Spelling of the whole definition, e.g. `FOO(a, b) a + b`. The name is at
+  // the beginning of `data`.
+  std::string data;
+  uint32_t name_len{0u};
+
+  // Offset of the body in `data`.
+  uint32_t body_offset{0u};
+
+  // Offsets and lengths of parameter names in `data`.
+  std::vector<std::pair<uint32_t, uint32_t>> parameters;
+
+  uint64_t hash{0u};
+  unsigned num_explicit_parameters{0u};
+  bool is_function_like{false};
+  bool is_variadic{false};
+};
+
+// A macro definition that is a candidate for interning. Its spelling and
+// parameters live in the buffers of its `MacroDefinitionBatch`, so building up
+// a batch doesn't allocate per definition, and only definitions that aren't
+// already interned are ever copied out of the batch.
+struct MacroDefinitionCandidate final {
+
+  // Offset and length of the spelling of the definition in
+  // `MacroDefinitionBatch::data`.
+  uint32_t data_offset{0u};
+  uint32_t data_len{0u};
+
+  // Like in `MacroDefinitionImpl`, but relative to `data_offset`.
+  uint32_t name_len{0u};
+  uint32_t body_offset{0u};
+
+  // Range of this candidate's parameters in `MacroDefinitionBatch::parameters`.
+  uint32_t parameters_begin{0u};
+  uint32_t num_parameters{0u};
+
+  uint64_t hash{0u};
+  unsigned num_explicit_parameters{0u};
+  bool is_function_like{false};
+  bool is_variadic{false};
+};
+
+// All of the macro definitions of one AST, to be interned together.
+struct MacroDefinitionBatch final {
+  std::string data;
+
+  // Offsets (relative to the candidate's `data_offset`) and lengths of the
+  // parameter names of all candidates.
+  std::vector<std::pair<uint32_t, uint32_t>> parameters;
+
+  std::vector<MacroDefinitionCandidate> candidates;
+};
+
 // Backing implementation of a file manager.
 class FileManagerImpl final
     : public std::enable_shared_from_this<FileManagerImpl> {
@@ -104,6 +170,30 @@ class FileManagerImpl final
   // Guards access to `open_files`.
   std::mutex open_files_lock;
 
+  // Deduplicated macro definitions, keyed by `MacroDefinitionImpl::hash`.
+  // These are shared by all ASTs whose files are managed by this file manager.
+  //
+  // NOTE(pag): The ASTs own the definitions, and so a definition is freed once
+  //            no AST references it. Expired entries are pruned as they are
+  //            found during lookups, and by a full sweep whenever the map
+  //            grows past `next_macro_definitions_sweep`.
+  std::unordered_multimap<uint64_t, std::weak_ptr<const MacroDefinitionImpl>>
+      macro_definitions;
+  size_t next_macro_definitions_sweep{1024u};
+
+  // Guards access to `macro_definitions`.
+  std::mutex macro_definitions_lock;
+
+  // Should ASTs intern their macro definitions into `macro_definitions`?
+  std::atomic<bool> share_macro_definitions{false};
+
+  // Return the canonical version of each candidate definition in `batch`,
+  // adding them to `macro_definitions` if they aren't already present. This
+  // acquires `macro_definitions_lock` only once per call, and so whole
+  // translation units worth of definitions should be interned together.
+  std::vector<std::shared_ptr<const MacroDefinitionImpl>>
+  InternMacroDefinitions(MacroDefinitionBatch &batch);
+
   inline FileManagerImpl(std::shared_ptr<FileSystem> file_system_)
       : file_system(std::move(file_system_)) {}
 };
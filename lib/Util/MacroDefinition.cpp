@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2023 Trail of Bits, Inc.
+ */
+
+#include <pasta/Util/MacroDefinition.h>
+
+#include "FileManager.h"
+
+namespace pasta {
+
+MacroDefinition::~MacroDefinition(void) {}
+
+// Name of the defined macro.
+std::string_view MacroDefinition::Name(void) const noexcept {
+  return std::string_view(impl->data).substr(0u, impl->name_len);
+}
+
+// Names of the parameters.
+std::vector<std::string_view> MacroDefinition::ParameterNames(void) const {
+  std::vector<std::string_view> names;
+  names.reserve(impl->parameters.size());
+  for (auto [offset, len] : impl->parameters) {
+    names.emplace_back(std::string_view(impl->data).substr(offset, len));
+  }
+  return names;
+}
+
+// Spelling of the body of this macro.
+std::string_view MacroDefinition::Body(void) const noexcept {
+  return std::string_view(impl->data).substr(impl->body_offset);
+}
+
+// Spelling of the whole definition.
+std::string_view MacroDefinition::Data(void) const noexcept {
+  return impl->data;
+}
+
+// Number of explicit, i.e. not variadic, parameters.
+unsigned MacroDefinition::NumExplicitParameters(void) const noexcept {
+  return impl->num_explicit_parameters;
+}
+
+// Does this definition accept a variable number of arguments?
+bool MacroDefinition::IsVariadic(void) const noexcept {
+  return impl->is_variadic;
+}
+
+// Is this a function-like macro?
+bool MacroDefinition::IsFunctionLike(void) const noexcept {
+  return impl->is_function_like;
+}
+
+// Hash of `Data()`.
+uint64_t MacroDefinition::Hash(void) const noexcept {
+  return impl->hash;
+}
+
+}  // namespace pasta
@@ -0,0 +1,36 @@
+// RUN: cp %s %t.first.c
+// RUN: cp %s %t.second.c
+// RUN: echo "#define ONLY_IN_SECOND 1" >> %t.second.c
+// RUN: print-c-entities --pasta-canonical-macros %t.first.c > %t.unshared
+// RUN: print-c-entities --pasta-share-macros --pasta-canonical-macros %t.first.c %t.second.c > %t.shared
+// RUN: FileCheck %s --check-prefix=UNSHARED --input-file %t.unshared
+// RUN: FileCheck %s --check-prefix=SHARED --input-file %t.shared
+
+// Two compile jobs sharing a file manager share the canonical definitions of
+// their equivalent `#define`s, and a redefinition with a different body gets
+// a different canonical definition. Without opting in to sharing, there are no
+// canonical definitions.
+
+// UNSHARED: job {{.*}}.first.c
+// UNSHARED: define ADD none
+// UNSHARED-NOT: |
+
+// SHARED: job {{.*}}.first.c
+// SHARED: define ADD [[ADD:[0-9]+]] |ADD(a, b) ((a) + (b))
+// SHARED: define ID [[ID:[0-9]+]] |ID(x) x
+// SHARED: define ID [[REDEFINED_ID:[0-9]+]] |ID(x) (x)
+// SHARED: job {{.*}}.second.c
+// SHARED: define ADD [[ADD]] |
+// SHARED: define ID [[ID]] |
+// SHARED: define ID [[REDEFINED_ID]] |
+// SHARED: define ONLY_IN_SECOND {{[0-9]+}} |ONLY_IN_SECOND 1
+
+#define ADD(a, b) ((a) + (b))
+#define ID(x) x
+
+int first = ADD(ID(1), 2);
+
+#undef ID
+#define ID(x) (x)
+
+int second = ADD(ID(3), 4);
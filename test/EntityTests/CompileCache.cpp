@@ -0,0 +1,32 @@
+// RUN: rm -rf %t.cache
+// RUN: cp %s %t.cpp
+// RUN: print-cxx-entities --pasta-parsed-tokens %t.cpp > %t.ast
+// RUN: print-cxx-entities --pasta-compile-cache=%t.cache %t.cpp > %t.first
+// RUN: print-cxx-entities --pasta-compile-cache=%t.cache --pasta-check-cache-collisions %t.cpp > %t.second
+// RUN: print-cxx-entities --pasta-compile-cache=%t.cache -DOTHER %t.cpp > %t.other
+// RUN: echo "int changed;" >> %t.cpp
+// RUN: print-cxx-entities --pasta-compile-cache=%t.cache %t.cpp > %t.changed
+// RUN: FileCheck %s --check-prefix=MISS --input-file %t.first
+// RUN: FileCheck %s --check-prefix=HIT --input-file %t.second
+// RUN: FileCheck %s --check-prefix=MISS --input-file %t.other
+// RUN: FileCheck %s --check-prefix=MISS --input-file %t.changed
+// RUN: grep -v "^cache " %t.second > %t.second.tokens
+// RUN: diff %t.ast %t.second.tokens
+
+// The first run of a job misses the cache and stores an entry, and an
+// identical second run hits it and gets the same files and tokens as parsing
+// the file. Changing the arguments or the contents of a parsed file misses.
+// An entry that ends up at the path of another key, as if the hashes of the
+// keys collided, must not be returned for that other key.
+
+// MISS: cache miss
+// HIT: cache hit
+// HIT-NEXT: cache collision miss
+
+#ifdef OTHER
+# define VALUE 2
+#else
+# define VALUE 1
+#endif
+
+int value = VALUE;
@@ -0,0 +1,22 @@
+// RUN: rm -rf %t.cache %t.dir
+// RUN: mkdir -p %t.dir/first %t.dir/second
+// RUN: echo "int shadowed = 1;" > %t.dir/second/shadowed.h
+// RUN: print-cxx-entities --pasta-compile-cache=%t.cache -I%t.dir/first -I%t.dir/second %s > %t.first
+// RUN: print-cxx-entities --pasta-compile-cache=%t.cache -I%t.dir/first -I%t.dir/second %s > %t.second
+// RUN: echo "int shadowed = 2;" > %t.dir/first/shadowed.h
+// RUN: print-cxx-entities --pasta-compile-cache=%t.cache -I%t.dir/first -I%t.dir/second %s > %t.shadowed
+// RUN: FileCheck %s --check-prefix=MISS --input-file %t.first
+// RUN: FileCheck %s --check-prefix=HIT --input-file %t.second
+// RUN: FileCheck %s --check-prefix=MISS --input-file %t.shadowed
+
+// A cached job misses if a header is created at a path that the job looked up
+// and didn't find, because re-running the job would then include that header
+// instead of the one that was cached, even though none of the cached files
+// have changed.
+
+// MISS: cache miss
+// HIT: cache hit
+
+#include <shadowed.h>
+
+int value = shadowed;
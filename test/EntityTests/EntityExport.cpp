@@ -0,0 +1,50 @@
+// RUN: print-cxx-entities --pasta-entity-export --pasta-threads=1 %s > %t.serial
+// RUN: print-cxx-entities --pasta-entity-export --pasta-threads=4 %s > %t.parallel
+// RUN: diff %t.serial %t.parallel
+// RUN: FileCheck %s --input-file %t.parallel
+// RUN: print-cxx-entities --pasta-time --pasta-threads=4 %s 2>&1 | FileCheck %s --check-prefix=TIME
+
+// Exporting in parallel must produce the same entities, names, and references
+// as exporting serially. Names that aren't identifiers, e.g. those of
+// operators, constructors, and conversion functions, are printed by Clang
+// after the parallel walk. Timing the export against a loop over the accessors
+// of the walked entities must export the same number of entities.
+
+// CHECK: entity 0 {{[0-9]+}} 0 {{.*}} |{{$}}
+// CHECK-DAG: entity {{.*}} |Vec{{$}}
+// CHECK-DAG: entity {{.*}} |operator+{{$}}
+// CHECK-DAG: entity {{.*}} |operator bool{{$}}
+// CHECK-DAG: entity {{.*}} |~Vec{{$}}
+// CHECK-DAG: entity {{.*}} |Sum{{$}}
+// CHECK-DAG: entity {{.*}} |Scale{{$}}
+// CHECK: reference {{[0-9]+}} {{[0-9]+}} 1{{$}}
+
+// TIME: time entity export [[NUM:[0-9]+]] entities {{[0-9]+}}us
+// TIME: time accessor export [[NUM]] entities {{[0-9]+}}us
+
+struct Vec {
+  int x;
+  int y;
+
+  Vec(int x_, int y_) : x(x_), y(y_) {}
+  ~Vec(void) {}
+
+  Vec operator+(const Vec &that) const {
+    return Vec(x + that.x, y + that.y);
+  }
+
+  explicit operator bool(void) const {
+    return x || y;
+  }
+};
+
+int Scale(int val);
+
+int Sum(Vec a, Vec b) {
+  Vec c = a + b;
+  return c ? Scale(c.x + c.y) : 0;
+}
+
+int Scale(int val) {
+  return val * 2;
+}
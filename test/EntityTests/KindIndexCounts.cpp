@@ -0,0 +1,98 @@
+// RUN: print-cxx-entities --pasta-visitor-counts -std=c++17 -fopenmp %s > %t.visitor
+// RUN: print-cxx-entities --pasta-walk-counts -std=c++17 -fopenmp %s > %t.walk
+// RUN: print-cxx-entities --pasta-index-counts -std=c++17 -fopenmp %s > %t.index
+// RUN: diff %t.visitor %t.walk
+// RUN: diff %t.visitor %t.index
+// RUN: FileCheck %s --input-file %t.index
+
+// The kind index must contain every entity of every kind that a Clang
+// `RecursiveASTVisitor` visits, including those only reachable through types,
+// template parameter lists, lambdas, structured bindings, and captured
+// statements, and each indexed entity must be of the kind it is indexed by.
+// Indexing by a class, e.g. `TagDecl` or `Expr`, must return the entities of
+// that class and of its derived classes, in walk order.
+
+// CHECK-NOT: Wrong kind in index
+// CHECK-NOT: Wrong entities in index
+// CHECK: decl Binding 2{{$}}
+// CHECK: decl CXXConstructor {{[1-9][0-9]*$}}
+// CHECK: decl Decomposition 1{{$}}
+// CHECK: decl Enum 1{{$}}
+// CHECK: decl EnumConstant 3{{$}}
+// CHECK: decl NonTypeTemplateParm 2{{$}}
+// CHECK: decl TemplateTypeParm 1{{$}}
+// CHECK: stmt CXXForRangeStmt 1{{$}}
+// CHECK: stmt CapturedStmt {{[1-9][0-9]*$}}
+// CHECK: stmt LambdaExpr 2{{$}}
+// CHECK: stmt UnaryExprOrTypeTraitExpr 3{{$}}
+
+namespace shapes {
+
+enum class Kind { kPoint, kLine = 2, kBox = kLine * 2 };
+
+template <typename T, int N = 3>
+struct Vec {
+  T elems[N];
+  static constexpr int kBytes = sizeof(T[N]);
+
+  T Dot(const Vec &that) const {
+    T total = T();
+    for (int i = 0; i < N; ++i) {
+      total += elems[i] * that.elems[i];
+    }
+    return total;
+  }
+};
+
+struct Box {
+  int width = 1;
+  int height;
+  Kind kind{Kind::kBox};
+
+  explicit Box(int height_) : height(height_) {}
+
+  int Area(int scale = 2) const {
+    return width * height * scale;
+  }
+};
+
+template <int Size>
+int Fill(int (&arr)[Size], decltype(Size) value) {
+  for (int &elem : arr) {
+    elem = value;
+  }
+  return static_cast<int>(sizeof(int[Size]) / sizeof(int));
+}
+
+}  // namespace shapes
+
+struct Pair {
+  int first;
+  int second;
+};
+
+int UseBindings(Pair p) {
+  auto [a, b] = p;
+  return a * b;
+}
+
+int UseLambdas(int x) {
+  int y = 3;
+  auto add = [x, &y] (int z) { return x + y + z; };
+  auto scaled = [factor = x * 2] (int z) { return factor * z; };
+  return add(1) + scaled(2);
+}
+
+int UseBox(void) {
+  shapes::Box box(4);
+  return box.Area() + box.Area(3);
+}
+
+int UseOpenMP(int n) {
+  int total = 0;
+#pragma omp parallel
+  {
+    total += n;
+  }
+  return total;
+}
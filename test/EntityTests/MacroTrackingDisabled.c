@@ -0,0 +1,44 @@
+// RUN: print-c-entities --pasta-parsed-locations %s > %t.enabled
+// RUN: print-c-entities --pasta-parsed-locations --pasta-no-macro-tracking %s > %t.disabled
+// RUN: diff %t.enabled %t.disabled
+// RUN: FileCheck %s --input-file %t.disabled
+// RUN: print-c-entities --pasta-time %s 2>&1 | FileCheck %s --check-prefix=TIME
+
+// Running a compile job without macro tracking must parse the same tokens, at
+// the same file locations, as running it with macro tracking. Macro expansion
+// tokens are located at their spellings in both cases. Stringification and
+// concatenation are avoided, as their tokens are spelled in scratch space.
+
+// CHECK: token @{{[0-9]+}}:{{[0-9]+}} |kTable
+// CHECK: token @{{[0-9]+}}:{{[0-9]+}} |Scale
+// CHECK: token @{{[0-9]+}}:{{[0-9]+}} |kLimit
+
+// TIME: time run with macro tracking {{[0-9]+}}us
+// TIME: time run without macro tracking {{[0-9]+}}us
+
+#define ID(x) x
+#define ADD(a, b) (ID(a) + ID(b))
+#define TWICE(x) ADD(x, x)
+#define QUAD(x) TWICE(TWICE(x))
+#define CALL(f, ...) f(__VA_ARGS__)
+#define EMPTY
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+
+#if defined(ADD) && TWICE(1) == 2
+# define kSize QUAD(1)
+#else
+# define kSize 1
+#endif
+
+static const int kTable[kSize] = {ID(1), ADD(2, 3), TWICE(ID(4)), QUAD(5)};
+
+static int Scale(int x, int y) {
+  return MAX(x, y) * TWICE(EMPTY 2);
+}
+
+#undef ID
+#define ID(x) (x)
+
+int kLimit(void) {
+  return CALL(Scale, ID(kSize), kTable[ID(0)]) + CALL(Scale, 1, 2);
+}
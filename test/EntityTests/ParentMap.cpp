@@ -0,0 +1,40 @@
+// RUN: print-cxx-entities --pasta-check-parents -std=c++17 %s > %t
+// RUN: FileCheck %s --input-file %t
+
+// The parent map must agree with the parents observed while walking, for
+// every declaration and statement, including expressions that are only
+// reachable through written types. The counts of parent/child kind pairs
+// depend on the implicit nodes that Clang makes, and so only the presence of
+// each pair is checked.
+
+// CHECK-NOT: Wrong parent
+// CHECK: parent CXXMethod CompoundStmt {{[1-9][0-9]*$}}
+// CHECK: parent Field DeclRefExpr {{[1-9][0-9]*$}}
+// CHECK: parent Function CompoundStmt {{[1-9][0-9]*$}}
+// CHECK: parent ParmVar DeclRefExpr {{[1-9][0-9]*$}}
+// CHECK: parent Typedef BinaryOperator {{[1-9][0-9]*$}}
+// CHECK: parent Var BinaryOperator {{[1-9][0-9]*$}}
+// CHECK: parent Var CXXConstructExpr {{[1-9][0-9]*$}}
+// CHECK: parent Var IntegerLiteral {{[1-9][0-9]*$}}
+// CHECK: parent Var LambdaExpr {{[1-9][0-9]*$}}
+// CHECK: parent Var UnaryExprOrTypeTraitExpr {{[1-9][0-9]*$}}
+// CHECK: Checked {{[0-9]+}} entities
+
+constexpr int kCount = 4;
+
+decltype(kCount + 1) next = 5;
+
+typedef decltype(kCount * 3) Triple;
+
+template <int N>
+struct Fixed {
+  int value = N;
+};
+
+Fixed<sizeof(long)> fixed;
+
+int Scale(decltype(kCount) factor) {
+  return factor * 2;
+}
+
+auto twice = [] (int v) { return v * 2; };
@@ -0,0 +1,35 @@
+// RUN: print-c-entities --pasta-parsed-tokens --pasta-macros %s > %t.run
+// RUN: print-c-entities --pasta-parsed-tokens --pasta-macros --pasta-preprocess-only %s > %t.preprocessed
+// RUN: diff %t.run %t.preprocessed
+// RUN: FileCheck %s --input-file %t.preprocessed
+
+// Only preprocessing a compile job must produce the same parsed files, tokens,
+// and macros as running it, even though nothing is parsed.
+
+// CHECK: file {{.*}}PreprocessOnly.c
+// CHECK: token {{[0-9]+}} {{.*}} |kTable
+// CHECK: macro 0 kDefineDirective
+// CHECK: macro {{[0-9]+}} kExpansion
+// CHECK: macro {{[0-9]+}} kToken <{{[0-9]+}} |CAT
+
+#define ID(x) x
+#define ADD(a, b) (ID(a) + ID(b))
+#define STR(x) #x
+#define CAT(a, b) a ## b
+#define TWICE(x) ADD(x, x)
+
+#if defined(ADD) && TWICE(1) == 2
+# define kSize TWICE(2)
+#else
+# define kSize 1
+#endif
+
+static const int kTable[kSize] = {ID(1), ADD(2, 3), TWICE(ID(4)), CAT(1, 0)};
+static const char kName[] = STR(kTable);
+
+#undef ID
+#define ID(x) (x)
+
+int CAT(Get, Size)(void) {
+  return ID(kSize) + (int) sizeof(kName);
+}
@@ -0,0 +1,82 @@
+// RUN: print-cxx-entities --pasta-snapshot-entities -std=c++20 %s > %t
+// RUN: FileCheck %s --input-file %t
+
+// Snapshotting calls every scalar getter of an entity, some of which have
+// preconditions, e.g. only bit-fields have bit widths, and only lambda classes
+// have lambda indexes. Every declaration and statement in this file must be
+// snapshotted without tripping over those preconditions.
+
+// CHECK-DAG: decl CXXRecord {{[0-9]+}}
+// CHECK-DAG: decl ClassTemplate 3{{$}}
+// CHECK-DAG: decl Concept 1{{$}}
+// CHECK-DAG: decl Field {{[0-9]+}}
+// CHECK-DAG: decl TemplateTemplateParm 1{{$}}
+// CHECK-DAG: stmt CallExpr {{[0-9]+}}
+// CHECK-DAG: stmt ChooseExpr 1{{$}}
+// CHECK-DAG: stmt ConceptSpecializationExpr {{[0-9]+}}
+// CHECK-DAG: stmt GenericSelectionExpr 2{{$}}
+// CHECK-DAG: stmt LambdaExpr 2{{$}}
+// CHECK-DAG: stmt RequiresExpr 1{{$}}
+// CHECK-DAG: field flag 1 1{{$}}
+// CHECK-DAG: field kind 1 3{{$}}
+// CHECK-DAG: field count 0 0{{$}}
+// CHECK-DAG: field dependent 1 0{{$}}
+
+struct Flags {
+  unsigned flag : 1;
+  unsigned kind : 3;
+  unsigned : 0;
+  int count;
+};
+
+template <unsigned N>
+struct Bits {
+  unsigned dependent : N;
+};
+
+struct Empty {};
+
+struct Holder {
+  [[no_unique_address]] Empty empty;
+  int value;
+};
+
+template <typename T>
+concept Addable = requires (T a, T b) {
+  a + b;
+};
+
+template <typename T>
+  requires Addable<T>
+T Add(T a, T b) {
+  return a + b;
+}
+
+void Consume(int);
+
+template <typename T>
+void Forward(T val) {
+  Consume(val);
+  (void) _Generic(val, int: 1, default: 0);
+}
+
+template <template <typename> class C>
+struct Wrap {
+  C<int> wrapped;
+};
+
+template <typename T>
+struct Box {
+  T value;
+};
+
+Wrap<Box> wrapped_box;
+
+int Use(void) {
+  auto add = [] (int a, int b) { return a + b; };
+  auto generic = [] (auto a) { return a; };
+  Forward(1);
+  int x = __builtin_choose_expr(1, 2, 3);
+  int y = _Generic(x, int: 4, default: 5);
+  return add(x, y) + generic(Add(1, 2)) + Bits<4>{}.dependent;
+}
@@ -0,0 +1,23 @@
+// RUN: print-cxx-entities --pasta-parsed-tokens %s > %t.ast
+// RUN: print-cxx-entities --pasta-token-snapshot=%t.snapshot %s > %t.loaded
+// RUN: diff %t.ast %t.loaded
+// RUN: FileCheck %s --input-file %t.loaded
+
+// A token snapshot that is written to a file, and then memory-mapped back in,
+// must have the same parsed files and tokens as the AST it was made from. The
+// system header makes the snapshot big enough to be memory-mapped, rather than
+// read into memory.
+
+// CHECK: file {{.*}}TokenSnapshotRoundTrip.cpp
+// CHECK: token {{[0-9]+}} {{.*}} |kAnswer
+// CHECK: token {{[0-9]+}} {{.*}} |ADD
+
+#include <stdint.h>
+
+#define ADD(a, b) ((a) + (b))
+
+static const int64_t kAnswer = ADD(40, 2);
+
+int32_t Answer(void) {
+  return static_cast<int32_t>(ADD(kAnswer, 0));
+}
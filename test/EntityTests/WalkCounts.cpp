@@ -0,0 +1,66 @@
+// RUN: print-cxx-entities --pasta-visitor-counts -std=c++17 -fopenmp %s > %t.visitor
+// RUN: print-cxx-entities --pasta-walk-counts -std=c++17 -fopenmp %s > %t.serial
+// RUN: print-cxx-entities --pasta-walk-counts --pasta-threads=4 -std=c++17 -fopenmp %s > %t.parallel
+// RUN: diff %t.visitor %t.serial
+// RUN: diff %t.serial %t.parallel
+// RUN: FileCheck %s --input-file %t.serial
+
+// The walker must reach the template parameters of templates, the bindings of
+// structured bindings, the classes and call operators of lambdas, the captured
+// declarations of OpenMP regions, and the expressions in written types, and it
+// must not walk any entity twice. The counts of every kind are checked against
+// those of a Clang `RecursiveASTVisitor`; the counts below are only those that
+// follow directly from the source.
+
+// CHECK-NOT: Walked twice
+// CHECK: decl Binding 2{{$}}
+// CHECK: decl CXXMethod {{[1-9][0-9]*$}}
+// CHECK: decl Captured {{[1-9][0-9]*$}}
+// CHECK: decl Decomposition 1{{$}}
+// CHECK: decl NonTypeTemplateParm 1{{$}}
+// CHECK: decl TemplateTypeParm 2{{$}}
+// CHECK: stmt CapturedStmt {{[1-9][0-9]*$}}
+// CHECK: stmt LambdaExpr 2{{$}}
+// CHECK: stmt OMPParallelDirective 1{{$}}
+// CHECK: stmt UnaryExprOrTypeTraitExpr 1{{$}}
+
+template <typename T, int N = 4>
+struct Array {
+  T elems[N];
+  static constexpr int kSize = sizeof(T[N]);
+};
+
+template <typename T>
+T Sum(const Array<T, 3> &arr) {
+  T total = T();
+  for (const T &elem : arr.elems) {
+    total += elem;
+  }
+  return total;
+}
+
+struct Pair {
+  int first;
+  int second;
+};
+
+int UseBindings(Pair p) {
+  auto [a, b] = p;
+  return a + b;
+}
+
+int UseLambdas(int x) {
+  int y = 2;
+  auto add = [x, &y] (int z) { return x + y + z; };
+  auto init = [w = x + 1] (void) { return w; };
+  return add(1) + init();
+}
+
+int UseOpenMP(int n) {
+  int total = 0;
+#pragma omp parallel
+  {
+    total += n;
+  }
+  return total;
+}
@@ -0,0 +1,39 @@
+// Anchored matching must produce the same alignment as greedy matching alone,
+// including when the same tokens repeat many times, and when macros expand to
+// tokens that also appear outside of any expansion.
+//
+// RUN: print-c-tokens --pasta-contexts --pasta-align --pasta-no-anchors %s > %t.greedy
+// RUN: print-c-tokens --pasta-contexts --pasta-align %s > %t.anchored
+// RUN: diff %t.greedy %t.anchored
+// RUN: FileCheck %s --input-file %t.anchored
+
+// CHECK-NOT: Alignment error
+
+#define ZERO 0
+#define ONE 1
+#define ADD(a, b) ((a) + (b))
+#define ROW(x) ADD(x, ONE), ADD(x, ZERO), x, x
+#define FIELD(name) int name;
+
+struct repeated {
+  FIELD(a)
+  FIELD(b)
+  int c;
+  FIELD(d)
+};
+
+int table[] = {
+  ROW(0), ROW(1), ROW(ONE), ROW(ZERO),
+  ROW(0), ROW(1), ROW(ONE), ROW(ZERO),
+  0, 1, 0, 1, ZERO, ONE, ZERO, ONE,
+  ROW(0), ROW(1), ROW(ONE), ROW(ZERO),
+  ADD(ADD(0, 1), ADD(ONE, ZERO)),
+};
+
+int unique_anchor(int x) {
+  int y = ADD(x, ONE);
+  if (y == ZERO) {
+    return ADD(y, y);
+  }
+  return table[ONE] + table[0];
+}
@@ -0,0 +1,29 @@
+// RUN: print-c-entities --pasta-check-derivations %s > %t
+// RUN: FileCheck %s --input-file %t
+
+// The derivation depths and file locations of tokens, which are looked up in
+// tables, must match following each token's derived locations by hand. Nested
+// expansions, arguments that are themselves expanded, and stringification all
+// make chains that are more than one token long.
+
+// CHECK-NOT: Wrong
+// CHECK: depth 0 {{[0-9]+}}
+// CHECK: depth 1 {{[0-9]+}}
+// CHECK: depth {{([2-9]|[1-9][0-9]+)}} {{[0-9]+}}
+// CHECK-NOT: Wrong
+// CHECK: Checked {{[0-9]+}} tokens
+
+#define ID(x) x
+#define ADD(x, y) ((x) + (y))
+#define TWICE(x) ADD(x, x)
+#define QUAD(x) TWICE(TWICE(x))
+#define STR_(x) #x
+#define STR(x) STR_(x)
+#define CAT_(a, b) a ## b
+#define CAT(a, b) CAT_(a, b)
+
+int one = ID(1);
+int four = QUAD(ID(1));
+int nested = ADD(TWICE(2), ID(ADD(3, 4)));
+const char *name = STR(QUAD(one));
+int CAT(var_, 5) = CAT(fo, ur);
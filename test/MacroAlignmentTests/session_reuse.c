@@ -0,0 +1,30 @@
+// Re-using one alignment session across many declarations must align them the
+// same way as spreading them across many sessions, even when the same tokens
+// repeat many times within and across declarations.
+//
+// RUN: print-c-tokens --pasta-contexts --pasta-align-top-level-decls --pasta-threads=1 %s > %t.one
+// RUN: print-c-tokens --pasta-contexts --pasta-align-top-level-decls --pasta-threads=8 %s > %t.many
+// RUN: diff %t.one %t.many
+// RUN: FileCheck %s --input-file %t.one
+
+// CHECK-NOT: Alignment error
+// CHECK: first @{{.*}}VarDecl
+// CHECK: 1 @IntegerLiteral
+// CHECK: second @{{.*}}VarDecl
+// CHECK: 1 @IntegerLiteral
+// CHECK: pick @{{.*}}FunctionDecl
+
+#define ONE 1
+#define PAIR(x) x, ONE
+#define QUAD(x) PAIR(x), PAIR(x)
+
+int first[] = {ONE, 1, QUAD(1), QUAD(ONE), 1, 1, 1, ONE};
+int second[] = {1, ONE, QUAD(ONE), QUAD(1), ONE, ONE, 1, 1};
+int third[] = {QUAD(QUAD(1)), 1, 1, 1, 1, ONE, ONE, ONE, ONE};
+
+int pick(int i) {
+  if (i == ONE) {
+    return first[1] + second[ONE] + third[1];
+  }
+  return first[ONE] + second[1] + third[ONE] + ONE + 1;
+}
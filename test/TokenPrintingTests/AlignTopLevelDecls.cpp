@@ -0,0 +1,34 @@
+// Aligning each top-level declaration separately must keep every parsed token,
+// including those between declarations, and must give every declaration's
+// tokens a context, even when declarations share tokens.
+//
+// RUN: print-cxx-tokens --pasta-align %s > %t.whole
+// RUN: print-cxx-tokens --pasta-align-top-level-decls %s > %t.serial
+// RUN: print-cxx-tokens --pasta-align-top-level-decls --pasta-threads=4 %s > %t.parallel
+// RUN: diff %t.whole %t.serial
+// RUN: diff %t.serial %t.parallel
+// RUN: print-cxx-tokens --pasta-contexts --pasta-align-top-level-decls %s | FileCheck %s
+
+// CHECK-NOT: Alignment error
+// CHECK: struct @
+// CHECK: x @{{.*}}FieldDecl
+// CHECK: a @{{.*}}VarDecl
+// CHECK: b @{{.*}}VarDecl
+// CHECK: ;
+// CHECK: ;
+// CHECK: int @
+// CHECK: c @{{.*}}VarDecl
+// CHECK: d @{{.*}}VarDecl
+// CHECK: f @{{.*}}FunctionDecl
+
+struct {
+  int x;
+} a, b;
+
+;
+
+int c, d;
+
+int f(void) {
+  return a.x + b.x + c + d;
+}
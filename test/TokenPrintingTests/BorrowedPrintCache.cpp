@@ -0,0 +1,27 @@
+// RUN: print-cxx-tokens --pasta-contexts --pasta-top-level-decls %s > %t.owned
+// RUN: print-cxx-tokens --pasta-contexts --pasta-borrowed %s > %t.borrowed
+// RUN: print-cxx-tokens --pasta-contexts --pasta-borrowed --pasta-print-cache %s > %t.borrowed-cached
+// RUN: diff %t.owned %t.borrowed
+// RUN: diff %t.owned %t.borrowed-cached
+// RUN: FileCheck %s --input-file %t.borrowed-cached
+
+// Printing a declaration through the view of a borrowed handle must produce the
+// same tokens and contexts as printing it through an owning handle, with or
+// without the AST's print cache.
+
+// CHECK: template
+// CHECK: Box
+// CHECK: get
+// CHECK: Box
+// CHECK: int
+// CHECK: unbox
+
+template <typename T>
+struct Box {
+  T value;
+  T get(void) const { return value; }
+};
+
+int unbox(const Box<int> &b) {
+  return b.get();
+}
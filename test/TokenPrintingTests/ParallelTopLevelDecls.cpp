@@ -0,0 +1,59 @@
+// RUN: print-cxx-tokens --pasta-contexts %s > %t.serial
+// RUN: print-cxx-tokens --pasta-contexts --pasta-threads=1 %s > %t.one
+// RUN: print-cxx-tokens --pasta-contexts --pasta-threads=4 %s > %t.four
+// RUN: diff %t.serial %t.one
+// RUN: diff %t.serial %t.four
+// RUN: FileCheck %s --input-file %t.four
+
+// Printing the top-level declarations in parallel must produce the same tokens
+// and contexts as printing the translation unit serially. Literals are printed
+// as written, and anonymous tags are printed, which both query the source
+// manager from each printing thread.
+
+// CHECK: int
+// CHECK: hex
+// CHECK: =
+// CHECK: 0x2A
+// CHECK: double
+// CHECK: flt
+// CHECK: =
+// CHECK: 1.50e3
+
+int hex = 0x2A;
+double flt = 1.50e3;
+unsigned long ul = 42ul;
+float f = .5f;
+char c = '\x41';
+
+struct {
+  int x;
+} anon_a, anon_b;
+
+union {
+  int i;
+  float f;
+} anon_u;
+
+enum { kA = 0b101, kB = 010, kC } anon_e;
+
+static int Add(int a, int b) {
+  return a + b + 0x10 + 017;
+}
+
+namespace ns {
+struct S {
+  int v = 100'000;
+  double d = 2.5e-3;
+  int Get(void) const { return v * 0xFF; }
+};
+}  // namespace ns
+
+template <typename T>
+T Twice(T t) {
+  return t * 2 + T(1.0e0);
+}
+
+int UseAll(void) {
+  ns::S s;
+  return Add(s.Get(), hex) + static_cast<int>(Twice(flt)) + kC;
+}
@@ -0,0 +1,39 @@
+// RUN: print-cxx-tokens --pasta-contexts --pasta-top-level-decls %s > %t.uncached
+// RUN: print-cxx-tokens --pasta-contexts --pasta-print-cache %s > %t.cached
+// RUN: diff %t.uncached %t.cached
+// RUN: FileCheck %s --input-file %t.cached
+
+// Printing a declaration whose printed tokens come from the AST's print cache
+// must produce the same tokens and contexts as printing it afresh.
+
+// CHECK: struct
+// CHECK: Point
+// CHECK: int
+// CHECK: x
+// CHECK: typedef
+// CHECK: Point
+// CHECK: Pt
+
+struct Point {
+  int x;
+  int y;
+};
+
+typedef struct Point Pt;
+
+static int Dot(const Pt &a, const Pt &b) {
+  return a.x * b.x + a.y * b.y;
+}
+
+template <typename T>
+struct Box {
+  T value;
+  T Get(void) const { return value; }
+};
+
+Box<int> int_box = {1};
+Box<Pt> pt_box = {{1, 2}};
+
+int UseAll(void) {
+  return Dot(pt_box.Get(), pt_box.value) + int_box.Get();
+}
@@ -0,0 +1,20 @@
+// RUN: print-cxx-tokens --pasta-contexts --pasta-top-level-decls %s > %t.ranges
+// RUN: print-cxx-tokens --pasta-contexts --pasta-rope %s > %t.rope
+// RUN: diff %t.ranges %t.rope
+// RUN: print-cxx-tokens --pasta-deep-rope=200000 %s | FileCheck %s -check-prefix=DEEP
+
+// Flattening a rope of printed declarations must produce the same tokens and
+// contexts as the printed declarations themselves, even after the flattened
+// ranges of intermediate ropes have been released. Destroying a very long rope
+// must not overflow the stack.
+
+// DEEP: Deep rope of 200000 segments
+
+int a = 1;
+int b = a + 2;
+
+struct S {
+  int x;
+};
+
+S s = {b};
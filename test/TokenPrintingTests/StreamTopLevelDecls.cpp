@@ -0,0 +1,62 @@
+// RUN: print-cxx-tokens --pasta-contexts %s > %t.create
+// RUN: print-cxx-tokens --pasta-contexts --pasta-stream %s > %t.stream
+// RUN: diff %t.create %t.stream
+// RUN: FileCheck %s --input-file %t.stream
+
+// Streaming the translation unit in chunks must produce the same tokens and
+// contexts as printing it in one go. Each flush drops the contexts of the
+// flushed chunk, and so contexts that are shared across top-level
+// declarations, e.g. those of tags and typedefs that are used by later
+// declarations, must be re-created in later chunks rather than re-used.
+
+// CHECK: Point @{{.*}}CXXRecordDecl
+// CHECK: PointT @{{.*}}TypedefDecl
+// CHECK: canvas_a @{{.*}}VarDecl
+// CHECK: Child @{{.*}}CXXRecordDecl
+// CHECK: MakeNode @{{.*}}FunctionDecl
+
+struct Point {
+  int x;
+  int y;
+};
+
+typedef struct Point PointT;
+typedef PointT *PointPtr;
+
+struct {
+  PointT origin;
+  PointPtr cursor;
+} canvas_a, canvas_b;
+
+enum Color { kRed, kGreen };
+typedef enum Color ColorT;
+
+namespace outer {
+namespace inner {
+struct Node {
+  struct Child {
+    ColorT color;
+    PointT where;
+  } child;
+  Node *next;
+};
+typedef Node NodeT;
+}  // namespace inner
+
+inner::NodeT MakeNode(PointT p) {
+  inner::NodeT n = {};
+  n.child.where = p;
+  n.child.color = kGreen;
+  return n;
+}
+}  // namespace outer
+
+PointT Translate(PointPtr p, PointT by) {
+  PointT out = {p->x + by.x, p->y + by.y};
+  return out;
+}
+
+int UseAll(void) {
+  outer::inner::NodeT n = outer::MakeNode(canvas_a.origin);
+  return Translate(&n.child.where, canvas_b.origin).x;
+}
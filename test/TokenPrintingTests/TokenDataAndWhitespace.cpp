@@ -0,0 +1,23 @@
+// RUN: print-cxx-tokens --pasta-whitespace %s | FileCheck %s
+
+// Printed tokens keep their exact data, including data that contains escaped
+// NUL characters, and their leading new lines and indentation.
+
+// CHECK: {{[0-9]+}} {{[0-9]+}} |const
+// CHECK-NEXT: 0 1 |char
+// CHECK-NEXT: 0 1 |*
+// CHECK-NEXT: 0 0 |str
+// CHECK-NEXT: 0 1 |=
+// CHECK-NEXT: 0 1 |"a\0b\0a much longer string literal than most other tokens"
+// CHECK-NEXT: 0 0 |;
+// CHECK: 0 1 |{
+// CHECK-NEXT: 1 {{[1-9][0-9]*}} |return
+// CHECK-NEXT: 0 1 |a_rather_long_identifier_for_a_parameter
+// CHECK-NEXT: 0 0 |;
+// CHECK-NEXT: 1 0 |}
+
+const char *str = "a\0b\0a much longer string literal than most other tokens";
+
+int Identity(int a_rather_long_identifier_for_a_parameter) {
+  return a_rather_long_identifier_for_a_parameter;
+}
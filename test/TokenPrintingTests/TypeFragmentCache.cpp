@@ -0,0 +1,86 @@
+// RUN: print-cxx-tokens --pasta-contexts %s > %t.cached
+// RUN: print-cxx-tokens --pasta-contexts --pasta-no-type-cache %s > %t.uncached
+// RUN: diff %t.cached %t.uncached
+// RUN: print-cxx-tokens --pasta-contexts --pasta-alternate-policies %s > %t.alt.cached
+// RUN: print-cxx-tokens --pasta-contexts --pasta-alternate-policies --pasta-no-type-cache %s > %t.alt.uncached
+// RUN: diff %t.alt.cached %t.alt.uncached
+// RUN: FileCheck %s --input-file %t.cached
+
+// Re-using the tokens printed for a type within a print must produce the same
+// tokens and contexts as re-printing the type, no matter the qualifiers, the
+// typedef sugar, template arguments, or the printing policy, which changes both
+// within a print (e.g. when printing a tag body) and between prints.
+
+// CHECK: typedef
+// CHECK: const
+// CHECK: volatile
+// CHECK: int
+// CHECK: CVInt
+
+typedef const volatile int CVInt;
+typedef CVInt *CVIntPtr;
+typedef CVIntPtr const CVIntPtrConst;
+
+CVInt a = 1;
+const CVInt b = 2;
+CVIntPtr c = nullptr;
+CVIntPtrConst d = nullptr;
+const int *const *volatile e = nullptr;
+int *__restrict f = nullptr;
+
+struct Pair {
+  struct Inner {
+    CVInt x;
+  } first, second;
+  Inner third;
+  struct Inner *fourth;
+};
+
+struct { Pair p; CVInt q; } anon_a, anon_b;
+struct Pair pairs[2][3];
+
+typedef struct Named {
+  int n;
+} Named, *NamedPtr;
+
+Named n1;
+struct Named n2;
+NamedPtr n3;
+
+template <typename T, typename U = const T *>
+struct Holder {
+  T value;
+  U pointer;
+  Holder<T, U> *self;
+  Holder *injected;
+};
+
+Holder<int> h1;
+Holder<const int> h2;
+Holder<int, int> h3;
+Holder<Holder<CVInt>> h4;
+
+namespace outer {
+namespace inner {
+struct Scoped {
+  int s;
+};
+}  // namespace inner
+inner::Scoped scoped_a;
+}  // namespace outer
+
+outer::inner::Scoped scoped_b;
+
+int (*FuncPtr(int (*)(CVInt, const CVInt *)))(Holder<int> &, CVInt);
+
+void UseAll(CVInt x, const CVInt &y, CVIntPtr z, Holder<int> h) {
+  CVInt local = x;
+  const CVInt *ptr = &y;
+  Holder<int> copy = h;
+  Holder<const int> other = {};
+  (void) local;
+  (void) ptr;
+  (void) z;
+  (void) copy;
+  (void) other;
+}
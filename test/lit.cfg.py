@@ -60,6 +60,18 @@ tools = [
                      'PrintTokens', 'print-tokens'),
         extra_args=["-x", "c"]),
 
+    ToolSubst(
+        "print-cxx-entities",
+        os.path.join(config.pasta_obj_root, 'bin',
+                     'PrintEntities', 'print-entities'),
+        extra_args=["-x", "c++"]),
+
+    ToolSubst(
+        "print-c-entities",
+        os.path.join(config.pasta_obj_root, 'bin',
+                     'PrintEntities', 'print-entities'),
+        extra_args=["-x", "c"]),
+
     ToolSubst(
         "print-aligned-substitutions",
         os.path.join(config.pasta_obj_root, 'bin',